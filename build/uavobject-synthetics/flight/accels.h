@@ -0,0 +1,134 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup Accels Accels
+ * @brief The accelerometer sensor data, rotated into body frame.
+ *
+ *
+ * @file       accels.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the Accels object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: accels.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef ACCELS_H
+#define ACCELS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ACCELS_OBJID 0xDD9D5FC0
+#define ACCELS_ISSINGLEINST 1
+#define ACCELS_ISSETTINGS 0
+#define ACCELS_ISSEQLOCKED 1
+#define ACCELS_NUMBYTES 16
+
+// Generic interface functions
+int32_t AccelsInitialize();
+UAVObjHandle AccelsHandle();
+void AccelsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float x;
+    float y;
+    float z;
+    float temperature;
+
+} __attribute__((packed)) __attribute__((aligned(4))) AccelsData;
+
+// Typesafe Object access functions
+/**
+ * @function AccelsGet(dataOut)
+ * @brief Populate a AccelsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t AccelsGet(AccelsData *dataOut) { return UAVObjGetData(AccelsHandle(), dataOut); }
+
+static inline int32_t AccelsSet(const AccelsData *dataIn) { return UAVObjSetData(AccelsHandle(), dataIn); }
+
+static inline int32_t AccelsInstGet(uint16_t instId, AccelsData *dataOut) { return UAVObjGetInstanceData(AccelsHandle(), instId, dataOut); }
+
+static inline int32_t AccelsInstSet(uint16_t instId, const AccelsData *dataIn) { return UAVObjSetInstanceData(AccelsHandle(), instId, dataIn); }
+
+static inline int32_t AccelsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(AccelsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AccelsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(AccelsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AccelsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(AccelsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AccelsConnectCopy(volatile AccelsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	AccelsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(AccelsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t AccelsCreateInstance() { return UAVObjCreateInstance(AccelsHandle(), &AccelsSetDefaults); }
+
+static inline void AccelsUpdated() { UAVObjUpdated(AccelsHandle()); }
+
+static inline void AccelsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(AccelsHandle(), instId); }
+
+static inline int32_t AccelsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(AccelsHandle(), dataOut); }
+
+static inline int32_t AccelsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(AccelsHandle(), dataIn); }
+
+static inline int8_t AccelsReadOnly() { return UAVObjReadOnly(AccelsHandle()); }
+
+static inline uint16_t AccelsGetNumInstances(){ return UAVObjGetNumInstances(AccelsHandle()); }
+
+static inline uint32_t AccelsGetNumBytes(){ return UAVObjGetNumBytes(AccelsHandle()); }
+
+// Field information
+// Field x information
+// Field y information
+// Field z information
+// Field temperature information
+
+
+// set/Get functions
+extern void AccelsxSet( float *Newx );
+extern void AccelsxGet( float *Newx );
+extern void AccelsySet( float *Newy );
+extern void AccelsyGet( float *Newy );
+extern void AccelszSet( float *Newz );
+extern void AccelszGet( float *Newz );
+extern void AccelstemperatureSet( float *Newtemperature );
+extern void AccelstemperatureGet( float *Newtemperature );
+
+
+#endif // ACCELS_H
+
+/**
+ * @}
+ * @}
+ */
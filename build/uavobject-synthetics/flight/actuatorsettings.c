@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       actuatorsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the ActuatorSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: actuatorsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "actuatorsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ActuatorSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ACTUATORSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ACTUATORSETTINGS_OBJID,
+			ACTUATORSETTINGS_ISSINGLEINST, ACTUATORSETTINGS_ISSETTINGS, ACTUATORSETTINGS_ISSEQLOCKED,
+			ACTUATORSETTINGS_NUMBYTES, &ActuatorSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void ActuatorSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	ActuatorSettingsData data = {};
+
+	data.LowPowerStabilizationMaxPowerAdd = 0.07;
+	data.LowPowerStabilizationMaxTime = 0;
+	data.MotorInputOutputCurveFit = 0.9;
+	data.TimerUpdateFreq[0] = 50;
+	data.TimerUpdateFreq[1] = 50;
+	data.TimerUpdateFreq[2] = 50;
+	data.TimerUpdateFreq[3] = 50;
+	data.TimerUpdateFreq[4] = 50;
+	data.TimerUpdateFreq[5] = 50;
+	data.ChannelMax[0] = 0;
+	data.ChannelMax[1] = 0;
+	data.ChannelMax[2] = 0;
+	data.ChannelMax[3] = 0;
+	data.ChannelMax[4] = 0;
+	data.ChannelMax[5] = 0;
+	data.ChannelMax[6] = 0;
+	data.ChannelMax[7] = 0;
+	data.ChannelMax[8] = 0;
+	data.ChannelMax[9] = 0;
+	data.ChannelNeutral[0] = 0;
+	data.ChannelNeutral[1] = 0;
+	data.ChannelNeutral[2] = 0;
+	data.ChannelNeutral[3] = 0;
+	data.ChannelNeutral[4] = 0;
+	data.ChannelNeutral[5] = 0;
+	data.ChannelNeutral[6] = 0;
+	data.ChannelNeutral[7] = 0;
+	data.ChannelNeutral[8] = 0;
+	data.ChannelNeutral[9] = 0;
+	data.ChannelMin[0] = 0;
+	data.ChannelMin[1] = 0;
+	data.ChannelMin[2] = 0;
+	data.ChannelMin[3] = 0;
+	data.ChannelMin[4] = 0;
+	data.ChannelMin[5] = 0;
+	data.ChannelMin[6] = 0;
+	data.ChannelMin[7] = 0;
+	data.ChannelMin[8] = 0;
+	data.ChannelMin[9] = 0;
+	data.ChannelType[0] = 0;
+	data.ChannelType[1] = 0;
+	data.ChannelType[2] = 0;
+	data.ChannelType[3] = 0;
+	data.ChannelType[4] = 0;
+	data.ChannelType[5] = 0;
+	data.ChannelType[6] = 0;
+	data.ChannelType[7] = 0;
+	data.ChannelType[8] = 0;
+	data.ChannelType[9] = 0;
+	data.MotorsSpinWhileArmed = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void ActuatorSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ActuatorSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	ActuatorSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		ActuatorSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ActuatorSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ActuatorSettingsLowPowerStabilizationMaxPowerAddSet( float *NewLowPowerStabilizationMaxPowerAdd )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxPowerAdd, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxPowerAdd), sizeof(float));
+}
+void ActuatorSettingsLowPowerStabilizationMaxPowerAddGet( float *NewLowPowerStabilizationMaxPowerAdd )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxPowerAdd, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxPowerAdd), sizeof(float));
+}
+void ActuatorSettingsLowPowerStabilizationMaxTimeSet( float *NewLowPowerStabilizationMaxTime )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxTime, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxTime), sizeof(float));
+}
+void ActuatorSettingsLowPowerStabilizationMaxTimeGet( float *NewLowPowerStabilizationMaxTime )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewLowPowerStabilizationMaxTime, offsetof( ActuatorSettingsData, LowPowerStabilizationMaxTime), sizeof(float));
+}
+void ActuatorSettingsMotorInputOutputCurveFitSet( float *NewMotorInputOutputCurveFit )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewMotorInputOutputCurveFit, offsetof( ActuatorSettingsData, MotorInputOutputCurveFit), sizeof(float));
+}
+void ActuatorSettingsMotorInputOutputCurveFitGet( float *NewMotorInputOutputCurveFit )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewMotorInputOutputCurveFit, offsetof( ActuatorSettingsData, MotorInputOutputCurveFit), sizeof(float));
+}
+void ActuatorSettingsTimerUpdateFreqSet( uint16_t *NewTimerUpdateFreq )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewTimerUpdateFreq, offsetof( ActuatorSettingsData, TimerUpdateFreq), 6*sizeof(uint16_t));
+}
+void ActuatorSettingsTimerUpdateFreqGet( uint16_t *NewTimerUpdateFreq )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewTimerUpdateFreq, offsetof( ActuatorSettingsData, TimerUpdateFreq), 6*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMaxSet( uint16_t *NewChannelMax )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelMax, offsetof( ActuatorSettingsData, ChannelMax), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMaxGet( uint16_t *NewChannelMax )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelMax, offsetof( ActuatorSettingsData, ChannelMax), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelNeutralSet( uint16_t *NewChannelNeutral )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelNeutral, offsetof( ActuatorSettingsData, ChannelNeutral), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelNeutralGet( uint16_t *NewChannelNeutral )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelNeutral, offsetof( ActuatorSettingsData, ChannelNeutral), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMinSet( uint16_t *NewChannelMin )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelMin, offsetof( ActuatorSettingsData, ChannelMin), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelMinGet( uint16_t *NewChannelMin )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelMin, offsetof( ActuatorSettingsData, ChannelMin), 10*sizeof(uint16_t));
+}
+void ActuatorSettingsChannelTypeSet( uint8_t *NewChannelType )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewChannelType, offsetof( ActuatorSettingsData, ChannelType), 10*sizeof(uint8_t));
+}
+void ActuatorSettingsChannelTypeGet( uint8_t *NewChannelType )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewChannelType, offsetof( ActuatorSettingsData, ChannelType), 10*sizeof(uint8_t));
+}
+void ActuatorSettingsMotorsSpinWhileArmedSet( uint8_t *NewMotorsSpinWhileArmed )
+{
+	UAVObjSetDataField(ActuatorSettingsHandle(), (void*)NewMotorsSpinWhileArmed, offsetof( ActuatorSettingsData, MotorsSpinWhileArmed), sizeof(uint8_t));
+}
+void ActuatorSettingsMotorsSpinWhileArmedGet( uint8_t *NewMotorsSpinWhileArmed )
+{
+	UAVObjGetDataField(ActuatorSettingsHandle(), (void*)NewMotorsSpinWhileArmed, offsetof( ActuatorSettingsData, MotorsSpinWhileArmed), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
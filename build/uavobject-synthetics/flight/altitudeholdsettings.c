@@ -0,0 +1,203 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       altitudeholdsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AltitudeHoldSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: altitudeholdsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "altitudeholdsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AltitudeHoldSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ALTITUDEHOLDSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ALTITUDEHOLDSETTINGS_OBJID,
+			ALTITUDEHOLDSETTINGS_ISSINGLEINST, ALTITUDEHOLDSETTINGS_ISSETTINGS, ALTITUDEHOLDSETTINGS_ISSEQLOCKED,
+			ALTITUDEHOLDSETTINGS_NUMBYTES, &AltitudeHoldSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AltitudeHoldSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AltitudeHoldSettingsData data = {};
+
+	data.PositionKp = 0.8;
+	data.VelocityKp = 0.2;
+	data.VelocityKi = 0.25;
+	data.AttitudeComp = 120;
+	data.MaxClimbRate = 40;
+	data.MaxDescentRate = 15;
+	data.Expo = 40;
+	data.Deadband = 30;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AltitudeHoldSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AltitudeHoldSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AltitudeHoldSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AltitudeHoldSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AltitudeHoldSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AltitudeHoldSettingsPositionKpSet( float *NewPositionKp )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewPositionKp, offsetof( AltitudeHoldSettingsData, PositionKp), sizeof(float));
+}
+void AltitudeHoldSettingsPositionKpGet( float *NewPositionKp )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewPositionKp, offsetof( AltitudeHoldSettingsData, PositionKp), sizeof(float));
+}
+void AltitudeHoldSettingsVelocityKpSet( float *NewVelocityKp )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewVelocityKp, offsetof( AltitudeHoldSettingsData, VelocityKp), sizeof(float));
+}
+void AltitudeHoldSettingsVelocityKpGet( float *NewVelocityKp )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewVelocityKp, offsetof( AltitudeHoldSettingsData, VelocityKp), sizeof(float));
+}
+void AltitudeHoldSettingsVelocityKiSet( float *NewVelocityKi )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewVelocityKi, offsetof( AltitudeHoldSettingsData, VelocityKi), sizeof(float));
+}
+void AltitudeHoldSettingsVelocityKiGet( float *NewVelocityKi )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewVelocityKi, offsetof( AltitudeHoldSettingsData, VelocityKi), sizeof(float));
+}
+void AltitudeHoldSettingsAttitudeCompSet( uint16_t *NewAttitudeComp )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewAttitudeComp, offsetof( AltitudeHoldSettingsData, AttitudeComp), sizeof(uint16_t));
+}
+void AltitudeHoldSettingsAttitudeCompGet( uint16_t *NewAttitudeComp )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewAttitudeComp, offsetof( AltitudeHoldSettingsData, AttitudeComp), sizeof(uint16_t));
+}
+void AltitudeHoldSettingsMaxClimbRateSet( uint8_t *NewMaxClimbRate )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewMaxClimbRate, offsetof( AltitudeHoldSettingsData, MaxClimbRate), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsMaxClimbRateGet( uint8_t *NewMaxClimbRate )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewMaxClimbRate, offsetof( AltitudeHoldSettingsData, MaxClimbRate), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsMaxDescentRateSet( uint8_t *NewMaxDescentRate )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewMaxDescentRate, offsetof( AltitudeHoldSettingsData, MaxDescentRate), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsMaxDescentRateGet( uint8_t *NewMaxDescentRate )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewMaxDescentRate, offsetof( AltitudeHoldSettingsData, MaxDescentRate), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsExpoSet( uint8_t *NewExpo )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewExpo, offsetof( AltitudeHoldSettingsData, Expo), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsExpoGet( uint8_t *NewExpo )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewExpo, offsetof( AltitudeHoldSettingsData, Expo), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsDeadbandSet( uint8_t *NewDeadband )
+{
+	UAVObjSetDataField(AltitudeHoldSettingsHandle(), (void*)NewDeadband, offsetof( AltitudeHoldSettingsData, Deadband), sizeof(uint8_t));
+}
+void AltitudeHoldSettingsDeadbandGet( uint8_t *NewDeadband )
+{
+	UAVObjGetDataField(AltitudeHoldSettingsHandle(), (void*)NewDeadband, offsetof( AltitudeHoldSettingsData, Deadband), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
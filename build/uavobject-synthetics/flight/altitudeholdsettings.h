@@ -0,0 +1,150 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup AltitudeHoldSettings AltitudeHoldSettings
+ * @brief Settings for the @ref AltitudeHold module
+ *
+ *
+ * @file       altitudeholdsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the AltitudeHoldSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: altitudeholdsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef ALTITUDEHOLDSETTINGS_H
+#define ALTITUDEHOLDSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ALTITUDEHOLDSETTINGS_OBJID 0x96E3903C
+#define ALTITUDEHOLDSETTINGS_ISSINGLEINST 1
+#define ALTITUDEHOLDSETTINGS_ISSETTINGS 1
+#define ALTITUDEHOLDSETTINGS_ISSEQLOCKED 0
+#define ALTITUDEHOLDSETTINGS_NUMBYTES 18
+
+// Generic interface functions
+int32_t AltitudeHoldSettingsInitialize();
+UAVObjHandle AltitudeHoldSettingsHandle();
+void AltitudeHoldSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float PositionKp;
+    float VelocityKp;
+    float VelocityKi;
+    uint16_t AttitudeComp;
+    uint8_t MaxClimbRate;
+    uint8_t MaxDescentRate;
+    uint8_t Expo;
+    uint8_t Deadband;
+
+} __attribute__((packed)) __attribute__((aligned(4))) AltitudeHoldSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function AltitudeHoldSettingsGet(dataOut)
+ * @brief Populate a AltitudeHoldSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t AltitudeHoldSettingsGet(AltitudeHoldSettingsData *dataOut) { return UAVObjGetData(AltitudeHoldSettingsHandle(), dataOut); }
+
+static inline int32_t AltitudeHoldSettingsSet(const AltitudeHoldSettingsData *dataIn) { return UAVObjSetData(AltitudeHoldSettingsHandle(), dataIn); }
+
+static inline int32_t AltitudeHoldSettingsInstGet(uint16_t instId, AltitudeHoldSettingsData *dataOut) { return UAVObjGetInstanceData(AltitudeHoldSettingsHandle(), instId, dataOut); }
+
+static inline int32_t AltitudeHoldSettingsInstSet(uint16_t instId, const AltitudeHoldSettingsData *dataIn) { return UAVObjSetInstanceData(AltitudeHoldSettingsHandle(), instId, dataIn); }
+
+static inline int32_t AltitudeHoldSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(AltitudeHoldSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AltitudeHoldSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(AltitudeHoldSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AltitudeHoldSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(AltitudeHoldSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t AltitudeHoldSettingsConnectCopy(volatile AltitudeHoldSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	AltitudeHoldSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(AltitudeHoldSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t AltitudeHoldSettingsCreateInstance() { return UAVObjCreateInstance(AltitudeHoldSettingsHandle(), &AltitudeHoldSettingsSetDefaults); }
+
+static inline void AltitudeHoldSettingsUpdated() { UAVObjUpdated(AltitudeHoldSettingsHandle()); }
+
+static inline void AltitudeHoldSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(AltitudeHoldSettingsHandle(), instId); }
+
+static inline int32_t AltitudeHoldSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(AltitudeHoldSettingsHandle(), dataOut); }
+
+static inline int32_t AltitudeHoldSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(AltitudeHoldSettingsHandle(), dataIn); }
+
+static inline int8_t AltitudeHoldSettingsReadOnly() { return UAVObjReadOnly(AltitudeHoldSettingsHandle()); }
+
+static inline uint16_t AltitudeHoldSettingsGetNumInstances(){ return UAVObjGetNumInstances(AltitudeHoldSettingsHandle()); }
+
+static inline uint32_t AltitudeHoldSettingsGetNumBytes(){ return UAVObjGetNumBytes(AltitudeHoldSettingsHandle()); }
+
+// Field information
+// Field PositionKp information
+// Field VelocityKp information
+// Field VelocityKi information
+// Field AttitudeComp information
+// Field MaxClimbRate information
+// Field MaxDescentRate information
+// Field Expo information
+// Field Deadband information
+
+
+// set/Get functions
+extern void AltitudeHoldSettingsPositionKpSet( float *NewPositionKp );
+extern void AltitudeHoldSettingsPositionKpGet( float *NewPositionKp );
+extern void AltitudeHoldSettingsVelocityKpSet( float *NewVelocityKp );
+extern void AltitudeHoldSettingsVelocityKpGet( float *NewVelocityKp );
+extern void AltitudeHoldSettingsVelocityKiSet( float *NewVelocityKi );
+extern void AltitudeHoldSettingsVelocityKiGet( float *NewVelocityKi );
+extern void AltitudeHoldSettingsAttitudeCompSet( uint16_t *NewAttitudeComp );
+extern void AltitudeHoldSettingsAttitudeCompGet( uint16_t *NewAttitudeComp );
+extern void AltitudeHoldSettingsMaxClimbRateSet( uint8_t *NewMaxClimbRate );
+extern void AltitudeHoldSettingsMaxClimbRateGet( uint8_t *NewMaxClimbRate );
+extern void AltitudeHoldSettingsMaxDescentRateSet( uint8_t *NewMaxDescentRate );
+extern void AltitudeHoldSettingsMaxDescentRateGet( uint8_t *NewMaxDescentRate );
+extern void AltitudeHoldSettingsExpoSet( uint8_t *NewExpo );
+extern void AltitudeHoldSettingsExpoGet( uint8_t *NewExpo );
+extern void AltitudeHoldSettingsDeadbandSet( uint8_t *NewDeadband );
+extern void AltitudeHoldSettingsDeadbandGet( uint8_t *NewDeadband );
+
+
+#endif // ALTITUDEHOLDSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
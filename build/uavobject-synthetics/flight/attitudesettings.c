@@ -0,0 +1,232 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       attitudesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the AttitudeSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: attitudesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "attitudesettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t AttitudeSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ATTITUDESETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ATTITUDESETTINGS_OBJID,
+			ATTITUDESETTINGS_ISSINGLEINST, ATTITUDESETTINGS_ISSETTINGS, ATTITUDESETTINGS_ISSEQLOCKED,
+			ATTITUDESETTINGS_NUMBYTES, &AttitudeSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void AttitudeSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	AttitudeSettingsData data = {};
+
+	data.MagKp = 0.05;
+	data.MagKi = 0.0001;
+	data.AccelKp = 0.05;
+	data.AccelKi = 0.0001;
+	data.AccelTau = 0.1;
+	data.VertPositionTau = 2;
+	data.YawBiasRate = 1e-06;
+	data.BoardRotation[0] = 0;
+	data.BoardRotation[1] = 0;
+	data.BoardRotation[2] = 0;
+	data.ZeroDuringArming = 1;
+	data.BiasCorrectGyro = 1;
+	data.FilterChoice = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void AttitudeSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void AttitudeSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	AttitudeSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		AttitudeSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle AttitudeSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void AttitudeSettingsMagKpSet( float *NewMagKp )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewMagKp, offsetof( AttitudeSettingsData, MagKp), sizeof(float));
+}
+void AttitudeSettingsMagKpGet( float *NewMagKp )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewMagKp, offsetof( AttitudeSettingsData, MagKp), sizeof(float));
+}
+void AttitudeSettingsMagKiSet( float *NewMagKi )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewMagKi, offsetof( AttitudeSettingsData, MagKi), sizeof(float));
+}
+void AttitudeSettingsMagKiGet( float *NewMagKi )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewMagKi, offsetof( AttitudeSettingsData, MagKi), sizeof(float));
+}
+void AttitudeSettingsAccelKpSet( float *NewAccelKp )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewAccelKp, offsetof( AttitudeSettingsData, AccelKp), sizeof(float));
+}
+void AttitudeSettingsAccelKpGet( float *NewAccelKp )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewAccelKp, offsetof( AttitudeSettingsData, AccelKp), sizeof(float));
+}
+void AttitudeSettingsAccelKiSet( float *NewAccelKi )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewAccelKi, offsetof( AttitudeSettingsData, AccelKi), sizeof(float));
+}
+void AttitudeSettingsAccelKiGet( float *NewAccelKi )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewAccelKi, offsetof( AttitudeSettingsData, AccelKi), sizeof(float));
+}
+void AttitudeSettingsAccelTauSet( float *NewAccelTau )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewAccelTau, offsetof( AttitudeSettingsData, AccelTau), sizeof(float));
+}
+void AttitudeSettingsAccelTauGet( float *NewAccelTau )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewAccelTau, offsetof( AttitudeSettingsData, AccelTau), sizeof(float));
+}
+void AttitudeSettingsVertPositionTauSet( float *NewVertPositionTau )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewVertPositionTau, offsetof( AttitudeSettingsData, VertPositionTau), sizeof(float));
+}
+void AttitudeSettingsVertPositionTauGet( float *NewVertPositionTau )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewVertPositionTau, offsetof( AttitudeSettingsData, VertPositionTau), sizeof(float));
+}
+void AttitudeSettingsYawBiasRateSet( float *NewYawBiasRate )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewYawBiasRate, offsetof( AttitudeSettingsData, YawBiasRate), sizeof(float));
+}
+void AttitudeSettingsYawBiasRateGet( float *NewYawBiasRate )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewYawBiasRate, offsetof( AttitudeSettingsData, YawBiasRate), sizeof(float));
+}
+void AttitudeSettingsBoardRotationSet( int16_t *NewBoardRotation )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewBoardRotation, offsetof( AttitudeSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AttitudeSettingsBoardRotationGet( int16_t *NewBoardRotation )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewBoardRotation, offsetof( AttitudeSettingsData, BoardRotation), 3*sizeof(int16_t));
+}
+void AttitudeSettingsZeroDuringArmingSet( uint8_t *NewZeroDuringArming )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewZeroDuringArming, offsetof( AttitudeSettingsData, ZeroDuringArming), sizeof(uint8_t));
+}
+void AttitudeSettingsZeroDuringArmingGet( uint8_t *NewZeroDuringArming )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewZeroDuringArming, offsetof( AttitudeSettingsData, ZeroDuringArming), sizeof(uint8_t));
+}
+void AttitudeSettingsBiasCorrectGyroSet( uint8_t *NewBiasCorrectGyro )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewBiasCorrectGyro, offsetof( AttitudeSettingsData, BiasCorrectGyro), sizeof(uint8_t));
+}
+void AttitudeSettingsBiasCorrectGyroGet( uint8_t *NewBiasCorrectGyro )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewBiasCorrectGyro, offsetof( AttitudeSettingsData, BiasCorrectGyro), sizeof(uint8_t));
+}
+void AttitudeSettingsFilterChoiceSet( uint8_t *NewFilterChoice )
+{
+	UAVObjSetDataField(AttitudeSettingsHandle(), (void*)NewFilterChoice, offsetof( AttitudeSettingsData, FilterChoice), sizeof(uint8_t));
+}
+void AttitudeSettingsFilterChoiceGet( uint8_t *NewFilterChoice )
+{
+	UAVObjGetDataField(AttitudeSettingsHandle(), (void*)NewFilterChoice, offsetof( AttitudeSettingsData, FilterChoice), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup ControlLatency ControlLatency
+ * @brief Time from a gyro sample being read to the actuator outputs computed from it being written.
+ *
+ *
+ * @file       controllatency.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the ControlLatency object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: controllatency.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef CONTROLLATENCY_H
+#define CONTROLLATENCY_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define CONTROLLATENCY_OBJID 0x4628F7AC
+#define CONTROLLATENCY_ISSINGLEINST 1
+#define CONTROLLATENCY_ISSETTINGS 0
+#define CONTROLLATENCY_ISSEQLOCKED 0
+#define CONTROLLATENCY_NUMBYTES 39
+
+// Generic interface functions
+int32_t ControlLatencyInitialize();
+UAVObjHandle ControlLatencyHandle();
+void ControlLatencySetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t Histogram[8];
+    float Mean;
+    uint16_t Max;
+    uint8_t FastLoop;
+
+} __attribute__((packed)) __attribute__((aligned(4))) ControlLatencyData;
+
+// Typesafe Object access functions
+/**
+ * @function ControlLatencyGet(dataOut)
+ * @brief Populate a ControlLatencyData object
+ * @param[out] dataOut 
+ */
+static inline int32_t ControlLatencyGet(ControlLatencyData *dataOut) { return UAVObjGetData(ControlLatencyHandle(), dataOut); }
+
+static inline int32_t ControlLatencySet(const ControlLatencyData *dataIn) { return UAVObjSetData(ControlLatencyHandle(), dataIn); }
+
+static inline int32_t ControlLatencyInstGet(uint16_t instId, ControlLatencyData *dataOut) { return UAVObjGetInstanceData(ControlLatencyHandle(), instId, dataOut); }
+
+static inline int32_t ControlLatencyInstSet(uint16_t instId, const ControlLatencyData *dataIn) { return UAVObjSetInstanceData(ControlLatencyHandle(), instId, dataIn); }
+
+static inline int32_t ControlLatencyConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(ControlLatencyHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ControlLatencyConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(ControlLatencyHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ControlLatencyConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(ControlLatencyHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ControlLatencyConnectCopy(volatile ControlLatencyData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	ControlLatencyGet((void *) dataOut);
+
+	return UAVObjConnectCallback(ControlLatencyHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t ControlLatencyCreateInstance() { return UAVObjCreateInstance(ControlLatencyHandle(), &ControlLatencySetDefaults); }
+
+static inline void ControlLatencyUpdated() { UAVObjUpdated(ControlLatencyHandle()); }
+
+static inline void ControlLatencyInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(ControlLatencyHandle(), instId); }
+
+static inline int32_t ControlLatencyGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(ControlLatencyHandle(), dataOut); }
+
+static inline int32_t ControlLatencySetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(ControlLatencyHandle(), dataIn); }
+
+static inline int8_t ControlLatencyReadOnly() { return UAVObjReadOnly(ControlLatencyHandle()); }
+
+static inline uint16_t ControlLatencyGetNumInstances(){ return UAVObjGetNumInstances(ControlLatencyHandle()); }
+
+static inline uint32_t ControlLatencyGetNumBytes(){ return UAVObjGetNumBytes(ControlLatencyHandle()); }
+
+// Field information
+// Field Histogram information
+/* Array element names for field Histogram */
+typedef enum { CONTROLLATENCY_HISTOGRAM_50=0, CONTROLLATENCY_HISTOGRAM_100=1, CONTROLLATENCY_HISTOGRAM_200=2, CONTROLLATENCY_HISTOGRAM_400=3, CONTROLLATENCY_HISTOGRAM_800=4, CONTROLLATENCY_HISTOGRAM_1600=5, CONTROLLATENCY_HISTOGRAM_3200=6, CONTROLLATENCY_HISTOGRAM_OVER=7 } __attribute__((packed)) ControlLatencyHistogramElem;
+/* Number of elements for field Histogram */
+#define CONTROLLATENCY_HISTOGRAM_NUMELEM 8
+// Field Mean information
+// Field Max information
+// Field FastLoop information
+/* Enumeration options for field FastLoop */
+typedef enum { CONTROLLATENCY_FASTLOOP_FALSE=0, CONTROLLATENCY_FASTLOOP_TRUE=1 }  __attribute__((packed)) ControlLatencyFastLoopOptions;
+/* Max value of any option in topmost parent FastLoop of field FastLoop */
+#define CONTROLLATENCY_FASTLOOP_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field FastLoop */
+#define CONTROLLATENCY_FASTLOOP_MAXOPTVAL 1
+/* Ensure field FastLoop contains valid data */
+static inline bool ControlLatencyFastLoopIsValid( uint8_t CurrentFastLoop ) { return CurrentFastLoop < CONTROLLATENCY_FASTLOOP_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void ControlLatencyHistogramSet( uint32_t *NewHistogram );
+extern void ControlLatencyHistogramGet( uint32_t *NewHistogram );
+extern void ControlLatencyMeanSet( float *NewMean );
+extern void ControlLatencyMeanGet( float *NewMean );
+extern void ControlLatencyMaxSet( uint16_t *NewMax );
+extern void ControlLatencyMaxGet( uint16_t *NewMax );
+extern void ControlLatencyFastLoopSet( uint8_t *NewFastLoop );
+extern void ControlLatencyFastLoopGet( uint8_t *NewFastLoop );
+
+
+#endif // CONTROLLATENCY_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,195 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       eventdispatcherstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the EventDispatcherStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: eventdispatcherstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "eventdispatcherstats.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t EventDispatcherStatsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(EVENTDISPATCHERSTATS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(EVENTDISPATCHERSTATS_OBJID,
+			EVENTDISPATCHERSTATS_ISSINGLEINST, EVENTDISPATCHERSTATS_ISSETTINGS, EVENTDISPATCHERSTATS_ISSEQLOCKED,
+			EVENTDISPATCHERSTATS_NUMBYTES, &EventDispatcherStatsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void EventDispatcherStatsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	EventDispatcherStatsData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void EventDispatcherStatsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 5000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 5000;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void EventDispatcherStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	EventDispatcherStatsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		EventDispatcherStatsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle EventDispatcherStatsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void EventDispatcherStatsDispatchedSet( uint32_t *NewDispatched )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewDispatched, offsetof( EventDispatcherStatsData, Dispatched), sizeof(uint32_t));
+}
+void EventDispatcherStatsDispatchedGet( uint32_t *NewDispatched )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewDispatched, offsetof( EventDispatcherStatsData, Dispatched), sizeof(uint32_t));
+}
+void EventDispatcherStatsCoalescedSet( uint32_t *NewCoalesced )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewCoalesced, offsetof( EventDispatcherStatsData, Coalesced), sizeof(uint32_t));
+}
+void EventDispatcherStatsCoalescedGet( uint32_t *NewCoalesced )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewCoalesced, offsetof( EventDispatcherStatsData, Coalesced), sizeof(uint32_t));
+}
+void EventDispatcherStatsSuppressedSet( uint32_t *NewSuppressed )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewSuppressed, offsetof( EventDispatcherStatsData, Suppressed), sizeof(uint32_t));
+}
+void EventDispatcherStatsSuppressedGet( uint32_t *NewSuppressed )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewSuppressed, offsetof( EventDispatcherStatsData, Suppressed), sizeof(uint32_t));
+}
+void EventDispatcherStatsDroppedSet( uint32_t *NewDropped )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewDropped, offsetof( EventDispatcherStatsData, Dropped), sizeof(uint32_t));
+}
+void EventDispatcherStatsDroppedGet( uint32_t *NewDropped )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewDropped, offsetof( EventDispatcherStatsData, Dropped), sizeof(uint32_t));
+}
+void EventDispatcherStatsDroppedObjectIDSet( uint32_t *NewDroppedObjectID )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewDroppedObjectID, offsetof( EventDispatcherStatsData, DroppedObjectID), 4*sizeof(uint32_t));
+}
+void EventDispatcherStatsDroppedObjectIDGet( uint32_t *NewDroppedObjectID )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewDroppedObjectID, offsetof( EventDispatcherStatsData, DroppedObjectID), 4*sizeof(uint32_t));
+}
+void EventDispatcherStatsDroppedObjectCountSet( uint16_t *NewDroppedObjectCount )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewDroppedObjectCount, offsetof( EventDispatcherStatsData, DroppedObjectCount), 4*sizeof(uint16_t));
+}
+void EventDispatcherStatsDroppedObjectCountGet( uint16_t *NewDroppedObjectCount )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewDroppedObjectCount, offsetof( EventDispatcherStatsData, DroppedObjectCount), 4*sizeof(uint16_t));
+}
+void EventDispatcherStatsBacklogDepthSet( uint8_t *NewBacklogDepth )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewBacklogDepth, offsetof( EventDispatcherStatsData, BacklogDepth), sizeof(uint8_t));
+}
+void EventDispatcherStatsBacklogDepthGet( uint8_t *NewBacklogDepth )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewBacklogDepth, offsetof( EventDispatcherStatsData, BacklogDepth), sizeof(uint8_t));
+}
+void EventDispatcherStatsBacklogHighWaterSet( uint8_t *NewBacklogHighWater )
+{
+	UAVObjSetDataField(EventDispatcherStatsHandle(), (void*)NewBacklogHighWater, offsetof( EventDispatcherStatsData, BacklogHighWater), sizeof(uint8_t));
+}
+void EventDispatcherStatsBacklogHighWaterGet( uint8_t *NewBacklogHighWater )
+{
+	UAVObjGetDataField(EventDispatcherStatsHandle(), (void*)NewBacklogHighWater, offsetof( EventDispatcherStatsData, BacklogHighWater), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,154 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup EventDispatcherStats EventDispatcherStats
+ * @brief Object manager event dispatch statistics since boot.  Events raised from within object callbacks wait in a bounded backlog until the running callback returns.
+ *
+ *
+ * @file       eventdispatcherstats.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the EventDispatcherStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: eventdispatcherstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTDISPATCHERSTATS_H
+#define EVENTDISPATCHERSTATS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define EVENTDISPATCHERSTATS_OBJID 0x61D618B4
+#define EVENTDISPATCHERSTATS_ISSINGLEINST 1
+#define EVENTDISPATCHERSTATS_ISSETTINGS 0
+#define EVENTDISPATCHERSTATS_ISSEQLOCKED 0
+#define EVENTDISPATCHERSTATS_NUMBYTES 42
+
+// Generic interface functions
+int32_t EventDispatcherStatsInitialize();
+UAVObjHandle EventDispatcherStatsHandle();
+void EventDispatcherStatsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t Dispatched;
+    uint32_t Coalesced;
+    uint32_t Suppressed;
+    uint32_t Dropped;
+    uint32_t DroppedObjectID[4];
+    uint16_t DroppedObjectCount[4];
+    uint8_t BacklogDepth;
+    uint8_t BacklogHighWater;
+
+} __attribute__((packed)) __attribute__((aligned(4))) EventDispatcherStatsData;
+
+// Typesafe Object access functions
+/**
+ * @function EventDispatcherStatsGet(dataOut)
+ * @brief Populate a EventDispatcherStatsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t EventDispatcherStatsGet(EventDispatcherStatsData *dataOut) { return UAVObjGetData(EventDispatcherStatsHandle(), dataOut); }
+
+static inline int32_t EventDispatcherStatsSet(const EventDispatcherStatsData *dataIn) { return UAVObjSetData(EventDispatcherStatsHandle(), dataIn); }
+
+static inline int32_t EventDispatcherStatsInstGet(uint16_t instId, EventDispatcherStatsData *dataOut) { return UAVObjGetInstanceData(EventDispatcherStatsHandle(), instId, dataOut); }
+
+static inline int32_t EventDispatcherStatsInstSet(uint16_t instId, const EventDispatcherStatsData *dataIn) { return UAVObjSetInstanceData(EventDispatcherStatsHandle(), instId, dataIn); }
+
+static inline int32_t EventDispatcherStatsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(EventDispatcherStatsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t EventDispatcherStatsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(EventDispatcherStatsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t EventDispatcherStatsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(EventDispatcherStatsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t EventDispatcherStatsConnectCopy(volatile EventDispatcherStatsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	EventDispatcherStatsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(EventDispatcherStatsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t EventDispatcherStatsCreateInstance() { return UAVObjCreateInstance(EventDispatcherStatsHandle(), &EventDispatcherStatsSetDefaults); }
+
+static inline void EventDispatcherStatsUpdated() { UAVObjUpdated(EventDispatcherStatsHandle()); }
+
+static inline void EventDispatcherStatsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(EventDispatcherStatsHandle(), instId); }
+
+static inline int32_t EventDispatcherStatsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(EventDispatcherStatsHandle(), dataOut); }
+
+static inline int32_t EventDispatcherStatsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(EventDispatcherStatsHandle(), dataIn); }
+
+static inline int8_t EventDispatcherStatsReadOnly() { return UAVObjReadOnly(EventDispatcherStatsHandle()); }
+
+static inline uint16_t EventDispatcherStatsGetNumInstances(){ return UAVObjGetNumInstances(EventDispatcherStatsHandle()); }
+
+static inline uint32_t EventDispatcherStatsGetNumBytes(){ return UAVObjGetNumBytes(EventDispatcherStatsHandle()); }
+
+// Field information
+// Field Dispatched information
+// Field Coalesced information
+// Field Suppressed information
+// Field Dropped information
+// Field DroppedObjectID information
+/* Number of elements for field DroppedObjectID */
+#define EVENTDISPATCHERSTATS_DROPPEDOBJECTID_NUMELEM 4
+// Field DroppedObjectCount information
+/* Number of elements for field DroppedObjectCount */
+#define EVENTDISPATCHERSTATS_DROPPEDOBJECTCOUNT_NUMELEM 4
+// Field BacklogDepth information
+// Field BacklogHighWater information
+
+
+// set/Get functions
+extern void EventDispatcherStatsDispatchedSet( uint32_t *NewDispatched );
+extern void EventDispatcherStatsDispatchedGet( uint32_t *NewDispatched );
+extern void EventDispatcherStatsCoalescedSet( uint32_t *NewCoalesced );
+extern void EventDispatcherStatsCoalescedGet( uint32_t *NewCoalesced );
+extern void EventDispatcherStatsSuppressedSet( uint32_t *NewSuppressed );
+extern void EventDispatcherStatsSuppressedGet( uint32_t *NewSuppressed );
+extern void EventDispatcherStatsDroppedSet( uint32_t *NewDropped );
+extern void EventDispatcherStatsDroppedGet( uint32_t *NewDropped );
+extern void EventDispatcherStatsDroppedObjectIDSet( uint32_t *NewDroppedObjectID );
+extern void EventDispatcherStatsDroppedObjectIDGet( uint32_t *NewDroppedObjectID );
+extern void EventDispatcherStatsDroppedObjectCountSet( uint16_t *NewDroppedObjectCount );
+extern void EventDispatcherStatsDroppedObjectCountGet( uint16_t *NewDroppedObjectCount );
+extern void EventDispatcherStatsBacklogDepthSet( uint8_t *NewBacklogDepth );
+extern void EventDispatcherStatsBacklogDepthGet( uint8_t *NewBacklogDepth );
+extern void EventDispatcherStatsBacklogHighWaterSet( uint8_t *NewBacklogHighWater );
+extern void EventDispatcherStatsBacklogHighWaterGet( uint8_t *NewBacklogHighWater );
+
+
+#endif // EVENTDISPATCHERSTATS_H
+
+/**
+ * @}
+ * @}
+ */
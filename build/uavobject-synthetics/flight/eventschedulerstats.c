@@ -0,0 +1,171 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       eventschedulerstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the EventSchedulerStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: eventschedulerstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "eventschedulerstats.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t EventSchedulerStatsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(EVENTSCHEDULERSTATS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(EVENTSCHEDULERSTATS_OBJID,
+			EVENTSCHEDULERSTATS_ISSINGLEINST, EVENTSCHEDULERSTATS_ISSETTINGS, EVENTSCHEDULERSTATS_ISSEQLOCKED,
+			EVENTSCHEDULERSTATS_NUMBYTES, &EventSchedulerStatsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void EventSchedulerStatsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	EventSchedulerStatsData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void EventSchedulerStatsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 1000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 1000;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void EventSchedulerStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	EventSchedulerStatsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		EventSchedulerStatsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle EventSchedulerStatsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void EventSchedulerStatsFiredSet( uint32_t *NewFired )
+{
+	UAVObjSetDataField(EventSchedulerStatsHandle(), (void*)NewFired, offsetof( EventSchedulerStatsData, Fired), sizeof(uint32_t));
+}
+void EventSchedulerStatsFiredGet( uint32_t *NewFired )
+{
+	UAVObjGetDataField(EventSchedulerStatsHandle(), (void*)NewFired, offsetof( EventSchedulerStatsData, Fired), sizeof(uint32_t));
+}
+void EventSchedulerStatsWorstObjectIDSet( uint32_t *NewWorstObjectID )
+{
+	UAVObjSetDataField(EventSchedulerStatsHandle(), (void*)NewWorstObjectID, offsetof( EventSchedulerStatsData, WorstObjectID), 8*sizeof(uint32_t));
+}
+void EventSchedulerStatsWorstObjectIDGet( uint32_t *NewWorstObjectID )
+{
+	UAVObjGetDataField(EventSchedulerStatsHandle(), (void*)NewWorstObjectID, offsetof( EventSchedulerStatsData, WorstObjectID), 8*sizeof(uint32_t));
+}
+void EventSchedulerStatsEntriesSet( uint16_t *NewEntries )
+{
+	UAVObjSetDataField(EventSchedulerStatsHandle(), (void*)NewEntries, offsetof( EventSchedulerStatsData, Entries), sizeof(uint16_t));
+}
+void EventSchedulerStatsEntriesGet( uint16_t *NewEntries )
+{
+	UAVObjGetDataField(EventSchedulerStatsHandle(), (void*)NewEntries, offsetof( EventSchedulerStatsData, Entries), sizeof(uint16_t));
+}
+void EventSchedulerStatsWorstPeriodSet( uint16_t *NewWorstPeriod )
+{
+	UAVObjSetDataField(EventSchedulerStatsHandle(), (void*)NewWorstPeriod, offsetof( EventSchedulerStatsData, WorstPeriod), 8*sizeof(uint16_t));
+}
+void EventSchedulerStatsWorstPeriodGet( uint16_t *NewWorstPeriod )
+{
+	UAVObjGetDataField(EventSchedulerStatsHandle(), (void*)NewWorstPeriod, offsetof( EventSchedulerStatsData, WorstPeriod), 8*sizeof(uint16_t));
+}
+void EventSchedulerStatsWorstJitterSet( uint16_t *NewWorstJitter )
+{
+	UAVObjSetDataField(EventSchedulerStatsHandle(), (void*)NewWorstJitter, offsetof( EventSchedulerStatsData, WorstJitter), 8*sizeof(uint16_t));
+}
+void EventSchedulerStatsWorstJitterGet( uint16_t *NewWorstJitter )
+{
+	UAVObjGetDataField(EventSchedulerStatsHandle(), (void*)NewWorstJitter, offsetof( EventSchedulerStatsData, WorstJitter), 8*sizeof(uint16_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
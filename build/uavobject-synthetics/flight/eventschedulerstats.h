@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup EventSchedulerStats EventSchedulerStats
+ * @brief Periodic event scheduler statistics.  Jitter is how late an event fired, measured over the time since the previous update of this object.
+ *
+ *
+ * @file       eventschedulerstats.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the EventSchedulerStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: eventschedulerstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef EVENTSCHEDULERSTATS_H
+#define EVENTSCHEDULERSTATS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define EVENTSCHEDULERSTATS_OBJID 0xD3EE4636
+#define EVENTSCHEDULERSTATS_ISSINGLEINST 1
+#define EVENTSCHEDULERSTATS_ISSETTINGS 0
+#define EVENTSCHEDULERSTATS_ISSEQLOCKED 0
+#define EVENTSCHEDULERSTATS_NUMBYTES 70
+
+// Generic interface functions
+int32_t EventSchedulerStatsInitialize();
+UAVObjHandle EventSchedulerStatsHandle();
+void EventSchedulerStatsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t Fired;
+    uint32_t WorstObjectID[8];
+    uint16_t Entries;
+    uint16_t WorstPeriod[8];
+    uint16_t WorstJitter[8];
+
+} __attribute__((packed)) __attribute__((aligned(4))) EventSchedulerStatsData;
+
+// Typesafe Object access functions
+/**
+ * @function EventSchedulerStatsGet(dataOut)
+ * @brief Populate a EventSchedulerStatsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t EventSchedulerStatsGet(EventSchedulerStatsData *dataOut) { return UAVObjGetData(EventSchedulerStatsHandle(), dataOut); }
+
+static inline int32_t EventSchedulerStatsSet(const EventSchedulerStatsData *dataIn) { return UAVObjSetData(EventSchedulerStatsHandle(), dataIn); }
+
+static inline int32_t EventSchedulerStatsInstGet(uint16_t instId, EventSchedulerStatsData *dataOut) { return UAVObjGetInstanceData(EventSchedulerStatsHandle(), instId, dataOut); }
+
+static inline int32_t EventSchedulerStatsInstSet(uint16_t instId, const EventSchedulerStatsData *dataIn) { return UAVObjSetInstanceData(EventSchedulerStatsHandle(), instId, dataIn); }
+
+static inline int32_t EventSchedulerStatsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(EventSchedulerStatsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t EventSchedulerStatsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(EventSchedulerStatsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t EventSchedulerStatsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(EventSchedulerStatsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t EventSchedulerStatsConnectCopy(volatile EventSchedulerStatsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	EventSchedulerStatsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(EventSchedulerStatsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t EventSchedulerStatsCreateInstance() { return UAVObjCreateInstance(EventSchedulerStatsHandle(), &EventSchedulerStatsSetDefaults); }
+
+static inline void EventSchedulerStatsUpdated() { UAVObjUpdated(EventSchedulerStatsHandle()); }
+
+static inline void EventSchedulerStatsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(EventSchedulerStatsHandle(), instId); }
+
+static inline int32_t EventSchedulerStatsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(EventSchedulerStatsHandle(), dataOut); }
+
+static inline int32_t EventSchedulerStatsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(EventSchedulerStatsHandle(), dataIn); }
+
+static inline int8_t EventSchedulerStatsReadOnly() { return UAVObjReadOnly(EventSchedulerStatsHandle()); }
+
+static inline uint16_t EventSchedulerStatsGetNumInstances(){ return UAVObjGetNumInstances(EventSchedulerStatsHandle()); }
+
+static inline uint32_t EventSchedulerStatsGetNumBytes(){ return UAVObjGetNumBytes(EventSchedulerStatsHandle()); }
+
+// Field information
+// Field Fired information
+// Field WorstObjectID information
+/* Number of elements for field WorstObjectID */
+#define EVENTSCHEDULERSTATS_WORSTOBJECTID_NUMELEM 8
+// Field Entries information
+// Field WorstPeriod information
+/* Number of elements for field WorstPeriod */
+#define EVENTSCHEDULERSTATS_WORSTPERIOD_NUMELEM 8
+// Field WorstJitter information
+/* Number of elements for field WorstJitter */
+#define EVENTSCHEDULERSTATS_WORSTJITTER_NUMELEM 8
+
+
+// set/Get functions
+extern void EventSchedulerStatsFiredSet( uint32_t *NewFired );
+extern void EventSchedulerStatsFiredGet( uint32_t *NewFired );
+extern void EventSchedulerStatsWorstObjectIDSet( uint32_t *NewWorstObjectID );
+extern void EventSchedulerStatsWorstObjectIDGet( uint32_t *NewWorstObjectID );
+extern void EventSchedulerStatsEntriesSet( uint16_t *NewEntries );
+extern void EventSchedulerStatsEntriesGet( uint16_t *NewEntries );
+extern void EventSchedulerStatsWorstPeriodSet( uint16_t *NewWorstPeriod );
+extern void EventSchedulerStatsWorstPeriodGet( uint16_t *NewWorstPeriod );
+extern void EventSchedulerStatsWorstJitterSet( uint16_t *NewWorstJitter );
+extern void EventSchedulerStatsWorstJitterGet( uint16_t *NewWorstJitter );
+
+
+#endif // EVENTSCHEDULERSTATS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,253 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       fixedwingpathfollowersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the FixedWingPathFollowerSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: fixedwingpathfollowersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "fixedwingpathfollowersettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FixedWingPathFollowerSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(FIXEDWINGPATHFOLLOWERSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(FIXEDWINGPATHFOLLOWERSETTINGS_OBJID,
+			FIXEDWINGPATHFOLLOWERSETTINGS_ISSINGLEINST, FIXEDWINGPATHFOLLOWERSETTINGS_ISSETTINGS, FIXEDWINGPATHFOLLOWERSETTINGS_ISSEQLOCKED,
+			FIXEDWINGPATHFOLLOWERSETTINGS_NUMBYTES, &FixedWingPathFollowerSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void FixedWingPathFollowerSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	FixedWingPathFollowerSettingsData data = {};
+
+	data.HorizontalPosP = 0.6;
+	data.VerticalPosP = 0.05;
+	data.BearingPI[0] = 0.6;
+	data.BearingPI[1] = 0;
+	data.BearingPI[2] = 0;
+	data.PowerPI[0] = 1.5;
+	data.PowerPI[1] = 0.15;
+	data.PowerPI[2] = 20;
+	data.VerticalToPitchCrossFeed[0] = 5;
+	data.VerticalToPitchCrossFeed[1] = 10;
+	data.AirspeedToVerticalCrossFeed[0] = 10;
+	data.AirspeedToVerticalCrossFeed[1] = 100;
+	data.SpeedPI[0] = 0.01;
+	data.SpeedPI[1] = 0.01;
+	data.SpeedPI[2] = 0.8;
+	data.RollLimit[0] = -35;
+	data.RollLimit[1] = 0;
+	data.RollLimit[2] = 35;
+	data.PitchLimit[0] = -10;
+	data.PitchLimit[1] = 0;
+	data.PitchLimit[2] = 10;
+	data.ThrottleLimit[0] = 0;
+	data.ThrottleLimit[1] = 0.5;
+	data.ThrottleLimit[2] = 1;
+	data.OrbitRadius = 50;
+	data.UpdatePeriod = 100;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void FixedWingPathFollowerSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FixedWingPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	FixedWingPathFollowerSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		FixedWingPathFollowerSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FixedWingPathFollowerSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void FixedWingPathFollowerSettingsHorizontalPosPSet( float *NewHorizontalPosP )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewHorizontalPosP, offsetof( FixedWingPathFollowerSettingsData, HorizontalPosP), sizeof(float));
+}
+void FixedWingPathFollowerSettingsHorizontalPosPGet( float *NewHorizontalPosP )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewHorizontalPosP, offsetof( FixedWingPathFollowerSettingsData, HorizontalPosP), sizeof(float));
+}
+void FixedWingPathFollowerSettingsVerticalPosPSet( float *NewVerticalPosP )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewVerticalPosP, offsetof( FixedWingPathFollowerSettingsData, VerticalPosP), sizeof(float));
+}
+void FixedWingPathFollowerSettingsVerticalPosPGet( float *NewVerticalPosP )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewVerticalPosP, offsetof( FixedWingPathFollowerSettingsData, VerticalPosP), sizeof(float));
+}
+void FixedWingPathFollowerSettingsBearingPISet( float *NewBearingPI )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewBearingPI, offsetof( FixedWingPathFollowerSettingsData, BearingPI), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsBearingPIGet( float *NewBearingPI )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewBearingPI, offsetof( FixedWingPathFollowerSettingsData, BearingPI), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsPowerPISet( float *NewPowerPI )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewPowerPI, offsetof( FixedWingPathFollowerSettingsData, PowerPI), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsPowerPIGet( float *NewPowerPI )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewPowerPI, offsetof( FixedWingPathFollowerSettingsData, PowerPI), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsVerticalToPitchCrossFeedSet( float *NewVerticalToPitchCrossFeed )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewVerticalToPitchCrossFeed, offsetof( FixedWingPathFollowerSettingsData, VerticalToPitchCrossFeed), 2*sizeof(float));
+}
+void FixedWingPathFollowerSettingsVerticalToPitchCrossFeedGet( float *NewVerticalToPitchCrossFeed )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewVerticalToPitchCrossFeed, offsetof( FixedWingPathFollowerSettingsData, VerticalToPitchCrossFeed), 2*sizeof(float));
+}
+void FixedWingPathFollowerSettingsAirspeedToVerticalCrossFeedSet( float *NewAirspeedToVerticalCrossFeed )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewAirspeedToVerticalCrossFeed, offsetof( FixedWingPathFollowerSettingsData, AirspeedToVerticalCrossFeed), 2*sizeof(float));
+}
+void FixedWingPathFollowerSettingsAirspeedToVerticalCrossFeedGet( float *NewAirspeedToVerticalCrossFeed )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewAirspeedToVerticalCrossFeed, offsetof( FixedWingPathFollowerSettingsData, AirspeedToVerticalCrossFeed), 2*sizeof(float));
+}
+void FixedWingPathFollowerSettingsSpeedPISet( float *NewSpeedPI )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewSpeedPI, offsetof( FixedWingPathFollowerSettingsData, SpeedPI), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsSpeedPIGet( float *NewSpeedPI )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewSpeedPI, offsetof( FixedWingPathFollowerSettingsData, SpeedPI), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsRollLimitSet( float *NewRollLimit )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewRollLimit, offsetof( FixedWingPathFollowerSettingsData, RollLimit), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsRollLimitGet( float *NewRollLimit )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewRollLimit, offsetof( FixedWingPathFollowerSettingsData, RollLimit), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsPitchLimitSet( float *NewPitchLimit )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewPitchLimit, offsetof( FixedWingPathFollowerSettingsData, PitchLimit), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsPitchLimitGet( float *NewPitchLimit )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewPitchLimit, offsetof( FixedWingPathFollowerSettingsData, PitchLimit), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsThrottleLimitSet( float *NewThrottleLimit )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewThrottleLimit, offsetof( FixedWingPathFollowerSettingsData, ThrottleLimit), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsThrottleLimitGet( float *NewThrottleLimit )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewThrottleLimit, offsetof( FixedWingPathFollowerSettingsData, ThrottleLimit), 3*sizeof(float));
+}
+void FixedWingPathFollowerSettingsOrbitRadiusSet( float *NewOrbitRadius )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewOrbitRadius, offsetof( FixedWingPathFollowerSettingsData, OrbitRadius), sizeof(float));
+}
+void FixedWingPathFollowerSettingsOrbitRadiusGet( float *NewOrbitRadius )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewOrbitRadius, offsetof( FixedWingPathFollowerSettingsData, OrbitRadius), sizeof(float));
+}
+void FixedWingPathFollowerSettingsUpdatePeriodSet( int16_t *NewUpdatePeriod )
+{
+	UAVObjSetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewUpdatePeriod, offsetof( FixedWingPathFollowerSettingsData, UpdatePeriod), sizeof(int16_t));
+}
+void FixedWingPathFollowerSettingsUpdatePeriodGet( int16_t *NewUpdatePeriod )
+{
+	UAVObjGetDataField(FixedWingPathFollowerSettingsHandle(), (void*)NewUpdatePeriod, offsetof( FixedWingPathFollowerSettingsData, UpdatePeriod), sizeof(int16_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,216 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       flightbatterysettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the FlightBatterySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flightbatterysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "flightbatterysettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightBatterySettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(FLIGHTBATTERYSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(FLIGHTBATTERYSETTINGS_OBJID,
+			FLIGHTBATTERYSETTINGS_ISSINGLEINST, FLIGHTBATTERYSETTINGS_ISSETTINGS, FLIGHTBATTERYSETTINGS_ISSEQLOCKED,
+			FLIGHTBATTERYSETTINGS_NUMBYTES, &FlightBatterySettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void FlightBatterySettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	FlightBatterySettingsData data = {};
+
+	data.MaxCellVoltage = 4.2;
+	data.Capacity = 2200;
+	data.CellVoltageThresholds[0] = 3.5;
+	data.CellVoltageThresholds[1] = 3.3;
+	data.SensorCalibrationFactor[0] = 63.69;
+	data.SensorCalibrationFactor[1] = 36.6;
+	data.SensorCalibrationOffset[0] = 0;
+	data.SensorCalibrationOffset[1] = 0;
+	data.CurrentPin = 0;
+	data.VoltagePin = 1;
+	data.NbCells = 3;
+	data.FlightTimeThresholds[0] = 120;
+	data.FlightTimeThresholds[1] = 30;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void FlightBatterySettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightBatterySettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	FlightBatterySettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		FlightBatterySettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightBatterySettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void FlightBatterySettingsMaxCellVoltageSet( float *NewMaxCellVoltage )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewMaxCellVoltage, offsetof( FlightBatterySettingsData, MaxCellVoltage), sizeof(float));
+}
+void FlightBatterySettingsMaxCellVoltageGet( float *NewMaxCellVoltage )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewMaxCellVoltage, offsetof( FlightBatterySettingsData, MaxCellVoltage), sizeof(float));
+}
+void FlightBatterySettingsCapacitySet( uint32_t *NewCapacity )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewCapacity, offsetof( FlightBatterySettingsData, Capacity), sizeof(uint32_t));
+}
+void FlightBatterySettingsCapacityGet( uint32_t *NewCapacity )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewCapacity, offsetof( FlightBatterySettingsData, Capacity), sizeof(uint32_t));
+}
+void FlightBatterySettingsCellVoltageThresholdsSet( float *NewCellVoltageThresholds )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewCellVoltageThresholds, offsetof( FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsCellVoltageThresholdsGet( float *NewCellVoltageThresholds )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewCellVoltageThresholds, offsetof( FlightBatterySettingsData, CellVoltageThresholds), 2*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationFactorSet( float *NewSensorCalibrationFactor )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewSensorCalibrationFactor, offsetof( FlightBatterySettingsData, SensorCalibrationFactor), 2*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationFactorGet( float *NewSensorCalibrationFactor )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewSensorCalibrationFactor, offsetof( FlightBatterySettingsData, SensorCalibrationFactor), 2*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationOffsetSet( float *NewSensorCalibrationOffset )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewSensorCalibrationOffset, offsetof( FlightBatterySettingsData, SensorCalibrationOffset), 2*sizeof(float));
+}
+void FlightBatterySettingsSensorCalibrationOffsetGet( float *NewSensorCalibrationOffset )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewSensorCalibrationOffset, offsetof( FlightBatterySettingsData, SensorCalibrationOffset), 2*sizeof(float));
+}
+void FlightBatterySettingsCurrentPinSet( uint8_t *NewCurrentPin )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewCurrentPin, offsetof( FlightBatterySettingsData, CurrentPin), sizeof(uint8_t));
+}
+void FlightBatterySettingsCurrentPinGet( uint8_t *NewCurrentPin )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewCurrentPin, offsetof( FlightBatterySettingsData, CurrentPin), sizeof(uint8_t));
+}
+void FlightBatterySettingsVoltagePinSet( uint8_t *NewVoltagePin )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewVoltagePin, offsetof( FlightBatterySettingsData, VoltagePin), sizeof(uint8_t));
+}
+void FlightBatterySettingsVoltagePinGet( uint8_t *NewVoltagePin )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewVoltagePin, offsetof( FlightBatterySettingsData, VoltagePin), sizeof(uint8_t));
+}
+void FlightBatterySettingsNbCellsSet( uint8_t *NewNbCells )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewNbCells, offsetof( FlightBatterySettingsData, NbCells), sizeof(uint8_t));
+}
+void FlightBatterySettingsNbCellsGet( uint8_t *NewNbCells )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewNbCells, offsetof( FlightBatterySettingsData, NbCells), sizeof(uint8_t));
+}
+void FlightBatterySettingsFlightTimeThresholdsSet( uint8_t *NewFlightTimeThresholds )
+{
+	UAVObjSetDataField(FlightBatterySettingsHandle(), (void*)NewFlightTimeThresholds, offsetof( FlightBatterySettingsData, FlightTimeThresholds), 2*sizeof(uint8_t));
+}
+void FlightBatterySettingsFlightTimeThresholdsGet( uint8_t *NewFlightTimeThresholds )
+{
+	UAVObjGetDataField(FlightBatterySettingsHandle(), (void*)NewFlightTimeThresholds, offsetof( FlightBatterySettingsData, FlightTimeThresholds), 2*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
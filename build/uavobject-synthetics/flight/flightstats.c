@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       flightstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the FlightStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: flightstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "flightstats.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t FlightStatsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(FLIGHTSTATS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(FLIGHTSTATS_OBJID,
+			FLIGHTSTATS_ISSINGLEINST, FLIGHTSTATS_ISSETTINGS, FLIGHTSTATS_ISSEQLOCKED,
+			FLIGHTSTATS_NUMBYTES, &FlightStatsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void FlightStatsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	FlightStatsData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void FlightStatsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_PERIODIC << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 5000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void FlightStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	FlightStatsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		FlightStatsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle FlightStatsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void FlightStatsDistanceTravelledSet( float *NewDistanceTravelled )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewDistanceTravelled, offsetof( FlightStatsData, DistanceTravelled), sizeof(float));
+}
+void FlightStatsDistanceTravelledGet( float *NewDistanceTravelled )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewDistanceTravelled, offsetof( FlightStatsData, DistanceTravelled), sizeof(float));
+}
+void FlightStatsMaxDistanceToHomeSet( float *NewMaxDistanceToHome )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxDistanceToHome, offsetof( FlightStatsData, MaxDistanceToHome), sizeof(float));
+}
+void FlightStatsMaxDistanceToHomeGet( float *NewMaxDistanceToHome )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxDistanceToHome, offsetof( FlightStatsData, MaxDistanceToHome), sizeof(float));
+}
+void FlightStatsMaxClimbRateSet( float *NewMaxClimbRate )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxClimbRate, offsetof( FlightStatsData, MaxClimbRate), sizeof(float));
+}
+void FlightStatsMaxClimbRateGet( float *NewMaxClimbRate )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxClimbRate, offsetof( FlightStatsData, MaxClimbRate), sizeof(float));
+}
+void FlightStatsMaxDescentRateSet( float *NewMaxDescentRate )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxDescentRate, offsetof( FlightStatsData, MaxDescentRate), sizeof(float));
+}
+void FlightStatsMaxDescentRateGet( float *NewMaxDescentRate )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxDescentRate, offsetof( FlightStatsData, MaxDescentRate), sizeof(float));
+}
+void FlightStatsMaxGroundSpeedSet( float *NewMaxGroundSpeed )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxGroundSpeed, offsetof( FlightStatsData, MaxGroundSpeed), sizeof(float));
+}
+void FlightStatsMaxGroundSpeedGet( float *NewMaxGroundSpeed )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxGroundSpeed, offsetof( FlightStatsData, MaxGroundSpeed), sizeof(float));
+}
+void FlightStatsMaxAirSpeedSet( float *NewMaxAirSpeed )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxAirSpeed, offsetof( FlightStatsData, MaxAirSpeed), sizeof(float));
+}
+void FlightStatsMaxAirSpeedGet( float *NewMaxAirSpeed )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxAirSpeed, offsetof( FlightStatsData, MaxAirSpeed), sizeof(float));
+}
+void FlightStatsMaxAltitudeSet( uint16_t *NewMaxAltitude )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxAltitude, offsetof( FlightStatsData, MaxAltitude), sizeof(uint16_t));
+}
+void FlightStatsMaxAltitudeGet( uint16_t *NewMaxAltitude )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxAltitude, offsetof( FlightStatsData, MaxAltitude), sizeof(uint16_t));
+}
+void FlightStatsMaxRollRateSet( uint16_t *NewMaxRollRate )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxRollRate, offsetof( FlightStatsData, MaxRollRate), sizeof(uint16_t));
+}
+void FlightStatsMaxRollRateGet( uint16_t *NewMaxRollRate )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxRollRate, offsetof( FlightStatsData, MaxRollRate), sizeof(uint16_t));
+}
+void FlightStatsMaxPitchRateSet( uint16_t *NewMaxPitchRate )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxPitchRate, offsetof( FlightStatsData, MaxPitchRate), sizeof(uint16_t));
+}
+void FlightStatsMaxPitchRateGet( uint16_t *NewMaxPitchRate )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxPitchRate, offsetof( FlightStatsData, MaxPitchRate), sizeof(uint16_t));
+}
+void FlightStatsMaxYawRateSet( uint16_t *NewMaxYawRate )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewMaxYawRate, offsetof( FlightStatsData, MaxYawRate), sizeof(uint16_t));
+}
+void FlightStatsMaxYawRateGet( uint16_t *NewMaxYawRate )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewMaxYawRate, offsetof( FlightStatsData, MaxYawRate), sizeof(uint16_t));
+}
+void FlightStatsConsumedEnergySet( uint16_t *NewConsumedEnergy )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewConsumedEnergy, offsetof( FlightStatsData, ConsumedEnergy), sizeof(uint16_t));
+}
+void FlightStatsConsumedEnergyGet( uint16_t *NewConsumedEnergy )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewConsumedEnergy, offsetof( FlightStatsData, ConsumedEnergy), sizeof(uint16_t));
+}
+void FlightStatsInitialBatteryVoltageSet( uint16_t *NewInitialBatteryVoltage )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewInitialBatteryVoltage, offsetof( FlightStatsData, InitialBatteryVoltage), sizeof(uint16_t));
+}
+void FlightStatsInitialBatteryVoltageGet( uint16_t *NewInitialBatteryVoltage )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewInitialBatteryVoltage, offsetof( FlightStatsData, InitialBatteryVoltage), sizeof(uint16_t));
+}
+void FlightStatsStateSet( uint8_t *NewState )
+{
+	UAVObjSetDataField(FlightStatsHandle(), (void*)NewState, offsetof( FlightStatsData, State), sizeof(uint8_t));
+}
+void FlightStatsStateGet( uint8_t *NewState )
+{
+	UAVObjGetDataField(FlightStatsHandle(), (void*)NewState, offsetof( FlightStatsData, State), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,235 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       groundpathfollowersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the GroundPathFollowerSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: groundpathfollowersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "groundpathfollowersettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GroundPathFollowerSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(GROUNDPATHFOLLOWERSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(GROUNDPATHFOLLOWERSETTINGS_OBJID,
+			GROUNDPATHFOLLOWERSETTINGS_ISSINGLEINST, GROUNDPATHFOLLOWERSETTINGS_ISSETTINGS, GROUNDPATHFOLLOWERSETTINGS_ISSEQLOCKED,
+			GROUNDPATHFOLLOWERSETTINGS_NUMBYTES, &GroundPathFollowerSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void GroundPathFollowerSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	GroundPathFollowerSettingsData data = {};
+
+	data.HorizontalPosPI[0] = 1;
+	data.HorizontalPosPI[1] = 0;
+	data.HorizontalPosPI[2] = 0;
+	data.HorizontalVelPID[0] = 5;
+	data.HorizontalVelPID[1] = 0;
+	data.HorizontalVelPID[2] = 1;
+	data.HorizontalVelPID[3] = 0;
+	data.VelocityFeedforward = 0;
+	data.MaxThrottle = 1;
+	data.UpdatePeriod = 100;
+	data.HorizontalVelMax = 10;
+	data.ManualOverride = 0;
+	data.ThrottleControl = 1;
+	data.VelocitySource = 0;
+	data.PositionSource = 0;
+	data.EndpointRadius = 2;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void GroundPathFollowerSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GroundPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	GroundPathFollowerSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		GroundPathFollowerSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GroundPathFollowerSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GroundPathFollowerSettingsHorizontalPosPISet( float *NewHorizontalPosPI )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewHorizontalPosPI, offsetof( GroundPathFollowerSettingsData, HorizontalPosPI), 3*sizeof(float));
+}
+void GroundPathFollowerSettingsHorizontalPosPIGet( float *NewHorizontalPosPI )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewHorizontalPosPI, offsetof( GroundPathFollowerSettingsData, HorizontalPosPI), 3*sizeof(float));
+}
+void GroundPathFollowerSettingsHorizontalVelPIDSet( float *NewHorizontalVelPID )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewHorizontalVelPID, offsetof( GroundPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void GroundPathFollowerSettingsHorizontalVelPIDGet( float *NewHorizontalVelPID )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewHorizontalVelPID, offsetof( GroundPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void GroundPathFollowerSettingsVelocityFeedforwardSet( float *NewVelocityFeedforward )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewVelocityFeedforward, offsetof( GroundPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+void GroundPathFollowerSettingsVelocityFeedforwardGet( float *NewVelocityFeedforward )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewVelocityFeedforward, offsetof( GroundPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+void GroundPathFollowerSettingsMaxThrottleSet( float *NewMaxThrottle )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewMaxThrottle, offsetof( GroundPathFollowerSettingsData, MaxThrottle), sizeof(float));
+}
+void GroundPathFollowerSettingsMaxThrottleGet( float *NewMaxThrottle )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewMaxThrottle, offsetof( GroundPathFollowerSettingsData, MaxThrottle), sizeof(float));
+}
+void GroundPathFollowerSettingsUpdatePeriodSet( int32_t *NewUpdatePeriod )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewUpdatePeriod, offsetof( GroundPathFollowerSettingsData, UpdatePeriod), sizeof(int32_t));
+}
+void GroundPathFollowerSettingsUpdatePeriodGet( int32_t *NewUpdatePeriod )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewUpdatePeriod, offsetof( GroundPathFollowerSettingsData, UpdatePeriod), sizeof(int32_t));
+}
+void GroundPathFollowerSettingsHorizontalVelMaxSet( uint16_t *NewHorizontalVelMax )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewHorizontalVelMax, offsetof( GroundPathFollowerSettingsData, HorizontalVelMax), sizeof(uint16_t));
+}
+void GroundPathFollowerSettingsHorizontalVelMaxGet( uint16_t *NewHorizontalVelMax )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewHorizontalVelMax, offsetof( GroundPathFollowerSettingsData, HorizontalVelMax), sizeof(uint16_t));
+}
+void GroundPathFollowerSettingsManualOverrideSet( uint8_t *NewManualOverride )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewManualOverride, offsetof( GroundPathFollowerSettingsData, ManualOverride), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsManualOverrideGet( uint8_t *NewManualOverride )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewManualOverride, offsetof( GroundPathFollowerSettingsData, ManualOverride), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsThrottleControlSet( uint8_t *NewThrottleControl )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewThrottleControl, offsetof( GroundPathFollowerSettingsData, ThrottleControl), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsThrottleControlGet( uint8_t *NewThrottleControl )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewThrottleControl, offsetof( GroundPathFollowerSettingsData, ThrottleControl), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsVelocitySourceSet( uint8_t *NewVelocitySource )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewVelocitySource, offsetof( GroundPathFollowerSettingsData, VelocitySource), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsVelocitySourceGet( uint8_t *NewVelocitySource )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewVelocitySource, offsetof( GroundPathFollowerSettingsData, VelocitySource), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsPositionSourceSet( uint8_t *NewPositionSource )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewPositionSource, offsetof( GroundPathFollowerSettingsData, PositionSource), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsPositionSourceGet( uint8_t *NewPositionSource )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewPositionSource, offsetof( GroundPathFollowerSettingsData, PositionSource), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsEndpointRadiusSet( uint8_t *NewEndpointRadius )
+{
+	UAVObjSetDataField(GroundPathFollowerSettingsHandle(), (void*)NewEndpointRadius, offsetof( GroundPathFollowerSettingsData, EndpointRadius), sizeof(uint8_t));
+}
+void GroundPathFollowerSettingsEndpointRadiusGet( uint8_t *NewEndpointRadius )
+{
+	UAVObjGetDataField(GroundPathFollowerSettingsHandle(), (void*)NewEndpointRadius, offsetof( GroundPathFollowerSettingsData, EndpointRadius), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,174 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       gyrofiltersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the GyroFilterSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gyrofiltersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "gyrofiltersettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t GyroFilterSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(GYROFILTERSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(GYROFILTERSETTINGS_OBJID,
+			GYROFILTERSETTINGS_ISSINGLEINST, GYROFILTERSETTINGS_ISSETTINGS, GYROFILTERSETTINGS_ISSEQLOCKED,
+			GYROFILTERSETTINGS_NUMBYTES, &GyroFilterSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void GyroFilterSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	GyroFilterSettingsData data = {};
+
+	data.NotchFrequency[0] = 0;
+	data.NotchFrequency[1] = 0;
+	data.NotchFrequency[2] = 0;
+	data.NotchFrequency[3] = 0;
+	data.NotchQ[0] = 3;
+	data.NotchQ[1] = 3;
+	data.NotchQ[2] = 3;
+	data.NotchQ[3] = 3;
+	data.TrackingRange[0] = 80;
+	data.TrackingRange[1] = 400;
+	data.TrackedNotches = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void GyroFilterSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void GyroFilterSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	GyroFilterSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		GyroFilterSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle GyroFilterSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void GyroFilterSettingsNotchFrequencySet( float *NewNotchFrequency )
+{
+	UAVObjSetDataField(GyroFilterSettingsHandle(), (void*)NewNotchFrequency, offsetof( GyroFilterSettingsData, NotchFrequency), 4*sizeof(float));
+}
+void GyroFilterSettingsNotchFrequencyGet( float *NewNotchFrequency )
+{
+	UAVObjGetDataField(GyroFilterSettingsHandle(), (void*)NewNotchFrequency, offsetof( GyroFilterSettingsData, NotchFrequency), 4*sizeof(float));
+}
+void GyroFilterSettingsNotchQSet( float *NewNotchQ )
+{
+	UAVObjSetDataField(GyroFilterSettingsHandle(), (void*)NewNotchQ, offsetof( GyroFilterSettingsData, NotchQ), 4*sizeof(float));
+}
+void GyroFilterSettingsNotchQGet( float *NewNotchQ )
+{
+	UAVObjGetDataField(GyroFilterSettingsHandle(), (void*)NewNotchQ, offsetof( GyroFilterSettingsData, NotchQ), 4*sizeof(float));
+}
+void GyroFilterSettingsTrackingRangeSet( float *NewTrackingRange )
+{
+	UAVObjSetDataField(GyroFilterSettingsHandle(), (void*)NewTrackingRange, offsetof( GyroFilterSettingsData, TrackingRange), 2*sizeof(float));
+}
+void GyroFilterSettingsTrackingRangeGet( float *NewTrackingRange )
+{
+	UAVObjGetDataField(GyroFilterSettingsHandle(), (void*)NewTrackingRange, offsetof( GyroFilterSettingsData, TrackingRange), 2*sizeof(float));
+}
+void GyroFilterSettingsTrackedNotchesSet( uint8_t *NewTrackedNotches )
+{
+	UAVObjSetDataField(GyroFilterSettingsHandle(), (void*)NewTrackedNotches, offsetof( GyroFilterSettingsData, TrackedNotches), sizeof(uint8_t));
+}
+void GyroFilterSettingsTrackedNotchesGet( uint8_t *NewTrackedNotches )
+{
+	UAVObjGetDataField(GyroFilterSettingsHandle(), (void*)NewTrackedNotches, offsetof( GyroFilterSettingsData, TrackedNotches), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
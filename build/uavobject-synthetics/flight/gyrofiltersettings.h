@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup GyroFilterSettings GyroFilterSettings
+ * @brief Notch filters applied to the gyros by the sensors module, before stabilization uses them.
+ *
+ *
+ * @file       gyrofiltersettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the GyroFilterSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gyrofiltersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef GYROFILTERSETTINGS_H
+#define GYROFILTERSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define GYROFILTERSETTINGS_OBJID 0xBAE050D4
+#define GYROFILTERSETTINGS_ISSINGLEINST 1
+#define GYROFILTERSETTINGS_ISSETTINGS 1
+#define GYROFILTERSETTINGS_ISSEQLOCKED 0
+#define GYROFILTERSETTINGS_NUMBYTES 41
+
+// Generic interface functions
+int32_t GyroFilterSettingsInitialize();
+UAVObjHandle GyroFilterSettingsHandle();
+void GyroFilterSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float NotchFrequency[4];
+    float NotchQ[4];
+    float TrackingRange[2];
+    uint8_t TrackedNotches;
+
+} __attribute__((packed)) __attribute__((aligned(4))) GyroFilterSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function GyroFilterSettingsGet(dataOut)
+ * @brief Populate a GyroFilterSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t GyroFilterSettingsGet(GyroFilterSettingsData *dataOut) { return UAVObjGetData(GyroFilterSettingsHandle(), dataOut); }
+
+static inline int32_t GyroFilterSettingsSet(const GyroFilterSettingsData *dataIn) { return UAVObjSetData(GyroFilterSettingsHandle(), dataIn); }
+
+static inline int32_t GyroFilterSettingsInstGet(uint16_t instId, GyroFilterSettingsData *dataOut) { return UAVObjGetInstanceData(GyroFilterSettingsHandle(), instId, dataOut); }
+
+static inline int32_t GyroFilterSettingsInstSet(uint16_t instId, const GyroFilterSettingsData *dataIn) { return UAVObjSetInstanceData(GyroFilterSettingsHandle(), instId, dataIn); }
+
+static inline int32_t GyroFilterSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(GyroFilterSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GyroFilterSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(GyroFilterSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GyroFilterSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(GyroFilterSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GyroFilterSettingsConnectCopy(volatile GyroFilterSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	GyroFilterSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(GyroFilterSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t GyroFilterSettingsCreateInstance() { return UAVObjCreateInstance(GyroFilterSettingsHandle(), &GyroFilterSettingsSetDefaults); }
+
+static inline void GyroFilterSettingsUpdated() { UAVObjUpdated(GyroFilterSettingsHandle()); }
+
+static inline void GyroFilterSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(GyroFilterSettingsHandle(), instId); }
+
+static inline int32_t GyroFilterSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(GyroFilterSettingsHandle(), dataOut); }
+
+static inline int32_t GyroFilterSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(GyroFilterSettingsHandle(), dataIn); }
+
+static inline int8_t GyroFilterSettingsReadOnly() { return UAVObjReadOnly(GyroFilterSettingsHandle()); }
+
+static inline uint16_t GyroFilterSettingsGetNumInstances(){ return UAVObjGetNumInstances(GyroFilterSettingsHandle()); }
+
+static inline uint32_t GyroFilterSettingsGetNumBytes(){ return UAVObjGetNumBytes(GyroFilterSettingsHandle()); }
+
+// Field information
+// Field NotchFrequency information
+/* Array element names for field NotchFrequency */
+typedef enum { GYROFILTERSETTINGS_NOTCHFREQUENCY_1=0, GYROFILTERSETTINGS_NOTCHFREQUENCY_2=1, GYROFILTERSETTINGS_NOTCHFREQUENCY_3=2, GYROFILTERSETTINGS_NOTCHFREQUENCY_4=3 } __attribute__((packed)) GyroFilterSettingsNotchFrequencyElem;
+/* Number of elements for field NotchFrequency */
+#define GYROFILTERSETTINGS_NOTCHFREQUENCY_NUMELEM 4
+// Field NotchQ information
+/* Array element names for field NotchQ */
+typedef enum { GYROFILTERSETTINGS_NOTCHQ_1=0, GYROFILTERSETTINGS_NOTCHQ_2=1, GYROFILTERSETTINGS_NOTCHQ_3=2, GYROFILTERSETTINGS_NOTCHQ_4=3 } __attribute__((packed)) GyroFilterSettingsNotchQElem;
+/* Number of elements for field NotchQ */
+#define GYROFILTERSETTINGS_NOTCHQ_NUMELEM 4
+// Field TrackingRange information
+/* Array element names for field TrackingRange */
+typedef enum { GYROFILTERSETTINGS_TRACKINGRANGE_MIN=0, GYROFILTERSETTINGS_TRACKINGRANGE_MAX=1 } __attribute__((packed)) GyroFilterSettingsTrackingRangeElem;
+/* Number of elements for field TrackingRange */
+#define GYROFILTERSETTINGS_TRACKINGRANGE_NUMELEM 2
+// Field TrackedNotches information
+
+
+// set/Get functions
+extern void GyroFilterSettingsNotchFrequencySet( float *NewNotchFrequency );
+extern void GyroFilterSettingsNotchFrequencyGet( float *NewNotchFrequency );
+extern void GyroFilterSettingsNotchQSet( float *NewNotchQ );
+extern void GyroFilterSettingsNotchQGet( float *NewNotchQ );
+extern void GyroFilterSettingsTrackingRangeSet( float *NewTrackingRange );
+extern void GyroFilterSettingsTrackingRangeGet( float *NewTrackingRange );
+extern void GyroFilterSettingsTrackedNotchesSet( uint8_t *NewTrackedNotches );
+extern void GyroFilterSettingsTrackedNotchesGet( uint8_t *NewTrackedNotches );
+
+
+#endif // GYROFILTERSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
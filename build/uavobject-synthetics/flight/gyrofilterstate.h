@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup GyroFilterState GyroFilterState
+ * @brief The gyro notch filters as they are running, and the peaks found in the gyro spectrum when tracking.
+ *
+ *
+ * @file       gyrofilterstate.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the GyroFilterState object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: gyrofilterstate.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef GYROFILTERSTATE_H
+#define GYROFILTERSTATE_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define GYROFILTERSTATE_OBJID 0xA10B03DE
+#define GYROFILTERSTATE_ISSINGLEINST 1
+#define GYROFILTERSTATE_ISSETTINGS 0
+#define GYROFILTERSTATE_ISSEQLOCKED 0
+#define GYROFILTERSTATE_NUMBYTES 52
+
+// Generic interface functions
+int32_t GyroFilterStateInitialize();
+UAVObjHandle GyroFilterStateHandle();
+void GyroFilterStateSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float SampleRate;
+    float NotchFrequency[4];
+    float PeakFrequency[4];
+    float PeakAmplitude[4];
+
+} __attribute__((packed)) __attribute__((aligned(4))) GyroFilterStateData;
+
+// Typesafe Object access functions
+/**
+ * @function GyroFilterStateGet(dataOut)
+ * @brief Populate a GyroFilterStateData object
+ * @param[out] dataOut 
+ */
+static inline int32_t GyroFilterStateGet(GyroFilterStateData *dataOut) { return UAVObjGetData(GyroFilterStateHandle(), dataOut); }
+
+static inline int32_t GyroFilterStateSet(const GyroFilterStateData *dataIn) { return UAVObjSetData(GyroFilterStateHandle(), dataIn); }
+
+static inline int32_t GyroFilterStateInstGet(uint16_t instId, GyroFilterStateData *dataOut) { return UAVObjGetInstanceData(GyroFilterStateHandle(), instId, dataOut); }
+
+static inline int32_t GyroFilterStateInstSet(uint16_t instId, const GyroFilterStateData *dataIn) { return UAVObjSetInstanceData(GyroFilterStateHandle(), instId, dataIn); }
+
+static inline int32_t GyroFilterStateConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(GyroFilterStateHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GyroFilterStateConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(GyroFilterStateHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GyroFilterStateConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(GyroFilterStateHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t GyroFilterStateConnectCopy(volatile GyroFilterStateData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	GyroFilterStateGet((void *) dataOut);
+
+	return UAVObjConnectCallback(GyroFilterStateHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t GyroFilterStateCreateInstance() { return UAVObjCreateInstance(GyroFilterStateHandle(), &GyroFilterStateSetDefaults); }
+
+static inline void GyroFilterStateUpdated() { UAVObjUpdated(GyroFilterStateHandle()); }
+
+static inline void GyroFilterStateInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(GyroFilterStateHandle(), instId); }
+
+static inline int32_t GyroFilterStateGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(GyroFilterStateHandle(), dataOut); }
+
+static inline int32_t GyroFilterStateSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(GyroFilterStateHandle(), dataIn); }
+
+static inline int8_t GyroFilterStateReadOnly() { return UAVObjReadOnly(GyroFilterStateHandle()); }
+
+static inline uint16_t GyroFilterStateGetNumInstances(){ return UAVObjGetNumInstances(GyroFilterStateHandle()); }
+
+static inline uint32_t GyroFilterStateGetNumBytes(){ return UAVObjGetNumBytes(GyroFilterStateHandle()); }
+
+// Field information
+// Field SampleRate information
+// Field NotchFrequency information
+/* Array element names for field NotchFrequency */
+typedef enum { GYROFILTERSTATE_NOTCHFREQUENCY_1=0, GYROFILTERSTATE_NOTCHFREQUENCY_2=1, GYROFILTERSTATE_NOTCHFREQUENCY_3=2, GYROFILTERSTATE_NOTCHFREQUENCY_4=3 } __attribute__((packed)) GyroFilterStateNotchFrequencyElem;
+/* Number of elements for field NotchFrequency */
+#define GYROFILTERSTATE_NOTCHFREQUENCY_NUMELEM 4
+// Field PeakFrequency information
+/* Array element names for field PeakFrequency */
+typedef enum { GYROFILTERSTATE_PEAKFREQUENCY_1=0, GYROFILTERSTATE_PEAKFREQUENCY_2=1, GYROFILTERSTATE_PEAKFREQUENCY_3=2, GYROFILTERSTATE_PEAKFREQUENCY_4=3 } __attribute__((packed)) GyroFilterStatePeakFrequencyElem;
+/* Number of elements for field PeakFrequency */
+#define GYROFILTERSTATE_PEAKFREQUENCY_NUMELEM 4
+// Field PeakAmplitude information
+/* Array element names for field PeakAmplitude */
+typedef enum { GYROFILTERSTATE_PEAKAMPLITUDE_1=0, GYROFILTERSTATE_PEAKAMPLITUDE_2=1, GYROFILTERSTATE_PEAKAMPLITUDE_3=2, GYROFILTERSTATE_PEAKAMPLITUDE_4=3 } __attribute__((packed)) GyroFilterStatePeakAmplitudeElem;
+/* Number of elements for field PeakAmplitude */
+#define GYROFILTERSTATE_PEAKAMPLITUDE_NUMELEM 4
+
+
+// set/Get functions
+extern void GyroFilterStateSampleRateSet( float *NewSampleRate );
+extern void GyroFilterStateSampleRateGet( float *NewSampleRate );
+extern void GyroFilterStateNotchFrequencySet( float *NewNotchFrequency );
+extern void GyroFilterStateNotchFrequencyGet( float *NewNotchFrequency );
+extern void GyroFilterStatePeakFrequencySet( float *NewPeakFrequency );
+extern void GyroFilterStatePeakFrequencyGet( float *NewPeakFrequency );
+extern void GyroFilterStatePeakAmplitudeSet( float *NewPeakAmplitude );
+extern void GyroFilterStatePeakAmplitudeGet( float *NewPeakAmplitude );
+
+
+#endif // GYROFILTERSTATE_H
+
+/**
+ * @}
+ * @}
+ */
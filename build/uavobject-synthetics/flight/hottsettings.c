@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hottsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HoTTSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hottsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hottsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HoTTSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HOTTSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HOTTSETTINGS_OBJID,
+			HOTTSETTINGS_ISSINGLEINST, HOTTSETTINGS_ISSETTINGS, HOTTSETTINGS_ISSEQLOCKED,
+			HOTTSETTINGS_NUMBYTES, &HoTTSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HoTTSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HoTTSettingsData data = {};
+
+	data.Limit[0] = 30;
+	data.Limit[1] = 100;
+	data.Limit[2] = -10;
+	data.Limit[3] = 10;
+	data.Limit[4] = -1;
+	data.Limit[5] = 1;
+	data.Limit[6] = 20;
+	data.Limit[7] = 500;
+	data.Limit[8] = 1500;
+	data.Limit[9] = 5;
+	data.Limit[10] = 30;
+	data.Limit[11] = 5;
+	data.Limit[12] = 30;
+	data.Limit[13] = 5;
+	data.Limit[14] = 30;
+	data.Limit[15] = 3.3;
+	data.Limit[16] = 40;
+	data.Limit[17] = 2000;
+	data.Limit[18] = 0;
+	data.Limit[19] = 100;
+	data.Limit[20] = 0;
+	data.Limit[21] = 100;
+	data.Limit[22] = 100;
+	data.Limit[23] = 100;
+	data.Limit[24] = 7000;
+	data.Limit[25] = 1000;
+	data.Limit[26] = 0;
+	data.Sensor[0] = 0;
+	data.Sensor[1] = 0;
+	data.Sensor[2] = 0;
+	data.Sensor[3] = 0;
+	data.Sensor[4] = 0;
+	data.Warning[0] = 0;
+	data.Warning[1] = 0;
+	data.Warning[2] = 0;
+	data.Warning[3] = 0;
+	data.Warning[4] = 0;
+	data.Warning[5] = 0;
+	data.Warning[6] = 0;
+	data.Warning[7] = 0;
+	data.Warning[8] = 0;
+	data.Warning[9] = 0;
+	data.Warning[10] = 0;
+	data.Warning[11] = 0;
+	data.Warning[12] = 0;
+	data.Warning[13] = 0;
+	data.Warning[14] = 0;
+	data.Warning[15] = 0;
+	data.Warning[16] = 0;
+	data.Warning[17] = 0;
+	data.Warning[18] = 0;
+	data.Warning[19] = 0;
+	data.Warning[20] = 0;
+	data.Warning[21] = 0;
+	data.Warning[22] = 0;
+	data.Warning[23] = 0;
+	data.Warning[24] = 0;
+	data.Warning[25] = 0;
+	data.Warning[26] = 0;
+	data.Warning[27] = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HoTTSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HoTTSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HoTTSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HoTTSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HoTTSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HoTTSettingsLimitSet( float *NewLimit )
+{
+	UAVObjSetDataField(HoTTSettingsHandle(), (void*)NewLimit, offsetof( HoTTSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTSettingsLimitGet( float *NewLimit )
+{
+	UAVObjGetDataField(HoTTSettingsHandle(), (void*)NewLimit, offsetof( HoTTSettingsData, Limit), 27*sizeof(float));
+}
+void HoTTSettingsSensorSet( uint8_t *NewSensor )
+{
+	UAVObjSetDataField(HoTTSettingsHandle(), (void*)NewSensor, offsetof( HoTTSettingsData, Sensor), 5*sizeof(uint8_t));
+}
+void HoTTSettingsSensorGet( uint8_t *NewSensor )
+{
+	UAVObjGetDataField(HoTTSettingsHandle(), (void*)NewSensor, offsetof( HoTTSettingsData, Sensor), 5*sizeof(uint8_t));
+}
+void HoTTSettingsWarningSet( uint8_t *NewWarning )
+{
+	UAVObjSetDataField(HoTTSettingsHandle(), (void*)NewWarning, offsetof( HoTTSettingsData, Warning), 28*sizeof(uint8_t));
+}
+void HoTTSettingsWarningGet( uint8_t *NewWarning )
+{
+	UAVObjGetDataField(HoTTSettingsHandle(), (void*)NewWarning, offsetof( HoTTSettingsData, Warning), 28*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
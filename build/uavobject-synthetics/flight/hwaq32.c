@@ -0,0 +1,275 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwaq32.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwAQ32 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwaq32.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwaq32.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwAQ32Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWAQ32_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWAQ32_OBJID,
+			HWAQ32_ISSINGLEINST, HWAQ32_ISSETTINGS, HWAQ32_ISSEQLOCKED,
+			HWAQ32_NUMBYTES, &HwAQ32SetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwAQ32SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwAQ32Data data = {};
+
+	data.RcvrPort = 0;
+	data.Uart1 = 0;
+	data.Uart2 = 0;
+	data.Uart3 = 0;
+	data.Uart4 = 0;
+	data.Uart6 = 0;
+	data.ADCInputs = 0;
+	data.USB_HIDPort = 0;
+	data.USB_VCPPort = 4;
+	data.DSMxMode = 0;
+	data.GyroRange = 2;
+	data.AccelRange = 2;
+	data.MPU6000Rate = 2;
+	data.MPU6000DLPF = 1;
+	data.Magnetometer = 1;
+	data.ExtMagOrientation = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwAQ32SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwAQ32SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwAQ32SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwAQ32SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwAQ32Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwAQ32RcvrPortSet( uint8_t *NewRcvrPort )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewRcvrPort, offsetof( HwAQ32Data, RcvrPort), sizeof(uint8_t));
+}
+void HwAQ32RcvrPortGet( uint8_t *NewRcvrPort )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewRcvrPort, offsetof( HwAQ32Data, RcvrPort), sizeof(uint8_t));
+}
+void HwAQ32Uart1Set( uint8_t *NewUart1 )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUart1, offsetof( HwAQ32Data, Uart1), sizeof(uint8_t));
+}
+void HwAQ32Uart1Get( uint8_t *NewUart1 )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUart1, offsetof( HwAQ32Data, Uart1), sizeof(uint8_t));
+}
+void HwAQ32Uart2Set( uint8_t *NewUart2 )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUart2, offsetof( HwAQ32Data, Uart2), sizeof(uint8_t));
+}
+void HwAQ32Uart2Get( uint8_t *NewUart2 )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUart2, offsetof( HwAQ32Data, Uart2), sizeof(uint8_t));
+}
+void HwAQ32Uart3Set( uint8_t *NewUart3 )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUart3, offsetof( HwAQ32Data, Uart3), sizeof(uint8_t));
+}
+void HwAQ32Uart3Get( uint8_t *NewUart3 )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUart3, offsetof( HwAQ32Data, Uart3), sizeof(uint8_t));
+}
+void HwAQ32Uart4Set( uint8_t *NewUart4 )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUart4, offsetof( HwAQ32Data, Uart4), sizeof(uint8_t));
+}
+void HwAQ32Uart4Get( uint8_t *NewUart4 )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUart4, offsetof( HwAQ32Data, Uart4), sizeof(uint8_t));
+}
+void HwAQ32Uart6Set( uint8_t *NewUart6 )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUart6, offsetof( HwAQ32Data, Uart6), sizeof(uint8_t));
+}
+void HwAQ32Uart6Get( uint8_t *NewUart6 )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUart6, offsetof( HwAQ32Data, Uart6), sizeof(uint8_t));
+}
+void HwAQ32ADCInputsSet( uint8_t *NewADCInputs )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewADCInputs, offsetof( HwAQ32Data, ADCInputs), sizeof(uint8_t));
+}
+void HwAQ32ADCInputsGet( uint8_t *NewADCInputs )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewADCInputs, offsetof( HwAQ32Data, ADCInputs), sizeof(uint8_t));
+}
+void HwAQ32USB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUSB_HIDPort, offsetof( HwAQ32Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwAQ32USB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUSB_HIDPort, offsetof( HwAQ32Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwAQ32USB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewUSB_VCPPort, offsetof( HwAQ32Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwAQ32USB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewUSB_VCPPort, offsetof( HwAQ32Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwAQ32DSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewDSMxMode, offsetof( HwAQ32Data, DSMxMode), sizeof(uint8_t));
+}
+void HwAQ32DSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewDSMxMode, offsetof( HwAQ32Data, DSMxMode), sizeof(uint8_t));
+}
+void HwAQ32GyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewGyroRange, offsetof( HwAQ32Data, GyroRange), sizeof(uint8_t));
+}
+void HwAQ32GyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewGyroRange, offsetof( HwAQ32Data, GyroRange), sizeof(uint8_t));
+}
+void HwAQ32AccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewAccelRange, offsetof( HwAQ32Data, AccelRange), sizeof(uint8_t));
+}
+void HwAQ32AccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewAccelRange, offsetof( HwAQ32Data, AccelRange), sizeof(uint8_t));
+}
+void HwAQ32MPU6000RateSet( uint8_t *NewMPU6000Rate )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewMPU6000Rate, offsetof( HwAQ32Data, MPU6000Rate), sizeof(uint8_t));
+}
+void HwAQ32MPU6000RateGet( uint8_t *NewMPU6000Rate )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewMPU6000Rate, offsetof( HwAQ32Data, MPU6000Rate), sizeof(uint8_t));
+}
+void HwAQ32MPU6000DLPFSet( uint8_t *NewMPU6000DLPF )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewMPU6000DLPF, offsetof( HwAQ32Data, MPU6000DLPF), sizeof(uint8_t));
+}
+void HwAQ32MPU6000DLPFGet( uint8_t *NewMPU6000DLPF )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewMPU6000DLPF, offsetof( HwAQ32Data, MPU6000DLPF), sizeof(uint8_t));
+}
+void HwAQ32MagnetometerSet( uint8_t *NewMagnetometer )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewMagnetometer, offsetof( HwAQ32Data, Magnetometer), sizeof(uint8_t));
+}
+void HwAQ32MagnetometerGet( uint8_t *NewMagnetometer )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewMagnetometer, offsetof( HwAQ32Data, Magnetometer), sizeof(uint8_t));
+}
+void HwAQ32ExtMagOrientationSet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjSetDataField(HwAQ32Handle(), (void*)NewExtMagOrientation, offsetof( HwAQ32Data, ExtMagOrientation), sizeof(uint8_t));
+}
+void HwAQ32ExtMagOrientationGet( uint8_t *NewExtMagOrientation )
+{
+	UAVObjGetDataField(HwAQ32Handle(), (void*)NewExtMagOrientation, offsetof( HwAQ32Data, ExtMagOrientation), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,287 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwBrain HwBrain
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwbrain.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwBrain object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwbrain.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef HWBRAIN_H
+#define HWBRAIN_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWBRAIN_OBJID 0x312B74E6
+#define HWBRAIN_ISSINGLEINST 1
+#define HWBRAIN_ISSETTINGS 1
+#define HWBRAIN_ISSEQLOCKED 0
+#define HWBRAIN_NUMBYTES 14
+
+// Generic interface functions
+int32_t HwBrainInitialize();
+UAVObjHandle HwBrainHandle();
+void HwBrainSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t RxPort;
+    uint8_t MainPort;
+    uint8_t FlxPort;
+    uint8_t RxPortUsart;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroFullScale;
+    uint8_t AccelFullScale;
+    uint8_t MPU9250Rate;
+    uint8_t MPU9250GyroLPF;
+    uint8_t MPU9250AccelLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwBrainData;
+
+// Typesafe Object access functions
+/**
+ * @function HwBrainGet(dataOut)
+ * @brief Populate a HwBrainData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwBrainGet(HwBrainData *dataOut) { return UAVObjGetData(HwBrainHandle(), dataOut); }
+
+static inline int32_t HwBrainSet(const HwBrainData *dataIn) { return UAVObjSetData(HwBrainHandle(), dataIn); }
+
+static inline int32_t HwBrainInstGet(uint16_t instId, HwBrainData *dataOut) { return UAVObjGetInstanceData(HwBrainHandle(), instId, dataOut); }
+
+static inline int32_t HwBrainInstSet(uint16_t instId, const HwBrainData *dataIn) { return UAVObjSetInstanceData(HwBrainHandle(), instId, dataIn); }
+
+static inline int32_t HwBrainConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwBrainHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwBrainHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwBrainHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwBrainConnectCopy(volatile HwBrainData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwBrainGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwBrainHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwBrainCreateInstance() { return UAVObjCreateInstance(HwBrainHandle(), &HwBrainSetDefaults); }
+
+static inline void HwBrainUpdated() { UAVObjUpdated(HwBrainHandle()); }
+
+static inline void HwBrainInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwBrainHandle(), instId); }
+
+static inline int32_t HwBrainGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwBrainHandle(), dataOut); }
+
+static inline int32_t HwBrainSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwBrainHandle(), dataIn); }
+
+static inline int8_t HwBrainReadOnly() { return UAVObjReadOnly(HwBrainHandle()); }
+
+static inline uint16_t HwBrainGetNumInstances(){ return UAVObjGetNumInstances(HwBrainHandle()); }
+
+static inline uint32_t HwBrainGetNumBytes(){ return UAVObjGetNumBytes(HwBrainHandle()); }
+
+// Field information
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWBRAIN_RXPORT_DISABLED=0, HWBRAIN_RXPORT_OUTPUTS=1, HWBRAIN_RXPORT_PPM=2, HWBRAIN_RXPORT_PPMFRSKY=3, HWBRAIN_RXPORT_PPMOUTPUTS=4, HWBRAIN_RXPORT_PPMPWM=5, HWBRAIN_RXPORT_PPMUART=6, HWBRAIN_RXPORT_PPMUARTOUTPUTS=7, HWBRAIN_RXPORT_PWM=8, HWBRAIN_RXPORT_UART=9 }  __attribute__((packed)) HwBrainRxPortOptions;
+/* Max value of any option in topmost parent RxPort of field RxPort */
+#define HWBRAIN_RXPORT_GLOBAL_MAXOPTVAL 9
+/* Max value of any option in field RxPort */
+#define HWBRAIN_RXPORT_MAXOPTVAL 9
+/* Ensure field RxPort contains valid data */
+static inline bool HwBrainRxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort < HWBRAIN_RXPORT_MAXOPTVAL; }
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWBRAIN_MAINPORT_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWBRAIN_MAINPORT_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWBRAIN_MAINPORT_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWBRAIN_MAINPORT_DSM=HWSHARED_PORTTYPES_DSM, HWBRAIN_MAINPORT_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWBRAIN_MAINPORT_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWBRAIN_MAINPORT_GPS=HWSHARED_PORTTYPES_GPS, HWBRAIN_MAINPORT_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWBRAIN_MAINPORT_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWBRAIN_MAINPORT_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWBRAIN_MAINPORT_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWBRAIN_MAINPORT_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWBRAIN_MAINPORT_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWBRAIN_MAINPORT_PICOC=HWSHARED_PORTTYPES_PICOC, HWBRAIN_MAINPORT_SBUS=HWSHARED_PORTTYPES_SBUS, HWBRAIN_MAINPORT_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWBRAIN_MAINPORT_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWBRAIN_MAINPORT_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWBRAIN_MAINPORT_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWBRAIN_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainMainPortOptions;
+/* Max value of any option in topmost parent PortTypes of field MainPort */
+#define HWBRAIN_MAINPORT_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field MainPort */
+#define HWBRAIN_MAINPORT_MAXOPTVAL 19
+/* Ensure field MainPort contains valid data */
+static inline bool HwBrainMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort < HWBRAIN_MAINPORT_MAXOPTVAL; }
+// Field FlxPort information
+/* Enumeration options for field FlxPort */
+typedef enum { HWBRAIN_FLXPORT_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWBRAIN_FLXPORT_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWBRAIN_FLXPORT_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWBRAIN_FLXPORT_DSM=HWSHARED_PORTTYPES_DSM, HWBRAIN_FLXPORT_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWBRAIN_FLXPORT_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWBRAIN_FLXPORT_GPS=HWSHARED_PORTTYPES_GPS, HWBRAIN_FLXPORT_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWBRAIN_FLXPORT_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWBRAIN_FLXPORT_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWBRAIN_FLXPORT_I2C=HWSHARED_PORTTYPES_I2C, HWBRAIN_FLXPORT_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWBRAIN_FLXPORT_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWBRAIN_FLXPORT_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWBRAIN_FLXPORT_PICOC=HWSHARED_PORTTYPES_PICOC, HWBRAIN_FLXPORT_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWBRAIN_FLXPORT_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWBRAIN_FLXPORT_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWBRAIN_FLXPORT_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWBRAIN_FLXPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainFlxPortOptions;
+/* Max value of any option in topmost parent PortTypes of field FlxPort */
+#define HWBRAIN_FLXPORT_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field FlxPort */
+#define HWBRAIN_FLXPORT_MAXOPTVAL 20
+/* Ensure field FlxPort contains valid data */
+static inline bool HwBrainFlxPortIsValid( uint8_t CurrentFlxPort ) { return CurrentFlxPort < HWBRAIN_FLXPORT_MAXOPTVAL; }
+// Field RxPortUsart information
+/* Enumeration options for field RxPortUsart */
+typedef enum { HWBRAIN_RXPORTUSART_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWBRAIN_RXPORTUSART_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWBRAIN_RXPORTUSART_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWBRAIN_RXPORTUSART_DSM=HWSHARED_PORTTYPES_DSM, HWBRAIN_RXPORTUSART_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWBRAIN_RXPORTUSART_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWBRAIN_RXPORTUSART_GPS=HWSHARED_PORTTYPES_GPS, HWBRAIN_RXPORTUSART_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWBRAIN_RXPORTUSART_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWBRAIN_RXPORTUSART_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWBRAIN_RXPORTUSART_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWBRAIN_RXPORTUSART_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWBRAIN_RXPORTUSART_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWBRAIN_RXPORTUSART_PICOC=HWSHARED_PORTTYPES_PICOC, HWBRAIN_RXPORTUSART_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWBRAIN_RXPORTUSART_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWBRAIN_RXPORTUSART_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWBRAIN_RXPORTUSART_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWBRAIN_RXPORTUSART_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainRxPortUsartOptions;
+/* Max value of any option in topmost parent PortTypes of field RxPortUsart */
+#define HWBRAIN_RXPORTUSART_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field RxPortUsart */
+#define HWBRAIN_RXPORTUSART_MAXOPTVAL 19
+/* Ensure field RxPortUsart contains valid data */
+static inline bool HwBrainRxPortUsartIsValid( uint8_t CurrentRxPortUsart ) { return CurrentRxPortUsart < HWBRAIN_RXPORTUSART_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWBRAIN_USB_HIDPORT_USBTELEMETRY=0, HWBRAIN_USB_HIDPORT_RCTRANSMITTER=1, HWBRAIN_USB_HIDPORT_DISABLED=2 }  __attribute__((packed)) HwBrainUSB_HIDPortOptions;
+/* Max value of any option in topmost parent USB_HIDPort of field USB_HIDPort */
+#define HWBRAIN_USB_HIDPORT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field USB_HIDPort */
+#define HWBRAIN_USB_HIDPORT_MAXOPTVAL 2
+/* Ensure field USB_HIDPort contains valid data */
+static inline bool HwBrainUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort < HWBRAIN_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWBRAIN_USB_VCPPORT_USBTELEMETRY=0, HWBRAIN_USB_VCPPORT_COMBRIDGE=1, HWBRAIN_USB_VCPPORT_DEBUGCONSOLE=2, HWBRAIN_USB_VCPPORT_DISABLED=3 }  __attribute__((packed)) HwBrainUSB_VCPPortOptions;
+/* Max value of any option in topmost parent USB_VCPPort of field USB_VCPPort */
+#define HWBRAIN_USB_VCPPORT_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field USB_VCPPort */
+#define HWBRAIN_USB_VCPPORT_MAXOPTVAL 3
+/* Ensure field USB_VCPPort contains valid data */
+static inline bool HwBrainUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort < HWBRAIN_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWBRAIN_DSMXMODE_AUTODETECT=HWSHARED_DSMXMODE_AUTODETECT, HWBRAIN_DSMXMODE_FORCE10BIT=HWSHARED_DSMXMODE_FORCE10BIT, HWBRAIN_DSMXMODE_FORCE11BIT=HWSHARED_DSMXMODE_FORCE11BIT, HWBRAIN_DSMXMODE_BIND3PULSES=HWSHARED_DSMXMODE_BIND3PULSES, HWBRAIN_DSMXMODE_BIND4PULSES=HWSHARED_DSMXMODE_BIND4PULSES, HWBRAIN_DSMXMODE_BIND5PULSES=HWSHARED_DSMXMODE_BIND5PULSES, HWBRAIN_DSMXMODE_BIND6PULSES=HWSHARED_DSMXMODE_BIND6PULSES, HWBRAIN_DSMXMODE_BIND7PULSES=HWSHARED_DSMXMODE_BIND7PULSES, HWBRAIN_DSMXMODE_BIND8PULSES=HWSHARED_DSMXMODE_BIND8PULSES, HWBRAIN_DSMXMODE_BIND9PULSES=HWSHARED_DSMXMODE_BIND9PULSES, HWBRAIN_DSMXMODE_BIND10PULSES=HWSHARED_DSMXMODE_BIND10PULSES, HWBRAIN_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwBrainDSMxModeOptions;
+/* Max value of any option in topmost parent DSMxMode of field DSMxMode */
+#define HWBRAIN_DSMXMODE_GLOBAL_MAXOPTVAL 10
+/* Max value of any option in field DSMxMode */
+#define HWBRAIN_DSMXMODE_MAXOPTVAL 10
+/* Ensure field DSMxMode contains valid data */
+static inline bool HwBrainDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode < HWBRAIN_DSMXMODE_MAXOPTVAL; }
+// Field GyroFullScale information
+/* Enumeration options for field GyroFullScale */
+typedef enum { HWBRAIN_GYROFULLSCALE_250=0, HWBRAIN_GYROFULLSCALE_500=1, HWBRAIN_GYROFULLSCALE_1000=2, HWBRAIN_GYROFULLSCALE_2000=3 }  __attribute__((packed)) HwBrainGyroFullScaleOptions;
+/* Max value of any option in topmost parent GyroFullScale of field GyroFullScale */
+#define HWBRAIN_GYROFULLSCALE_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field GyroFullScale */
+#define HWBRAIN_GYROFULLSCALE_MAXOPTVAL 3
+/* Ensure field GyroFullScale contains valid data */
+static inline bool HwBrainGyroFullScaleIsValid( uint8_t CurrentGyroFullScale ) { return CurrentGyroFullScale < HWBRAIN_GYROFULLSCALE_MAXOPTVAL; }
+// Field AccelFullScale information
+/* Enumeration options for field AccelFullScale */
+typedef enum { HWBRAIN_ACCELFULLSCALE_2G=0, HWBRAIN_ACCELFULLSCALE_4G=1, HWBRAIN_ACCELFULLSCALE_8G=2, HWBRAIN_ACCELFULLSCALE_16G=3 }  __attribute__((packed)) HwBrainAccelFullScaleOptions;
+/* Max value of any option in topmost parent AccelFullScale of field AccelFullScale */
+#define HWBRAIN_ACCELFULLSCALE_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field AccelFullScale */
+#define HWBRAIN_ACCELFULLSCALE_MAXOPTVAL 3
+/* Ensure field AccelFullScale contains valid data */
+static inline bool HwBrainAccelFullScaleIsValid( uint8_t CurrentAccelFullScale ) { return CurrentAccelFullScale < HWBRAIN_ACCELFULLSCALE_MAXOPTVAL; }
+// Field MPU9250Rate information
+/* Enumeration options for field MPU9250Rate */
+typedef enum { HWBRAIN_MPU9250RATE_200=0, HWBRAIN_MPU9250RATE_250=1, HWBRAIN_MPU9250RATE_333=2, HWBRAIN_MPU9250RATE_500=3, HWBRAIN_MPU9250RATE_1000=4 }  __attribute__((packed)) HwBrainMPU9250RateOptions;
+/* Max value of any option in topmost parent MPU9250Rate of field MPU9250Rate */
+#define HWBRAIN_MPU9250RATE_GLOBAL_MAXOPTVAL 4
+/* Max value of any option in field MPU9250Rate */
+#define HWBRAIN_MPU9250RATE_MAXOPTVAL 4
+/* Ensure field MPU9250Rate contains valid data */
+static inline bool HwBrainMPU9250RateIsValid( uint8_t CurrentMPU9250Rate ) { return CurrentMPU9250Rate < HWBRAIN_MPU9250RATE_MAXOPTVAL; }
+// Field MPU9250GyroLPF information
+/* Enumeration options for field MPU9250GyroLPF */
+typedef enum { HWBRAIN_MPU9250GYROLPF_184=0, HWBRAIN_MPU9250GYROLPF_92=1, HWBRAIN_MPU9250GYROLPF_41=2, HWBRAIN_MPU9250GYROLPF_20=3, HWBRAIN_MPU9250GYROLPF_10=4, HWBRAIN_MPU9250GYROLPF_5=5 }  __attribute__((packed)) HwBrainMPU9250GyroLPFOptions;
+/* Max value of any option in topmost parent MPU9250GyroLPF of field MPU9250GyroLPF */
+#define HWBRAIN_MPU9250GYROLPF_GLOBAL_MAXOPTVAL 5
+/* Max value of any option in field MPU9250GyroLPF */
+#define HWBRAIN_MPU9250GYROLPF_MAXOPTVAL 5
+/* Ensure field MPU9250GyroLPF contains valid data */
+static inline bool HwBrainMPU9250GyroLPFIsValid( uint8_t CurrentMPU9250GyroLPF ) { return CurrentMPU9250GyroLPF < HWBRAIN_MPU9250GYROLPF_MAXOPTVAL; }
+// Field MPU9250AccelLPF information
+/* Enumeration options for field MPU9250AccelLPF */
+typedef enum { HWBRAIN_MPU9250ACCELLPF_460=0, HWBRAIN_MPU9250ACCELLPF_184=1, HWBRAIN_MPU9250ACCELLPF_92=2, HWBRAIN_MPU9250ACCELLPF_41=3, HWBRAIN_MPU9250ACCELLPF_20=4, HWBRAIN_MPU9250ACCELLPF_10=5, HWBRAIN_MPU9250ACCELLPF_5=6 }  __attribute__((packed)) HwBrainMPU9250AccelLPFOptions;
+/* Max value of any option in topmost parent MPU9250AccelLPF of field MPU9250AccelLPF */
+#define HWBRAIN_MPU9250ACCELLPF_GLOBAL_MAXOPTVAL 6
+/* Max value of any option in field MPU9250AccelLPF */
+#define HWBRAIN_MPU9250ACCELLPF_MAXOPTVAL 6
+/* Ensure field MPU9250AccelLPF contains valid data */
+static inline bool HwBrainMPU9250AccelLPFIsValid( uint8_t CurrentMPU9250AccelLPF ) { return CurrentMPU9250AccelLPF < HWBRAIN_MPU9250ACCELLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWBRAIN_MAGNETOMETER_INTERNAL=0, HWBRAIN_MAGNETOMETER_DISABLED=1, HWBRAIN_MAGNETOMETER_FLXPORTHMC5883=2, HWBRAIN_MAGNETOMETER_FLXPORTHMC5983=3 }  __attribute__((packed)) HwBrainMagnetometerOptions;
+/* Max value of any option in topmost parent Magnetometer of field Magnetometer */
+#define HWBRAIN_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field Magnetometer */
+#define HWBRAIN_MAGNETOMETER_MAXOPTVAL 3
+/* Ensure field Magnetometer contains valid data */
+static inline bool HwBrainMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer < HWBRAIN_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWBRAIN_EXTMAGORIENTATION_TOP0DEGCW=0, HWBRAIN_EXTMAGORIENTATION_TOP90DEGCW=1, HWBRAIN_EXTMAGORIENTATION_TOP180DEGCW=2, HWBRAIN_EXTMAGORIENTATION_TOP270DEGCW=3, HWBRAIN_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWBRAIN_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWBRAIN_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWBRAIN_EXTMAGORIENTATION_BOTTOM270DEGCW=7 }  __attribute__((packed)) HwBrainExtMagOrientationOptions;
+/* Max value of any option in topmost parent ExtMagOrientation of field ExtMagOrientation */
+#define HWBRAIN_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+/* Max value of any option in field ExtMagOrientation */
+#define HWBRAIN_EXTMAGORIENTATION_MAXOPTVAL 7
+/* Ensure field ExtMagOrientation contains valid data */
+static inline bool HwBrainExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation < HWBRAIN_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwBrainRxPortSet( uint8_t *NewRxPort );
+extern void HwBrainRxPortGet( uint8_t *NewRxPort );
+extern void HwBrainMainPortSet( uint8_t *NewMainPort );
+extern void HwBrainMainPortGet( uint8_t *NewMainPort );
+extern void HwBrainFlxPortSet( uint8_t *NewFlxPort );
+extern void HwBrainFlxPortGet( uint8_t *NewFlxPort );
+extern void HwBrainRxPortUsartSet( uint8_t *NewRxPortUsart );
+extern void HwBrainRxPortUsartGet( uint8_t *NewRxPortUsart );
+extern void HwBrainUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwBrainUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwBrainUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwBrainUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwBrainDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwBrainDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwBrainGyroFullScaleSet( uint8_t *NewGyroFullScale );
+extern void HwBrainGyroFullScaleGet( uint8_t *NewGyroFullScale );
+extern void HwBrainAccelFullScaleSet( uint8_t *NewAccelFullScale );
+extern void HwBrainAccelFullScaleGet( uint8_t *NewAccelFullScale );
+extern void HwBrainMPU9250RateSet( uint8_t *NewMPU9250Rate );
+extern void HwBrainMPU9250RateGet( uint8_t *NewMPU9250Rate );
+extern void HwBrainMPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF );
+extern void HwBrainMPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF );
+extern void HwBrainMPU9250AccelLPFSet( uint8_t *NewMPU9250AccelLPF );
+extern void HwBrainMPU9250AccelLPFGet( uint8_t *NewMPU9250AccelLPF );
+extern void HwBrainMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwBrainMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwBrainExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwBrainExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWBRAIN_H
+
+/**
+ * @}
+ * @}
+ */
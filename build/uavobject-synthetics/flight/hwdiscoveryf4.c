@@ -0,0 +1,158 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwdiscoveryf4.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwDiscoveryF4 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwdiscoveryf4.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwdiscoveryf4.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwDiscoveryF4Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWDISCOVERYF4_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWDISCOVERYF4_OBJID,
+			HWDISCOVERYF4_ISSINGLEINST, HWDISCOVERYF4_ISSETTINGS, HWDISCOVERYF4_ISSEQLOCKED,
+			HWDISCOVERYF4_NUMBYTES, &HwDiscoveryF4SetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwDiscoveryF4SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwDiscoveryF4Data data = {};
+
+	data.MainPort = 6;
+	data.USB_HIDPort = 0;
+	data.USB_VCPPort = 4;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwDiscoveryF4SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwDiscoveryF4SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwDiscoveryF4SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwDiscoveryF4SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwDiscoveryF4Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwDiscoveryF4MainPortSet( uint8_t *NewMainPort )
+{
+	UAVObjSetDataField(HwDiscoveryF4Handle(), (void*)NewMainPort, offsetof( HwDiscoveryF4Data, MainPort), sizeof(uint8_t));
+}
+void HwDiscoveryF4MainPortGet( uint8_t *NewMainPort )
+{
+	UAVObjGetDataField(HwDiscoveryF4Handle(), (void*)NewMainPort, offsetof( HwDiscoveryF4Data, MainPort), sizeof(uint8_t));
+}
+void HwDiscoveryF4USB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwDiscoveryF4Handle(), (void*)NewUSB_HIDPort, offsetof( HwDiscoveryF4Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwDiscoveryF4USB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwDiscoveryF4Handle(), (void*)NewUSB_HIDPort, offsetof( HwDiscoveryF4Data, USB_HIDPort), sizeof(uint8_t));
+}
+void HwDiscoveryF4USB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwDiscoveryF4Handle(), (void*)NewUSB_VCPPort, offsetof( HwDiscoveryF4Data, USB_VCPPort), sizeof(uint8_t));
+}
+void HwDiscoveryF4USB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwDiscoveryF4Handle(), (void*)NewUSB_VCPPort, offsetof( HwDiscoveryF4Data, USB_VCPPort), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
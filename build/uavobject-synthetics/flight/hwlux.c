@@ -0,0 +1,230 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwlux.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwLux object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwlux.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwlux.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwLuxInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWLUX_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWLUX_OBJID,
+			HWLUX_ISSINGLEINST, HWLUX_ISSETTINGS, HWLUX_ISSEQLOCKED,
+			HWLUX_NUMBYTES, &HwLuxSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwLuxSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwLuxData data = {};
+
+	data.RxPort = 0;
+	data.Uart2 = 0;
+	data.Uart3 = 0;
+	data.USB_HIDPort = 0;
+	data.USB_VCPPort = 4;
+	data.DSMxMode = 0;
+	data.GyroRange = 3;
+	data.AccelRange = 2;
+	data.MPU9250Rate = 3;
+	data.MPU9250GyroLPF = 0;
+	data.MPU9250AccelLPF = 1;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwLuxSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwLuxSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwLuxSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwLuxSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwLuxHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwLuxRxPortSet( uint8_t *NewRxPort )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewRxPort, offsetof( HwLuxData, RxPort), sizeof(uint8_t));
+}
+void HwLuxRxPortGet( uint8_t *NewRxPort )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewRxPort, offsetof( HwLuxData, RxPort), sizeof(uint8_t));
+}
+void HwLuxUart2Set( uint8_t *NewUart2 )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewUart2, offsetof( HwLuxData, Uart2), sizeof(uint8_t));
+}
+void HwLuxUart2Get( uint8_t *NewUart2 )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewUart2, offsetof( HwLuxData, Uart2), sizeof(uint8_t));
+}
+void HwLuxUart3Set( uint8_t *NewUart3 )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewUart3, offsetof( HwLuxData, Uart3), sizeof(uint8_t));
+}
+void HwLuxUart3Get( uint8_t *NewUart3 )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewUart3, offsetof( HwLuxData, Uart3), sizeof(uint8_t));
+}
+void HwLuxUSB_HIDPortSet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewUSB_HIDPort, offsetof( HwLuxData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwLuxUSB_HIDPortGet( uint8_t *NewUSB_HIDPort )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewUSB_HIDPort, offsetof( HwLuxData, USB_HIDPort), sizeof(uint8_t));
+}
+void HwLuxUSB_VCPPortSet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewUSB_VCPPort, offsetof( HwLuxData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwLuxUSB_VCPPortGet( uint8_t *NewUSB_VCPPort )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewUSB_VCPPort, offsetof( HwLuxData, USB_VCPPort), sizeof(uint8_t));
+}
+void HwLuxDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewDSMxMode, offsetof( HwLuxData, DSMxMode), sizeof(uint8_t));
+}
+void HwLuxDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewDSMxMode, offsetof( HwLuxData, DSMxMode), sizeof(uint8_t));
+}
+void HwLuxGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewGyroRange, offsetof( HwLuxData, GyroRange), sizeof(uint8_t));
+}
+void HwLuxGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewGyroRange, offsetof( HwLuxData, GyroRange), sizeof(uint8_t));
+}
+void HwLuxAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewAccelRange, offsetof( HwLuxData, AccelRange), sizeof(uint8_t));
+}
+void HwLuxAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewAccelRange, offsetof( HwLuxData, AccelRange), sizeof(uint8_t));
+}
+void HwLuxMPU9250RateSet( uint8_t *NewMPU9250Rate )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewMPU9250Rate, offsetof( HwLuxData, MPU9250Rate), sizeof(uint8_t));
+}
+void HwLuxMPU9250RateGet( uint8_t *NewMPU9250Rate )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewMPU9250Rate, offsetof( HwLuxData, MPU9250Rate), sizeof(uint8_t));
+}
+void HwLuxMPU9250GyroLPFSet( uint8_t *NewMPU9250GyroLPF )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewMPU9250GyroLPF, offsetof( HwLuxData, MPU9250GyroLPF), sizeof(uint8_t));
+}
+void HwLuxMPU9250GyroLPFGet( uint8_t *NewMPU9250GyroLPF )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewMPU9250GyroLPF, offsetof( HwLuxData, MPU9250GyroLPF), sizeof(uint8_t));
+}
+void HwLuxMPU9250AccelLPFSet( uint8_t *NewMPU9250AccelLPF )
+{
+	UAVObjSetDataField(HwLuxHandle(), (void*)NewMPU9250AccelLPF, offsetof( HwLuxData, MPU9250AccelLPF), sizeof(uint8_t));
+}
+void HwLuxMPU9250AccelLPFGet( uint8_t *NewMPU9250AccelLPF )
+{
+	UAVObjGetDataField(HwLuxHandle(), (void*)NewMPU9250AccelLPF, offsetof( HwLuxData, MPU9250AccelLPF), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,212 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       hwnaze.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the HwNaze object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwnaze.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "hwnaze.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t HwNazeInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(HWNAZE_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(HWNAZE_OBJID,
+			HWNAZE_ISSINGLEINST, HWNAZE_ISSETTINGS, HWNAZE_ISSEQLOCKED,
+			HWNAZE_NUMBYTES, &HwNazeSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void HwNazeSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	HwNazeData data = {};
+
+	data.MainPort = 1;
+	data.RcvrPort = 2;
+	data.RcvrSerial = 0;
+	data.DSMxMode = 0;
+	data.GyroRange = 2;
+	data.AccelRange = 2;
+	data.MPU6050Rate = 1;
+	data.MPU6050DLPF = 1;
+	data.MPU6050IntPin = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void HwNazeSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void HwNazeSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	HwNazeSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		HwNazeSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle HwNazeHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void HwNazeMainPortSet( uint8_t *NewMainPort )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewMainPort, offsetof( HwNazeData, MainPort), sizeof(uint8_t));
+}
+void HwNazeMainPortGet( uint8_t *NewMainPort )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewMainPort, offsetof( HwNazeData, MainPort), sizeof(uint8_t));
+}
+void HwNazeRcvrPortSet( uint8_t *NewRcvrPort )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewRcvrPort, offsetof( HwNazeData, RcvrPort), sizeof(uint8_t));
+}
+void HwNazeRcvrPortGet( uint8_t *NewRcvrPort )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewRcvrPort, offsetof( HwNazeData, RcvrPort), sizeof(uint8_t));
+}
+void HwNazeRcvrSerialSet( uint8_t *NewRcvrSerial )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewRcvrSerial, offsetof( HwNazeData, RcvrSerial), sizeof(uint8_t));
+}
+void HwNazeRcvrSerialGet( uint8_t *NewRcvrSerial )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewRcvrSerial, offsetof( HwNazeData, RcvrSerial), sizeof(uint8_t));
+}
+void HwNazeDSMxModeSet( uint8_t *NewDSMxMode )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewDSMxMode, offsetof( HwNazeData, DSMxMode), sizeof(uint8_t));
+}
+void HwNazeDSMxModeGet( uint8_t *NewDSMxMode )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewDSMxMode, offsetof( HwNazeData, DSMxMode), sizeof(uint8_t));
+}
+void HwNazeGyroRangeSet( uint8_t *NewGyroRange )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewGyroRange, offsetof( HwNazeData, GyroRange), sizeof(uint8_t));
+}
+void HwNazeGyroRangeGet( uint8_t *NewGyroRange )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewGyroRange, offsetof( HwNazeData, GyroRange), sizeof(uint8_t));
+}
+void HwNazeAccelRangeSet( uint8_t *NewAccelRange )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewAccelRange, offsetof( HwNazeData, AccelRange), sizeof(uint8_t));
+}
+void HwNazeAccelRangeGet( uint8_t *NewAccelRange )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewAccelRange, offsetof( HwNazeData, AccelRange), sizeof(uint8_t));
+}
+void HwNazeMPU6050RateSet( uint8_t *NewMPU6050Rate )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewMPU6050Rate, offsetof( HwNazeData, MPU6050Rate), sizeof(uint8_t));
+}
+void HwNazeMPU6050RateGet( uint8_t *NewMPU6050Rate )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewMPU6050Rate, offsetof( HwNazeData, MPU6050Rate), sizeof(uint8_t));
+}
+void HwNazeMPU6050DLPFSet( uint8_t *NewMPU6050DLPF )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewMPU6050DLPF, offsetof( HwNazeData, MPU6050DLPF), sizeof(uint8_t));
+}
+void HwNazeMPU6050DLPFGet( uint8_t *NewMPU6050DLPF )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewMPU6050DLPF, offsetof( HwNazeData, MPU6050DLPF), sizeof(uint8_t));
+}
+void HwNazeMPU6050IntPinSet( uint8_t *NewMPU6050IntPin )
+{
+	UAVObjSetDataField(HwNazeHandle(), (void*)NewMPU6050IntPin, offsetof( HwNazeData, MPU6050IntPin), sizeof(uint8_t));
+}
+void HwNazeMPU6050IntPinGet( uint8_t *NewMPU6050IntPin )
+{
+	UAVObjGetDataField(HwNazeHandle(), (void*)NewMPU6050IntPin, offsetof( HwNazeData, MPU6050IntPin), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,311 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwQuanton HwQuanton
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwquanton.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwQuanton object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwquanton.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef HWQUANTON_H
+#define HWQUANTON_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWQUANTON_OBJID 0x7F5D07E2
+#define HWQUANTON_ISSINGLEINST 1
+#define HWQUANTON_ISSETTINGS 1
+#define HWQUANTON_ISSEQLOCKED 0
+#define HWQUANTON_NUMBYTES 16
+
+// Generic interface functions
+int32_t HwQuantonInitialize();
+UAVObjHandle HwQuantonHandle();
+void HwQuantonSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t InPort;
+    uint8_t InPortSerial;
+    uint8_t Uart1;
+    uint8_t Uart2;
+    uint8_t Uart3;
+    uint8_t Uart4;
+    uint8_t Uart5;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU6000Rate;
+    uint8_t MPU6000DLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwQuantonData;
+
+// Typesafe Object access functions
+/**
+ * @function HwQuantonGet(dataOut)
+ * @brief Populate a HwQuantonData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwQuantonGet(HwQuantonData *dataOut) { return UAVObjGetData(HwQuantonHandle(), dataOut); }
+
+static inline int32_t HwQuantonSet(const HwQuantonData *dataIn) { return UAVObjSetData(HwQuantonHandle(), dataIn); }
+
+static inline int32_t HwQuantonInstGet(uint16_t instId, HwQuantonData *dataOut) { return UAVObjGetInstanceData(HwQuantonHandle(), instId, dataOut); }
+
+static inline int32_t HwQuantonInstSet(uint16_t instId, const HwQuantonData *dataIn) { return UAVObjSetInstanceData(HwQuantonHandle(), instId, dataIn); }
+
+static inline int32_t HwQuantonConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwQuantonHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwQuantonConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwQuantonHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwQuantonConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwQuantonHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwQuantonConnectCopy(volatile HwQuantonData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwQuantonGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwQuantonHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwQuantonCreateInstance() { return UAVObjCreateInstance(HwQuantonHandle(), &HwQuantonSetDefaults); }
+
+static inline void HwQuantonUpdated() { UAVObjUpdated(HwQuantonHandle()); }
+
+static inline void HwQuantonInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwQuantonHandle(), instId); }
+
+static inline int32_t HwQuantonGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwQuantonHandle(), dataOut); }
+
+static inline int32_t HwQuantonSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwQuantonHandle(), dataIn); }
+
+static inline int8_t HwQuantonReadOnly() { return UAVObjReadOnly(HwQuantonHandle()); }
+
+static inline uint16_t HwQuantonGetNumInstances(){ return UAVObjGetNumInstances(HwQuantonHandle()); }
+
+static inline uint32_t HwQuantonGetNumBytes(){ return UAVObjGetNumBytes(HwQuantonHandle()); }
+
+// Field information
+// Field InPort information
+/* Enumeration options for field InPort */
+typedef enum { HWQUANTON_INPORT_DISABLED=0, HWQUANTON_INPORT_OUTPUTS=1, HWQUANTON_INPORT_OUTPUTSADC=2, HWQUANTON_INPORT_PPM=3, HWQUANTON_INPORT_PPMADC=4, HWQUANTON_INPORT_PPMOUTPUTS=5, HWQUANTON_INPORT_PPMOUTPUTSADC=6, HWQUANTON_INPORT_PPMSERIAL=7, HWQUANTON_INPORT_PPMSERIALADC=8, HWQUANTON_INPORT_PPMPWM=9, HWQUANTON_INPORT_PPMPWMADC=10, HWQUANTON_INPORT_PWM=11, HWQUANTON_INPORT_PWMADC=12, HWQUANTON_INPORT_SERIAL=13 }  __attribute__((packed)) HwQuantonInPortOptions;
+/* Max value of any option in topmost parent InPort of field InPort */
+#define HWQUANTON_INPORT_GLOBAL_MAXOPTVAL 13
+/* Max value of any option in field InPort */
+#define HWQUANTON_INPORT_MAXOPTVAL 13
+/* Ensure field InPort contains valid data */
+static inline bool HwQuantonInPortIsValid( uint8_t CurrentInPort ) { return CurrentInPort < HWQUANTON_INPORT_MAXOPTVAL; }
+// Field InPortSerial information
+/* Enumeration options for field InPortSerial */
+typedef enum { HWQUANTON_INPORTSERIAL_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWQUANTON_INPORTSERIAL_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWQUANTON_INPORTSERIAL_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWQUANTON_INPORTSERIAL_DSM=HWSHARED_PORTTYPES_DSM, HWQUANTON_INPORTSERIAL_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWQUANTON_INPORTSERIAL_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWQUANTON_INPORTSERIAL_GPS=HWSHARED_PORTTYPES_GPS, HWQUANTON_INPORTSERIAL_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWQUANTON_INPORTSERIAL_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWQUANTON_INPORTSERIAL_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWQUANTON_INPORTSERIAL_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWQUANTON_INPORTSERIAL_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWQUANTON_INPORTSERIAL_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWQUANTON_INPORTSERIAL_MSP=HWSHARED_PORTTYPES_MSP, HWQUANTON_INPORTSERIAL_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWQUANTON_INPORTSERIAL_PICOC=HWSHARED_PORTTYPES_PICOC, HWQUANTON_INPORTSERIAL_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWQUANTON_INPORTSERIAL_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWQUANTON_INPORTSERIAL_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWQUANTON_INPORTSERIAL_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonInPortSerialOptions;
+/* Max value of any option in topmost parent PortTypes of field InPortSerial */
+#define HWQUANTON_INPORTSERIAL_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field InPortSerial */
+#define HWQUANTON_INPORTSERIAL_MAXOPTVAL 19
+/* Ensure field InPortSerial contains valid data */
+static inline bool HwQuantonInPortSerialIsValid( uint8_t CurrentInPortSerial ) { return CurrentInPortSerial < HWQUANTON_INPORTSERIAL_MAXOPTVAL; }
+// Field Uart1 information
+/* Enumeration options for field Uart1 */
+typedef enum { HWQUANTON_UART1_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWQUANTON_UART1_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWQUANTON_UART1_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWQUANTON_UART1_DSM=HWSHARED_PORTTYPES_DSM, HWQUANTON_UART1_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWQUANTON_UART1_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWQUANTON_UART1_GPS=HWSHARED_PORTTYPES_GPS, HWQUANTON_UART1_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWQUANTON_UART1_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWQUANTON_UART1_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWQUANTON_UART1_I2C=HWSHARED_PORTTYPES_I2C, HWQUANTON_UART1_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWQUANTON_UART1_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWQUANTON_UART1_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWQUANTON_UART1_MSP=HWSHARED_PORTTYPES_MSP, HWQUANTON_UART1_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWQUANTON_UART1_PICOC=HWSHARED_PORTTYPES_PICOC, HWQUANTON_UART1_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWQUANTON_UART1_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWQUANTON_UART1_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWQUANTON_UART1_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart1Options;
+/* Max value of any option in topmost parent PortTypes of field Uart1 */
+#define HWQUANTON_UART1_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field Uart1 */
+#define HWQUANTON_UART1_MAXOPTVAL 20
+/* Ensure field Uart1 contains valid data */
+static inline bool HwQuantonUart1IsValid( uint8_t CurrentUart1 ) { return CurrentUart1 < HWQUANTON_UART1_MAXOPTVAL; }
+// Field Uart2 information
+/* Enumeration options for field Uart2 */
+typedef enum { HWQUANTON_UART2_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWQUANTON_UART2_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWQUANTON_UART2_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWQUANTON_UART2_DSM=HWSHARED_PORTTYPES_DSM, HWQUANTON_UART2_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWQUANTON_UART2_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWQUANTON_UART2_GPS=HWSHARED_PORTTYPES_GPS, HWQUANTON_UART2_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWQUANTON_UART2_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWQUANTON_UART2_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWQUANTON_UART2_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWQUANTON_UART2_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWQUANTON_UART2_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWQUANTON_UART2_MSP=HWSHARED_PORTTYPES_MSP, HWQUANTON_UART2_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWQUANTON_UART2_PICOC=HWSHARED_PORTTYPES_PICOC, HWQUANTON_UART2_SBUS=HWSHARED_PORTTYPES_SBUS, HWQUANTON_UART2_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWQUANTON_UART2_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWQUANTON_UART2_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWQUANTON_UART2_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart2Options;
+/* Max value of any option in topmost parent PortTypes of field Uart2 */
+#define HWQUANTON_UART2_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field Uart2 */
+#define HWQUANTON_UART2_MAXOPTVAL 19
+/* Ensure field Uart2 contains valid data */
+static inline bool HwQuantonUart2IsValid( uint8_t CurrentUart2 ) { return CurrentUart2 < HWQUANTON_UART2_MAXOPTVAL; }
+// Field Uart3 information
+/* Enumeration options for field Uart3 */
+typedef enum { HWQUANTON_UART3_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWQUANTON_UART3_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWQUANTON_UART3_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWQUANTON_UART3_DSM=HWSHARED_PORTTYPES_DSM, HWQUANTON_UART3_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWQUANTON_UART3_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWQUANTON_UART3_GPS=HWSHARED_PORTTYPES_GPS, HWQUANTON_UART3_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWQUANTON_UART3_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWQUANTON_UART3_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWQUANTON_UART3_I2C=HWSHARED_PORTTYPES_I2C, HWQUANTON_UART3_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWQUANTON_UART3_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWQUANTON_UART3_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWQUANTON_UART3_MSP=HWSHARED_PORTTYPES_MSP, HWQUANTON_UART3_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWQUANTON_UART3_PICOC=HWSHARED_PORTTYPES_PICOC, HWQUANTON_UART3_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWQUANTON_UART3_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWQUANTON_UART3_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWQUANTON_UART3_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart3Options;
+/* Max value of any option in topmost parent PortTypes of field Uart3 */
+#define HWQUANTON_UART3_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field Uart3 */
+#define HWQUANTON_UART3_MAXOPTVAL 20
+/* Ensure field Uart3 contains valid data */
+static inline bool HwQuantonUart3IsValid( uint8_t CurrentUart3 ) { return CurrentUart3 < HWQUANTON_UART3_MAXOPTVAL; }
+// Field Uart4 information
+/* Enumeration options for field Uart4 */
+typedef enum { HWQUANTON_UART4_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWQUANTON_UART4_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWQUANTON_UART4_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWQUANTON_UART4_DSM=HWSHARED_PORTTYPES_DSM, HWQUANTON_UART4_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWQUANTON_UART4_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWQUANTON_UART4_GPS=HWSHARED_PORTTYPES_GPS, HWQUANTON_UART4_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWQUANTON_UART4_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWQUANTON_UART4_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWQUANTON_UART4_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWQUANTON_UART4_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWQUANTON_UART4_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWQUANTON_UART4_MSP=HWSHARED_PORTTYPES_MSP, HWQUANTON_UART4_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWQUANTON_UART4_PICOC=HWSHARED_PORTTYPES_PICOC, HWQUANTON_UART4_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWQUANTON_UART4_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWQUANTON_UART4_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWQUANTON_UART4_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart4Options;
+/* Max value of any option in topmost parent PortTypes of field Uart4 */
+#define HWQUANTON_UART4_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field Uart4 */
+#define HWQUANTON_UART4_MAXOPTVAL 19
+/* Ensure field Uart4 contains valid data */
+static inline bool HwQuantonUart4IsValid( uint8_t CurrentUart4 ) { return CurrentUart4 < HWQUANTON_UART4_MAXOPTVAL; }
+// Field Uart5 information
+/* Enumeration options for field Uart5 */
+typedef enum { HWQUANTON_UART5_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWQUANTON_UART5_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWQUANTON_UART5_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWQUANTON_UART5_DSM=HWSHARED_PORTTYPES_DSM, HWQUANTON_UART5_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWQUANTON_UART5_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWQUANTON_UART5_GPS=HWSHARED_PORTTYPES_GPS, HWQUANTON_UART5_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWQUANTON_UART5_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWQUANTON_UART5_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWQUANTON_UART5_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWQUANTON_UART5_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWQUANTON_UART5_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWQUANTON_UART5_MSP=HWSHARED_PORTTYPES_MSP, HWQUANTON_UART5_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWQUANTON_UART5_PICOC=HWSHARED_PORTTYPES_PICOC, HWQUANTON_UART5_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWQUANTON_UART5_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWQUANTON_UART5_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWQUANTON_UART5_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUart5Options;
+/* Max value of any option in topmost parent PortTypes of field Uart5 */
+#define HWQUANTON_UART5_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field Uart5 */
+#define HWQUANTON_UART5_MAXOPTVAL 19
+/* Ensure field Uart5 contains valid data */
+static inline bool HwQuantonUart5IsValid( uint8_t CurrentUart5 ) { return CurrentUart5 < HWQUANTON_UART5_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWQUANTON_USB_HIDPORT_USBTELEMETRY=HWSHARED_USB_HIDPORT_USBTELEMETRY, HWQUANTON_USB_HIDPORT_DISABLED=HWSHARED_USB_HIDPORT_DISABLED, HWQUANTON_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUSB_HIDPortOptions;
+/* Max value of any option in topmost parent USB_HIDPort of field USB_HIDPort */
+#define HWQUANTON_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field USB_HIDPort */
+#define HWQUANTON_USB_HIDPORT_MAXOPTVAL 1
+/* Ensure field USB_HIDPort contains valid data */
+static inline bool HwQuantonUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort < HWQUANTON_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWQUANTON_USB_VCPPORT_USBTELEMETRY=HWSHARED_USB_VCPPORT_USBTELEMETRY, HWQUANTON_USB_VCPPORT_COMBRIDGE=HWSHARED_USB_VCPPORT_COMBRIDGE, HWQUANTON_USB_VCPPORT_DEBUGCONSOLE=HWSHARED_USB_VCPPORT_DEBUGCONSOLE, HWQUANTON_USB_VCPPORT_PICOC=HWSHARED_USB_VCPPORT_PICOC, HWQUANTON_USB_VCPPORT_DISABLED=HWSHARED_USB_VCPPORT_DISABLED, HWQUANTON_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonUSB_VCPPortOptions;
+/* Max value of any option in topmost parent USB_VCPPort of field USB_VCPPort */
+#define HWQUANTON_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+/* Max value of any option in field USB_VCPPort */
+#define HWQUANTON_USB_VCPPORT_MAXOPTVAL 4
+/* Ensure field USB_VCPPort contains valid data */
+static inline bool HwQuantonUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort < HWQUANTON_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWQUANTON_DSMXMODE_AUTODETECT=HWSHARED_DSMXMODE_AUTODETECT, HWQUANTON_DSMXMODE_FORCE10BIT=HWSHARED_DSMXMODE_FORCE10BIT, HWQUANTON_DSMXMODE_FORCE11BIT=HWSHARED_DSMXMODE_FORCE11BIT, HWQUANTON_DSMXMODE_BIND3PULSES=HWSHARED_DSMXMODE_BIND3PULSES, HWQUANTON_DSMXMODE_BIND4PULSES=HWSHARED_DSMXMODE_BIND4PULSES, HWQUANTON_DSMXMODE_BIND5PULSES=HWSHARED_DSMXMODE_BIND5PULSES, HWQUANTON_DSMXMODE_BIND6PULSES=HWSHARED_DSMXMODE_BIND6PULSES, HWQUANTON_DSMXMODE_BIND7PULSES=HWSHARED_DSMXMODE_BIND7PULSES, HWQUANTON_DSMXMODE_BIND8PULSES=HWSHARED_DSMXMODE_BIND8PULSES, HWQUANTON_DSMXMODE_BIND9PULSES=HWSHARED_DSMXMODE_BIND9PULSES, HWQUANTON_DSMXMODE_BIND10PULSES=HWSHARED_DSMXMODE_BIND10PULSES, HWQUANTON_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonDSMxModeOptions;
+/* Max value of any option in topmost parent DSMxMode of field DSMxMode */
+#define HWQUANTON_DSMXMODE_GLOBAL_MAXOPTVAL 10
+/* Max value of any option in field DSMxMode */
+#define HWQUANTON_DSMXMODE_MAXOPTVAL 10
+/* Ensure field DSMxMode contains valid data */
+static inline bool HwQuantonDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode < HWQUANTON_DSMXMODE_MAXOPTVAL; }
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWQUANTON_GYRORANGE_250=0, HWQUANTON_GYRORANGE_500=1, HWQUANTON_GYRORANGE_1000=2, HWQUANTON_GYRORANGE_2000=3 }  __attribute__((packed)) HwQuantonGyroRangeOptions;
+/* Max value of any option in topmost parent GyroRange of field GyroRange */
+#define HWQUANTON_GYRORANGE_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field GyroRange */
+#define HWQUANTON_GYRORANGE_MAXOPTVAL 3
+/* Ensure field GyroRange contains valid data */
+static inline bool HwQuantonGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange < HWQUANTON_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWQUANTON_ACCELRANGE_2G=0, HWQUANTON_ACCELRANGE_4G=1, HWQUANTON_ACCELRANGE_8G=2, HWQUANTON_ACCELRANGE_16G=3 }  __attribute__((packed)) HwQuantonAccelRangeOptions;
+/* Max value of any option in topmost parent AccelRange of field AccelRange */
+#define HWQUANTON_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field AccelRange */
+#define HWQUANTON_ACCELRANGE_MAXOPTVAL 3
+/* Ensure field AccelRange contains valid data */
+static inline bool HwQuantonAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange < HWQUANTON_ACCELRANGE_MAXOPTVAL; }
+// Field MPU6000Rate information
+/* Enumeration options for field MPU6000Rate */
+typedef enum { HWQUANTON_MPU6000RATE_200=0, HWQUANTON_MPU6000RATE_333=1, HWQUANTON_MPU6000RATE_500=2, HWQUANTON_MPU6000RATE_666=3, HWQUANTON_MPU6000RATE_1000=4, HWQUANTON_MPU6000RATE_2000=5, HWQUANTON_MPU6000RATE_4000=6, HWQUANTON_MPU6000RATE_8000=7 }  __attribute__((packed)) HwQuantonMPU6000RateOptions;
+/* Max value of any option in topmost parent MPU6000Rate of field MPU6000Rate */
+#define HWQUANTON_MPU6000RATE_GLOBAL_MAXOPTVAL 7
+/* Max value of any option in field MPU6000Rate */
+#define HWQUANTON_MPU6000RATE_MAXOPTVAL 7
+/* Ensure field MPU6000Rate contains valid data */
+static inline bool HwQuantonMPU6000RateIsValid( uint8_t CurrentMPU6000Rate ) { return CurrentMPU6000Rate < HWQUANTON_MPU6000RATE_MAXOPTVAL; }
+// Field MPU6000DLPF information
+/* Enumeration options for field MPU6000DLPF */
+typedef enum { HWQUANTON_MPU6000DLPF_256=0, HWQUANTON_MPU6000DLPF_188=1, HWQUANTON_MPU6000DLPF_98=2, HWQUANTON_MPU6000DLPF_42=3, HWQUANTON_MPU6000DLPF_20=4, HWQUANTON_MPU6000DLPF_10=5, HWQUANTON_MPU6000DLPF_5=6 }  __attribute__((packed)) HwQuantonMPU6000DLPFOptions;
+/* Max value of any option in topmost parent MPU6000DLPF of field MPU6000DLPF */
+#define HWQUANTON_MPU6000DLPF_GLOBAL_MAXOPTVAL 6
+/* Max value of any option in field MPU6000DLPF */
+#define HWQUANTON_MPU6000DLPF_MAXOPTVAL 6
+/* Ensure field MPU6000DLPF contains valid data */
+static inline bool HwQuantonMPU6000DLPFIsValid( uint8_t CurrentMPU6000DLPF ) { return CurrentMPU6000DLPF < HWQUANTON_MPU6000DLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWQUANTON_MAGNETOMETER_DISABLED=0, HWQUANTON_MAGNETOMETER_INTERNAL=1, HWQUANTON_MAGNETOMETER_EXTERNALI2CUART1=2, HWQUANTON_MAGNETOMETER_EXTERNALI2CUART3=3 }  __attribute__((packed)) HwQuantonMagnetometerOptions;
+/* Max value of any option in topmost parent Magnetometer of field Magnetometer */
+#define HWQUANTON_MAGNETOMETER_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field Magnetometer */
+#define HWQUANTON_MAGNETOMETER_MAXOPTVAL 3
+/* Ensure field Magnetometer contains valid data */
+static inline bool HwQuantonMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer < HWQUANTON_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWQUANTON_EXTMAGORIENTATION_TOP0DEGCW=HWSHARED_MAGORIENTATION_TOP0DEGCW, HWQUANTON_EXTMAGORIENTATION_TOP90DEGCW=HWSHARED_MAGORIENTATION_TOP90DEGCW, HWQUANTON_EXTMAGORIENTATION_TOP180DEGCW=HWSHARED_MAGORIENTATION_TOP180DEGCW, HWQUANTON_EXTMAGORIENTATION_TOP270DEGCW=HWSHARED_MAGORIENTATION_TOP270DEGCW, HWQUANTON_EXTMAGORIENTATION_BOTTOM0DEGCW=HWSHARED_MAGORIENTATION_BOTTOM0DEGCW, HWQUANTON_EXTMAGORIENTATION_BOTTOM90DEGCW=HWSHARED_MAGORIENTATION_BOTTOM90DEGCW, HWQUANTON_EXTMAGORIENTATION_BOTTOM180DEGCW=HWSHARED_MAGORIENTATION_BOTTOM180DEGCW, HWQUANTON_EXTMAGORIENTATION_BOTTOM270DEGCW=HWSHARED_MAGORIENTATION_BOTTOM270DEGCW, HWQUANTON_EXTMAGORIENTATION_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwQuantonExtMagOrientationOptions;
+/* Max value of any option in topmost parent MagOrientation of field ExtMagOrientation */
+#define HWQUANTON_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+/* Max value of any option in field ExtMagOrientation */
+#define HWQUANTON_EXTMAGORIENTATION_MAXOPTVAL 7
+/* Ensure field ExtMagOrientation contains valid data */
+static inline bool HwQuantonExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation < HWQUANTON_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwQuantonInPortSet( uint8_t *NewInPort );
+extern void HwQuantonInPortGet( uint8_t *NewInPort );
+extern void HwQuantonInPortSerialSet( uint8_t *NewInPortSerial );
+extern void HwQuantonInPortSerialGet( uint8_t *NewInPortSerial );
+extern void HwQuantonUart1Set( uint8_t *NewUart1 );
+extern void HwQuantonUart1Get( uint8_t *NewUart1 );
+extern void HwQuantonUart2Set( uint8_t *NewUart2 );
+extern void HwQuantonUart2Get( uint8_t *NewUart2 );
+extern void HwQuantonUart3Set( uint8_t *NewUart3 );
+extern void HwQuantonUart3Get( uint8_t *NewUart3 );
+extern void HwQuantonUart4Set( uint8_t *NewUart4 );
+extern void HwQuantonUart4Get( uint8_t *NewUart4 );
+extern void HwQuantonUart5Set( uint8_t *NewUart5 );
+extern void HwQuantonUart5Get( uint8_t *NewUart5 );
+extern void HwQuantonUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwQuantonUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwQuantonUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwQuantonUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwQuantonDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwQuantonDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwQuantonGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwQuantonGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwQuantonAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwQuantonAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwQuantonMPU6000RateSet( uint8_t *NewMPU6000Rate );
+extern void HwQuantonMPU6000RateGet( uint8_t *NewMPU6000Rate );
+extern void HwQuantonMPU6000DLPFSet( uint8_t *NewMPU6000DLPF );
+extern void HwQuantonMPU6000DLPFGet( uint8_t *NewMPU6000DLPF );
+extern void HwQuantonMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwQuantonMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwQuantonExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwQuantonExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWQUANTON_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,335 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup HwRevolution HwRevolution
+ * @brief Selection of optional hardware configurations.
+ *
+ *
+ * @file       hwrevolution.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the HwRevolution object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: hwrevolution.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef HWREVOLUTION_H
+#define HWREVOLUTION_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define HWREVOLUTION_OBJID 0xB5B60602
+#define HWREVOLUTION_ISSINGLEINST 1
+#define HWREVOLUTION_ISSETTINGS 1
+#define HWREVOLUTION_ISSEQLOCKED 0
+#define HWREVOLUTION_NUMBYTES 23
+
+// Generic interface functions
+int32_t HwRevolutionInitialize();
+UAVObjHandle HwRevolutionHandle();
+void HwRevolutionSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t CoordID;
+    uint8_t RxPort;
+    uint8_t MainPort;
+    uint8_t FlexiPort;
+    uint8_t RxPortUsart;
+    uint8_t USB_HIDPort;
+    uint8_t USB_VCPPort;
+    uint8_t DSMxMode;
+    uint8_t Radio;
+    uint8_t MaxRfSpeed;
+    uint8_t MaxRfPower;
+    uint8_t RfBand;
+    uint8_t MinChannel;
+    uint8_t MaxChannel;
+    uint8_t GyroRange;
+    uint8_t AccelRange;
+    uint8_t MPU6000Rate;
+    uint8_t MPU6000DLPF;
+    uint8_t Magnetometer;
+    uint8_t ExtMagOrientation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) HwRevolutionData;
+
+// Typesafe Object access functions
+/**
+ * @function HwRevolutionGet(dataOut)
+ * @brief Populate a HwRevolutionData object
+ * @param[out] dataOut 
+ */
+static inline int32_t HwRevolutionGet(HwRevolutionData *dataOut) { return UAVObjGetData(HwRevolutionHandle(), dataOut); }
+
+static inline int32_t HwRevolutionSet(const HwRevolutionData *dataIn) { return UAVObjSetData(HwRevolutionHandle(), dataIn); }
+
+static inline int32_t HwRevolutionInstGet(uint16_t instId, HwRevolutionData *dataOut) { return UAVObjGetInstanceData(HwRevolutionHandle(), instId, dataOut); }
+
+static inline int32_t HwRevolutionInstSet(uint16_t instId, const HwRevolutionData *dataIn) { return UAVObjSetInstanceData(HwRevolutionHandle(), instId, dataIn); }
+
+static inline int32_t HwRevolutionConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(HwRevolutionHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwRevolutionConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(HwRevolutionHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwRevolutionConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(HwRevolutionHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t HwRevolutionConnectCopy(volatile HwRevolutionData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	HwRevolutionGet((void *) dataOut);
+
+	return UAVObjConnectCallback(HwRevolutionHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t HwRevolutionCreateInstance() { return UAVObjCreateInstance(HwRevolutionHandle(), &HwRevolutionSetDefaults); }
+
+static inline void HwRevolutionUpdated() { UAVObjUpdated(HwRevolutionHandle()); }
+
+static inline void HwRevolutionInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(HwRevolutionHandle(), instId); }
+
+static inline int32_t HwRevolutionGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(HwRevolutionHandle(), dataOut); }
+
+static inline int32_t HwRevolutionSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(HwRevolutionHandle(), dataIn); }
+
+static inline int8_t HwRevolutionReadOnly() { return UAVObjReadOnly(HwRevolutionHandle()); }
+
+static inline uint16_t HwRevolutionGetNumInstances(){ return UAVObjGetNumInstances(HwRevolutionHandle()); }
+
+static inline uint32_t HwRevolutionGetNumBytes(){ return UAVObjGetNumBytes(HwRevolutionHandle()); }
+
+// Field information
+// Field CoordID information
+// Field RxPort information
+/* Enumeration options for field RxPort */
+typedef enum { HWREVOLUTION_RXPORT_DISABLED=0, HWREVOLUTION_RXPORT_OUTPUTS=1, HWREVOLUTION_RXPORT_PPM=2, HWREVOLUTION_RXPORT_PPMFRSKY=3, HWREVOLUTION_RXPORT_PPMOUTPUTS=4, HWREVOLUTION_RXPORT_PPMPWM=5, HWREVOLUTION_RXPORT_PPMUART=6, HWREVOLUTION_RXPORT_PWM=7, HWREVOLUTION_RXPORT_UART=8 }  __attribute__((packed)) HwRevolutionRxPortOptions;
+/* Max value of any option in topmost parent RxPort of field RxPort */
+#define HWREVOLUTION_RXPORT_GLOBAL_MAXOPTVAL 8
+/* Max value of any option in field RxPort */
+#define HWREVOLUTION_RXPORT_MAXOPTVAL 8
+/* Ensure field RxPort contains valid data */
+static inline bool HwRevolutionRxPortIsValid( uint8_t CurrentRxPort ) { return CurrentRxPort < HWREVOLUTION_RXPORT_MAXOPTVAL; }
+// Field MainPort information
+/* Enumeration options for field MainPort */
+typedef enum { HWREVOLUTION_MAINPORT_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWREVOLUTION_MAINPORT_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWREVOLUTION_MAINPORT_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWREVOLUTION_MAINPORT_DSM=HWSHARED_PORTTYPES_DSM, HWREVOLUTION_MAINPORT_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWREVOLUTION_MAINPORT_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWREVOLUTION_MAINPORT_GPS=HWSHARED_PORTTYPES_GPS, HWREVOLUTION_MAINPORT_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWREVOLUTION_MAINPORT_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWREVOLUTION_MAINPORT_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWREVOLUTION_MAINPORT_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWREVOLUTION_MAINPORT_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWREVOLUTION_MAINPORT_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWREVOLUTION_MAINPORT_MSP=HWSHARED_PORTTYPES_MSP, HWREVOLUTION_MAINPORT_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWREVOLUTION_MAINPORT_PICOC=HWSHARED_PORTTYPES_PICOC, HWREVOLUTION_MAINPORT_SBUS=HWSHARED_PORTTYPES_SBUS, HWREVOLUTION_MAINPORT_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWREVOLUTION_MAINPORT_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWREVOLUTION_MAINPORT_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWREVOLUTION_MAINPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionMainPortOptions;
+/* Max value of any option in topmost parent PortTypes of field MainPort */
+#define HWREVOLUTION_MAINPORT_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field MainPort */
+#define HWREVOLUTION_MAINPORT_MAXOPTVAL 19
+/* Ensure field MainPort contains valid data */
+static inline bool HwRevolutionMainPortIsValid( uint8_t CurrentMainPort ) { return CurrentMainPort < HWREVOLUTION_MAINPORT_MAXOPTVAL; }
+// Field FlexiPort information
+/* Enumeration options for field FlexiPort */
+typedef enum { HWREVOLUTION_FLEXIPORT_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWREVOLUTION_FLEXIPORT_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWREVOLUTION_FLEXIPORT_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWREVOLUTION_FLEXIPORT_DSM=HWSHARED_PORTTYPES_DSM, HWREVOLUTION_FLEXIPORT_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWREVOLUTION_FLEXIPORT_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWREVOLUTION_FLEXIPORT_GPS=HWSHARED_PORTTYPES_GPS, HWREVOLUTION_FLEXIPORT_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWREVOLUTION_FLEXIPORT_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWREVOLUTION_FLEXIPORT_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWREVOLUTION_FLEXIPORT_I2C=HWSHARED_PORTTYPES_I2C, HWREVOLUTION_FLEXIPORT_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWREVOLUTION_FLEXIPORT_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWREVOLUTION_FLEXIPORT_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWREVOLUTION_FLEXIPORT_MSP=HWSHARED_PORTTYPES_MSP, HWREVOLUTION_FLEXIPORT_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWREVOLUTION_FLEXIPORT_PICOC=HWSHARED_PORTTYPES_PICOC, HWREVOLUTION_FLEXIPORT_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWREVOLUTION_FLEXIPORT_STORM32BGC=HWSHARED_PORTTYPES_STORM32BGC, HWREVOLUTION_FLEXIPORT_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWREVOLUTION_FLEXIPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionFlexiPortOptions;
+/* Max value of any option in topmost parent PortTypes of field FlexiPort */
+#define HWREVOLUTION_FLEXIPORT_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field FlexiPort */
+#define HWREVOLUTION_FLEXIPORT_MAXOPTVAL 20
+/* Ensure field FlexiPort contains valid data */
+static inline bool HwRevolutionFlexiPortIsValid( uint8_t CurrentFlexiPort ) { return CurrentFlexiPort < HWREVOLUTION_FLEXIPORT_MAXOPTVAL; }
+// Field RxPortUsart information
+/* Enumeration options for field RxPortUsart */
+typedef enum { HWREVOLUTION_RXPORTUSART_DISABLED=HWSHARED_PORTTYPES_DISABLED, HWREVOLUTION_RXPORTUSART_COMBRIDGE=HWSHARED_PORTTYPES_COMBRIDGE, HWREVOLUTION_RXPORTUSART_DEBUGCONSOLE=HWSHARED_PORTTYPES_DEBUGCONSOLE, HWREVOLUTION_RXPORTUSART_DSM=HWSHARED_PORTTYPES_DSM, HWREVOLUTION_RXPORTUSART_FRSKYSENSORHUB=HWSHARED_PORTTYPES_FRSKYSENSORHUB, HWREVOLUTION_RXPORTUSART_FRSKYSPORTTELEMETRY=HWSHARED_PORTTYPES_FRSKYSPORTTELEMETRY, HWREVOLUTION_RXPORTUSART_GPS=HWSHARED_PORTTYPES_GPS, HWREVOLUTION_RXPORTUSART_HOTTSUMD=HWSHARED_PORTTYPES_HOTTSUMD, HWREVOLUTION_RXPORTUSART_HOTTSUMH=HWSHARED_PORTTYPES_HOTTSUMH, HWREVOLUTION_RXPORTUSART_HOTTTELEMETRY=HWSHARED_PORTTYPES_HOTTTELEMETRY, HWREVOLUTION_RXPORTUSART_LIGHTTELEMETRYTX=HWSHARED_PORTTYPES_LIGHTTELEMETRYTX, HWREVOLUTION_RXPORTUSART_MAVLINKTX=HWSHARED_PORTTYPES_MAVLINKTX, HWREVOLUTION_RXPORTUSART_MAVLINKTX_GPS_RX=HWSHARED_PORTTYPES_MAVLINKTX_GPS_RX, HWREVOLUTION_RXPORTUSART_MSP=HWSHARED_PORTTYPES_MSP, HWREVOLUTION_RXPORTUSART_OPENLOG=HWSHARED_PORTTYPES_OPENLOG, HWREVOLUTION_RXPORTUSART_PICOC=HWSHARED_PORTTYPES_PICOC, HWREVOLUTION_RXPORTUSART_SBUSNONINVERTED=HWSHARED_PORTTYPES_SBUSNONINVERTED, HWREVOLUTION_RXPORTUSART_TELEMETRY=HWSHARED_PORTTYPES_TELEMETRY, HWREVOLUTION_RXPORTUSART_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionRxPortUsartOptions;
+/* Max value of any option in topmost parent PortTypes of field RxPortUsart */
+#define HWREVOLUTION_RXPORTUSART_GLOBAL_MAXOPTVAL 22
+/* Max value of any option in field RxPortUsart */
+#define HWREVOLUTION_RXPORTUSART_MAXOPTVAL 18
+/* Ensure field RxPortUsart contains valid data */
+static inline bool HwRevolutionRxPortUsartIsValid( uint8_t CurrentRxPortUsart ) { return CurrentRxPortUsart < HWREVOLUTION_RXPORTUSART_MAXOPTVAL; }
+// Field USB_HIDPort information
+/* Enumeration options for field USB_HIDPort */
+typedef enum { HWREVOLUTION_USB_HIDPORT_USBTELEMETRY=HWSHARED_USB_HIDPORT_USBTELEMETRY, HWREVOLUTION_USB_HIDPORT_DISABLED=HWSHARED_USB_HIDPORT_DISABLED, HWREVOLUTION_USB_HIDPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionUSB_HIDPortOptions;
+/* Max value of any option in topmost parent USB_HIDPort of field USB_HIDPort */
+#define HWREVOLUTION_USB_HIDPORT_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field USB_HIDPort */
+#define HWREVOLUTION_USB_HIDPORT_MAXOPTVAL 1
+/* Ensure field USB_HIDPort contains valid data */
+static inline bool HwRevolutionUSB_HIDPortIsValid( uint8_t CurrentUSB_HIDPort ) { return CurrentUSB_HIDPort < HWREVOLUTION_USB_HIDPORT_MAXOPTVAL; }
+// Field USB_VCPPort information
+/* Enumeration options for field USB_VCPPort */
+typedef enum { HWREVOLUTION_USB_VCPPORT_USBTELEMETRY=HWSHARED_USB_VCPPORT_USBTELEMETRY, HWREVOLUTION_USB_VCPPORT_COMBRIDGE=HWSHARED_USB_VCPPORT_COMBRIDGE, HWREVOLUTION_USB_VCPPORT_DEBUGCONSOLE=HWSHARED_USB_VCPPORT_DEBUGCONSOLE, HWREVOLUTION_USB_VCPPORT_PICOC=HWSHARED_USB_VCPPORT_PICOC, HWREVOLUTION_USB_VCPPORT_DISABLED=HWSHARED_USB_VCPPORT_DISABLED, HWREVOLUTION_USB_VCPPORT_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionUSB_VCPPortOptions;
+/* Max value of any option in topmost parent USB_VCPPort of field USB_VCPPort */
+#define HWREVOLUTION_USB_VCPPORT_GLOBAL_MAXOPTVAL 4
+/* Max value of any option in field USB_VCPPort */
+#define HWREVOLUTION_USB_VCPPORT_MAXOPTVAL 4
+/* Ensure field USB_VCPPort contains valid data */
+static inline bool HwRevolutionUSB_VCPPortIsValid( uint8_t CurrentUSB_VCPPort ) { return CurrentUSB_VCPPort < HWREVOLUTION_USB_VCPPORT_MAXOPTVAL; }
+// Field DSMxMode information
+/* Enumeration options for field DSMxMode */
+typedef enum { HWREVOLUTION_DSMXMODE_AUTODETECT=HWSHARED_DSMXMODE_AUTODETECT, HWREVOLUTION_DSMXMODE_FORCE10BIT=HWSHARED_DSMXMODE_FORCE10BIT, HWREVOLUTION_DSMXMODE_FORCE11BIT=HWSHARED_DSMXMODE_FORCE11BIT, HWREVOLUTION_DSMXMODE_BIND3PULSES=HWSHARED_DSMXMODE_BIND3PULSES, HWREVOLUTION_DSMXMODE_BIND4PULSES=HWSHARED_DSMXMODE_BIND4PULSES, HWREVOLUTION_DSMXMODE_BIND5PULSES=HWSHARED_DSMXMODE_BIND5PULSES, HWREVOLUTION_DSMXMODE_BIND6PULSES=HWSHARED_DSMXMODE_BIND6PULSES, HWREVOLUTION_DSMXMODE_BIND7PULSES=HWSHARED_DSMXMODE_BIND7PULSES, HWREVOLUTION_DSMXMODE_BIND8PULSES=HWSHARED_DSMXMODE_BIND8PULSES, HWREVOLUTION_DSMXMODE_BIND9PULSES=HWSHARED_DSMXMODE_BIND9PULSES, HWREVOLUTION_DSMXMODE_BIND10PULSES=HWSHARED_DSMXMODE_BIND10PULSES, HWREVOLUTION_DSMXMODE_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionDSMxModeOptions;
+/* Max value of any option in topmost parent DSMxMode of field DSMxMode */
+#define HWREVOLUTION_DSMXMODE_GLOBAL_MAXOPTVAL 10
+/* Max value of any option in field DSMxMode */
+#define HWREVOLUTION_DSMXMODE_MAXOPTVAL 10
+/* Ensure field DSMxMode contains valid data */
+static inline bool HwRevolutionDSMxModeIsValid( uint8_t CurrentDSMxMode ) { return CurrentDSMxMode < HWREVOLUTION_DSMXMODE_MAXOPTVAL; }
+// Field Radio information
+/* Enumeration options for field Radio */
+typedef enum { HWREVOLUTION_RADIO_DISABLED=HWSHARED_RADIOPORT_DISABLED, HWREVOLUTION_RADIO_TELEM=HWSHARED_RADIOPORT_TELEM, HWREVOLUTION_RADIO_TELEMPPM=HWSHARED_RADIOPORT_TELEMPPM, HWREVOLUTION_RADIO_PPM=HWSHARED_RADIOPORT_PPM, HWREVOLUTION_RADIO_OPENLRS=HWSHARED_RADIOPORT_OPENLRS, HWREVOLUTION_RADIO_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionRadioOptions;
+/* Max value of any option in topmost parent RadioPort of field Radio */
+#define HWREVOLUTION_RADIO_GLOBAL_MAXOPTVAL 4
+/* Max value of any option in field Radio */
+#define HWREVOLUTION_RADIO_MAXOPTVAL 4
+/* Ensure field Radio contains valid data */
+static inline bool HwRevolutionRadioIsValid( uint8_t CurrentRadio ) { return CurrentRadio < HWREVOLUTION_RADIO_MAXOPTVAL; }
+// Field MaxRfSpeed information
+/* Enumeration options for field MaxRfSpeed */
+typedef enum { HWREVOLUTION_MAXRFSPEED_9600=0, HWREVOLUTION_MAXRFSPEED_19200=1, HWREVOLUTION_MAXRFSPEED_32000=2, HWREVOLUTION_MAXRFSPEED_64000=3, HWREVOLUTION_MAXRFSPEED_100000=4, HWREVOLUTION_MAXRFSPEED_192000=5 }  __attribute__((packed)) HwRevolutionMaxRfSpeedOptions;
+/* Max value of any option in topmost parent MaxRfSpeed of field MaxRfSpeed */
+#define HWREVOLUTION_MAXRFSPEED_GLOBAL_MAXOPTVAL 5
+/* Max value of any option in field MaxRfSpeed */
+#define HWREVOLUTION_MAXRFSPEED_MAXOPTVAL 5
+/* Ensure field MaxRfSpeed contains valid data */
+static inline bool HwRevolutionMaxRfSpeedIsValid( uint8_t CurrentMaxRfSpeed ) { return CurrentMaxRfSpeed < HWREVOLUTION_MAXRFSPEED_MAXOPTVAL; }
+// Field MaxRfPower information
+/* Enumeration options for field MaxRfPower */
+typedef enum { HWREVOLUTION_MAXRFPOWER_0=0, HWREVOLUTION_MAXRFPOWER_125=1, HWREVOLUTION_MAXRFPOWER_16=2, HWREVOLUTION_MAXRFPOWER_316=3, HWREVOLUTION_MAXRFPOWER_63=4, HWREVOLUTION_MAXRFPOWER_126=5, HWREVOLUTION_MAXRFPOWER_25=6, HWREVOLUTION_MAXRFPOWER_50=7, HWREVOLUTION_MAXRFPOWER_100=8 }  __attribute__((packed)) HwRevolutionMaxRfPowerOptions;
+/* Max value of any option in topmost parent MaxRfPower of field MaxRfPower */
+#define HWREVOLUTION_MAXRFPOWER_GLOBAL_MAXOPTVAL 8
+/* Max value of any option in field MaxRfPower */
+#define HWREVOLUTION_MAXRFPOWER_MAXOPTVAL 8
+/* Ensure field MaxRfPower contains valid data */
+static inline bool HwRevolutionMaxRfPowerIsValid( uint8_t CurrentMaxRfPower ) { return CurrentMaxRfPower < HWREVOLUTION_MAXRFPOWER_MAXOPTVAL; }
+// Field RfBand information
+/* Enumeration options for field RfBand */
+typedef enum { HWREVOLUTION_RFBAND_BOARDDEFAULT=HWSHARED_RFBAND_BOARDDEFAULT, HWREVOLUTION_RFBAND_433=HWSHARED_RFBAND_433, HWREVOLUTION_RFBAND_868=HWSHARED_RFBAND_868, HWREVOLUTION_RFBAND_915=HWSHARED_RFBAND_915, HWREVOLUTION_RFBAND_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) HwRevolutionRfBandOptions;
+/* Max value of any option in topmost parent RfBand of field RfBand */
+#define HWREVOLUTION_RFBAND_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field RfBand */
+#define HWREVOLUTION_RFBAND_MAXOPTVAL 3
+/* Ensure field RfBand contains valid data */
+static inline bool HwRevolutionRfBandIsValid( uint8_t CurrentRfBand ) { return CurrentRfBand < HWREVOLUTION_RFBAND_MAXOPTVAL; }
+// Field MinChannel information
+// Field MaxChannel information
+// Field GyroRange information
+/* Enumeration options for field GyroRange */
+typedef enum { HWREVOLUTION_GYRORANGE_250=0, HWREVOLUTION_GYRORANGE_500=1, HWREVOLUTION_GYRORANGE_1000=2, HWREVOLUTION_GYRORANGE_2000=3 }  __attribute__((packed)) HwRevolutionGyroRangeOptions;
+/* Max value of any option in topmost parent GyroRange of field GyroRange */
+#define HWREVOLUTION_GYRORANGE_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field GyroRange */
+#define HWREVOLUTION_GYRORANGE_MAXOPTVAL 3
+/* Ensure field GyroRange contains valid data */
+static inline bool HwRevolutionGyroRangeIsValid( uint8_t CurrentGyroRange ) { return CurrentGyroRange < HWREVOLUTION_GYRORANGE_MAXOPTVAL; }
+// Field AccelRange information
+/* Enumeration options for field AccelRange */
+typedef enum { HWREVOLUTION_ACCELRANGE_2G=0, HWREVOLUTION_ACCELRANGE_4G=1, HWREVOLUTION_ACCELRANGE_8G=2, HWREVOLUTION_ACCELRANGE_16G=3 }  __attribute__((packed)) HwRevolutionAccelRangeOptions;
+/* Max value of any option in topmost parent AccelRange of field AccelRange */
+#define HWREVOLUTION_ACCELRANGE_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field AccelRange */
+#define HWREVOLUTION_ACCELRANGE_MAXOPTVAL 3
+/* Ensure field AccelRange contains valid data */
+static inline bool HwRevolutionAccelRangeIsValid( uint8_t CurrentAccelRange ) { return CurrentAccelRange < HWREVOLUTION_ACCELRANGE_MAXOPTVAL; }
+// Field MPU6000Rate information
+/* Enumeration options for field MPU6000Rate */
+typedef enum { HWREVOLUTION_MPU6000RATE_200=0, HWREVOLUTION_MPU6000RATE_333=1, HWREVOLUTION_MPU6000RATE_500=2, HWREVOLUTION_MPU6000RATE_666=3, HWREVOLUTION_MPU6000RATE_1000=4, HWREVOLUTION_MPU6000RATE_2000=5, HWREVOLUTION_MPU6000RATE_4000=6, HWREVOLUTION_MPU6000RATE_8000=7 }  __attribute__((packed)) HwRevolutionMPU6000RateOptions;
+/* Max value of any option in topmost parent MPU6000Rate of field MPU6000Rate */
+#define HWREVOLUTION_MPU6000RATE_GLOBAL_MAXOPTVAL 7
+/* Max value of any option in field MPU6000Rate */
+#define HWREVOLUTION_MPU6000RATE_MAXOPTVAL 7
+/* Ensure field MPU6000Rate contains valid data */
+static inline bool HwRevolutionMPU6000RateIsValid( uint8_t CurrentMPU6000Rate ) { return CurrentMPU6000Rate < HWREVOLUTION_MPU6000RATE_MAXOPTVAL; }
+// Field MPU6000DLPF information
+/* Enumeration options for field MPU6000DLPF */
+typedef enum { HWREVOLUTION_MPU6000DLPF_256=0, HWREVOLUTION_MPU6000DLPF_188=1, HWREVOLUTION_MPU6000DLPF_98=2, HWREVOLUTION_MPU6000DLPF_42=3, HWREVOLUTION_MPU6000DLPF_20=4, HWREVOLUTION_MPU6000DLPF_10=5, HWREVOLUTION_MPU6000DLPF_5=6 }  __attribute__((packed)) HwRevolutionMPU6000DLPFOptions;
+/* Max value of any option in topmost parent MPU6000DLPF of field MPU6000DLPF */
+#define HWREVOLUTION_MPU6000DLPF_GLOBAL_MAXOPTVAL 6
+/* Max value of any option in field MPU6000DLPF */
+#define HWREVOLUTION_MPU6000DLPF_MAXOPTVAL 6
+/* Ensure field MPU6000DLPF contains valid data */
+static inline bool HwRevolutionMPU6000DLPFIsValid( uint8_t CurrentMPU6000DLPF ) { return CurrentMPU6000DLPF < HWREVOLUTION_MPU6000DLPF_MAXOPTVAL; }
+// Field Magnetometer information
+/* Enumeration options for field Magnetometer */
+typedef enum { HWREVOLUTION_MAGNETOMETER_DISABLED=0, HWREVOLUTION_MAGNETOMETER_INTERNAL=1, HWREVOLUTION_MAGNETOMETER_EXTERNALI2CFLEXIPORT=2 }  __attribute__((packed)) HwRevolutionMagnetometerOptions;
+/* Max value of any option in topmost parent Magnetometer of field Magnetometer */
+#define HWREVOLUTION_MAGNETOMETER_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field Magnetometer */
+#define HWREVOLUTION_MAGNETOMETER_MAXOPTVAL 2
+/* Ensure field Magnetometer contains valid data */
+static inline bool HwRevolutionMagnetometerIsValid( uint8_t CurrentMagnetometer ) { return CurrentMagnetometer < HWREVOLUTION_MAGNETOMETER_MAXOPTVAL; }
+// Field ExtMagOrientation information
+/* Enumeration options for field ExtMagOrientation */
+typedef enum { HWREVOLUTION_EXTMAGORIENTATION_TOP0DEGCW=0, HWREVOLUTION_EXTMAGORIENTATION_TOP90DEGCW=1, HWREVOLUTION_EXTMAGORIENTATION_TOP180DEGCW=2, HWREVOLUTION_EXTMAGORIENTATION_TOP270DEGCW=3, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM0DEGCW=4, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM90DEGCW=5, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM180DEGCW=6, HWREVOLUTION_EXTMAGORIENTATION_BOTTOM270DEGCW=7 }  __attribute__((packed)) HwRevolutionExtMagOrientationOptions;
+/* Max value of any option in topmost parent ExtMagOrientation of field ExtMagOrientation */
+#define HWREVOLUTION_EXTMAGORIENTATION_GLOBAL_MAXOPTVAL 7
+/* Max value of any option in field ExtMagOrientation */
+#define HWREVOLUTION_EXTMAGORIENTATION_MAXOPTVAL 7
+/* Ensure field ExtMagOrientation contains valid data */
+static inline bool HwRevolutionExtMagOrientationIsValid( uint8_t CurrentExtMagOrientation ) { return CurrentExtMagOrientation < HWREVOLUTION_EXTMAGORIENTATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void HwRevolutionCoordIDSet( uint32_t *NewCoordID );
+extern void HwRevolutionCoordIDGet( uint32_t *NewCoordID );
+extern void HwRevolutionRxPortSet( uint8_t *NewRxPort );
+extern void HwRevolutionRxPortGet( uint8_t *NewRxPort );
+extern void HwRevolutionMainPortSet( uint8_t *NewMainPort );
+extern void HwRevolutionMainPortGet( uint8_t *NewMainPort );
+extern void HwRevolutionFlexiPortSet( uint8_t *NewFlexiPort );
+extern void HwRevolutionFlexiPortGet( uint8_t *NewFlexiPort );
+extern void HwRevolutionRxPortUsartSet( uint8_t *NewRxPortUsart );
+extern void HwRevolutionRxPortUsartGet( uint8_t *NewRxPortUsart );
+extern void HwRevolutionUSB_HIDPortSet( uint8_t *NewUSB_HIDPort );
+extern void HwRevolutionUSB_HIDPortGet( uint8_t *NewUSB_HIDPort );
+extern void HwRevolutionUSB_VCPPortSet( uint8_t *NewUSB_VCPPort );
+extern void HwRevolutionUSB_VCPPortGet( uint8_t *NewUSB_VCPPort );
+extern void HwRevolutionDSMxModeSet( uint8_t *NewDSMxMode );
+extern void HwRevolutionDSMxModeGet( uint8_t *NewDSMxMode );
+extern void HwRevolutionRadioSet( uint8_t *NewRadio );
+extern void HwRevolutionRadioGet( uint8_t *NewRadio );
+extern void HwRevolutionMaxRfSpeedSet( uint8_t *NewMaxRfSpeed );
+extern void HwRevolutionMaxRfSpeedGet( uint8_t *NewMaxRfSpeed );
+extern void HwRevolutionMaxRfPowerSet( uint8_t *NewMaxRfPower );
+extern void HwRevolutionMaxRfPowerGet( uint8_t *NewMaxRfPower );
+extern void HwRevolutionRfBandSet( uint8_t *NewRfBand );
+extern void HwRevolutionRfBandGet( uint8_t *NewRfBand );
+extern void HwRevolutionMinChannelSet( uint8_t *NewMinChannel );
+extern void HwRevolutionMinChannelGet( uint8_t *NewMinChannel );
+extern void HwRevolutionMaxChannelSet( uint8_t *NewMaxChannel );
+extern void HwRevolutionMaxChannelGet( uint8_t *NewMaxChannel );
+extern void HwRevolutionGyroRangeSet( uint8_t *NewGyroRange );
+extern void HwRevolutionGyroRangeGet( uint8_t *NewGyroRange );
+extern void HwRevolutionAccelRangeSet( uint8_t *NewAccelRange );
+extern void HwRevolutionAccelRangeGet( uint8_t *NewAccelRange );
+extern void HwRevolutionMPU6000RateSet( uint8_t *NewMPU6000Rate );
+extern void HwRevolutionMPU6000RateGet( uint8_t *NewMPU6000Rate );
+extern void HwRevolutionMPU6000DLPFSet( uint8_t *NewMPU6000DLPF );
+extern void HwRevolutionMPU6000DLPFGet( uint8_t *NewMPU6000DLPF );
+extern void HwRevolutionMagnetometerSet( uint8_t *NewMagnetometer );
+extern void HwRevolutionMagnetometerGet( uint8_t *NewMagnetometer );
+extern void HwRevolutionExtMagOrientationSet( uint8_t *NewExtMagOrientation );
+extern void HwRevolutionExtMagOrientationGet( uint8_t *NewExtMagOrientation );
+
+
+#endif // HWREVOLUTION_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,176 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       loggingsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the LoggingSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: loggingsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "loggingsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t LoggingSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(LOGGINGSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(LOGGINGSETTINGS_OBJID,
+			LOGGINGSETTINGS_ISSINGLEINST, LOGGINGSETTINGS_ISSETTINGS, LOGGINGSETTINGS_ISSEQLOCKED,
+			LOGGINGSETTINGS_NUMBYTES, &LoggingSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void LoggingSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	LoggingSettingsData data = {};
+
+	data.LogBehavior = 1;
+	data.LogSettingsOnStart = 0;
+	data.MaxLogRate = 2;
+	data.Profile = 0;
+	data.LogFormat = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void LoggingSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void LoggingSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	LoggingSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		LoggingSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle LoggingSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void LoggingSettingsLogBehaviorSet( uint8_t *NewLogBehavior )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewLogBehavior, offsetof( LoggingSettingsData, LogBehavior), sizeof(uint8_t));
+}
+void LoggingSettingsLogBehaviorGet( uint8_t *NewLogBehavior )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewLogBehavior, offsetof( LoggingSettingsData, LogBehavior), sizeof(uint8_t));
+}
+void LoggingSettingsLogSettingsOnStartSet( uint8_t *NewLogSettingsOnStart )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewLogSettingsOnStart, offsetof( LoggingSettingsData, LogSettingsOnStart), sizeof(uint8_t));
+}
+void LoggingSettingsLogSettingsOnStartGet( uint8_t *NewLogSettingsOnStart )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewLogSettingsOnStart, offsetof( LoggingSettingsData, LogSettingsOnStart), sizeof(uint8_t));
+}
+void LoggingSettingsMaxLogRateSet( uint8_t *NewMaxLogRate )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewMaxLogRate, offsetof( LoggingSettingsData, MaxLogRate), sizeof(uint8_t));
+}
+void LoggingSettingsMaxLogRateGet( uint8_t *NewMaxLogRate )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewMaxLogRate, offsetof( LoggingSettingsData, MaxLogRate), sizeof(uint8_t));
+}
+void LoggingSettingsProfileSet( uint8_t *NewProfile )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewProfile, offsetof( LoggingSettingsData, Profile), sizeof(uint8_t));
+}
+void LoggingSettingsProfileGet( uint8_t *NewProfile )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewProfile, offsetof( LoggingSettingsData, Profile), sizeof(uint8_t));
+}
+void LoggingSettingsLogFormatSet( uint8_t *NewLogFormat )
+{
+	UAVObjSetDataField(LoggingSettingsHandle(), (void*)NewLogFormat, offsetof( LoggingSettingsData, LogFormat), sizeof(uint8_t));
+}
+void LoggingSettingsLogFormatGet( uint8_t *NewLogFormat )
+{
+	UAVObjGetDataField(LoggingSettingsHandle(), (void*)NewLogFormat, offsetof( LoggingSettingsData, LogFormat), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,227 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       loggingstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the LoggingStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: loggingstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "loggingstats.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t LoggingStatsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(LOGGINGSTATS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(LOGGINGSTATS_OBJID,
+			LOGGINGSTATS_ISSINGLEINST, LOGGINGSTATS_ISSETTINGS, LOGGINGSTATS_ISSEQLOCKED,
+			LOGGINGSTATS_NUMBYTES, &LoggingStatsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void LoggingStatsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	LoggingStatsData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void LoggingStatsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 1000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void LoggingStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	LoggingStatsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		LoggingStatsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle LoggingStatsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void LoggingStatsBytesLoggedSet( uint32_t *NewBytesLogged )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewBytesLogged, offsetof( LoggingStatsData, BytesLogged), sizeof(uint32_t));
+}
+void LoggingStatsBytesLoggedGet( uint32_t *NewBytesLogged )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewBytesLogged, offsetof( LoggingStatsData, BytesLogged), sizeof(uint32_t));
+}
+void LoggingStatsFlashWritesSet( uint32_t *NewFlashWrites )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFlashWrites, offsetof( LoggingStatsData, FlashWrites), sizeof(uint32_t));
+}
+void LoggingStatsFlashWritesGet( uint32_t *NewFlashWrites )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFlashWrites, offsetof( LoggingStatsData, FlashWrites), sizeof(uint32_t));
+}
+void LoggingStatsFlashWriteAmplificationSet( float *NewFlashWriteAmplification )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFlashWriteAmplification, offsetof( LoggingStatsData, FlashWriteAmplification), sizeof(float));
+}
+void LoggingStatsFlashWriteAmplificationGet( float *NewFlashWriteAmplification )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFlashWriteAmplification, offsetof( LoggingStatsData, FlashWriteAmplification), sizeof(float));
+}
+void LoggingStatsFlashStallTimeSet( uint32_t *NewFlashStallTime )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFlashStallTime, offsetof( LoggingStatsData, FlashStallTime), sizeof(uint32_t));
+}
+void LoggingStatsFlashStallTimeGet( uint32_t *NewFlashStallTime )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFlashStallTime, offsetof( LoggingStatsData, FlashStallTime), sizeof(uint32_t));
+}
+void LoggingStatsFlashMaxStallSet( uint32_t *NewFlashMaxStall )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFlashMaxStall, offsetof( LoggingStatsData, FlashMaxStall), sizeof(uint32_t));
+}
+void LoggingStatsFlashMaxStallGet( uint32_t *NewFlashMaxStall )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFlashMaxStall, offsetof( LoggingStatsData, FlashMaxStall), sizeof(uint32_t));
+}
+void LoggingStatsCompressionRatioSet( float *NewCompressionRatio )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewCompressionRatio, offsetof( LoggingStatsData, CompressionRatio), sizeof(float));
+}
+void LoggingStatsCompressionRatioGet( float *NewCompressionRatio )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewCompressionRatio, offsetof( LoggingStatsData, CompressionRatio), sizeof(float));
+}
+void LoggingStatsMinFileIdSet( uint16_t *NewMinFileId )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewMinFileId, offsetof( LoggingStatsData, MinFileId), sizeof(uint16_t));
+}
+void LoggingStatsMinFileIdGet( uint16_t *NewMinFileId )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewMinFileId, offsetof( LoggingStatsData, MinFileId), sizeof(uint16_t));
+}
+void LoggingStatsMaxFileIdSet( uint16_t *NewMaxFileId )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewMaxFileId, offsetof( LoggingStatsData, MaxFileId), sizeof(uint16_t));
+}
+void LoggingStatsMaxFileIdGet( uint16_t *NewMaxFileId )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewMaxFileId, offsetof( LoggingStatsData, MaxFileId), sizeof(uint16_t));
+}
+void LoggingStatsFileRequestSet( uint16_t *NewFileRequest )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFileRequest, offsetof( LoggingStatsData, FileRequest), sizeof(uint16_t));
+}
+void LoggingStatsFileRequestGet( uint16_t *NewFileRequest )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFileRequest, offsetof( LoggingStatsData, FileRequest), sizeof(uint16_t));
+}
+void LoggingStatsFileSectorNumSet( uint16_t *NewFileSectorNum )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFileSectorNum, offsetof( LoggingStatsData, FileSectorNum), sizeof(uint16_t));
+}
+void LoggingStatsFileSectorNumGet( uint16_t *NewFileSectorNum )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFileSectorNum, offsetof( LoggingStatsData, FileSectorNum), sizeof(uint16_t));
+}
+void LoggingStatsOperationSet( uint8_t *NewOperation )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewOperation, offsetof( LoggingStatsData, Operation), sizeof(uint8_t));
+}
+void LoggingStatsOperationGet( uint8_t *NewOperation )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewOperation, offsetof( LoggingStatsData, Operation), sizeof(uint8_t));
+}
+void LoggingStatsFileSectorSet( uint8_t *NewFileSector )
+{
+	UAVObjSetDataField(LoggingStatsHandle(), (void*)NewFileSector, offsetof( LoggingStatsData, FileSector), 128*sizeof(uint8_t));
+}
+void LoggingStatsFileSectorGet( uint8_t *NewFileSector )
+{
+	UAVObjGetDataField(LoggingStatsHandle(), (void*)NewFileSector, offsetof( LoggingStatsData, FileSector), 128*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
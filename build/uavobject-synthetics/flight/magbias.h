@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup MagBias MagBias
+ * @brief The gyro data.
+ *
+ *
+ * @file       magbias.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the MagBias object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: magbias.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MAGBIAS_H
+#define MAGBIAS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define MAGBIAS_OBJID 0x5043E510
+#define MAGBIAS_ISSINGLEINST 1
+#define MAGBIAS_ISSETTINGS 0
+#define MAGBIAS_ISSEQLOCKED 0
+#define MAGBIAS_NUMBYTES 12
+
+// Generic interface functions
+int32_t MagBiasInitialize();
+UAVObjHandle MagBiasHandle();
+void MagBiasSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float x;
+    float y;
+    float z;
+
+} __attribute__((packed)) __attribute__((aligned(4))) MagBiasData;
+
+// Typesafe Object access functions
+/**
+ * @function MagBiasGet(dataOut)
+ * @brief Populate a MagBiasData object
+ * @param[out] dataOut 
+ */
+static inline int32_t MagBiasGet(MagBiasData *dataOut) { return UAVObjGetData(MagBiasHandle(), dataOut); }
+
+static inline int32_t MagBiasSet(const MagBiasData *dataIn) { return UAVObjSetData(MagBiasHandle(), dataIn); }
+
+static inline int32_t MagBiasInstGet(uint16_t instId, MagBiasData *dataOut) { return UAVObjGetInstanceData(MagBiasHandle(), instId, dataOut); }
+
+static inline int32_t MagBiasInstSet(uint16_t instId, const MagBiasData *dataIn) { return UAVObjSetInstanceData(MagBiasHandle(), instId, dataIn); }
+
+static inline int32_t MagBiasConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(MagBiasHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t MagBiasConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(MagBiasHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t MagBiasConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(MagBiasHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t MagBiasConnectCopy(volatile MagBiasData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	MagBiasGet((void *) dataOut);
+
+	return UAVObjConnectCallback(MagBiasHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t MagBiasCreateInstance() { return UAVObjCreateInstance(MagBiasHandle(), &MagBiasSetDefaults); }
+
+static inline void MagBiasUpdated() { UAVObjUpdated(MagBiasHandle()); }
+
+static inline void MagBiasInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(MagBiasHandle(), instId); }
+
+static inline int32_t MagBiasGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(MagBiasHandle(), dataOut); }
+
+static inline int32_t MagBiasSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(MagBiasHandle(), dataIn); }
+
+static inline int8_t MagBiasReadOnly() { return UAVObjReadOnly(MagBiasHandle()); }
+
+static inline uint16_t MagBiasGetNumInstances(){ return UAVObjGetNumInstances(MagBiasHandle()); }
+
+static inline uint32_t MagBiasGetNumBytes(){ return UAVObjGetNumBytes(MagBiasHandle()); }
+
+// Field information
+// Field x information
+// Field y information
+// Field z information
+
+
+// set/Get functions
+extern void MagBiasxSet( float *Newx );
+extern void MagBiasxGet( float *Newx );
+extern void MagBiasySet( float *Newy );
+extern void MagBiasyGet( float *Newy );
+extern void MagBiaszSet( float *Newz );
+extern void MagBiaszGet( float *Newz );
+
+
+#endif // MAGBIAS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,403 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       manualcontrolsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the ManualControlSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: manualcontrolsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "manualcontrolsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ManualControlSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(MANUALCONTROLSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(MANUALCONTROLSETTINGS_OBJID,
+			MANUALCONTROLSETTINGS_ISSINGLEINST, MANUALCONTROLSETTINGS_ISSETTINGS, MANUALCONTROLSETTINGS_ISSEQLOCKED,
+			MANUALCONTROLSETTINGS_NUMBYTES, &ManualControlSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void ManualControlSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	ManualControlSettingsData data = {};
+
+	data.Deadband = 0;
+	data.RssiMax = 2000;
+	data.RssiMin = 1000;
+	data.ChannelMin[0] = 1000;
+	data.ChannelMin[1] = 1000;
+	data.ChannelMin[2] = 1000;
+	data.ChannelMin[3] = 1000;
+	data.ChannelMin[4] = 1000;
+	data.ChannelMin[5] = 1000;
+	data.ChannelMin[6] = 1000;
+	data.ChannelMin[7] = 1000;
+	data.ChannelMin[8] = 1000;
+	data.ChannelMin[9] = 1000;
+	data.ChannelNeutral[0] = 1500;
+	data.ChannelNeutral[1] = 1500;
+	data.ChannelNeutral[2] = 1500;
+	data.ChannelNeutral[3] = 1500;
+	data.ChannelNeutral[4] = 1500;
+	data.ChannelNeutral[5] = 1500;
+	data.ChannelNeutral[6] = 1500;
+	data.ChannelNeutral[7] = 1500;
+	data.ChannelNeutral[8] = 1500;
+	data.ChannelNeutral[9] = 1500;
+	data.ChannelMax[0] = 2000;
+	data.ChannelMax[1] = 2000;
+	data.ChannelMax[2] = 2000;
+	data.ChannelMax[3] = 2000;
+	data.ChannelMax[4] = 2000;
+	data.ChannelMax[5] = 2000;
+	data.ChannelMax[6] = 2000;
+	data.ChannelMax[7] = 2000;
+	data.ChannelMax[8] = 2000;
+	data.ChannelMax[9] = 2000;
+	data.ArmedTimeout = 30000;
+	data.InvalidRXArmedTimeout = 0;
+	data.ChannelGroups[0] = 8;
+	data.ChannelGroups[1] = 8;
+	data.ChannelGroups[2] = 8;
+	data.ChannelGroups[3] = 8;
+	data.ChannelGroups[4] = 8;
+	data.ChannelGroups[5] = 8;
+	data.ChannelGroups[6] = 8;
+	data.ChannelGroups[7] = 8;
+	data.ChannelGroups[8] = 8;
+	data.ChannelGroups[9] = 8;
+	data.RssiType = 0;
+	data.RssiChannelNumber = 0;
+	data.ChannelNumber[0] = 0;
+	data.ChannelNumber[1] = 0;
+	data.ChannelNumber[2] = 0;
+	data.ChannelNumber[3] = 0;
+	data.ChannelNumber[4] = 0;
+	data.ChannelNumber[5] = 0;
+	data.ChannelNumber[6] = 0;
+	data.ChannelNumber[7] = 0;
+	data.ChannelNumber[8] = 0;
+	data.ChannelNumber[9] = 0;
+	data.Arming = 0;
+	data.ArmTime = 2;
+	data.DisarmTime = 2;
+	data.Stabilization1Settings[0] = 2;
+	data.Stabilization1Settings[1] = 2;
+	data.Stabilization1Settings[2] = 1;
+	data.Stabilization2Settings[0] = 2;
+	data.Stabilization2Settings[1] = 2;
+	data.Stabilization2Settings[2] = 1;
+	data.Stabilization3Settings[0] = 2;
+	data.Stabilization3Settings[1] = 2;
+	data.Stabilization3Settings[2] = 1;
+	data.Stabilization1Reprojection = 0;
+	data.Stabilization2Reprojection = 0;
+	data.Stabilization3Reprojection = 0;
+	data.FlightModeNumber = 3;
+	data.FlightModePosition[0] = 2;
+	data.FlightModePosition[1] = 2;
+	data.FlightModePosition[2] = 2;
+	data.FlightModePosition[3] = 3;
+	data.FlightModePosition[4] = 12;
+	data.FlightModePosition[5] = 11;
+	data.ArmTimeoutAutonomous = 1;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void ManualControlSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ManualControlSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	ManualControlSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		ManualControlSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ManualControlSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ManualControlSettingsDeadbandSet( float *NewDeadband )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewDeadband, offsetof( ManualControlSettingsData, Deadband), sizeof(float));
+}
+void ManualControlSettingsDeadbandGet( float *NewDeadband )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewDeadband, offsetof( ManualControlSettingsData, Deadband), sizeof(float));
+}
+void ManualControlSettingsRssiMaxSet( int16_t *NewRssiMax )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewRssiMax, offsetof( ManualControlSettingsData, RssiMax), sizeof(int16_t));
+}
+void ManualControlSettingsRssiMaxGet( int16_t *NewRssiMax )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewRssiMax, offsetof( ManualControlSettingsData, RssiMax), sizeof(int16_t));
+}
+void ManualControlSettingsRssiMinSet( int16_t *NewRssiMin )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewRssiMin, offsetof( ManualControlSettingsData, RssiMin), sizeof(int16_t));
+}
+void ManualControlSettingsRssiMinGet( int16_t *NewRssiMin )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewRssiMin, offsetof( ManualControlSettingsData, RssiMin), sizeof(int16_t));
+}
+void ManualControlSettingsChannelMinSet( int16_t *NewChannelMin )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewChannelMin, offsetof( ManualControlSettingsData, ChannelMin), 10*sizeof(int16_t));
+}
+void ManualControlSettingsChannelMinGet( int16_t *NewChannelMin )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewChannelMin, offsetof( ManualControlSettingsData, ChannelMin), 10*sizeof(int16_t));
+}
+void ManualControlSettingsChannelNeutralSet( int16_t *NewChannelNeutral )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewChannelNeutral, offsetof( ManualControlSettingsData, ChannelNeutral), 10*sizeof(int16_t));
+}
+void ManualControlSettingsChannelNeutralGet( int16_t *NewChannelNeutral )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewChannelNeutral, offsetof( ManualControlSettingsData, ChannelNeutral), 10*sizeof(int16_t));
+}
+void ManualControlSettingsChannelMaxSet( int16_t *NewChannelMax )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewChannelMax, offsetof( ManualControlSettingsData, ChannelMax), 10*sizeof(int16_t));
+}
+void ManualControlSettingsChannelMaxGet( int16_t *NewChannelMax )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewChannelMax, offsetof( ManualControlSettingsData, ChannelMax), 10*sizeof(int16_t));
+}
+void ManualControlSettingsArmedTimeoutSet( uint16_t *NewArmedTimeout )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewArmedTimeout, offsetof( ManualControlSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+void ManualControlSettingsArmedTimeoutGet( uint16_t *NewArmedTimeout )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewArmedTimeout, offsetof( ManualControlSettingsData, ArmedTimeout), sizeof(uint16_t));
+}
+void ManualControlSettingsInvalidRXArmedTimeoutSet( uint16_t *NewInvalidRXArmedTimeout )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewInvalidRXArmedTimeout, offsetof( ManualControlSettingsData, InvalidRXArmedTimeout), sizeof(uint16_t));
+}
+void ManualControlSettingsInvalidRXArmedTimeoutGet( uint16_t *NewInvalidRXArmedTimeout )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewInvalidRXArmedTimeout, offsetof( ManualControlSettingsData, InvalidRXArmedTimeout), sizeof(uint16_t));
+}
+void ManualControlSettingsChannelGroupsSet( uint8_t *NewChannelGroups )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewChannelGroups, offsetof( ManualControlSettingsData, ChannelGroups), 10*sizeof(uint8_t));
+}
+void ManualControlSettingsChannelGroupsGet( uint8_t *NewChannelGroups )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewChannelGroups, offsetof( ManualControlSettingsData, ChannelGroups), 10*sizeof(uint8_t));
+}
+void ManualControlSettingsRssiTypeSet( uint8_t *NewRssiType )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewRssiType, offsetof( ManualControlSettingsData, RssiType), sizeof(uint8_t));
+}
+void ManualControlSettingsRssiTypeGet( uint8_t *NewRssiType )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewRssiType, offsetof( ManualControlSettingsData, RssiType), sizeof(uint8_t));
+}
+void ManualControlSettingsRssiChannelNumberSet( uint8_t *NewRssiChannelNumber )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewRssiChannelNumber, offsetof( ManualControlSettingsData, RssiChannelNumber), sizeof(uint8_t));
+}
+void ManualControlSettingsRssiChannelNumberGet( uint8_t *NewRssiChannelNumber )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewRssiChannelNumber, offsetof( ManualControlSettingsData, RssiChannelNumber), sizeof(uint8_t));
+}
+void ManualControlSettingsChannelNumberSet( uint8_t *NewChannelNumber )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewChannelNumber, offsetof( ManualControlSettingsData, ChannelNumber), 10*sizeof(uint8_t));
+}
+void ManualControlSettingsChannelNumberGet( uint8_t *NewChannelNumber )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewChannelNumber, offsetof( ManualControlSettingsData, ChannelNumber), 10*sizeof(uint8_t));
+}
+void ManualControlSettingsArmingSet( uint8_t *NewArming )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewArming, offsetof( ManualControlSettingsData, Arming), sizeof(uint8_t));
+}
+void ManualControlSettingsArmingGet( uint8_t *NewArming )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewArming, offsetof( ManualControlSettingsData, Arming), sizeof(uint8_t));
+}
+void ManualControlSettingsArmTimeSet( uint8_t *NewArmTime )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewArmTime, offsetof( ManualControlSettingsData, ArmTime), sizeof(uint8_t));
+}
+void ManualControlSettingsArmTimeGet( uint8_t *NewArmTime )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewArmTime, offsetof( ManualControlSettingsData, ArmTime), sizeof(uint8_t));
+}
+void ManualControlSettingsDisarmTimeSet( uint8_t *NewDisarmTime )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewDisarmTime, offsetof( ManualControlSettingsData, DisarmTime), sizeof(uint8_t));
+}
+void ManualControlSettingsDisarmTimeGet( uint8_t *NewDisarmTime )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewDisarmTime, offsetof( ManualControlSettingsData, DisarmTime), sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization1SettingsSet( uint8_t *NewStabilization1Settings )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewStabilization1Settings, offsetof( ManualControlSettingsData, Stabilization1Settings), 3*sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization1SettingsGet( uint8_t *NewStabilization1Settings )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewStabilization1Settings, offsetof( ManualControlSettingsData, Stabilization1Settings), 3*sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization2SettingsSet( uint8_t *NewStabilization2Settings )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewStabilization2Settings, offsetof( ManualControlSettingsData, Stabilization2Settings), 3*sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization2SettingsGet( uint8_t *NewStabilization2Settings )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewStabilization2Settings, offsetof( ManualControlSettingsData, Stabilization2Settings), 3*sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization3SettingsSet( uint8_t *NewStabilization3Settings )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewStabilization3Settings, offsetof( ManualControlSettingsData, Stabilization3Settings), 3*sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization3SettingsGet( uint8_t *NewStabilization3Settings )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewStabilization3Settings, offsetof( ManualControlSettingsData, Stabilization3Settings), 3*sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization1ReprojectionSet( uint8_t *NewStabilization1Reprojection )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewStabilization1Reprojection, offsetof( ManualControlSettingsData, Stabilization1Reprojection), sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization1ReprojectionGet( uint8_t *NewStabilization1Reprojection )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewStabilization1Reprojection, offsetof( ManualControlSettingsData, Stabilization1Reprojection), sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization2ReprojectionSet( uint8_t *NewStabilization2Reprojection )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewStabilization2Reprojection, offsetof( ManualControlSettingsData, Stabilization2Reprojection), sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization2ReprojectionGet( uint8_t *NewStabilization2Reprojection )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewStabilization2Reprojection, offsetof( ManualControlSettingsData, Stabilization2Reprojection), sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization3ReprojectionSet( uint8_t *NewStabilization3Reprojection )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewStabilization3Reprojection, offsetof( ManualControlSettingsData, Stabilization3Reprojection), sizeof(uint8_t));
+}
+void ManualControlSettingsStabilization3ReprojectionGet( uint8_t *NewStabilization3Reprojection )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewStabilization3Reprojection, offsetof( ManualControlSettingsData, Stabilization3Reprojection), sizeof(uint8_t));
+}
+void ManualControlSettingsFlightModeNumberSet( uint8_t *NewFlightModeNumber )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewFlightModeNumber, offsetof( ManualControlSettingsData, FlightModeNumber), sizeof(uint8_t));
+}
+void ManualControlSettingsFlightModeNumberGet( uint8_t *NewFlightModeNumber )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewFlightModeNumber, offsetof( ManualControlSettingsData, FlightModeNumber), sizeof(uint8_t));
+}
+void ManualControlSettingsFlightModePositionSet( uint8_t *NewFlightModePosition )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewFlightModePosition, offsetof( ManualControlSettingsData, FlightModePosition), 6*sizeof(uint8_t));
+}
+void ManualControlSettingsFlightModePositionGet( uint8_t *NewFlightModePosition )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewFlightModePosition, offsetof( ManualControlSettingsData, FlightModePosition), 6*sizeof(uint8_t));
+}
+void ManualControlSettingsArmTimeoutAutonomousSet( uint8_t *NewArmTimeoutAutonomous )
+{
+	UAVObjSetDataField(ManualControlSettingsHandle(), (void*)NewArmTimeoutAutonomous, offsetof( ManualControlSettingsData, ArmTimeoutAutonomous), sizeof(uint8_t));
+}
+void ManualControlSettingsArmTimeoutAutonomousGet( uint8_t *NewArmTimeoutAutonomous )
+{
+	UAVObjGetDataField(ManualControlSettingsHandle(), (void*)NewArmTimeoutAutonomous, offsetof( ManualControlSettingsData, ArmTimeoutAutonomous), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,352 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup ManualControlSettings ManualControlSettings
+ * @brief Settings to indicate how to decode receiver input by @ref ManualControlModule.
+ *
+ *
+ * @file       manualcontrolsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the ManualControlSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: manualcontrolsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MANUALCONTROLSETTINGS_H
+#define MANUALCONTROLSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define MANUALCONTROLSETTINGS_OBJID 0xFA4AB60A
+#define MANUALCONTROLSETTINGS_ISSINGLEINST 1
+#define MANUALCONTROLSETTINGS_ISSETTINGS 1
+#define MANUALCONTROLSETTINGS_ISSEQLOCKED 0
+#define MANUALCONTROLSETTINGS_NUMBYTES 117
+
+// Generic interface functions
+int32_t ManualControlSettingsInitialize();
+UAVObjHandle ManualControlSettingsHandle();
+void ManualControlSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float Deadband;
+    int16_t RssiMax;
+    int16_t RssiMin;
+    int16_t ChannelMin[10];
+    int16_t ChannelNeutral[10];
+    int16_t ChannelMax[10];
+    uint16_t ArmedTimeout;
+    uint16_t InvalidRXArmedTimeout;
+    uint8_t ChannelGroups[10];
+    uint8_t RssiType;
+    uint8_t RssiChannelNumber;
+    uint8_t ChannelNumber[10];
+    uint8_t Arming;
+    uint8_t ArmTime;
+    uint8_t DisarmTime;
+    uint8_t Stabilization1Settings[3];
+    uint8_t Stabilization2Settings[3];
+    uint8_t Stabilization3Settings[3];
+    uint8_t Stabilization1Reprojection;
+    uint8_t Stabilization2Reprojection;
+    uint8_t Stabilization3Reprojection;
+    uint8_t FlightModeNumber;
+    uint8_t FlightModePosition[6];
+    uint8_t ArmTimeoutAutonomous;
+
+} __attribute__((packed)) __attribute__((aligned(4))) ManualControlSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function ManualControlSettingsGet(dataOut)
+ * @brief Populate a ManualControlSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t ManualControlSettingsGet(ManualControlSettingsData *dataOut) { return UAVObjGetData(ManualControlSettingsHandle(), dataOut); }
+
+static inline int32_t ManualControlSettingsSet(const ManualControlSettingsData *dataIn) { return UAVObjSetData(ManualControlSettingsHandle(), dataIn); }
+
+static inline int32_t ManualControlSettingsInstGet(uint16_t instId, ManualControlSettingsData *dataOut) { return UAVObjGetInstanceData(ManualControlSettingsHandle(), instId, dataOut); }
+
+static inline int32_t ManualControlSettingsInstSet(uint16_t instId, const ManualControlSettingsData *dataIn) { return UAVObjSetInstanceData(ManualControlSettingsHandle(), instId, dataIn); }
+
+static inline int32_t ManualControlSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(ManualControlSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ManualControlSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(ManualControlSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ManualControlSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(ManualControlSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ManualControlSettingsConnectCopy(volatile ManualControlSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	ManualControlSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(ManualControlSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t ManualControlSettingsCreateInstance() { return UAVObjCreateInstance(ManualControlSettingsHandle(), &ManualControlSettingsSetDefaults); }
+
+static inline void ManualControlSettingsUpdated() { UAVObjUpdated(ManualControlSettingsHandle()); }
+
+static inline void ManualControlSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(ManualControlSettingsHandle(), instId); }
+
+static inline int32_t ManualControlSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(ManualControlSettingsHandle(), dataOut); }
+
+static inline int32_t ManualControlSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(ManualControlSettingsHandle(), dataIn); }
+
+static inline int8_t ManualControlSettingsReadOnly() { return UAVObjReadOnly(ManualControlSettingsHandle()); }
+
+static inline uint16_t ManualControlSettingsGetNumInstances(){ return UAVObjGetNumInstances(ManualControlSettingsHandle()); }
+
+static inline uint32_t ManualControlSettingsGetNumBytes(){ return UAVObjGetNumBytes(ManualControlSettingsHandle()); }
+
+// Field information
+// Field Deadband information
+// Field RssiMax information
+// Field RssiMin information
+// Field ChannelMin information
+/* Array element names for field ChannelMin */
+typedef enum { MANUALCONTROLSETTINGS_CHANNELMIN_THROTTLE=0, MANUALCONTROLSETTINGS_CHANNELMIN_ROLL=1, MANUALCONTROLSETTINGS_CHANNELMIN_PITCH=2, MANUALCONTROLSETTINGS_CHANNELMIN_YAW=3, MANUALCONTROLSETTINGS_CHANNELMIN_FLIGHTMODE=4, MANUALCONTROLSETTINGS_CHANNELMIN_COLLECTIVE=5, MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY0=6, MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY1=7, MANUALCONTROLSETTINGS_CHANNELMIN_ACCESSORY2=8, MANUALCONTROLSETTINGS_CHANNELMIN_ARMING=9 } __attribute__((packed)) ManualControlSettingsChannelMinElem;
+/* Number of elements for field ChannelMin */
+#define MANUALCONTROLSETTINGS_CHANNELMIN_NUMELEM 10
+// Field ChannelNeutral information
+/* Array element names for field ChannelNeutral */
+typedef enum { MANUALCONTROLSETTINGS_CHANNELNEUTRAL_THROTTLE=0, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ROLL=1, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_PITCH=2, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_YAW=3, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_FLIGHTMODE=4, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_COLLECTIVE=5, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY0=6, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY1=7, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ACCESSORY2=8, MANUALCONTROLSETTINGS_CHANNELNEUTRAL_ARMING=9 } __attribute__((packed)) ManualControlSettingsChannelNeutralElem;
+/* Number of elements for field ChannelNeutral */
+#define MANUALCONTROLSETTINGS_CHANNELNEUTRAL_NUMELEM 10
+// Field ChannelMax information
+/* Array element names for field ChannelMax */
+typedef enum { MANUALCONTROLSETTINGS_CHANNELMAX_THROTTLE=0, MANUALCONTROLSETTINGS_CHANNELMAX_ROLL=1, MANUALCONTROLSETTINGS_CHANNELMAX_PITCH=2, MANUALCONTROLSETTINGS_CHANNELMAX_YAW=3, MANUALCONTROLSETTINGS_CHANNELMAX_FLIGHTMODE=4, MANUALCONTROLSETTINGS_CHANNELMAX_COLLECTIVE=5, MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY0=6, MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY1=7, MANUALCONTROLSETTINGS_CHANNELMAX_ACCESSORY2=8, MANUALCONTROLSETTINGS_CHANNELMAX_ARMING=9 } __attribute__((packed)) ManualControlSettingsChannelMaxElem;
+/* Number of elements for field ChannelMax */
+#define MANUALCONTROLSETTINGS_CHANNELMAX_NUMELEM 10
+// Field ArmedTimeout information
+// Field InvalidRXArmedTimeout information
+// Field ChannelGroups information
+/* Enumeration options for field ChannelGroups */
+typedef enum { MANUALCONTROLSETTINGS_CHANNELGROUPS_PWM=0, MANUALCONTROLSETTINGS_CHANNELGROUPS_PPM=1, MANUALCONTROLSETTINGS_CHANNELGROUPS_DSM=2, MANUALCONTROLSETTINGS_CHANNELGROUPS_SBUS=3, MANUALCONTROLSETTINGS_CHANNELGROUPS_RFM22B=4, MANUALCONTROLSETTINGS_CHANNELGROUPS_OPENLRS=5, MANUALCONTROLSETTINGS_CHANNELGROUPS_GCS=6, MANUALCONTROLSETTINGS_CHANNELGROUPS_HOTTSUM=7, MANUALCONTROLSETTINGS_CHANNELGROUPS_NONE=8 }  __attribute__((packed)) ManualControlSettingsChannelGroupsOptions;
+/* Max value of any option in topmost parent ChannelGroups of field ChannelGroups */
+#define MANUALCONTROLSETTINGS_CHANNELGROUPS_GLOBAL_MAXOPTVAL 8
+/* Max value of any option in field ChannelGroups */
+#define MANUALCONTROLSETTINGS_CHANNELGROUPS_MAXOPTVAL 8
+/* Ensure field ChannelGroups contains valid data */
+static inline bool ManualControlSettingsChannelGroupsIsValid( uint8_t CurrentChannelGroups ) { return CurrentChannelGroups < MANUALCONTROLSETTINGS_CHANNELGROUPS_MAXOPTVAL; }
+/* Array element names for field ChannelGroups */
+typedef enum { MANUALCONTROLSETTINGS_CHANNELGROUPS_THROTTLE=0, MANUALCONTROLSETTINGS_CHANNELGROUPS_ROLL=1, MANUALCONTROLSETTINGS_CHANNELGROUPS_PITCH=2, MANUALCONTROLSETTINGS_CHANNELGROUPS_YAW=3, MANUALCONTROLSETTINGS_CHANNELGROUPS_FLIGHTMODE=4, MANUALCONTROLSETTINGS_CHANNELGROUPS_COLLECTIVE=5, MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY0=6, MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY1=7, MANUALCONTROLSETTINGS_CHANNELGROUPS_ACCESSORY2=8, MANUALCONTROLSETTINGS_CHANNELGROUPS_ARMING=9 } __attribute__((packed)) ManualControlSettingsChannelGroupsElem;
+/* Number of elements for field ChannelGroups */
+#define MANUALCONTROLSETTINGS_CHANNELGROUPS_NUMELEM 10
+// Field RssiType information
+/* Enumeration options for field RssiType */
+typedef enum { MANUALCONTROLSETTINGS_RSSITYPE_NONE=0, MANUALCONTROLSETTINGS_RSSITYPE_PWM=1, MANUALCONTROLSETTINGS_RSSITYPE_PPM=2, MANUALCONTROLSETTINGS_RSSITYPE_SBUS=3, MANUALCONTROLSETTINGS_RSSITYPE_HOTTSUM=4, MANUALCONTROLSETTINGS_RSSITYPE_ADC=5, MANUALCONTROLSETTINGS_RSSITYPE_OPENLRS=6, MANUALCONTROLSETTINGS_RSSITYPE_FRSKYPWM=7 }  __attribute__((packed)) ManualControlSettingsRssiTypeOptions;
+/* Max value of any option in topmost parent RssiType of field RssiType */
+#define MANUALCONTROLSETTINGS_RSSITYPE_GLOBAL_MAXOPTVAL 7
+/* Max value of any option in field RssiType */
+#define MANUALCONTROLSETTINGS_RSSITYPE_MAXOPTVAL 7
+/* Ensure field RssiType contains valid data */
+static inline bool ManualControlSettingsRssiTypeIsValid( uint8_t CurrentRssiType ) { return CurrentRssiType < MANUALCONTROLSETTINGS_RSSITYPE_MAXOPTVAL; }
+// Field RssiChannelNumber information
+// Field ChannelNumber information
+/* Array element names for field ChannelNumber */
+typedef enum { MANUALCONTROLSETTINGS_CHANNELNUMBER_THROTTLE=0, MANUALCONTROLSETTINGS_CHANNELNUMBER_ROLL=1, MANUALCONTROLSETTINGS_CHANNELNUMBER_PITCH=2, MANUALCONTROLSETTINGS_CHANNELNUMBER_YAW=3, MANUALCONTROLSETTINGS_CHANNELNUMBER_FLIGHTMODE=4, MANUALCONTROLSETTINGS_CHANNELNUMBER_COLLECTIVE=5, MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY0=6, MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY1=7, MANUALCONTROLSETTINGS_CHANNELNUMBER_ACCESSORY2=8, MANUALCONTROLSETTINGS_CHANNELNUMBER_ARMING=9 } __attribute__((packed)) ManualControlSettingsChannelNumberElem;
+/* Number of elements for field ChannelNumber */
+#define MANUALCONTROLSETTINGS_CHANNELNUMBER_NUMELEM 10
+// Field Arming information
+/* Enumeration options for field Arming */
+typedef enum { MANUALCONTROLSETTINGS_ARMING_ALWAYSDISARMED=0, MANUALCONTROLSETTINGS_ARMING_ALWAYSARMED=1, MANUALCONTROLSETTINGS_ARMING_ROLLLEFTTHROTTLE=2, MANUALCONTROLSETTINGS_ARMING_ROLLRIGHTTHROTTLE=3, MANUALCONTROLSETTINGS_ARMING_YAWLEFTTHROTTLE=4, MANUALCONTROLSETTINGS_ARMING_YAWRIGHTTHROTTLE=5, MANUALCONTROLSETTINGS_ARMING_CORNERSTHROTTLE=6, MANUALCONTROLSETTINGS_ARMING_SWITCH=7, MANUALCONTROLSETTINGS_ARMING_SWITCHDELAY=8, MANUALCONTROLSETTINGS_ARMING_SWITCHTHROTTLE=9, MANUALCONTROLSETTINGS_ARMING_SWITCHTHROTTLEDELAY=10 }  __attribute__((packed)) ManualControlSettingsArmingOptions;
+/* Max value of any option in topmost parent Arming of field Arming */
+#define MANUALCONTROLSETTINGS_ARMING_GLOBAL_MAXOPTVAL 10
+/* Max value of any option in field Arming */
+#define MANUALCONTROLSETTINGS_ARMING_MAXOPTVAL 10
+/* Ensure field Arming contains valid data */
+static inline bool ManualControlSettingsArmingIsValid( uint8_t CurrentArming ) { return CurrentArming < MANUALCONTROLSETTINGS_ARMING_MAXOPTVAL; }
+// Field ArmTime information
+/* Enumeration options for field ArmTime */
+typedef enum { MANUALCONTROLSETTINGS_ARMTIME_250=0, MANUALCONTROLSETTINGS_ARMTIME_500=1, MANUALCONTROLSETTINGS_ARMTIME_1000=2, MANUALCONTROLSETTINGS_ARMTIME_2000=3 }  __attribute__((packed)) ManualControlSettingsArmTimeOptions;
+/* Max value of any option in topmost parent ArmTime of field ArmTime */
+#define MANUALCONTROLSETTINGS_ARMTIME_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field ArmTime */
+#define MANUALCONTROLSETTINGS_ARMTIME_MAXOPTVAL 3
+/* Ensure field ArmTime contains valid data */
+static inline bool ManualControlSettingsArmTimeIsValid( uint8_t CurrentArmTime ) { return CurrentArmTime < MANUALCONTROLSETTINGS_ARMTIME_MAXOPTVAL; }
+// Field DisarmTime information
+/* Enumeration options for field DisarmTime */
+typedef enum { MANUALCONTROLSETTINGS_DISARMTIME_250=0, MANUALCONTROLSETTINGS_DISARMTIME_500=1, MANUALCONTROLSETTINGS_DISARMTIME_1000=2, MANUALCONTROLSETTINGS_DISARMTIME_2000=3 }  __attribute__((packed)) ManualControlSettingsDisarmTimeOptions;
+/* Max value of any option in topmost parent DisarmTime of field DisarmTime */
+#define MANUALCONTROLSETTINGS_DISARMTIME_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field DisarmTime */
+#define MANUALCONTROLSETTINGS_DISARMTIME_MAXOPTVAL 3
+/* Ensure field DisarmTime contains valid data */
+static inline bool ManualControlSettingsDisarmTimeIsValid( uint8_t CurrentDisarmTime ) { return CurrentDisarmTime < MANUALCONTROLSETTINGS_DISARMTIME_MAXOPTVAL; }
+// Field Stabilization1Settings information
+/* Enumeration options for field Stabilization1Settings */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_MANUAL=0, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_RATE=1, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_ATTITUDE=2, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_AXISLOCK=3, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_WEAKLEVELING=4, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_VIRTUALBAR=5, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_HORIZON=6, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_SYSTEMIDENT=7, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_POI=8, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_COORDINATEDFLIGHT=9, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_ACROPLUS=10, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_DISABLED=11, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_FAILSAFE=12 }  __attribute__((packed)) ManualControlSettingsStabilization1SettingsOptions;
+/* Max value of any option in topmost parent Stabilization1Settings of field Stabilization1Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_GLOBAL_MAXOPTVAL 12
+/* Max value of any option in field Stabilization1Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_MAXOPTVAL 12
+/* Ensure field Stabilization1Settings contains valid data */
+static inline bool ManualControlSettingsStabilization1SettingsIsValid( uint8_t CurrentStabilization1Settings ) { return CurrentStabilization1Settings < MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_MAXOPTVAL; }
+/* Array element names for field Stabilization1Settings */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_ROLL=0, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_PITCH=1, MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_YAW=2 } __attribute__((packed)) ManualControlSettingsStabilization1SettingsElem;
+/* Number of elements for field Stabilization1Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION1SETTINGS_NUMELEM 3
+// Field Stabilization2Settings information
+/* Enumeration options for field Stabilization2Settings */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_MANUAL=0, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_RATE=1, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_ATTITUDE=2, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_AXISLOCK=3, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_WEAKLEVELING=4, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_VIRTUALBAR=5, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_HORIZON=6, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_SYSTEMIDENT=7, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_POI=8, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_COORDINATEDFLIGHT=9, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_ACROPLUS=10, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_DISABLED=11, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_FAILSAFE=12 }  __attribute__((packed)) ManualControlSettingsStabilization2SettingsOptions;
+/* Max value of any option in topmost parent Stabilization2Settings of field Stabilization2Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_GLOBAL_MAXOPTVAL 12
+/* Max value of any option in field Stabilization2Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_MAXOPTVAL 12
+/* Ensure field Stabilization2Settings contains valid data */
+static inline bool ManualControlSettingsStabilization2SettingsIsValid( uint8_t CurrentStabilization2Settings ) { return CurrentStabilization2Settings < MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_MAXOPTVAL; }
+/* Array element names for field Stabilization2Settings */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_ROLL=0, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_PITCH=1, MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_YAW=2 } __attribute__((packed)) ManualControlSettingsStabilization2SettingsElem;
+/* Number of elements for field Stabilization2Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION2SETTINGS_NUMELEM 3
+// Field Stabilization3Settings information
+/* Enumeration options for field Stabilization3Settings */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_MANUAL=0, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_RATE=1, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_ATTITUDE=2, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_AXISLOCK=3, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_WEAKLEVELING=4, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_VIRTUALBAR=5, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_HORIZON=6, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_SYSTEMIDENT=7, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_POI=8, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_COORDINATEDFLIGHT=9, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_ACROPLUS=10, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_DISABLED=11, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_FAILSAFE=12 }  __attribute__((packed)) ManualControlSettingsStabilization3SettingsOptions;
+/* Max value of any option in topmost parent Stabilization3Settings of field Stabilization3Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_GLOBAL_MAXOPTVAL 12
+/* Max value of any option in field Stabilization3Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_MAXOPTVAL 12
+/* Ensure field Stabilization3Settings contains valid data */
+static inline bool ManualControlSettingsStabilization3SettingsIsValid( uint8_t CurrentStabilization3Settings ) { return CurrentStabilization3Settings < MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_MAXOPTVAL; }
+/* Array element names for field Stabilization3Settings */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_ROLL=0, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_PITCH=1, MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_YAW=2 } __attribute__((packed)) ManualControlSettingsStabilization3SettingsElem;
+/* Number of elements for field Stabilization3Settings */
+#define MANUALCONTROLSETTINGS_STABILIZATION3SETTINGS_NUMELEM 3
+// Field Stabilization1Reprojection information
+/* Enumeration options for field Stabilization1Reprojection */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION1REPROJECTION_NONE=0, MANUALCONTROLSETTINGS_STABILIZATION1REPROJECTION_CAMERAANGLE=1 }  __attribute__((packed)) ManualControlSettingsStabilization1ReprojectionOptions;
+/* Max value of any option in topmost parent Stabilization1Reprojection of field Stabilization1Reprojection */
+#define MANUALCONTROLSETTINGS_STABILIZATION1REPROJECTION_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Stabilization1Reprojection */
+#define MANUALCONTROLSETTINGS_STABILIZATION1REPROJECTION_MAXOPTVAL 1
+/* Ensure field Stabilization1Reprojection contains valid data */
+static inline bool ManualControlSettingsStabilization1ReprojectionIsValid( uint8_t CurrentStabilization1Reprojection ) { return CurrentStabilization1Reprojection < MANUALCONTROLSETTINGS_STABILIZATION1REPROJECTION_MAXOPTVAL; }
+// Field Stabilization2Reprojection information
+/* Enumeration options for field Stabilization2Reprojection */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION2REPROJECTION_NONE=0, MANUALCONTROLSETTINGS_STABILIZATION2REPROJECTION_CAMERAANGLE=1 }  __attribute__((packed)) ManualControlSettingsStabilization2ReprojectionOptions;
+/* Max value of any option in topmost parent Stabilization2Reprojection of field Stabilization2Reprojection */
+#define MANUALCONTROLSETTINGS_STABILIZATION2REPROJECTION_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Stabilization2Reprojection */
+#define MANUALCONTROLSETTINGS_STABILIZATION2REPROJECTION_MAXOPTVAL 1
+/* Ensure field Stabilization2Reprojection contains valid data */
+static inline bool ManualControlSettingsStabilization2ReprojectionIsValid( uint8_t CurrentStabilization2Reprojection ) { return CurrentStabilization2Reprojection < MANUALCONTROLSETTINGS_STABILIZATION2REPROJECTION_MAXOPTVAL; }
+// Field Stabilization3Reprojection information
+/* Enumeration options for field Stabilization3Reprojection */
+typedef enum { MANUALCONTROLSETTINGS_STABILIZATION3REPROJECTION_NONE=0, MANUALCONTROLSETTINGS_STABILIZATION3REPROJECTION_CAMERAANGLE=1 }  __attribute__((packed)) ManualControlSettingsStabilization3ReprojectionOptions;
+/* Max value of any option in topmost parent Stabilization3Reprojection of field Stabilization3Reprojection */
+#define MANUALCONTROLSETTINGS_STABILIZATION3REPROJECTION_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Stabilization3Reprojection */
+#define MANUALCONTROLSETTINGS_STABILIZATION3REPROJECTION_MAXOPTVAL 1
+/* Ensure field Stabilization3Reprojection contains valid data */
+static inline bool ManualControlSettingsStabilization3ReprojectionIsValid( uint8_t CurrentStabilization3Reprojection ) { return CurrentStabilization3Reprojection < MANUALCONTROLSETTINGS_STABILIZATION3REPROJECTION_MAXOPTVAL; }
+// Field FlightModeNumber information
+// Field FlightModePosition information
+/* Enumeration options for field FlightModePosition */
+typedef enum { MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_MANUAL=0, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_ACRO=1, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_LEVELING=2, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_HORIZON=3, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_AXISLOCK=4, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_VIRTUALBAR=5, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_STABILIZED1=6, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_STABILIZED2=7, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_STABILIZED3=8, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_AUTOTUNE=9, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_ALTITUDEHOLD=10, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_POSITIONHOLD=11, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_RETURNTOHOME=12, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_PATHPLANNER=13, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_TABLETCONTROL=14, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_ACROPLUS=15, MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_FAILSAFE=16 }  __attribute__((packed)) ManualControlSettingsFlightModePositionOptions;
+/* Max value of any option in topmost parent FlightModePosition of field FlightModePosition */
+#define MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_GLOBAL_MAXOPTVAL 16
+/* Max value of any option in field FlightModePosition */
+#define MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_MAXOPTVAL 16
+/* Ensure field FlightModePosition contains valid data */
+static inline bool ManualControlSettingsFlightModePositionIsValid( uint8_t CurrentFlightModePosition ) { return CurrentFlightModePosition < MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_MAXOPTVAL; }
+/* Number of elements for field FlightModePosition */
+#define MANUALCONTROLSETTINGS_FLIGHTMODEPOSITION_NUMELEM 6
+// Field ArmTimeoutAutonomous information
+/* Enumeration options for field ArmTimeoutAutonomous */
+typedef enum { MANUALCONTROLSETTINGS_ARMTIMEOUTAUTONOMOUS_DISABLED=0, MANUALCONTROLSETTINGS_ARMTIMEOUTAUTONOMOUS_ENABLED=1 }  __attribute__((packed)) ManualControlSettingsArmTimeoutAutonomousOptions;
+/* Max value of any option in topmost parent ArmTimeoutAutonomous of field ArmTimeoutAutonomous */
+#define MANUALCONTROLSETTINGS_ARMTIMEOUTAUTONOMOUS_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field ArmTimeoutAutonomous */
+#define MANUALCONTROLSETTINGS_ARMTIMEOUTAUTONOMOUS_MAXOPTVAL 1
+/* Ensure field ArmTimeoutAutonomous contains valid data */
+static inline bool ManualControlSettingsArmTimeoutAutonomousIsValid( uint8_t CurrentArmTimeoutAutonomous ) { return CurrentArmTimeoutAutonomous < MANUALCONTROLSETTINGS_ARMTIMEOUTAUTONOMOUS_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void ManualControlSettingsDeadbandSet( float *NewDeadband );
+extern void ManualControlSettingsDeadbandGet( float *NewDeadband );
+extern void ManualControlSettingsRssiMaxSet( int16_t *NewRssiMax );
+extern void ManualControlSettingsRssiMaxGet( int16_t *NewRssiMax );
+extern void ManualControlSettingsRssiMinSet( int16_t *NewRssiMin );
+extern void ManualControlSettingsRssiMinGet( int16_t *NewRssiMin );
+extern void ManualControlSettingsChannelMinSet( int16_t *NewChannelMin );
+extern void ManualControlSettingsChannelMinGet( int16_t *NewChannelMin );
+extern void ManualControlSettingsChannelNeutralSet( int16_t *NewChannelNeutral );
+extern void ManualControlSettingsChannelNeutralGet( int16_t *NewChannelNeutral );
+extern void ManualControlSettingsChannelMaxSet( int16_t *NewChannelMax );
+extern void ManualControlSettingsChannelMaxGet( int16_t *NewChannelMax );
+extern void ManualControlSettingsArmedTimeoutSet( uint16_t *NewArmedTimeout );
+extern void ManualControlSettingsArmedTimeoutGet( uint16_t *NewArmedTimeout );
+extern void ManualControlSettingsInvalidRXArmedTimeoutSet( uint16_t *NewInvalidRXArmedTimeout );
+extern void ManualControlSettingsInvalidRXArmedTimeoutGet( uint16_t *NewInvalidRXArmedTimeout );
+extern void ManualControlSettingsChannelGroupsSet( uint8_t *NewChannelGroups );
+extern void ManualControlSettingsChannelGroupsGet( uint8_t *NewChannelGroups );
+extern void ManualControlSettingsRssiTypeSet( uint8_t *NewRssiType );
+extern void ManualControlSettingsRssiTypeGet( uint8_t *NewRssiType );
+extern void ManualControlSettingsRssiChannelNumberSet( uint8_t *NewRssiChannelNumber );
+extern void ManualControlSettingsRssiChannelNumberGet( uint8_t *NewRssiChannelNumber );
+extern void ManualControlSettingsChannelNumberSet( uint8_t *NewChannelNumber );
+extern void ManualControlSettingsChannelNumberGet( uint8_t *NewChannelNumber );
+extern void ManualControlSettingsArmingSet( uint8_t *NewArming );
+extern void ManualControlSettingsArmingGet( uint8_t *NewArming );
+extern void ManualControlSettingsArmTimeSet( uint8_t *NewArmTime );
+extern void ManualControlSettingsArmTimeGet( uint8_t *NewArmTime );
+extern void ManualControlSettingsDisarmTimeSet( uint8_t *NewDisarmTime );
+extern void ManualControlSettingsDisarmTimeGet( uint8_t *NewDisarmTime );
+extern void ManualControlSettingsStabilization1SettingsSet( uint8_t *NewStabilization1Settings );
+extern void ManualControlSettingsStabilization1SettingsGet( uint8_t *NewStabilization1Settings );
+extern void ManualControlSettingsStabilization2SettingsSet( uint8_t *NewStabilization2Settings );
+extern void ManualControlSettingsStabilization2SettingsGet( uint8_t *NewStabilization2Settings );
+extern void ManualControlSettingsStabilization3SettingsSet( uint8_t *NewStabilization3Settings );
+extern void ManualControlSettingsStabilization3SettingsGet( uint8_t *NewStabilization3Settings );
+extern void ManualControlSettingsStabilization1ReprojectionSet( uint8_t *NewStabilization1Reprojection );
+extern void ManualControlSettingsStabilization1ReprojectionGet( uint8_t *NewStabilization1Reprojection );
+extern void ManualControlSettingsStabilization2ReprojectionSet( uint8_t *NewStabilization2Reprojection );
+extern void ManualControlSettingsStabilization2ReprojectionGet( uint8_t *NewStabilization2Reprojection );
+extern void ManualControlSettingsStabilization3ReprojectionSet( uint8_t *NewStabilization3Reprojection );
+extern void ManualControlSettingsStabilization3ReprojectionGet( uint8_t *NewStabilization3Reprojection );
+extern void ManualControlSettingsFlightModeNumberSet( uint8_t *NewFlightModeNumber );
+extern void ManualControlSettingsFlightModeNumberGet( uint8_t *NewFlightModeNumber );
+extern void ManualControlSettingsFlightModePositionSet( uint8_t *NewFlightModePosition );
+extern void ManualControlSettingsFlightModePositionGet( uint8_t *NewFlightModePosition );
+extern void ManualControlSettingsArmTimeoutAutonomousSet( uint8_t *NewArmTimeoutAutonomous );
+extern void ManualControlSettingsArmTimeoutAutonomousGet( uint8_t *NewArmTimeoutAutonomous );
+
+
+#endif // MANUALCONTROLSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
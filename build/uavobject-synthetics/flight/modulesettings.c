@@ -0,0 +1,272 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       modulesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the ModuleSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: modulesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "modulesettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ModuleSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(MODULESETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(MODULESETTINGS_OBJID,
+			MODULESETTINGS_ISSINGLEINST, MODULESETTINGS_ISSETTINGS, MODULESETTINGS_ISSEQLOCKED,
+			MODULESETTINGS_NUMBYTES, &ModuleSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void ModuleSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	ModuleSettingsData data = {};
+
+	data.AdminState[0] = 0;
+	data.AdminState[1] = 0;
+	data.AdminState[2] = 0;
+	data.AdminState[3] = 0;
+	data.AdminState[4] = 0;
+	data.AdminState[5] = 0;
+	data.AdminState[6] = 0;
+	data.AdminState[7] = 0;
+	data.AdminState[8] = 0;
+	data.AdminState[9] = 0;
+	data.AdminState[10] = 0;
+	data.AdminState[11] = 0;
+	data.AdminState[12] = 0;
+	data.AdminState[13] = 0;
+	data.AdminState[14] = 0;
+	data.AdminState[15] = 0;
+	data.TelemetrySpeed = 7;
+	data.GPSSpeed = 6;
+	data.GPSDataProtocol = 1;
+	data.GPSAutoConfigure = 1;
+	data.GPSConstellation = 1;
+	data.GPSSBASConstellation = 0;
+	data.GPSDynamicsMode = 4;
+	data.ComUsbBridgeSpeed = 6;
+	data.MavlinkSpeed = 6;
+	data.MSPSpeed = 7;
+	data.LightTelemetrySpeed = 1;
+	data.FrskyAccelData = 0;
+	data.OpenLogSpeed = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void ModuleSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ModuleSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	ModuleSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		ModuleSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ModuleSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ModuleSettingsAdminStateSet( uint8_t *NewAdminState )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewAdminState, offsetof( ModuleSettingsData, AdminState), 16*sizeof(uint8_t));
+}
+void ModuleSettingsAdminStateGet( uint8_t *NewAdminState )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewAdminState, offsetof( ModuleSettingsData, AdminState), 16*sizeof(uint8_t));
+}
+void ModuleSettingsTelemetrySpeedSet( uint8_t *NewTelemetrySpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewTelemetrySpeed, offsetof( ModuleSettingsData, TelemetrySpeed), sizeof(uint8_t));
+}
+void ModuleSettingsTelemetrySpeedGet( uint8_t *NewTelemetrySpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewTelemetrySpeed, offsetof( ModuleSettingsData, TelemetrySpeed), sizeof(uint8_t));
+}
+void ModuleSettingsGPSSpeedSet( uint8_t *NewGPSSpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewGPSSpeed, offsetof( ModuleSettingsData, GPSSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsGPSSpeedGet( uint8_t *NewGPSSpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewGPSSpeed, offsetof( ModuleSettingsData, GPSSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsGPSDataProtocolSet( uint8_t *NewGPSDataProtocol )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewGPSDataProtocol, offsetof( ModuleSettingsData, GPSDataProtocol), sizeof(uint8_t));
+}
+void ModuleSettingsGPSDataProtocolGet( uint8_t *NewGPSDataProtocol )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewGPSDataProtocol, offsetof( ModuleSettingsData, GPSDataProtocol), sizeof(uint8_t));
+}
+void ModuleSettingsGPSAutoConfigureSet( uint8_t *NewGPSAutoConfigure )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewGPSAutoConfigure, offsetof( ModuleSettingsData, GPSAutoConfigure), sizeof(uint8_t));
+}
+void ModuleSettingsGPSAutoConfigureGet( uint8_t *NewGPSAutoConfigure )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewGPSAutoConfigure, offsetof( ModuleSettingsData, GPSAutoConfigure), sizeof(uint8_t));
+}
+void ModuleSettingsGPSConstellationSet( uint8_t *NewGPSConstellation )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewGPSConstellation, offsetof( ModuleSettingsData, GPSConstellation), sizeof(uint8_t));
+}
+void ModuleSettingsGPSConstellationGet( uint8_t *NewGPSConstellation )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewGPSConstellation, offsetof( ModuleSettingsData, GPSConstellation), sizeof(uint8_t));
+}
+void ModuleSettingsGPSSBASConstellationSet( uint8_t *NewGPSSBASConstellation )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewGPSSBASConstellation, offsetof( ModuleSettingsData, GPSSBASConstellation), sizeof(uint8_t));
+}
+void ModuleSettingsGPSSBASConstellationGet( uint8_t *NewGPSSBASConstellation )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewGPSSBASConstellation, offsetof( ModuleSettingsData, GPSSBASConstellation), sizeof(uint8_t));
+}
+void ModuleSettingsGPSDynamicsModeSet( uint8_t *NewGPSDynamicsMode )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewGPSDynamicsMode, offsetof( ModuleSettingsData, GPSDynamicsMode), sizeof(uint8_t));
+}
+void ModuleSettingsGPSDynamicsModeGet( uint8_t *NewGPSDynamicsMode )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewGPSDynamicsMode, offsetof( ModuleSettingsData, GPSDynamicsMode), sizeof(uint8_t));
+}
+void ModuleSettingsComUsbBridgeSpeedSet( uint8_t *NewComUsbBridgeSpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewComUsbBridgeSpeed, offsetof( ModuleSettingsData, ComUsbBridgeSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsComUsbBridgeSpeedGet( uint8_t *NewComUsbBridgeSpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewComUsbBridgeSpeed, offsetof( ModuleSettingsData, ComUsbBridgeSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsMavlinkSpeedSet( uint8_t *NewMavlinkSpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewMavlinkSpeed, offsetof( ModuleSettingsData, MavlinkSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsMavlinkSpeedGet( uint8_t *NewMavlinkSpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewMavlinkSpeed, offsetof( ModuleSettingsData, MavlinkSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsMSPSpeedSet( uint8_t *NewMSPSpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewMSPSpeed, offsetof( ModuleSettingsData, MSPSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsMSPSpeedGet( uint8_t *NewMSPSpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewMSPSpeed, offsetof( ModuleSettingsData, MSPSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsLightTelemetrySpeedSet( uint8_t *NewLightTelemetrySpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewLightTelemetrySpeed, offsetof( ModuleSettingsData, LightTelemetrySpeed), sizeof(uint8_t));
+}
+void ModuleSettingsLightTelemetrySpeedGet( uint8_t *NewLightTelemetrySpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewLightTelemetrySpeed, offsetof( ModuleSettingsData, LightTelemetrySpeed), sizeof(uint8_t));
+}
+void ModuleSettingsFrskyAccelDataSet( uint8_t *NewFrskyAccelData )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewFrskyAccelData, offsetof( ModuleSettingsData, FrskyAccelData), sizeof(uint8_t));
+}
+void ModuleSettingsFrskyAccelDataGet( uint8_t *NewFrskyAccelData )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewFrskyAccelData, offsetof( ModuleSettingsData, FrskyAccelData), sizeof(uint8_t));
+}
+void ModuleSettingsOpenLogSpeedSet( uint8_t *NewOpenLogSpeed )
+{
+	UAVObjSetDataField(ModuleSettingsHandle(), (void*)NewOpenLogSpeed, offsetof( ModuleSettingsData, OpenLogSpeed), sizeof(uint8_t));
+}
+void ModuleSettingsOpenLogSpeedGet( uint8_t *NewOpenLogSpeed )
+{
+	UAVObjGetDataField(ModuleSettingsHandle(), (void*)NewOpenLogSpeed, offsetof( ModuleSettingsData, OpenLogSpeed), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
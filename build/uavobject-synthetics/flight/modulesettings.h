@@ -0,0 +1,291 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup ModuleSettings ModuleSettings
+ * @brief Optional module enable/disable configuration.
+ *
+ *
+ * @file       modulesettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the ModuleSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: modulesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef MODULESETTINGS_H
+#define MODULESETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+#include <hwshared.h>
+
+
+// Object constants
+#define MODULESETTINGS_OBJID 0xA35EB43E
+#define MODULESETTINGS_ISSINGLEINST 1
+#define MODULESETTINGS_ISSETTINGS 1
+#define MODULESETTINGS_ISSEQLOCKED 0
+#define MODULESETTINGS_NUMBYTES 29
+
+// Generic interface functions
+int32_t ModuleSettingsInitialize();
+UAVObjHandle ModuleSettingsHandle();
+void ModuleSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint8_t AdminState[16];
+    uint8_t TelemetrySpeed;
+    uint8_t GPSSpeed;
+    uint8_t GPSDataProtocol;
+    uint8_t GPSAutoConfigure;
+    uint8_t GPSConstellation;
+    uint8_t GPSSBASConstellation;
+    uint8_t GPSDynamicsMode;
+    uint8_t ComUsbBridgeSpeed;
+    uint8_t MavlinkSpeed;
+    uint8_t MSPSpeed;
+    uint8_t LightTelemetrySpeed;
+    uint8_t FrskyAccelData;
+    uint8_t OpenLogSpeed;
+
+} __attribute__((packed)) __attribute__((aligned(4))) ModuleSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function ModuleSettingsGet(dataOut)
+ * @brief Populate a ModuleSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t ModuleSettingsGet(ModuleSettingsData *dataOut) { return UAVObjGetData(ModuleSettingsHandle(), dataOut); }
+
+static inline int32_t ModuleSettingsSet(const ModuleSettingsData *dataIn) { return UAVObjSetData(ModuleSettingsHandle(), dataIn); }
+
+static inline int32_t ModuleSettingsInstGet(uint16_t instId, ModuleSettingsData *dataOut) { return UAVObjGetInstanceData(ModuleSettingsHandle(), instId, dataOut); }
+
+static inline int32_t ModuleSettingsInstSet(uint16_t instId, const ModuleSettingsData *dataIn) { return UAVObjSetInstanceData(ModuleSettingsHandle(), instId, dataIn); }
+
+static inline int32_t ModuleSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(ModuleSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ModuleSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(ModuleSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ModuleSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(ModuleSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ModuleSettingsConnectCopy(volatile ModuleSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	ModuleSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(ModuleSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t ModuleSettingsCreateInstance() { return UAVObjCreateInstance(ModuleSettingsHandle(), &ModuleSettingsSetDefaults); }
+
+static inline void ModuleSettingsUpdated() { UAVObjUpdated(ModuleSettingsHandle()); }
+
+static inline void ModuleSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(ModuleSettingsHandle(), instId); }
+
+static inline int32_t ModuleSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(ModuleSettingsHandle(), dataOut); }
+
+static inline int32_t ModuleSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(ModuleSettingsHandle(), dataIn); }
+
+static inline int8_t ModuleSettingsReadOnly() { return UAVObjReadOnly(ModuleSettingsHandle()); }
+
+static inline uint16_t ModuleSettingsGetNumInstances(){ return UAVObjGetNumInstances(ModuleSettingsHandle()); }
+
+static inline uint32_t ModuleSettingsGetNumBytes(){ return UAVObjGetNumBytes(ModuleSettingsHandle()); }
+
+// Field information
+// Field AdminState information
+/* Enumeration options for field AdminState */
+typedef enum { MODULESETTINGS_ADMINSTATE_DISABLED=0, MODULESETTINGS_ADMINSTATE_ENABLED=1 }  __attribute__((packed)) ModuleSettingsAdminStateOptions;
+/* Max value of any option in topmost parent AdminState of field AdminState */
+#define MODULESETTINGS_ADMINSTATE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AdminState */
+#define MODULESETTINGS_ADMINSTATE_MAXOPTVAL 1
+/* Ensure field AdminState contains valid data */
+static inline bool ModuleSettingsAdminStateIsValid( uint8_t CurrentAdminState ) { return CurrentAdminState < MODULESETTINGS_ADMINSTATE_MAXOPTVAL; }
+/* Array element names for field AdminState */
+typedef enum { MODULESETTINGS_ADMINSTATE_AIRSPEED=0, MODULESETTINGS_ADMINSTATE_ALTITUDEHOLD=1, MODULESETTINGS_ADMINSTATE_AUTOTUNE=2, MODULESETTINGS_ADMINSTATE_BATTERY=3, MODULESETTINGS_ADMINSTATE_CAMERASTAB=4, MODULESETTINGS_ADMINSTATE_FIXEDWINGPATHFOLLOWER=5, MODULESETTINGS_ADMINSTATE_FAULT=6, MODULESETTINGS_ADMINSTATE_PATHPLANNER=7, MODULESETTINGS_ADMINSTATE_TXPID=8, MODULESETTINGS_ADMINSTATE_VTOLPATHFOLLOWER=9, MODULESETTINGS_ADMINSTATE_GROUNDPATHFOLLOWER=10, MODULESETTINGS_ADMINSTATE_VIBRATIONANALYSIS=11, MODULESETTINGS_ADMINSTATE_PICOC=12, MODULESETTINGS_ADMINSTATE_GEOFENCE=13, MODULESETTINGS_ADMINSTATE_LOGGING=14, MODULESETTINGS_ADMINSTATE_FLIGHTSTATS=15 } __attribute__((packed)) ModuleSettingsAdminStateElem;
+/* Number of elements for field AdminState */
+#define MODULESETTINGS_ADMINSTATE_NUMELEM 16
+// Field TelemetrySpeed information
+/* Enumeration options for field TelemetrySpeed */
+typedef enum { MODULESETTINGS_TELEMETRYSPEED_9600=HWSHARED_SPEEDBPS_9600, MODULESETTINGS_TELEMETRYSPEED_19200=HWSHARED_SPEEDBPS_19200, MODULESETTINGS_TELEMETRYSPEED_38400=HWSHARED_SPEEDBPS_38400, MODULESETTINGS_TELEMETRYSPEED_57600=HWSHARED_SPEEDBPS_57600, MODULESETTINGS_TELEMETRYSPEED_115200=HWSHARED_SPEEDBPS_115200, MODULESETTINGS_TELEMETRYSPEED_230400=HWSHARED_SPEEDBPS_230400, MODULESETTINGS_TELEMETRYSPEED_INITHC05=HWSHARED_SPEEDBPS_INITHC05, MODULESETTINGS_TELEMETRYSPEED_INITHC06=HWSHARED_SPEEDBPS_INITHC06, MODULESETTINGS_TELEMETRYSPEED_INITHM10=HWSHARED_SPEEDBPS_INITHM10, MODULESETTINGS_TELEMETRYSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsTelemetrySpeedOptions;
+/* Max value of any option in topmost parent SpeedBps of field TelemetrySpeed */
+#define MODULESETTINGS_TELEMETRYSPEED_GLOBAL_MAXOPTVAL 11
+/* Max value of any option in field TelemetrySpeed */
+#define MODULESETTINGS_TELEMETRYSPEED_MAXOPTVAL 11
+/* Ensure field TelemetrySpeed contains valid data */
+static inline bool ModuleSettingsTelemetrySpeedIsValid( uint8_t CurrentTelemetrySpeed ) { return CurrentTelemetrySpeed < MODULESETTINGS_TELEMETRYSPEED_MAXOPTVAL; }
+// Field GPSSpeed information
+/* Enumeration options for field GPSSpeed */
+typedef enum { MODULESETTINGS_GPSSPEED_2400=HWSHARED_SPEEDBPS_2400, MODULESETTINGS_GPSSPEED_4800=HWSHARED_SPEEDBPS_4800, MODULESETTINGS_GPSSPEED_9600=HWSHARED_SPEEDBPS_9600, MODULESETTINGS_GPSSPEED_19200=HWSHARED_SPEEDBPS_19200, MODULESETTINGS_GPSSPEED_38400=HWSHARED_SPEEDBPS_38400, MODULESETTINGS_GPSSPEED_57600=HWSHARED_SPEEDBPS_57600, MODULESETTINGS_GPSSPEED_115200=HWSHARED_SPEEDBPS_115200, MODULESETTINGS_GPSSPEED_230400=HWSHARED_SPEEDBPS_230400, MODULESETTINGS_GPSSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsGPSSpeedOptions;
+/* Max value of any option in topmost parent SpeedBps of field GPSSpeed */
+#define MODULESETTINGS_GPSSPEED_GLOBAL_MAXOPTVAL 11
+/* Max value of any option in field GPSSpeed */
+#define MODULESETTINGS_GPSSPEED_MAXOPTVAL 8
+/* Ensure field GPSSpeed contains valid data */
+static inline bool ModuleSettingsGPSSpeedIsValid( uint8_t CurrentGPSSpeed ) { return CurrentGPSSpeed < MODULESETTINGS_GPSSPEED_MAXOPTVAL; }
+// Field GPSDataProtocol information
+/* Enumeration options for field GPSDataProtocol */
+typedef enum { MODULESETTINGS_GPSDATAPROTOCOL_NMEA=0, MODULESETTINGS_GPSDATAPROTOCOL_UBX=1 }  __attribute__((packed)) ModuleSettingsGPSDataProtocolOptions;
+/* Max value of any option in topmost parent GPSDataProtocol of field GPSDataProtocol */
+#define MODULESETTINGS_GPSDATAPROTOCOL_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GPSDataProtocol */
+#define MODULESETTINGS_GPSDATAPROTOCOL_MAXOPTVAL 1
+/* Ensure field GPSDataProtocol contains valid data */
+static inline bool ModuleSettingsGPSDataProtocolIsValid( uint8_t CurrentGPSDataProtocol ) { return CurrentGPSDataProtocol < MODULESETTINGS_GPSDATAPROTOCOL_MAXOPTVAL; }
+// Field GPSAutoConfigure information
+/* Enumeration options for field GPSAutoConfigure */
+typedef enum { MODULESETTINGS_GPSAUTOCONFIGURE_FALSE=0, MODULESETTINGS_GPSAUTOCONFIGURE_TRUE=1 }  __attribute__((packed)) ModuleSettingsGPSAutoConfigureOptions;
+/* Max value of any option in topmost parent GPSAutoConfigure of field GPSAutoConfigure */
+#define MODULESETTINGS_GPSAUTOCONFIGURE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GPSAutoConfigure */
+#define MODULESETTINGS_GPSAUTOCONFIGURE_MAXOPTVAL 1
+/* Ensure field GPSAutoConfigure contains valid data */
+static inline bool ModuleSettingsGPSAutoConfigureIsValid( uint8_t CurrentGPSAutoConfigure ) { return CurrentGPSAutoConfigure < MODULESETTINGS_GPSAUTOCONFIGURE_MAXOPTVAL; }
+// Field GPSConstellation information
+/* Enumeration options for field GPSConstellation */
+typedef enum { MODULESETTINGS_GPSCONSTELLATION_ALL=0, MODULESETTINGS_GPSCONSTELLATION_GPS=1, MODULESETTINGS_GPSCONSTELLATION_GLONASS=2 }  __attribute__((packed)) ModuleSettingsGPSConstellationOptions;
+/* Max value of any option in topmost parent GPSConstellation of field GPSConstellation */
+#define MODULESETTINGS_GPSCONSTELLATION_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GPSConstellation */
+#define MODULESETTINGS_GPSCONSTELLATION_MAXOPTVAL 2
+/* Ensure field GPSConstellation contains valid data */
+static inline bool ModuleSettingsGPSConstellationIsValid( uint8_t CurrentGPSConstellation ) { return CurrentGPSConstellation < MODULESETTINGS_GPSCONSTELLATION_MAXOPTVAL; }
+// Field GPSSBASConstellation information
+/* Enumeration options for field GPSSBASConstellation */
+typedef enum { MODULESETTINGS_GPSSBASCONSTELLATION_ALL=0, MODULESETTINGS_GPSSBASCONSTELLATION_WAAS=1, MODULESETTINGS_GPSSBASCONSTELLATION_EGNOS=2, MODULESETTINGS_GPSSBASCONSTELLATION_MSAS=3, MODULESETTINGS_GPSSBASCONSTELLATION_GAGAN=4, MODULESETTINGS_GPSSBASCONSTELLATION_NONE=5 }  __attribute__((packed)) ModuleSettingsGPSSBASConstellationOptions;
+/* Max value of any option in topmost parent GPSSBASConstellation of field GPSSBASConstellation */
+#define MODULESETTINGS_GPSSBASCONSTELLATION_GLOBAL_MAXOPTVAL 5
+/* Max value of any option in field GPSSBASConstellation */
+#define MODULESETTINGS_GPSSBASCONSTELLATION_MAXOPTVAL 5
+/* Ensure field GPSSBASConstellation contains valid data */
+static inline bool ModuleSettingsGPSSBASConstellationIsValid( uint8_t CurrentGPSSBASConstellation ) { return CurrentGPSSBASConstellation < MODULESETTINGS_GPSSBASCONSTELLATION_MAXOPTVAL; }
+// Field GPSDynamicsMode information
+/* Enumeration options for field GPSDynamicsMode */
+typedef enum { MODULESETTINGS_GPSDYNAMICSMODE_PORTABLE=0, MODULESETTINGS_GPSDYNAMICSMODE_PEDESTRIAN=1, MODULESETTINGS_GPSDYNAMICSMODE_AUTOMOTIVE=2, MODULESETTINGS_GPSDYNAMICSMODE_AIRBORNE1G=3, MODULESETTINGS_GPSDYNAMICSMODE_AIRBORNE2G=4, MODULESETTINGS_GPSDYNAMICSMODE_AIRBORNE4G=5 }  __attribute__((packed)) ModuleSettingsGPSDynamicsModeOptions;
+/* Max value of any option in topmost parent GPSDynamicsMode of field GPSDynamicsMode */
+#define MODULESETTINGS_GPSDYNAMICSMODE_GLOBAL_MAXOPTVAL 5
+/* Max value of any option in field GPSDynamicsMode */
+#define MODULESETTINGS_GPSDYNAMICSMODE_MAXOPTVAL 5
+/* Ensure field GPSDynamicsMode contains valid data */
+static inline bool ModuleSettingsGPSDynamicsModeIsValid( uint8_t CurrentGPSDynamicsMode ) { return CurrentGPSDynamicsMode < MODULESETTINGS_GPSDYNAMICSMODE_MAXOPTVAL; }
+// Field ComUsbBridgeSpeed information
+/* Enumeration options for field ComUsbBridgeSpeed */
+typedef enum { MODULESETTINGS_COMUSBBRIDGESPEED_1200=HWSHARED_SPEEDBPS_1200, MODULESETTINGS_COMUSBBRIDGESPEED_2400=HWSHARED_SPEEDBPS_2400, MODULESETTINGS_COMUSBBRIDGESPEED_4800=HWSHARED_SPEEDBPS_4800, MODULESETTINGS_COMUSBBRIDGESPEED_9600=HWSHARED_SPEEDBPS_9600, MODULESETTINGS_COMUSBBRIDGESPEED_19200=HWSHARED_SPEEDBPS_19200, MODULESETTINGS_COMUSBBRIDGESPEED_38400=HWSHARED_SPEEDBPS_38400, MODULESETTINGS_COMUSBBRIDGESPEED_57600=HWSHARED_SPEEDBPS_57600, MODULESETTINGS_COMUSBBRIDGESPEED_115200=HWSHARED_SPEEDBPS_115200, MODULESETTINGS_COMUSBBRIDGESPEED_230400=HWSHARED_SPEEDBPS_230400, MODULESETTINGS_COMUSBBRIDGESPEED_INITHC05=HWSHARED_SPEEDBPS_INITHC05, MODULESETTINGS_COMUSBBRIDGESPEED_INITHC06=HWSHARED_SPEEDBPS_INITHC06, MODULESETTINGS_COMUSBBRIDGESPEED_INITHM10=HWSHARED_SPEEDBPS_INITHM10, MODULESETTINGS_COMUSBBRIDGESPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsComUsbBridgeSpeedOptions;
+/* Max value of any option in topmost parent SpeedBps of field ComUsbBridgeSpeed */
+#define MODULESETTINGS_COMUSBBRIDGESPEED_GLOBAL_MAXOPTVAL 11
+/* Max value of any option in field ComUsbBridgeSpeed */
+#define MODULESETTINGS_COMUSBBRIDGESPEED_MAXOPTVAL 11
+/* Ensure field ComUsbBridgeSpeed contains valid data */
+static inline bool ModuleSettingsComUsbBridgeSpeedIsValid( uint8_t CurrentComUsbBridgeSpeed ) { return CurrentComUsbBridgeSpeed < MODULESETTINGS_COMUSBBRIDGESPEED_MAXOPTVAL; }
+// Field MavlinkSpeed information
+/* Enumeration options for field MavlinkSpeed */
+typedef enum { MODULESETTINGS_MAVLINKSPEED_2400=HWSHARED_SPEEDBPS_2400, MODULESETTINGS_MAVLINKSPEED_4800=HWSHARED_SPEEDBPS_4800, MODULESETTINGS_MAVLINKSPEED_9600=HWSHARED_SPEEDBPS_9600, MODULESETTINGS_MAVLINKSPEED_19200=HWSHARED_SPEEDBPS_19200, MODULESETTINGS_MAVLINKSPEED_38400=HWSHARED_SPEEDBPS_38400, MODULESETTINGS_MAVLINKSPEED_57600=HWSHARED_SPEEDBPS_57600, MODULESETTINGS_MAVLINKSPEED_115200=HWSHARED_SPEEDBPS_115200, MODULESETTINGS_MAVLINKSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsMavlinkSpeedOptions;
+/* Max value of any option in topmost parent SpeedBps of field MavlinkSpeed */
+#define MODULESETTINGS_MAVLINKSPEED_GLOBAL_MAXOPTVAL 11
+/* Max value of any option in field MavlinkSpeed */
+#define MODULESETTINGS_MAVLINKSPEED_MAXOPTVAL 7
+/* Ensure field MavlinkSpeed contains valid data */
+static inline bool ModuleSettingsMavlinkSpeedIsValid( uint8_t CurrentMavlinkSpeed ) { return CurrentMavlinkSpeed < MODULESETTINGS_MAVLINKSPEED_MAXOPTVAL; }
+// Field MSPSpeed information
+/* Enumeration options for field MSPSpeed */
+typedef enum { MODULESETTINGS_MSPSPEED_2400=HWSHARED_SPEEDBPS_2400, MODULESETTINGS_MSPSPEED_4800=HWSHARED_SPEEDBPS_4800, MODULESETTINGS_MSPSPEED_9600=HWSHARED_SPEEDBPS_9600, MODULESETTINGS_MSPSPEED_19200=HWSHARED_SPEEDBPS_19200, MODULESETTINGS_MSPSPEED_38400=HWSHARED_SPEEDBPS_38400, MODULESETTINGS_MSPSPEED_57600=HWSHARED_SPEEDBPS_57600, MODULESETTINGS_MSPSPEED_115200=HWSHARED_SPEEDBPS_115200, MODULESETTINGS_MSPSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsMSPSpeedOptions;
+/* Max value of any option in topmost parent SpeedBps of field MSPSpeed */
+#define MODULESETTINGS_MSPSPEED_GLOBAL_MAXOPTVAL 11
+/* Max value of any option in field MSPSpeed */
+#define MODULESETTINGS_MSPSPEED_MAXOPTVAL 7
+/* Ensure field MSPSpeed contains valid data */
+static inline bool ModuleSettingsMSPSpeedIsValid( uint8_t CurrentMSPSpeed ) { return CurrentMSPSpeed < MODULESETTINGS_MSPSPEED_MAXOPTVAL; }
+// Field LightTelemetrySpeed information
+/* Enumeration options for field LightTelemetrySpeed */
+typedef enum { MODULESETTINGS_LIGHTTELEMETRYSPEED_1200=HWSHARED_SPEEDBPS_1200, MODULESETTINGS_LIGHTTELEMETRYSPEED_2400=HWSHARED_SPEEDBPS_2400, MODULESETTINGS_LIGHTTELEMETRYSPEED_4800=HWSHARED_SPEEDBPS_4800, MODULESETTINGS_LIGHTTELEMETRYSPEED_9600=HWSHARED_SPEEDBPS_9600, MODULESETTINGS_LIGHTTELEMETRYSPEED_19200=HWSHARED_SPEEDBPS_19200, MODULESETTINGS_LIGHTTELEMETRYSPEED_38400=HWSHARED_SPEEDBPS_38400, MODULESETTINGS_LIGHTTELEMETRYSPEED_57600=HWSHARED_SPEEDBPS_57600, MODULESETTINGS_LIGHTTELEMETRYSPEED_115200=HWSHARED_SPEEDBPS_115200, MODULESETTINGS_LIGHTTELEMETRYSPEED_DONTSWITCHONCHILDENUMS=255 }  __attribute__((packed)) ModuleSettingsLightTelemetrySpeedOptions;
+/* Max value of any option in topmost parent SpeedBps of field LightTelemetrySpeed */
+#define MODULESETTINGS_LIGHTTELEMETRYSPEED_GLOBAL_MAXOPTVAL 11
+/* Max value of any option in field LightTelemetrySpeed */
+#define MODULESETTINGS_LIGHTTELEMETRYSPEED_MAXOPTVAL 7
+/* Ensure field LightTelemetrySpeed contains valid data */
+static inline bool ModuleSettingsLightTelemetrySpeedIsValid( uint8_t CurrentLightTelemetrySpeed ) { return CurrentLightTelemetrySpeed < MODULESETTINGS_LIGHTTELEMETRYSPEED_MAXOPTVAL; }
+// Field FrskyAccelData information
+/* Enumeration options for field FrskyAccelData */
+typedef enum { MODULESETTINGS_FRSKYACCELDATA_ACCELS=0, MODULESETTINGS_FRSKYACCELDATA_NEDACCELS=1, MODULESETTINGS_FRSKYACCELDATA_NEDVELOCITY=2, MODULESETTINGS_FRSKYACCELDATA_ATTITUDEANGLES=3 }  __attribute__((packed)) ModuleSettingsFrskyAccelDataOptions;
+/* Max value of any option in topmost parent FrskyAccelData of field FrskyAccelData */
+#define MODULESETTINGS_FRSKYACCELDATA_GLOBAL_MAXOPTVAL 3
+/* Max value of any option in field FrskyAccelData */
+#define MODULESETTINGS_FRSKYACCELDATA_MAXOPTVAL 3
+/* Ensure field FrskyAccelData contains valid data */
+static inline bool ModuleSettingsFrskyAccelDataIsValid( uint8_t CurrentFrskyAccelData ) { return CurrentFrskyAccelData < MODULESETTINGS_FRSKYACCELDATA_MAXOPTVAL; }
+// Field OpenLogSpeed information
+/* Enumeration options for field OpenLogSpeed */
+typedef enum { MODULESETTINGS_OPENLOGSPEED_115200=0, MODULESETTINGS_OPENLOGSPEED_250000=1, MODULESETTINGS_OPENLOGSPEED_1500000=2, MODULESETTINGS_OPENLOGSPEED_2000000=3, MODULESETTINGS_OPENLOGSPEED_2470000=4 }  __attribute__((packed)) ModuleSettingsOpenLogSpeedOptions;
+/* Max value of any option in topmost parent OpenLogSpeed of field OpenLogSpeed */
+#define MODULESETTINGS_OPENLOGSPEED_GLOBAL_MAXOPTVAL 4
+/* Max value of any option in field OpenLogSpeed */
+#define MODULESETTINGS_OPENLOGSPEED_MAXOPTVAL 4
+/* Ensure field OpenLogSpeed contains valid data */
+static inline bool ModuleSettingsOpenLogSpeedIsValid( uint8_t CurrentOpenLogSpeed ) { return CurrentOpenLogSpeed < MODULESETTINGS_OPENLOGSPEED_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void ModuleSettingsAdminStateSet( uint8_t *NewAdminState );
+extern void ModuleSettingsAdminStateGet( uint8_t *NewAdminState );
+extern void ModuleSettingsTelemetrySpeedSet( uint8_t *NewTelemetrySpeed );
+extern void ModuleSettingsTelemetrySpeedGet( uint8_t *NewTelemetrySpeed );
+extern void ModuleSettingsGPSSpeedSet( uint8_t *NewGPSSpeed );
+extern void ModuleSettingsGPSSpeedGet( uint8_t *NewGPSSpeed );
+extern void ModuleSettingsGPSDataProtocolSet( uint8_t *NewGPSDataProtocol );
+extern void ModuleSettingsGPSDataProtocolGet( uint8_t *NewGPSDataProtocol );
+extern void ModuleSettingsGPSAutoConfigureSet( uint8_t *NewGPSAutoConfigure );
+extern void ModuleSettingsGPSAutoConfigureGet( uint8_t *NewGPSAutoConfigure );
+extern void ModuleSettingsGPSConstellationSet( uint8_t *NewGPSConstellation );
+extern void ModuleSettingsGPSConstellationGet( uint8_t *NewGPSConstellation );
+extern void ModuleSettingsGPSSBASConstellationSet( uint8_t *NewGPSSBASConstellation );
+extern void ModuleSettingsGPSSBASConstellationGet( uint8_t *NewGPSSBASConstellation );
+extern void ModuleSettingsGPSDynamicsModeSet( uint8_t *NewGPSDynamicsMode );
+extern void ModuleSettingsGPSDynamicsModeGet( uint8_t *NewGPSDynamicsMode );
+extern void ModuleSettingsComUsbBridgeSpeedSet( uint8_t *NewComUsbBridgeSpeed );
+extern void ModuleSettingsComUsbBridgeSpeedGet( uint8_t *NewComUsbBridgeSpeed );
+extern void ModuleSettingsMavlinkSpeedSet( uint8_t *NewMavlinkSpeed );
+extern void ModuleSettingsMavlinkSpeedGet( uint8_t *NewMavlinkSpeed );
+extern void ModuleSettingsMSPSpeedSet( uint8_t *NewMSPSpeed );
+extern void ModuleSettingsMSPSpeedGet( uint8_t *NewMSPSpeed );
+extern void ModuleSettingsLightTelemetrySpeedSet( uint8_t *NewLightTelemetrySpeed );
+extern void ModuleSettingsLightTelemetrySpeedGet( uint8_t *NewLightTelemetrySpeed );
+extern void ModuleSettingsFrskyAccelDataSet( uint8_t *NewFrskyAccelData );
+extern void ModuleSettingsFrskyAccelDataGet( uint8_t *NewFrskyAccelData );
+extern void ModuleSettingsOpenLogSpeedSet( uint8_t *NewOpenLogSpeed );
+extern void ModuleSettingsOpenLogSpeedGet( uint8_t *NewOpenLogSpeed );
+
+
+#endif // MODULESETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,179 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       objectmanagerstats.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the ObjectManagerStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: objectmanagerstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "objectmanagerstats.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t ObjectManagerStatsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(OBJECTMANAGERSTATS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(OBJECTMANAGERSTATS_OBJID,
+			OBJECTMANAGERSTATS_ISSINGLEINST, OBJECTMANAGERSTATS_ISSETTINGS, OBJECTMANAGERSTATS_ISSEQLOCKED,
+			OBJECTMANAGERSTATS_NUMBYTES, &ObjectManagerStatsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void ObjectManagerStatsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	ObjectManagerStatsData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void ObjectManagerStatsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 1000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 1000;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void ObjectManagerStatsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	ObjectManagerStatsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		ObjectManagerStatsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle ObjectManagerStatsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void ObjectManagerStatsLockAcquisitionsSet( uint32_t *NewLockAcquisitions )
+{
+	UAVObjSetDataField(ObjectManagerStatsHandle(), (void*)NewLockAcquisitions, offsetof( ObjectManagerStatsData, LockAcquisitions), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockAcquisitionsGet( uint32_t *NewLockAcquisitions )
+{
+	UAVObjGetDataField(ObjectManagerStatsHandle(), (void*)NewLockAcquisitions, offsetof( ObjectManagerStatsData, LockAcquisitions), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockContendedSet( uint32_t *NewLockContended )
+{
+	UAVObjSetDataField(ObjectManagerStatsHandle(), (void*)NewLockContended, offsetof( ObjectManagerStatsData, LockContended), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockContendedGet( uint32_t *NewLockContended )
+{
+	UAVObjGetDataField(ObjectManagerStatsHandle(), (void*)NewLockContended, offsetof( ObjectManagerStatsData, LockContended), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockWaitTotalSet( uint32_t *NewLockWaitTotal )
+{
+	UAVObjSetDataField(ObjectManagerStatsHandle(), (void*)NewLockWaitTotal, offsetof( ObjectManagerStatsData, LockWaitTotal), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockWaitTotalGet( uint32_t *NewLockWaitTotal )
+{
+	UAVObjGetDataField(ObjectManagerStatsHandle(), (void*)NewLockWaitTotal, offsetof( ObjectManagerStatsData, LockWaitTotal), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockWaitMaxSet( uint32_t *NewLockWaitMax )
+{
+	UAVObjSetDataField(ObjectManagerStatsHandle(), (void*)NewLockWaitMax, offsetof( ObjectManagerStatsData, LockWaitMax), sizeof(uint32_t));
+}
+void ObjectManagerStatsLockWaitMaxGet( uint32_t *NewLockWaitMax )
+{
+	UAVObjGetDataField(ObjectManagerStatsHandle(), (void*)NewLockWaitMax, offsetof( ObjectManagerStatsData, LockWaitMax), sizeof(uint32_t));
+}
+void ObjectManagerStatsSeqLockReadsSet( uint32_t *NewSeqLockReads )
+{
+	UAVObjSetDataField(ObjectManagerStatsHandle(), (void*)NewSeqLockReads, offsetof( ObjectManagerStatsData, SeqLockReads), sizeof(uint32_t));
+}
+void ObjectManagerStatsSeqLockReadsGet( uint32_t *NewSeqLockReads )
+{
+	UAVObjGetDataField(ObjectManagerStatsHandle(), (void*)NewSeqLockReads, offsetof( ObjectManagerStatsData, SeqLockReads), sizeof(uint32_t));
+}
+void ObjectManagerStatsSeqLockRetriesSet( uint32_t *NewSeqLockRetries )
+{
+	UAVObjSetDataField(ObjectManagerStatsHandle(), (void*)NewSeqLockRetries, offsetof( ObjectManagerStatsData, SeqLockRetries), sizeof(uint32_t));
+}
+void ObjectManagerStatsSeqLockRetriesGet( uint32_t *NewSeqLockRetries )
+{
+	UAVObjGetDataField(ObjectManagerStatsHandle(), (void*)NewSeqLockRetries, offsetof( ObjectManagerStatsData, SeqLockRetries), sizeof(uint32_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,142 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup ObjectManagerStats ObjectManagerStats
+ * @brief Object manager lock contention, counted over the last system update period.
+ *
+ *
+ * @file       objectmanagerstats.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the ObjectManagerStats object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: objectmanagerstats.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OBJECTMANAGERSTATS_H
+#define OBJECTMANAGERSTATS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define OBJECTMANAGERSTATS_OBJID 0xD309D55C
+#define OBJECTMANAGERSTATS_ISSINGLEINST 1
+#define OBJECTMANAGERSTATS_ISSETTINGS 0
+#define OBJECTMANAGERSTATS_ISSEQLOCKED 0
+#define OBJECTMANAGERSTATS_NUMBYTES 24
+
+// Generic interface functions
+int32_t ObjectManagerStatsInitialize();
+UAVObjHandle ObjectManagerStatsHandle();
+void ObjectManagerStatsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t LockAcquisitions;
+    uint32_t LockContended;
+    uint32_t LockWaitTotal;
+    uint32_t LockWaitMax;
+    uint32_t SeqLockReads;
+    uint32_t SeqLockRetries;
+
+} __attribute__((packed)) __attribute__((aligned(4))) ObjectManagerStatsData;
+
+// Typesafe Object access functions
+/**
+ * @function ObjectManagerStatsGet(dataOut)
+ * @brief Populate a ObjectManagerStatsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t ObjectManagerStatsGet(ObjectManagerStatsData *dataOut) { return UAVObjGetData(ObjectManagerStatsHandle(), dataOut); }
+
+static inline int32_t ObjectManagerStatsSet(const ObjectManagerStatsData *dataIn) { return UAVObjSetData(ObjectManagerStatsHandle(), dataIn); }
+
+static inline int32_t ObjectManagerStatsInstGet(uint16_t instId, ObjectManagerStatsData *dataOut) { return UAVObjGetInstanceData(ObjectManagerStatsHandle(), instId, dataOut); }
+
+static inline int32_t ObjectManagerStatsInstSet(uint16_t instId, const ObjectManagerStatsData *dataIn) { return UAVObjSetInstanceData(ObjectManagerStatsHandle(), instId, dataIn); }
+
+static inline int32_t ObjectManagerStatsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(ObjectManagerStatsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ObjectManagerStatsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(ObjectManagerStatsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ObjectManagerStatsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(ObjectManagerStatsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ObjectManagerStatsConnectCopy(volatile ObjectManagerStatsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	ObjectManagerStatsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(ObjectManagerStatsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t ObjectManagerStatsCreateInstance() { return UAVObjCreateInstance(ObjectManagerStatsHandle(), &ObjectManagerStatsSetDefaults); }
+
+static inline void ObjectManagerStatsUpdated() { UAVObjUpdated(ObjectManagerStatsHandle()); }
+
+static inline void ObjectManagerStatsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(ObjectManagerStatsHandle(), instId); }
+
+static inline int32_t ObjectManagerStatsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(ObjectManagerStatsHandle(), dataOut); }
+
+static inline int32_t ObjectManagerStatsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(ObjectManagerStatsHandle(), dataIn); }
+
+static inline int8_t ObjectManagerStatsReadOnly() { return UAVObjReadOnly(ObjectManagerStatsHandle()); }
+
+static inline uint16_t ObjectManagerStatsGetNumInstances(){ return UAVObjGetNumInstances(ObjectManagerStatsHandle()); }
+
+static inline uint32_t ObjectManagerStatsGetNumBytes(){ return UAVObjGetNumBytes(ObjectManagerStatsHandle()); }
+
+// Field information
+// Field LockAcquisitions information
+// Field LockContended information
+// Field LockWaitTotal information
+// Field LockWaitMax information
+// Field SeqLockReads information
+// Field SeqLockRetries information
+
+
+// set/Get functions
+extern void ObjectManagerStatsLockAcquisitionsSet( uint32_t *NewLockAcquisitions );
+extern void ObjectManagerStatsLockAcquisitionsGet( uint32_t *NewLockAcquisitions );
+extern void ObjectManagerStatsLockContendedSet( uint32_t *NewLockContended );
+extern void ObjectManagerStatsLockContendedGet( uint32_t *NewLockContended );
+extern void ObjectManagerStatsLockWaitTotalSet( uint32_t *NewLockWaitTotal );
+extern void ObjectManagerStatsLockWaitTotalGet( uint32_t *NewLockWaitTotal );
+extern void ObjectManagerStatsLockWaitMaxSet( uint32_t *NewLockWaitMax );
+extern void ObjectManagerStatsLockWaitMaxGet( uint32_t *NewLockWaitMax );
+extern void ObjectManagerStatsSeqLockReadsSet( uint32_t *NewSeqLockReads );
+extern void ObjectManagerStatsSeqLockReadsGet( uint32_t *NewSeqLockReads );
+extern void ObjectManagerStatsSeqLockRetriesSet( uint32_t *NewSeqLockRetries );
+extern void ObjectManagerStatsSeqLockRetriesGet( uint32_t *NewSeqLockRetries );
+
+
+#endif // OBJECTMANAGERSTATS_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup ObjectPersistence ObjectPersistence
+ * @brief Someone who knows please enter this
+ *
+ *
+ * @file       objectpersistence.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the ObjectPersistence object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: objectpersistence.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef OBJECTPERSISTENCE_H
+#define OBJECTPERSISTENCE_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define OBJECTPERSISTENCE_OBJID 0x6A02CAAA
+#define OBJECTPERSISTENCE_ISSINGLEINST 1
+#define OBJECTPERSISTENCE_ISSETTINGS 0
+#define OBJECTPERSISTENCE_ISSEQLOCKED 0
+#define OBJECTPERSISTENCE_NUMBYTES 9
+
+// Generic interface functions
+int32_t ObjectPersistenceInitialize();
+UAVObjHandle ObjectPersistenceHandle();
+void ObjectPersistenceSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t ObjectID;
+    uint32_t InstanceID;
+    uint8_t Operation;
+
+} __attribute__((packed)) __attribute__((aligned(4))) ObjectPersistenceData;
+
+// Typesafe Object access functions
+/**
+ * @function ObjectPersistenceGet(dataOut)
+ * @brief Populate a ObjectPersistenceData object
+ * @param[out] dataOut 
+ */
+static inline int32_t ObjectPersistenceGet(ObjectPersistenceData *dataOut) { return UAVObjGetData(ObjectPersistenceHandle(), dataOut); }
+
+static inline int32_t ObjectPersistenceSet(const ObjectPersistenceData *dataIn) { return UAVObjSetData(ObjectPersistenceHandle(), dataIn); }
+
+static inline int32_t ObjectPersistenceInstGet(uint16_t instId, ObjectPersistenceData *dataOut) { return UAVObjGetInstanceData(ObjectPersistenceHandle(), instId, dataOut); }
+
+static inline int32_t ObjectPersistenceInstSet(uint16_t instId, const ObjectPersistenceData *dataIn) { return UAVObjSetInstanceData(ObjectPersistenceHandle(), instId, dataIn); }
+
+static inline int32_t ObjectPersistenceConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(ObjectPersistenceHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ObjectPersistenceConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(ObjectPersistenceHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ObjectPersistenceConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(ObjectPersistenceHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t ObjectPersistenceConnectCopy(volatile ObjectPersistenceData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	ObjectPersistenceGet((void *) dataOut);
+
+	return UAVObjConnectCallback(ObjectPersistenceHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t ObjectPersistenceCreateInstance() { return UAVObjCreateInstance(ObjectPersistenceHandle(), &ObjectPersistenceSetDefaults); }
+
+static inline void ObjectPersistenceUpdated() { UAVObjUpdated(ObjectPersistenceHandle()); }
+
+static inline void ObjectPersistenceInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(ObjectPersistenceHandle(), instId); }
+
+static inline int32_t ObjectPersistenceGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(ObjectPersistenceHandle(), dataOut); }
+
+static inline int32_t ObjectPersistenceSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(ObjectPersistenceHandle(), dataIn); }
+
+static inline int8_t ObjectPersistenceReadOnly() { return UAVObjReadOnly(ObjectPersistenceHandle()); }
+
+static inline uint16_t ObjectPersistenceGetNumInstances(){ return UAVObjGetNumInstances(ObjectPersistenceHandle()); }
+
+static inline uint32_t ObjectPersistenceGetNumBytes(){ return UAVObjGetNumBytes(ObjectPersistenceHandle()); }
+
+// Field information
+// Field ObjectID information
+// Field InstanceID information
+// Field Operation information
+/* Enumeration options for field Operation */
+typedef enum { OBJECTPERSISTENCE_OPERATION_NOP=0, OBJECTPERSISTENCE_OPERATION_LOAD=1, OBJECTPERSISTENCE_OPERATION_SAVE=2, OBJECTPERSISTENCE_OPERATION_DELETE=3, OBJECTPERSISTENCE_OPERATION_FULLERASE=4, OBJECTPERSISTENCE_OPERATION_COMPLETED=5, OBJECTPERSISTENCE_OPERATION_ERROR=6 }  __attribute__((packed)) ObjectPersistenceOperationOptions;
+/* Max value of any option in topmost parent Operation of field Operation */
+#define OBJECTPERSISTENCE_OPERATION_GLOBAL_MAXOPTVAL 6
+/* Max value of any option in field Operation */
+#define OBJECTPERSISTENCE_OPERATION_MAXOPTVAL 6
+/* Ensure field Operation contains valid data */
+static inline bool ObjectPersistenceOperationIsValid( uint8_t CurrentOperation ) { return CurrentOperation < OBJECTPERSISTENCE_OPERATION_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void ObjectPersistenceObjectIDSet( uint32_t *NewObjectID );
+extern void ObjectPersistenceObjectIDGet( uint32_t *NewObjectID );
+extern void ObjectPersistenceInstanceIDSet( uint32_t *NewInstanceID );
+extern void ObjectPersistenceInstanceIDGet( uint32_t *NewInstanceID );
+extern void ObjectPersistenceOperationSet( uint8_t *NewOperation );
+extern void ObjectPersistenceOperationGet( uint8_t *NewOperation );
+
+
+#endif // OBJECTPERSISTENCE_H
+
+/**
+ * @}
+ * @}
+ */
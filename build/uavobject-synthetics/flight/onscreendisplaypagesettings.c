@@ -0,0 +1,1310 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       onscreendisplaypagesettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OnScreenDisplayPageSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "onscreendisplaypagesettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OnScreenDisplayPageSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ONSCREENDISPLAYPAGESETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ONSCREENDISPLAYPAGESETTINGS_OBJID,
+			ONSCREENDISPLAYPAGESETTINGS_ISSINGLEINST, ONSCREENDISPLAYPAGESETTINGS_ISSETTINGS, ONSCREENDISPLAYPAGESETTINGS_ISSEQLOCKED,
+			ONSCREENDISPLAYPAGESETTINGS_NUMBYTES, &OnScreenDisplayPageSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OnScreenDisplayPageSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OnScreenDisplayPageSettingsData data = {};
+
+	data.AlarmPosX = 0;
+	data.AlarmPosY = 214;
+	data.AltitudeScalePos = 350;
+	data.AltitudeNumericPosX = 280;
+	data.AltitudeNumericPosY = 200;
+	data.ArmStatusPosX = 0;
+	data.ArmStatusPosY = 24;
+	data.BatteryVoltPosX = 350;
+	data.BatteryVoltPosY = 4;
+	data.BatteryCurrentPosX = 350;
+	data.BatteryCurrentPosY = 14;
+	data.BatteryConsumedPosX = 350;
+	data.BatteryConsumedPosY = 24;
+	data.BatteryChargeStatePosX = 325;
+	data.BatteryChargeStatePosY = 38;
+	data.ClimbRatePosX = 350;
+	data.ClimbRatePosY = 200;
+	data.CompassPos = 15;
+	data.CpuPosX = 0;
+	data.CpuPosY = 204;
+	data.CustomTextPosX = 60;
+	data.CustomTextPosY = 190;
+	data.FlightModePosX = 0;
+	data.FlightModePosY = 4;
+	data.GForcePosX = 10;
+	data.GForcePosY = 40;
+	data.GpsStatusPosX = 0;
+	data.GpsStatusPosY = 230;
+	data.GpsLatPosX = 200;
+	data.GpsLatPosY = 230;
+	data.GpsLonPosX = 350;
+	data.GpsLonPosY = 230;
+	data.GpsMgrsPosX = 350;
+	data.GpsMgrsPosY = 230;
+	data.HomeDistancePosX = 180;
+	data.HomeDistancePosY = 195;
+	data.HomeArrowPosX = 240;
+	data.HomeArrowPosY = 195;
+	data.MapWidthMeters = 2000;
+	data.MapWidthPixels = 180;
+	data.MapHeightMeters = 2000;
+	data.MapHeightPixels = 140;
+	data.RssiPosX = 130;
+	data.RssiPosY = 195;
+	data.SpeedScalePos = 0;
+	data.SpeedNumericPosX = 50;
+	data.SpeedNumericPosY = 200;
+	data.TimePosX = 350;
+	data.TimePosY = 220;
+	data.ThrottlePosX = 300;
+	data.ThrottlePosY = 220;
+	data.Alarm = 1;
+	data.AlarmFont = 0;
+	data.AlarmAlign = 0;
+	data.AltitudeScale = 1;
+	data.AltitudeScaleAlign = 1;
+	data.AltitudeScaleSource = 0;
+	data.AltitudeNumeric = 0;
+	data.AltitudeNumericAlign = 0;
+	data.AltitudeNumericFont = 0;
+	data.AltitudeNumericSource = 0;
+	data.ArmStatus = 1;
+	data.ArmStatusFont = 0;
+	data.ArmStatusAlign = 0;
+	data.ArtificialHorizon = 1;
+	data.ArtificialHorizonMaxPitch = 30;
+	data.ArtificialHorizonPitchSteps = 2;
+	data.BatteryVolt = 1;
+	data.BatteryVoltFont = 0;
+	data.BatteryVoltAlign = 2;
+	data.BatteryCurrent = 1;
+	data.BatteryCurrentFont = 0;
+	data.BatteryCurrentAlign = 2;
+	data.BatteryConsumed = 1;
+	data.BatteryConsumedFont = 0;
+	data.BatteryConsumedAlign = 2;
+	data.BatteryChargeState = 1;
+	data.CenterMark = 1;
+	data.ClimbRate = 1;
+	data.ClimbRateFont = 0;
+	data.ClimbRateAlign = 2;
+	data.Compass = 1;
+	data.CompassHomeDir = 1;
+	data.Cpu = 0;
+	data.CpuFont = 0;
+	data.CpuAlign = 0;
+	data.CustomText = 0;
+	data.CustomTextFont = 0;
+	data.CustomTextAlign = 0;
+	data.FlightMode = 1;
+	data.FlightModeFont = 0;
+	data.FlightModeAlign = 0;
+	data.GForce = 1;
+	data.GForceFont = 0;
+	data.GForceAlign = 0;
+	data.GpsStatus = 1;
+	data.GpsStatusFont = 0;
+	data.GpsLat = 1;
+	data.GpsLatFont = 0;
+	data.GpsLatAlign = 0;
+	data.GpsLon = 1;
+	data.GpsLonFont = 0;
+	data.GpsLonAlign = 2;
+	data.GpsMgrs = 0;
+	data.GpsMgrsFont = 0;
+	data.GpsMgrsAlign = 2;
+	data.HomeDistance = 1;
+	data.HomeDistanceFont = 0;
+	data.HomeDistanceShowIcon = 1;
+	data.HomeArrow = 1;
+	data.Map = 0;
+	data.MapCenterMode = 0;
+	data.MapShowWp = 0;
+	data.MapShowUavHome = 1;
+	data.MapShowTablet = 0;
+	data.Rssi = 1;
+	data.RssiFont = 0;
+	data.RssiShowIcon = 1;
+	data.SpeedScale = 1;
+	data.SpeedScaleAlign = 0;
+	data.SpeedScaleSource = 0;
+	data.SpeedNumeric = 1;
+	data.SpeedNumericFont = 0;
+	data.SpeedNumericAlign = 0;
+	data.SpeedNumericSource = 0;
+	data.Time = 1;
+	data.TimeFont = 0;
+	data.TimeAlign = 2;
+	data.Throttle = 0;
+	data.ThrottleFont = 0;
+	data.ThrottleAlign = 2;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OnScreenDisplayPageSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OnScreenDisplayPageSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OnScreenDisplayPageSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OnScreenDisplayPageSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OnScreenDisplayPageSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OnScreenDisplayPageSettingsAlarmPosXSet( int16_t *NewAlarmPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettingsData, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAlarmPosXGet( int16_t *NewAlarmPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettingsData, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAlarmPosYSet( int16_t *NewAlarmPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettingsData, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAlarmPosYGet( int16_t *NewAlarmPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettingsData, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScalePosSet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettingsData, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScalePosGet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettingsData, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsArmStatusPosXSet( int16_t *NewArmStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettingsData, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsArmStatusPosXGet( int16_t *NewArmStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettingsData, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsArmStatusPosYSet( int16_t *NewArmStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettingsData, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsArmStatusPosYGet( int16_t *NewArmStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettingsData, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltPosXSet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltPosXGet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltPosYSet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltPosYGet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettingsData, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettingsData, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettingsData, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsBatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettingsData, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsClimbRatePosXSet( int16_t *NewClimbRatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettingsData, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsClimbRatePosXGet( int16_t *NewClimbRatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettingsData, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsClimbRatePosYSet( int16_t *NewClimbRatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettingsData, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsClimbRatePosYGet( int16_t *NewClimbRatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettingsData, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCompassPosSet( int16_t *NewCompassPos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettingsData, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCompassPosGet( int16_t *NewCompassPos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettingsData, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCpuPosXSet( int16_t *NewCpuPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettingsData, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCpuPosXGet( int16_t *NewCpuPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettingsData, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCpuPosYSet( int16_t *NewCpuPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettingsData, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCpuPosYGet( int16_t *NewCpuPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettingsData, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCustomTextPosXSet( int16_t *NewCustomTextPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettingsData, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCustomTextPosXGet( int16_t *NewCustomTextPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettingsData, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCustomTextPosYSet( int16_t *NewCustomTextPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettingsData, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsCustomTextPosYGet( int16_t *NewCustomTextPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettingsData, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsFlightModePosXSet( int16_t *NewFlightModePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettingsData, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsFlightModePosXGet( int16_t *NewFlightModePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettingsData, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsFlightModePosYSet( int16_t *NewFlightModePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettingsData, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsFlightModePosYGet( int16_t *NewFlightModePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettingsData, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGForcePosXSet( int16_t *NewGForcePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettingsData, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGForcePosXGet( int16_t *NewGForcePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettingsData, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGForcePosYSet( int16_t *NewGForcePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettingsData, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGForcePosYGet( int16_t *NewGForcePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettingsData, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusPosXSet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettingsData, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusPosXGet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettingsData, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusPosYSet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettingsData, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusPosYGet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettingsData, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLatPosXSet( int16_t *NewGpsLatPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettingsData, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLatPosXGet( int16_t *NewGpsLatPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettingsData, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLatPosYSet( int16_t *NewGpsLatPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettingsData, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLatPosYGet( int16_t *NewGpsLatPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettingsData, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLonPosXSet( int16_t *NewGpsLonPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettingsData, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLonPosXGet( int16_t *NewGpsLonPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettingsData, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLonPosYSet( int16_t *NewGpsLonPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettingsData, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsLonPosYGet( int16_t *NewGpsLonPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettingsData, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsPosXSet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsPosXGet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsPosYSet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsPosYGet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeDistancePosXSet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettingsData, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeDistancePosXGet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettingsData, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeDistancePosYSet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettingsData, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeDistancePosYGet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettingsData, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeArrowPosXSet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettingsData, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeArrowPosXGet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettingsData, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeArrowPosYSet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettingsData, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsHomeArrowPosYGet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettingsData, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapWidthMetersSet( int16_t *NewMapWidthMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettingsData, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapWidthMetersGet( int16_t *NewMapWidthMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettingsData, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapWidthPixelsSet( int16_t *NewMapWidthPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettingsData, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapWidthPixelsGet( int16_t *NewMapWidthPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettingsData, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapHeightMetersSet( int16_t *NewMapHeightMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettingsData, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapHeightMetersGet( int16_t *NewMapHeightMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettingsData, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapHeightPixelsSet( int16_t *NewMapHeightPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettingsData, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsMapHeightPixelsGet( int16_t *NewMapHeightPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettingsData, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsRssiPosXSet( int16_t *NewRssiPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettingsData, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsRssiPosXGet( int16_t *NewRssiPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettingsData, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsRssiPosYSet( int16_t *NewRssiPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettingsData, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsRssiPosYGet( int16_t *NewRssiPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettingsData, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsSpeedScalePosSet( int16_t *NewSpeedScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettingsData, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsSpeedScalePosGet( int16_t *NewSpeedScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettingsData, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericPosXSet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericPosXGet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericPosYSet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericPosYGet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsTimePosXSet( int16_t *NewTimePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettingsData, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsTimePosXGet( int16_t *NewTimePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettingsData, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsTimePosYSet( int16_t *NewTimePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettingsData, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsTimePosYGet( int16_t *NewTimePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettingsData, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsThrottlePosXSet( int16_t *NewThrottlePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettingsData, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsThrottlePosXGet( int16_t *NewThrottlePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettingsData, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsThrottlePosYSet( int16_t *NewThrottlePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettingsData, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsThrottlePosYGet( int16_t *NewThrottlePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettingsData, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettingsAlarmSet( uint8_t *NewAlarm )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettingsData, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAlarmGet( uint8_t *NewAlarm )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettingsData, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAlarmFontSet( uint8_t *NewAlarmFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettingsData, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAlarmFontGet( uint8_t *NewAlarmFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettingsData, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAlarmAlignSet( uint8_t *NewAlarmAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettingsData, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAlarmAlignGet( uint8_t *NewAlarmAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettingsData, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScaleSet( uint8_t *NewAltitudeScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettingsData, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScaleGet( uint8_t *NewAltitudeScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettingsData, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettingsData, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettingsData, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettingsData, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettingsData, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericSet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericGet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsAltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettingsData, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArmStatusSet( uint8_t *NewArmStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettingsData, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArmStatusGet( uint8_t *NewArmStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettingsData, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArmStatusFontSet( uint8_t *NewArmStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettingsData, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArmStatusFontGet( uint8_t *NewArmStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettingsData, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArmStatusAlignSet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettingsData, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArmStatusAlignGet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettingsData, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArtificialHorizonSet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettingsData, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArtificialHorizonGet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettingsData, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettingsData, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettingsData, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettingsData, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettingsData, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltSet( uint8_t *NewBatteryVolt )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettingsData, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltGet( uint8_t *NewBatteryVolt )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettingsData, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltFontSet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltFontGet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettingsData, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentSet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentGet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettingsData, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedSet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedGet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettingsData, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryChargeStateSet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettingsData, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsBatteryChargeStateGet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettingsData, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCenterMarkSet( uint8_t *NewCenterMark )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettingsData, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCenterMarkGet( uint8_t *NewCenterMark )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettingsData, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsClimbRateSet( uint8_t *NewClimbRate )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettingsData, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsClimbRateGet( uint8_t *NewClimbRate )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettingsData, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsClimbRateFontSet( uint8_t *NewClimbRateFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettingsData, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsClimbRateFontGet( uint8_t *NewClimbRateFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettingsData, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsClimbRateAlignSet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettingsData, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsClimbRateAlignGet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettingsData, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCompassSet( uint8_t *NewCompass )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettingsData, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCompassGet( uint8_t *NewCompass )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettingsData, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCompassHomeDirSet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettingsData, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCompassHomeDirGet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettingsData, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCpuSet( uint8_t *NewCpu )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettingsData, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCpuGet( uint8_t *NewCpu )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettingsData, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCpuFontSet( uint8_t *NewCpuFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettingsData, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCpuFontGet( uint8_t *NewCpuFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettingsData, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCpuAlignSet( uint8_t *NewCpuAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettingsData, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCpuAlignGet( uint8_t *NewCpuAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettingsData, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettingsData, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettingsData, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCustomTextFontSet( uint8_t *NewCustomTextFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettingsData, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCustomTextFontGet( uint8_t *NewCustomTextFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettingsData, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCustomTextAlignSet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettingsData, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsCustomTextAlignGet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettingsData, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsFlightModeSet( uint8_t *NewFlightMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettingsData, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsFlightModeGet( uint8_t *NewFlightMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettingsData, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsFlightModeFontSet( uint8_t *NewFlightModeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettingsData, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsFlightModeFontGet( uint8_t *NewFlightModeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettingsData, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsFlightModeAlignSet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettingsData, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsFlightModeAlignGet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettingsData, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGForceSet( uint8_t *NewGForce )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettingsData, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGForceGet( uint8_t *NewGForce )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettingsData, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGForceFontSet( uint8_t *NewGForceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettingsData, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGForceFontGet( uint8_t *NewGForceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettingsData, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGForceAlignSet( uint8_t *NewGForceAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettingsData, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGForceAlignGet( uint8_t *NewGForceAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettingsData, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusSet( uint8_t *NewGpsStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettingsData, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusGet( uint8_t *NewGpsStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettingsData, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusFontSet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettingsData, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsStatusFontGet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettingsData, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLatSet( uint8_t *NewGpsLat )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettingsData, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLatGet( uint8_t *NewGpsLat )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettingsData, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLatFontSet( uint8_t *NewGpsLatFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettingsData, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLatFontGet( uint8_t *NewGpsLatFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettingsData, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLatAlignSet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettingsData, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLatAlignGet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettingsData, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLonSet( uint8_t *NewGpsLon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettingsData, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLonGet( uint8_t *NewGpsLon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettingsData, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLonFontSet( uint8_t *NewGpsLonFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettingsData, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLonFontGet( uint8_t *NewGpsLonFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettingsData, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLonAlignSet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettingsData, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsLonAlignGet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettingsData, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsSet( uint8_t *NewGpsMgrs )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettingsData, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsGet( uint8_t *NewGpsMgrs )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettingsData, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsFontSet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsFontGet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsGpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettingsData, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeDistanceSet( uint8_t *NewHomeDistance )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettingsData, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeDistanceGet( uint8_t *NewHomeDistance )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettingsData, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeDistanceFontSet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettingsData, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeDistanceFontGet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettingsData, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettingsData, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettingsData, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeArrowSet( uint8_t *NewHomeArrow )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettingsData, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsHomeArrowGet( uint8_t *NewHomeArrow )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettingsData, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapSet( uint8_t *NewMap )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettingsData, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapGet( uint8_t *NewMap )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettingsData, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapCenterModeSet( uint8_t *NewMapCenterMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettingsData, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapCenterModeGet( uint8_t *NewMapCenterMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettingsData, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapShowWpSet( uint8_t *NewMapShowWp )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettingsData, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapShowWpGet( uint8_t *NewMapShowWp )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettingsData, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapShowUavHomeSet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettingsData, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapShowUavHomeGet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettingsData, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapShowTabletSet( uint8_t *NewMapShowTablet )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettingsData, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsMapShowTabletGet( uint8_t *NewMapShowTablet )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettingsData, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsRssiSet( uint8_t *NewRssi )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettingsData, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsRssiGet( uint8_t *NewRssi )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettingsData, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsRssiFontSet( uint8_t *NewRssiFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettingsData, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsRssiFontGet( uint8_t *NewRssiFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettingsData, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsRssiShowIconSet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettingsData, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsRssiShowIconGet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettingsData, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedScaleSet( uint8_t *NewSpeedScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettingsData, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedScaleGet( uint8_t *NewSpeedScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettingsData, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettingsData, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettingsData, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedScaleSourceSet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettingsData, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedScaleSourceGet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettingsData, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericSet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettingsData, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericGet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettingsData, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericFontSet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericFontGet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericSourceSet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsSpeedNumericSourceGet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettingsData, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsTimeSet( uint8_t *NewTime )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettingsData, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsTimeGet( uint8_t *NewTime )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettingsData, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsTimeFontSet( uint8_t *NewTimeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettingsData, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsTimeFontGet( uint8_t *NewTimeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettingsData, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsTimeAlignSet( uint8_t *NewTimeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettingsData, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsTimeAlignGet( uint8_t *NewTimeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettingsData, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsThrottleSet( uint8_t *NewThrottle )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettingsData, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsThrottleGet( uint8_t *NewThrottle )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettingsData, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsThrottleFontSet( uint8_t *NewThrottleFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettingsData, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsThrottleFontGet( uint8_t *NewThrottleFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettingsData, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsThrottleAlignSet( uint8_t *NewThrottleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettingsData, ThrottleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettingsThrottleAlignGet( uint8_t *NewThrottleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettingsHandle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettingsData, ThrottleAlign), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
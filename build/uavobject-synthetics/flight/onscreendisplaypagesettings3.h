@@ -0,0 +1,1266 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup OnScreenDisplayPageSettings3 OnScreenDisplayPageSettings3
+ * @brief On Sreen Display Page Settings
+ *
+ *
+ * @file       onscreendisplaypagesettings3.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the OnScreenDisplayPageSettings3 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings3.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef ONSCREENDISPLAYPAGESETTINGS3_H
+#define ONSCREENDISPLAYPAGESETTINGS3_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define ONSCREENDISPLAYPAGESETTINGS3_OBJID 0x6B172958
+#define ONSCREENDISPLAYPAGESETTINGS3_ISSINGLEINST 1
+#define ONSCREENDISPLAYPAGESETTINGS3_ISSETTINGS 1
+#define ONSCREENDISPLAYPAGESETTINGS3_ISSEQLOCKED 0
+#define ONSCREENDISPLAYPAGESETTINGS3_NUMBYTES 182
+
+// Generic interface functions
+int32_t OnScreenDisplayPageSettings3Initialize();
+UAVObjHandle OnScreenDisplayPageSettings3Handle();
+void OnScreenDisplayPageSettings3SetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    int16_t AlarmPosX;
+    int16_t AlarmPosY;
+    int16_t AltitudeScalePos;
+    int16_t AltitudeNumericPosX;
+    int16_t AltitudeNumericPosY;
+    int16_t ArmStatusPosX;
+    int16_t ArmStatusPosY;
+    int16_t BatteryVoltPosX;
+    int16_t BatteryVoltPosY;
+    int16_t BatteryCurrentPosX;
+    int16_t BatteryCurrentPosY;
+    int16_t BatteryConsumedPosX;
+    int16_t BatteryConsumedPosY;
+    int16_t BatteryChargeStatePosX;
+    int16_t BatteryChargeStatePosY;
+    int16_t ClimbRatePosX;
+    int16_t ClimbRatePosY;
+    int16_t CompassPos;
+    int16_t CpuPosX;
+    int16_t CpuPosY;
+    int16_t CustomTextPosX;
+    int16_t CustomTextPosY;
+    int16_t FlightModePosX;
+    int16_t FlightModePosY;
+    int16_t GForcePosX;
+    int16_t GForcePosY;
+    int16_t GpsStatusPosX;
+    int16_t GpsStatusPosY;
+    int16_t GpsLatPosX;
+    int16_t GpsLatPosY;
+    int16_t GpsLonPosX;
+    int16_t GpsLonPosY;
+    int16_t GpsMgrsPosX;
+    int16_t GpsMgrsPosY;
+    int16_t HomeDistancePosX;
+    int16_t HomeDistancePosY;
+    int16_t HomeArrowPosX;
+    int16_t HomeArrowPosY;
+    int16_t MapWidthMeters;
+    int16_t MapWidthPixels;
+    int16_t MapHeightMeters;
+    int16_t MapHeightPixels;
+    int16_t RssiPosX;
+    int16_t RssiPosY;
+    int16_t SpeedScalePos;
+    int16_t SpeedNumericPosX;
+    int16_t SpeedNumericPosY;
+    int16_t TimePosX;
+    int16_t TimePosY;
+    int16_t ThrottlePosX;
+    int16_t ThrottlePosY;
+    uint8_t Alarm;
+    uint8_t AlarmFont;
+    uint8_t AlarmAlign;
+    uint8_t AltitudeScale;
+    uint8_t AltitudeScaleAlign;
+    uint8_t AltitudeScaleSource;
+    uint8_t AltitudeNumeric;
+    uint8_t AltitudeNumericAlign;
+    uint8_t AltitudeNumericFont;
+    uint8_t AltitudeNumericSource;
+    uint8_t ArmStatus;
+    uint8_t ArmStatusFont;
+    uint8_t ArmStatusAlign;
+    uint8_t ArtificialHorizon;
+    uint8_t ArtificialHorizonMaxPitch;
+    uint8_t ArtificialHorizonPitchSteps;
+    uint8_t BatteryVolt;
+    uint8_t BatteryVoltFont;
+    uint8_t BatteryVoltAlign;
+    uint8_t BatteryCurrent;
+    uint8_t BatteryCurrentFont;
+    uint8_t BatteryCurrentAlign;
+    uint8_t BatteryConsumed;
+    uint8_t BatteryConsumedFont;
+    uint8_t BatteryConsumedAlign;
+    uint8_t BatteryChargeState;
+    uint8_t CenterMark;
+    uint8_t ClimbRate;
+    uint8_t ClimbRateFont;
+    uint8_t ClimbRateAlign;
+    uint8_t Compass;
+    uint8_t CompassHomeDir;
+    uint8_t Cpu;
+    uint8_t CpuFont;
+    uint8_t CpuAlign;
+    uint8_t CustomText;
+    uint8_t CustomTextFont;
+    uint8_t CustomTextAlign;
+    uint8_t FlightMode;
+    uint8_t FlightModeFont;
+    uint8_t FlightModeAlign;
+    uint8_t GForce;
+    uint8_t GForceFont;
+    uint8_t GForceAlign;
+    uint8_t GpsStatus;
+    uint8_t GpsStatusFont;
+    uint8_t GpsLat;
+    uint8_t GpsLatFont;
+    uint8_t GpsLatAlign;
+    uint8_t GpsLon;
+    uint8_t GpsLonFont;
+    uint8_t GpsLonAlign;
+    uint8_t GpsMgrs;
+    uint8_t GpsMgrsFont;
+    uint8_t GpsMgrsAlign;
+    uint8_t HomeDistance;
+    uint8_t HomeDistanceFont;
+    uint8_t HomeDistanceShowIcon;
+    uint8_t HomeArrow;
+    uint8_t Map;
+    uint8_t MapCenterMode;
+    uint8_t MapShowWp;
+    uint8_t MapShowUavHome;
+    uint8_t MapShowTablet;
+    uint8_t Rssi;
+    uint8_t RssiFont;
+    uint8_t RssiShowIcon;
+    uint8_t SpeedScale;
+    uint8_t SpeedScaleAlign;
+    uint8_t SpeedScaleSource;
+    uint8_t SpeedNumeric;
+    uint8_t SpeedNumericFont;
+    uint8_t SpeedNumericAlign;
+    uint8_t SpeedNumericSource;
+    uint8_t Time;
+    uint8_t TimeFont;
+    uint8_t TimeAlign;
+    uint8_t Throttle;
+    uint8_t ThrottleFont;
+    uint8_t ThrottleAlign;
+
+} __attribute__((packed)) __attribute__((aligned(4))) OnScreenDisplayPageSettings3Data;
+
+// Typesafe Object access functions
+/**
+ * @function OnScreenDisplayPageSettings3Get(dataOut)
+ * @brief Populate a OnScreenDisplayPageSettings3Data object
+ * @param[out] dataOut 
+ */
+static inline int32_t OnScreenDisplayPageSettings3Get(OnScreenDisplayPageSettings3Data *dataOut) { return UAVObjGetData(OnScreenDisplayPageSettings3Handle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings3Set(const OnScreenDisplayPageSettings3Data *dataIn) { return UAVObjSetData(OnScreenDisplayPageSettings3Handle(), dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettings3InstGet(uint16_t instId, OnScreenDisplayPageSettings3Data *dataOut) { return UAVObjGetInstanceData(OnScreenDisplayPageSettings3Handle(), instId, dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings3InstSet(uint16_t instId, const OnScreenDisplayPageSettings3Data *dataIn) { return UAVObjSetInstanceData(OnScreenDisplayPageSettings3Handle(), instId, dataIn); }
+
+static inline int32_t OnScreenDisplayPageSettings3ConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(OnScreenDisplayPageSettings3Handle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings3ConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(OnScreenDisplayPageSettings3Handle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings3ConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(OnScreenDisplayPageSettings3Handle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t OnScreenDisplayPageSettings3ConnectCopy(volatile OnScreenDisplayPageSettings3Data *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	OnScreenDisplayPageSettings3Get((void *) dataOut);
+
+	return UAVObjConnectCallback(OnScreenDisplayPageSettings3Handle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t OnScreenDisplayPageSettings3CreateInstance() { return UAVObjCreateInstance(OnScreenDisplayPageSettings3Handle(), &OnScreenDisplayPageSettings3SetDefaults); }
+
+static inline void OnScreenDisplayPageSettings3Updated() { UAVObjUpdated(OnScreenDisplayPageSettings3Handle()); }
+
+static inline void OnScreenDisplayPageSettings3InstUpdated(uint16_t instId) { UAVObjInstanceUpdated(OnScreenDisplayPageSettings3Handle(), instId); }
+
+static inline int32_t OnScreenDisplayPageSettings3GetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(OnScreenDisplayPageSettings3Handle(), dataOut); }
+
+static inline int32_t OnScreenDisplayPageSettings3SetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(OnScreenDisplayPageSettings3Handle(), dataIn); }
+
+static inline int8_t OnScreenDisplayPageSettings3ReadOnly() { return UAVObjReadOnly(OnScreenDisplayPageSettings3Handle()); }
+
+static inline uint16_t OnScreenDisplayPageSettings3GetNumInstances(){ return UAVObjGetNumInstances(OnScreenDisplayPageSettings3Handle()); }
+
+static inline uint32_t OnScreenDisplayPageSettings3GetNumBytes(){ return UAVObjGetNumBytes(OnScreenDisplayPageSettings3Handle()); }
+
+// Field information
+// Field AlarmPosX information
+// Field AlarmPosY information
+// Field AltitudeScalePos information
+// Field AltitudeNumericPosX information
+// Field AltitudeNumericPosY information
+// Field ArmStatusPosX information
+// Field ArmStatusPosY information
+// Field BatteryVoltPosX information
+// Field BatteryVoltPosY information
+// Field BatteryCurrentPosX information
+// Field BatteryCurrentPosY information
+// Field BatteryConsumedPosX information
+// Field BatteryConsumedPosY information
+// Field BatteryChargeStatePosX information
+// Field BatteryChargeStatePosY information
+// Field ClimbRatePosX information
+// Field ClimbRatePosY information
+// Field CompassPos information
+// Field CpuPosX information
+// Field CpuPosY information
+// Field CustomTextPosX information
+// Field CustomTextPosY information
+// Field FlightModePosX information
+// Field FlightModePosY information
+// Field GForcePosX information
+// Field GForcePosY information
+// Field GpsStatusPosX information
+// Field GpsStatusPosY information
+// Field GpsLatPosX information
+// Field GpsLatPosY information
+// Field GpsLonPosX information
+// Field GpsLonPosY information
+// Field GpsMgrsPosX information
+// Field GpsMgrsPosY information
+// Field HomeDistancePosX information
+// Field HomeDistancePosY information
+// Field HomeArrowPosX information
+// Field HomeArrowPosY information
+// Field MapWidthMeters information
+// Field MapWidthPixels information
+// Field MapHeightMeters information
+// Field MapHeightPixels information
+// Field RssiPosX information
+// Field RssiPosY information
+// Field SpeedScalePos information
+// Field SpeedNumericPosX information
+// Field SpeedNumericPosY information
+// Field TimePosX information
+// Field TimePosY information
+// Field ThrottlePosX information
+// Field ThrottlePosY information
+// Field Alarm information
+/* Enumeration options for field Alarm */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALARM_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_ALARM_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AlarmOptions;
+/* Max value of any option in topmost parent Alarm of field Alarm */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALARM_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Alarm */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALARM_MAXOPTVAL 1
+/* Ensure field Alarm contains valid data */
+static inline bool OnScreenDisplayPageSettings3AlarmIsValid( uint8_t CurrentAlarm ) { return CurrentAlarm < ONSCREENDISPLAYPAGESETTINGS3_ALARM_MAXOPTVAL; }
+// Field AlarmFont information
+/* Enumeration options for field AlarmFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALARMFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_ALARMFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_ALARMFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3AlarmFontOptions;
+/* Max value of any option in topmost parent AlarmFont of field AlarmFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALARMFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field AlarmFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALARMFONT_MAXOPTVAL 2
+/* Ensure field AlarmFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3AlarmFontIsValid( uint8_t CurrentAlarmFont ) { return CurrentAlarmFont < ONSCREENDISPLAYPAGESETTINGS3_ALARMFONT_MAXOPTVAL; }
+// Field AlarmAlign information
+/* Enumeration options for field AlarmAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALARMALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_ALARMALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_ALARMALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3AlarmAlignOptions;
+/* Max value of any option in topmost parent AlarmAlign of field AlarmAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALARMALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field AlarmAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALARMALIGN_MAXOPTVAL 2
+/* Ensure field AlarmAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3AlarmAlignIsValid( uint8_t CurrentAlarmAlign ) { return CurrentAlarmAlign < ONSCREENDISPLAYPAGESETTINGS3_ALARMALIGN_MAXOPTVAL; }
+// Field AltitudeScale information
+/* Enumeration options for field AltitudeScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeScaleOptions;
+/* Max value of any option in topmost parent AltitudeScale of field AltitudeScale */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AltitudeScale */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALE_MAXOPTVAL 1
+/* Ensure field AltitudeScale contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeScaleIsValid( uint8_t CurrentAltitudeScale ) { return CurrentAltitudeScale < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALE_MAXOPTVAL; }
+// Field AltitudeScaleAlign information
+/* Enumeration options for field AltitudeScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeScaleAlignOptions;
+/* Max value of any option in topmost parent AltitudeScaleAlign of field AltitudeScaleAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALEALIGN_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AltitudeScaleAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALEALIGN_MAXOPTVAL 1
+/* Ensure field AltitudeScaleAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeScaleAlignIsValid( uint8_t CurrentAltitudeScaleAlign ) { return CurrentAltitudeScaleAlign < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALEALIGN_MAXOPTVAL; }
+// Field AltitudeScaleSource information
+/* Enumeration options for field AltitudeScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALESOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALESOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeScaleSourceOptions;
+/* Max value of any option in topmost parent AltitudeScaleSource of field AltitudeScaleSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALESOURCE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AltitudeScaleSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALESOURCE_MAXOPTVAL 1
+/* Ensure field AltitudeScaleSource contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeScaleSourceIsValid( uint8_t CurrentAltitudeScaleSource ) { return CurrentAltitudeScaleSource < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDESCALESOURCE_MAXOPTVAL; }
+// Field AltitudeNumeric information
+/* Enumeration options for field AltitudeNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeNumericOptions;
+/* Max value of any option in topmost parent AltitudeNumeric of field AltitudeNumeric */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERIC_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AltitudeNumeric */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERIC_MAXOPTVAL 1
+/* Ensure field AltitudeNumeric contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeNumericIsValid( uint8_t CurrentAltitudeNumeric ) { return CurrentAltitudeNumeric < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERIC_MAXOPTVAL; }
+// Field AltitudeNumericAlign information
+/* Enumeration options for field AltitudeNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeNumericAlignOptions;
+/* Max value of any option in topmost parent AltitudeNumericAlign of field AltitudeNumericAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICALIGN_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AltitudeNumericAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICALIGN_MAXOPTVAL 1
+/* Ensure field AltitudeNumericAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeNumericAlignIsValid( uint8_t CurrentAltitudeNumericAlign ) { return CurrentAltitudeNumericAlign < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICALIGN_MAXOPTVAL; }
+// Field AltitudeNumericFont information
+/* Enumeration options for field AltitudeNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeNumericFontOptions;
+/* Max value of any option in topmost parent AltitudeNumericFont of field AltitudeNumericFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field AltitudeNumericFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICFONT_MAXOPTVAL 2
+/* Ensure field AltitudeNumericFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeNumericFontIsValid( uint8_t CurrentAltitudeNumericFont ) { return CurrentAltitudeNumericFont < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICFONT_MAXOPTVAL; }
+// Field AltitudeNumericSource information
+/* Enumeration options for field AltitudeNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICSOURCE_BARO=0, ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICSOURCE_NAV=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3AltitudeNumericSourceOptions;
+/* Max value of any option in topmost parent AltitudeNumericSource of field AltitudeNumericSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICSOURCE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field AltitudeNumericSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICSOURCE_MAXOPTVAL 1
+/* Ensure field AltitudeNumericSource contains valid data */
+static inline bool OnScreenDisplayPageSettings3AltitudeNumericSourceIsValid( uint8_t CurrentAltitudeNumericSource ) { return CurrentAltitudeNumericSource < ONSCREENDISPLAYPAGESETTINGS3_ALTITUDENUMERICSOURCE_MAXOPTVAL; }
+// Field ArmStatus information
+/* Enumeration options for field ArmStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3ArmStatusOptions;
+/* Max value of any option in topmost parent ArmStatus of field ArmStatus */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUS_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field ArmStatus */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUS_MAXOPTVAL 1
+/* Ensure field ArmStatus contains valid data */
+static inline bool OnScreenDisplayPageSettings3ArmStatusIsValid( uint8_t CurrentArmStatus ) { return CurrentArmStatus < ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUS_MAXOPTVAL; }
+// Field ArmStatusFont information
+/* Enumeration options for field ArmStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3ArmStatusFontOptions;
+/* Max value of any option in topmost parent ArmStatusFont of field ArmStatusFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field ArmStatusFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSFONT_MAXOPTVAL 2
+/* Ensure field ArmStatusFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3ArmStatusFontIsValid( uint8_t CurrentArmStatusFont ) { return CurrentArmStatusFont < ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSFONT_MAXOPTVAL; }
+// Field ArmStatusAlign information
+/* Enumeration options for field ArmStatusAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3ArmStatusAlignOptions;
+/* Max value of any option in topmost parent ArmStatusAlign of field ArmStatusAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field ArmStatusAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSALIGN_MAXOPTVAL 2
+/* Ensure field ArmStatusAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3ArmStatusAlignIsValid( uint8_t CurrentArmStatusAlign ) { return CurrentArmStatusAlign < ONSCREENDISPLAYPAGESETTINGS3_ARMSTATUSALIGN_MAXOPTVAL; }
+// Field ArtificialHorizon information
+/* Enumeration options for field ArtificialHorizon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_ARTIFICIALHORIZON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_ARTIFICIALHORIZON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3ArtificialHorizonOptions;
+/* Max value of any option in topmost parent ArtificialHorizon of field ArtificialHorizon */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARTIFICIALHORIZON_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field ArtificialHorizon */
+#define ONSCREENDISPLAYPAGESETTINGS3_ARTIFICIALHORIZON_MAXOPTVAL 1
+/* Ensure field ArtificialHorizon contains valid data */
+static inline bool OnScreenDisplayPageSettings3ArtificialHorizonIsValid( uint8_t CurrentArtificialHorizon ) { return CurrentArtificialHorizon < ONSCREENDISPLAYPAGESETTINGS3_ARTIFICIALHORIZON_MAXOPTVAL; }
+// Field ArtificialHorizonMaxPitch information
+// Field ArtificialHorizonPitchSteps information
+// Field BatteryVolt information
+/* Enumeration options for field BatteryVolt */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryVoltOptions;
+/* Max value of any option in topmost parent BatteryVolt of field BatteryVolt */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLT_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field BatteryVolt */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLT_MAXOPTVAL 1
+/* Ensure field BatteryVolt contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryVoltIsValid( uint8_t CurrentBatteryVolt ) { return CurrentBatteryVolt < ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLT_MAXOPTVAL; }
+// Field BatteryVoltFont information
+/* Enumeration options for field BatteryVoltFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryVoltFontOptions;
+/* Max value of any option in topmost parent BatteryVoltFont of field BatteryVoltFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field BatteryVoltFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTFONT_MAXOPTVAL 2
+/* Ensure field BatteryVoltFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryVoltFontIsValid( uint8_t CurrentBatteryVoltFont ) { return CurrentBatteryVoltFont < ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTFONT_MAXOPTVAL; }
+// Field BatteryVoltAlign information
+/* Enumeration options for field BatteryVoltAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryVoltAlignOptions;
+/* Max value of any option in topmost parent BatteryVoltAlign of field BatteryVoltAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field BatteryVoltAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTALIGN_MAXOPTVAL 2
+/* Ensure field BatteryVoltAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryVoltAlignIsValid( uint8_t CurrentBatteryVoltAlign ) { return CurrentBatteryVoltAlign < ONSCREENDISPLAYPAGESETTINGS3_BATTERYVOLTALIGN_MAXOPTVAL; }
+// Field BatteryCurrent information
+/* Enumeration options for field BatteryCurrent */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryCurrentOptions;
+/* Max value of any option in topmost parent BatteryCurrent of field BatteryCurrent */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENT_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field BatteryCurrent */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENT_MAXOPTVAL 1
+/* Ensure field BatteryCurrent contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryCurrentIsValid( uint8_t CurrentBatteryCurrent ) { return CurrentBatteryCurrent < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENT_MAXOPTVAL; }
+// Field BatteryCurrentFont information
+/* Enumeration options for field BatteryCurrentFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryCurrentFontOptions;
+/* Max value of any option in topmost parent BatteryCurrentFont of field BatteryCurrentFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field BatteryCurrentFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTFONT_MAXOPTVAL 2
+/* Ensure field BatteryCurrentFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryCurrentFontIsValid( uint8_t CurrentBatteryCurrentFont ) { return CurrentBatteryCurrentFont < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTFONT_MAXOPTVAL; }
+// Field BatteryCurrentAlign information
+/* Enumeration options for field BatteryCurrentAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryCurrentAlignOptions;
+/* Max value of any option in topmost parent BatteryCurrentAlign of field BatteryCurrentAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field BatteryCurrentAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTALIGN_MAXOPTVAL 2
+/* Ensure field BatteryCurrentAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryCurrentAlignIsValid( uint8_t CurrentBatteryCurrentAlign ) { return CurrentBatteryCurrentAlign < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCURRENTALIGN_MAXOPTVAL; }
+// Field BatteryConsumed information
+/* Enumeration options for field BatteryConsumed */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMED_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMED_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryConsumedOptions;
+/* Max value of any option in topmost parent BatteryConsumed of field BatteryConsumed */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMED_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field BatteryConsumed */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMED_MAXOPTVAL 1
+/* Ensure field BatteryConsumed contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryConsumedIsValid( uint8_t CurrentBatteryConsumed ) { return CurrentBatteryConsumed < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMED_MAXOPTVAL; }
+// Field BatteryConsumedFont information
+/* Enumeration options for field BatteryConsumedFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryConsumedFontOptions;
+/* Max value of any option in topmost parent BatteryConsumedFont of field BatteryConsumedFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field BatteryConsumedFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDFONT_MAXOPTVAL 2
+/* Ensure field BatteryConsumedFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryConsumedFontIsValid( uint8_t CurrentBatteryConsumedFont ) { return CurrentBatteryConsumedFont < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDFONT_MAXOPTVAL; }
+// Field BatteryConsumedAlign information
+/* Enumeration options for field BatteryConsumedAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryConsumedAlignOptions;
+/* Max value of any option in topmost parent BatteryConsumedAlign of field BatteryConsumedAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field BatteryConsumedAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDALIGN_MAXOPTVAL 2
+/* Ensure field BatteryConsumedAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryConsumedAlignIsValid( uint8_t CurrentBatteryConsumedAlign ) { return CurrentBatteryConsumedAlign < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCONSUMEDALIGN_MAXOPTVAL; }
+// Field BatteryChargeState information
+/* Enumeration options for field BatteryChargeState */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_BATTERYCHARGESTATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_BATTERYCHARGESTATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3BatteryChargeStateOptions;
+/* Max value of any option in topmost parent BatteryChargeState of field BatteryChargeState */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCHARGESTATE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field BatteryChargeState */
+#define ONSCREENDISPLAYPAGESETTINGS3_BATTERYCHARGESTATE_MAXOPTVAL 1
+/* Ensure field BatteryChargeState contains valid data */
+static inline bool OnScreenDisplayPageSettings3BatteryChargeStateIsValid( uint8_t CurrentBatteryChargeState ) { return CurrentBatteryChargeState < ONSCREENDISPLAYPAGESETTINGS3_BATTERYCHARGESTATE_MAXOPTVAL; }
+// Field CenterMark information
+/* Enumeration options for field CenterMark */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CENTERMARK_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_CENTERMARK_MIDDLE=1, ONSCREENDISPLAYPAGESETTINGS3_CENTERMARK_CAMERAPITCH=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3CenterMarkOptions;
+/* Max value of any option in topmost parent CenterMark of field CenterMark */
+#define ONSCREENDISPLAYPAGESETTINGS3_CENTERMARK_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field CenterMark */
+#define ONSCREENDISPLAYPAGESETTINGS3_CENTERMARK_MAXOPTVAL 2
+/* Ensure field CenterMark contains valid data */
+static inline bool OnScreenDisplayPageSettings3CenterMarkIsValid( uint8_t CurrentCenterMark ) { return CurrentCenterMark < ONSCREENDISPLAYPAGESETTINGS3_CENTERMARK_MAXOPTVAL; }
+// Field ClimbRate information
+/* Enumeration options for field ClimbRate */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3ClimbRateOptions;
+/* Max value of any option in topmost parent ClimbRate of field ClimbRate */
+#define ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field ClimbRate */
+#define ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATE_MAXOPTVAL 1
+/* Ensure field ClimbRate contains valid data */
+static inline bool OnScreenDisplayPageSettings3ClimbRateIsValid( uint8_t CurrentClimbRate ) { return CurrentClimbRate < ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATE_MAXOPTVAL; }
+// Field ClimbRateFont information
+/* Enumeration options for field ClimbRateFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3ClimbRateFontOptions;
+/* Max value of any option in topmost parent ClimbRateFont of field ClimbRateFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field ClimbRateFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEFONT_MAXOPTVAL 2
+/* Ensure field ClimbRateFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3ClimbRateFontIsValid( uint8_t CurrentClimbRateFont ) { return CurrentClimbRateFont < ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEFONT_MAXOPTVAL; }
+// Field ClimbRateAlign information
+/* Enumeration options for field ClimbRateAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3ClimbRateAlignOptions;
+/* Max value of any option in topmost parent ClimbRateAlign of field ClimbRateAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field ClimbRateAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEALIGN_MAXOPTVAL 2
+/* Ensure field ClimbRateAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3ClimbRateAlignIsValid( uint8_t CurrentClimbRateAlign ) { return CurrentClimbRateAlign < ONSCREENDISPLAYPAGESETTINGS3_CLIMBRATEALIGN_MAXOPTVAL; }
+// Field Compass information
+/* Enumeration options for field Compass */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_COMPASS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_COMPASS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3CompassOptions;
+/* Max value of any option in topmost parent Compass of field Compass */
+#define ONSCREENDISPLAYPAGESETTINGS3_COMPASS_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Compass */
+#define ONSCREENDISPLAYPAGESETTINGS3_COMPASS_MAXOPTVAL 1
+/* Ensure field Compass contains valid data */
+static inline bool OnScreenDisplayPageSettings3CompassIsValid( uint8_t CurrentCompass ) { return CurrentCompass < ONSCREENDISPLAYPAGESETTINGS3_COMPASS_MAXOPTVAL; }
+// Field CompassHomeDir information
+/* Enumeration options for field CompassHomeDir */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_COMPASSHOMEDIR_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_COMPASSHOMEDIR_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3CompassHomeDirOptions;
+/* Max value of any option in topmost parent CompassHomeDir of field CompassHomeDir */
+#define ONSCREENDISPLAYPAGESETTINGS3_COMPASSHOMEDIR_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field CompassHomeDir */
+#define ONSCREENDISPLAYPAGESETTINGS3_COMPASSHOMEDIR_MAXOPTVAL 1
+/* Ensure field CompassHomeDir contains valid data */
+static inline bool OnScreenDisplayPageSettings3CompassHomeDirIsValid( uint8_t CurrentCompassHomeDir ) { return CurrentCompassHomeDir < ONSCREENDISPLAYPAGESETTINGS3_COMPASSHOMEDIR_MAXOPTVAL; }
+// Field Cpu information
+/* Enumeration options for field Cpu */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CPU_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_CPU_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3CpuOptions;
+/* Max value of any option in topmost parent Cpu of field Cpu */
+#define ONSCREENDISPLAYPAGESETTINGS3_CPU_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Cpu */
+#define ONSCREENDISPLAYPAGESETTINGS3_CPU_MAXOPTVAL 1
+/* Ensure field Cpu contains valid data */
+static inline bool OnScreenDisplayPageSettings3CpuIsValid( uint8_t CurrentCpu ) { return CurrentCpu < ONSCREENDISPLAYPAGESETTINGS3_CPU_MAXOPTVAL; }
+// Field CpuFont information
+/* Enumeration options for field CpuFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CPUFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_CPUFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_CPUFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3CpuFontOptions;
+/* Max value of any option in topmost parent CpuFont of field CpuFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_CPUFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field CpuFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_CPUFONT_MAXOPTVAL 2
+/* Ensure field CpuFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3CpuFontIsValid( uint8_t CurrentCpuFont ) { return CurrentCpuFont < ONSCREENDISPLAYPAGESETTINGS3_CPUFONT_MAXOPTVAL; }
+// Field CpuAlign information
+/* Enumeration options for field CpuAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CPUALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_CPUALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_CPUALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3CpuAlignOptions;
+/* Max value of any option in topmost parent CpuAlign of field CpuAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_CPUALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field CpuAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_CPUALIGN_MAXOPTVAL 2
+/* Ensure field CpuAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3CpuAlignIsValid( uint8_t CurrentCpuAlign ) { return CurrentCpuAlign < ONSCREENDISPLAYPAGESETTINGS3_CPUALIGN_MAXOPTVAL; }
+// Field CustomText information
+/* Enumeration options for field CustomText */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3CustomTextOptions;
+/* Max value of any option in topmost parent CustomText of field CustomText */
+#define ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXT_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field CustomText */
+#define ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXT_MAXOPTVAL 1
+/* Ensure field CustomText contains valid data */
+static inline bool OnScreenDisplayPageSettings3CustomTextIsValid( uint8_t CurrentCustomText ) { return CurrentCustomText < ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXT_MAXOPTVAL; }
+// Field CustomTextFont information
+/* Enumeration options for field CustomTextFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3CustomTextFontOptions;
+/* Max value of any option in topmost parent CustomTextFont of field CustomTextFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field CustomTextFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTFONT_MAXOPTVAL 2
+/* Ensure field CustomTextFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3CustomTextFontIsValid( uint8_t CurrentCustomTextFont ) { return CurrentCustomTextFont < ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTFONT_MAXOPTVAL; }
+// Field CustomTextAlign information
+/* Enumeration options for field CustomTextAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3CustomTextAlignOptions;
+/* Max value of any option in topmost parent CustomTextAlign of field CustomTextAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTALIGN_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field CustomTextAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTALIGN_MAXOPTVAL 1
+/* Ensure field CustomTextAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3CustomTextAlignIsValid( uint8_t CurrentCustomTextAlign ) { return CurrentCustomTextAlign < ONSCREENDISPLAYPAGESETTINGS3_CUSTOMTEXTALIGN_MAXOPTVAL; }
+// Field FlightMode information
+/* Enumeration options for field FlightMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3FlightModeOptions;
+/* Max value of any option in topmost parent FlightMode of field FlightMode */
+#define ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field FlightMode */
+#define ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODE_MAXOPTVAL 1
+/* Ensure field FlightMode contains valid data */
+static inline bool OnScreenDisplayPageSettings3FlightModeIsValid( uint8_t CurrentFlightMode ) { return CurrentFlightMode < ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODE_MAXOPTVAL; }
+// Field FlightModeFont information
+/* Enumeration options for field FlightModeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3FlightModeFontOptions;
+/* Max value of any option in topmost parent FlightModeFont of field FlightModeFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field FlightModeFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEFONT_MAXOPTVAL 2
+/* Ensure field FlightModeFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3FlightModeFontIsValid( uint8_t CurrentFlightModeFont ) { return CurrentFlightModeFont < ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEFONT_MAXOPTVAL; }
+// Field FlightModeAlign information
+/* Enumeration options for field FlightModeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3FlightModeAlignOptions;
+/* Max value of any option in topmost parent FlightModeAlign of field FlightModeAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field FlightModeAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEALIGN_MAXOPTVAL 2
+/* Ensure field FlightModeAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3FlightModeAlignIsValid( uint8_t CurrentFlightModeAlign ) { return CurrentFlightModeAlign < ONSCREENDISPLAYPAGESETTINGS3_FLIGHTMODEALIGN_MAXOPTVAL; }
+// Field GForce information
+/* Enumeration options for field GForce */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GFORCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_GFORCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3GForceOptions;
+/* Max value of any option in topmost parent GForce of field GForce */
+#define ONSCREENDISPLAYPAGESETTINGS3_GFORCE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GForce */
+#define ONSCREENDISPLAYPAGESETTINGS3_GFORCE_MAXOPTVAL 1
+/* Ensure field GForce contains valid data */
+static inline bool OnScreenDisplayPageSettings3GForceIsValid( uint8_t CurrentGForce ) { return CurrentGForce < ONSCREENDISPLAYPAGESETTINGS3_GFORCE_MAXOPTVAL; }
+// Field GForceFont information
+/* Enumeration options for field GForceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GFORCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_GFORCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_GFORCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GForceFontOptions;
+/* Max value of any option in topmost parent GForceFont of field GForceFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GFORCEFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GForceFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GFORCEFONT_MAXOPTVAL 2
+/* Ensure field GForceFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3GForceFontIsValid( uint8_t CurrentGForceFont ) { return CurrentGForceFont < ONSCREENDISPLAYPAGESETTINGS3_GFORCEFONT_MAXOPTVAL; }
+// Field GForceAlign information
+/* Enumeration options for field GForceAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GFORCEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_GFORCEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_GFORCEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GForceAlignOptions;
+/* Max value of any option in topmost parent GForceAlign of field GForceAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GFORCEALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GForceAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GFORCEALIGN_MAXOPTVAL 2
+/* Ensure field GForceAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3GForceAlignIsValid( uint8_t CurrentGForceAlign ) { return CurrentGForceAlign < ONSCREENDISPLAYPAGESETTINGS3_GFORCEALIGN_MAXOPTVAL; }
+// Field GpsStatus information
+/* Enumeration options for field GpsStatus */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsStatusOptions;
+/* Max value of any option in topmost parent GpsStatus of field GpsStatus */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUS_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GpsStatus */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUS_MAXOPTVAL 1
+/* Ensure field GpsStatus contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsStatusIsValid( uint8_t CurrentGpsStatus ) { return CurrentGpsStatus < ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUS_MAXOPTVAL; }
+// Field GpsStatusFont information
+/* Enumeration options for field GpsStatusFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsStatusFontOptions;
+/* Max value of any option in topmost parent GpsStatusFont of field GpsStatusFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUSFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsStatusFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUSFONT_MAXOPTVAL 2
+/* Ensure field GpsStatusFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsStatusFontIsValid( uint8_t CurrentGpsStatusFont ) { return CurrentGpsStatusFont < ONSCREENDISPLAYPAGESETTINGS3_GPSSTATUSFONT_MAXOPTVAL; }
+// Field GpsLat information
+/* Enumeration options for field GpsLat */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSLAT_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_GPSLAT_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsLatOptions;
+/* Max value of any option in topmost parent GpsLat of field GpsLat */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLAT_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GpsLat */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLAT_MAXOPTVAL 1
+/* Ensure field GpsLat contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsLatIsValid( uint8_t CurrentGpsLat ) { return CurrentGpsLat < ONSCREENDISPLAYPAGESETTINGS3_GPSLAT_MAXOPTVAL; }
+// Field GpsLatFont information
+/* Enumeration options for field GpsLatFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSLATFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_GPSLATFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_GPSLATFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsLatFontOptions;
+/* Max value of any option in topmost parent GpsLatFont of field GpsLatFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLATFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsLatFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLATFONT_MAXOPTVAL 2
+/* Ensure field GpsLatFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsLatFontIsValid( uint8_t CurrentGpsLatFont ) { return CurrentGpsLatFont < ONSCREENDISPLAYPAGESETTINGS3_GPSLATFONT_MAXOPTVAL; }
+// Field GpsLatAlign information
+/* Enumeration options for field GpsLatAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSLATALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_GPSLATALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_GPSLATALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsLatAlignOptions;
+/* Max value of any option in topmost parent GpsLatAlign of field GpsLatAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLATALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsLatAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLATALIGN_MAXOPTVAL 2
+/* Ensure field GpsLatAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsLatAlignIsValid( uint8_t CurrentGpsLatAlign ) { return CurrentGpsLatAlign < ONSCREENDISPLAYPAGESETTINGS3_GPSLATALIGN_MAXOPTVAL; }
+// Field GpsLon information
+/* Enumeration options for field GpsLon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSLON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_GPSLON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsLonOptions;
+/* Max value of any option in topmost parent GpsLon of field GpsLon */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLON_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GpsLon */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLON_MAXOPTVAL 1
+/* Ensure field GpsLon contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsLonIsValid( uint8_t CurrentGpsLon ) { return CurrentGpsLon < ONSCREENDISPLAYPAGESETTINGS3_GPSLON_MAXOPTVAL; }
+// Field GpsLonFont information
+/* Enumeration options for field GpsLonFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSLONFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_GPSLONFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_GPSLONFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsLonFontOptions;
+/* Max value of any option in topmost parent GpsLonFont of field GpsLonFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLONFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsLonFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLONFONT_MAXOPTVAL 2
+/* Ensure field GpsLonFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsLonFontIsValid( uint8_t CurrentGpsLonFont ) { return CurrentGpsLonFont < ONSCREENDISPLAYPAGESETTINGS3_GPSLONFONT_MAXOPTVAL; }
+// Field GpsLonAlign information
+/* Enumeration options for field GpsLonAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSLONALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_GPSLONALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_GPSLONALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsLonAlignOptions;
+/* Max value of any option in topmost parent GpsLonAlign of field GpsLonAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLONALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsLonAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSLONALIGN_MAXOPTVAL 2
+/* Ensure field GpsLonAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsLonAlignIsValid( uint8_t CurrentGpsLonAlign ) { return CurrentGpsLonAlign < ONSCREENDISPLAYPAGESETTINGS3_GPSLONALIGN_MAXOPTVAL; }
+// Field GpsMgrs information
+/* Enumeration options for field GpsMgrs */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSMGRS_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_GPSMGRS_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsMgrsOptions;
+/* Max value of any option in topmost parent GpsMgrs of field GpsMgrs */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSMGRS_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field GpsMgrs */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSMGRS_MAXOPTVAL 1
+/* Ensure field GpsMgrs contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsMgrsIsValid( uint8_t CurrentGpsMgrs ) { return CurrentGpsMgrs < ONSCREENDISPLAYPAGESETTINGS3_GPSMGRS_MAXOPTVAL; }
+// Field GpsMgrsFont information
+/* Enumeration options for field GpsMgrsFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsMgrsFontOptions;
+/* Max value of any option in topmost parent GpsMgrsFont of field GpsMgrsFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsMgrsFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSFONT_MAXOPTVAL 2
+/* Ensure field GpsMgrsFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsMgrsFontIsValid( uint8_t CurrentGpsMgrsFont ) { return CurrentGpsMgrsFont < ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSFONT_MAXOPTVAL; }
+// Field GpsMgrsAlign information
+/* Enumeration options for field GpsMgrsAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3GpsMgrsAlignOptions;
+/* Max value of any option in topmost parent GpsMgrsAlign of field GpsMgrsAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field GpsMgrsAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSALIGN_MAXOPTVAL 2
+/* Ensure field GpsMgrsAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3GpsMgrsAlignIsValid( uint8_t CurrentGpsMgrsAlign ) { return CurrentGpsMgrsAlign < ONSCREENDISPLAYPAGESETTINGS3_GPSMGRSALIGN_MAXOPTVAL; }
+// Field HomeDistance information
+/* Enumeration options for field HomeDistance */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3HomeDistanceOptions;
+/* Max value of any option in topmost parent HomeDistance of field HomeDistance */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field HomeDistance */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCE_MAXOPTVAL 1
+/* Ensure field HomeDistance contains valid data */
+static inline bool OnScreenDisplayPageSettings3HomeDistanceIsValid( uint8_t CurrentHomeDistance ) { return CurrentHomeDistance < ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCE_MAXOPTVAL; }
+// Field HomeDistanceFont information
+/* Enumeration options for field HomeDistanceFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3HomeDistanceFontOptions;
+/* Max value of any option in topmost parent HomeDistanceFont of field HomeDistanceFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCEFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field HomeDistanceFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCEFONT_MAXOPTVAL 2
+/* Ensure field HomeDistanceFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3HomeDistanceFontIsValid( uint8_t CurrentHomeDistanceFont ) { return CurrentHomeDistanceFont < ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCEFONT_MAXOPTVAL; }
+// Field HomeDistanceShowIcon information
+/* Enumeration options for field HomeDistanceShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCESHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCESHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3HomeDistanceShowIconOptions;
+/* Max value of any option in topmost parent HomeDistanceShowIcon of field HomeDistanceShowIcon */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCESHOWICON_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field HomeDistanceShowIcon */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCESHOWICON_MAXOPTVAL 1
+/* Ensure field HomeDistanceShowIcon contains valid data */
+static inline bool OnScreenDisplayPageSettings3HomeDistanceShowIconIsValid( uint8_t CurrentHomeDistanceShowIcon ) { return CurrentHomeDistanceShowIcon < ONSCREENDISPLAYPAGESETTINGS3_HOMEDISTANCESHOWICON_MAXOPTVAL; }
+// Field HomeArrow information
+/* Enumeration options for field HomeArrow */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_HOMEARROW_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_HOMEARROW_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3HomeArrowOptions;
+/* Max value of any option in topmost parent HomeArrow of field HomeArrow */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEARROW_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field HomeArrow */
+#define ONSCREENDISPLAYPAGESETTINGS3_HOMEARROW_MAXOPTVAL 1
+/* Ensure field HomeArrow contains valid data */
+static inline bool OnScreenDisplayPageSettings3HomeArrowIsValid( uint8_t CurrentHomeArrow ) { return CurrentHomeArrow < ONSCREENDISPLAYPAGESETTINGS3_HOMEARROW_MAXOPTVAL; }
+// Field Map information
+/* Enumeration options for field Map */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_MAP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_MAP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3MapOptions;
+/* Max value of any option in topmost parent Map of field Map */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAP_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Map */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAP_MAXOPTVAL 1
+/* Ensure field Map contains valid data */
+static inline bool OnScreenDisplayPageSettings3MapIsValid( uint8_t CurrentMap ) { return CurrentMap < ONSCREENDISPLAYPAGESETTINGS3_MAP_MAXOPTVAL; }
+// Field MapCenterMode information
+/* Enumeration options for field MapCenterMode */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_MAPCENTERMODE_UAV=0, ONSCREENDISPLAYPAGESETTINGS3_MAPCENTERMODE_HOME=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3MapCenterModeOptions;
+/* Max value of any option in topmost parent MapCenterMode of field MapCenterMode */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPCENTERMODE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field MapCenterMode */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPCENTERMODE_MAXOPTVAL 1
+/* Ensure field MapCenterMode contains valid data */
+static inline bool OnScreenDisplayPageSettings3MapCenterModeIsValid( uint8_t CurrentMapCenterMode ) { return CurrentMapCenterMode < ONSCREENDISPLAYPAGESETTINGS3_MAPCENTERMODE_MAXOPTVAL; }
+// Field MapShowWp information
+/* Enumeration options for field MapShowWp */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWWP_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWWP_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3MapShowWpOptions;
+/* Max value of any option in topmost parent MapShowWp of field MapShowWp */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWWP_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field MapShowWp */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWWP_MAXOPTVAL 1
+/* Ensure field MapShowWp contains valid data */
+static inline bool OnScreenDisplayPageSettings3MapShowWpIsValid( uint8_t CurrentMapShowWp ) { return CurrentMapShowWp < ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWWP_MAXOPTVAL; }
+// Field MapShowUavHome information
+/* Enumeration options for field MapShowUavHome */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWUAVHOME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWUAVHOME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3MapShowUavHomeOptions;
+/* Max value of any option in topmost parent MapShowUavHome of field MapShowUavHome */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWUAVHOME_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field MapShowUavHome */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWUAVHOME_MAXOPTVAL 1
+/* Ensure field MapShowUavHome contains valid data */
+static inline bool OnScreenDisplayPageSettings3MapShowUavHomeIsValid( uint8_t CurrentMapShowUavHome ) { return CurrentMapShowUavHome < ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWUAVHOME_MAXOPTVAL; }
+// Field MapShowTablet information
+/* Enumeration options for field MapShowTablet */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWTABLET_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWTABLET_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3MapShowTabletOptions;
+/* Max value of any option in topmost parent MapShowTablet of field MapShowTablet */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWTABLET_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field MapShowTablet */
+#define ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWTABLET_MAXOPTVAL 1
+/* Ensure field MapShowTablet contains valid data */
+static inline bool OnScreenDisplayPageSettings3MapShowTabletIsValid( uint8_t CurrentMapShowTablet ) { return CurrentMapShowTablet < ONSCREENDISPLAYPAGESETTINGS3_MAPSHOWTABLET_MAXOPTVAL; }
+// Field Rssi information
+/* Enumeration options for field Rssi */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_RSSI_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_RSSI_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3RssiOptions;
+/* Max value of any option in topmost parent Rssi of field Rssi */
+#define ONSCREENDISPLAYPAGESETTINGS3_RSSI_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Rssi */
+#define ONSCREENDISPLAYPAGESETTINGS3_RSSI_MAXOPTVAL 1
+/* Ensure field Rssi contains valid data */
+static inline bool OnScreenDisplayPageSettings3RssiIsValid( uint8_t CurrentRssi ) { return CurrentRssi < ONSCREENDISPLAYPAGESETTINGS3_RSSI_MAXOPTVAL; }
+// Field RssiFont information
+/* Enumeration options for field RssiFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_RSSIFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_RSSIFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_RSSIFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3RssiFontOptions;
+/* Max value of any option in topmost parent RssiFont of field RssiFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_RSSIFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field RssiFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_RSSIFONT_MAXOPTVAL 2
+/* Ensure field RssiFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3RssiFontIsValid( uint8_t CurrentRssiFont ) { return CurrentRssiFont < ONSCREENDISPLAYPAGESETTINGS3_RSSIFONT_MAXOPTVAL; }
+// Field RssiShowIcon information
+/* Enumeration options for field RssiShowIcon */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_RSSISHOWICON_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_RSSISHOWICON_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3RssiShowIconOptions;
+/* Max value of any option in topmost parent RssiShowIcon of field RssiShowIcon */
+#define ONSCREENDISPLAYPAGESETTINGS3_RSSISHOWICON_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field RssiShowIcon */
+#define ONSCREENDISPLAYPAGESETTINGS3_RSSISHOWICON_MAXOPTVAL 1
+/* Ensure field RssiShowIcon contains valid data */
+static inline bool OnScreenDisplayPageSettings3RssiShowIconIsValid( uint8_t CurrentRssiShowIcon ) { return CurrentRssiShowIcon < ONSCREENDISPLAYPAGESETTINGS3_RSSISHOWICON_MAXOPTVAL; }
+// Field SpeedScale information
+/* Enumeration options for field SpeedScale */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedScaleOptions;
+/* Max value of any option in topmost parent SpeedScale of field SpeedScale */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field SpeedScale */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALE_MAXOPTVAL 1
+/* Ensure field SpeedScale contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedScaleIsValid( uint8_t CurrentSpeedScale ) { return CurrentSpeedScale < ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALE_MAXOPTVAL; }
+// Field SpeedScaleAlign information
+/* Enumeration options for field SpeedScaleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALEALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedScaleAlignOptions;
+/* Max value of any option in topmost parent SpeedScaleAlign of field SpeedScaleAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALEALIGN_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field SpeedScaleAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALEALIGN_MAXOPTVAL 1
+/* Ensure field SpeedScaleAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedScaleAlignIsValid( uint8_t CurrentSpeedScaleAlign ) { return CurrentSpeedScaleAlign < ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALEALIGN_MAXOPTVAL; }
+// Field SpeedScaleSource information
+/* Enumeration options for field SpeedScaleSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALESOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALESOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALESOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedScaleSourceOptions;
+/* Max value of any option in topmost parent SpeedScaleSource of field SpeedScaleSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALESOURCE_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field SpeedScaleSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALESOURCE_MAXOPTVAL 2
+/* Ensure field SpeedScaleSource contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedScaleSourceIsValid( uint8_t CurrentSpeedScaleSource ) { return CurrentSpeedScaleSource < ONSCREENDISPLAYPAGESETTINGS3_SPEEDSCALESOURCE_MAXOPTVAL; }
+// Field SpeedNumeric information
+/* Enumeration options for field SpeedNumeric */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERIC_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERIC_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedNumericOptions;
+/* Max value of any option in topmost parent SpeedNumeric of field SpeedNumeric */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERIC_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field SpeedNumeric */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERIC_MAXOPTVAL 1
+/* Ensure field SpeedNumeric contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedNumericIsValid( uint8_t CurrentSpeedNumeric ) { return CurrentSpeedNumeric < ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERIC_MAXOPTVAL; }
+// Field SpeedNumericFont information
+/* Enumeration options for field SpeedNumericFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedNumericFontOptions;
+/* Max value of any option in topmost parent SpeedNumericFont of field SpeedNumericFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field SpeedNumericFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICFONT_MAXOPTVAL 2
+/* Ensure field SpeedNumericFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedNumericFontIsValid( uint8_t CurrentSpeedNumericFont ) { return CurrentSpeedNumericFont < ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICFONT_MAXOPTVAL; }
+// Field SpeedNumericAlign information
+/* Enumeration options for field SpeedNumericAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICALIGN_RIGHT=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedNumericAlignOptions;
+/* Max value of any option in topmost parent SpeedNumericAlign of field SpeedNumericAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICALIGN_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field SpeedNumericAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICALIGN_MAXOPTVAL 1
+/* Ensure field SpeedNumericAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedNumericAlignIsValid( uint8_t CurrentSpeedNumericAlign ) { return CurrentSpeedNumericAlign < ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICALIGN_MAXOPTVAL; }
+// Field SpeedNumericSource information
+/* Enumeration options for field SpeedNumericSource */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICSOURCE_GPS=0, ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICSOURCE_NAV=1, ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICSOURCE_AIRSPEED=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3SpeedNumericSourceOptions;
+/* Max value of any option in topmost parent SpeedNumericSource of field SpeedNumericSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICSOURCE_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field SpeedNumericSource */
+#define ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICSOURCE_MAXOPTVAL 2
+/* Ensure field SpeedNumericSource contains valid data */
+static inline bool OnScreenDisplayPageSettings3SpeedNumericSourceIsValid( uint8_t CurrentSpeedNumericSource ) { return CurrentSpeedNumericSource < ONSCREENDISPLAYPAGESETTINGS3_SPEEDNUMERICSOURCE_MAXOPTVAL; }
+// Field Time information
+/* Enumeration options for field Time */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_TIME_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_TIME_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3TimeOptions;
+/* Max value of any option in topmost parent Time of field Time */
+#define ONSCREENDISPLAYPAGESETTINGS3_TIME_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Time */
+#define ONSCREENDISPLAYPAGESETTINGS3_TIME_MAXOPTVAL 1
+/* Ensure field Time contains valid data */
+static inline bool OnScreenDisplayPageSettings3TimeIsValid( uint8_t CurrentTime ) { return CurrentTime < ONSCREENDISPLAYPAGESETTINGS3_TIME_MAXOPTVAL; }
+// Field TimeFont information
+/* Enumeration options for field TimeFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_TIMEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_TIMEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_TIMEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3TimeFontOptions;
+/* Max value of any option in topmost parent TimeFont of field TimeFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_TIMEFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field TimeFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_TIMEFONT_MAXOPTVAL 2
+/* Ensure field TimeFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3TimeFontIsValid( uint8_t CurrentTimeFont ) { return CurrentTimeFont < ONSCREENDISPLAYPAGESETTINGS3_TIMEFONT_MAXOPTVAL; }
+// Field TimeAlign information
+/* Enumeration options for field TimeAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_TIMEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_TIMEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_TIMEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3TimeAlignOptions;
+/* Max value of any option in topmost parent TimeAlign of field TimeAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_TIMEALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field TimeAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_TIMEALIGN_MAXOPTVAL 2
+/* Ensure field TimeAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3TimeAlignIsValid( uint8_t CurrentTimeAlign ) { return CurrentTimeAlign < ONSCREENDISPLAYPAGESETTINGS3_TIMEALIGN_MAXOPTVAL; }
+// Field Throttle information
+/* Enumeration options for field Throttle */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_THROTTLE_DISABLED=0, ONSCREENDISPLAYPAGESETTINGS3_THROTTLE_ENABLED=1 }  __attribute__((packed)) OnScreenDisplayPageSettings3ThrottleOptions;
+/* Max value of any option in topmost parent Throttle of field Throttle */
+#define ONSCREENDISPLAYPAGESETTINGS3_THROTTLE_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field Throttle */
+#define ONSCREENDISPLAYPAGESETTINGS3_THROTTLE_MAXOPTVAL 1
+/* Ensure field Throttle contains valid data */
+static inline bool OnScreenDisplayPageSettings3ThrottleIsValid( uint8_t CurrentThrottle ) { return CurrentThrottle < ONSCREENDISPLAYPAGESETTINGS3_THROTTLE_MAXOPTVAL; }
+// Field ThrottleFont information
+/* Enumeration options for field ThrottleFont */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_THROTTLEFONT_SMALL=0, ONSCREENDISPLAYPAGESETTINGS3_THROTTLEFONT_NORMAL=1, ONSCREENDISPLAYPAGESETTINGS3_THROTTLEFONT_LARGE=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3ThrottleFontOptions;
+/* Max value of any option in topmost parent ThrottleFont of field ThrottleFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_THROTTLEFONT_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field ThrottleFont */
+#define ONSCREENDISPLAYPAGESETTINGS3_THROTTLEFONT_MAXOPTVAL 2
+/* Ensure field ThrottleFont contains valid data */
+static inline bool OnScreenDisplayPageSettings3ThrottleFontIsValid( uint8_t CurrentThrottleFont ) { return CurrentThrottleFont < ONSCREENDISPLAYPAGESETTINGS3_THROTTLEFONT_MAXOPTVAL; }
+// Field ThrottleAlign information
+/* Enumeration options for field ThrottleAlign */
+typedef enum { ONSCREENDISPLAYPAGESETTINGS3_THROTTLEALIGN_LEFT=0, ONSCREENDISPLAYPAGESETTINGS3_THROTTLEALIGN_CENTER=1, ONSCREENDISPLAYPAGESETTINGS3_THROTTLEALIGN_RIGHT=2 }  __attribute__((packed)) OnScreenDisplayPageSettings3ThrottleAlignOptions;
+/* Max value of any option in topmost parent ThrottleAlign of field ThrottleAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_THROTTLEALIGN_GLOBAL_MAXOPTVAL 2
+/* Max value of any option in field ThrottleAlign */
+#define ONSCREENDISPLAYPAGESETTINGS3_THROTTLEALIGN_MAXOPTVAL 2
+/* Ensure field ThrottleAlign contains valid data */
+static inline bool OnScreenDisplayPageSettings3ThrottleAlignIsValid( uint8_t CurrentThrottleAlign ) { return CurrentThrottleAlign < ONSCREENDISPLAYPAGESETTINGS3_THROTTLEALIGN_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void OnScreenDisplayPageSettings3AlarmPosXSet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettings3AlarmPosXGet( int16_t *NewAlarmPosX );
+extern void OnScreenDisplayPageSettings3AlarmPosYSet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettings3AlarmPosYGet( int16_t *NewAlarmPosY );
+extern void OnScreenDisplayPageSettings3AltitudeScalePosSet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettings3AltitudeScalePosGet( int16_t *NewAltitudeScalePos );
+extern void OnScreenDisplayPageSettings3AltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettings3AltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX );
+extern void OnScreenDisplayPageSettings3AltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettings3AltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY );
+extern void OnScreenDisplayPageSettings3ArmStatusPosXSet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettings3ArmStatusPosXGet( int16_t *NewArmStatusPosX );
+extern void OnScreenDisplayPageSettings3ArmStatusPosYSet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettings3ArmStatusPosYGet( int16_t *NewArmStatusPosY );
+extern void OnScreenDisplayPageSettings3BatteryVoltPosXSet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettings3BatteryVoltPosXGet( int16_t *NewBatteryVoltPosX );
+extern void OnScreenDisplayPageSettings3BatteryVoltPosYSet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettings3BatteryVoltPosYGet( int16_t *NewBatteryVoltPosY );
+extern void OnScreenDisplayPageSettings3BatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettings3BatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX );
+extern void OnScreenDisplayPageSettings3BatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettings3BatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY );
+extern void OnScreenDisplayPageSettings3BatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettings3BatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX );
+extern void OnScreenDisplayPageSettings3BatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettings3BatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY );
+extern void OnScreenDisplayPageSettings3BatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettings3BatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX );
+extern void OnScreenDisplayPageSettings3BatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettings3BatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY );
+extern void OnScreenDisplayPageSettings3ClimbRatePosXSet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettings3ClimbRatePosXGet( int16_t *NewClimbRatePosX );
+extern void OnScreenDisplayPageSettings3ClimbRatePosYSet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettings3ClimbRatePosYGet( int16_t *NewClimbRatePosY );
+extern void OnScreenDisplayPageSettings3CompassPosSet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettings3CompassPosGet( int16_t *NewCompassPos );
+extern void OnScreenDisplayPageSettings3CpuPosXSet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettings3CpuPosXGet( int16_t *NewCpuPosX );
+extern void OnScreenDisplayPageSettings3CpuPosYSet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettings3CpuPosYGet( int16_t *NewCpuPosY );
+extern void OnScreenDisplayPageSettings3CustomTextPosXSet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettings3CustomTextPosXGet( int16_t *NewCustomTextPosX );
+extern void OnScreenDisplayPageSettings3CustomTextPosYSet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettings3CustomTextPosYGet( int16_t *NewCustomTextPosY );
+extern void OnScreenDisplayPageSettings3FlightModePosXSet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettings3FlightModePosXGet( int16_t *NewFlightModePosX );
+extern void OnScreenDisplayPageSettings3FlightModePosYSet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettings3FlightModePosYGet( int16_t *NewFlightModePosY );
+extern void OnScreenDisplayPageSettings3GForcePosXSet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettings3GForcePosXGet( int16_t *NewGForcePosX );
+extern void OnScreenDisplayPageSettings3GForcePosYSet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettings3GForcePosYGet( int16_t *NewGForcePosY );
+extern void OnScreenDisplayPageSettings3GpsStatusPosXSet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettings3GpsStatusPosXGet( int16_t *NewGpsStatusPosX );
+extern void OnScreenDisplayPageSettings3GpsStatusPosYSet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettings3GpsStatusPosYGet( int16_t *NewGpsStatusPosY );
+extern void OnScreenDisplayPageSettings3GpsLatPosXSet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettings3GpsLatPosXGet( int16_t *NewGpsLatPosX );
+extern void OnScreenDisplayPageSettings3GpsLatPosYSet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettings3GpsLatPosYGet( int16_t *NewGpsLatPosY );
+extern void OnScreenDisplayPageSettings3GpsLonPosXSet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettings3GpsLonPosXGet( int16_t *NewGpsLonPosX );
+extern void OnScreenDisplayPageSettings3GpsLonPosYSet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettings3GpsLonPosYGet( int16_t *NewGpsLonPosY );
+extern void OnScreenDisplayPageSettings3GpsMgrsPosXSet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettings3GpsMgrsPosXGet( int16_t *NewGpsMgrsPosX );
+extern void OnScreenDisplayPageSettings3GpsMgrsPosYSet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettings3GpsMgrsPosYGet( int16_t *NewGpsMgrsPosY );
+extern void OnScreenDisplayPageSettings3HomeDistancePosXSet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettings3HomeDistancePosXGet( int16_t *NewHomeDistancePosX );
+extern void OnScreenDisplayPageSettings3HomeDistancePosYSet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettings3HomeDistancePosYGet( int16_t *NewHomeDistancePosY );
+extern void OnScreenDisplayPageSettings3HomeArrowPosXSet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettings3HomeArrowPosXGet( int16_t *NewHomeArrowPosX );
+extern void OnScreenDisplayPageSettings3HomeArrowPosYSet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettings3HomeArrowPosYGet( int16_t *NewHomeArrowPosY );
+extern void OnScreenDisplayPageSettings3MapWidthMetersSet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettings3MapWidthMetersGet( int16_t *NewMapWidthMeters );
+extern void OnScreenDisplayPageSettings3MapWidthPixelsSet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettings3MapWidthPixelsGet( int16_t *NewMapWidthPixels );
+extern void OnScreenDisplayPageSettings3MapHeightMetersSet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettings3MapHeightMetersGet( int16_t *NewMapHeightMeters );
+extern void OnScreenDisplayPageSettings3MapHeightPixelsSet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettings3MapHeightPixelsGet( int16_t *NewMapHeightPixels );
+extern void OnScreenDisplayPageSettings3RssiPosXSet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettings3RssiPosXGet( int16_t *NewRssiPosX );
+extern void OnScreenDisplayPageSettings3RssiPosYSet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettings3RssiPosYGet( int16_t *NewRssiPosY );
+extern void OnScreenDisplayPageSettings3SpeedScalePosSet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettings3SpeedScalePosGet( int16_t *NewSpeedScalePos );
+extern void OnScreenDisplayPageSettings3SpeedNumericPosXSet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettings3SpeedNumericPosXGet( int16_t *NewSpeedNumericPosX );
+extern void OnScreenDisplayPageSettings3SpeedNumericPosYSet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettings3SpeedNumericPosYGet( int16_t *NewSpeedNumericPosY );
+extern void OnScreenDisplayPageSettings3TimePosXSet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettings3TimePosXGet( int16_t *NewTimePosX );
+extern void OnScreenDisplayPageSettings3TimePosYSet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettings3TimePosYGet( int16_t *NewTimePosY );
+extern void OnScreenDisplayPageSettings3ThrottlePosXSet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettings3ThrottlePosXGet( int16_t *NewThrottlePosX );
+extern void OnScreenDisplayPageSettings3ThrottlePosYSet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettings3ThrottlePosYGet( int16_t *NewThrottlePosY );
+extern void OnScreenDisplayPageSettings3AlarmSet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettings3AlarmGet( uint8_t *NewAlarm );
+extern void OnScreenDisplayPageSettings3AlarmFontSet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettings3AlarmFontGet( uint8_t *NewAlarmFont );
+extern void OnScreenDisplayPageSettings3AlarmAlignSet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettings3AlarmAlignGet( uint8_t *NewAlarmAlign );
+extern void OnScreenDisplayPageSettings3AltitudeScaleSet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettings3AltitudeScaleGet( uint8_t *NewAltitudeScale );
+extern void OnScreenDisplayPageSettings3AltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettings3AltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign );
+extern void OnScreenDisplayPageSettings3AltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettings3AltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource );
+extern void OnScreenDisplayPageSettings3AltitudeNumericSet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettings3AltitudeNumericGet( uint8_t *NewAltitudeNumeric );
+extern void OnScreenDisplayPageSettings3AltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettings3AltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign );
+extern void OnScreenDisplayPageSettings3AltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettings3AltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont );
+extern void OnScreenDisplayPageSettings3AltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettings3AltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource );
+extern void OnScreenDisplayPageSettings3ArmStatusSet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettings3ArmStatusGet( uint8_t *NewArmStatus );
+extern void OnScreenDisplayPageSettings3ArmStatusFontSet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettings3ArmStatusFontGet( uint8_t *NewArmStatusFont );
+extern void OnScreenDisplayPageSettings3ArmStatusAlignSet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettings3ArmStatusAlignGet( uint8_t *NewArmStatusAlign );
+extern void OnScreenDisplayPageSettings3ArtificialHorizonSet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettings3ArtificialHorizonGet( uint8_t *NewArtificialHorizon );
+extern void OnScreenDisplayPageSettings3ArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettings3ArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch );
+extern void OnScreenDisplayPageSettings3ArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettings3ArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps );
+extern void OnScreenDisplayPageSettings3BatteryVoltSet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettings3BatteryVoltGet( uint8_t *NewBatteryVolt );
+extern void OnScreenDisplayPageSettings3BatteryVoltFontSet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettings3BatteryVoltFontGet( uint8_t *NewBatteryVoltFont );
+extern void OnScreenDisplayPageSettings3BatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettings3BatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign );
+extern void OnScreenDisplayPageSettings3BatteryCurrentSet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettings3BatteryCurrentGet( uint8_t *NewBatteryCurrent );
+extern void OnScreenDisplayPageSettings3BatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettings3BatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont );
+extern void OnScreenDisplayPageSettings3BatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettings3BatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign );
+extern void OnScreenDisplayPageSettings3BatteryConsumedSet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettings3BatteryConsumedGet( uint8_t *NewBatteryConsumed );
+extern void OnScreenDisplayPageSettings3BatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettings3BatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont );
+extern void OnScreenDisplayPageSettings3BatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettings3BatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign );
+extern void OnScreenDisplayPageSettings3BatteryChargeStateSet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettings3BatteryChargeStateGet( uint8_t *NewBatteryChargeState );
+extern void OnScreenDisplayPageSettings3CenterMarkSet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettings3CenterMarkGet( uint8_t *NewCenterMark );
+extern void OnScreenDisplayPageSettings3ClimbRateSet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettings3ClimbRateGet( uint8_t *NewClimbRate );
+extern void OnScreenDisplayPageSettings3ClimbRateFontSet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettings3ClimbRateFontGet( uint8_t *NewClimbRateFont );
+extern void OnScreenDisplayPageSettings3ClimbRateAlignSet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettings3ClimbRateAlignGet( uint8_t *NewClimbRateAlign );
+extern void OnScreenDisplayPageSettings3CompassSet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettings3CompassGet( uint8_t *NewCompass );
+extern void OnScreenDisplayPageSettings3CompassHomeDirSet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettings3CompassHomeDirGet( uint8_t *NewCompassHomeDir );
+extern void OnScreenDisplayPageSettings3CpuSet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettings3CpuGet( uint8_t *NewCpu );
+extern void OnScreenDisplayPageSettings3CpuFontSet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettings3CpuFontGet( uint8_t *NewCpuFont );
+extern void OnScreenDisplayPageSettings3CpuAlignSet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettings3CpuAlignGet( uint8_t *NewCpuAlign );
+extern void OnScreenDisplayPageSettings3CustomTextSet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettings3CustomTextGet( uint8_t *NewCustomText );
+extern void OnScreenDisplayPageSettings3CustomTextFontSet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettings3CustomTextFontGet( uint8_t *NewCustomTextFont );
+extern void OnScreenDisplayPageSettings3CustomTextAlignSet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettings3CustomTextAlignGet( uint8_t *NewCustomTextAlign );
+extern void OnScreenDisplayPageSettings3FlightModeSet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettings3FlightModeGet( uint8_t *NewFlightMode );
+extern void OnScreenDisplayPageSettings3FlightModeFontSet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettings3FlightModeFontGet( uint8_t *NewFlightModeFont );
+extern void OnScreenDisplayPageSettings3FlightModeAlignSet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettings3FlightModeAlignGet( uint8_t *NewFlightModeAlign );
+extern void OnScreenDisplayPageSettings3GForceSet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettings3GForceGet( uint8_t *NewGForce );
+extern void OnScreenDisplayPageSettings3GForceFontSet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettings3GForceFontGet( uint8_t *NewGForceFont );
+extern void OnScreenDisplayPageSettings3GForceAlignSet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettings3GForceAlignGet( uint8_t *NewGForceAlign );
+extern void OnScreenDisplayPageSettings3GpsStatusSet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettings3GpsStatusGet( uint8_t *NewGpsStatus );
+extern void OnScreenDisplayPageSettings3GpsStatusFontSet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettings3GpsStatusFontGet( uint8_t *NewGpsStatusFont );
+extern void OnScreenDisplayPageSettings3GpsLatSet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettings3GpsLatGet( uint8_t *NewGpsLat );
+extern void OnScreenDisplayPageSettings3GpsLatFontSet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettings3GpsLatFontGet( uint8_t *NewGpsLatFont );
+extern void OnScreenDisplayPageSettings3GpsLatAlignSet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettings3GpsLatAlignGet( uint8_t *NewGpsLatAlign );
+extern void OnScreenDisplayPageSettings3GpsLonSet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettings3GpsLonGet( uint8_t *NewGpsLon );
+extern void OnScreenDisplayPageSettings3GpsLonFontSet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettings3GpsLonFontGet( uint8_t *NewGpsLonFont );
+extern void OnScreenDisplayPageSettings3GpsLonAlignSet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettings3GpsLonAlignGet( uint8_t *NewGpsLonAlign );
+extern void OnScreenDisplayPageSettings3GpsMgrsSet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettings3GpsMgrsGet( uint8_t *NewGpsMgrs );
+extern void OnScreenDisplayPageSettings3GpsMgrsFontSet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettings3GpsMgrsFontGet( uint8_t *NewGpsMgrsFont );
+extern void OnScreenDisplayPageSettings3GpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettings3GpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign );
+extern void OnScreenDisplayPageSettings3HomeDistanceSet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettings3HomeDistanceGet( uint8_t *NewHomeDistance );
+extern void OnScreenDisplayPageSettings3HomeDistanceFontSet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettings3HomeDistanceFontGet( uint8_t *NewHomeDistanceFont );
+extern void OnScreenDisplayPageSettings3HomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettings3HomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon );
+extern void OnScreenDisplayPageSettings3HomeArrowSet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettings3HomeArrowGet( uint8_t *NewHomeArrow );
+extern void OnScreenDisplayPageSettings3MapSet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettings3MapGet( uint8_t *NewMap );
+extern void OnScreenDisplayPageSettings3MapCenterModeSet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettings3MapCenterModeGet( uint8_t *NewMapCenterMode );
+extern void OnScreenDisplayPageSettings3MapShowWpSet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettings3MapShowWpGet( uint8_t *NewMapShowWp );
+extern void OnScreenDisplayPageSettings3MapShowUavHomeSet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettings3MapShowUavHomeGet( uint8_t *NewMapShowUavHome );
+extern void OnScreenDisplayPageSettings3MapShowTabletSet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettings3MapShowTabletGet( uint8_t *NewMapShowTablet );
+extern void OnScreenDisplayPageSettings3RssiSet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettings3RssiGet( uint8_t *NewRssi );
+extern void OnScreenDisplayPageSettings3RssiFontSet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettings3RssiFontGet( uint8_t *NewRssiFont );
+extern void OnScreenDisplayPageSettings3RssiShowIconSet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettings3RssiShowIconGet( uint8_t *NewRssiShowIcon );
+extern void OnScreenDisplayPageSettings3SpeedScaleSet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettings3SpeedScaleGet( uint8_t *NewSpeedScale );
+extern void OnScreenDisplayPageSettings3SpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettings3SpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign );
+extern void OnScreenDisplayPageSettings3SpeedScaleSourceSet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettings3SpeedScaleSourceGet( uint8_t *NewSpeedScaleSource );
+extern void OnScreenDisplayPageSettings3SpeedNumericSet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettings3SpeedNumericGet( uint8_t *NewSpeedNumeric );
+extern void OnScreenDisplayPageSettings3SpeedNumericFontSet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettings3SpeedNumericFontGet( uint8_t *NewSpeedNumericFont );
+extern void OnScreenDisplayPageSettings3SpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettings3SpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign );
+extern void OnScreenDisplayPageSettings3SpeedNumericSourceSet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettings3SpeedNumericSourceGet( uint8_t *NewSpeedNumericSource );
+extern void OnScreenDisplayPageSettings3TimeSet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettings3TimeGet( uint8_t *NewTime );
+extern void OnScreenDisplayPageSettings3TimeFontSet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettings3TimeFontGet( uint8_t *NewTimeFont );
+extern void OnScreenDisplayPageSettings3TimeAlignSet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettings3TimeAlignGet( uint8_t *NewTimeAlign );
+extern void OnScreenDisplayPageSettings3ThrottleSet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettings3ThrottleGet( uint8_t *NewThrottle );
+extern void OnScreenDisplayPageSettings3ThrottleFontSet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettings3ThrottleFontGet( uint8_t *NewThrottleFont );
+extern void OnScreenDisplayPageSettings3ThrottleAlignSet( uint8_t *NewThrottleAlign );
+extern void OnScreenDisplayPageSettings3ThrottleAlignGet( uint8_t *NewThrottleAlign );
+
+
+#endif // ONSCREENDISPLAYPAGESETTINGS3_H
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,1310 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       onscreendisplaypagesettings4.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OnScreenDisplayPageSettings4 object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaypagesettings4.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "onscreendisplaypagesettings4.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OnScreenDisplayPageSettings4Initialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ONSCREENDISPLAYPAGESETTINGS4_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ONSCREENDISPLAYPAGESETTINGS4_OBJID,
+			ONSCREENDISPLAYPAGESETTINGS4_ISSINGLEINST, ONSCREENDISPLAYPAGESETTINGS4_ISSETTINGS, ONSCREENDISPLAYPAGESETTINGS4_ISSEQLOCKED,
+			ONSCREENDISPLAYPAGESETTINGS4_NUMBYTES, &OnScreenDisplayPageSettings4SetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OnScreenDisplayPageSettings4SetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OnScreenDisplayPageSettings4Data data = {};
+
+	data.AlarmPosX = 0;
+	data.AlarmPosY = 214;
+	data.AltitudeScalePos = 350;
+	data.AltitudeNumericPosX = 280;
+	data.AltitudeNumericPosY = 200;
+	data.ArmStatusPosX = 0;
+	data.ArmStatusPosY = 24;
+	data.BatteryVoltPosX = 350;
+	data.BatteryVoltPosY = 4;
+	data.BatteryCurrentPosX = 350;
+	data.BatteryCurrentPosY = 14;
+	data.BatteryConsumedPosX = 350;
+	data.BatteryConsumedPosY = 24;
+	data.BatteryChargeStatePosX = 325;
+	data.BatteryChargeStatePosY = 38;
+	data.ClimbRatePosX = 350;
+	data.ClimbRatePosY = 200;
+	data.CompassPos = 15;
+	data.CpuPosX = 0;
+	data.CpuPosY = 204;
+	data.CustomTextPosX = 60;
+	data.CustomTextPosY = 190;
+	data.FlightModePosX = 0;
+	data.FlightModePosY = 4;
+	data.GForcePosX = 10;
+	data.GForcePosY = 40;
+	data.GpsStatusPosX = 0;
+	data.GpsStatusPosY = 230;
+	data.GpsLatPosX = 200;
+	data.GpsLatPosY = 230;
+	data.GpsLonPosX = 350;
+	data.GpsLonPosY = 230;
+	data.GpsMgrsPosX = 350;
+	data.GpsMgrsPosY = 230;
+	data.HomeDistancePosX = 180;
+	data.HomeDistancePosY = 195;
+	data.HomeArrowPosX = 240;
+	data.HomeArrowPosY = 195;
+	data.MapWidthMeters = 2000;
+	data.MapWidthPixels = 180;
+	data.MapHeightMeters = 2000;
+	data.MapHeightPixels = 140;
+	data.RssiPosX = 130;
+	data.RssiPosY = 195;
+	data.SpeedScalePos = 0;
+	data.SpeedNumericPosX = 50;
+	data.SpeedNumericPosY = 200;
+	data.TimePosX = 350;
+	data.TimePosY = 220;
+	data.ThrottlePosX = 300;
+	data.ThrottlePosY = 220;
+	data.Alarm = 1;
+	data.AlarmFont = 0;
+	data.AlarmAlign = 0;
+	data.AltitudeScale = 1;
+	data.AltitudeScaleAlign = 1;
+	data.AltitudeScaleSource = 0;
+	data.AltitudeNumeric = 0;
+	data.AltitudeNumericAlign = 0;
+	data.AltitudeNumericFont = 0;
+	data.AltitudeNumericSource = 0;
+	data.ArmStatus = 1;
+	data.ArmStatusFont = 0;
+	data.ArmStatusAlign = 0;
+	data.ArtificialHorizon = 1;
+	data.ArtificialHorizonMaxPitch = 30;
+	data.ArtificialHorizonPitchSteps = 2;
+	data.BatteryVolt = 1;
+	data.BatteryVoltFont = 0;
+	data.BatteryVoltAlign = 2;
+	data.BatteryCurrent = 1;
+	data.BatteryCurrentFont = 0;
+	data.BatteryCurrentAlign = 2;
+	data.BatteryConsumed = 1;
+	data.BatteryConsumedFont = 0;
+	data.BatteryConsumedAlign = 2;
+	data.BatteryChargeState = 1;
+	data.CenterMark = 1;
+	data.ClimbRate = 1;
+	data.ClimbRateFont = 0;
+	data.ClimbRateAlign = 2;
+	data.Compass = 1;
+	data.CompassHomeDir = 1;
+	data.Cpu = 0;
+	data.CpuFont = 0;
+	data.CpuAlign = 0;
+	data.CustomText = 0;
+	data.CustomTextFont = 0;
+	data.CustomTextAlign = 0;
+	data.FlightMode = 1;
+	data.FlightModeFont = 0;
+	data.FlightModeAlign = 0;
+	data.GForce = 1;
+	data.GForceFont = 0;
+	data.GForceAlign = 0;
+	data.GpsStatus = 1;
+	data.GpsStatusFont = 0;
+	data.GpsLat = 1;
+	data.GpsLatFont = 0;
+	data.GpsLatAlign = 0;
+	data.GpsLon = 1;
+	data.GpsLonFont = 0;
+	data.GpsLonAlign = 2;
+	data.GpsMgrs = 0;
+	data.GpsMgrsFont = 0;
+	data.GpsMgrsAlign = 2;
+	data.HomeDistance = 1;
+	data.HomeDistanceFont = 0;
+	data.HomeDistanceShowIcon = 1;
+	data.HomeArrow = 1;
+	data.Map = 0;
+	data.MapCenterMode = 0;
+	data.MapShowWp = 0;
+	data.MapShowUavHome = 1;
+	data.MapShowTablet = 0;
+	data.Rssi = 1;
+	data.RssiFont = 0;
+	data.RssiShowIcon = 1;
+	data.SpeedScale = 1;
+	data.SpeedScaleAlign = 0;
+	data.SpeedScaleSource = 0;
+	data.SpeedNumeric = 1;
+	data.SpeedNumericFont = 0;
+	data.SpeedNumericAlign = 0;
+	data.SpeedNumericSource = 0;
+	data.Time = 1;
+	data.TimeFont = 0;
+	data.TimeAlign = 2;
+	data.Throttle = 0;
+	data.ThrottleFont = 0;
+	data.ThrottleAlign = 2;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OnScreenDisplayPageSettings4SetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OnScreenDisplayPageSettings4SetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OnScreenDisplayPageSettings4SetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OnScreenDisplayPageSettings4SetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OnScreenDisplayPageSettings4Handle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OnScreenDisplayPageSettings4AlarmPosXSet( int16_t *NewAlarmPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettings4Data, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AlarmPosXGet( int16_t *NewAlarmPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmPosX, offsetof( OnScreenDisplayPageSettings4Data, AlarmPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AlarmPosYSet( int16_t *NewAlarmPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettings4Data, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AlarmPosYGet( int16_t *NewAlarmPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmPosY, offsetof( OnScreenDisplayPageSettings4Data, AlarmPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScalePosSet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScalePosGet( int16_t *NewAltitudeScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScalePos, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericPosXSet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericPosXGet( int16_t *NewAltitudeNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericPosX, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericPosYSet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericPosYGet( int16_t *NewAltitudeNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericPosY, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusPosXSet( int16_t *NewArmStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusPosXGet( int16_t *NewArmStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusPosX, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusPosYSet( int16_t *NewArmStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusPosYGet( int16_t *NewArmStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusPosY, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltPosXSet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltPosXGet( int16_t *NewBatteryVoltPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltPosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltPosYSet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltPosYGet( int16_t *NewBatteryVoltPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltPosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentPosXSet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentPosXGet( int16_t *NewBatteryCurrentPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentPosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentPosYSet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentPosYGet( int16_t *NewBatteryCurrentPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentPosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedPosXSet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedPosXGet( int16_t *NewBatteryConsumedPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedPosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedPosYSet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedPosYGet( int16_t *NewBatteryConsumedPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedPosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryChargeStatePosXSet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryChargeStatePosXGet( int16_t *NewBatteryChargeStatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryChargeStatePosX, offsetof( OnScreenDisplayPageSettings4Data, BatteryChargeStatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryChargeStatePosYSet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4BatteryChargeStatePosYGet( int16_t *NewBatteryChargeStatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryChargeStatePosY, offsetof( OnScreenDisplayPageSettings4Data, BatteryChargeStatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ClimbRatePosXSet( int16_t *NewClimbRatePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettings4Data, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ClimbRatePosXGet( int16_t *NewClimbRatePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRatePosX, offsetof( OnScreenDisplayPageSettings4Data, ClimbRatePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ClimbRatePosYSet( int16_t *NewClimbRatePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettings4Data, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ClimbRatePosYGet( int16_t *NewClimbRatePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRatePosY, offsetof( OnScreenDisplayPageSettings4Data, ClimbRatePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CompassPosSet( int16_t *NewCompassPos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettings4Data, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CompassPosGet( int16_t *NewCompassPos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCompassPos, offsetof( OnScreenDisplayPageSettings4Data, CompassPos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CpuPosXSet( int16_t *NewCpuPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettings4Data, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CpuPosXGet( int16_t *NewCpuPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuPosX, offsetof( OnScreenDisplayPageSettings4Data, CpuPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CpuPosYSet( int16_t *NewCpuPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettings4Data, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CpuPosYGet( int16_t *NewCpuPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuPosY, offsetof( OnScreenDisplayPageSettings4Data, CpuPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CustomTextPosXSet( int16_t *NewCustomTextPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettings4Data, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CustomTextPosXGet( int16_t *NewCustomTextPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextPosX, offsetof( OnScreenDisplayPageSettings4Data, CustomTextPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CustomTextPosYSet( int16_t *NewCustomTextPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettings4Data, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4CustomTextPosYGet( int16_t *NewCustomTextPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextPosY, offsetof( OnScreenDisplayPageSettings4Data, CustomTextPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4FlightModePosXSet( int16_t *NewFlightModePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettings4Data, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4FlightModePosXGet( int16_t *NewFlightModePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModePosX, offsetof( OnScreenDisplayPageSettings4Data, FlightModePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4FlightModePosYSet( int16_t *NewFlightModePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettings4Data, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4FlightModePosYGet( int16_t *NewFlightModePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModePosY, offsetof( OnScreenDisplayPageSettings4Data, FlightModePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GForcePosXSet( int16_t *NewGForcePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettings4Data, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GForcePosXGet( int16_t *NewGForcePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForcePosX, offsetof( OnScreenDisplayPageSettings4Data, GForcePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GForcePosYSet( int16_t *NewGForcePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettings4Data, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GForcePosYGet( int16_t *NewGForcePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForcePosY, offsetof( OnScreenDisplayPageSettings4Data, GForcePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusPosXSet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusPosXGet( int16_t *NewGpsStatusPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatusPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsStatusPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusPosYSet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusPosYGet( int16_t *NewGpsStatusPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatusPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsStatusPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLatPosXSet( int16_t *NewGpsLatPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLatPosXGet( int16_t *NewGpsLatPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsLatPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLatPosYSet( int16_t *NewGpsLatPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLatPosYGet( int16_t *NewGpsLatPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsLatPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLonPosXSet( int16_t *NewGpsLonPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLonPosXGet( int16_t *NewGpsLonPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsLonPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLonPosYSet( int16_t *NewGpsLonPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsLonPosYGet( int16_t *NewGpsLonPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsLonPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsPosXSet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsPosXGet( int16_t *NewGpsMgrsPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsPosX, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsPosYSet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsPosYGet( int16_t *NewGpsMgrsPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsPosY, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeDistancePosXSet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettings4Data, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeDistancePosXGet( int16_t *NewHomeDistancePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistancePosX, offsetof( OnScreenDisplayPageSettings4Data, HomeDistancePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeDistancePosYSet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettings4Data, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeDistancePosYGet( int16_t *NewHomeDistancePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistancePosY, offsetof( OnScreenDisplayPageSettings4Data, HomeDistancePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeArrowPosXSet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettings4Data, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeArrowPosXGet( int16_t *NewHomeArrowPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeArrowPosX, offsetof( OnScreenDisplayPageSettings4Data, HomeArrowPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeArrowPosYSet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettings4Data, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4HomeArrowPosYGet( int16_t *NewHomeArrowPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeArrowPosY, offsetof( OnScreenDisplayPageSettings4Data, HomeArrowPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapWidthMetersSet( int16_t *NewMapWidthMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettings4Data, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapWidthMetersGet( int16_t *NewMapWidthMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapWidthMeters, offsetof( OnScreenDisplayPageSettings4Data, MapWidthMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapWidthPixelsSet( int16_t *NewMapWidthPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettings4Data, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapWidthPixelsGet( int16_t *NewMapWidthPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapWidthPixels, offsetof( OnScreenDisplayPageSettings4Data, MapWidthPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapHeightMetersSet( int16_t *NewMapHeightMeters )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettings4Data, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapHeightMetersGet( int16_t *NewMapHeightMeters )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapHeightMeters, offsetof( OnScreenDisplayPageSettings4Data, MapHeightMeters), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapHeightPixelsSet( int16_t *NewMapHeightPixels )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettings4Data, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4MapHeightPixelsGet( int16_t *NewMapHeightPixels )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapHeightPixels, offsetof( OnScreenDisplayPageSettings4Data, MapHeightPixels), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4RssiPosXSet( int16_t *NewRssiPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettings4Data, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4RssiPosXGet( int16_t *NewRssiPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiPosX, offsetof( OnScreenDisplayPageSettings4Data, RssiPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4RssiPosYSet( int16_t *NewRssiPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettings4Data, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4RssiPosYGet( int16_t *NewRssiPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiPosY, offsetof( OnScreenDisplayPageSettings4Data, RssiPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4SpeedScalePosSet( int16_t *NewSpeedScalePos )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettings4Data, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4SpeedScalePosGet( int16_t *NewSpeedScalePos )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScalePos, offsetof( OnScreenDisplayPageSettings4Data, SpeedScalePos), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericPosXSet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericPosXGet( int16_t *NewSpeedNumericPosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericPosX, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericPosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericPosYSet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericPosYGet( int16_t *NewSpeedNumericPosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericPosY, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericPosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4TimePosXSet( int16_t *NewTimePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettings4Data, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4TimePosXGet( int16_t *NewTimePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimePosX, offsetof( OnScreenDisplayPageSettings4Data, TimePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4TimePosYSet( int16_t *NewTimePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettings4Data, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4TimePosYGet( int16_t *NewTimePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimePosY, offsetof( OnScreenDisplayPageSettings4Data, TimePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ThrottlePosXSet( int16_t *NewThrottlePosX )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettings4Data, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ThrottlePosXGet( int16_t *NewThrottlePosX )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottlePosX, offsetof( OnScreenDisplayPageSettings4Data, ThrottlePosX), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ThrottlePosYSet( int16_t *NewThrottlePosY )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettings4Data, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4ThrottlePosYGet( int16_t *NewThrottlePosY )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottlePosY, offsetof( OnScreenDisplayPageSettings4Data, ThrottlePosY), sizeof(int16_t));
+}
+void OnScreenDisplayPageSettings4AlarmSet( uint8_t *NewAlarm )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettings4Data, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AlarmGet( uint8_t *NewAlarm )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarm, offsetof( OnScreenDisplayPageSettings4Data, Alarm), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AlarmFontSet( uint8_t *NewAlarmFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettings4Data, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AlarmFontGet( uint8_t *NewAlarmFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmFont, offsetof( OnScreenDisplayPageSettings4Data, AlarmFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AlarmAlignSet( uint8_t *NewAlarmAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettings4Data, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AlarmAlignGet( uint8_t *NewAlarmAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAlarmAlign, offsetof( OnScreenDisplayPageSettings4Data, AlarmAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScaleSet( uint8_t *NewAltitudeScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScaleGet( uint8_t *NewAltitudeScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScale, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScaleAlignSet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScaleAlignGet( uint8_t *NewAltitudeScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScaleAlign, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScaleSourceSet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeScaleSourceGet( uint8_t *NewAltitudeScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeScaleSource, offsetof( OnScreenDisplayPageSettings4Data, AltitudeScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericSet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericGet( uint8_t *NewAltitudeNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumeric, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericAlignSet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericAlignGet( uint8_t *NewAltitudeNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericAlign, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericFontSet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericFontGet( uint8_t *NewAltitudeNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericFont, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericSourceSet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4AltitudeNumericSourceGet( uint8_t *NewAltitudeNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewAltitudeNumericSource, offsetof( OnScreenDisplayPageSettings4Data, AltitudeNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusSet( uint8_t *NewArmStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettings4Data, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusGet( uint8_t *NewArmStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatus, offsetof( OnScreenDisplayPageSettings4Data, ArmStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusFontSet( uint8_t *NewArmStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusFontGet( uint8_t *NewArmStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusFont, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusAlignSet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArmStatusAlignGet( uint8_t *NewArmStatusAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArmStatusAlign, offsetof( OnScreenDisplayPageSettings4Data, ArmStatusAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArtificialHorizonSet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettings4Data, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArtificialHorizonGet( uint8_t *NewArtificialHorizon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArtificialHorizon, offsetof( OnScreenDisplayPageSettings4Data, ArtificialHorizon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArtificialHorizonMaxPitchSet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettings4Data, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArtificialHorizonMaxPitchGet( uint8_t *NewArtificialHorizonMaxPitch )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArtificialHorizonMaxPitch, offsetof( OnScreenDisplayPageSettings4Data, ArtificialHorizonMaxPitch), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArtificialHorizonPitchStepsSet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettings4Data, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ArtificialHorizonPitchStepsGet( uint8_t *NewArtificialHorizonPitchSteps )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewArtificialHorizonPitchSteps, offsetof( OnScreenDisplayPageSettings4Data, ArtificialHorizonPitchSteps), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltSet( uint8_t *NewBatteryVolt )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettings4Data, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltGet( uint8_t *NewBatteryVolt )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVolt, offsetof( OnScreenDisplayPageSettings4Data, BatteryVolt), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltFontSet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltFontGet( uint8_t *NewBatteryVoltFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltFont, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltAlignSet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryVoltAlignGet( uint8_t *NewBatteryVoltAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryVoltAlign, offsetof( OnScreenDisplayPageSettings4Data, BatteryVoltAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentSet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentGet( uint8_t *NewBatteryCurrent )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrent, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrent), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentFontSet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentFontGet( uint8_t *NewBatteryCurrentFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentFont, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentAlignSet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryCurrentAlignGet( uint8_t *NewBatteryCurrentAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryCurrentAlign, offsetof( OnScreenDisplayPageSettings4Data, BatteryCurrentAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedSet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedGet( uint8_t *NewBatteryConsumed )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumed, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumed), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedFontSet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedFontGet( uint8_t *NewBatteryConsumedFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedFont, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedAlignSet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryConsumedAlignGet( uint8_t *NewBatteryConsumedAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryConsumedAlign, offsetof( OnScreenDisplayPageSettings4Data, BatteryConsumedAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryChargeStateSet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettings4Data, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4BatteryChargeStateGet( uint8_t *NewBatteryChargeState )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewBatteryChargeState, offsetof( OnScreenDisplayPageSettings4Data, BatteryChargeState), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CenterMarkSet( uint8_t *NewCenterMark )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettings4Data, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CenterMarkGet( uint8_t *NewCenterMark )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCenterMark, offsetof( OnScreenDisplayPageSettings4Data, CenterMark), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ClimbRateSet( uint8_t *NewClimbRate )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettings4Data, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ClimbRateGet( uint8_t *NewClimbRate )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRate, offsetof( OnScreenDisplayPageSettings4Data, ClimbRate), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ClimbRateFontSet( uint8_t *NewClimbRateFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettings4Data, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ClimbRateFontGet( uint8_t *NewClimbRateFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRateFont, offsetof( OnScreenDisplayPageSettings4Data, ClimbRateFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ClimbRateAlignSet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettings4Data, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ClimbRateAlignGet( uint8_t *NewClimbRateAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewClimbRateAlign, offsetof( OnScreenDisplayPageSettings4Data, ClimbRateAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CompassSet( uint8_t *NewCompass )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettings4Data, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CompassGet( uint8_t *NewCompass )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCompass, offsetof( OnScreenDisplayPageSettings4Data, Compass), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CompassHomeDirSet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettings4Data, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CompassHomeDirGet( uint8_t *NewCompassHomeDir )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCompassHomeDir, offsetof( OnScreenDisplayPageSettings4Data, CompassHomeDir), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CpuSet( uint8_t *NewCpu )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettings4Data, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CpuGet( uint8_t *NewCpu )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpu, offsetof( OnScreenDisplayPageSettings4Data, Cpu), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CpuFontSet( uint8_t *NewCpuFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettings4Data, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CpuFontGet( uint8_t *NewCpuFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuFont, offsetof( OnScreenDisplayPageSettings4Data, CpuFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CpuAlignSet( uint8_t *NewCpuAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettings4Data, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CpuAlignGet( uint8_t *NewCpuAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCpuAlign, offsetof( OnScreenDisplayPageSettings4Data, CpuAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettings4Data, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomText, offsetof( OnScreenDisplayPageSettings4Data, CustomText), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CustomTextFontSet( uint8_t *NewCustomTextFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettings4Data, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CustomTextFontGet( uint8_t *NewCustomTextFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextFont, offsetof( OnScreenDisplayPageSettings4Data, CustomTextFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CustomTextAlignSet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettings4Data, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4CustomTextAlignGet( uint8_t *NewCustomTextAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewCustomTextAlign, offsetof( OnScreenDisplayPageSettings4Data, CustomTextAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4FlightModeSet( uint8_t *NewFlightMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettings4Data, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4FlightModeGet( uint8_t *NewFlightMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightMode, offsetof( OnScreenDisplayPageSettings4Data, FlightMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4FlightModeFontSet( uint8_t *NewFlightModeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettings4Data, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4FlightModeFontGet( uint8_t *NewFlightModeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModeFont, offsetof( OnScreenDisplayPageSettings4Data, FlightModeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4FlightModeAlignSet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettings4Data, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4FlightModeAlignGet( uint8_t *NewFlightModeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewFlightModeAlign, offsetof( OnScreenDisplayPageSettings4Data, FlightModeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GForceSet( uint8_t *NewGForce )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettings4Data, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GForceGet( uint8_t *NewGForce )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForce, offsetof( OnScreenDisplayPageSettings4Data, GForce), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GForceFontSet( uint8_t *NewGForceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettings4Data, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GForceFontGet( uint8_t *NewGForceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForceFont, offsetof( OnScreenDisplayPageSettings4Data, GForceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GForceAlignSet( uint8_t *NewGForceAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettings4Data, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GForceAlignGet( uint8_t *NewGForceAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGForceAlign, offsetof( OnScreenDisplayPageSettings4Data, GForceAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusSet( uint8_t *NewGpsStatus )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettings4Data, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusGet( uint8_t *NewGpsStatus )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatus, offsetof( OnScreenDisplayPageSettings4Data, GpsStatus), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusFontSet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettings4Data, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsStatusFontGet( uint8_t *NewGpsStatusFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsStatusFont, offsetof( OnScreenDisplayPageSettings4Data, GpsStatusFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLatSet( uint8_t *NewGpsLat )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettings4Data, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLatGet( uint8_t *NewGpsLat )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLat, offsetof( OnScreenDisplayPageSettings4Data, GpsLat), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLatFontSet( uint8_t *NewGpsLatFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettings4Data, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLatFontGet( uint8_t *NewGpsLatFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatFont, offsetof( OnScreenDisplayPageSettings4Data, GpsLatFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLatAlignSet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettings4Data, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLatAlignGet( uint8_t *NewGpsLatAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLatAlign, offsetof( OnScreenDisplayPageSettings4Data, GpsLatAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLonSet( uint8_t *NewGpsLon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettings4Data, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLonGet( uint8_t *NewGpsLon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLon, offsetof( OnScreenDisplayPageSettings4Data, GpsLon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLonFontSet( uint8_t *NewGpsLonFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettings4Data, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLonFontGet( uint8_t *NewGpsLonFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonFont, offsetof( OnScreenDisplayPageSettings4Data, GpsLonFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLonAlignSet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettings4Data, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsLonAlignGet( uint8_t *NewGpsLonAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsLonAlign, offsetof( OnScreenDisplayPageSettings4Data, GpsLonAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsSet( uint8_t *NewGpsMgrs )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsGet( uint8_t *NewGpsMgrs )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrs, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrs), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsFontSet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsFontGet( uint8_t *NewGpsMgrsFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsFont, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsAlignSet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4GpsMgrsAlignGet( uint8_t *NewGpsMgrsAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewGpsMgrsAlign, offsetof( OnScreenDisplayPageSettings4Data, GpsMgrsAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeDistanceSet( uint8_t *NewHomeDistance )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettings4Data, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeDistanceGet( uint8_t *NewHomeDistance )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistance, offsetof( OnScreenDisplayPageSettings4Data, HomeDistance), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeDistanceFontSet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettings4Data, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeDistanceFontGet( uint8_t *NewHomeDistanceFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistanceFont, offsetof( OnScreenDisplayPageSettings4Data, HomeDistanceFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeDistanceShowIconSet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettings4Data, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeDistanceShowIconGet( uint8_t *NewHomeDistanceShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeDistanceShowIcon, offsetof( OnScreenDisplayPageSettings4Data, HomeDistanceShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeArrowSet( uint8_t *NewHomeArrow )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettings4Data, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4HomeArrowGet( uint8_t *NewHomeArrow )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewHomeArrow, offsetof( OnScreenDisplayPageSettings4Data, HomeArrow), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapSet( uint8_t *NewMap )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettings4Data, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapGet( uint8_t *NewMap )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMap, offsetof( OnScreenDisplayPageSettings4Data, Map), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapCenterModeSet( uint8_t *NewMapCenterMode )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettings4Data, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapCenterModeGet( uint8_t *NewMapCenterMode )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapCenterMode, offsetof( OnScreenDisplayPageSettings4Data, MapCenterMode), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapShowWpSet( uint8_t *NewMapShowWp )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettings4Data, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapShowWpGet( uint8_t *NewMapShowWp )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapShowWp, offsetof( OnScreenDisplayPageSettings4Data, MapShowWp), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapShowUavHomeSet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettings4Data, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapShowUavHomeGet( uint8_t *NewMapShowUavHome )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapShowUavHome, offsetof( OnScreenDisplayPageSettings4Data, MapShowUavHome), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapShowTabletSet( uint8_t *NewMapShowTablet )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettings4Data, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4MapShowTabletGet( uint8_t *NewMapShowTablet )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewMapShowTablet, offsetof( OnScreenDisplayPageSettings4Data, MapShowTablet), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4RssiSet( uint8_t *NewRssi )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettings4Data, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4RssiGet( uint8_t *NewRssi )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssi, offsetof( OnScreenDisplayPageSettings4Data, Rssi), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4RssiFontSet( uint8_t *NewRssiFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettings4Data, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4RssiFontGet( uint8_t *NewRssiFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiFont, offsetof( OnScreenDisplayPageSettings4Data, RssiFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4RssiShowIconSet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettings4Data, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4RssiShowIconGet( uint8_t *NewRssiShowIcon )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewRssiShowIcon, offsetof( OnScreenDisplayPageSettings4Data, RssiShowIcon), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedScaleSet( uint8_t *NewSpeedScale )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettings4Data, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedScaleGet( uint8_t *NewSpeedScale )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScale, offsetof( OnScreenDisplayPageSettings4Data, SpeedScale), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedScaleAlignSet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettings4Data, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedScaleAlignGet( uint8_t *NewSpeedScaleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScaleAlign, offsetof( OnScreenDisplayPageSettings4Data, SpeedScaleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedScaleSourceSet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettings4Data, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedScaleSourceGet( uint8_t *NewSpeedScaleSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedScaleSource, offsetof( OnScreenDisplayPageSettings4Data, SpeedScaleSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericSet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericGet( uint8_t *NewSpeedNumeric )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumeric, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumeric), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericFontSet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericFontGet( uint8_t *NewSpeedNumericFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericFont, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericAlignSet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericAlignGet( uint8_t *NewSpeedNumericAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericAlign, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericSourceSet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4SpeedNumericSourceGet( uint8_t *NewSpeedNumericSource )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewSpeedNumericSource, offsetof( OnScreenDisplayPageSettings4Data, SpeedNumericSource), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4TimeSet( uint8_t *NewTime )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettings4Data, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4TimeGet( uint8_t *NewTime )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTime, offsetof( OnScreenDisplayPageSettings4Data, Time), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4TimeFontSet( uint8_t *NewTimeFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettings4Data, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4TimeFontGet( uint8_t *NewTimeFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimeFont, offsetof( OnScreenDisplayPageSettings4Data, TimeFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4TimeAlignSet( uint8_t *NewTimeAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettings4Data, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4TimeAlignGet( uint8_t *NewTimeAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewTimeAlign, offsetof( OnScreenDisplayPageSettings4Data, TimeAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ThrottleSet( uint8_t *NewThrottle )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettings4Data, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ThrottleGet( uint8_t *NewThrottle )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottle, offsetof( OnScreenDisplayPageSettings4Data, Throttle), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ThrottleFontSet( uint8_t *NewThrottleFont )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettings4Data, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ThrottleFontGet( uint8_t *NewThrottleFont )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottleFont, offsetof( OnScreenDisplayPageSettings4Data, ThrottleFont), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ThrottleAlignSet( uint8_t *NewThrottleAlign )
+{
+	UAVObjSetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettings4Data, ThrottleAlign), sizeof(uint8_t));
+}
+void OnScreenDisplayPageSettings4ThrottleAlignGet( uint8_t *NewThrottleAlign )
+{
+	UAVObjGetDataField(OnScreenDisplayPageSettings4Handle(), (void*)NewThrottleAlign, offsetof( OnScreenDisplayPageSettings4Data, ThrottleAlign), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,316 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       onscreendisplaysettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OnScreenDisplaySettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: onscreendisplaysettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "onscreendisplaysettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OnScreenDisplaySettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(ONSCREENDISPLAYSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(ONSCREENDISPLAYSETTINGS_OBJID,
+			ONSCREENDISPLAYSETTINGS_ISSINGLEINST, ONSCREENDISPLAYSETTINGS_ISSETTINGS, ONSCREENDISPLAYSETTINGS_ISSEQLOCKED,
+			ONSCREENDISPLAYSETTINGS_NUMBYTES, &OnScreenDisplaySettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OnScreenDisplaySettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OnScreenDisplaySettingsData data = {};
+
+	data.OSDEnabled = 1;
+	data.Units = 0;
+	data.PALWhite = 110;
+	data.PALBlack = 35;
+	data.NTSCWhite = 110;
+	data.NTSCBlack = 20;
+	data.XOffset = 0;
+	data.YOffset = 0;
+	data.NumPages = 2;
+	data.PageSwitch = 0;
+	data.PageConfig[0] = 0;
+	data.PageConfig[1] = 0;
+	data.PageConfig[2] = 0;
+	data.PageConfig[3] = 0;
+	data.PageConfig[4] = 0;
+	data.PageConfig[5] = 0;
+	data.DisableMenuWhenArmed = 1;
+	data.RssiWarnThreshold = 50;
+	data.CustomText[0] = 66;
+	data.CustomText[1] = 114;
+	data.CustomText[2] = 97;
+	data.CustomText[3] = 105;
+	data.CustomText[4] = 110;
+	data.CustomText[5] = 70;
+	data.CustomText[6] = 80;
+	data.CustomText[7] = 86;
+	data.CustomText[8] = 0;
+	data.CustomText[9] = 0;
+	data.StatsDisplayDuration = 2;
+	data.PALXScale = 7;
+	data.NTSCXScale = 8;
+	data.ThreeDMode = 0;
+	data.ThreeDRightEyeXShift = 30;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OnScreenDisplaySettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OnScreenDisplaySettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OnScreenDisplaySettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OnScreenDisplaySettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OnScreenDisplaySettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OnScreenDisplaySettingsOSDEnabledSet( uint8_t *NewOSDEnabled )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewOSDEnabled, offsetof( OnScreenDisplaySettingsData, OSDEnabled), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsOSDEnabledGet( uint8_t *NewOSDEnabled )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewOSDEnabled, offsetof( OnScreenDisplaySettingsData, OSDEnabled), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsUnitsSet( uint8_t *NewUnits )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewUnits, offsetof( OnScreenDisplaySettingsData, Units), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsUnitsGet( uint8_t *NewUnits )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewUnits, offsetof( OnScreenDisplaySettingsData, Units), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALWhiteSet( uint8_t *NewPALWhite )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALWhite, offsetof( OnScreenDisplaySettingsData, PALWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALWhiteGet( uint8_t *NewPALWhite )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALWhite, offsetof( OnScreenDisplaySettingsData, PALWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALBlackSet( uint8_t *NewPALBlack )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALBlack, offsetof( OnScreenDisplaySettingsData, PALBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALBlackGet( uint8_t *NewPALBlack )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALBlack, offsetof( OnScreenDisplaySettingsData, PALBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCWhiteSet( uint8_t *NewNTSCWhite )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCWhite, offsetof( OnScreenDisplaySettingsData, NTSCWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCWhiteGet( uint8_t *NewNTSCWhite )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCWhite, offsetof( OnScreenDisplaySettingsData, NTSCWhite), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCBlackSet( uint8_t *NewNTSCBlack )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCBlack, offsetof( OnScreenDisplaySettingsData, NTSCBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCBlackGet( uint8_t *NewNTSCBlack )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCBlack, offsetof( OnScreenDisplaySettingsData, NTSCBlack), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsXOffsetSet( int8_t *NewXOffset )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewXOffset, offsetof( OnScreenDisplaySettingsData, XOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsXOffsetGet( int8_t *NewXOffset )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewXOffset, offsetof( OnScreenDisplaySettingsData, XOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsYOffsetSet( int8_t *NewYOffset )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewYOffset, offsetof( OnScreenDisplaySettingsData, YOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsYOffsetGet( int8_t *NewYOffset )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewYOffset, offsetof( OnScreenDisplaySettingsData, YOffset), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsNumPagesSet( int8_t *NewNumPages )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNumPages, offsetof( OnScreenDisplaySettingsData, NumPages), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsNumPagesGet( int8_t *NewNumPages )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNumPages, offsetof( OnScreenDisplaySettingsData, NumPages), sizeof(int8_t));
+}
+void OnScreenDisplaySettingsPageSwitchSet( uint8_t *NewPageSwitch )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageSwitch, offsetof( OnScreenDisplaySettingsData, PageSwitch), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPageSwitchGet( uint8_t *NewPageSwitch )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageSwitch, offsetof( OnScreenDisplaySettingsData, PageSwitch), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPageConfigSet( uint8_t *NewPageConfig )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageConfig, offsetof( OnScreenDisplaySettingsData, PageConfig), 6*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPageConfigGet( uint8_t *NewPageConfig )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPageConfig, offsetof( OnScreenDisplaySettingsData, PageConfig), 6*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsDisableMenuWhenArmedSet( uint8_t *NewDisableMenuWhenArmed )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewDisableMenuWhenArmed, offsetof( OnScreenDisplaySettingsData, DisableMenuWhenArmed), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsDisableMenuWhenArmedGet( uint8_t *NewDisableMenuWhenArmed )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewDisableMenuWhenArmed, offsetof( OnScreenDisplaySettingsData, DisableMenuWhenArmed), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsRssiWarnThresholdSet( uint8_t *NewRssiWarnThreshold )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewRssiWarnThreshold, offsetof( OnScreenDisplaySettingsData, RssiWarnThreshold), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsRssiWarnThresholdGet( uint8_t *NewRssiWarnThreshold )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewRssiWarnThreshold, offsetof( OnScreenDisplaySettingsData, RssiWarnThreshold), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsCustomTextSet( uint8_t *NewCustomText )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewCustomText, offsetof( OnScreenDisplaySettingsData, CustomText), 10*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsCustomTextGet( uint8_t *NewCustomText )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewCustomText, offsetof( OnScreenDisplaySettingsData, CustomText), 10*sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsStatsDisplayDurationSet( uint8_t *NewStatsDisplayDuration )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewStatsDisplayDuration, offsetof( OnScreenDisplaySettingsData, StatsDisplayDuration), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsStatsDisplayDurationGet( uint8_t *NewStatsDisplayDuration )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewStatsDisplayDuration, offsetof( OnScreenDisplaySettingsData, StatsDisplayDuration), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALXScaleSet( uint8_t *NewPALXScale )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALXScale, offsetof( OnScreenDisplaySettingsData, PALXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsPALXScaleGet( uint8_t *NewPALXScale )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewPALXScale, offsetof( OnScreenDisplaySettingsData, PALXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCXScaleSet( uint8_t *NewNTSCXScale )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCXScale, offsetof( OnScreenDisplaySettingsData, NTSCXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsNTSCXScaleGet( uint8_t *NewNTSCXScale )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewNTSCXScale, offsetof( OnScreenDisplaySettingsData, NTSCXScale), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDModeSet( uint8_t *NewThreeDMode )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDMode, offsetof( OnScreenDisplaySettingsData, ThreeDMode), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDModeGet( uint8_t *NewThreeDMode )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDMode, offsetof( OnScreenDisplaySettingsData, ThreeDMode), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDRightEyeXShiftSet( uint8_t *NewThreeDRightEyeXShift )
+{
+	UAVObjSetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDRightEyeXShift, offsetof( OnScreenDisplaySettingsData, ThreeDRightEyeXShift), sizeof(uint8_t));
+}
+void OnScreenDisplaySettingsThreeDRightEyeXShiftGet( uint8_t *NewThreeDRightEyeXShift )
+{
+	UAVObjGetDataField(OnScreenDisplaySettingsHandle(), (void*)NewThreeDRightEyeXShift, offsetof( OnScreenDisplaySettingsData, ThreeDRightEyeXShift), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,163 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       opticalflow.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the OpticalFlow object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: opticalflow.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "opticalflow.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t OpticalFlowInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(OPTICALFLOW_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(OPTICALFLOW_OBJID,
+			OPTICALFLOW_ISSINGLEINST, OPTICALFLOW_ISSETTINGS, OPTICALFLOW_ISSEQLOCKED,
+			OPTICALFLOW_NUMBYTES, &OpticalFlowSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void OpticalFlowSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	OpticalFlowData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void OpticalFlowSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		0 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		0 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_MANUAL << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 1000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 100;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void OpticalFlowSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	OpticalFlowSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		OpticalFlowSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle OpticalFlowHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void OpticalFlowxSet( float *Newx )
+{
+	UAVObjSetDataField(OpticalFlowHandle(), (void*)Newx, offsetof( OpticalFlowData, x), sizeof(float));
+}
+void OpticalFlowxGet( float *Newx )
+{
+	UAVObjGetDataField(OpticalFlowHandle(), (void*)Newx, offsetof( OpticalFlowData, x), sizeof(float));
+}
+void OpticalFlowySet( float *Newy )
+{
+	UAVObjSetDataField(OpticalFlowHandle(), (void*)Newy, offsetof( OpticalFlowData, y), sizeof(float));
+}
+void OpticalFlowyGet( float *Newy )
+{
+	UAVObjGetDataField(OpticalFlowHandle(), (void*)Newy, offsetof( OpticalFlowData, y), sizeof(float));
+}
+void OpticalFlowzSet( float *Newz )
+{
+	UAVObjSetDataField(OpticalFlowHandle(), (void*)Newz, offsetof( OpticalFlowData, z), sizeof(float));
+}
+void OpticalFlowzGet( float *Newz )
+{
+	UAVObjGetDataField(OpticalFlowHandle(), (void*)Newz, offsetof( OpticalFlowData, z), sizeof(float));
+}
+void OpticalFlowQualitySet( uint8_t *NewQuality )
+{
+	UAVObjSetDataField(OpticalFlowHandle(), (void*)NewQuality, offsetof( OpticalFlowData, Quality), sizeof(uint8_t));
+}
+void OpticalFlowQualityGet( uint8_t *NewQuality )
+{
+	UAVObjGetDataField(OpticalFlowHandle(), (void*)NewQuality, offsetof( OpticalFlowData, Quality), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
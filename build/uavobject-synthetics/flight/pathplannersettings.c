@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       pathplannersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the PathPlannerSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: pathplannersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "pathplannersettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t PathPlannerSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(PATHPLANNERSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(PATHPLANNERSETTINGS_OBJID,
+			PATHPLANNERSETTINGS_ISSINGLEINST, PATHPLANNERSETTINGS_ISSETTINGS, PATHPLANNERSETTINGS_ISSEQLOCKED,
+			PATHPLANNERSETTINGS_NUMBYTES, &PathPlannerSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void PathPlannerSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	PathPlannerSettingsData data = {};
+
+	data.PreprogrammedPath = 0;
+	data.FlashOperation = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void PathPlannerSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void PathPlannerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	PathPlannerSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		PathPlannerSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle PathPlannerSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void PathPlannerSettingsPreprogrammedPathSet( uint8_t *NewPreprogrammedPath )
+{
+	UAVObjSetDataField(PathPlannerSettingsHandle(), (void*)NewPreprogrammedPath, offsetof( PathPlannerSettingsData, PreprogrammedPath), sizeof(uint8_t));
+}
+void PathPlannerSettingsPreprogrammedPathGet( uint8_t *NewPreprogrammedPath )
+{
+	UAVObjGetDataField(PathPlannerSettingsHandle(), (void*)NewPreprogrammedPath, offsetof( PathPlannerSettingsData, PreprogrammedPath), sizeof(uint8_t));
+}
+void PathPlannerSettingsFlashOperationSet( uint8_t *NewFlashOperation )
+{
+	UAVObjSetDataField(PathPlannerSettingsHandle(), (void*)NewFlashOperation, offsetof( PathPlannerSettingsData, FlashOperation), sizeof(uint8_t));
+}
+void PathPlannerSettingsFlashOperationGet( uint8_t *NewFlashOperation )
+{
+	UAVObjGetDataField(PathPlannerSettingsHandle(), (void*)NewFlashOperation, offsetof( PathPlannerSettingsData, FlashOperation), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
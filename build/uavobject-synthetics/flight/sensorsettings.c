@@ -0,0 +1,231 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       sensorsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SensorSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: sensorsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "sensorsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SensorSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SENSORSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SENSORSETTINGS_OBJID,
+			SENSORSETTINGS_ISSINGLEINST, SENSORSETTINGS_ISSETTINGS, SENSORSETTINGS_ISSEQLOCKED,
+			SENSORSETTINGS_NUMBYTES, &SensorSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SensorSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SensorSettingsData data = {};
+
+	data.AccelBias[0] = 0;
+	data.AccelBias[1] = 0;
+	data.AccelBias[2] = 0;
+	data.AccelScale[0] = 1;
+	data.AccelScale[1] = 1;
+	data.AccelScale[2] = 1;
+	data.GyroScale[0] = 1;
+	data.GyroScale[1] = 1;
+	data.GyroScale[2] = 1;
+	data.XGyroTempCoeff[0] = 0;
+	data.XGyroTempCoeff[1] = 0;
+	data.XGyroTempCoeff[2] = 0;
+	data.XGyroTempCoeff[3] = 0;
+	data.YGyroTempCoeff[0] = 0;
+	data.YGyroTempCoeff[1] = 0;
+	data.YGyroTempCoeff[2] = 0;
+	data.YGyroTempCoeff[3] = 0;
+	data.ZGyroTempCoeff[0] = 0;
+	data.ZGyroTempCoeff[1] = 0;
+	data.ZGyroTempCoeff[2] = 0;
+	data.ZGyroTempCoeff[3] = 0;
+	data.MagBias[0] = 0;
+	data.MagBias[1] = 0;
+	data.MagBias[2] = 0;
+	data.MagScale[0] = 1;
+	data.MagScale[1] = 1;
+	data.MagScale[2] = 1;
+	data.ZAccelOffset = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SensorSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SensorSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SensorSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SensorSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SensorSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SensorSettingsAccelBiasSet( float *NewAccelBias )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewAccelBias, offsetof( SensorSettingsData, AccelBias), 3*sizeof(float));
+}
+void SensorSettingsAccelBiasGet( float *NewAccelBias )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewAccelBias, offsetof( SensorSettingsData, AccelBias), 3*sizeof(float));
+}
+void SensorSettingsAccelScaleSet( float *NewAccelScale )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewAccelScale, offsetof( SensorSettingsData, AccelScale), 3*sizeof(float));
+}
+void SensorSettingsAccelScaleGet( float *NewAccelScale )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewAccelScale, offsetof( SensorSettingsData, AccelScale), 3*sizeof(float));
+}
+void SensorSettingsGyroScaleSet( float *NewGyroScale )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewGyroScale, offsetof( SensorSettingsData, GyroScale), 3*sizeof(float));
+}
+void SensorSettingsGyroScaleGet( float *NewGyroScale )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewGyroScale, offsetof( SensorSettingsData, GyroScale), 3*sizeof(float));
+}
+void SensorSettingsXGyroTempCoeffSet( float *NewXGyroTempCoeff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewXGyroTempCoeff, offsetof( SensorSettingsData, XGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsXGyroTempCoeffGet( float *NewXGyroTempCoeff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewXGyroTempCoeff, offsetof( SensorSettingsData, XGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsYGyroTempCoeffSet( float *NewYGyroTempCoeff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewYGyroTempCoeff, offsetof( SensorSettingsData, YGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsYGyroTempCoeffGet( float *NewYGyroTempCoeff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewYGyroTempCoeff, offsetof( SensorSettingsData, YGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsZGyroTempCoeffSet( float *NewZGyroTempCoeff )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewZGyroTempCoeff, offsetof( SensorSettingsData, ZGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsZGyroTempCoeffGet( float *NewZGyroTempCoeff )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewZGyroTempCoeff, offsetof( SensorSettingsData, ZGyroTempCoeff), 4*sizeof(float));
+}
+void SensorSettingsMagBiasSet( float *NewMagBias )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewMagBias, offsetof( SensorSettingsData, MagBias), 3*sizeof(float));
+}
+void SensorSettingsMagBiasGet( float *NewMagBias )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewMagBias, offsetof( SensorSettingsData, MagBias), 3*sizeof(float));
+}
+void SensorSettingsMagScaleSet( float *NewMagScale )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewMagScale, offsetof( SensorSettingsData, MagScale), 3*sizeof(float));
+}
+void SensorSettingsMagScaleGet( float *NewMagScale )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewMagScale, offsetof( SensorSettingsData, MagScale), 3*sizeof(float));
+}
+void SensorSettingsZAccelOffsetSet( float *NewZAccelOffset )
+{
+	UAVObjSetDataField(SensorSettingsHandle(), (void*)NewZAccelOffset, offsetof( SensorSettingsData, ZAccelOffset), sizeof(float));
+}
+void SensorSettingsZAccelOffsetGet( float *NewZAccelOffset )
+{
+	UAVObjGetDataField(SensorSettingsHandle(), (void*)NewZAccelOffset, offsetof( SensorSettingsData, ZAccelOffset), sizeof(float));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,350 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup StabilizationSettings StabilizationSettings
+ * @brief PID settings used by the Stabilization module to combine the @ref AttitudeActual and @ref AttitudeDesired to compute @ref ActuatorDesired
+ *
+ *
+ * @file       stabilizationsettings.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the StabilizationSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: stabilizationsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef STABILIZATIONSETTINGS_H
+#define STABILIZATIONSETTINGS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define STABILIZATIONSETTINGS_OBJID 0xFAE14154
+#define STABILIZATIONSETTINGS_ISSINGLEINST 1
+#define STABILIZATIONSETTINGS_ISSETTINGS 1
+#define STABILIZATIONSETTINGS_ISSEQLOCKED 0
+#define STABILIZATIONSETTINGS_NUMBYTES 225
+
+// Generic interface functions
+int32_t StabilizationSettingsInitialize();
+UAVObjHandle StabilizationSettingsHandle();
+void StabilizationSettingsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    float ManualRate[3];
+    float MaximumRate[3];
+    float PoiMaximumRate[3];
+    float RollRatePID[4];
+    float PitchRatePID[4];
+    float YawRatePID[4];
+    float RollPI[3];
+    float PitchPI[3];
+    float YawPI[3];
+    float VbarSensitivity[3];
+    float VbarRollPID[3];
+    float VbarPitchPID[3];
+    float VbarYawPID[3];
+    float VbarTau;
+    float GyroCutoff;
+    float DerivativeGamma;
+    float WeakLevelingKp;
+    float CoordinatedFlightYawPI[3];
+    float AcroInsanityFactor;
+    float CameraTilt;
+    uint8_t RollMax;
+    uint8_t PitchMax;
+    uint8_t YawMax;
+    uint8_t RateExpo[3];
+    uint8_t AttitudeExpo[3];
+    uint8_t HorizonExpo[3];
+    int8_t VbarGyroSuppress;
+    uint8_t VbarPiroComp;
+    uint8_t VbarMaxAngle;
+    uint8_t DerivativeCutoff;
+    uint8_t MaxAxisLock;
+    uint8_t MaxAxisLockRate;
+    uint8_t MaxWeakLevelingRate;
+    uint8_t LowThrottleZeroIntegral;
+    uint8_t FastLoop;
+
+} __attribute__((packed)) __attribute__((aligned(4))) StabilizationSettingsData;
+
+// Typesafe Object access functions
+/**
+ * @function StabilizationSettingsGet(dataOut)
+ * @brief Populate a StabilizationSettingsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t StabilizationSettingsGet(StabilizationSettingsData *dataOut) { return UAVObjGetData(StabilizationSettingsHandle(), dataOut); }
+
+static inline int32_t StabilizationSettingsSet(const StabilizationSettingsData *dataIn) { return UAVObjSetData(StabilizationSettingsHandle(), dataIn); }
+
+static inline int32_t StabilizationSettingsInstGet(uint16_t instId, StabilizationSettingsData *dataOut) { return UAVObjGetInstanceData(StabilizationSettingsHandle(), instId, dataOut); }
+
+static inline int32_t StabilizationSettingsInstSet(uint16_t instId, const StabilizationSettingsData *dataIn) { return UAVObjSetInstanceData(StabilizationSettingsHandle(), instId, dataIn); }
+
+static inline int32_t StabilizationSettingsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(StabilizationSettingsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t StabilizationSettingsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(StabilizationSettingsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t StabilizationSettingsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(StabilizationSettingsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t StabilizationSettingsConnectCopy(volatile StabilizationSettingsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	StabilizationSettingsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(StabilizationSettingsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t StabilizationSettingsCreateInstance() { return UAVObjCreateInstance(StabilizationSettingsHandle(), &StabilizationSettingsSetDefaults); }
+
+static inline void StabilizationSettingsUpdated() { UAVObjUpdated(StabilizationSettingsHandle()); }
+
+static inline void StabilizationSettingsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(StabilizationSettingsHandle(), instId); }
+
+static inline int32_t StabilizationSettingsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(StabilizationSettingsHandle(), dataOut); }
+
+static inline int32_t StabilizationSettingsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(StabilizationSettingsHandle(), dataIn); }
+
+static inline int8_t StabilizationSettingsReadOnly() { return UAVObjReadOnly(StabilizationSettingsHandle()); }
+
+static inline uint16_t StabilizationSettingsGetNumInstances(){ return UAVObjGetNumInstances(StabilizationSettingsHandle()); }
+
+static inline uint32_t StabilizationSettingsGetNumBytes(){ return UAVObjGetNumBytes(StabilizationSettingsHandle()); }
+
+// Field information
+// Field ManualRate information
+/* Array element names for field ManualRate */
+typedef enum { STABILIZATIONSETTINGS_MANUALRATE_ROLL=0, STABILIZATIONSETTINGS_MANUALRATE_PITCH=1, STABILIZATIONSETTINGS_MANUALRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsManualRateElem;
+/* Number of elements for field ManualRate */
+#define STABILIZATIONSETTINGS_MANUALRATE_NUMELEM 3
+// Field MaximumRate information
+/* Array element names for field MaximumRate */
+typedef enum { STABILIZATIONSETTINGS_MAXIMUMRATE_ROLL=0, STABILIZATIONSETTINGS_MAXIMUMRATE_PITCH=1, STABILIZATIONSETTINGS_MAXIMUMRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsMaximumRateElem;
+/* Number of elements for field MaximumRate */
+#define STABILIZATIONSETTINGS_MAXIMUMRATE_NUMELEM 3
+// Field PoiMaximumRate information
+/* Array element names for field PoiMaximumRate */
+typedef enum { STABILIZATIONSETTINGS_POIMAXIMUMRATE_ROLL=0, STABILIZATIONSETTINGS_POIMAXIMUMRATE_PITCH=1, STABILIZATIONSETTINGS_POIMAXIMUMRATE_YAW=2 } __attribute__((packed)) StabilizationSettingsPoiMaximumRateElem;
+/* Number of elements for field PoiMaximumRate */
+#define STABILIZATIONSETTINGS_POIMAXIMUMRATE_NUMELEM 3
+// Field RollRatePID information
+/* Array element names for field RollRatePID */
+typedef enum { STABILIZATIONSETTINGS_ROLLRATEPID_KP=0, STABILIZATIONSETTINGS_ROLLRATEPID_KI=1, STABILIZATIONSETTINGS_ROLLRATEPID_KD=2, STABILIZATIONSETTINGS_ROLLRATEPID_ILIMIT=3 } __attribute__((packed)) StabilizationSettingsRollRatePIDElem;
+/* Number of elements for field RollRatePID */
+#define STABILIZATIONSETTINGS_ROLLRATEPID_NUMELEM 4
+// Field PitchRatePID information
+/* Array element names for field PitchRatePID */
+typedef enum { STABILIZATIONSETTINGS_PITCHRATEPID_KP=0, STABILIZATIONSETTINGS_PITCHRATEPID_KI=1, STABILIZATIONSETTINGS_PITCHRATEPID_KD=2, STABILIZATIONSETTINGS_PITCHRATEPID_ILIMIT=3 } __attribute__((packed)) StabilizationSettingsPitchRatePIDElem;
+/* Number of elements for field PitchRatePID */
+#define STABILIZATIONSETTINGS_PITCHRATEPID_NUMELEM 4
+// Field YawRatePID information
+/* Array element names for field YawRatePID */
+typedef enum { STABILIZATIONSETTINGS_YAWRATEPID_KP=0, STABILIZATIONSETTINGS_YAWRATEPID_KI=1, STABILIZATIONSETTINGS_YAWRATEPID_KD=2, STABILIZATIONSETTINGS_YAWRATEPID_ILIMIT=3 } __attribute__((packed)) StabilizationSettingsYawRatePIDElem;
+/* Number of elements for field YawRatePID */
+#define STABILIZATIONSETTINGS_YAWRATEPID_NUMELEM 4
+// Field RollPI information
+/* Array element names for field RollPI */
+typedef enum { STABILIZATIONSETTINGS_ROLLPI_KP=0, STABILIZATIONSETTINGS_ROLLPI_KI=1, STABILIZATIONSETTINGS_ROLLPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsRollPIElem;
+/* Number of elements for field RollPI */
+#define STABILIZATIONSETTINGS_ROLLPI_NUMELEM 3
+// Field PitchPI information
+/* Array element names for field PitchPI */
+typedef enum { STABILIZATIONSETTINGS_PITCHPI_KP=0, STABILIZATIONSETTINGS_PITCHPI_KI=1, STABILIZATIONSETTINGS_PITCHPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsPitchPIElem;
+/* Number of elements for field PitchPI */
+#define STABILIZATIONSETTINGS_PITCHPI_NUMELEM 3
+// Field YawPI information
+/* Array element names for field YawPI */
+typedef enum { STABILIZATIONSETTINGS_YAWPI_KP=0, STABILIZATIONSETTINGS_YAWPI_KI=1, STABILIZATIONSETTINGS_YAWPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsYawPIElem;
+/* Number of elements for field YawPI */
+#define STABILIZATIONSETTINGS_YAWPI_NUMELEM 3
+// Field VbarSensitivity information
+/* Array element names for field VbarSensitivity */
+typedef enum { STABILIZATIONSETTINGS_VBARSENSITIVITY_ROLL=0, STABILIZATIONSETTINGS_VBARSENSITIVITY_PITCH=1, STABILIZATIONSETTINGS_VBARSENSITIVITY_YAW=2 } __attribute__((packed)) StabilizationSettingsVbarSensitivityElem;
+/* Number of elements for field VbarSensitivity */
+#define STABILIZATIONSETTINGS_VBARSENSITIVITY_NUMELEM 3
+// Field VbarRollPID information
+/* Array element names for field VbarRollPID */
+typedef enum { STABILIZATIONSETTINGS_VBARROLLPID_KP=0, STABILIZATIONSETTINGS_VBARROLLPID_KI=1, STABILIZATIONSETTINGS_VBARROLLPID_KD=2 } __attribute__((packed)) StabilizationSettingsVbarRollPIDElem;
+/* Number of elements for field VbarRollPID */
+#define STABILIZATIONSETTINGS_VBARROLLPID_NUMELEM 3
+// Field VbarPitchPID information
+/* Array element names for field VbarPitchPID */
+typedef enum { STABILIZATIONSETTINGS_VBARPITCHPID_KP=0, STABILIZATIONSETTINGS_VBARPITCHPID_KI=1, STABILIZATIONSETTINGS_VBARPITCHPID_KD=2 } __attribute__((packed)) StabilizationSettingsVbarPitchPIDElem;
+/* Number of elements for field VbarPitchPID */
+#define STABILIZATIONSETTINGS_VBARPITCHPID_NUMELEM 3
+// Field VbarYawPID information
+/* Array element names for field VbarYawPID */
+typedef enum { STABILIZATIONSETTINGS_VBARYAWPID_KP=0, STABILIZATIONSETTINGS_VBARYAWPID_KI=1, STABILIZATIONSETTINGS_VBARYAWPID_KD=2 } __attribute__((packed)) StabilizationSettingsVbarYawPIDElem;
+/* Number of elements for field VbarYawPID */
+#define STABILIZATIONSETTINGS_VBARYAWPID_NUMELEM 3
+// Field VbarTau information
+// Field GyroCutoff information
+// Field DerivativeGamma information
+// Field WeakLevelingKp information
+// Field CoordinatedFlightYawPI information
+/* Array element names for field CoordinatedFlightYawPI */
+typedef enum { STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_KP=0, STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_KI=1, STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_ILIMIT=2 } __attribute__((packed)) StabilizationSettingsCoordinatedFlightYawPIElem;
+/* Number of elements for field CoordinatedFlightYawPI */
+#define STABILIZATIONSETTINGS_COORDINATEDFLIGHTYAWPI_NUMELEM 3
+// Field AcroInsanityFactor information
+// Field CameraTilt information
+// Field RollMax information
+// Field PitchMax information
+// Field YawMax information
+// Field RateExpo information
+/* Array element names for field RateExpo */
+typedef enum { STABILIZATIONSETTINGS_RATEEXPO_ROLL=0, STABILIZATIONSETTINGS_RATEEXPO_PITCH=1, STABILIZATIONSETTINGS_RATEEXPO_YAW=2 } __attribute__((packed)) StabilizationSettingsRateExpoElem;
+/* Number of elements for field RateExpo */
+#define STABILIZATIONSETTINGS_RATEEXPO_NUMELEM 3
+// Field AttitudeExpo information
+/* Array element names for field AttitudeExpo */
+typedef enum { STABILIZATIONSETTINGS_ATTITUDEEXPO_ROLL=0, STABILIZATIONSETTINGS_ATTITUDEEXPO_PITCH=1, STABILIZATIONSETTINGS_ATTITUDEEXPO_YAW=2 } __attribute__((packed)) StabilizationSettingsAttitudeExpoElem;
+/* Number of elements for field AttitudeExpo */
+#define STABILIZATIONSETTINGS_ATTITUDEEXPO_NUMELEM 3
+// Field HorizonExpo information
+/* Array element names for field HorizonExpo */
+typedef enum { STABILIZATIONSETTINGS_HORIZONEXPO_ROLL=0, STABILIZATIONSETTINGS_HORIZONEXPO_PITCH=1, STABILIZATIONSETTINGS_HORIZONEXPO_YAW=2 } __attribute__((packed)) StabilizationSettingsHorizonExpoElem;
+/* Number of elements for field HorizonExpo */
+#define STABILIZATIONSETTINGS_HORIZONEXPO_NUMELEM 3
+// Field VbarGyroSuppress information
+// Field VbarPiroComp information
+/* Enumeration options for field VbarPiroComp */
+typedef enum { STABILIZATIONSETTINGS_VBARPIROCOMP_FALSE=0, STABILIZATIONSETTINGS_VBARPIROCOMP_TRUE=1 }  __attribute__((packed)) StabilizationSettingsVbarPiroCompOptions;
+/* Max value of any option in topmost parent VbarPiroComp of field VbarPiroComp */
+#define STABILIZATIONSETTINGS_VBARPIROCOMP_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field VbarPiroComp */
+#define STABILIZATIONSETTINGS_VBARPIROCOMP_MAXOPTVAL 1
+/* Ensure field VbarPiroComp contains valid data */
+static inline bool StabilizationSettingsVbarPiroCompIsValid( uint8_t CurrentVbarPiroComp ) { return CurrentVbarPiroComp < STABILIZATIONSETTINGS_VBARPIROCOMP_MAXOPTVAL; }
+// Field VbarMaxAngle information
+// Field DerivativeCutoff information
+// Field MaxAxisLock information
+// Field MaxAxisLockRate information
+// Field MaxWeakLevelingRate information
+// Field LowThrottleZeroIntegral information
+/* Enumeration options for field LowThrottleZeroIntegral */
+typedef enum { STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_FALSE=0, STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_TRUE=1 }  __attribute__((packed)) StabilizationSettingsLowThrottleZeroIntegralOptions;
+/* Max value of any option in topmost parent LowThrottleZeroIntegral of field LowThrottleZeroIntegral */
+#define STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field LowThrottleZeroIntegral */
+#define STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_MAXOPTVAL 1
+/* Ensure field LowThrottleZeroIntegral contains valid data */
+static inline bool StabilizationSettingsLowThrottleZeroIntegralIsValid( uint8_t CurrentLowThrottleZeroIntegral ) { return CurrentLowThrottleZeroIntegral < STABILIZATIONSETTINGS_LOWTHROTTLEZEROINTEGRAL_MAXOPTVAL; }
+// Field FastLoop information
+/* Enumeration options for field FastLoop */
+typedef enum { STABILIZATIONSETTINGS_FASTLOOP_FALSE=0, STABILIZATIONSETTINGS_FASTLOOP_TRUE=1 }  __attribute__((packed)) StabilizationSettingsFastLoopOptions;
+/* Max value of any option in topmost parent FastLoop of field FastLoop */
+#define STABILIZATIONSETTINGS_FASTLOOP_GLOBAL_MAXOPTVAL 1
+/* Max value of any option in field FastLoop */
+#define STABILIZATIONSETTINGS_FASTLOOP_MAXOPTVAL 1
+/* Ensure field FastLoop contains valid data */
+static inline bool StabilizationSettingsFastLoopIsValid( uint8_t CurrentFastLoop ) { return CurrentFastLoop < STABILIZATIONSETTINGS_FASTLOOP_MAXOPTVAL; }
+
+
+// set/Get functions
+extern void StabilizationSettingsManualRateSet( float *NewManualRate );
+extern void StabilizationSettingsManualRateGet( float *NewManualRate );
+extern void StabilizationSettingsMaximumRateSet( float *NewMaximumRate );
+extern void StabilizationSettingsMaximumRateGet( float *NewMaximumRate );
+extern void StabilizationSettingsPoiMaximumRateSet( float *NewPoiMaximumRate );
+extern void StabilizationSettingsPoiMaximumRateGet( float *NewPoiMaximumRate );
+extern void StabilizationSettingsRollRatePIDSet( float *NewRollRatePID );
+extern void StabilizationSettingsRollRatePIDGet( float *NewRollRatePID );
+extern void StabilizationSettingsPitchRatePIDSet( float *NewPitchRatePID );
+extern void StabilizationSettingsPitchRatePIDGet( float *NewPitchRatePID );
+extern void StabilizationSettingsYawRatePIDSet( float *NewYawRatePID );
+extern void StabilizationSettingsYawRatePIDGet( float *NewYawRatePID );
+extern void StabilizationSettingsRollPISet( float *NewRollPI );
+extern void StabilizationSettingsRollPIGet( float *NewRollPI );
+extern void StabilizationSettingsPitchPISet( float *NewPitchPI );
+extern void StabilizationSettingsPitchPIGet( float *NewPitchPI );
+extern void StabilizationSettingsYawPISet( float *NewYawPI );
+extern void StabilizationSettingsYawPIGet( float *NewYawPI );
+extern void StabilizationSettingsVbarSensitivitySet( float *NewVbarSensitivity );
+extern void StabilizationSettingsVbarSensitivityGet( float *NewVbarSensitivity );
+extern void StabilizationSettingsVbarRollPIDSet( float *NewVbarRollPID );
+extern void StabilizationSettingsVbarRollPIDGet( float *NewVbarRollPID );
+extern void StabilizationSettingsVbarPitchPIDSet( float *NewVbarPitchPID );
+extern void StabilizationSettingsVbarPitchPIDGet( float *NewVbarPitchPID );
+extern void StabilizationSettingsVbarYawPIDSet( float *NewVbarYawPID );
+extern void StabilizationSettingsVbarYawPIDGet( float *NewVbarYawPID );
+extern void StabilizationSettingsVbarTauSet( float *NewVbarTau );
+extern void StabilizationSettingsVbarTauGet( float *NewVbarTau );
+extern void StabilizationSettingsGyroCutoffSet( float *NewGyroCutoff );
+extern void StabilizationSettingsGyroCutoffGet( float *NewGyroCutoff );
+extern void StabilizationSettingsDerivativeGammaSet( float *NewDerivativeGamma );
+extern void StabilizationSettingsDerivativeGammaGet( float *NewDerivativeGamma );
+extern void StabilizationSettingsWeakLevelingKpSet( float *NewWeakLevelingKp );
+extern void StabilizationSettingsWeakLevelingKpGet( float *NewWeakLevelingKp );
+extern void StabilizationSettingsCoordinatedFlightYawPISet( float *NewCoordinatedFlightYawPI );
+extern void StabilizationSettingsCoordinatedFlightYawPIGet( float *NewCoordinatedFlightYawPI );
+extern void StabilizationSettingsAcroInsanityFactorSet( float *NewAcroInsanityFactor );
+extern void StabilizationSettingsAcroInsanityFactorGet( float *NewAcroInsanityFactor );
+extern void StabilizationSettingsCameraTiltSet( float *NewCameraTilt );
+extern void StabilizationSettingsCameraTiltGet( float *NewCameraTilt );
+extern void StabilizationSettingsRollMaxSet( uint8_t *NewRollMax );
+extern void StabilizationSettingsRollMaxGet( uint8_t *NewRollMax );
+extern void StabilizationSettingsPitchMaxSet( uint8_t *NewPitchMax );
+extern void StabilizationSettingsPitchMaxGet( uint8_t *NewPitchMax );
+extern void StabilizationSettingsYawMaxSet( uint8_t *NewYawMax );
+extern void StabilizationSettingsYawMaxGet( uint8_t *NewYawMax );
+extern void StabilizationSettingsRateExpoSet( uint8_t *NewRateExpo );
+extern void StabilizationSettingsRateExpoGet( uint8_t *NewRateExpo );
+extern void StabilizationSettingsAttitudeExpoSet( uint8_t *NewAttitudeExpo );
+extern void StabilizationSettingsAttitudeExpoGet( uint8_t *NewAttitudeExpo );
+extern void StabilizationSettingsHorizonExpoSet( uint8_t *NewHorizonExpo );
+extern void StabilizationSettingsHorizonExpoGet( uint8_t *NewHorizonExpo );
+extern void StabilizationSettingsVbarGyroSuppressSet( int8_t *NewVbarGyroSuppress );
+extern void StabilizationSettingsVbarGyroSuppressGet( int8_t *NewVbarGyroSuppress );
+extern void StabilizationSettingsVbarPiroCompSet( uint8_t *NewVbarPiroComp );
+extern void StabilizationSettingsVbarPiroCompGet( uint8_t *NewVbarPiroComp );
+extern void StabilizationSettingsVbarMaxAngleSet( uint8_t *NewVbarMaxAngle );
+extern void StabilizationSettingsVbarMaxAngleGet( uint8_t *NewVbarMaxAngle );
+extern void StabilizationSettingsDerivativeCutoffSet( uint8_t *NewDerivativeCutoff );
+extern void StabilizationSettingsDerivativeCutoffGet( uint8_t *NewDerivativeCutoff );
+extern void StabilizationSettingsMaxAxisLockSet( uint8_t *NewMaxAxisLock );
+extern void StabilizationSettingsMaxAxisLockGet( uint8_t *NewMaxAxisLock );
+extern void StabilizationSettingsMaxAxisLockRateSet( uint8_t *NewMaxAxisLockRate );
+extern void StabilizationSettingsMaxAxisLockRateGet( uint8_t *NewMaxAxisLockRate );
+extern void StabilizationSettingsMaxWeakLevelingRateSet( uint8_t *NewMaxWeakLevelingRate );
+extern void StabilizationSettingsMaxWeakLevelingRateGet( uint8_t *NewMaxWeakLevelingRate );
+extern void StabilizationSettingsLowThrottleZeroIntegralSet( uint8_t *NewLowThrottleZeroIntegral );
+extern void StabilizationSettingsLowThrottleZeroIntegralGet( uint8_t *NewLowThrottleZeroIntegral );
+extern void StabilizationSettingsFastLoopSet( uint8_t *NewFastLoop );
+extern void StabilizationSettingsFastLoopGet( uint8_t *NewFastLoop );
+
+
+#endif // STABILIZATIONSETTINGS_H
+
+/**
+ * @}
+ * @}
+ */
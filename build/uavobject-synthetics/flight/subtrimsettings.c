@@ -0,0 +1,149 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       subtrimsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the SubTrimSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: subtrimsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "subtrimsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t SubTrimSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(SUBTRIMSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(SUBTRIMSETTINGS_OBJID,
+			SUBTRIMSETTINGS_ISSINGLEINST, SUBTRIMSETTINGS_ISSETTINGS, SUBTRIMSETTINGS_ISSEQLOCKED,
+			SUBTRIMSETTINGS_NUMBYTES, &SubTrimSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void SubTrimSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	SubTrimSettingsData data = {};
+
+	data.Roll = 0;
+	data.Pitch = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void SubTrimSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void SubTrimSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	SubTrimSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		SubTrimSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle SubTrimSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void SubTrimSettingsRollSet( float *NewRoll )
+{
+	UAVObjSetDataField(SubTrimSettingsHandle(), (void*)NewRoll, offsetof( SubTrimSettingsData, Roll), sizeof(float));
+}
+void SubTrimSettingsRollGet( float *NewRoll )
+{
+	UAVObjGetDataField(SubTrimSettingsHandle(), (void*)NewRoll, offsetof( SubTrimSettingsData, Roll), sizeof(float));
+}
+void SubTrimSettingsPitchSet( float *NewPitch )
+{
+	UAVObjSetDataField(SubTrimSettingsHandle(), (void*)NewPitch, offsetof( SubTrimSettingsData, Pitch), sizeof(float));
+}
+void SubTrimSettingsPitchGet( float *NewPitch )
+{
+	UAVObjGetDataField(SubTrimSettingsHandle(), (void*)NewPitch, offsetof( SubTrimSettingsData, Pitch), sizeof(float));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
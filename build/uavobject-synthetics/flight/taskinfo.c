@@ -0,0 +1,155 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       taskinfo.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the TaskInfo object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: taskinfo.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "taskinfo.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t TaskInfoInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(TASKINFO_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(TASKINFO_OBJID,
+			TASKINFO_ISSINGLEINST, TASKINFO_ISSETTINGS, TASKINFO_ISSEQLOCKED,
+			TASKINFO_NUMBYTES, &TaskInfoSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void TaskInfoSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	TaskInfoData data = {};
+
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void TaskInfoSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_THROTTLED << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 10000;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 1000;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void TaskInfoSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	TaskInfoSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		TaskInfoSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle TaskInfoHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void TaskInfoStackRemainingSet( uint16_t *NewStackRemaining )
+{
+	UAVObjSetDataField(TaskInfoHandle(), (void*)NewStackRemaining, offsetof( TaskInfoData, StackRemaining), 39*sizeof(uint16_t));
+}
+void TaskInfoStackRemainingGet( uint16_t *NewStackRemaining )
+{
+	UAVObjGetDataField(TaskInfoHandle(), (void*)NewStackRemaining, offsetof( TaskInfoData, StackRemaining), 39*sizeof(uint16_t));
+}
+void TaskInfoRunningSet( uint8_t *NewRunning )
+{
+	UAVObjSetDataField(TaskInfoHandle(), (void*)NewRunning, offsetof( TaskInfoData, Running), 39*sizeof(uint8_t));
+}
+void TaskInfoRunningGet( uint8_t *NewRunning )
+{
+	UAVObjGetDataField(TaskInfoHandle(), (void*)NewRunning, offsetof( TaskInfoData, Running), 39*sizeof(uint8_t));
+}
+void TaskInfoRunningTimeSet( uint8_t *NewRunningTime )
+{
+	UAVObjSetDataField(TaskInfoHandle(), (void*)NewRunningTime, offsetof( TaskInfoData, RunningTime), 39*sizeof(uint8_t));
+}
+void TaskInfoRunningTimeGet( uint8_t *NewRunningTime )
+{
+	UAVObjGetDataField(TaskInfoHandle(), (void*)NewRunningTime, offsetof( TaskInfoData, RunningTime), 39*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,146 @@
+/**
+ ******************************************************************************
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ * @addtogroup TraceEvents TraceEvents
+ * @brief Control path tracepoints drained from the flight side ring buffer.  Only present in firmware built with DIAG_TRACE=YES.  Set several times a period, so it is only logged, not sent.
+ *
+ *
+ * @file       traceevents.h
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Include files for the TraceEvents object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: traceevents.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef TRACEEVENTS_H
+#define TRACEEVENTS_H
+
+#include "pios_queue.h"
+#include "uavoversion.h"
+
+
+
+// Object constants
+#define TRACEEVENTS_OBJID 0xD7AC215A
+#define TRACEEVENTS_ISSINGLEINST 1
+#define TRACEEVENTS_ISSETTINGS 0
+#define TRACEEVENTS_ISSEQLOCKED 0
+#define TRACEEVENTS_NUMBYTES 165
+
+// Generic interface functions
+int32_t TraceEventsInitialize();
+UAVObjHandle TraceEventsHandle();
+void TraceEventsSetDefaults(UAVObjHandle obj, uint16_t instId);
+
+// Object data
+typedef struct {
+    uint32_t Dropped;
+    uint32_t Time[32];
+    uint8_t Count;
+    uint8_t Point[32];
+
+} __attribute__((packed)) __attribute__((aligned(4))) TraceEventsData;
+
+// Typesafe Object access functions
+/**
+ * @function TraceEventsGet(dataOut)
+ * @brief Populate a TraceEventsData object
+ * @param[out] dataOut 
+ */
+static inline int32_t TraceEventsGet(TraceEventsData *dataOut) { return UAVObjGetData(TraceEventsHandle(), dataOut); }
+
+static inline int32_t TraceEventsSet(const TraceEventsData *dataIn) { return UAVObjSetData(TraceEventsHandle(), dataIn); }
+
+static inline int32_t TraceEventsInstGet(uint16_t instId, TraceEventsData *dataOut) { return UAVObjGetInstanceData(TraceEventsHandle(), instId, dataOut); }
+
+static inline int32_t TraceEventsInstSet(uint16_t instId, const TraceEventsData *dataIn) { return UAVObjSetInstanceData(TraceEventsHandle(), instId, dataIn); }
+
+static inline int32_t TraceEventsConnectQueue(struct pios_queue *queue) { return UAVObjConnectQueue(TraceEventsHandle(), queue, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t TraceEventsConnectCallback(UAVObjEventCallback cb) { return UAVObjConnectCallback(TraceEventsHandle(), cb, NULL, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t TraceEventsConnectCallbackCtx(UAVObjEventCallback cb, volatile void *ctx) { return UAVObjConnectCallback(TraceEventsHandle(), cb, (void *)ctx, EV_MASK_ALL_UPDATES); }
+
+static inline int32_t TraceEventsConnectCopy(volatile TraceEventsData *dataOut) {
+	/* Get the thing once for free first-- no changes */
+	TraceEventsGet((void *) dataOut);
+
+	return UAVObjConnectCallback(TraceEventsHandle(), UAVObjCbCopyData, (void *)dataOut, EV_MASK_ALL_UPDATES);
+}
+
+static inline uint16_t TraceEventsCreateInstance() { return UAVObjCreateInstance(TraceEventsHandle(), &TraceEventsSetDefaults); }
+
+static inline void TraceEventsUpdated() { UAVObjUpdated(TraceEventsHandle()); }
+
+static inline void TraceEventsInstUpdated(uint16_t instId) { UAVObjInstanceUpdated(TraceEventsHandle(), instId); }
+
+static inline int32_t TraceEventsGetMetadata(UAVObjMetadata *dataOut) { return UAVObjGetMetadata(TraceEventsHandle(), dataOut); }
+
+static inline int32_t TraceEventsSetMetadata(const UAVObjMetadata *dataIn) { return UAVObjSetMetadata(TraceEventsHandle(), dataIn); }
+
+static inline int8_t TraceEventsReadOnly() { return UAVObjReadOnly(TraceEventsHandle()); }
+
+static inline uint16_t TraceEventsGetNumInstances(){ return UAVObjGetNumInstances(TraceEventsHandle()); }
+
+static inline uint32_t TraceEventsGetNumBytes(){ return UAVObjGetNumBytes(TraceEventsHandle()); }
+
+// Field information
+// Field Dropped information
+// Field Time information
+/* Number of elements for field Time */
+#define TRACEEVENTS_TIME_NUMELEM 32
+// Field Count information
+// Field Point information
+/* Enumeration options for field Point */
+typedef enum { TRACEEVENTS_POINT_GYRORECEIVE=0, TRACEEVENTS_POINT_INSPREDICT=1, TRACEEVENTS_POINT_PIDCOMPUTE=2, TRACEEVENTS_POINT_MIXER=3, TRACEEVENTS_POINT_SERVOUPDATE=4 }  __attribute__((packed)) TraceEventsPointOptions;
+/* Max value of any option in topmost parent Point of field Point */
+#define TRACEEVENTS_POINT_GLOBAL_MAXOPTVAL 4
+/* Max value of any option in field Point */
+#define TRACEEVENTS_POINT_MAXOPTVAL 4
+/* Ensure field Point contains valid data */
+static inline bool TraceEventsPointIsValid( uint8_t CurrentPoint ) { return CurrentPoint < TRACEEVENTS_POINT_MAXOPTVAL; }
+/* Number of elements for field Point */
+#define TRACEEVENTS_POINT_NUMELEM 32
+
+
+// set/Get functions
+extern void TraceEventsDroppedSet( uint32_t *NewDropped );
+extern void TraceEventsDroppedGet( uint32_t *NewDropped );
+extern void TraceEventsTimeSet( uint32_t *NewTime );
+extern void TraceEventsTimeGet( uint32_t *NewTime );
+extern void TraceEventsCountSet( uint8_t *NewCount );
+extern void TraceEventsCountGet( uint8_t *NewCount );
+extern void TraceEventsPointSet( uint8_t *NewPoint );
+extern void TraceEventsPointGet( uint8_t *NewPoint );
+
+
+#endif // TRACEEVENTS_H
+
+/**
+ * @}
+ * @}
+ */
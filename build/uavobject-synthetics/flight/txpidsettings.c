@@ -0,0 +1,194 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       txpidsettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the TxPIDSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: txpidsettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "txpidsettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t TxPIDSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(TXPIDSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(TXPIDSETTINGS_OBJID,
+			TXPIDSETTINGS_ISSINGLEINST, TXPIDSETTINGS_ISSETTINGS, TXPIDSETTINGS_ISSEQLOCKED,
+			TXPIDSETTINGS_NUMBYTES, &TxPIDSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void TxPIDSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	TxPIDSettingsData data = {};
+
+	data.ThrottleRange[0] = 0.2;
+	data.ThrottleRange[1] = 0.8;
+	data.MinPID[0] = 0;
+	data.MinPID[1] = 0;
+	data.MinPID[2] = 0;
+	data.MaxPID[0] = 0;
+	data.MaxPID[1] = 0;
+	data.MaxPID[2] = 0;
+	data.UpdateMode = 1;
+	data.Inputs[0] = 0;
+	data.Inputs[1] = 1;
+	data.Inputs[2] = 2;
+	data.PIDs[0] = 0;
+	data.PIDs[1] = 0;
+	data.PIDs[2] = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void TxPIDSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void TxPIDSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	TxPIDSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		TxPIDSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle TxPIDSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void TxPIDSettingsThrottleRangeSet( float *NewThrottleRange )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewThrottleRange, offsetof( TxPIDSettingsData, ThrottleRange), 2*sizeof(float));
+}
+void TxPIDSettingsThrottleRangeGet( float *NewThrottleRange )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewThrottleRange, offsetof( TxPIDSettingsData, ThrottleRange), 2*sizeof(float));
+}
+void TxPIDSettingsMinPIDSet( float *NewMinPID )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewMinPID, offsetof( TxPIDSettingsData, MinPID), 3*sizeof(float));
+}
+void TxPIDSettingsMinPIDGet( float *NewMinPID )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewMinPID, offsetof( TxPIDSettingsData, MinPID), 3*sizeof(float));
+}
+void TxPIDSettingsMaxPIDSet( float *NewMaxPID )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewMaxPID, offsetof( TxPIDSettingsData, MaxPID), 3*sizeof(float));
+}
+void TxPIDSettingsMaxPIDGet( float *NewMaxPID )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewMaxPID, offsetof( TxPIDSettingsData, MaxPID), 3*sizeof(float));
+}
+void TxPIDSettingsUpdateModeSet( uint8_t *NewUpdateMode )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewUpdateMode, offsetof( TxPIDSettingsData, UpdateMode), sizeof(uint8_t));
+}
+void TxPIDSettingsUpdateModeGet( uint8_t *NewUpdateMode )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewUpdateMode, offsetof( TxPIDSettingsData, UpdateMode), sizeof(uint8_t));
+}
+void TxPIDSettingsInputsSet( uint8_t *NewInputs )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewInputs, offsetof( TxPIDSettingsData, Inputs), 3*sizeof(uint8_t));
+}
+void TxPIDSettingsInputsGet( uint8_t *NewInputs )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewInputs, offsetof( TxPIDSettingsData, Inputs), 3*sizeof(uint8_t));
+}
+void TxPIDSettingsPIDsSet( uint8_t *NewPIDs )
+{
+	UAVObjSetDataField(TxPIDSettingsHandle(), (void*)NewPIDs, offsetof( TxPIDSettingsData, PIDs), 3*sizeof(uint8_t));
+}
+void TxPIDSettingsPIDsGet( uint8_t *NewPIDs )
+{
+	UAVObjGetDataField(TxPIDSettingsHandle(), (void*)NewPIDs, offsetof( TxPIDSettingsData, PIDs), 3*sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjectHandling UAVObject handling code
+ * @{
+ *
+ * @file       uavobjectshash.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Perfect hash over all data object IDs, used by the object
+ *             manager to look up objects by ID in constant time.
+ *             Automatically generated by the UAVObjectGenerator.
+ *
+ * @note       This is an automatically generated file.
+ *             DO NOT modify manually.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef UAVOBJECTSHASH_H
+#define UAVOBJECTSHASH_H
+
+#include <stdint.h>
+
+/*
+ * Two level "hash and displace" table.  The first multiplicative hash
+ * selects a bucket, whose displacement is XORed into the second hash to
+ * give a collision free slot.  Every data object ID maps to a distinct
+ * slot; IDs that are not in the table land on a slot holding another ID
+ * (or zero), so callers must compare against uavo_hash_ids[].
+ */
+#define UAVO_HASH_BITS        7
+#define UAVO_HASH_BUCKET_BITS 6
+#define UAVO_HASH_SIZE        (1 << UAVO_HASH_BITS)
+#define UAVO_HASH_BUCKETS     (1 << UAVO_HASH_BUCKET_BITS)
+#define UAVO_HASH_MULT1       0xe29724bdu
+#define UAVO_HASH_MULT2       0x8d1ab8ebu
+
+static const uint16_t uavo_hash_disp[UAVO_HASH_BUCKETS] = {
+	0x0000, 0x0002, 0x0006, 0x0000, 0x0000, 0x0000, 0x0003, 0x0000,
+	0x0006, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008, 0x0000,
+	0x0002, 0x0003, 0x000b, 0x0002, 0x0000, 0x0003, 0x0003, 0x0000,
+	0x0000, 0x000d, 0x0001, 0x0002, 0x0000, 0x0000, 0x0001, 0x0000,
+	0x0000, 0x0006, 0x0006, 0x0009, 0x0005, 0x0005, 0x0000, 0x000a,
+	0x0006, 0x0008, 0x000e, 0x0006, 0x0000, 0x0037, 0x0002, 0x0003,
+	0x0000, 0x0008, 0x0005, 0x0005, 0x0006, 0x0004, 0x000a, 0x0005,
+	0x0000, 0x000b, 0x0000, 0x0005, 0x001b, 0x0005, 0x002a, 0x0004,
+
+};
+
+static const uint32_t uavo_hash_ids[UAVO_HASH_SIZE] = {
+	0xdd9d5fc0, 0xd4478084, 0xa10b03de, 0xdf5ea7fe, 0x7f5d07e2, 0xb80cc3b2,
+	0x00000000, 0xdeecd7b6, 0xfae14154, 0x3af5274a, 0xcc7e1470, 0xf132538a,
+	0x6d31d2f8, 0x133a3280, 0x36770a80, 0x03fcf7f6, 0x9266ce74, 0x7b9a729e,
+	0x09090c16, 0xd309d55c, 0xa35eb43e, 0xcac62f5e, 0x1ea5b19c, 0xa54816f2,
+	0xb8eb0af4, 0x3b7c5b62, 0x44f8119a, 0xe02c8266, 0x2499ae58, 0x04228af6,
+	0x64d7dc16, 0xa207fa7c, 0xabc72744, 0x56c316da, 0x813b55de, 0x1abcfb7e,
+	0x1d9c0348, 0xd3ce626c, 0x33dad5e6, 0xe4b6f980, 0x368cc898, 0x77f8cbac,
+	0xe358d69c, 0x008dfdec, 0xb5b60602, 0x61d618b4, 0x10d6bd7c, 0x2026fd3c,
+	0x0ce8c826, 0x17e829b8, 0x510419ce, 0x9e946992, 0xc6634f26, 0xaca80808,
+	0xe5b7c72c, 0x4622ec88, 0x3a877112, 0x5a08f61a, 0xfa4ab60a, 0x99622e6a,
+	0xca32b032, 0x30ede716, 0x88de3472, 0xf178dca8, 0xbf2fe198, 0x5043e510,
+	0x6b172958, 0x3238594c, 0x4d06ca1c, 0x2f7e2902, 0x51150e32, 0x6a02caaa,
+	0x0124e28a, 0x6473ea06, 0x6f3bb6b0, 0xeae65c28, 0xb26781ca, 0xfa09a51a,
+	0xad7f4958, 0x2dd579be, 0x88bae028, 0xfa9e2d42, 0xcae25898, 0x73f86654,
+	0x45befcd2, 0x6a60957e, 0xd3ee4636, 0x09db8d0a, 0x1fb15a00, 0xe2dbc224,
+	0x55734b70, 0xe341d5ec, 0xbae050d4, 0xd7ac215a, 0x4628f7ac, 0x4e485b94,
+	0x063f679c, 0xf82e4e84, 0x96e3903c, 0x7a6c6728, 0xa9ec7bca, 0xcf711142,
+	0xf8a5279a, 0xe7b9c87a, 0x77a9e8f0, 0x00000000, 0x00000000, 0x89034e4a,
+	0xcce5aed6, 0x5fb6a96c, 0x6cbc1102, 0xf630b000, 0x32df2402, 0x78beb756,
+	0x7c7f5bc0, 0xde4d4c94, 0x5e6e8fdc, 0xf15e2028, 0x7761c4da, 0x312b74e6,
+	0x5c5c96b6, 0xadb3b106, 0x225d3bb8, 0xba09f7c2, 0x5c1d189e, 0x966abe9a,
+	0x2778ba3c, 0xc409985a,
+
+};
+
+static inline uint16_t uavo_hash_slot(uint32_t id)
+{
+	uint32_t bucket = (id * UAVO_HASH_MULT1) >> (32 - UAVO_HASH_BUCKET_BITS);
+	uint32_t slot = (id * UAVO_HASH_MULT2) >> (32 - UAVO_HASH_BITS);
+
+	return slot ^ uavo_hash_disp[bucket];
+}
+
+#endif /* UAVOBJECTSHASH_H */
+
+/**
+ * @}
+ * @}
+ */
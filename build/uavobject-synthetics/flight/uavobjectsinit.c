@@ -0,0 +1,794 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjectHandling UAVObject handling code
+ * @{
+ *
+ * @file       uavobjectsinit.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2013
+ * @brief      Initialize all objects.
+ *             Automatically generated by the UAVObjectGenerator.
+ *   
+ * @note       This is an automatically generated file.
+ *             DO NOT modify manually.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "openpilot.h"
+#include "stabilizationsettings.h"
+#include "positionactual.h"
+#include "manualcontrolsettings.h"
+#include "camerastabsettings.h"
+#include "pathstatus.h"
+#include "systemident.h"
+#include "onscreendisplaysettings.h"
+#include "groundtruth.h"
+#include "txpidsettings.h"
+#include "picocstatus.h"
+#include "actuatordesired.h"
+#include "altitudeholddesired.h"
+#include "hwdiscoveryf4.h"
+#include "gyrosbias.h"
+#include "gpsvelocity.h"
+#include "insstate.h"
+#include "inssettings.h"
+#include "waypoint.h"
+#include "geofencesettings.h"
+#include "rfm22breceiver.h"
+#include "systemalarms.h"
+#include "accels.h"
+#include "traceevents.h"
+#include "gpstime.h"
+#include "eventschedulerstats.h"
+#include "manualcontrolcommand.h"
+#include "objectmanagerstats.h"
+#include "hwcoptercontrol.h"
+#include "hwtaulink.h"
+#include "gcsreceiver.h"
+#include "hwshared.h"
+#include "flightbatterystate.h"
+#include "homelocation.h"
+#include "loggingstats.h"
+#include "accessorydesired.h"
+#include "vibrationanalysisoutput.h"
+#include "gyrofiltersettings.h"
+#include "stateestimation.h"
+#include "systemstats.h"
+#include "tabletinfo.h"
+#include "hwrevolution.h"
+#include "openlrsstatus.h"
+#include "sensorsettings.h"
+#include "gpssatellites.h"
+#include "fixedwingpathfollowerstatus.h"
+#include "gcstelemetrystats.h"
+#include "hwsparky.h"
+#include "hwaq32.h"
+#include "modulesettings.h"
+#include "watchdogstatus.h"
+#include "gyrofilterstate.h"
+#include "velocitydesired.h"
+#include "baroaltitude.h"
+#include "altitudeholdsettings.h"
+#include "subtrim.h"
+#include "attitudesimulated.h"
+#include "sessionmanaging.h"
+#include "flightstats.h"
+#include "flightstatssettings.h"
+#include "magnetometer.h"
+#include "hwquanton.h"
+#include "nedaccel.h"
+#include "taskinfo.h"
+#include "onscreendisplaypagesettings2.h"
+#include "actuatorsettings.h"
+#include "rangefinderdistance.h"
+#include "pathplannersettings.h"
+#include "flightbatterysettings.h"
+#include "flightstatus.h"
+#include "systemsettings.h"
+#include "windvelocityactual.h"
+#include "hottsettings.h"
+#include "onscreendisplaypagesettings3.h"
+#include "hwnaze.h"
+#include "objectpersistence.h"
+#include "onscreendisplaypagesettings4.h"
+#include "picocsettings.h"
+#include "eventdispatcherstats.h"
+#include "altitudeholdstate.h"
+#include "firmwareiapobj.h"
+#include "vibrationanalysissettings.h"
+#include "gpsposition.h"
+#include "velocityactual.h"
+#include "fixedwingpathfollowersettings.h"
+#include "opticalflowsettings.h"
+#include "onscreendisplaypagesettings.h"
+#include "actuatorcommand.h"
+#include "magbias.h"
+#include "mixersettings.h"
+#include "ubloxinfo.h"
+#include "controllatency.h"
+#include "cameradesired.h"
+#include "loggingsettings.h"
+#include "openlrs.h"
+#include "acceldesired.h"
+#include "pathdesired.h"
+#include "hwsimulation.h"
+#include "vtolpathfollowersettings.h"
+#include "hwsparky2.h"
+#include "attitudeactual.h"
+#include "hwlux.h"
+#include "vtolpathfollowerstatus.h"
+#include "hwbrain.h"
+#include "loitercommand.h"
+#include "flighttelemetrystats.h"
+#include "subtrimsettings.h"
+#include "faultsettings.h"
+#include "radiocombridgestats.h"
+#include "opticalflow.h"
+#include "rfm22bstatus.h"
+#include "nedposition.h"
+#include "waypointactive.h"
+#include "hwflyingf3.h"
+#include "receiveractivity.h"
+#include "poilocation.h"
+#include "airspeedactual.h"
+#include "baroairspeed.h"
+#include "ratedesired.h"
+#include "attitudesettings.h"
+#include "groundpathfollowersettings.h"
+#include "airspeedsettings.h"
+#include "gyros.h"
+#include "fixedwingairspeeds.h"
+#include "mixerstatus.h"
+#include "stabilizationdesired.h"
+
+
+#if !defined(SMALLF1)
+/* Start of each field in the packed data, followed by the object size */
+static const uint16_t stabilizationsettings_field_offsets[] = { 0, 12, 24, 36, 52, 68, 84, 96, 108, 120, 132, 144, 156, 168, 172, 176, 180, 184, 196, 200, 204, 205, 206, 207, 210, 213, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225 };
+static const uint16_t positionactual_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t manualcontrolsettings_field_offsets[] = { 0, 4, 6, 8, 28, 48, 68, 70, 72, 82, 83, 84, 94, 95, 96, 97, 100, 103, 106, 107, 108, 109, 110, 116, 117 };
+static const uint16_t camerastabsettings_field_offsets[] = { 0, 4, 8, 11, 14, 17, 20, 23, 26, 27, 28, 29 };
+static const uint16_t pathstatus_field_offsets[] = { 0, 4, 8, 10, 11 };
+static const uint16_t systemident_field_offsets[] = { 0, 4, 16, 28, 40, 44, 48, 52, 56 };
+static const uint16_t onscreendisplaysettings_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 16, 17, 18, 28, 29, 30, 31, 32, 33 };
+static const uint16_t groundtruth_field_offsets[] = { 0, 12, 24, 36, 48, 60, 64, 68, 72, 76 };
+static const uint16_t txpidsettings_field_offsets[] = { 0, 8, 20, 32, 33, 36, 39 };
+static const uint16_t picocstatus_field_offsets[] = { 0, 2, 4, 6, 7, 8, 9, 41 };
+static const uint16_t actuatordesired_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24 };
+static const uint16_t altitudeholddesired_field_offsets[] = { 0, 4, 8, 12, 16, 20, 21 };
+static const uint16_t hwdiscoveryf4_field_offsets[] = { 0, 1, 2, 3 };
+static const uint16_t gyrosbias_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t gpsvelocity_field_offsets[] = { 0, 4, 8, 12, 16 };
+static const uint16_t insstate_field_offsets[] = { 0, 64, 128 };
+static const uint16_t inssettings_field_offsets[] = { 0, 12, 24, 36, 48, 52, 56, 57 };
+static const uint16_t waypoint_field_offsets[] = { 0, 12, 16, 20, 21 };
+static const uint16_t geofencesettings_field_offsets[] = { 0, 2, 4 };
+static const uint16_t systemalarms_field_offsets[] = { 0, 24, 25, 26, 27, 28 };
+static const uint16_t accels_field_offsets[] = { 0, 4, 8, 12, 16 };
+static const uint16_t traceevents_field_offsets[] = { 0, 4, 132, 133, 165 };
+static const uint16_t gpstime_field_offsets[] = { 0, 2, 3, 4, 5, 6, 7 };
+static const uint16_t eventschedulerstats_field_offsets[] = { 0, 4, 36, 38, 54, 70 };
+static const uint16_t manualcontrolcommand_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 26, 46, 47, 48 };
+static const uint16_t objectmanagerstats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24 };
+static const uint16_t hwcoptercontrol_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+static const uint16_t hwtaulink_field_offsets[] = { 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+static const uint16_t hwshared_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+static const uint16_t flightbatterystate_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28, 29 };
+static const uint16_t homelocation_field_offsets[] = { 0, 4, 8, 12, 24, 26, 28, 29 };
+static const uint16_t loggingstats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 26, 28, 30, 32, 33, 161 };
+static const uint16_t vibrationanalysisoutput_field_offsets[] = { 0, 4, 36, 68, 100, 102, 104 };
+static const uint16_t gyrofiltersettings_field_offsets[] = { 0, 16, 32, 40, 41 };
+static const uint16_t stateestimation_field_offsets[] = { 0, 1, 2 };
+static const uint16_t systemstats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 26, 27, 28 };
+static const uint16_t tabletinfo_field_offsets[] = { 0, 4, 8, 12, 13, 14, 15 };
+static const uint16_t hwrevolution_field_offsets[] = { 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23 };
+static const uint16_t openlrsstatus_field_offsets[] = { 0, 2, 3, 4 };
+static const uint16_t sensorsettings_field_offsets[] = { 0, 12, 24, 36, 52, 68, 84, 96, 108, 112 };
+static const uint16_t gpssatellites_field_offsets[] = { 0, 60, 61, 91, 121, 151 };
+static const uint16_t fixedwingpathfollowerstatus_field_offsets[] = { 0, 16, 32, 48, 56 };
+static const uint16_t gcstelemetrystats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 21 };
+static const uint16_t hwsparky_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+static const uint16_t hwaq32_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+static const uint16_t modulesettings_field_offsets[] = { 0, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 };
+static const uint16_t watchdogstatus_field_offsets[] = { 0, 2, 4 };
+static const uint16_t gyrofilterstate_field_offsets[] = { 0, 4, 20, 36, 52 };
+static const uint16_t velocitydesired_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t baroaltitude_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t altitudeholdsettings_field_offsets[] = { 0, 4, 8, 12, 14, 15, 16, 17, 18 };
+static const uint16_t subtrim_field_offsets[] = { 0, 4, 8 };
+static const uint16_t attitudesimulated_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28, 40, 52 };
+static const uint16_t sessionmanaging_field_offsets[] = { 0, 4, 6, 7, 8, 9 };
+static const uint16_t flightstats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 26, 28, 30, 32, 34, 36, 37 };
+static const uint16_t magnetometer_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t hwquanton_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+static const uint16_t nedaccel_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t taskinfo_field_offsets[] = { 0, 78, 117, 156 };
+static const uint16_t onscreendisplaypagesettings2_field_offsets[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182 };
+static const uint16_t actuatorsettings_field_offsets[] = { 0, 4, 8, 12, 24, 44, 64, 84, 94, 95 };
+static const uint16_t rangefinderdistance_field_offsets[] = { 0, 4, 5 };
+static const uint16_t pathplannersettings_field_offsets[] = { 0, 1, 2 };
+static const uint16_t flightbatterysettings_field_offsets[] = { 0, 4, 8, 16, 24, 32, 33, 34, 35, 37 };
+static const uint16_t flightstatus_field_offsets[] = { 0, 1, 2, 3 };
+static const uint16_t systemsettings_field_offsets[] = { 0, 16, 17 };
+static const uint16_t windvelocityactual_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t hottsettings_field_offsets[] = { 0, 108, 113, 141 };
+static const uint16_t onscreendisplaypagesettings3_field_offsets[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182 };
+static const uint16_t hwnaze_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+static const uint16_t objectpersistence_field_offsets[] = { 0, 4, 8, 9 };
+static const uint16_t onscreendisplaypagesettings4_field_offsets[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182 };
+static const uint16_t picocsettings_field_offsets[] = { 0, 4, 8, 12, 13, 14, 15, 16 };
+static const uint16_t eventdispatcherstats_field_offsets[] = { 0, 4, 8, 12, 16, 32, 40, 41, 42 };
+static const uint16_t altitudeholdstate_field_offsets[] = { 0, 4, 8, 12, 16 };
+static const uint16_t firmwareiapobj_field_offsets[] = { 0, 4, 6, 8, 108, 120, 121, 122 };
+static const uint16_t vibrationanalysissettings_field_offsets[] = { 0, 2, 3, 4 };
+static const uint16_t gpsposition_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 41, 42 };
+static const uint16_t velocityactual_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t fixedwingpathfollowersettings_field_offsets[] = { 0, 4, 8, 20, 32, 40, 48, 60, 72, 84, 96, 100, 102 };
+static const uint16_t opticalflowsettings_field_offsets[] = { 0, 6, 7, 8 };
+static const uint16_t onscreendisplaypagesettings_field_offsets[] = { 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30, 32, 34, 36, 38, 40, 42, 44, 46, 48, 50, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74, 76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182 };
+static const uint16_t actuatorcommand_field_offsets[] = { 0, 40, 42, 44, 46, 47, 48 };
+static const uint16_t magbias_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t mixersettings_field_offsets[] = { 0, 20, 40, 41, 42, 47, 48, 53, 54, 59, 60, 65, 66, 71, 72, 77, 78, 83, 84, 89, 90, 95, 96, 101 };
+static const uint16_t ubloxinfo_field_offsets[] = { 0, 4, 8, 10 };
+static const uint16_t controllatency_field_offsets[] = { 0, 32, 36, 38, 39 };
+static const uint16_t cameradesired_field_offsets[] = { 0, 4, 8, 12, 16, 20 };
+static const uint16_t loggingsettings_field_offsets[] = { 0, 1, 2, 3, 4, 5 };
+static const uint16_t openlrs_field_offsets[] = { 0, 4, 8, 12, 16, 20, 21, 22, 23, 47, 48, 49, 50, 51, 52 };
+static const uint16_t acceldesired_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t pathdesired_field_offsets[] = { 0, 12, 24, 28, 32, 36, 38, 39 };
+static const uint16_t vtolpathfollowersettings_field_offsets[] = { 0, 12, 28, 32, 36, 40, 44, 48, 52, 56, 60, 64, 68, 72, 76, 80, 84, 88, 92, 96, 98, 100, 101, 102, 103, 104 };
+static const uint16_t hwsparky2_field_offsets[] = { 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24 };
+static const uint16_t attitudeactual_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28 };
+static const uint16_t hwlux_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+static const uint16_t hwbrain_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 };
+static const uint16_t loitercommand_field_offsets[] = { 0, 4, 8, 12, 13 };
+static const uint16_t flighttelemetrystats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 21 };
+static const uint16_t subtrimsettings_field_offsets[] = { 0, 4, 8 };
+static const uint16_t radiocombridgestats_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56 };
+static const uint16_t opticalflow_field_offsets[] = { 0, 4, 8, 12, 13 };
+static const uint16_t rfm22bstatus_field_offsets[] = { 0, 4, 6, 8, 10, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24 };
+static const uint16_t nedposition_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t hwflyingf3_field_offsets[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+static const uint16_t receiveractivity_field_offsets[] = { 0, 1, 2 };
+static const uint16_t poilocation_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t airspeedactual_field_offsets[] = { 0, 4, 8, 12, 16 };
+static const uint16_t baroairspeed_field_offsets[] = { 0, 4, 8, 12, 14, 15 };
+static const uint16_t ratedesired_field_offsets[] = { 0, 4, 8, 12 };
+static const uint16_t attitudesettings_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28, 34, 35, 36, 37 };
+static const uint16_t groundpathfollowersettings_field_offsets[] = { 0, 12, 28, 32, 36, 40, 42, 43, 44, 45, 46, 47 };
+static const uint16_t airspeedsettings_field_offsets[] = { 0, 4, 6, 7, 8, 9 };
+static const uint16_t gyros_field_offsets[] = { 0, 4, 8, 12, 16 };
+static const uint16_t fixedwingairspeeds_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24 };
+static const uint16_t mixerstatus_field_offsets[] = { 0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40 };
+static const uint16_t stabilizationdesired_field_offsets[] = { 0, 4, 8, 12, 16, 19, 20 };
+
+#endif /* SMALLF1 */
+
+/**
+ * Function used to initialize the first instance of each object.
+ * This file is automatically updated by the UAVObjectGenerator.
+ */
+void UAVObjectsInitializeAll()
+{
+    StabilizationSettingsInitialize();
+    PositionActualInitialize();
+    ManualControlSettingsInitialize();
+    CameraStabSettingsInitialize();
+    PathStatusInitialize();
+    SystemIdentInitialize();
+    OnScreenDisplaySettingsInitialize();
+    GroundTruthInitialize();
+    TxPIDSettingsInitialize();
+    PicoCStatusInitialize();
+    ActuatorDesiredInitialize();
+    AltitudeHoldDesiredInitialize();
+    HwDiscoveryF4Initialize();
+    GyrosBiasInitialize();
+    GPSVelocityInitialize();
+    INSStateInitialize();
+    INSSettingsInitialize();
+    WaypointInitialize();
+    GeoFenceSettingsInitialize();
+    RFM22BReceiverInitialize();
+    SystemAlarmsInitialize();
+    AccelsInitialize();
+    TraceEventsInitialize();
+    GPSTimeInitialize();
+    EventSchedulerStatsInitialize();
+    ManualControlCommandInitialize();
+    ObjectManagerStatsInitialize();
+    HwCopterControlInitialize();
+    HwTauLinkInitialize();
+    GCSReceiverInitialize();
+    HwSharedInitialize();
+    FlightBatteryStateInitialize();
+    HomeLocationInitialize();
+    LoggingStatsInitialize();
+    AccessoryDesiredInitialize();
+    VibrationAnalysisOutputInitialize();
+    GyroFilterSettingsInitialize();
+    StateEstimationInitialize();
+    SystemStatsInitialize();
+    TabletInfoInitialize();
+    HwRevolutionInitialize();
+    OpenLRSStatusInitialize();
+    SensorSettingsInitialize();
+    GPSSatellitesInitialize();
+    FixedWingPathFollowerStatusInitialize();
+    GCSTelemetryStatsInitialize();
+    HwSparkyInitialize();
+    HwAQ32Initialize();
+    ModuleSettingsInitialize();
+    WatchdogStatusInitialize();
+    GyroFilterStateInitialize();
+    VelocityDesiredInitialize();
+    BaroAltitudeInitialize();
+    AltitudeHoldSettingsInitialize();
+    SubTrimInitialize();
+    AttitudeSimulatedInitialize();
+    SessionManagingInitialize();
+    FlightStatsInitialize();
+    FlightStatsSettingsInitialize();
+    MagnetometerInitialize();
+    HwQuantonInitialize();
+    NedAccelInitialize();
+    TaskInfoInitialize();
+    OnScreenDisplayPageSettings2Initialize();
+    ActuatorSettingsInitialize();
+    RangefinderDistanceInitialize();
+    PathPlannerSettingsInitialize();
+    FlightBatterySettingsInitialize();
+    FlightStatusInitialize();
+    SystemSettingsInitialize();
+    WindVelocityActualInitialize();
+    HoTTSettingsInitialize();
+    OnScreenDisplayPageSettings3Initialize();
+    HwNazeInitialize();
+    ObjectPersistenceInitialize();
+    OnScreenDisplayPageSettings4Initialize();
+    PicoCSettingsInitialize();
+    EventDispatcherStatsInitialize();
+    AltitudeHoldStateInitialize();
+    FirmwareIAPObjInitialize();
+    VibrationAnalysisSettingsInitialize();
+    GPSPositionInitialize();
+    VelocityActualInitialize();
+    FixedWingPathFollowerSettingsInitialize();
+    OpticalFlowSettingsInitialize();
+    OnScreenDisplayPageSettingsInitialize();
+    ActuatorCommandInitialize();
+    MagBiasInitialize();
+    MixerSettingsInitialize();
+    UBloxInfoInitialize();
+    ControlLatencyInitialize();
+    CameraDesiredInitialize();
+    LoggingSettingsInitialize();
+    OpenLRSInitialize();
+    AccelDesiredInitialize();
+    PathDesiredInitialize();
+    HwSimulationInitialize();
+    VtolPathFollowerSettingsInitialize();
+    HwSparky2Initialize();
+    AttitudeActualInitialize();
+    HwLuxInitialize();
+    VtolPathFollowerStatusInitialize();
+    HwBrainInitialize();
+    LoiterCommandInitialize();
+    FlightTelemetryStatsInitialize();
+    SubTrimSettingsInitialize();
+    FaultSettingsInitialize();
+    RadioComBridgeStatsInitialize();
+    OpticalFlowInitialize();
+    RFM22BStatusInitialize();
+    NEDPositionInitialize();
+    WaypointActiveInitialize();
+    HwFlyingF3Initialize();
+    ReceiverActivityInitialize();
+    PoiLocationInitialize();
+    AirspeedActualInitialize();
+    BaroAirspeedInitialize();
+    RateDesiredInitialize();
+    AttitudeSettingsInitialize();
+    GroundPathFollowerSettingsInitialize();
+    AirspeedSettingsInitialize();
+    GyrosInitialize();
+    FixedWingAirspeedsInitialize();
+    MixerStatusInitialize();
+    StabilizationDesiredInitialize();
+
+}
+
+/**
+ * Look up the field layout of an object, as used by UAVTalk delta packets.
+ * This file is automatically updated by the UAVObjectGenerator.
+ * \param[in] objId Object ID
+ * \param[out] numFields Number of fields in the object
+ * \return numFields + 1 offsets into the packed data, NULL if the object
+ * has a single field
+ */
+const uint16_t *UAVObjectsFieldOffsets(uint32_t objId, uint8_t *numFields)
+{
+#if !defined(SMALLF1)
+	switch (objId) {
+	case STABILIZATIONSETTINGS_OBJID:
+		*numFields = 35;
+		return stabilizationsettings_field_offsets;
+	case POSITIONACTUAL_OBJID:
+		*numFields = 3;
+		return positionactual_field_offsets;
+	case MANUALCONTROLSETTINGS_OBJID:
+		*numFields = 24;
+		return manualcontrolsettings_field_offsets;
+	case CAMERASTABSETTINGS_OBJID:
+		*numFields = 11;
+		return camerastabsettings_field_offsets;
+	case PATHSTATUS_OBJID:
+		*numFields = 4;
+		return pathstatus_field_offsets;
+	case SYSTEMIDENT_OBJID:
+		*numFields = 8;
+		return systemident_field_offsets;
+	case ONSCREENDISPLAYSETTINGS_OBJID:
+		*numFields = 19;
+		return onscreendisplaysettings_field_offsets;
+	case GROUNDTRUTH_OBJID:
+		*numFields = 9;
+		return groundtruth_field_offsets;
+	case TXPIDSETTINGS_OBJID:
+		*numFields = 6;
+		return txpidsettings_field_offsets;
+	case PICOCSTATUS_OBJID:
+		*numFields = 7;
+		return picocstatus_field_offsets;
+	case ACTUATORDESIRED_OBJID:
+		*numFields = 6;
+		return actuatordesired_field_offsets;
+	case ALTITUDEHOLDDESIRED_OBJID:
+		*numFields = 6;
+		return altitudeholddesired_field_offsets;
+	case HWDISCOVERYF4_OBJID:
+		*numFields = 3;
+		return hwdiscoveryf4_field_offsets;
+	case GYROSBIAS_OBJID:
+		*numFields = 3;
+		return gyrosbias_field_offsets;
+	case GPSVELOCITY_OBJID:
+		*numFields = 4;
+		return gpsvelocity_field_offsets;
+	case INSSTATE_OBJID:
+		*numFields = 2;
+		return insstate_field_offsets;
+	case INSSETTINGS_OBJID:
+		*numFields = 7;
+		return inssettings_field_offsets;
+	case WAYPOINT_OBJID:
+		*numFields = 4;
+		return waypoint_field_offsets;
+	case GEOFENCESETTINGS_OBJID:
+		*numFields = 2;
+		return geofencesettings_field_offsets;
+	case SYSTEMALARMS_OBJID:
+		*numFields = 5;
+		return systemalarms_field_offsets;
+	case ACCELS_OBJID:
+		*numFields = 4;
+		return accels_field_offsets;
+	case TRACEEVENTS_OBJID:
+		*numFields = 4;
+		return traceevents_field_offsets;
+	case GPSTIME_OBJID:
+		*numFields = 6;
+		return gpstime_field_offsets;
+	case EVENTSCHEDULERSTATS_OBJID:
+		*numFields = 5;
+		return eventschedulerstats_field_offsets;
+	case MANUALCONTROLCOMMAND_OBJID:
+		*numFields = 10;
+		return manualcontrolcommand_field_offsets;
+	case OBJECTMANAGERSTATS_OBJID:
+		*numFields = 6;
+		return objectmanagerstats_field_offsets;
+	case HWCOPTERCONTROL_OBJID:
+		*numFields = 10;
+		return hwcoptercontrol_field_offsets;
+	case HWTAULINK_OBJID:
+		*numFields = 12;
+		return hwtaulink_field_offsets;
+	case HWSHARED_OBJID:
+		*numFields = 10;
+		return hwshared_field_offsets;
+	case FLIGHTBATTERYSTATE_OBJID:
+		*numFields = 8;
+		return flightbatterystate_field_offsets;
+	case HOMELOCATION_OBJID:
+		*numFields = 7;
+		return homelocation_field_offsets;
+	case LOGGINGSTATS_OBJID:
+		*numFields = 12;
+		return loggingstats_field_offsets;
+	case VIBRATIONANALYSISOUTPUT_OBJID:
+		*numFields = 6;
+		return vibrationanalysisoutput_field_offsets;
+	case GYROFILTERSETTINGS_OBJID:
+		*numFields = 4;
+		return gyrofiltersettings_field_offsets;
+	case STATEESTIMATION_OBJID:
+		*numFields = 2;
+		return stateestimation_field_offsets;
+	case SYSTEMSTATS_OBJID:
+		*numFields = 9;
+		return systemstats_field_offsets;
+	case TABLETINFO_OBJID:
+		*numFields = 6;
+		return tabletinfo_field_offsets;
+	case HWREVOLUTION_OBJID:
+		*numFields = 20;
+		return hwrevolution_field_offsets;
+	case OPENLRSSTATUS_OBJID:
+		*numFields = 3;
+		return openlrsstatus_field_offsets;
+	case SENSORSETTINGS_OBJID:
+		*numFields = 9;
+		return sensorsettings_field_offsets;
+	case GPSSATELLITES_OBJID:
+		*numFields = 5;
+		return gpssatellites_field_offsets;
+	case FIXEDWINGPATHFOLLOWERSTATUS_OBJID:
+		*numFields = 4;
+		return fixedwingpathfollowerstatus_field_offsets;
+	case GCSTELEMETRYSTATS_OBJID:
+		*numFields = 6;
+		return gcstelemetrystats_field_offsets;
+	case HWSPARKY_OBJID:
+		*numFields = 13;
+		return hwsparky_field_offsets;
+	case HWAQ32_OBJID:
+		*numFields = 16;
+		return hwaq32_field_offsets;
+	case MODULESETTINGS_OBJID:
+		*numFields = 14;
+		return modulesettings_field_offsets;
+	case WATCHDOGSTATUS_OBJID:
+		*numFields = 2;
+		return watchdogstatus_field_offsets;
+	case GYROFILTERSTATE_OBJID:
+		*numFields = 4;
+		return gyrofilterstate_field_offsets;
+	case VELOCITYDESIRED_OBJID:
+		*numFields = 3;
+		return velocitydesired_field_offsets;
+	case BAROALTITUDE_OBJID:
+		*numFields = 3;
+		return baroaltitude_field_offsets;
+	case ALTITUDEHOLDSETTINGS_OBJID:
+		*numFields = 8;
+		return altitudeholdsettings_field_offsets;
+	case SUBTRIM_OBJID:
+		*numFields = 2;
+		return subtrim_field_offsets;
+	case ATTITUDESIMULATED_OBJID:
+		*numFields = 9;
+		return attitudesimulated_field_offsets;
+	case SESSIONMANAGING_OBJID:
+		*numFields = 5;
+		return sessionmanaging_field_offsets;
+	case FLIGHTSTATS_OBJID:
+		*numFields = 13;
+		return flightstats_field_offsets;
+	case MAGNETOMETER_OBJID:
+		*numFields = 3;
+		return magnetometer_field_offsets;
+	case HWQUANTON_OBJID:
+		*numFields = 16;
+		return hwquanton_field_offsets;
+	case NEDACCEL_OBJID:
+		*numFields = 3;
+		return nedaccel_field_offsets;
+	case TASKINFO_OBJID:
+		*numFields = 3;
+		return taskinfo_field_offsets;
+	case ONSCREENDISPLAYPAGESETTINGS2_OBJID:
+		*numFields = 131;
+		return onscreendisplaypagesettings2_field_offsets;
+	case ACTUATORSETTINGS_OBJID:
+		*numFields = 9;
+		return actuatorsettings_field_offsets;
+	case RANGEFINDERDISTANCE_OBJID:
+		*numFields = 2;
+		return rangefinderdistance_field_offsets;
+	case PATHPLANNERSETTINGS_OBJID:
+		*numFields = 2;
+		return pathplannersettings_field_offsets;
+	case FLIGHTBATTERYSETTINGS_OBJID:
+		*numFields = 9;
+		return flightbatterysettings_field_offsets;
+	case FLIGHTSTATUS_OBJID:
+		*numFields = 3;
+		return flightstatus_field_offsets;
+	case SYSTEMSETTINGS_OBJID:
+		*numFields = 2;
+		return systemsettings_field_offsets;
+	case WINDVELOCITYACTUAL_OBJID:
+		*numFields = 3;
+		return windvelocityactual_field_offsets;
+	case HOTTSETTINGS_OBJID:
+		*numFields = 3;
+		return hottsettings_field_offsets;
+	case ONSCREENDISPLAYPAGESETTINGS3_OBJID:
+		*numFields = 131;
+		return onscreendisplaypagesettings3_field_offsets;
+	case HWNAZE_OBJID:
+		*numFields = 9;
+		return hwnaze_field_offsets;
+	case OBJECTPERSISTENCE_OBJID:
+		*numFields = 3;
+		return objectpersistence_field_offsets;
+	case ONSCREENDISPLAYPAGESETTINGS4_OBJID:
+		*numFields = 131;
+		return onscreendisplaypagesettings4_field_offsets;
+	case PICOCSETTINGS_OBJID:
+		*numFields = 7;
+		return picocsettings_field_offsets;
+	case EVENTDISPATCHERSTATS_OBJID:
+		*numFields = 8;
+		return eventdispatcherstats_field_offsets;
+	case ALTITUDEHOLDSTATE_OBJID:
+		*numFields = 4;
+		return altitudeholdstate_field_offsets;
+	case FIRMWAREIAPOBJ_OBJID:
+		*numFields = 7;
+		return firmwareiapobj_field_offsets;
+	case VIBRATIONANALYSISSETTINGS_OBJID:
+		*numFields = 3;
+		return vibrationanalysissettings_field_offsets;
+	case GPSPOSITION_OBJID:
+		*numFields = 12;
+		return gpsposition_field_offsets;
+	case VELOCITYACTUAL_OBJID:
+		*numFields = 3;
+		return velocityactual_field_offsets;
+	case FIXEDWINGPATHFOLLOWERSETTINGS_OBJID:
+		*numFields = 12;
+		return fixedwingpathfollowersettings_field_offsets;
+	case OPTICALFLOWSETTINGS_OBJID:
+		*numFields = 3;
+		return opticalflowsettings_field_offsets;
+	case ONSCREENDISPLAYPAGESETTINGS_OBJID:
+		*numFields = 131;
+		return onscreendisplaypagesettings_field_offsets;
+	case ACTUATORCOMMAND_OBJID:
+		*numFields = 6;
+		return actuatorcommand_field_offsets;
+	case MAGBIAS_OBJID:
+		*numFields = 3;
+		return magbias_field_offsets;
+	case MIXERSETTINGS_OBJID:
+		*numFields = 23;
+		return mixersettings_field_offsets;
+	case UBLOXINFO_OBJID:
+		*numFields = 3;
+		return ubloxinfo_field_offsets;
+	case CONTROLLATENCY_OBJID:
+		*numFields = 4;
+		return controllatency_field_offsets;
+	case CAMERADESIRED_OBJID:
+		*numFields = 5;
+		return cameradesired_field_offsets;
+	case LOGGINGSETTINGS_OBJID:
+		*numFields = 5;
+		return loggingsettings_field_offsets;
+	case OPENLRS_OBJID:
+		*numFields = 14;
+		return openlrs_field_offsets;
+	case ACCELDESIRED_OBJID:
+		*numFields = 3;
+		return acceldesired_field_offsets;
+	case PATHDESIRED_OBJID:
+		*numFields = 7;
+		return pathdesired_field_offsets;
+	case VTOLPATHFOLLOWERSETTINGS_OBJID:
+		*numFields = 25;
+		return vtolpathfollowersettings_field_offsets;
+	case HWSPARKY2_OBJID:
+		*numFields = 21;
+		return hwsparky2_field_offsets;
+	case ATTITUDEACTUAL_OBJID:
+		*numFields = 7;
+		return attitudeactual_field_offsets;
+	case HWLUX_OBJID:
+		*numFields = 11;
+		return hwlux_field_offsets;
+	case HWBRAIN_OBJID:
+		*numFields = 14;
+		return hwbrain_field_offsets;
+	case LOITERCOMMAND_OBJID:
+		*numFields = 4;
+		return loitercommand_field_offsets;
+	case FLIGHTTELEMETRYSTATS_OBJID:
+		*numFields = 6;
+		return flighttelemetrystats_field_offsets;
+	case SUBTRIMSETTINGS_OBJID:
+		*numFields = 2;
+		return subtrimsettings_field_offsets;
+	case RADIOCOMBRIDGESTATS_OBJID:
+		*numFields = 14;
+		return radiocombridgestats_field_offsets;
+	case OPTICALFLOW_OBJID:
+		*numFields = 4;
+		return opticalflow_field_offsets;
+	case RFM22BSTATUS_OBJID:
+		*numFields = 17;
+		return rfm22bstatus_field_offsets;
+	case NEDPOSITION_OBJID:
+		*numFields = 3;
+		return nedposition_field_offsets;
+	case HWFLYINGF3_OBJID:
+		*numFields = 13;
+		return hwflyingf3_field_offsets;
+	case RECEIVERACTIVITY_OBJID:
+		*numFields = 2;
+		return receiveractivity_field_offsets;
+	case POILOCATION_OBJID:
+		*numFields = 3;
+		return poilocation_field_offsets;
+	case AIRSPEEDACTUAL_OBJID:
+		*numFields = 4;
+		return airspeedactual_field_offsets;
+	case BAROAIRSPEED_OBJID:
+		*numFields = 5;
+		return baroairspeed_field_offsets;
+	case RATEDESIRED_OBJID:
+		*numFields = 3;
+		return ratedesired_field_offsets;
+	case ATTITUDESETTINGS_OBJID:
+		*numFields = 11;
+		return attitudesettings_field_offsets;
+	case GROUNDPATHFOLLOWERSETTINGS_OBJID:
+		*numFields = 11;
+		return groundpathfollowersettings_field_offsets;
+	case AIRSPEEDSETTINGS_OBJID:
+		*numFields = 5;
+		return airspeedsettings_field_offsets;
+	case GYROS_OBJID:
+		*numFields = 4;
+		return gyros_field_offsets;
+	case FIXEDWINGAIRSPEEDS_OBJID:
+		*numFields = 6;
+		return fixedwingairspeeds_field_offsets;
+	case MIXERSTATUS_OBJID:
+		*numFields = 10;
+		return mixerstatus_field_offsets;
+	case STABILIZATIONDESIRED_OBJID:
+		*numFields = 6;
+		return stabilizationdesired_field_offsets;
+	}
+#else
+	(void) objId;
+	(void) numFields;
+#endif /* SMALLF1 */
+
+	return NULL;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,6 @@
+#ifndef UAVVER_H
+#define UAVVER_H
+
+#define UAVOHASH 0x79b4710129832039
+
+#endif
@@ -0,0 +1,361 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjects UAVObject set for this firmware
+ * @{
+ *
+ * @file       vtolpathfollowersettings.c
+ * @author     The OpenPilot Team, http://www.openpilot.org Copyright (C) 2010.
+ * @author     Tau Labs, http://taulabs.org, Copyright (C) 2012-2015
+ * @author     dRonin, http://dronin.org Copyright (C) 2015
+ * @brief      Implementation of the VtolPathFollowerSettings object. This file has been 
+ *             automatically generated by the UAVObjectGenerator.
+ * 
+ * @note       Object definition file: vtolpathfollowersettings.xml. 
+ *             This is an automatically generated file.
+ *             DO NOT modify manually.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ *
+ * Additional note on redistribution: The copyright and license notices above
+ * must be maintained in each individual source file that is a derivative work
+ * of this source file; otherwise redistribution is prohibited.
+ */
+
+#include <string.h>
+#include "uavobjectmanager.h"
+#include "vtolpathfollowersettings.h"
+
+// Private variables
+static UAVObjHandle handle = NULL;
+
+/**
+ * Initialize object.
+ * \return 0 Success
+ * \return -1 Failure to initialize or -2 for already initialized
+ */
+int32_t VtolPathFollowerSettingsInitialize(void)
+{
+	// Don't set the handle to null if already registered
+	if(UAVObjGetByID(VTOLPATHFOLLOWERSETTINGS_OBJID) != NULL)
+		return -2;
+	
+	// Register object with the object manager
+	handle = UAVObjRegister(VTOLPATHFOLLOWERSETTINGS_OBJID,
+			VTOLPATHFOLLOWERSETTINGS_ISSINGLEINST, VTOLPATHFOLLOWERSETTINGS_ISSETTINGS, VTOLPATHFOLLOWERSETTINGS_ISSEQLOCKED,
+			VTOLPATHFOLLOWERSETTINGS_NUMBYTES, &VtolPathFollowerSettingsSetDefaults);
+
+	// Done
+	if (handle != 0)
+	{
+		return 0;
+	}
+	else
+	{
+		return -1;
+	}
+}
+
+static void VtolPathFollowerSettingsSetDefaultsImpl(UAVObjHandle obj, uint16_t instId) {
+	// Initialize object fields to their default values
+	VtolPathFollowerSettingsData data = {};
+
+	data.HorizontalPosPI[0] = 1;
+	data.HorizontalPosPI[1] = 0;
+	data.HorizontalPosPI[2] = 2;
+	data.HorizontalVelPID[0] = 2.6;
+	data.HorizontalVelPID[1] = 0.4;
+	data.HorizontalVelPID[2] = 0;
+	data.HorizontalVelPID[3] = 5;
+	data.VelocityFeedforward = 0;
+	data.PositionFeedforward = 0.45;
+	data.EndpointDeadbandWidth = 0.45;
+	data.EndpointDeadbandCenterGain = 0.3;
+	data.PathDeadbandWidth = 1.25;
+	data.PathDeadbandCenterGain = 0.1;
+	data.MaxRollPitch = 20;
+	data.EndpointRadius = 2;
+	data.WaypointAltitudeTol = 2;
+	data.UpdatePeriod = 50;
+	data.LandingRate = 0.5;
+	data.LoiterBrakingTimeConstant = 1.25;
+	data.LoiterErrorDecayConstant = 0.15;
+	data.LoiterLookaheadTimeConstant = 1.25;
+	data.LoiterInitialMaxVel = 3.5;
+	data.LoiterAttitudeFeedthrough = 15;
+	data.ReturnToHomeVel = 3;
+	data.HorizontalVelMax = 10;
+	data.VerticalVelMax = 2;
+	data.ThrottleControl = 0;
+	data.VelocityChangePrediction = 0;
+	data.YawMode = 1;
+	data.LoiterAllowAltControl = 0;
+
+	UAVObjSetInstanceData(obj, instId, &data);
+}
+
+static void VtolPathFollowerSettingsSetMetadataDefaults(UAVObjHandle obj) {
+	// Initialize object metadata to their default values
+	UAVObjMetadata metadata;
+	metadata.flags =
+		ACCESS_READWRITE << UAVOBJ_ACCESS_SHIFT |
+		ACCESS_READWRITE << UAVOBJ_GCS_ACCESS_SHIFT |
+		1 << UAVOBJ_TELEMETRY_ACKED_SHIFT |
+		1 << UAVOBJ_GCS_TELEMETRY_ACKED_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_TELEMETRY_UPDATE_MODE_SHIFT |
+		UPDATEMODE_ONCHANGE << UAVOBJ_GCS_TELEMETRY_UPDATE_MODE_SHIFT;
+	metadata.telemetryUpdatePeriod = 0;
+	metadata.gcsTelemetryUpdatePeriod = 0;
+	metadata.loggingUpdatePeriod = 0;
+	UAVObjSetMetadata(obj, &metadata);
+}
+
+/**
+ * Initialize object fields and metadata with the default values.
+ * If a default value is not specified the object fields
+ * will be initialized to zero.
+ */
+void VtolPathFollowerSettingsSetDefaults(UAVObjHandle obj, uint16_t instId)
+{
+	VtolPathFollowerSettingsSetDefaultsImpl(obj, instId);
+
+	if (instId == 0) {
+		VtolPathFollowerSettingsSetMetadataDefaults(obj);
+	}
+}
+
+/**
+ * Get object handle
+ */
+UAVObjHandle VtolPathFollowerSettingsHandle()
+{
+	return handle;
+}
+
+/**
+ * Get/Set object Functions
+ */
+void VtolPathFollowerSettingsHorizontalPosPISet( float *NewHorizontalPosPI )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewHorizontalPosPI, offsetof( VtolPathFollowerSettingsData, HorizontalPosPI), 3*sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalPosPIGet( float *NewHorizontalPosPI )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewHorizontalPosPI, offsetof( VtolPathFollowerSettingsData, HorizontalPosPI), 3*sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelPIDSet( float *NewHorizontalVelPID )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewHorizontalVelPID, offsetof( VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelPIDGet( float *NewHorizontalVelPID )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewHorizontalVelPID, offsetof( VtolPathFollowerSettingsData, HorizontalVelPID), 4*sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityFeedforwardSet( float *NewVelocityFeedforward )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewVelocityFeedforward, offsetof( VtolPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsVelocityFeedforwardGet( float *NewVelocityFeedforward )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewVelocityFeedforward, offsetof( VtolPathFollowerSettingsData, VelocityFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsPositionFeedforwardSet( float *NewPositionFeedforward )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewPositionFeedforward, offsetof( VtolPathFollowerSettingsData, PositionFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsPositionFeedforwardGet( float *NewPositionFeedforward )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewPositionFeedforward, offsetof( VtolPathFollowerSettingsData, PositionFeedforward), sizeof(float));
+}
+void VtolPathFollowerSettingsEndpointDeadbandWidthSet( float *NewEndpointDeadbandWidth )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewEndpointDeadbandWidth, offsetof( VtolPathFollowerSettingsData, EndpointDeadbandWidth), sizeof(float));
+}
+void VtolPathFollowerSettingsEndpointDeadbandWidthGet( float *NewEndpointDeadbandWidth )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewEndpointDeadbandWidth, offsetof( VtolPathFollowerSettingsData, EndpointDeadbandWidth), sizeof(float));
+}
+void VtolPathFollowerSettingsEndpointDeadbandCenterGainSet( float *NewEndpointDeadbandCenterGain )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewEndpointDeadbandCenterGain, offsetof( VtolPathFollowerSettingsData, EndpointDeadbandCenterGain), sizeof(float));
+}
+void VtolPathFollowerSettingsEndpointDeadbandCenterGainGet( float *NewEndpointDeadbandCenterGain )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewEndpointDeadbandCenterGain, offsetof( VtolPathFollowerSettingsData, EndpointDeadbandCenterGain), sizeof(float));
+}
+void VtolPathFollowerSettingsPathDeadbandWidthSet( float *NewPathDeadbandWidth )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewPathDeadbandWidth, offsetof( VtolPathFollowerSettingsData, PathDeadbandWidth), sizeof(float));
+}
+void VtolPathFollowerSettingsPathDeadbandWidthGet( float *NewPathDeadbandWidth )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewPathDeadbandWidth, offsetof( VtolPathFollowerSettingsData, PathDeadbandWidth), sizeof(float));
+}
+void VtolPathFollowerSettingsPathDeadbandCenterGainSet( float *NewPathDeadbandCenterGain )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewPathDeadbandCenterGain, offsetof( VtolPathFollowerSettingsData, PathDeadbandCenterGain), sizeof(float));
+}
+void VtolPathFollowerSettingsPathDeadbandCenterGainGet( float *NewPathDeadbandCenterGain )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewPathDeadbandCenterGain, offsetof( VtolPathFollowerSettingsData, PathDeadbandCenterGain), sizeof(float));
+}
+void VtolPathFollowerSettingsMaxRollPitchSet( float *NewMaxRollPitch )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewMaxRollPitch, offsetof( VtolPathFollowerSettingsData, MaxRollPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsMaxRollPitchGet( float *NewMaxRollPitch )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewMaxRollPitch, offsetof( VtolPathFollowerSettingsData, MaxRollPitch), sizeof(float));
+}
+void VtolPathFollowerSettingsEndpointRadiusSet( float *NewEndpointRadius )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewEndpointRadius, offsetof( VtolPathFollowerSettingsData, EndpointRadius), sizeof(float));
+}
+void VtolPathFollowerSettingsEndpointRadiusGet( float *NewEndpointRadius )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewEndpointRadius, offsetof( VtolPathFollowerSettingsData, EndpointRadius), sizeof(float));
+}
+void VtolPathFollowerSettingsWaypointAltitudeTolSet( float *NewWaypointAltitudeTol )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewWaypointAltitudeTol, offsetof( VtolPathFollowerSettingsData, WaypointAltitudeTol), sizeof(float));
+}
+void VtolPathFollowerSettingsWaypointAltitudeTolGet( float *NewWaypointAltitudeTol )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewWaypointAltitudeTol, offsetof( VtolPathFollowerSettingsData, WaypointAltitudeTol), sizeof(float));
+}
+void VtolPathFollowerSettingsUpdatePeriodSet( int32_t *NewUpdatePeriod )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewUpdatePeriod, offsetof( VtolPathFollowerSettingsData, UpdatePeriod), sizeof(int32_t));
+}
+void VtolPathFollowerSettingsUpdatePeriodGet( int32_t *NewUpdatePeriod )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewUpdatePeriod, offsetof( VtolPathFollowerSettingsData, UpdatePeriod), sizeof(int32_t));
+}
+void VtolPathFollowerSettingsLandingRateSet( float *NewLandingRate )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLandingRate, offsetof( VtolPathFollowerSettingsData, LandingRate), sizeof(float));
+}
+void VtolPathFollowerSettingsLandingRateGet( float *NewLandingRate )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLandingRate, offsetof( VtolPathFollowerSettingsData, LandingRate), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterBrakingTimeConstantSet( float *NewLoiterBrakingTimeConstant )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterBrakingTimeConstant, offsetof( VtolPathFollowerSettingsData, LoiterBrakingTimeConstant), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterBrakingTimeConstantGet( float *NewLoiterBrakingTimeConstant )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterBrakingTimeConstant, offsetof( VtolPathFollowerSettingsData, LoiterBrakingTimeConstant), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterErrorDecayConstantSet( float *NewLoiterErrorDecayConstant )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterErrorDecayConstant, offsetof( VtolPathFollowerSettingsData, LoiterErrorDecayConstant), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterErrorDecayConstantGet( float *NewLoiterErrorDecayConstant )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterErrorDecayConstant, offsetof( VtolPathFollowerSettingsData, LoiterErrorDecayConstant), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterLookaheadTimeConstantSet( float *NewLoiterLookaheadTimeConstant )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterLookaheadTimeConstant, offsetof( VtolPathFollowerSettingsData, LoiterLookaheadTimeConstant), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterLookaheadTimeConstantGet( float *NewLoiterLookaheadTimeConstant )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterLookaheadTimeConstant, offsetof( VtolPathFollowerSettingsData, LoiterLookaheadTimeConstant), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterInitialMaxVelSet( float *NewLoiterInitialMaxVel )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterInitialMaxVel, offsetof( VtolPathFollowerSettingsData, LoiterInitialMaxVel), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterInitialMaxVelGet( float *NewLoiterInitialMaxVel )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterInitialMaxVel, offsetof( VtolPathFollowerSettingsData, LoiterInitialMaxVel), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterAttitudeFeedthroughSet( float *NewLoiterAttitudeFeedthrough )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterAttitudeFeedthrough, offsetof( VtolPathFollowerSettingsData, LoiterAttitudeFeedthrough), sizeof(float));
+}
+void VtolPathFollowerSettingsLoiterAttitudeFeedthroughGet( float *NewLoiterAttitudeFeedthrough )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterAttitudeFeedthrough, offsetof( VtolPathFollowerSettingsData, LoiterAttitudeFeedthrough), sizeof(float));
+}
+void VtolPathFollowerSettingsReturnToHomeVelSet( float *NewReturnToHomeVel )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewReturnToHomeVel, offsetof( VtolPathFollowerSettingsData, ReturnToHomeVel), sizeof(float));
+}
+void VtolPathFollowerSettingsReturnToHomeVelGet( float *NewReturnToHomeVel )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewReturnToHomeVel, offsetof( VtolPathFollowerSettingsData, ReturnToHomeVel), sizeof(float));
+}
+void VtolPathFollowerSettingsHorizontalVelMaxSet( uint16_t *NewHorizontalVelMax )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewHorizontalVelMax, offsetof( VtolPathFollowerSettingsData, HorizontalVelMax), sizeof(uint16_t));
+}
+void VtolPathFollowerSettingsHorizontalVelMaxGet( uint16_t *NewHorizontalVelMax )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewHorizontalVelMax, offsetof( VtolPathFollowerSettingsData, HorizontalVelMax), sizeof(uint16_t));
+}
+void VtolPathFollowerSettingsVerticalVelMaxSet( uint16_t *NewVerticalVelMax )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewVerticalVelMax, offsetof( VtolPathFollowerSettingsData, VerticalVelMax), sizeof(uint16_t));
+}
+void VtolPathFollowerSettingsVerticalVelMaxGet( uint16_t *NewVerticalVelMax )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewVerticalVelMax, offsetof( VtolPathFollowerSettingsData, VerticalVelMax), sizeof(uint16_t));
+}
+void VtolPathFollowerSettingsThrottleControlSet( uint8_t *NewThrottleControl )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewThrottleControl, offsetof( VtolPathFollowerSettingsData, ThrottleControl), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsThrottleControlGet( uint8_t *NewThrottleControl )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewThrottleControl, offsetof( VtolPathFollowerSettingsData, ThrottleControl), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsVelocityChangePredictionSet( uint8_t *NewVelocityChangePrediction )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewVelocityChangePrediction, offsetof( VtolPathFollowerSettingsData, VelocityChangePrediction), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsVelocityChangePredictionGet( uint8_t *NewVelocityChangePrediction )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewVelocityChangePrediction, offsetof( VtolPathFollowerSettingsData, VelocityChangePrediction), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsYawModeSet( uint8_t *NewYawMode )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewYawMode, offsetof( VtolPathFollowerSettingsData, YawMode), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsYawModeGet( uint8_t *NewYawMode )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewYawMode, offsetof( VtolPathFollowerSettingsData, YawMode), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsLoiterAllowAltControlSet( uint8_t *NewLoiterAllowAltControl )
+{
+	UAVObjSetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterAllowAltControl, offsetof( VtolPathFollowerSettingsData, LoiterAllowAltControl), sizeof(uint8_t));
+}
+void VtolPathFollowerSettingsLoiterAllowAltControlGet( uint8_t *NewLoiterAllowAltControl )
+{
+	UAVObjGetDataField(VtolPathFollowerSettingsHandle(), (void*)NewLoiterAllowAltControl, offsetof( VtolPathFollowerSettingsData, LoiterAllowAltControl), sizeof(uint8_t));
+}
+
+
+/**
+ * @}
+ * @}
+ */
+
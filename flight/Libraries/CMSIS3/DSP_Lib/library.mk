@@ -14,6 +14,7 @@ SRC += $(CMSIS3_DSPLIB_DIR)/Source/ComplexMathFunctions/arm_cmplx_mag_q15.c
 SRC += $(CMSIS3_DSPLIB_DIR)/Source/FastMathFunctions/arm_sqrt_q15.c
 SRC += $(CMSIS3_DSPLIB_DIR)/Source/CommonTables/arm_common_tables.c
 SRC += $(CMSIS3_DSPLIB_DIR)/Source/TransformFunctions/arm_bitreversal.c
+SRC += $(CMSIS3_DSPLIB_DIR)/Source/MatrixFunctions/arm_mat_mult_f32.c
 endif
 
 EXTRAINCDIRS += $(CMSIS3_DSPLIB_DIR)Include
@@ -0,0 +1,202 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       fastloop.c
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Run the control path in the sensor task for each gyro sample
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * Normally a gyro sample goes Sensors -> Stabilization -> Actuator, with a
+ * queue wakeup and a task switch at each arrow.  With
+ * StabilizationSettings.FastLoop set, Stabilization and Actuator register
+ * their loop bodies here instead of starting tasks, and the sensor task runs
+ * them straight after publishing Gyros.  Attitude stays in its own task.
+ *
+ * Either way the time from the gyro sample being read to the outputs being
+ * written is collected in @ref ControlLatency.
+ */
+
+#include "openpilot.h"
+#include "fastloop.h"
+#include "pios_thread.h"
+#include "misc_math.h"
+
+#include "controllatency.h"
+#include "stabilizationsettings.h"
+
+// Private constants
+#define LATENCY_UPDATE_PERIOD_MS 1000
+
+// Private types
+struct fastloop_stage_fns {
+	fastloop_fn_t run;
+	fastloop_fn_t stall;
+};
+
+// Private variables
+static bool initialized;
+static bool enabled;
+static struct fastloop_stage_fns stages[FASTLOOP_STAGE_NUM];
+
+//! Read time of the newest gyro sample, and whether it reached the outputs
+static volatile uint32_t sample_time;
+static volatile bool sample_pending;
+
+static ControlLatencyData latency;
+static uint32_t window_sum_us;
+static uint32_t window_count;
+static uint32_t window_start_ms;
+
+/**
+ * Initialize the objects used here.  Called by each module using the fast
+ * loop, so it may run more than once.
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t FastLoopInitialize(void)
+{
+	if (initialized)
+		return 0;
+
+	if (ControlLatencyInitialize() == -1 ||
+			StabilizationSettingsInitialize() == -1)
+		return -1;
+
+	memset(&latency, 0, sizeof(latency));
+	ControlLatencySet(&latency);
+
+	initialized = true;
+
+	return 0;
+}
+
+/**
+ * Called by the task reading the gyro.  Turns the fast loop on if it is
+ * selected in the settings; it cannot be changed without a reboot because the
+ * other modules decide at start whether to create their tasks.
+ */
+void FastLoopAttachSource(void)
+{
+	uint8_t fast_loop;
+	StabilizationSettingsFastLoopGet(&fast_loop);
+
+	enabled = fast_loop == STABILIZATIONSETTINGS_FASTLOOP_TRUE;
+	latency.FastLoop = enabled ? CONTROLLATENCY_FASTLOOP_TRUE :
+		CONTROLLATENCY_FASTLOOP_FALSE;
+}
+
+/**
+ * Whether the stages should register here instead of starting a task.  Only
+ * valid once all modules are initialized.
+ */
+bool FastLoopEnabled(void)
+{
+	return enabled;
+}
+
+/**
+ * Register the functions for one stage.
+ * @param[in] stage the stage
+ * @param[in] run called for each gyro sample
+ * @param[in] stall called in place of run when the gyro sample was missed
+ */
+void FastLoopRegister(enum fastloop_stage stage, fastloop_fn_t run,
+		fastloop_fn_t stall)
+{
+	PIOS_Assert(stage < FASTLOOP_STAGE_NUM);
+
+	stages[stage].stall = stall;
+	stages[stage].run = run;
+}
+
+//! Run every stage for the gyro sample just published
+void FastLoopRun(void)
+{
+	for (int i = 0; i < FASTLOOP_STAGE_NUM; i++) {
+		if (stages[i].run)
+			stages[i].run();
+	}
+}
+
+//! Let every stage know that no gyro sample arrived in time
+void FastLoopStall(void)
+{
+	for (int i = 0; i < FASTLOOP_STAGE_NUM; i++) {
+		if (stages[i].stall)
+			stages[i].stall();
+	}
+}
+
+/**
+ * Note the time a gyro sample was read
+ * @param[in] raw_time the time from PIOS_DELAY_GetRaw
+ */
+void FastLoopGyroSample(uint32_t raw_time)
+{
+	sample_time = raw_time;
+	sample_pending = true;
+}
+
+/**
+ * Called once the outputs have been written.  Adds the latency of the newest
+ * gyro sample to the statistics, and publishes them once a second.
+ */
+void FastLoopOutputDone(void)
+{
+	if (!initialized)
+		return;
+
+	if (sample_pending) {
+		sample_pending = false;
+
+		uint32_t latency_us = PIOS_DELAY_DiffuS(sample_time);
+
+		uint32_t bin = 0;
+		for (uint32_t bound = 50; bin < CONTROLLATENCY_HISTOGRAM_OVER &&
+				latency_us >= bound; bound *= 2)
+			bin++;
+
+		latency.Histogram[bin]++;
+		if (latency_us > latency.Max)
+			latency.Max = MIN(latency_us, UINT16_MAX);
+
+		window_sum_us += latency_us;
+		window_count++;
+	}
+
+	uint32_t now = PIOS_Thread_Systime();
+	if (now - window_start_ms < LATENCY_UPDATE_PERIOD_MS)
+		return;
+
+	latency.Mean = window_count ? (float)window_sum_us / window_count : 0;
+	ControlLatencySet(&latency);
+
+	latency.Max = 0;
+	window_sum_us = 0;
+	window_count = 0;
+	window_start_ms = now;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,434 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       gyrofilter.c
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Gyro notch filters, optionally tracking the noise spectrum
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * The sensor task passes each gyro sample through a cascade of notch filters
+ * from @ref GyroFilterSettings before publishing Gyros.  The notches are
+ * designed for the measured rate of those samples, which depends on the
+ * sensor and the board.
+ *
+ * With TrackedNotches set, the unfiltered samples are also copied into a
+ * queue.  A periodic event collects them into windows, runs the CMSIS q15
+ * FFT on each axis and looks for the strongest peaks in the summed spectrum.
+ * The sensor task then moves the tracked notches towards those peaks, so
+ * they follow the motor noise as the throttle changes.  Both sides are shown
+ * in @ref GyroFilterState.
+ */
+
+#include "openpilot.h"
+#include "gyrofilter.h"
+#include "biquad.h"
+#include "misc_math.h"
+#include "arm_math.h"
+#include <circqueue.h>
+
+#include "gyrofiltersettings.h"
+#include "gyrofilterstate.h"
+
+// Private constants
+#define NUM_NOTCHES GYROFILTERSETTINGS_NOTCHFREQUENCY_NUMELEM
+#define NUM_PEAKS GYROFILTERSTATE_PEAKFREQUENCY_NUMELEM
+
+#define FFT_LEN 256			// Samples per window, a radix 4 size
+#define WINDOW_SCALE 16.0f		// Window counts per deg/s
+#define MAX_SAMPLE_RATE 8000		// Fastest gyro rate the analysis keeps up with
+#define ANALYSIS_PERIOD_MS 10
+// Two analysis periods of samples at the fastest rate, so a late callback
+// does not drop any, plus the slot the queue always leaves empty
+#define SAMPLE_QUEUE_LEN (2 * MAX_SAMPLE_RATE * ANALYSIS_PERIOD_MS / 1000 + 1)
+
+#define SAMPLE_RATE_ALPHA 0.01f		// Weight of each period in the rate estimate
+#define MAX_SAMPLE_PERIOD_US 20000	// Longer gaps are stalls, not the rate
+#define RETUNE_RATE_CHANGE 0.02f	// Redesign when the rate moves this much
+#define TRACKING_ALPHA 0.3f		// How far notches move towards a new peak
+#define PEAK_MIN_RATIO 3.0f		// Peaks must be this far over the band mean
+
+// Private types
+struct gyrofilter_peak {
+	float freq;
+	float amplitude;
+};
+
+struct gyrofilter_analysis {
+	circ_queue_t samples;
+	volatile bool overrun;
+
+	arm_cfft_radix4_instance_q15 fft;
+	int16_t window[3][FFT_LEN];
+	q15_t fft_buf[2 * FFT_LEN];
+	float spectrum[FFT_LEN / 2];
+	uint16_t window_count;
+
+	//! Handed to the sensor task, which clears peaks_pending once read
+	struct gyrofilter_peak peaks[NUM_PEAKS];
+	volatile bool peaks_pending;
+};
+
+// Private variables
+static bool initialized;
+static volatile bool settings_updated;
+static GyroFilterSettingsData settings;
+
+static struct biquad notches[NUM_NOTCHES][3];
+static bool notch_active[NUM_NOTCHES];
+static float notch_freq[NUM_NOTCHES];
+
+static uint32_t last_sample_raw;
+static float sample_period_us;
+static volatile float sample_rate;
+static float design_rate;
+
+static struct gyrofilter_analysis *analysis;
+
+// Private functions
+static void gyrofilter_update_rate(void);
+static void gyrofilter_retune(void);
+static void gyrofilter_track(const struct gyrofilter_peak *peaks);
+static void gyrofilter_analysis_cb(UAVObjEvent *ev, void *ctx, void *obj, int len);
+static void gyrofilter_analyse_window(struct gyrofilter_analysis *an);
+static void gyrofilter_find_peaks(struct gyrofilter_analysis *an);
+
+/**
+ * Initialize the notches, and the spectrum analysis if any notch is tracked.
+ * Called by the sensors module.
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t GyroFilterInitialize(void)
+{
+	if (GyroFilterSettingsInitialize() == -1 ||
+			GyroFilterStateInitialize() == -1)
+		return -1;
+
+	for (int i = 0; i < NUM_NOTCHES; i++)
+		for (int j = 0; j < 3; j++)
+			biquad_passthrough(&notches[i][j]);
+
+	GyroFilterSettingsConnectCallbackCtx(UAVObjCbSetFlag, &settings_updated);
+	settings_updated = true;
+
+	uint8_t tracked_notches;
+	GyroFilterSettingsTrackedNotchesGet(&tracked_notches);
+
+	if (tracked_notches > 0) {
+		// Without the memory the static notches still work, they just
+		// do not move
+		analysis = PIOS_malloc(sizeof(*analysis));
+		if (analysis != NULL) {
+			memset(analysis, 0, sizeof(*analysis));
+
+			analysis->samples = circ_queue_new(3 * sizeof(float),
+					SAMPLE_QUEUE_LEN);
+			arm_cfft_radix4_init_q15(&analysis->fft, FFT_LEN, 0, 1);
+		}
+
+		if (analysis != NULL && analysis->samples != NULL) {
+			UAVObjEvent ev;
+			memset(&ev, 0, sizeof(ev));
+			EventPeriodicCallbackCreate(&ev, gyrofilter_analysis_cb,
+					ANALYSIS_PERIOD_MS);
+		} else {
+			analysis = NULL;
+		}
+	}
+
+	initialized = true;
+
+	return 0;
+}
+
+/**
+ * Filter one gyro sample in place.  Called by the sensor task for every
+ * sample, after calibration and rotation.
+ * @param[in,out] gyros the three axes in deg/s
+ */
+void GyroFilterApply(float *gyros)
+{
+	if (!initialized)
+		return;
+
+	gyrofilter_update_rate();
+
+	if (analysis != NULL &&
+			circ_queue_write_data(analysis->samples, gyros, 1) == 0)
+		analysis->overrun = true;
+
+	if (settings_updated || (analysis != NULL && analysis->peaks_pending) ||
+			fabsf(sample_rate - design_rate) > RETUNE_RATE_CHANGE * design_rate)
+		gyrofilter_retune();
+
+	for (int i = 0; i < NUM_NOTCHES; i++) {
+		if (!notch_active[i])
+			continue;
+
+		for (int j = 0; j < 3; j++)
+			gyros[j] = biquad_apply(&notches[i][j], gyros[j]);
+	}
+}
+
+//! Measure the rate samples arrive at, which the notches are designed for
+static void gyrofilter_update_rate(void)
+{
+	uint32_t now = PIOS_DELAY_GetRaw();
+	uint32_t period_us = PIOS_DELAY_DiffuS2(last_sample_raw, now);
+
+	last_sample_raw = now;
+
+	if (period_us == 0 || period_us > MAX_SAMPLE_PERIOD_US)
+		return;
+
+	if (sample_period_us == 0)
+		sample_period_us = period_us;
+	else
+		sample_period_us += SAMPLE_RATE_ALPHA * (period_us - sample_period_us);
+
+	sample_rate = 1e6f / sample_period_us;
+}
+
+//! Redesign the notches for new settings, peaks or sample rate
+static void gyrofilter_retune(void)
+{
+	GyroFilterStateData state;
+	memset(&state, 0, sizeof(state));
+
+	if (settings_updated) {
+		settings_updated = false;
+		GyroFilterSettingsGet(&settings);
+
+		// Tracked notches start again from the configured centres
+		for (int i = 0; i < NUM_NOTCHES; i++)
+			notch_freq[i] = settings.NotchFrequency[i];
+	}
+
+	if (analysis != NULL && analysis->peaks_pending) {
+		gyrofilter_track(analysis->peaks);
+
+		for (int i = 0; i < NUM_PEAKS; i++) {
+			state.PeakFrequency[i] = analysis->peaks[i].freq;
+			state.PeakAmplitude[i] = analysis->peaks[i].amplitude;
+		}
+
+		__sync_synchronize();
+		analysis->peaks_pending = false;
+	} else {
+		GyroFilterStatePeakFrequencyGet(state.PeakFrequency);
+		GyroFilterStatePeakAmplitudeGet(state.PeakAmplitude);
+	}
+
+	design_rate = sample_rate;
+
+	for (int i = 0; i < NUM_NOTCHES; i++) {
+		bool was_active = notch_active[i];
+
+		notch_active[i] = false;
+		for (int j = 0; j < 3; j++)
+			notch_active[i] = biquad_notch(&notches[i][j], notch_freq[i],
+					settings.NotchQ[i], design_rate);
+
+		// A notch being switched on starts from rest
+		if (notch_active[i] && !was_active)
+			for (int j = 0; j < 3; j++)
+				biquad_reset(&notches[i][j]);
+
+		state.NotchFrequency[i] = notch_active[i] ? notch_freq[i] : 0;
+	}
+
+	state.SampleRate = design_rate;
+	GyroFilterStateSet(&state);
+}
+
+/**
+ * Move each tracked notch towards the nearest of the new peaks
+ * @param[in] peaks the peaks found, strongest first
+ */
+static void gyrofilter_track(const struct gyrofilter_peak *peaks)
+{
+	uint8_t tracked = MIN(settings.TrackedNotches, NUM_NOTCHES);
+	bool assigned[NUM_NOTCHES] = { false };
+
+	// Pairing by distance rather than strength stops two similar peaks
+	// from swapping notches between updates
+	for (int i = 0; i < MIN(tracked, NUM_PEAKS); i++) {
+		if (peaks[i].freq <= 0)
+			break;
+
+		int best = -1;
+		for (int j = 0; j < tracked; j++) {
+			if (assigned[j])
+				continue;
+
+			if (best < 0 || fabsf(notch_freq[j] - peaks[i].freq) <
+					fabsf(notch_freq[best] - peaks[i].freq))
+				best = j;
+		}
+
+		assigned[best] = true;
+
+		if (notch_freq[best] <= 0)
+			notch_freq[best] = peaks[i].freq;
+		else
+			notch_freq[best] += TRACKING_ALPHA * (peaks[i].freq - notch_freq[best]);
+	}
+}
+
+/**
+ * Collect the queued gyro samples into windows and analyse each full one
+ */
+static void gyrofilter_analysis_cb(UAVObjEvent *ev, void *ctx, void *obj, int len)
+{
+	(void) ev; (void) ctx; (void) obj; (void) len;
+
+	struct gyrofilter_analysis *an = analysis;
+	float sample[3];
+
+	// A dropped sample would smear the spectrum, start the window again
+	if (an->overrun) {
+		an->overrun = false;
+		an->window_count = 0;
+	}
+
+	while (circ_queue_read_data(an->samples, sample, 1) == 1) {
+		for (int j = 0; j < 3; j++)
+			an->window[j][an->window_count] =
+				bound_sym(sample[j] * WINDOW_SCALE, INT16_MAX);
+
+		if (++an->window_count < FFT_LEN)
+			continue;
+
+		an->window_count = 0;
+
+		// Skip the analysis until the last peaks have been picked up
+		if (!an->peaks_pending)
+			gyrofilter_analyse_window(an);
+	}
+}
+
+/**
+ * Sum the magnitude spectra of the three axes for one window, then look for
+ * peaks in it
+ */
+static void gyrofilter_analyse_window(struct gyrofilter_analysis *an)
+{
+	memset(an->spectrum, 0, sizeof(an->spectrum));
+
+	for (int j = 0; j < 3; j++) {
+		const int16_t *window = an->window[j];
+
+		int32_t sum = 0;
+		for (int i = 0; i < FFT_LEN; i++)
+			sum += window[i];
+		float mean = (float) sum / FFT_LEN;
+
+		float max_dev = 0;
+		for (int i = 0; i < FFT_LEN; i++)
+			max_dev = MAX(max_dev, fabsf(window[i] - mean));
+
+		if (max_dev < 1)
+			continue;
+
+		// Use half the q15 range, and a Hann window against leakage
+		const float scale = 16384 / max_dev;
+		for (int i = 0; i < FFT_LEN; i++) {
+			float hann = 0.5f - 0.5f * cosf(2 * (float)M_PI * i / FFT_LEN);
+			an->fft_buf[2 * i] = (window[i] - mean) * scale * hann;
+			an->fft_buf[2 * i + 1] = 0;
+		}
+
+		arm_cfft_radix4_q15(&an->fft, an->fft_buf);
+		arm_cmplx_mag_q15(an->fft_buf, an->fft_buf, FFT_LEN / 2);
+
+		// The FFT output is scaled by 1 / FFT_LEN and the magnitude is
+		// 2.14, so a sine of amplitude A gives A / 4 counts, halved
+		// again by the Hann window
+		const float to_dps = 8 / (scale * WINDOW_SCALE);
+		for (int i = 0; i < FFT_LEN / 2; i++)
+			an->spectrum[i] += an->fft_buf[i] * to_dps;
+	}
+
+	gyrofilter_find_peaks(an);
+}
+
+/**
+ * Find the strongest local maxima of the spectrum in the tracking range and
+ * hand them to the sensor task
+ */
+static void gyrofilter_find_peaks(struct gyrofilter_analysis *an)
+{
+	float range[GYROFILTERSETTINGS_TRACKINGRANGE_NUMELEM];
+	GyroFilterSettingsTrackingRangeGet(range);
+
+	const float bin_hz = sample_rate / FFT_LEN;
+	if (bin_hz <= 0)
+		return;
+
+	int lo = MAX((int) ceilf(range[GYROFILTERSETTINGS_TRACKINGRANGE_MIN] / bin_hz), 1);
+	int hi = MIN((int) (range[GYROFILTERSETTINGS_TRACKINGRANGE_MAX] / bin_hz), FFT_LEN / 2 - 2);
+
+	struct gyrofilter_peak peaks[NUM_PEAKS];
+	memset(peaks, 0, sizeof(peaks));
+
+	if (lo < hi) {
+		const float *s = an->spectrum;
+
+		float band_sum = 0;
+		for (int i = lo; i <= hi; i++)
+			band_sum += s[i];
+		const float threshold = PEAK_MIN_RATIO * band_sum / (hi - lo + 1);
+
+		for (int i = lo; i <= hi; i++) {
+			if (s[i] <= threshold || s[i] <= s[i - 1] || s[i] < s[i + 1])
+				continue;
+
+			// Place the peak between bins by fitting a parabola
+			float denom = s[i - 1] - 2 * s[i] + s[i + 1];
+			float offset = denom != 0 ? 0.5f * (s[i - 1] - s[i + 1]) / denom : 0;
+
+			struct gyrofilter_peak peak = {
+				.freq = (i + offset) * bin_hz,
+				.amplitude = s[i],
+			};
+
+			// Keep the list sorted, strongest first
+			for (int j = 0; j < NUM_PEAKS; j++) {
+				if (peak.amplitude > peaks[j].amplitude) {
+					struct gyrofilter_peak tmp = peaks[j];
+					peaks[j] = peak;
+					peak = tmp;
+				}
+			}
+		}
+	}
+
+	memcpy(an->peaks, peaks, sizeof(peaks));
+
+	__sync_synchronize();
+	an->peaks_pending = true;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       fastloop.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Run the control path in the sensor task for each gyro sample
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef FASTLOOP_H
+#define FASTLOOP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+//! Stacks of the modules whose stages the fast loop can run, as they are
+//! sized for their own tasks
+#if defined(PIOS_STABILIZATION_STACK_SIZE)
+#define STABILIZATION_STACK_BYTES PIOS_STABILIZATION_STACK_SIZE
+#else
+#define STABILIZATION_STACK_BYTES 800
+#endif
+
+#if defined(PIOS_ACTUATOR_STACK_SIZE)
+#define ACTUATOR_STACK_BYTES PIOS_ACTUATOR_STACK_SIZE
+#else
+#define ACTUATOR_STACK_BYTES 1336
+#endif
+
+//! Stack the sensor task needs on top of its own to run the stages
+#define FASTLOOP_STACK_BYTES (STABILIZATION_STACK_BYTES + ACTUATOR_STACK_BYTES)
+
+//! The stages run for each gyro sample, in this order
+enum fastloop_stage {
+	FASTLOOP_STAGE_CONTROL,		//!< Stabilization, gyro to ActuatorDesired
+	FASTLOOP_STAGE_OUTPUT,		//!< Actuator, ActuatorDesired to the outputs
+	FASTLOOP_STAGE_NUM
+};
+
+typedef void (*fastloop_fn_t)(void);
+
+int32_t FastLoopInitialize(void);
+void FastLoopAttachSource(void);
+bool FastLoopEnabled(void);
+void FastLoopRegister(enum fastloop_stage stage, fastloop_fn_t run,
+		fastloop_fn_t stall);
+void FastLoopRun(void);
+void FastLoopStall(void);
+void FastLoopGyroSample(uint32_t raw_time);
+void FastLoopOutputDone(void);
+
+#endif // FASTLOOP_H
+
+/**
+ * @}
+ */
@@ -32,6 +32,7 @@
 
 #include "stdint.h"
 #include "stdbool.h"
+#include "stddef.h"
 
 /**
   * @addtogroup Constants
@@ -67,6 +68,12 @@ void INSCovariancePrediction(float dT);
 //! Correct the state and covariance estimate based on the sensors that were updated
 void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[3], float BaroAlt, uint16_t SensorsUsed);
 
+//! Correct with one sensor group, only linearizing the measurements of that group
+void INSPosCorrection(const float Pos[3], uint16_t SensorsUsed);
+void INSVelCorrection(const float Vel[3], uint16_t SensorsUsed);
+void INSMagCorrection(const float mag_data[3]);
+void INSBaroCorrection(float BaroAlt);
+
 //! Get the current state estimate
 void INSGetState(float *pos, float *vel, float *attitude, float *gyro_bias, float *accel_bias);
 
@@ -93,6 +100,42 @@ void INSGetVariance(float *p);
 
 uint16_t ins_get_num_states();
 
+/****************************************************/
+/** Reentrant interface, one context per filter    **/
+/****************************************************/
+
+/*
+ * The calls above all work on one filter built into the library.  These
+ * take the filter to work on instead, so several can run at once, e.g.
+ * on different threads when replaying logs.  The context is opaque, the
+ * caller allocates insgps_ctx_size() bytes for it and calls insgps_init().
+ */
+struct insgps_ctx;
+
+size_t insgps_ctx_size();
+void insgps_init(struct insgps_ctx *ctx);
+void insgps_state_prediction(struct insgps_ctx *ctx, const float gyro_data[3], const float accel_data[3], float dT);
+void insgps_covariance_prediction(struct insgps_ctx *ctx, float dT);
+void insgps_correction(struct insgps_ctx *ctx, const float mag_data[3], const float Pos[3], const float Vel[3], float BaroAlt, uint16_t SensorsUsed);
+void insgps_pos_correction(struct insgps_ctx *ctx, const float Pos[3], uint16_t SensorsUsed);
+void insgps_vel_correction(struct insgps_ctx *ctx, const float Vel[3], uint16_t SensorsUsed);
+void insgps_mag_correction(struct insgps_ctx *ctx, const float mag_data[3]);
+void insgps_baro_correction(struct insgps_ctx *ctx, float BaroAlt);
+void insgps_get_state(struct insgps_ctx *ctx, float *pos, float *vel, float *attitude, float *gyro_bias, float *accel_bias);
+void insgps_set_armed(struct insgps_ctx *ctx, bool armed);
+void insgps_reset_p(struct insgps_ctx *ctx, const float *PDiag);
+void insgps_set_state(struct insgps_ctx *ctx, const float pos[3], const float vel[3], const float q[4], const float gyro_bias[3], const float accel_bias[3]);
+void insgps_set_pos_vel_var(struct insgps_ctx *ctx, float PosVar, float VelVar, float VertPosVar);
+void insgps_set_gyro_bias(struct insgps_ctx *ctx, const float gyro_bias[3]);
+void insgps_set_accel_bias(struct insgps_ctx *ctx, const float accel_bias[3]);
+void insgps_set_accel_var(struct insgps_ctx *ctx, const float accel_var[3]);
+void insgps_set_gyro_var(struct insgps_ctx *ctx, const float gyro_var[3]);
+void insgps_set_mag_north(struct insgps_ctx *ctx, const float B[3]);
+void insgps_set_mag_var(struct insgps_ctx *ctx, const float scaled_mag_var[3]);
+void insgps_set_baro_var(struct insgps_ctx *ctx, float baro_var);
+void insgps_pos_vel_reset(struct insgps_ctx *ctx, const float pos[3], const float vel[3]);
+void insgps_get_variance(struct insgps_ctx *ctx, float *p);
+
 #endif /* INSGPS_H_ */
 
 /**
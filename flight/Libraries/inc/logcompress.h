@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       logcompress.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Delta coding and LZ4 format block compression for logs
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef LOGCOMPRESS_H
+#define LOGCOMPRESS_H
+
+#include <stdint.h>
+
+//! Entries in the match finder table passed to logcompress_block
+#define LOGCOMPRESS_HASH_BITS 8
+#define LOGCOMPRESS_HASH_ENTRIES (1 << LOGCOMPRESS_HASH_BITS)
+
+//! Largest output logcompress_block can produce for len bytes
+#define LOGCOMPRESS_BOUND(len) ((len) + (len) / 255 + 16)
+
+uint16_t logcompress_delta(const uint8_t *data, uint8_t *prev, uint16_t len,
+		uint8_t *out);
+int32_t logcompress_undelta(const uint8_t *in, uint16_t in_len,
+		uint8_t *prev, uint16_t len);
+
+int32_t logcompress_block(const uint8_t *in, uint16_t len,
+		uint8_t *out, uint16_t out_size, uint16_t *hash);
+int32_t logcompress_unblock(const uint8_t *in, uint16_t len,
+		uint8_t *out, uint16_t out_size);
+
+#endif // LOGCOMPRESS_H
+
+/**
+ * @}
+ */
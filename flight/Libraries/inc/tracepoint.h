@@ -0,0 +1,56 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       tracepoint.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Timestamped tracepoints along the control path
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef TRACEPOINT_H
+#define TRACEPOINT_H
+
+#include "traceevents.h"
+
+//! The tracepoints, numbered as in TraceEvents.Point
+enum tracepoint_id {
+	TRACE_GYRO_RECEIVE = TRACEEVENTS_POINT_GYRORECEIVE,
+	TRACE_INS_PREDICT = TRACEEVENTS_POINT_INSPREDICT,
+	TRACE_PID_COMPUTE = TRACEEVENTS_POINT_PIDCOMPUTE,
+	TRACE_MIXER = TRACEEVENTS_POINT_MIXER,
+	TRACE_SERVO_UPDATE = TRACEEVENTS_POINT_SERVOUPDATE,
+};
+
+#if defined(DIAG_TRACE)
+int32_t TracepointInitialize(void);
+void Tracepoint(enum tracepoint_id point);
+
+#define TRACEPOINT(point) Tracepoint(point)
+#else
+#define TRACEPOINT(point) do { } while (0)
+#endif /* DIAG_TRACE */
+
+#endif // TRACEPOINT_H
+
+/**
+ * @}
+ */
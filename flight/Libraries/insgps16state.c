@@ -40,6 +40,10 @@
 #define NUMW 12			// number of plant noise inputs, w is disturbance noise vector
 #define NUMV 10			// number of measurements, v is the measurement noise vector
 #define NUMU 6			// number of deterministic inputs, U is the input vector
+#define NUMP (NUMX * (NUMX + 1) / 2)	// number of unique elements of the symmetric P
+
+// Offset of P(i,j), i <= j, in the row by row packed upper triangle of P
+#define PIDX(i, j) ((i) * (2 * NUMX - (i) - 1) / 2 + (j))
 
 #if defined(GENERAL_COV)
 // This might trick people so I have a note here.  There is a slower but bigger version of the 
@@ -49,24 +53,31 @@
 
 // Private functions
 void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
-			  float Q[NUMW], float dT, float P[NUMX][NUMX]);
+			  float Q[NUMW], float dT, const float D[NUMP], float P[restrict NUMP]);
 void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
-		  float Y[NUMV], float P[NUMX][NUMX], float X[NUMX],
-		  uint16_t SensorsUsed);
+		  float Y[NUMV], float P[NUMP], float X[NUMX],
+		  float K[NUMX][NUMV], uint16_t SensorsUsed);
 void RungeKutta(float X[NUMX], float U[NUMU], float dT);
 void StateEq(float X[NUMX], float U[NUMU], float Xdot[NUMX]);
 void LinearizeFG(float X[NUMX], float U[NUMU], float F[NUMX][NUMX],
 		 float G[NUMX][NUMW]);
-void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV]);
-void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX]);
+void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV], uint16_t SensorsUsed);
+void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX], uint16_t SensorsUsed);
 
 // Private variables
-float F[NUMX][NUMX], G[NUMX][NUMW], H[NUMV][NUMX];	// linearized system matrices
-													// global to init to zero and maintain zero elements
-float Be[3];			// local magnetic unit vector in NED frame
-float P[NUMX][NUMX], X[NUMX];	// covariance matrix and state vector
-float Q[NUMW], R[NUMV];		// input noise and measurement noise variances
-float K[NUMX][NUMV];		// feedback gain matrix
+//! Everything the filter keeps between calls
+struct insgps_ctx {
+	float F[NUMX][NUMX], G[NUMX][NUMW], H[NUMV][NUMX];	// linearized system matrices
+	float Be[3];			// local magnetic unit vector in NED frame
+	float P[2][NUMP];		// packed covariance, P[Pcur] is current
+	uint8_t Pcur;
+	float X[NUMX];			// state vector
+	float Q[NUMW], R[NUMV];		// input noise and measurement noise variances
+	float K[NUMX][NUMV];		// feedback gain matrix
+};
+
+//! The filter behind the INS* calls used by the flight code
+static struct insgps_ctx default_ctx;
 
 //  *************  Exposed Functions ****************
 //  *************************************************
@@ -76,68 +87,78 @@ uint16_t ins_get_num_states()
 	return NUMX;
 }
 
-void INSGPSInit()		//pretty much just a place holder for now
+//! Size of a filter context, for callers that run several filters
+size_t insgps_ctx_size()
 {
-	Be[0] = 1.0f;
-	Be[1] = 0;
-	Be[2] = 0;		// local magnetic unit vector
+	return sizeof(struct insgps_ctx);
+}
+
+void insgps_init(struct insgps_ctx *ctx)		//pretty much just a place holder for now
+{
+	float *P = ctx->P[0];
+
+	ctx->Be[0] = 1.0f;
+	ctx->Be[1] = 0;
+	ctx->Be[2] = 0;		// local magnetic unit vector
 
 	for (int i = 0; i < NUMX; i++) {
 		for (int j = 0; j < NUMX; j++) {
-			P[i][j] = 0.0f; // zero all terms
-			F[i][j] = 0.0f;
+			ctx->F[i][j] = 0.0f;
 		}
 		for (int j = 0; j < NUMW; j++)
-			G[i][j] = 0.0f;
+			ctx->G[i][j] = 0.0f;
 			
 		for (int j = 0; j < NUMV; j++) {
-			H[j][i] = 0.0f;
-			K[i][j] = 0.0f;
+			ctx->H[j][i] = 0.0f;
+			ctx->K[i][j] = 0.0f;
 		}
 			
-		X[i] = 0.0f;
+		ctx->X[i] = 0.0f;
 	}
 	for (int i = 0; i < NUMW; i++)
-		Q[i] = 0.0f;
+		ctx->Q[i] = 0.0f;
 	for (int i = 0; i < NUMV; i++) 
-		R[i] = 0.0f;
+		ctx->R[i] = 0.0f;
+	for (int i = 0; i < NUMP; i++)
+		P[i] = 0.0f;	// zero all terms
+	ctx->Pcur = 0;
 	
-	P[0][0] = P[1][1] = P[2][2] = 25.0f;	// initial position variance (m^2)
-	P[3][3] = P[4][4] = P[5][5] = 5.0f;	// initial velocity variance (m/s)^2
-	P[6][6] = P[7][7] = P[8][8] = P[9][9] = 1e-5f;	// initial quaternion variance
-	P[10][10] = P[11][11] = P[12][12] = 1e-6f;	// initial gyro bias variance (rad/s)^2
-	P[13][13] = P[14][14] = P[15][15] = 1e-5f;	// initial accel bias variance (deg/s)^2
-
-	X[0] = X[1] = X[2] = X[3] = X[4] = X[5] = 0.0f;	// initial pos and vel (m)
-	X[6] = 1.0f;
-	X[7] = X[8] = X[9] = 0.0f;	    // initial quaternion (level and North) (m/s)
-	X[10] = X[11] = X[12] = 0.0f;	// initial gyro bias (rad/s)
-	X[13] = X[14] = X[15] = 0.0f;	// initial accel bias
-
-	Q[0] = Q[1] = Q[2] = 1e-5f;	    // gyro noise variance (rad/s)^2
-	Q[3] = Q[4] = Q[5] = 1e-5f;	    // accelerometer noise variance (m/s^2)^2
-	Q[6] = Q[7]        = 1e-6f;	    // gyro x and y bias random walk variance (rad/s^2)^2
-	Q[8]               = 1e-6f;	    // gyro z bias random walk variance (rad/s^2)^2
-	Q[9] = Q[10] = Q[11] = 5e-4f;	                // accel bias random walk variance (m/s^3)^2
-
-	R[0] = R[1] = 0.004f;	// High freq GPS horizontal position noise variance (m^2)
-	R[2] = 0.036f;		// High freq GPS vertical position noise variance (m^2)
-	R[3] = R[4] = 0.004f;	// High freq GPS horizontal velocity noise variance (m/s)^2
-	R[5] = 100.0f;		// High freq GPS vertical velocity noise variance (m/s)^2
-	R[6] = R[7] = R[8] = 0.005f;	// magnetometer unit vector noise variance
-	R[9] = .05f;		// High freq altimeter noise variance (m^2)
+	P[PIDX(0, 0)] = P[PIDX(1, 1)] = P[PIDX(2, 2)] = 25.0f;	// initial position variance (m^2)
+	P[PIDX(3, 3)] = P[PIDX(4, 4)] = P[PIDX(5, 5)] = 5.0f;	// initial velocity variance (m/s)^2
+	P[PIDX(6, 6)] = P[PIDX(7, 7)] = P[PIDX(8, 8)] = P[PIDX(9, 9)] = 1e-5f;	// initial quaternion variance
+	P[PIDX(10, 10)] = P[PIDX(11, 11)] = P[PIDX(12, 12)] = 1e-6f;	// initial gyro bias variance (rad/s)^2
+	P[PIDX(13, 13)] = P[PIDX(14, 14)] = P[PIDX(15, 15)] = 1e-5f;	// initial accel bias variance (deg/s)^2
+
+	ctx->X[0] = ctx->X[1] = ctx->X[2] = ctx->X[3] = ctx->X[4] = ctx->X[5] = 0.0f;	// initial pos and vel (m)
+	ctx->X[6] = 1.0f;
+	ctx->X[7] = ctx->X[8] = ctx->X[9] = 0.0f;	    // initial quaternion (level and North) (m/s)
+	ctx->X[10] = ctx->X[11] = ctx->X[12] = 0.0f;	// initial gyro bias (rad/s)
+	ctx->X[13] = ctx->X[14] = ctx->X[15] = 0.0f;	// initial accel bias
+
+	ctx->Q[0] = ctx->Q[1] = ctx->Q[2] = 1e-5f;	    // gyro noise variance (rad/s)^2
+	ctx->Q[3] = ctx->Q[4] = ctx->Q[5] = 1e-5f;	    // accelerometer noise variance (m/s^2)^2
+	ctx->Q[6] = ctx->Q[7]        = 1e-6f;	    // gyro x and y bias random walk variance (rad/s^2)^2
+	ctx->Q[8]               = 1e-6f;	    // gyro z bias random walk variance (rad/s^2)^2
+	ctx->Q[9] = ctx->Q[10] = ctx->Q[11] = 5e-4f;	                // accel bias random walk variance (m/s^3)^2
+
+	ctx->R[0] = ctx->R[1] = 0.004f;	// High freq GPS horizontal position noise variance (m^2)
+	ctx->R[2] = 0.036f;		// High freq GPS vertical position noise variance (m^2)
+	ctx->R[3] = ctx->R[4] = 0.004f;	// High freq GPS horizontal velocity noise variance (m/s)^2
+	ctx->R[5] = 100.0f;		// High freq GPS vertical velocity noise variance (m/s)^2
+	ctx->R[6] = ctx->R[7] = ctx->R[8] = 0.005f;	// magnetometer unit vector noise variance
+	ctx->R[9] = .05f;		// High freq altimeter noise variance (m^2)
 }
 
 //! Set the current flight state
-void INSSetArmed(bool armed)
+void insgps_set_armed(struct insgps_ctx *ctx, bool armed)
 {
 	// Speed up convergence of accel and gyro bias when not armed
 	if (armed) {
-		Q[11] = 1e-5f;
-		Q[8] = 2e-4f;
+		ctx->Q[11] = 1e-5f;
+		ctx->Q[8] = 2e-4f;
 	} else {
-		Q[11] = 1e-2f;
-		Q[8] = 2e-8f;
+		ctx->Q[11] = 1e-2f;
+		ctx->Q[8] = 2e-8f;
 	}
 
 
@@ -152,37 +173,37 @@ void INSSetArmed(bool armed)
  * @param[out] gyros_bias Estimate of gyro bias (rad/s)
  * @param[out] accel_bias Estiamte of the accel bias (m/s^2)
  */
-void INSGetState(float *pos, float *vel, float *attitude, float *gyro_bias, float *accel_bias)
+void insgps_get_state(struct insgps_ctx *ctx, float *pos, float *vel, float *attitude, float *gyro_bias, float *accel_bias)
 {
        if (pos) {
-               pos[0] = X[0];
-               pos[1] = X[1];
-               pos[2] = X[2];
+               pos[0] = ctx->X[0];
+               pos[1] = ctx->X[1];
+               pos[2] = ctx->X[2];
        }
 
        if (vel) {
-               vel[0] = X[3];
-               vel[1] = X[4];
-               vel[2] = X[5];
+               vel[0] = ctx->X[3];
+               vel[1] = ctx->X[4];
+               vel[2] = ctx->X[5];
        }
 
        if (attitude) {
-               attitude[0] = X[6];
-               attitude[1] = X[7];
-               attitude[2] = X[8];
-               attitude[3] = X[9];
+               attitude[0] = ctx->X[6];
+               attitude[1] = ctx->X[7];
+               attitude[2] = ctx->X[8];
+               attitude[3] = ctx->X[9];
        }
 
        if (gyro_bias) {
-               gyro_bias[0] = X[10];
-               gyro_bias[1] = X[11];
-               gyro_bias[2] = X[12];
+               gyro_bias[0] = ctx->X[10];
+               gyro_bias[1] = ctx->X[11];
+               gyro_bias[2] = ctx->X[12];
        }
 
        if (accel_bias) {
-               accel_bias[0] = X[13];
-               accel_bias[1] = X[14];
-               accel_bias[2] = X[15];
+               accel_bias[0] = ctx->X[13];
+               accel_bias[1] = ctx->X[14];
+               accel_bias[2] = ctx->X[15];
        }
 }
 
@@ -190,124 +211,128 @@ void INSGetState(float *pos, float *vel, float *attitude, float *gyro_bias, floa
  * Get the variance, for visualizing the filter performance
  * @param[out var_out The variances
  */
-void INSGetVariance(float *var_out)
- {
+void insgps_get_variance(struct insgps_ctx *ctx, float *var_out)
+{
    for (uint32_t i = 0; i < NUMX; i++)
-           var_out[i] = P[i][i];
+           var_out[i] = ctx->P[ctx->Pcur][PIDX(i, i)];
  }
  
-void INSResetP(const float *PDiag)
+void insgps_reset_p(struct insgps_ctx *ctx, const float *PDiag)
 {
+	float *P = ctx->P[ctx->Pcur];
 	uint8_t i,j;
 
 	// if PDiag[i] nonzero then clear row and column and set diagonal element
 	for (i=0;i<NUMX;i++){
 		if (PDiag != 0){
-			for (j=0;j<NUMX;j++)
-				P[i][j]=P[j][i]=0.0f;
-			P[i][i]=PDiag[i];
+			for (j=0;j<i;j++)
+				P[PIDX(j,i)]=0.0f;
+			for (j=i+1;j<NUMX;j++)
+				P[PIDX(i,j)]=0.0f;
+			P[PIDX(i,i)]=PDiag[i];
 		}
 	}
 }
 
-void INSSetState(const float pos[3], const float vel[3], const float q[4], const float gyro_bias[3], const float accel_bias[3])
+void insgps_set_state(struct insgps_ctx *ctx, const float pos[3], const float vel[3], const float q[4], const float gyro_bias[3], const float accel_bias[3])
 {
-	X[0] = pos[0];
-	X[1] = pos[1];
-	X[2] = pos[2];
-	X[3] = vel[0];
-	X[4] = vel[1];
-	X[5] = vel[2];
-	X[6] = q[0];
-	X[7] = q[1];
-	X[8] = q[2];
-	X[9] = q[3];
-	X[10] = gyro_bias[0];
-	X[11] = gyro_bias[1];
-	X[12] = gyro_bias[2];
-	X[13] = accel_bias[0];
-	X[14] = accel_bias[1];
-	X[15] = accel_bias[2];
-}
-
-void INSPosVelReset(const float pos[3], const float vel[3]) 
+	ctx->X[0] = pos[0];
+	ctx->X[1] = pos[1];
+	ctx->X[2] = pos[2];
+	ctx->X[3] = vel[0];
+	ctx->X[4] = vel[1];
+	ctx->X[5] = vel[2];
+	ctx->X[6] = q[0];
+	ctx->X[7] = q[1];
+	ctx->X[8] = q[2];
+	ctx->X[9] = q[3];
+	ctx->X[10] = gyro_bias[0];
+	ctx->X[11] = gyro_bias[1];
+	ctx->X[12] = gyro_bias[2];
+	ctx->X[13] = accel_bias[0];
+	ctx->X[14] = accel_bias[1];
+	ctx->X[15] = accel_bias[2];
+}
+
+void insgps_pos_vel_reset(struct insgps_ctx *ctx, const float pos[3], const float vel[3])
 {
+	float *P = ctx->P[ctx->Pcur];
+
 	for (int i = 0; i < 6; i++) {
 		for(int j = i; j < NUMX; j++) {
-			P[i][j] = 0.0f;  // zero the first 6 rows and columns
-			P[j][i] = 0.0f; 
+			P[PIDX(i, j)] = 0.0f;  // zero the first 6 rows and columns
 		}
 	}
 	
-	P[0][0] = P[1][1] = P[2][2] = 25.0f;	// initial position variance (m^2)
-	P[3][3] = P[4][4] = P[5][5] = 5.0f;	// initial velocity variance (m/s)^2
+	P[PIDX(0, 0)] = P[PIDX(1, 1)] = P[PIDX(2, 2)] = 25.0f;	// initial position variance (m^2)
+	P[PIDX(3, 3)] = P[PIDX(4, 4)] = P[PIDX(5, 5)] = 5.0f;	// initial velocity variance (m/s)^2
 	
-	X[0] = pos[0];
-	X[1] = pos[1];
-	X[2] = pos[2];
-	X[3] = vel[0];
-	X[4] = vel[1];
-	X[5] = vel[2];	
+	ctx->X[0] = pos[0];
+	ctx->X[1] = pos[1];
+	ctx->X[2] = pos[2];
+	ctx->X[3] = vel[0];
+	ctx->X[4] = vel[1];
+	ctx->X[5] = vel[2];	
 }
 
-void INSSetPosVelVar(float PosVar, float VelVar, float VertPosVar)
+void insgps_set_pos_vel_var(struct insgps_ctx *ctx, float PosVar, float VelVar, float VertPosVar)
 {
-	R[0] = PosVar;
-	R[1] = PosVar;
-	R[2] = VertPosVar;
-	R[3] = VelVar;
-	R[4] = VelVar;
-	R[5] = VelVar;  // Don't change vertical velocity, not measured
+	ctx->R[0] = PosVar;
+	ctx->R[1] = PosVar;
+	ctx->R[2] = VertPosVar;
+	ctx->R[3] = VelVar;
+	ctx->R[4] = VelVar;
+	ctx->R[5] = VelVar;  // Don't change vertical velocity, not measured
 }
 
-void INSSetGyroBias(const float gyro_bias[3])
+void insgps_set_gyro_bias(struct insgps_ctx *ctx, const float gyro_bias[3])
 {
-	X[10] = gyro_bias[0];
-	X[11] = gyro_bias[1];
-	X[12] = gyro_bias[2];
+	ctx->X[10] = gyro_bias[0];
+	ctx->X[11] = gyro_bias[1];
+	ctx->X[12] = gyro_bias[2];
 }
 
-void INSSetAccelBias(const float accel_bias[3])
+void insgps_set_accel_bias(struct insgps_ctx *ctx, const float accel_bias[3])
 {
-	X[13] = accel_bias[0];
-	X[14] = accel_bias[1];
-	X[15] = accel_bias[2];
+	ctx->X[13] = accel_bias[0];
+	ctx->X[14] = accel_bias[1];
+	ctx->X[15] = accel_bias[2];
 }
 
-void INSSetAccelVar(const float accel_var[3])
+void insgps_set_accel_var(struct insgps_ctx *ctx, const float accel_var[3])
 {
-	Q[3] = accel_var[0];
-	Q[4] = accel_var[1];
-	Q[5] = accel_var[2];
+	ctx->Q[3] = accel_var[0];
+	ctx->Q[4] = accel_var[1];
+	ctx->Q[5] = accel_var[2];
 }
 
-void INSSetGyroVar(const float gyro_var[3])
+void insgps_set_gyro_var(struct insgps_ctx *ctx, const float gyro_var[3])
 {
-	Q[0] = gyro_var[0];
-	Q[1] = gyro_var[1];
-	Q[2] = gyro_var[2];
+	ctx->Q[0] = gyro_var[0];
+	ctx->Q[1] = gyro_var[1];
+	ctx->Q[2] = gyro_var[2];
 }
 
-void INSSetMagVar(const float scaled_mag_var[3])
+void insgps_set_mag_var(struct insgps_ctx *ctx, const float scaled_mag_var[3])
 {
-	R[6] = scaled_mag_var[0];
-	R[7] = scaled_mag_var[1];
-	R[8] = scaled_mag_var[2];
+	ctx->R[6] = scaled_mag_var[0];
+	ctx->R[7] = scaled_mag_var[1];
+	ctx->R[8] = scaled_mag_var[2];
 }
 
-void INSSetBaroVar(const float baro_var)
+void insgps_set_baro_var(struct insgps_ctx *ctx, const float baro_var)
 {
-	R[9] = baro_var;
+	ctx->R[9] = baro_var;
 }
 
-void INSSetMagNorth(const float B[3])
+void insgps_set_mag_north(struct insgps_ctx *ctx, const float B[3])
 {
-	Be[0] = B[0];
-	Be[1] = B[1];
-	Be[2] = B[2];
+	ctx->Be[0] = B[0];
+	ctx->Be[1] = B[1];
+	ctx->Be[2] = B[2];
 }
 
-void INSStatePrediction(const float gyro_data[3], const float accel_data[3], float dT)
+void insgps_state_prediction(struct insgps_ctx *ctx, const float gyro_data[3], const float accel_data[3], float dT)
 {
 	float U[6];
 	float qmag;
@@ -323,43 +348,48 @@ void INSStatePrediction(const float gyro_data[3], const float accel_data[3], flo
 	U[5] = accel_data[2];
 
 	// EKF prediction step
-	LinearizeFG(X, U, F, G);
-	RungeKutta(X, U, dT);
-	qmag = sqrtf(X[6] * X[6] + X[7] * X[7] + X[8] * X[8] + X[9] * X[9]);
-	X[6] /= qmag;
-	X[7] /= qmag;
-	X[8] /= qmag;
-	X[9] /= qmag;
+	LinearizeFG(ctx->X, U, ctx->F, ctx->G);
+	RungeKutta(ctx->X, U, dT);
+	qmag = sqrtf(ctx->X[6] * ctx->X[6] + ctx->X[7] * ctx->X[7] + ctx->X[8] * ctx->X[8] + ctx->X[9] * ctx->X[9]);
+	ctx->X[6] /= qmag;
+	ctx->X[7] /= qmag;
+	ctx->X[8] /= qmag;
+	ctx->X[9] /= qmag;
 }
 
-void INSCovariancePrediction(float dT)
+void insgps_covariance_prediction(struct insgps_ctx *ctx, float dT)
 {
-	CovariancePrediction(F, G, Q, dT, P);
+	CovariancePrediction(ctx->F, ctx->G, ctx->Q, dT, ctx->P[ctx->Pcur], ctx->P[!ctx->Pcur]);
+	ctx->Pcur = !ctx->Pcur;
 }
 
-void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[3],
+void insgps_correction(struct insgps_ctx *ctx, const float mag_data[3], const float Pos[3], const float Vel[3],
 		   float BaroAlt, uint16_t SensorsUsed)
 {
 	float Z[10], Y[10];
 	float qmag;
 
 	// GPS Position in meters and in local NED frame
-	Z[0] = Pos[0];
-	Z[1] = Pos[1];
-	Z[2] = Pos[2];
+	if (SensorsUsed & POS_SENSORS) {
+		Z[0] = Pos[0];
+		Z[1] = Pos[1];
+		Z[2] = Pos[2];
+	}
 
 	// GPS Velocity in meters and in local NED frame
-	Z[3] = Vel[0];
-	Z[4] = Vel[1];
-	Z[5] = Vel[2];
+	if (SensorsUsed & (HORIZ_VEL_SENSORS | VERT_VEL_SENSORS)) {
+		Z[3] = Vel[0];
+		Z[4] = Vel[1];
+		Z[5] = Vel[2];
+	}
 
 	if (SensorsUsed & MAG_SENSORS) {
 		// magnetometer data in any units (use unit vector) and in body frame
 		float Rbe_a[3][3];
-		float q0 = X[6];
-		float q1 = X[7];
-		float q2 = X[8];
-		float q3 = X[9];
+		float q0 = ctx->X[6];
+		float q1 = ctx->X[7];
+		float q2 = ctx->X[8];
+		float q3 = ctx->X[9];
 		float k1 = 1.0f/sqrtf(powf(q0*q1*2.0f+q2*q3*2.0f,2.0f)+powf(q0*q0-q1*q1-q2*q2+q3*q3,2.0f));
 		float k2 = sqrtf(-powf(q0*q2*2.0f-q1*q3*2.0f,2.0f)+1.0f);
 
@@ -379,22 +409,50 @@ void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[
 	}
 
 	// barometric altimeter in meters and in local NED frame
-	Z[9] = BaroAlt;
+	if (SensorsUsed & BARO_SENSOR)
+		Z[9] = BaroAlt;
 
 	// EKF correction step
-	LinearizeH(X, Be, H);
-	MeasurementEq(X, Be, Y);
-	SerialUpdate(H, R, Z, Y, P, X, SensorsUsed);
-	qmag = sqrtf(X[6] * X[6] + X[7] * X[7] + X[8] * X[8] + X[9] * X[9]);
-	X[6] /= qmag;
-	X[7] /= qmag;
-	X[8] /= qmag;
-	X[9] /= qmag;
+	LinearizeH(ctx->X, ctx->Be, ctx->H, SensorsUsed);
+	MeasurementEq(ctx->X, ctx->Be, Y, SensorsUsed);
+	SerialUpdate(ctx->H, ctx->R, Z, Y, ctx->P[ctx->Pcur], ctx->X, ctx->K, SensorsUsed);
+	qmag = sqrtf(ctx->X[6] * ctx->X[6] + ctx->X[7] * ctx->X[7] + ctx->X[8] * ctx->X[8] + ctx->X[9] * ctx->X[9]);
+	ctx->X[6] /= qmag;
+	ctx->X[7] /= qmag;
+	ctx->X[8] /= qmag;
+	ctx->X[9] /= qmag;
+}
+
+//  Corrections from one group of sensors.  Only that group's rows of H and
+//  the predicted measurement are computed, so e.g. a baro update does not
+//  pay for linearizing the magnetometer.
+
+void insgps_pos_correction(struct insgps_ctx *ctx, const float Pos[3], uint16_t SensorsUsed)
+{
+	insgps_correction(ctx, NULL, Pos, NULL, 0.0f, SensorsUsed & POS_SENSORS);
+}
+
+void insgps_vel_correction(struct insgps_ctx *ctx, const float Vel[3], uint16_t SensorsUsed)
+{
+	insgps_correction(ctx, NULL, NULL, Vel, 0.0f, SensorsUsed & (HORIZ_VEL_SENSORS | VERT_VEL_SENSORS));
+}
+
+void insgps_mag_correction(struct insgps_ctx *ctx, const float mag_data[3])
+{
+	insgps_correction(ctx, mag_data, NULL, NULL, 0.0f, MAG_SENSORS);
+}
+
+void insgps_baro_correction(struct insgps_ctx *ctx, float BaroAlt)
+{
+	insgps_correction(ctx, NULL, NULL, NULL, BaroAlt, BARO_SENSOR);
 }
 
 //  *************  CovariancePrediction *************
 //  Does the prediction step of the Kalman filter for the covariance matrix
-//  Output, Pnew, overwrites P, the input covariance
+//  Output, Pnew, is written to P from D, the input covariance
+//  Both are stored as the packed upper triangle, see PIDX
+//  P and D must not overlap, so stores to P do not force the compiler to
+//    reload D, F and G
 //  Pnew = (I+F*T)*P*(I+F*T)' + T^2*G*Q*G'
 //  Q is the discrete time covariance of process noise
 //  Q is vector of the diagonal for a square matrix with
@@ -405,10 +463,13 @@ void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[
 
 #ifdef COVARIANCE_PREDICTION_GENERAL
 
+// Offset of P(i,j) for any i and j
+#define PSYM(i, j) ((i) <= (j) ? PIDX(i, j) : PIDX(j, i))
+
 void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
-			  float Q[NUMW], float dT, float P[NUMX][NUMX])
+			  float Q[NUMW], float dT, const float D[NUMP], float P[restrict NUMP])
 {
-	float Dummy[NUMX][NUMX], dTsq;
+	float Dummy[NUMX][NUMX], Pij, dTsq;
 	uint8_t i, j, k;
 
 	//  Pnew = (I+F*T)*P*(I+F*T)' + T^2*G*Q*G' = T^2[(P/T + F*P)*(I/T + F') + G*Q*G')]
@@ -417,175 +478,170 @@ void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
 
 	for (i = 0; i < NUMX; i++)	// Calculate Dummy = (P/T +F*P)
 		for (j = 0; j < NUMX; j++) {
-			Dummy[i][j] = P[i][j] / dT;
+			Dummy[i][j] = D[PSYM(i, j)] / dT;
 			for (k = 0; k < NUMX; k++)
-				Dummy[i][j] += F[i][k] * P[k][j];
+				Dummy[i][j] += F[i][k] * D[PSYM(k, j)];
 		}
 	for (i = 0; i < NUMX; i++)	// Calculate Pnew = Dummy/T + Dummy*F' + G*Qw*G'
 		for (j = i; j < NUMX; j++) {	// Use symmetry, ie only find upper triangular
-			P[i][j] = Dummy[i][j] / dT;
+			Pij = Dummy[i][j] / dT;
 			for (k = 0; k < NUMX; k++)
-				P[i][j] += Dummy[i][k] * F[j][k];	// P = Dummy/T + Dummy*F'
+				Pij += Dummy[i][k] * F[j][k];	// P = Dummy/T + Dummy*F'
 			for (k = 0; k < NUMW; k++)
-				P[i][j] += Q[k] * G[i][k] * G[j][k];	// P = Dummy/T + Dummy*F' + G*Q*G'
-			P[j][i] = P[i][j] = P[i][j] * dTsq;	// Pnew = T^2*P and fill in lower triangular;
+				Pij += Q[k] * G[i][k] * G[j][k];	// P = Dummy/T + Dummy*F' + G*Q*G'
+			P[PIDX(i, j)] = Pij * dTsq;	// Pnew = T^2*P
 		}
 }
 
 #else
 
 void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
-			  float Q[NUMW], float dT, float P[NUMX][NUMX])
+			  float Q[NUMW], float dT, const float D[NUMP], float P[restrict NUMP])
 {
-	float D[NUMX][NUMX], T, Tsq;
-	uint8_t i, j;
+	float T, Tsq;
 
 	//  Pnew = (I+F*T)*P*(I+F*T)' + T^2*G*Q*G' = scalar expansion from symbolic manipulator
 
 	T = dT;
 	Tsq = dT * dT;
 
-	for (i = 0; i < NUMX; i++)	// Create a copy of the upper triangular of P
-		for (j = i; j < NUMX; j++)
-			D[i][j] = P[i][j];
-
 	// Brute force calculation of the elements of P
-	P[0][0] = D[3][3]*Tsq + (2*D[0][3])*T + D[0][0];
-	P[0][1] = P[1][0] = D[3][4]*Tsq + (D[0][4] + D[1][3])*T + D[0][1];
-	P[0][2] = P[2][0] = D[3][5]*Tsq + (D[0][5] + D[2][3])*T + D[0][2];
-	P[0][3] = P[3][0] = (F[3][6]*D[3][6] + F[3][7]*D[3][7] + F[3][8]*D[3][8] + F[3][9]*D[3][9] + F[3][13]*D[3][13] + F[3][14]*D[3][14] + F[3][15]*D[3][15])*Tsq + (D[3][3] + F[3][6]*D[0][6] + F[3][7]*D[0][7] + F[3][8]*D[0][8] + F[3][9]*D[0][9] + F[3][13]*D[0][13] + F[3][14]*D[0][14] + F[3][15]*D[0][15])*T + D[0][3];
-	P[0][4] = P[4][0] = (F[4][6]*D[3][6] + F[4][7]*D[3][7] + F[4][8]*D[3][8] + F[4][9]*D[3][9] + F[4][13]*D[3][13] + F[4][14]*D[3][14] + F[4][15]*D[3][15])*Tsq + (D[3][4] + F[4][6]*D[0][6] + F[4][7]*D[0][7] + F[4][8]*D[0][8] + F[4][9]*D[0][9] + F[4][13]*D[0][13] + F[4][14]*D[0][14] + F[4][15]*D[0][15])*T + D[0][4];
-	P[0][5] = P[5][0] = (F[5][6]*D[3][6] + F[5][7]*D[3][7] + F[5][8]*D[3][8] + F[5][9]*D[3][9] + F[5][13]*D[3][13] + F[5][14]*D[3][14] + F[5][15]*D[3][15])*Tsq + (D[3][5] + F[5][6]*D[0][6] + F[5][7]*D[0][7] + F[5][8]*D[0][8] + F[5][9]*D[0][9] + F[5][13]*D[0][13] + F[5][14]*D[0][14] + F[5][15]*D[0][15])*T + D[0][5];
-	P[0][6] = P[6][0] = (F[6][7]*D[3][7] + F[6][8]*D[3][8] + F[6][9]*D[3][9] + F[6][10]*D[3][10] + F[6][11]*D[3][11] + F[6][12]*D[3][12])*Tsq + (D[3][6] + F[6][7]*D[0][7] + F[6][8]*D[0][8] + F[6][9]*D[0][9] + F[6][10]*D[0][10] + F[6][11]*D[0][11] + F[6][12]*D[0][12])*T + D[0][6];
-	P[0][7] = P[7][0] = (F[7][6]*D[3][6] + F[7][8]*D[3][8] + F[7][9]*D[3][9] + F[7][10]*D[3][10] + F[7][11]*D[3][11] + F[7][12]*D[3][12])*Tsq + (D[3][7] + F[7][6]*D[0][6] + F[7][8]*D[0][8] + F[7][9]*D[0][9] + F[7][10]*D[0][10] + F[7][11]*D[0][11] + F[7][12]*D[0][12])*T + D[0][7];
-	P[0][8] = P[8][0] = (F[8][6]*D[3][6] + F[8][7]*D[3][7] + F[8][9]*D[3][9] + F[8][10]*D[3][10] + F[8][11]*D[3][11] + F[8][12]*D[3][12])*Tsq + (D[3][8] + F[8][6]*D[0][6] + F[8][7]*D[0][7] + F[8][9]*D[0][9] + F[8][10]*D[0][10] + F[8][11]*D[0][11] + F[8][12]*D[0][12])*T + D[0][8];
-	P[0][9] = P[9][0] = (F[9][6]*D[3][6] + F[9][7]*D[3][7] + F[9][8]*D[3][8] + F[9][10]*D[3][10] + F[9][11]*D[3][11] + F[9][12]*D[3][12])*Tsq + (D[3][9] + F[9][6]*D[0][6] + F[9][7]*D[0][7] + F[9][8]*D[0][8] + F[9][10]*D[0][10] + F[9][11]*D[0][11] + F[9][12]*D[0][12])*T + D[0][9];
-	P[0][10] = P[10][0] = D[3][10]*T + D[0][10];
-	P[0][11] = P[11][0] = D[3][11]*T + D[0][11];
-	P[0][12] = P[12][0] = D[3][12]*T + D[0][12];
-	P[0][13] = P[13][0] = D[3][13]*T + D[0][13];
-	P[0][14] = P[14][0] = D[3][14]*T + D[0][14];
-	P[0][15] = P[15][0] = D[3][15]*T + D[0][15];
-	P[1][1] = D[4][4]*Tsq + (2*D[1][4])*T + D[1][1];
-	P[1][2] = P[2][1] = D[4][5]*Tsq + (D[1][5] + D[2][4])*T + D[1][2];
-	P[1][3] = P[3][1] = (F[3][6]*D[4][6] + F[3][7]*D[4][7] + F[3][8]*D[4][8] + F[3][9]*D[4][9] + F[3][13]*D[4][13] + F[3][14]*D[4][14] + F[3][15]*D[4][15])*Tsq + (D[3][4] + F[3][6]*D[1][6] + F[3][7]*D[1][7] + F[3][8]*D[1][8] + F[3][9]*D[1][9] + F[3][13]*D[1][13] + F[3][14]*D[1][14] + F[3][15]*D[1][15])*T + D[1][3];
-	P[1][4] = P[4][1] = (F[4][6]*D[4][6] + F[4][7]*D[4][7] + F[4][8]*D[4][8] + F[4][9]*D[4][9] + F[4][13]*D[4][13] + F[4][14]*D[4][14] + F[4][15]*D[4][15])*Tsq + (D[4][4] + F[4][6]*D[1][6] + F[4][7]*D[1][7] + F[4][8]*D[1][8] + F[4][9]*D[1][9] + F[4][13]*D[1][13] + F[4][14]*D[1][14] + F[4][15]*D[1][15])*T + D[1][4];
-	P[1][5] = P[5][1] = (F[5][6]*D[4][6] + F[5][7]*D[4][7] + F[5][8]*D[4][8] + F[5][9]*D[4][9] + F[5][13]*D[4][13] + F[5][14]*D[4][14] + F[5][15]*D[4][15])*Tsq + (D[4][5] + F[5][6]*D[1][6] + F[5][7]*D[1][7] + F[5][8]*D[1][8] + F[5][9]*D[1][9] + F[5][13]*D[1][13] + F[5][14]*D[1][14] + F[5][15]*D[1][15])*T + D[1][5];
-	P[1][6] = P[6][1] = (F[6][7]*D[4][7] + F[6][8]*D[4][8] + F[6][9]*D[4][9] + F[6][10]*D[4][10] + F[6][11]*D[4][11] + F[6][12]*D[4][12])*Tsq + (D[4][6] + F[6][7]*D[1][7] + F[6][8]*D[1][8] + F[6][9]*D[1][9] + F[6][10]*D[1][10] + F[6][11]*D[1][11] + F[6][12]*D[1][12])*T + D[1][6];
-	P[1][7] = P[7][1] = (F[7][6]*D[4][6] + F[7][8]*D[4][8] + F[7][9]*D[4][9] + F[7][10]*D[4][10] + F[7][11]*D[4][11] + F[7][12]*D[4][12])*Tsq + (D[4][7] + F[7][6]*D[1][6] + F[7][8]*D[1][8] + F[7][9]*D[1][9] + F[7][10]*D[1][10] + F[7][11]*D[1][11] + F[7][12]*D[1][12])*T + D[1][7];
-	P[1][8] = P[8][1] = (F[8][6]*D[4][6] + F[8][7]*D[4][7] + F[8][9]*D[4][9] + F[8][10]*D[4][10] + F[8][11]*D[4][11] + F[8][12]*D[4][12])*Tsq + (D[4][8] + F[8][6]*D[1][6] + F[8][7]*D[1][7] + F[8][9]*D[1][9] + F[8][10]*D[1][10] + F[8][11]*D[1][11] + F[8][12]*D[1][12])*T + D[1][8];
-	P[1][9] = P[9][1] = (F[9][6]*D[4][6] + F[9][7]*D[4][7] + F[9][8]*D[4][8] + F[9][10]*D[4][10] + F[9][11]*D[4][11] + F[9][12]*D[4][12])*Tsq + (D[4][9] + F[9][6]*D[1][6] + F[9][7]*D[1][7] + F[9][8]*D[1][8] + F[9][10]*D[1][10] + F[9][11]*D[1][11] + F[9][12]*D[1][12])*T + D[1][9];
-	P[1][10] = P[10][1] = D[4][10]*T + D[1][10];
-	P[1][11] = P[11][1] = D[4][11]*T + D[1][11];
-	P[1][12] = P[12][1] = D[4][12]*T + D[1][12];
-	P[1][13] = P[13][1] = D[4][13]*T + D[1][13];
-	P[1][14] = P[14][1] = D[4][14]*T + D[1][14];
-	P[1][15] = P[15][1] = D[4][15]*T + D[1][15];
-	P[2][2] = D[5][5]*Tsq + (2*D[2][5])*T + D[2][2];
-	P[2][3] = P[3][2] = (F[3][6]*D[5][6] + F[3][7]*D[5][7] + F[3][8]*D[5][8] + F[3][9]*D[5][9] + F[3][13]*D[5][13] + F[3][14]*D[5][14] + F[3][15]*D[5][15])*Tsq + (D[3][5] + F[3][6]*D[2][6] + F[3][7]*D[2][7] + F[3][8]*D[2][8] + F[3][9]*D[2][9] + F[3][13]*D[2][13] + F[3][14]*D[2][14] + F[3][15]*D[2][15])*T + D[2][3];
-	P[2][4] = P[4][2] = (F[4][6]*D[5][6] + F[4][7]*D[5][7] + F[4][8]*D[5][8] + F[4][9]*D[5][9] + F[4][13]*D[5][13] + F[4][14]*D[5][14] + F[4][15]*D[5][15])*Tsq + (D[4][5] + F[4][6]*D[2][6] + F[4][7]*D[2][7] + F[4][8]*D[2][8] + F[4][9]*D[2][9] + F[4][13]*D[2][13] + F[4][14]*D[2][14] + F[4][15]*D[2][15])*T + D[2][4];
-	P[2][5] = P[5][2] = (F[5][6]*D[5][6] + F[5][7]*D[5][7] + F[5][8]*D[5][8] + F[5][9]*D[5][9] + F[5][13]*D[5][13] + F[5][14]*D[5][14] + F[5][15]*D[5][15])*Tsq + (D[5][5] + F[5][6]*D[2][6] + F[5][7]*D[2][7] + F[5][8]*D[2][8] + F[5][9]*D[2][9] + F[5][13]*D[2][13] + F[5][14]*D[2][14] + F[5][15]*D[2][15])*T + D[2][5];
-	P[2][6] = P[6][2] = (F[6][7]*D[5][7] + F[6][8]*D[5][8] + F[6][9]*D[5][9] + F[6][10]*D[5][10] + F[6][11]*D[5][11] + F[6][12]*D[5][12])*Tsq + (D[5][6] + F[6][7]*D[2][7] + F[6][8]*D[2][8] + F[6][9]*D[2][9] + F[6][10]*D[2][10] + F[6][11]*D[2][11] + F[6][12]*D[2][12])*T + D[2][6];
-	P[2][7] = P[7][2] = (F[7][6]*D[5][6] + F[7][8]*D[5][8] + F[7][9]*D[5][9] + F[7][10]*D[5][10] + F[7][11]*D[5][11] + F[7][12]*D[5][12])*Tsq + (D[5][7] + F[7][6]*D[2][6] + F[7][8]*D[2][8] + F[7][9]*D[2][9] + F[7][10]*D[2][10] + F[7][11]*D[2][11] + F[7][12]*D[2][12])*T + D[2][7];
-	P[2][8] = P[8][2] = (F[8][6]*D[5][6] + F[8][7]*D[5][7] + F[8][9]*D[5][9] + F[8][10]*D[5][10] + F[8][11]*D[5][11] + F[8][12]*D[5][12])*Tsq + (D[5][8] + F[8][6]*D[2][6] + F[8][7]*D[2][7] + F[8][9]*D[2][9] + F[8][10]*D[2][10] + F[8][11]*D[2][11] + F[8][12]*D[2][12])*T + D[2][8];
-	P[2][9] = P[9][2] = (F[9][6]*D[5][6] + F[9][7]*D[5][7] + F[9][8]*D[5][8] + F[9][10]*D[5][10] + F[9][11]*D[5][11] + F[9][12]*D[5][12])*Tsq + (D[5][9] + F[9][6]*D[2][6] + F[9][7]*D[2][7] + F[9][8]*D[2][8] + F[9][10]*D[2][10] + F[9][11]*D[2][11] + F[9][12]*D[2][12])*T + D[2][9];
-	P[2][10] = P[10][2] = D[5][10]*T + D[2][10];
-	P[2][11] = P[11][2] = D[5][11]*T + D[2][11];
-	P[2][12] = P[12][2] = D[5][12]*T + D[2][12];
-	P[2][13] = P[13][2] = D[5][13]*T + D[2][13];
-	P[2][14] = P[14][2] = D[5][14]*T + D[2][14];
-	P[2][15] = P[15][2] = D[5][15]*T + D[2][15];
-	P[3][3] = (Q[3]*G[3][3]*G[3][3] + Q[4]*G[3][4]*G[3][4] + Q[5]*G[3][5]*G[3][5] + F[3][6]*(F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[3][8]*D[6][8] + F[3][9]*D[6][9] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15]) + F[3][7]*(F[3][6]*D[6][7] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[3][9]*D[7][9] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15]) + F[3][8]*(F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15]) + F[3][9]*(F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15]) + F[3][13]*(F[3][6]*D[6][13] + F[3][7]*D[7][13] + F[3][8]*D[8][13] + F[3][9]*D[9][13] + F[3][13]*D[13][13] + F[3][14]*D[13][14] + F[3][15]*D[13][15]) + F[3][14]*(F[3][6]*D[6][14] + F[3][7]*D[7][14] + F[3][8]*D[8][14] + F[3][9]*D[9][14] + F[3][13]*D[13][14] + F[3][14]*D[14][14] + F[3][15]*D[14][15]) + F[3][15]*(F[3][6]*D[6][15] + F[3][7]*D[7][15] + F[3][8]*D[8][15] + F[3][9]*D[9][15] + F[3][13]*D[13][15] + F[3][14]*D[14][15] + F[3][15]*D[15][15]))*Tsq + (2*F[3][6]*D[3][6] + 2*F[3][7]*D[3][7] + 2*F[3][8]*D[3][8] + 2*F[3][9]*D[3][9] + 2*F[3][13]*D[3][13] + 2*F[3][14]*D[3][14] + 2*F[3][15]*D[3][15])*T + D[3][3];
-	P[3][4] = P[4][3] = (F[4][6]*(F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[3][8]*D[6][8] + F[3][9]*D[6][9] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15]) + F[4][7]*(F[3][6]*D[6][7] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[3][9]*D[7][9] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15]) + F[4][8]*(F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15]) + F[4][9]*(F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15]) + F[4][13]*(F[3][6]*D[6][13] + F[3][7]*D[7][13] + F[3][8]*D[8][13] + F[3][9]*D[9][13] + F[3][13]*D[13][13] + F[3][14]*D[13][14] + F[3][15]*D[13][15]) + F[4][14]*(F[3][6]*D[6][14] + F[3][7]*D[7][14] + F[3][8]*D[8][14] + F[3][9]*D[9][14] + F[3][13]*D[13][14] + F[3][14]*D[14][14] + F[3][15]*D[14][15]) + F[4][15]*(F[3][6]*D[6][15] + F[3][7]*D[7][15] + F[3][8]*D[8][15] + F[3][9]*D[9][15] + F[3][13]*D[13][15] + F[3][14]*D[14][15] + F[3][15]*D[15][15]) + G[3][3]*G[4][3]*Q[3] + G[3][4]*G[4][4]*Q[4] + G[3][5]*G[4][5]*Q[5])*Tsq + (F[3][6]*D[4][6] + F[4][6]*D[3][6] + F[3][7]*D[4][7] + F[4][7]*D[3][7] + F[3][8]*D[4][8] + F[4][8]*D[3][8] + F[3][9]*D[4][9] + F[4][9]*D[3][9] + F[3][13]*D[4][13] + F[4][13]*D[3][13] + F[3][14]*D[4][14] + F[4][14]*D[3][14] + F[3][15]*D[4][15] + F[4][15]*D[3][15])*T + D[3][4];
-	P[3][5] = P[5][3] = (F[5][6]*(F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[3][8]*D[6][8] + F[3][9]*D[6][9] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15]) + F[5][7]*(F[3][6]*D[6][7] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[3][9]*D[7][9] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15]) + F[5][8]*(F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15]) + F[5][9]*(F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15]) + F[5][13]*(F[3][6]*D[6][13] + F[3][7]*D[7][13] + F[3][8]*D[8][13] + F[3][9]*D[9][13] + F[3][13]*D[13][13] + F[3][14]*D[13][14] + F[3][15]*D[13][15]) + F[5][14]*(F[3][6]*D[6][14] + F[3][7]*D[7][14] + F[3][8]*D[8][14] + F[3][9]*D[9][14] + F[3][13]*D[13][14] + F[3][14]*D[14][14] + F[3][15]*D[14][15]) + F[5][15]*(F[3][6]*D[6][15] + F[3][7]*D[7][15] + F[3][8]*D[8][15] + F[3][9]*D[9][15] + F[3][13]*D[13][15] + F[3][14]*D[14][15] + F[3][15]*D[15][15]) + G[3][3]*G[5][3]*Q[3] + G[3][4]*G[5][4]*Q[4] + G[3][5]*G[5][5]*Q[5])*Tsq + (F[3][6]*D[5][6] + F[5][6]*D[3][6] + F[3][7]*D[5][7] + F[5][7]*D[3][7] + F[3][8]*D[5][8] + F[5][8]*D[3][8] + F[3][9]*D[5][9] + F[5][9]*D[3][9] + F[3][13]*D[5][13] + F[5][13]*D[3][13] + F[3][14]*D[5][14] + F[5][14]*D[3][14] + F[3][15]*D[5][15] + F[5][15]*D[3][15])*T + D[3][5];
-	P[3][6] = P[6][3] = (F[6][7]*(F[3][6]*D[6][7] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[3][9]*D[7][9] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15]) + F[6][8]*(F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15]) + F[6][9]*(F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15]) + F[6][10]*(F[3][6]*D[6][10] + F[3][7]*D[7][10] + F[3][8]*D[8][10] + F[3][9]*D[9][10] + F[3][13]*D[10][13] + F[3][14]*D[10][14] + F[3][15]*D[10][15]) + F[6][11]*(F[3][6]*D[6][11] + F[3][7]*D[7][11] + F[3][8]*D[8][11] + F[3][9]*D[9][11] + F[3][13]*D[11][13] + F[3][14]*D[11][14] + F[3][15]*D[11][15]) + F[6][12]*(F[3][6]*D[6][12] + F[3][7]*D[7][12] + F[3][8]*D[8][12] + F[3][9]*D[9][12] + F[3][13]*D[12][13] + F[3][14]*D[12][14] + F[3][15]*D[12][15]))*Tsq + (F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[6][7]*D[3][7] + F[3][8]*D[6][8] + F[6][8]*D[3][8] + F[3][9]*D[6][9] + F[6][9]*D[3][9] + F[6][10]*D[3][10] + F[6][11]*D[3][11] + F[6][12]*D[3][12] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15])*T + D[3][6];
-	P[3][7] = P[7][3] = (F[7][6]*(F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[3][8]*D[6][8] + F[3][9]*D[6][9] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15]) + F[7][8]*(F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15]) + F[7][9]*(F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15]) + F[7][10]*(F[3][6]*D[6][10] + F[3][7]*D[7][10] + F[3][8]*D[8][10] + F[3][9]*D[9][10] + F[3][13]*D[10][13] + F[3][14]*D[10][14] + F[3][15]*D[10][15]) + F[7][11]*(F[3][6]*D[6][11] + F[3][7]*D[7][11] + F[3][8]*D[8][11] + F[3][9]*D[9][11] + F[3][13]*D[11][13] + F[3][14]*D[11][14] + F[3][15]*D[11][15]) + F[7][12]*(F[3][6]*D[6][12] + F[3][7]*D[7][12] + F[3][8]*D[8][12] + F[3][9]*D[9][12] + F[3][13]*D[12][13] + F[3][14]*D[12][14] + F[3][15]*D[12][15]))*Tsq + (F[3][6]*D[6][7] + F[7][6]*D[3][6] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[7][8]*D[3][8] + F[3][9]*D[7][9] + F[7][9]*D[3][9] + F[7][10]*D[3][10] + F[7][11]*D[3][11] + F[7][12]*D[3][12] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15])*T + D[3][7];
-	P[3][8] = P[8][3] = (F[8][6]*(F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[3][8]*D[6][8] + F[3][9]*D[6][9] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15]) + F[8][7]*(F[3][6]*D[6][7] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[3][9]*D[7][9] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15]) + F[8][9]*(F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15]) + F[8][10]*(F[3][6]*D[6][10] + F[3][7]*D[7][10] + F[3][8]*D[8][10] + F[3][9]*D[9][10] + F[3][13]*D[10][13] + F[3][14]*D[10][14] + F[3][15]*D[10][15]) + F[8][11]*(F[3][6]*D[6][11] + F[3][7]*D[7][11] + F[3][8]*D[8][11] + F[3][9]*D[9][11] + F[3][13]*D[11][13] + F[3][14]*D[11][14] + F[3][15]*D[11][15]) + F[8][12]*(F[3][6]*D[6][12] + F[3][7]*D[7][12] + F[3][8]*D[8][12] + F[3][9]*D[9][12] + F[3][13]*D[12][13] + F[3][14]*D[12][14] + F[3][15]*D[12][15]))*Tsq + (F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[8][6]*D[3][6] + F[8][7]*D[3][7] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[8][9]*D[3][9] + F[8][10]*D[3][10] + F[8][11]*D[3][11] + F[8][12]*D[3][12] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15])*T + D[3][8];
-	P[3][9] = P[9][3] = (F[9][6]*(F[3][6]*D[6][6] + F[3][7]*D[6][7] + F[3][8]*D[6][8] + F[3][9]*D[6][9] + F[3][13]*D[6][13] + F[3][14]*D[6][14] + F[3][15]*D[6][15]) + F[9][7]*(F[3][6]*D[6][7] + F[3][7]*D[7][7] + F[3][8]*D[7][8] + F[3][9]*D[7][9] + F[3][13]*D[7][13] + F[3][14]*D[7][14] + F[3][15]*D[7][15]) + F[9][8]*(F[3][6]*D[6][8] + F[3][7]*D[7][8] + F[3][8]*D[8][8] + F[3][9]*D[8][9] + F[3][13]*D[8][13] + F[3][14]*D[8][14] + F[3][15]*D[8][15]) + F[9][10]*(F[3][6]*D[6][10] + F[3][7]*D[7][10] + F[3][8]*D[8][10] + F[3][9]*D[9][10] + F[3][13]*D[10][13] + F[3][14]*D[10][14] + F[3][15]*D[10][15]) + F[9][11]*(F[3][6]*D[6][11] + F[3][7]*D[7][11] + F[3][8]*D[8][11] + F[3][9]*D[9][11] + F[3][13]*D[11][13] + F[3][14]*D[11][14] + F[3][15]*D[11][15]) + F[9][12]*(F[3][6]*D[6][12] + F[3][7]*D[7][12] + F[3][8]*D[8][12] + F[3][9]*D[9][12] + F[3][13]*D[12][13] + F[3][14]*D[12][14] + F[3][15]*D[12][15]))*Tsq + (F[9][6]*D[3][6] + F[9][7]*D[3][7] + F[9][8]*D[3][8] + F[3][6]*D[6][9] + F[3][7]*D[7][9] + F[3][8]*D[8][9] + F[3][9]*D[9][9] + F[9][10]*D[3][10] + F[9][11]*D[3][11] + F[9][12]*D[3][12] + F[3][13]*D[9][13] + F[3][14]*D[9][14] + F[3][15]*D[9][15])*T + D[3][9];
-	P[3][10] = P[10][3] = (F[3][6]*D[6][10] + F[3][7]*D[7][10] + F[3][8]*D[8][10] + F[3][9]*D[9][10] + F[3][13]*D[10][13] + F[3][14]*D[10][14] + F[3][15]*D[10][15])*T + D[3][10];
-	P[3][11] = P[11][3] = (F[3][6]*D[6][11] + F[3][7]*D[7][11] + F[3][8]*D[8][11] + F[3][9]*D[9][11] + F[3][13]*D[11][13] + F[3][14]*D[11][14] + F[3][15]*D[11][15])*T + D[3][11];
-	P[3][12] = P[12][3] = (F[3][6]*D[6][12] + F[3][7]*D[7][12] + F[3][8]*D[8][12] + F[3][9]*D[9][12] + F[3][13]*D[12][13] + F[3][14]*D[12][14] + F[3][15]*D[12][15])*T + D[3][12];
-	P[3][13] = P[13][3] = (F[3][6]*D[6][13] + F[3][7]*D[7][13] + F[3][8]*D[8][13] + F[3][9]*D[9][13] + F[3][13]*D[13][13] + F[3][14]*D[13][14] + F[3][15]*D[13][15])*T + D[3][13];
-	P[3][14] = P[14][3] = (F[3][6]*D[6][14] + F[3][7]*D[7][14] + F[3][8]*D[8][14] + F[3][9]*D[9][14] + F[3][13]*D[13][14] + F[3][14]*D[14][14] + F[3][15]*D[14][15])*T + D[3][14];
-	P[3][15] = P[15][3] = (F[3][6]*D[6][15] + F[3][7]*D[7][15] + F[3][8]*D[8][15] + F[3][9]*D[9][15] + F[3][13]*D[13][15] + F[3][14]*D[14][15] + F[3][15]*D[15][15])*T + D[3][15];
-	P[4][4] = (Q[3]*G[4][3]*G[4][3] + Q[4]*G[4][4]*G[4][4] + Q[5]*G[4][5]*G[4][5] + F[4][6]*(F[4][6]*D[6][6] + F[4][7]*D[6][7] + F[4][8]*D[6][8] + F[4][9]*D[6][9] + F[4][13]*D[6][13] + F[4][14]*D[6][14] + F[4][15]*D[6][15]) + F[4][7]*(F[4][6]*D[6][7] + F[4][7]*D[7][7] + F[4][8]*D[7][8] + F[4][9]*D[7][9] + F[4][13]*D[7][13] + F[4][14]*D[7][14] + F[4][15]*D[7][15]) + F[4][8]*(F[4][6]*D[6][8] + F[4][7]*D[7][8] + F[4][8]*D[8][8] + F[4][9]*D[8][9] + F[4][13]*D[8][13] + F[4][14]*D[8][14] + F[4][15]*D[8][15]) + F[4][9]*(F[4][6]*D[6][9] + F[4][7]*D[7][9] + F[4][8]*D[8][9] + F[4][9]*D[9][9] + F[4][13]*D[9][13] + F[4][14]*D[9][14] + F[4][15]*D[9][15]) + F[4][13]*(F[4][6]*D[6][13] + F[4][7]*D[7][13] + F[4][8]*D[8][13] + F[4][9]*D[9][13] + F[4][13]*D[13][13] + F[4][14]*D[13][14] + F[4][15]*D[13][15]) + F[4][14]*(F[4][6]*D[6][14] + F[4][7]*D[7][14] + F[4][8]*D[8][14] + F[4][9]*D[9][14] + F[4][13]*D[13][14] + F[4][14]*D[14][14] + F[4][15]*D[14][15]) + F[4][15]*(F[4][6]*D[6][15] + F[4][7]*D[7][15] + F[4][8]*D[8][15] + F[4][9]*D[9][15] + F[4][13]*D[13][15] + F[4][14]*D[14][15] + F[4][15]*D[15][15]))*Tsq + (2*F[4][6]*D[4][6] + 2*F[4][7]*D[4][7] + 2*F[4][8]*D[4][8] + 2*F[4][9]*D[4][9] + 2*F[4][13]*D[4][13] + 2*F[4][14]*D[4][14] + 2*F[4][15]*D[4][15])*T + D[4][4];
-	P[4][5] = P[5][4] = (F[5][6]*(F[4][6]*D[6][6] + F[4][7]*D[6][7] + F[4][8]*D[6][8] + F[4][9]*D[6][9] + F[4][13]*D[6][13] + F[4][14]*D[6][14] + F[4][15]*D[6][15]) + F[5][7]*(F[4][6]*D[6][7] + F[4][7]*D[7][7] + F[4][8]*D[7][8] + F[4][9]*D[7][9] + F[4][13]*D[7][13] + F[4][14]*D[7][14] + F[4][15]*D[7][15]) + F[5][8]*(F[4][6]*D[6][8] + F[4][7]*D[7][8] + F[4][8]*D[8][8] + F[4][9]*D[8][9] + F[4][13]*D[8][13] + F[4][14]*D[8][14] + F[4][15]*D[8][15]) + F[5][9]*(F[4][6]*D[6][9] + F[4][7]*D[7][9] + F[4][8]*D[8][9] + F[4][9]*D[9][9] + F[4][13]*D[9][13] + F[4][14]*D[9][14] + F[4][15]*D[9][15]) + F[5][13]*(F[4][6]*D[6][13] + F[4][7]*D[7][13] + F[4][8]*D[8][13] + F[4][9]*D[9][13] + F[4][13]*D[13][13] + F[4][14]*D[13][14] + F[4][15]*D[13][15]) + F[5][14]*(F[4][6]*D[6][14] + F[4][7]*D[7][14] + F[4][8]*D[8][14] + F[4][9]*D[9][14] + F[4][13]*D[13][14] + F[4][14]*D[14][14] + F[4][15]*D[14][15]) + F[5][15]*(F[4][6]*D[6][15] + F[4][7]*D[7][15] + F[4][8]*D[8][15] + F[4][9]*D[9][15] + F[4][13]*D[13][15] + F[4][14]*D[14][15] + F[4][15]*D[15][15]) + G[4][3]*G[5][3]*Q[3] + G[4][4]*G[5][4]*Q[4] + G[4][5]*G[5][5]*Q[5])*Tsq + (F[4][6]*D[5][6] + F[5][6]*D[4][6] + F[4][7]*D[5][7] + F[5][7]*D[4][7] + F[4][8]*D[5][8] + F[5][8]*D[4][8] + F[4][9]*D[5][9] + F[5][9]*D[4][9] + F[4][13]*D[5][13] + F[5][13]*D[4][13] + F[4][14]*D[5][14] + F[5][14]*D[4][14] + F[4][15]*D[5][15] + F[5][15]*D[4][15])*T + D[4][5];
-	P[4][6] = P[6][4] = (F[6][7]*(F[4][6]*D[6][7] + F[4][7]*D[7][7] + F[4][8]*D[7][8] + F[4][9]*D[7][9] + F[4][13]*D[7][13] + F[4][14]*D[7][14] + F[4][15]*D[7][15]) + F[6][8]*(F[4][6]*D[6][8] + F[4][7]*D[7][8] + F[4][8]*D[8][8] + F[4][9]*D[8][9] + F[4][13]*D[8][13] + F[4][14]*D[8][14] + F[4][15]*D[8][15]) + F[6][9]*(F[4][6]*D[6][9] + F[4][7]*D[7][9] + F[4][8]*D[8][9] + F[4][9]*D[9][9] + F[4][13]*D[9][13] + F[4][14]*D[9][14] + F[4][15]*D[9][15]) + F[6][10]*(F[4][6]*D[6][10] + F[4][7]*D[7][10] + F[4][8]*D[8][10] + F[4][9]*D[9][10] + F[4][13]*D[10][13] + F[4][14]*D[10][14] + F[4][15]*D[10][15]) + F[6][11]*(F[4][6]*D[6][11] + F[4][7]*D[7][11] + F[4][8]*D[8][11] + F[4][9]*D[9][11] + F[4][13]*D[11][13] + F[4][14]*D[11][14] + F[4][15]*D[11][15]) + F[6][12]*(F[4][6]*D[6][12] + F[4][7]*D[7][12] + F[4][8]*D[8][12] + F[4][9]*D[9][12] + F[4][13]*D[12][13] + F[4][14]*D[12][14] + F[4][15]*D[12][15]))*Tsq + (F[4][6]*D[6][6] + F[4][7]*D[6][7] + F[6][7]*D[4][7] + F[4][8]*D[6][8] + F[6][8]*D[4][8] + F[4][9]*D[6][9] + F[6][9]*D[4][9] + F[6][10]*D[4][10] + F[6][11]*D[4][11] + F[6][12]*D[4][12] + F[4][13]*D[6][13] + F[4][14]*D[6][14] + F[4][15]*D[6][15])*T + D[4][6];
-	P[4][7] = P[7][4] = (F[7][6]*(F[4][6]*D[6][6] + F[4][7]*D[6][7] + F[4][8]*D[6][8] + F[4][9]*D[6][9] + F[4][13]*D[6][13] + F[4][14]*D[6][14] + F[4][15]*D[6][15]) + F[7][8]*(F[4][6]*D[6][8] + F[4][7]*D[7][8] + F[4][8]*D[8][8] + F[4][9]*D[8][9] + F[4][13]*D[8][13] + F[4][14]*D[8][14] + F[4][15]*D[8][15]) + F[7][9]*(F[4][6]*D[6][9] + F[4][7]*D[7][9] + F[4][8]*D[8][9] + F[4][9]*D[9][9] + F[4][13]*D[9][13] + F[4][14]*D[9][14] + F[4][15]*D[9][15]) + F[7][10]*(F[4][6]*D[6][10] + F[4][7]*D[7][10] + F[4][8]*D[8][10] + F[4][9]*D[9][10] + F[4][13]*D[10][13] + F[4][14]*D[10][14] + F[4][15]*D[10][15]) + F[7][11]*(F[4][6]*D[6][11] + F[4][7]*D[7][11] + F[4][8]*D[8][11] + F[4][9]*D[9][11] + F[4][13]*D[11][13] + F[4][14]*D[11][14] + F[4][15]*D[11][15]) + F[7][12]*(F[4][6]*D[6][12] + F[4][7]*D[7][12] + F[4][8]*D[8][12] + F[4][9]*D[9][12] + F[4][13]*D[12][13] + F[4][14]*D[12][14] + F[4][15]*D[12][15]))*Tsq + (F[4][6]*D[6][7] + F[7][6]*D[4][6] + F[4][7]*D[7][7] + F[4][8]*D[7][8] + F[7][8]*D[4][8] + F[4][9]*D[7][9] + F[7][9]*D[4][9] + F[7][10]*D[4][10] + F[7][11]*D[4][11] + F[7][12]*D[4][12] + F[4][13]*D[7][13] + F[4][14]*D[7][14] + F[4][15]*D[7][15])*T + D[4][7];
-	P[4][8] = P[8][4] = (F[8][6]*(F[4][6]*D[6][6] + F[4][7]*D[6][7] + F[4][8]*D[6][8] + F[4][9]*D[6][9] + F[4][13]*D[6][13] + F[4][14]*D[6][14] + F[4][15]*D[6][15]) + F[8][7]*(F[4][6]*D[6][7] + F[4][7]*D[7][7] + F[4][8]*D[7][8] + F[4][9]*D[7][9] + F[4][13]*D[7][13] + F[4][14]*D[7][14] + F[4][15]*D[7][15]) + F[8][9]*(F[4][6]*D[6][9] + F[4][7]*D[7][9] + F[4][8]*D[8][9] + F[4][9]*D[9][9] + F[4][13]*D[9][13] + F[4][14]*D[9][14] + F[4][15]*D[9][15]) + F[8][10]*(F[4][6]*D[6][10] + F[4][7]*D[7][10] + F[4][8]*D[8][10] + F[4][9]*D[9][10] + F[4][13]*D[10][13] + F[4][14]*D[10][14] + F[4][15]*D[10][15]) + F[8][11]*(F[4][6]*D[6][11] + F[4][7]*D[7][11] + F[4][8]*D[8][11] + F[4][9]*D[9][11] + F[4][13]*D[11][13] + F[4][14]*D[11][14] + F[4][15]*D[11][15]) + F[8][12]*(F[4][6]*D[6][12] + F[4][7]*D[7][12] + F[4][8]*D[8][12] + F[4][9]*D[9][12] + F[4][13]*D[12][13] + F[4][14]*D[12][14] + F[4][15]*D[12][15]))*Tsq + (F[4][6]*D[6][8] + F[4][7]*D[7][8] + F[8][6]*D[4][6] + F[8][7]*D[4][7] + F[4][8]*D[8][8] + F[4][9]*D[8][9] + F[8][9]*D[4][9] + F[8][10]*D[4][10] + F[8][11]*D[4][11] + F[8][12]*D[4][12] + F[4][13]*D[8][13] + F[4][14]*D[8][14] + F[4][15]*D[8][15])*T + D[4][8];
-	P[4][9] = P[9][4] = (F[9][6]*(F[4][6]*D[6][6] + F[4][7]*D[6][7] + F[4][8]*D[6][8] + F[4][9]*D[6][9] + F[4][13]*D[6][13] + F[4][14]*D[6][14] + F[4][15]*D[6][15]) + F[9][7]*(F[4][6]*D[6][7] + F[4][7]*D[7][7] + F[4][8]*D[7][8] + F[4][9]*D[7][9] + F[4][13]*D[7][13] + F[4][14]*D[7][14] + F[4][15]*D[7][15]) + F[9][8]*(F[4][6]*D[6][8] + F[4][7]*D[7][8] + F[4][8]*D[8][8] + F[4][9]*D[8][9] + F[4][13]*D[8][13] + F[4][14]*D[8][14] + F[4][15]*D[8][15]) + F[9][10]*(F[4][6]*D[6][10] + F[4][7]*D[7][10] + F[4][8]*D[8][10] + F[4][9]*D[9][10] + F[4][13]*D[10][13] + F[4][14]*D[10][14] + F[4][15]*D[10][15]) + F[9][11]*(F[4][6]*D[6][11] + F[4][7]*D[7][11] + F[4][8]*D[8][11] + F[4][9]*D[9][11] + F[4][13]*D[11][13] + F[4][14]*D[11][14] + F[4][15]*D[11][15]) + F[9][12]*(F[4][6]*D[6][12] + F[4][7]*D[7][12] + F[4][8]*D[8][12] + F[4][9]*D[9][12] + F[4][13]*D[12][13] + F[4][14]*D[12][14] + F[4][15]*D[12][15]))*Tsq + (F[9][6]*D[4][6] + F[9][7]*D[4][7] + F[9][8]*D[4][8] + F[4][6]*D[6][9] + F[4][7]*D[7][9] + F[4][8]*D[8][9] + F[4][9]*D[9][9] + F[9][10]*D[4][10] + F[9][11]*D[4][11] + F[9][12]*D[4][12] + F[4][13]*D[9][13] + F[4][14]*D[9][14] + F[4][15]*D[9][15])*T + D[4][9];
-	P[4][10] = P[10][4] = (F[4][6]*D[6][10] + F[4][7]*D[7][10] + F[4][8]*D[8][10] + F[4][9]*D[9][10] + F[4][13]*D[10][13] + F[4][14]*D[10][14] + F[4][15]*D[10][15])*T + D[4][10];
-	P[4][11] = P[11][4] = (F[4][6]*D[6][11] + F[4][7]*D[7][11] + F[4][8]*D[8][11] + F[4][9]*D[9][11] + F[4][13]*D[11][13] + F[4][14]*D[11][14] + F[4][15]*D[11][15])*T + D[4][11];
-	P[4][12] = P[12][4] = (F[4][6]*D[6][12] + F[4][7]*D[7][12] + F[4][8]*D[8][12] + F[4][9]*D[9][12] + F[4][13]*D[12][13] + F[4][14]*D[12][14] + F[4][15]*D[12][15])*T + D[4][12];
-	P[4][13] = P[13][4] = (F[4][6]*D[6][13] + F[4][7]*D[7][13] + F[4][8]*D[8][13] + F[4][9]*D[9][13] + F[4][13]*D[13][13] + F[4][14]*D[13][14] + F[4][15]*D[13][15])*T + D[4][13];
-	P[4][14] = P[14][4] = (F[4][6]*D[6][14] + F[4][7]*D[7][14] + F[4][8]*D[8][14] + F[4][9]*D[9][14] + F[4][13]*D[13][14] + F[4][14]*D[14][14] + F[4][15]*D[14][15])*T + D[4][14];
-	P[4][15] = P[15][4] = (F[4][6]*D[6][15] + F[4][7]*D[7][15] + F[4][8]*D[8][15] + F[4][9]*D[9][15] + F[4][13]*D[13][15] + F[4][14]*D[14][15] + F[4][15]*D[15][15])*T + D[4][15];
-	P[5][5] = (Q[3]*G[5][3]*G[5][3] + Q[4]*G[5][4]*G[5][4] + Q[5]*G[5][5]*G[5][5] + F[5][6]*(F[5][6]*D[6][6] + F[5][7]*D[6][7] + F[5][8]*D[6][8] + F[5][9]*D[6][9] + F[5][13]*D[6][13] + F[5][14]*D[6][14] + F[5][15]*D[6][15]) + F[5][7]*(F[5][6]*D[6][7] + F[5][7]*D[7][7] + F[5][8]*D[7][8] + F[5][9]*D[7][9] + F[5][13]*D[7][13] + F[5][14]*D[7][14] + F[5][15]*D[7][15]) + F[5][8]*(F[5][6]*D[6][8] + F[5][7]*D[7][8] + F[5][8]*D[8][8] + F[5][9]*D[8][9] + F[5][13]*D[8][13] + F[5][14]*D[8][14] + F[5][15]*D[8][15]) + F[5][9]*(F[5][6]*D[6][9] + F[5][7]*D[7][9] + F[5][8]*D[8][9] + F[5][9]*D[9][9] + F[5][13]*D[9][13] + F[5][14]*D[9][14] + F[5][15]*D[9][15]) + F[5][13]*(F[5][6]*D[6][13] + F[5][7]*D[7][13] + F[5][8]*D[8][13] + F[5][9]*D[9][13] + F[5][13]*D[13][13] + F[5][14]*D[13][14] + F[5][15]*D[13][15]) + F[5][14]*(F[5][6]*D[6][14] + F[5][7]*D[7][14] + F[5][8]*D[8][14] + F[5][9]*D[9][14] + F[5][13]*D[13][14] + F[5][14]*D[14][14] + F[5][15]*D[14][15]) + F[5][15]*(F[5][6]*D[6][15] + F[5][7]*D[7][15] + F[5][8]*D[8][15] + F[5][9]*D[9][15] + F[5][13]*D[13][15] + F[5][14]*D[14][15] + F[5][15]*D[15][15]))*Tsq + (2*F[5][6]*D[5][6] + 2*F[5][7]*D[5][7] + 2*F[5][8]*D[5][8] + 2*F[5][9]*D[5][9] + 2*F[5][13]*D[5][13] + 2*F[5][14]*D[5][14] + 2*F[5][15]*D[5][15])*T + D[5][5];
-	P[5][6] = P[6][5] = (F[6][7]*(F[5][6]*D[6][7] + F[5][7]*D[7][7] + F[5][8]*D[7][8] + F[5][9]*D[7][9] + F[5][13]*D[7][13] + F[5][14]*D[7][14] + F[5][15]*D[7][15]) + F[6][8]*(F[5][6]*D[6][8] + F[5][7]*D[7][8] + F[5][8]*D[8][8] + F[5][9]*D[8][9] + F[5][13]*D[8][13] + F[5][14]*D[8][14] + F[5][15]*D[8][15]) + F[6][9]*(F[5][6]*D[6][9] + F[5][7]*D[7][9] + F[5][8]*D[8][9] + F[5][9]*D[9][9] + F[5][13]*D[9][13] + F[5][14]*D[9][14] + F[5][15]*D[9][15]) + F[6][10]*(F[5][6]*D[6][10] + F[5][7]*D[7][10] + F[5][8]*D[8][10] + F[5][9]*D[9][10] + F[5][13]*D[10][13] + F[5][14]*D[10][14] + F[5][15]*D[10][15]) + F[6][11]*(F[5][6]*D[6][11] + F[5][7]*D[7][11] + F[5][8]*D[8][11] + F[5][9]*D[9][11] + F[5][13]*D[11][13] + F[5][14]*D[11][14] + F[5][15]*D[11][15]) + F[6][12]*(F[5][6]*D[6][12] + F[5][7]*D[7][12] + F[5][8]*D[8][12] + F[5][9]*D[9][12] + F[5][13]*D[12][13] + F[5][14]*D[12][14] + F[5][15]*D[12][15]))*Tsq + (F[5][6]*D[6][6] + F[5][7]*D[6][7] + F[6][7]*D[5][7] + F[5][8]*D[6][8] + F[6][8]*D[5][8] + F[5][9]*D[6][9] + F[6][9]*D[5][9] + F[6][10]*D[5][10] + F[6][11]*D[5][11] + F[6][12]*D[5][12] + F[5][13]*D[6][13] + F[5][14]*D[6][14] + F[5][15]*D[6][15])*T + D[5][6];
-	P[5][7] = P[7][5] = (F[7][6]*(F[5][6]*D[6][6] + F[5][7]*D[6][7] + F[5][8]*D[6][8] + F[5][9]*D[6][9] + F[5][13]*D[6][13] + F[5][14]*D[6][14] + F[5][15]*D[6][15]) + F[7][8]*(F[5][6]*D[6][8] + F[5][7]*D[7][8] + F[5][8]*D[8][8] + F[5][9]*D[8][9] + F[5][13]*D[8][13] + F[5][14]*D[8][14] + F[5][15]*D[8][15]) + F[7][9]*(F[5][6]*D[6][9] + F[5][7]*D[7][9] + F[5][8]*D[8][9] + F[5][9]*D[9][9] + F[5][13]*D[9][13] + F[5][14]*D[9][14] + F[5][15]*D[9][15]) + F[7][10]*(F[5][6]*D[6][10] + F[5][7]*D[7][10] + F[5][8]*D[8][10] + F[5][9]*D[9][10] + F[5][13]*D[10][13] + F[5][14]*D[10][14] + F[5][15]*D[10][15]) + F[7][11]*(F[5][6]*D[6][11] + F[5][7]*D[7][11] + F[5][8]*D[8][11] + F[5][9]*D[9][11] + F[5][13]*D[11][13] + F[5][14]*D[11][14] + F[5][15]*D[11][15]) + F[7][12]*(F[5][6]*D[6][12] + F[5][7]*D[7][12] + F[5][8]*D[8][12] + F[5][9]*D[9][12] + F[5][13]*D[12][13] + F[5][14]*D[12][14] + F[5][15]*D[12][15]))*Tsq + (F[5][6]*D[6][7] + F[7][6]*D[5][6] + F[5][7]*D[7][7] + F[5][8]*D[7][8] + F[7][8]*D[5][8] + F[5][9]*D[7][9] + F[7][9]*D[5][9] + F[7][10]*D[5][10] + F[7][11]*D[5][11] + F[7][12]*D[5][12] + F[5][13]*D[7][13] + F[5][14]*D[7][14] + F[5][15]*D[7][15])*T + D[5][7];
-	P[5][8] = P[8][5] = (F[8][6]*(F[5][6]*D[6][6] + F[5][7]*D[6][7] + F[5][8]*D[6][8] + F[5][9]*D[6][9] + F[5][13]*D[6][13] + F[5][14]*D[6][14] + F[5][15]*D[6][15]) + F[8][7]*(F[5][6]*D[6][7] + F[5][7]*D[7][7] + F[5][8]*D[7][8] + F[5][9]*D[7][9] + F[5][13]*D[7][13] + F[5][14]*D[7][14] + F[5][15]*D[7][15]) + F[8][9]*(F[5][6]*D[6][9] + F[5][7]*D[7][9] + F[5][8]*D[8][9] + F[5][9]*D[9][9] + F[5][13]*D[9][13] + F[5][14]*D[9][14] + F[5][15]*D[9][15]) + F[8][10]*(F[5][6]*D[6][10] + F[5][7]*D[7][10] + F[5][8]*D[8][10] + F[5][9]*D[9][10] + F[5][13]*D[10][13] + F[5][14]*D[10][14] + F[5][15]*D[10][15]) + F[8][11]*(F[5][6]*D[6][11] + F[5][7]*D[7][11] + F[5][8]*D[8][11] + F[5][9]*D[9][11] + F[5][13]*D[11][13] + F[5][14]*D[11][14] + F[5][15]*D[11][15]) + F[8][12]*(F[5][6]*D[6][12] + F[5][7]*D[7][12] + F[5][8]*D[8][12] + F[5][9]*D[9][12] + F[5][13]*D[12][13] + F[5][14]*D[12][14] + F[5][15]*D[12][15]))*Tsq + (F[5][6]*D[6][8] + F[5][7]*D[7][8] + F[8][6]*D[5][6] + F[8][7]*D[5][7] + F[5][8]*D[8][8] + F[5][9]*D[8][9] + F[8][9]*D[5][9] + F[8][10]*D[5][10] + F[8][11]*D[5][11] + F[8][12]*D[5][12] + F[5][13]*D[8][13] + F[5][14]*D[8][14] + F[5][15]*D[8][15])*T + D[5][8];
-	P[5][9] = P[9][5] = (F[9][6]*(F[5][6]*D[6][6] + F[5][7]*D[6][7] + F[5][8]*D[6][8] + F[5][9]*D[6][9] + F[5][13]*D[6][13] + F[5][14]*D[6][14] + F[5][15]*D[6][15]) + F[9][7]*(F[5][6]*D[6][7] + F[5][7]*D[7][7] + F[5][8]*D[7][8] + F[5][9]*D[7][9] + F[5][13]*D[7][13] + F[5][14]*D[7][14] + F[5][15]*D[7][15]) + F[9][8]*(F[5][6]*D[6][8] + F[5][7]*D[7][8] + F[5][8]*D[8][8] + F[5][9]*D[8][9] + F[5][13]*D[8][13] + F[5][14]*D[8][14] + F[5][15]*D[8][15]) + F[9][10]*(F[5][6]*D[6][10] + F[5][7]*D[7][10] + F[5][8]*D[8][10] + F[5][9]*D[9][10] + F[5][13]*D[10][13] + F[5][14]*D[10][14] + F[5][15]*D[10][15]) + F[9][11]*(F[5][6]*D[6][11] + F[5][7]*D[7][11] + F[5][8]*D[8][11] + F[5][9]*D[9][11] + F[5][13]*D[11][13] + F[5][14]*D[11][14] + F[5][15]*D[11][15]) + F[9][12]*(F[5][6]*D[6][12] + F[5][7]*D[7][12] + F[5][8]*D[8][12] + F[5][9]*D[9][12] + F[5][13]*D[12][13] + F[5][14]*D[12][14] + F[5][15]*D[12][15]))*Tsq + (F[9][6]*D[5][6] + F[9][7]*D[5][7] + F[9][8]*D[5][8] + F[5][6]*D[6][9] + F[5][7]*D[7][9] + F[5][8]*D[8][9] + F[5][9]*D[9][9] + F[9][10]*D[5][10] + F[9][11]*D[5][11] + F[9][12]*D[5][12] + F[5][13]*D[9][13] + F[5][14]*D[9][14] + F[5][15]*D[9][15])*T + D[5][9];
-	P[5][10] = P[10][5] = (F[5][6]*D[6][10] + F[5][7]*D[7][10] + F[5][8]*D[8][10] + F[5][9]*D[9][10] + F[5][13]*D[10][13] + F[5][14]*D[10][14] + F[5][15]*D[10][15])*T + D[5][10];
-	P[5][11] = P[11][5] = (F[5][6]*D[6][11] + F[5][7]*D[7][11] + F[5][8]*D[8][11] + F[5][9]*D[9][11] + F[5][13]*D[11][13] + F[5][14]*D[11][14] + F[5][15]*D[11][15])*T + D[5][11];
-	P[5][12] = P[12][5] = (F[5][6]*D[6][12] + F[5][7]*D[7][12] + F[5][8]*D[8][12] + F[5][9]*D[9][12] + F[5][13]*D[12][13] + F[5][14]*D[12][14] + F[5][15]*D[12][15])*T + D[5][12];
-	P[5][13] = P[13][5] = (F[5][6]*D[6][13] + F[5][7]*D[7][13] + F[5][8]*D[8][13] + F[5][9]*D[9][13] + F[5][13]*D[13][13] + F[5][14]*D[13][14] + F[5][15]*D[13][15])*T + D[5][13];
-	P[5][14] = P[14][5] = (F[5][6]*D[6][14] + F[5][7]*D[7][14] + F[5][8]*D[8][14] + F[5][9]*D[9][14] + F[5][13]*D[13][14] + F[5][14]*D[14][14] + F[5][15]*D[14][15])*T + D[5][14];
-	P[5][15] = P[15][5] = (F[5][6]*D[6][15] + F[5][7]*D[7][15] + F[5][8]*D[8][15] + F[5][9]*D[9][15] + F[5][13]*D[13][15] + F[5][14]*D[14][15] + F[5][15]*D[15][15])*T + D[5][15];
-	P[6][6] = (Q[0]*G[6][0]*G[6][0] + Q[1]*G[6][1]*G[6][1] + Q[2]*G[6][2]*G[6][2] + F[6][7]*(F[6][7]*D[7][7] + F[6][8]*D[7][8] + F[6][9]*D[7][9] + F[6][10]*D[7][10] + F[6][11]*D[7][11] + F[6][12]*D[7][12]) + F[6][8]*(F[6][7]*D[7][8] + F[6][8]*D[8][8] + F[6][9]*D[8][9] + F[6][10]*D[8][10] + F[6][11]*D[8][11] + F[6][12]*D[8][12]) + F[6][9]*(F[6][7]*D[7][9] + F[6][8]*D[8][9] + F[6][9]*D[9][9] + F[6][10]*D[9][10] + F[6][11]*D[9][11] + F[6][12]*D[9][12]) + F[6][10]*(F[6][7]*D[7][10] + F[6][8]*D[8][10] + F[6][9]*D[9][10] + F[6][10]*D[10][10] + F[6][11]*D[10][11] + F[6][12]*D[10][12]) + F[6][11]*(F[6][7]*D[7][11] + F[6][8]*D[8][11] + F[6][9]*D[9][11] + F[6][10]*D[10][11] + F[6][11]*D[11][11] + F[6][12]*D[11][12]) + F[6][12]*(F[6][7]*D[7][12] + F[6][8]*D[8][12] + F[6][9]*D[9][12] + F[6][10]*D[10][12] + F[6][11]*D[11][12] + F[6][12]*D[12][12]))*Tsq + (2*F[6][7]*D[6][7] + 2*F[6][8]*D[6][8] + 2*F[6][9]*D[6][9] + 2*F[6][10]*D[6][10] + 2*F[6][11]*D[6][11] + 2*F[6][12]*D[6][12])*T + D[6][6];
-	P[6][7] = P[7][6] = (F[7][6]*(F[6][7]*D[6][7] + F[6][8]*D[6][8] + F[6][9]*D[6][9] + F[6][10]*D[6][10] + F[6][11]*D[6][11] + F[6][12]*D[6][12]) + F[7][8]*(F[6][7]*D[7][8] + F[6][8]*D[8][8] + F[6][9]*D[8][9] + F[6][10]*D[8][10] + F[6][11]*D[8][11] + F[6][12]*D[8][12]) + F[7][9]*(F[6][7]*D[7][9] + F[6][8]*D[8][9] + F[6][9]*D[9][9] + F[6][10]*D[9][10] + F[6][11]*D[9][11] + F[6][12]*D[9][12]) + F[7][10]*(F[6][7]*D[7][10] + F[6][8]*D[8][10] + F[6][9]*D[9][10] + F[6][10]*D[10][10] + F[6][11]*D[10][11] + F[6][12]*D[10][12]) + F[7][11]*(F[6][7]*D[7][11] + F[6][8]*D[8][11] + F[6][9]*D[9][11] + F[6][10]*D[10][11] + F[6][11]*D[11][11] + F[6][12]*D[11][12]) + F[7][12]*(F[6][7]*D[7][12] + F[6][8]*D[8][12] + F[6][9]*D[9][12] + F[6][10]*D[10][12] + F[6][11]*D[11][12] + F[6][12]*D[12][12]) + G[6][0]*G[7][0]*Q[0] + G[6][1]*G[7][1]*Q[1] + G[6][2]*G[7][2]*Q[2])*Tsq + (F[7][6]*D[6][6] + F[6][7]*D[7][7] + F[6][8]*D[7][8] + F[7][8]*D[6][8] + F[6][9]*D[7][9] + F[7][9]*D[6][9] + F[6][10]*D[7][10] + F[7][10]*D[6][10] + F[6][11]*D[7][11] + F[7][11]*D[6][11] + F[6][12]*D[7][12] + F[7][12]*D[6][12])*T + D[6][7];
-	P[6][8] = P[8][6] = (F[8][6]*(F[6][7]*D[6][7] + F[6][8]*D[6][8] + F[6][9]*D[6][9] + F[6][10]*D[6][10] + F[6][11]*D[6][11] + F[6][12]*D[6][12]) + F[8][7]*(F[6][7]*D[7][7] + F[6][8]*D[7][8] + F[6][9]*D[7][9] + F[6][10]*D[7][10] + F[6][11]*D[7][11] + F[6][12]*D[7][12]) + F[8][9]*(F[6][7]*D[7][9] + F[6][8]*D[8][9] + F[6][9]*D[9][9] + F[6][10]*D[9][10] + F[6][11]*D[9][11] + F[6][12]*D[9][12]) + F[8][10]*(F[6][7]*D[7][10] + F[6][8]*D[8][10] + F[6][9]*D[9][10] + F[6][10]*D[10][10] + F[6][11]*D[10][11] + F[6][12]*D[10][12]) + F[8][11]*(F[6][7]*D[7][11] + F[6][8]*D[8][11] + F[6][9]*D[9][11] + F[6][10]*D[10][11] + F[6][11]*D[11][11] + F[6][12]*D[11][12]) + F[8][12]*(F[6][7]*D[7][12] + F[6][8]*D[8][12] + F[6][9]*D[9][12] + F[6][10]*D[10][12] + F[6][11]*D[11][12] + F[6][12]*D[12][12]) + G[6][0]*G[8][0]*Q[0] + G[6][1]*G[8][1]*Q[1] + G[6][2]*G[8][2]*Q[2])*Tsq + (F[6][7]*D[7][8] + F[8][6]*D[6][6] + F[8][7]*D[6][7] + F[6][8]*D[8][8] + F[6][9]*D[8][9] + F[8][9]*D[6][9] + F[6][10]*D[8][10] + F[8][10]*D[6][10] + F[6][11]*D[8][11] + F[8][11]*D[6][11] + F[6][12]*D[8][12] + F[8][12]*D[6][12])*T + D[6][8];
-	P[6][9] = P[9][6] = (F[9][6]*(F[6][7]*D[6][7] + F[6][8]*D[6][8] + F[6][9]*D[6][9] + F[6][10]*D[6][10] + F[6][11]*D[6][11] + F[6][12]*D[6][12]) + F[9][7]*(F[6][7]*D[7][7] + F[6][8]*D[7][8] + F[6][9]*D[7][9] + F[6][10]*D[7][10] + F[6][11]*D[7][11] + F[6][12]*D[7][12]) + F[9][8]*(F[6][7]*D[7][8] + F[6][8]*D[8][8] + F[6][9]*D[8][9] + F[6][10]*D[8][10] + F[6][11]*D[8][11] + F[6][12]*D[8][12]) + F[9][10]*(F[6][7]*D[7][10] + F[6][8]*D[8][10] + F[6][9]*D[9][10] + F[6][10]*D[10][10] + F[6][11]*D[10][11] + F[6][12]*D[10][12]) + F[9][11]*(F[6][7]*D[7][11] + F[6][8]*D[8][11] + F[6][9]*D[9][11] + F[6][10]*D[10][11] + F[6][11]*D[11][11] + F[6][12]*D[11][12]) + F[9][12]*(F[6][7]*D[7][12] + F[6][8]*D[8][12] + F[6][9]*D[9][12] + F[6][10]*D[10][12] + F[6][11]*D[11][12] + F[6][12]*D[12][12]) + G[6][0]*G[9][0]*Q[0] + G[6][1]*G[9][1]*Q[1] + G[6][2]*G[9][2]*Q[2])*Tsq + (F[9][6]*D[6][6] + F[9][7]*D[6][7] + F[9][8]*D[6][8] + F[6][7]*D[7][9] + F[6][8]*D[8][9] + F[6][9]*D[9][9] + F[6][10]*D[9][10] + F[9][10]*D[6][10] + F[6][11]*D[9][11] + F[9][11]*D[6][11] + F[6][12]*D[9][12] + F[9][12]*D[6][12])*T + D[6][9];
-	P[6][10] = P[10][6] = (F[6][7]*D[7][10] + F[6][8]*D[8][10] + F[6][9]*D[9][10] + F[6][10]*D[10][10] + F[6][11]*D[10][11] + F[6][12]*D[10][12])*T + D[6][10];
-	P[6][11] = P[11][6] = (F[6][7]*D[7][11] + F[6][8]*D[8][11] + F[6][9]*D[9][11] + F[6][10]*D[10][11] + F[6][11]*D[11][11] + F[6][12]*D[11][12])*T + D[6][11];
-	P[6][12] = P[12][6] = (F[6][7]*D[7][12] + F[6][8]*D[8][12] + F[6][9]*D[9][12] + F[6][10]*D[10][12] + F[6][11]*D[11][12] + F[6][12]*D[12][12])*T + D[6][12];
-	P[6][13] = P[13][6] = (F[6][7]*D[7][13] + F[6][8]*D[8][13] + F[6][9]*D[9][13] + F[6][10]*D[10][13] + F[6][11]*D[11][13] + F[6][12]*D[12][13])*T + D[6][13];
-	P[6][14] = P[14][6] = (F[6][7]*D[7][14] + F[6][8]*D[8][14] + F[6][9]*D[9][14] + F[6][10]*D[10][14] + F[6][11]*D[11][14] + F[6][12]*D[12][14])*T + D[6][14];
-	P[6][15] = P[15][6] = (F[6][7]*D[7][15] + F[6][8]*D[8][15] + F[6][9]*D[9][15] + F[6][10]*D[10][15] + F[6][11]*D[11][15] + F[6][12]*D[12][15])*T + D[6][15];
-	P[7][7] = (Q[0]*G[7][0]*G[7][0] + Q[1]*G[7][1]*G[7][1] + Q[2]*G[7][2]*G[7][2] + F[7][6]*(F[7][6]*D[6][6] + F[7][8]*D[6][8] + F[7][9]*D[6][9] + F[7][10]*D[6][10] + F[7][11]*D[6][11] + F[7][12]*D[6][12]) + F[7][8]*(F[7][6]*D[6][8] + F[7][8]*D[8][8] + F[7][9]*D[8][9] + F[7][10]*D[8][10] + F[7][11]*D[8][11] + F[7][12]*D[8][12]) + F[7][9]*(F[7][6]*D[6][9] + F[7][8]*D[8][9] + F[7][9]*D[9][9] + F[7][10]*D[9][10] + F[7][11]*D[9][11] + F[7][12]*D[9][12]) + F[7][10]*(F[7][6]*D[6][10] + F[7][8]*D[8][10] + F[7][9]*D[9][10] + F[7][10]*D[10][10] + F[7][11]*D[10][11] + F[7][12]*D[10][12]) + F[7][11]*(F[7][6]*D[6][11] + F[7][8]*D[8][11] + F[7][9]*D[9][11] + F[7][10]*D[10][11] + F[7][11]*D[11][11] + F[7][12]*D[11][12]) + F[7][12]*(F[7][6]*D[6][12] + F[7][8]*D[8][12] + F[7][9]*D[9][12] + F[7][10]*D[10][12] + F[7][11]*D[11][12] + F[7][12]*D[12][12]))*Tsq + (2*F[7][6]*D[6][7] + 2*F[7][8]*D[7][8] + 2*F[7][9]*D[7][9] + 2*F[7][10]*D[7][10] + 2*F[7][11]*D[7][11] + 2*F[7][12]*D[7][12])*T + D[7][7];
-	P[7][8] = P[8][7] = (F[8][6]*(F[7][6]*D[6][6] + F[7][8]*D[6][8] + F[7][9]*D[6][9] + F[7][10]*D[6][10] + F[7][11]*D[6][11] + F[7][12]*D[6][12]) + F[8][7]*(F[7][6]*D[6][7] + F[7][8]*D[7][8] + F[7][9]*D[7][9] + F[7][10]*D[7][10] + F[7][11]*D[7][11] + F[7][12]*D[7][12]) + F[8][9]*(F[7][6]*D[6][9] + F[7][8]*D[8][9] + F[7][9]*D[9][9] + F[7][10]*D[9][10] + F[7][11]*D[9][11] + F[7][12]*D[9][12]) + F[8][10]*(F[7][6]*D[6][10] + F[7][8]*D[8][10] + F[7][9]*D[9][10] + F[7][10]*D[10][10] + F[7][11]*D[10][11] + F[7][12]*D[10][12]) + F[8][11]*(F[7][6]*D[6][11] + F[7][8]*D[8][11] + F[7][9]*D[9][11] + F[7][10]*D[10][11] + F[7][11]*D[11][11] + F[7][12]*D[11][12]) + F[8][12]*(F[7][6]*D[6][12] + F[7][8]*D[8][12] + F[7][9]*D[9][12] + F[7][10]*D[10][12] + F[7][11]*D[11][12] + F[7][12]*D[12][12]) + G[7][0]*G[8][0]*Q[0] + G[7][1]*G[8][1]*Q[1] + G[7][2]*G[8][2]*Q[2])*Tsq + (F[7][6]*D[6][8] + F[8][6]*D[6][7] + F[8][7]*D[7][7] + F[7][8]*D[8][8] + F[7][9]*D[8][9] + F[8][9]*D[7][9] + F[7][10]*D[8][10] + F[8][10]*D[7][10] + F[7][11]*D[8][11] + F[8][11]*D[7][11] + F[7][12]*D[8][12] + F[8][12]*D[7][12])*T + D[7][8];
-	P[7][9] = P[9][7] = (F[9][6]*(F[7][6]*D[6][6] + F[7][8]*D[6][8] + F[7][9]*D[6][9] + F[7][10]*D[6][10] + F[7][11]*D[6][11] + F[7][12]*D[6][12]) + F[9][7]*(F[7][6]*D[6][7] + F[7][8]*D[7][8] + F[7][9]*D[7][9] + F[7][10]*D[7][10] + F[7][11]*D[7][11] + F[7][12]*D[7][12]) + F[9][8]*(F[7][6]*D[6][8] + F[7][8]*D[8][8] + F[7][9]*D[8][9] + F[7][10]*D[8][10] + F[7][11]*D[8][11] + F[7][12]*D[8][12]) + F[9][10]*(F[7][6]*D[6][10] + F[7][8]*D[8][10] + F[7][9]*D[9][10] + F[7][10]*D[10][10] + F[7][11]*D[10][11] + F[7][12]*D[10][12]) + F[9][11]*(F[7][6]*D[6][11] + F[7][8]*D[8][11] + F[7][9]*D[9][11] + F[7][10]*D[10][11] + F[7][11]*D[11][11] + F[7][12]*D[11][12]) + F[9][12]*(F[7][6]*D[6][12] + F[7][8]*D[8][12] + F[7][9]*D[9][12] + F[7][10]*D[10][12] + F[7][11]*D[11][12] + F[7][12]*D[12][12]) + G[7][0]*G[9][0]*Q[0] + G[7][1]*G[9][1]*Q[1] + G[7][2]*G[9][2]*Q[2])*Tsq + (F[9][6]*D[6][7] + F[9][7]*D[7][7] + F[9][8]*D[7][8] + F[7][6]*D[6][9] + F[7][8]*D[8][9] + F[7][9]*D[9][9] + F[7][10]*D[9][10] + F[9][10]*D[7][10] + F[7][11]*D[9][11] + F[9][11]*D[7][11] + F[7][12]*D[9][12] + F[9][12]*D[7][12])*T + D[7][9];
-	P[7][10] = P[10][7] = (F[7][6]*D[6][10] + F[7][8]*D[8][10] + F[7][9]*D[9][10] + F[7][10]*D[10][10] + F[7][11]*D[10][11] + F[7][12]*D[10][12])*T + D[7][10];
-	P[7][11] = P[11][7] = (F[7][6]*D[6][11] + F[7][8]*D[8][11] + F[7][9]*D[9][11] + F[7][10]*D[10][11] + F[7][11]*D[11][11] + F[7][12]*D[11][12])*T + D[7][11];
-	P[7][12] = P[12][7] = (F[7][6]*D[6][12] + F[7][8]*D[8][12] + F[7][9]*D[9][12] + F[7][10]*D[10][12] + F[7][11]*D[11][12] + F[7][12]*D[12][12])*T + D[7][12];
-	P[7][13] = P[13][7] = (F[7][6]*D[6][13] + F[7][8]*D[8][13] + F[7][9]*D[9][13] + F[7][10]*D[10][13] + F[7][11]*D[11][13] + F[7][12]*D[12][13])*T + D[7][13];
-	P[7][14] = P[14][7] = (F[7][6]*D[6][14] + F[7][8]*D[8][14] + F[7][9]*D[9][14] + F[7][10]*D[10][14] + F[7][11]*D[11][14] + F[7][12]*D[12][14])*T + D[7][14];
-	P[7][15] = P[15][7] = (F[7][6]*D[6][15] + F[7][8]*D[8][15] + F[7][9]*D[9][15] + F[7][10]*D[10][15] + F[7][11]*D[11][15] + F[7][12]*D[12][15])*T + D[7][15];
-	P[8][8] = (Q[0]*G[8][0]*G[8][0] + Q[1]*G[8][1]*G[8][1] + Q[2]*G[8][2]*G[8][2] + F[8][6]*(F[8][6]*D[6][6] + F[8][7]*D[6][7] + F[8][9]*D[6][9] + F[8][10]*D[6][10] + F[8][11]*D[6][11] + F[8][12]*D[6][12]) + F[8][7]*(F[8][6]*D[6][7] + F[8][7]*D[7][7] + F[8][9]*D[7][9] + F[8][10]*D[7][10] + F[8][11]*D[7][11] + F[8][12]*D[7][12]) + F[8][9]*(F[8][6]*D[6][9] + F[8][7]*D[7][9] + F[8][9]*D[9][9] + F[8][10]*D[9][10] + F[8][11]*D[9][11] + F[8][12]*D[9][12]) + F[8][10]*(F[8][6]*D[6][10] + F[8][7]*D[7][10] + F[8][9]*D[9][10] + F[8][10]*D[10][10] + F[8][11]*D[10][11] + F[8][12]*D[10][12]) + F[8][11]*(F[8][6]*D[6][11] + F[8][7]*D[7][11] + F[8][9]*D[9][11] + F[8][10]*D[10][11] + F[8][11]*D[11][11] + F[8][12]*D[11][12]) + F[8][12]*(F[8][6]*D[6][12] + F[8][7]*D[7][12] + F[8][9]*D[9][12] + F[8][10]*D[10][12] + F[8][11]*D[11][12] + F[8][12]*D[12][12]))*Tsq + (2*F[8][6]*D[6][8] + 2*F[8][7]*D[7][8] + 2*F[8][9]*D[8][9] + 2*F[8][10]*D[8][10] + 2*F[8][11]*D[8][11] + 2*F[8][12]*D[8][12])*T + D[8][8];
-	P[8][9] = P[9][8] = (F[9][6]*(F[8][6]*D[6][6] + F[8][7]*D[6][7] + F[8][9]*D[6][9] + F[8][10]*D[6][10] + F[8][11]*D[6][11] + F[8][12]*D[6][12]) + F[9][7]*(F[8][6]*D[6][7] + F[8][7]*D[7][7] + F[8][9]*D[7][9] + F[8][10]*D[7][10] + F[8][11]*D[7][11] + F[8][12]*D[7][12]) + F[9][8]*(F[8][6]*D[6][8] + F[8][7]*D[7][8] + F[8][9]*D[8][9] + F[8][10]*D[8][10] + F[8][11]*D[8][11] + F[8][12]*D[8][12]) + F[9][10]*(F[8][6]*D[6][10] + F[8][7]*D[7][10] + F[8][9]*D[9][10] + F[8][10]*D[10][10] + F[8][11]*D[10][11] + F[8][12]*D[10][12]) + F[9][11]*(F[8][6]*D[6][11] + F[8][7]*D[7][11] + F[8][9]*D[9][11] + F[8][10]*D[10][11] + F[8][11]*D[11][11] + F[8][12]*D[11][12]) + F[9][12]*(F[8][6]*D[6][12] + F[8][7]*D[7][12] + F[8][9]*D[9][12] + F[8][10]*D[10][12] + F[8][11]*D[11][12] + F[8][12]*D[12][12]) + G[8][0]*G[9][0]*Q[0] + G[8][1]*G[9][1]*Q[1] + G[8][2]*G[9][2]*Q[2])*Tsq + (F[9][6]*D[6][8] + F[9][7]*D[7][8] + F[9][8]*D[8][8] + F[8][6]*D[6][9] + F[8][7]*D[7][9] + F[8][9]*D[9][9] + F[8][10]*D[9][10] + F[9][10]*D[8][10] + F[8][11]*D[9][11] + F[9][11]*D[8][11] + F[8][12]*D[9][12] + F[9][12]*D[8][12])*T + D[8][9];
-	P[8][10] = P[10][8] = (F[8][6]*D[6][10] + F[8][7]*D[7][10] + F[8][9]*D[9][10] + F[8][10]*D[10][10] + F[8][11]*D[10][11] + F[8][12]*D[10][12])*T + D[8][10];
-	P[8][11] = P[11][8] = (F[8][6]*D[6][11] + F[8][7]*D[7][11] + F[8][9]*D[9][11] + F[8][10]*D[10][11] + F[8][11]*D[11][11] + F[8][12]*D[11][12])*T + D[8][11];
-	P[8][12] = P[12][8] = (F[8][6]*D[6][12] + F[8][7]*D[7][12] + F[8][9]*D[9][12] + F[8][10]*D[10][12] + F[8][11]*D[11][12] + F[8][12]*D[12][12])*T + D[8][12];
-	P[8][13] = P[13][8] = (F[8][6]*D[6][13] + F[8][7]*D[7][13] + F[8][9]*D[9][13] + F[8][10]*D[10][13] + F[8][11]*D[11][13] + F[8][12]*D[12][13])*T + D[8][13];
-	P[8][14] = P[14][8] = (F[8][6]*D[6][14] + F[8][7]*D[7][14] + F[8][9]*D[9][14] + F[8][10]*D[10][14] + F[8][11]*D[11][14] + F[8][12]*D[12][14])*T + D[8][14];
-	P[8][15] = P[15][8] = (F[8][6]*D[6][15] + F[8][7]*D[7][15] + F[8][9]*D[9][15] + F[8][10]*D[10][15] + F[8][11]*D[11][15] + F[8][12]*D[12][15])*T + D[8][15];
-	P[9][9] = (Q[0]*G[9][0]*G[9][0] + Q[1]*G[9][1]*G[9][1] + Q[2]*G[9][2]*G[9][2] + F[9][6]*(F[9][6]*D[6][6] + F[9][7]*D[6][7] + F[9][8]*D[6][8] + F[9][10]*D[6][10] + F[9][11]*D[6][11] + F[9][12]*D[6][12]) + F[9][7]*(F[9][6]*D[6][7] + F[9][7]*D[7][7] + F[9][8]*D[7][8] + F[9][10]*D[7][10] + F[9][11]*D[7][11] + F[9][12]*D[7][12]) + F[9][8]*(F[9][6]*D[6][8] + F[9][7]*D[7][8] + F[9][8]*D[8][8] + F[9][10]*D[8][10] + F[9][11]*D[8][11] + F[9][12]*D[8][12]) + F[9][10]*(F[9][6]*D[6][10] + F[9][7]*D[7][10] + F[9][8]*D[8][10] + F[9][10]*D[10][10] + F[9][11]*D[10][11] + F[9][12]*D[10][12]) + F[9][11]*(F[9][6]*D[6][11] + F[9][7]*D[7][11] + F[9][8]*D[8][11] + F[9][10]*D[10][11] + F[9][11]*D[11][11] + F[9][12]*D[11][12]) + F[9][12]*(F[9][6]*D[6][12] + F[9][7]*D[7][12] + F[9][8]*D[8][12] + F[9][10]*D[10][12] + F[9][11]*D[11][12] + F[9][12]*D[12][12]))*Tsq + (2*F[9][6]*D[6][9] + 2*F[9][7]*D[7][9] + 2*F[9][8]*D[8][9] + 2*F[9][10]*D[9][10] + 2*F[9][11]*D[9][11] + 2*F[9][12]*D[9][12])*T + D[9][9];
-	P[9][10] = P[10][9] = (F[9][6]*D[6][10] + F[9][7]*D[7][10] + F[9][8]*D[8][10] + F[9][10]*D[10][10] + F[9][11]*D[10][11] + F[9][12]*D[10][12])*T + D[9][10];
-	P[9][11] = P[11][9] = (F[9][6]*D[6][11] + F[9][7]*D[7][11] + F[9][8]*D[8][11] + F[9][10]*D[10][11] + F[9][11]*D[11][11] + F[9][12]*D[11][12])*T + D[9][11];
-	P[9][12] = P[12][9] = (F[9][6]*D[6][12] + F[9][7]*D[7][12] + F[9][8]*D[8][12] + F[9][10]*D[10][12] + F[9][11]*D[11][12] + F[9][12]*D[12][12])*T + D[9][12];
-	P[9][13] = P[13][9] = (F[9][6]*D[6][13] + F[9][7]*D[7][13] + F[9][8]*D[8][13] + F[9][10]*D[10][13] + F[9][11]*D[11][13] + F[9][12]*D[12][13])*T + D[9][13];
-	P[9][14] = P[14][9] = (F[9][6]*D[6][14] + F[9][7]*D[7][14] + F[9][8]*D[8][14] + F[9][10]*D[10][14] + F[9][11]*D[11][14] + F[9][12]*D[12][14])*T + D[9][14];
-	P[9][15] = P[15][9] = (F[9][6]*D[6][15] + F[9][7]*D[7][15] + F[9][8]*D[8][15] + F[9][10]*D[10][15] + F[9][11]*D[11][15] + F[9][12]*D[12][15])*T + D[9][15];
-	P[10][10] = Q[6]*Tsq + D[10][10];
-	P[10][11] = P[11][10] = D[10][11];
-	P[10][12] = P[12][10] = D[10][12];
-	P[10][13] = P[13][10] = D[10][13];
-	P[10][14] = P[14][10] = D[10][14];
-	P[10][15] = P[15][10] = D[10][15];
-	P[11][11] = Q[7]*Tsq + D[11][11];
-	P[11][12] = P[12][11] = D[11][12];
-	P[11][13] = P[13][11] = D[11][13];
-	P[11][14] = P[14][11] = D[11][14];
-	P[11][15] = P[15][11] = D[11][15];
-	P[12][12] = Q[8]*Tsq + D[12][12];
-	P[12][13] = P[13][12] = D[12][13];
-	P[12][14] = P[14][12] = D[12][14];
-	P[12][15] = P[15][12] = D[12][15];
-	P[13][13] = Q[9]*Tsq + D[13][13];
-	P[13][14] = P[14][13] = D[13][14];
-	P[13][15] = P[15][13] = D[13][15];
-	P[14][14] = Q[10]*Tsq + D[14][14];
-	P[14][15] = P[15][14] = D[14][15];
-	P[15][15] = Q[11]*Tsq + D[15][15];
+	P[PIDX(0, 0)] = D[PIDX(3, 3)]*Tsq + (2*D[PIDX(0, 3)])*T + D[PIDX(0, 0)];
+	P[PIDX(0, 1)] = D[PIDX(3, 4)]*Tsq + (D[PIDX(0, 4)] + D[PIDX(1, 3)])*T + D[PIDX(0, 1)];
+	P[PIDX(0, 2)] = D[PIDX(3, 5)]*Tsq + (D[PIDX(0, 5)] + D[PIDX(2, 3)])*T + D[PIDX(0, 2)];
+	P[PIDX(0, 3)] = (F[3][6]*D[PIDX(3, 6)] + F[3][7]*D[PIDX(3, 7)] + F[3][8]*D[PIDX(3, 8)] + F[3][9]*D[PIDX(3, 9)] + F[3][13]*D[PIDX(3, 13)] + F[3][14]*D[PIDX(3, 14)] + F[3][15]*D[PIDX(3, 15)])*Tsq + (D[PIDX(3, 3)] + F[3][6]*D[PIDX(0, 6)] + F[3][7]*D[PIDX(0, 7)] + F[3][8]*D[PIDX(0, 8)] + F[3][9]*D[PIDX(0, 9)] + F[3][13]*D[PIDX(0, 13)] + F[3][14]*D[PIDX(0, 14)] + F[3][15]*D[PIDX(0, 15)])*T + D[PIDX(0, 3)];
+	P[PIDX(0, 4)] = (F[4][6]*D[PIDX(3, 6)] + F[4][7]*D[PIDX(3, 7)] + F[4][8]*D[PIDX(3, 8)] + F[4][9]*D[PIDX(3, 9)] + F[4][13]*D[PIDX(3, 13)] + F[4][14]*D[PIDX(3, 14)] + F[4][15]*D[PIDX(3, 15)])*Tsq + (D[PIDX(3, 4)] + F[4][6]*D[PIDX(0, 6)] + F[4][7]*D[PIDX(0, 7)] + F[4][8]*D[PIDX(0, 8)] + F[4][9]*D[PIDX(0, 9)] + F[4][13]*D[PIDX(0, 13)] + F[4][14]*D[PIDX(0, 14)] + F[4][15]*D[PIDX(0, 15)])*T + D[PIDX(0, 4)];
+	P[PIDX(0, 5)] = (F[5][6]*D[PIDX(3, 6)] + F[5][7]*D[PIDX(3, 7)] + F[5][8]*D[PIDX(3, 8)] + F[5][9]*D[PIDX(3, 9)] + F[5][13]*D[PIDX(3, 13)] + F[5][14]*D[PIDX(3, 14)] + F[5][15]*D[PIDX(3, 15)])*Tsq + (D[PIDX(3, 5)] + F[5][6]*D[PIDX(0, 6)] + F[5][7]*D[PIDX(0, 7)] + F[5][8]*D[PIDX(0, 8)] + F[5][9]*D[PIDX(0, 9)] + F[5][13]*D[PIDX(0, 13)] + F[5][14]*D[PIDX(0, 14)] + F[5][15]*D[PIDX(0, 15)])*T + D[PIDX(0, 5)];
+	P[PIDX(0, 6)] = (F[6][7]*D[PIDX(3, 7)] + F[6][8]*D[PIDX(3, 8)] + F[6][9]*D[PIDX(3, 9)] + F[6][10]*D[PIDX(3, 10)] + F[6][11]*D[PIDX(3, 11)] + F[6][12]*D[PIDX(3, 12)])*Tsq + (D[PIDX(3, 6)] + F[6][7]*D[PIDX(0, 7)] + F[6][8]*D[PIDX(0, 8)] + F[6][9]*D[PIDX(0, 9)] + F[6][10]*D[PIDX(0, 10)] + F[6][11]*D[PIDX(0, 11)] + F[6][12]*D[PIDX(0, 12)])*T + D[PIDX(0, 6)];
+	P[PIDX(0, 7)] = (F[7][6]*D[PIDX(3, 6)] + F[7][8]*D[PIDX(3, 8)] + F[7][9]*D[PIDX(3, 9)] + F[7][10]*D[PIDX(3, 10)] + F[7][11]*D[PIDX(3, 11)] + F[7][12]*D[PIDX(3, 12)])*Tsq + (D[PIDX(3, 7)] + F[7][6]*D[PIDX(0, 6)] + F[7][8]*D[PIDX(0, 8)] + F[7][9]*D[PIDX(0, 9)] + F[7][10]*D[PIDX(0, 10)] + F[7][11]*D[PIDX(0, 11)] + F[7][12]*D[PIDX(0, 12)])*T + D[PIDX(0, 7)];
+	P[PIDX(0, 8)] = (F[8][6]*D[PIDX(3, 6)] + F[8][7]*D[PIDX(3, 7)] + F[8][9]*D[PIDX(3, 9)] + F[8][10]*D[PIDX(3, 10)] + F[8][11]*D[PIDX(3, 11)] + F[8][12]*D[PIDX(3, 12)])*Tsq + (D[PIDX(3, 8)] + F[8][6]*D[PIDX(0, 6)] + F[8][7]*D[PIDX(0, 7)] + F[8][9]*D[PIDX(0, 9)] + F[8][10]*D[PIDX(0, 10)] + F[8][11]*D[PIDX(0, 11)] + F[8][12]*D[PIDX(0, 12)])*T + D[PIDX(0, 8)];
+	P[PIDX(0, 9)] = (F[9][6]*D[PIDX(3, 6)] + F[9][7]*D[PIDX(3, 7)] + F[9][8]*D[PIDX(3, 8)] + F[9][10]*D[PIDX(3, 10)] + F[9][11]*D[PIDX(3, 11)] + F[9][12]*D[PIDX(3, 12)])*Tsq + (D[PIDX(3, 9)] + F[9][6]*D[PIDX(0, 6)] + F[9][7]*D[PIDX(0, 7)] + F[9][8]*D[PIDX(0, 8)] + F[9][10]*D[PIDX(0, 10)] + F[9][11]*D[PIDX(0, 11)] + F[9][12]*D[PIDX(0, 12)])*T + D[PIDX(0, 9)];
+	P[PIDX(0, 10)] = D[PIDX(3, 10)]*T + D[PIDX(0, 10)];
+	P[PIDX(0, 11)] = D[PIDX(3, 11)]*T + D[PIDX(0, 11)];
+	P[PIDX(0, 12)] = D[PIDX(3, 12)]*T + D[PIDX(0, 12)];
+	P[PIDX(0, 13)] = D[PIDX(3, 13)]*T + D[PIDX(0, 13)];
+	P[PIDX(0, 14)] = D[PIDX(3, 14)]*T + D[PIDX(0, 14)];
+	P[PIDX(0, 15)] = D[PIDX(3, 15)]*T + D[PIDX(0, 15)];
+	P[PIDX(1, 1)] = D[PIDX(4, 4)]*Tsq + (2*D[PIDX(1, 4)])*T + D[PIDX(1, 1)];
+	P[PIDX(1, 2)] = D[PIDX(4, 5)]*Tsq + (D[PIDX(1, 5)] + D[PIDX(2, 4)])*T + D[PIDX(1, 2)];
+	P[PIDX(1, 3)] = (F[3][6]*D[PIDX(4, 6)] + F[3][7]*D[PIDX(4, 7)] + F[3][8]*D[PIDX(4, 8)] + F[3][9]*D[PIDX(4, 9)] + F[3][13]*D[PIDX(4, 13)] + F[3][14]*D[PIDX(4, 14)] + F[3][15]*D[PIDX(4, 15)])*Tsq + (D[PIDX(3, 4)] + F[3][6]*D[PIDX(1, 6)] + F[3][7]*D[PIDX(1, 7)] + F[3][8]*D[PIDX(1, 8)] + F[3][9]*D[PIDX(1, 9)] + F[3][13]*D[PIDX(1, 13)] + F[3][14]*D[PIDX(1, 14)] + F[3][15]*D[PIDX(1, 15)])*T + D[PIDX(1, 3)];
+	P[PIDX(1, 4)] = (F[4][6]*D[PIDX(4, 6)] + F[4][7]*D[PIDX(4, 7)] + F[4][8]*D[PIDX(4, 8)] + F[4][9]*D[PIDX(4, 9)] + F[4][13]*D[PIDX(4, 13)] + F[4][14]*D[PIDX(4, 14)] + F[4][15]*D[PIDX(4, 15)])*Tsq + (D[PIDX(4, 4)] + F[4][6]*D[PIDX(1, 6)] + F[4][7]*D[PIDX(1, 7)] + F[4][8]*D[PIDX(1, 8)] + F[4][9]*D[PIDX(1, 9)] + F[4][13]*D[PIDX(1, 13)] + F[4][14]*D[PIDX(1, 14)] + F[4][15]*D[PIDX(1, 15)])*T + D[PIDX(1, 4)];
+	P[PIDX(1, 5)] = (F[5][6]*D[PIDX(4, 6)] + F[5][7]*D[PIDX(4, 7)] + F[5][8]*D[PIDX(4, 8)] + F[5][9]*D[PIDX(4, 9)] + F[5][13]*D[PIDX(4, 13)] + F[5][14]*D[PIDX(4, 14)] + F[5][15]*D[PIDX(4, 15)])*Tsq + (D[PIDX(4, 5)] + F[5][6]*D[PIDX(1, 6)] + F[5][7]*D[PIDX(1, 7)] + F[5][8]*D[PIDX(1, 8)] + F[5][9]*D[PIDX(1, 9)] + F[5][13]*D[PIDX(1, 13)] + F[5][14]*D[PIDX(1, 14)] + F[5][15]*D[PIDX(1, 15)])*T + D[PIDX(1, 5)];
+	P[PIDX(1, 6)] = (F[6][7]*D[PIDX(4, 7)] + F[6][8]*D[PIDX(4, 8)] + F[6][9]*D[PIDX(4, 9)] + F[6][10]*D[PIDX(4, 10)] + F[6][11]*D[PIDX(4, 11)] + F[6][12]*D[PIDX(4, 12)])*Tsq + (D[PIDX(4, 6)] + F[6][7]*D[PIDX(1, 7)] + F[6][8]*D[PIDX(1, 8)] + F[6][9]*D[PIDX(1, 9)] + F[6][10]*D[PIDX(1, 10)] + F[6][11]*D[PIDX(1, 11)] + F[6][12]*D[PIDX(1, 12)])*T + D[PIDX(1, 6)];
+	P[PIDX(1, 7)] = (F[7][6]*D[PIDX(4, 6)] + F[7][8]*D[PIDX(4, 8)] + F[7][9]*D[PIDX(4, 9)] + F[7][10]*D[PIDX(4, 10)] + F[7][11]*D[PIDX(4, 11)] + F[7][12]*D[PIDX(4, 12)])*Tsq + (D[PIDX(4, 7)] + F[7][6]*D[PIDX(1, 6)] + F[7][8]*D[PIDX(1, 8)] + F[7][9]*D[PIDX(1, 9)] + F[7][10]*D[PIDX(1, 10)] + F[7][11]*D[PIDX(1, 11)] + F[7][12]*D[PIDX(1, 12)])*T + D[PIDX(1, 7)];
+	P[PIDX(1, 8)] = (F[8][6]*D[PIDX(4, 6)] + F[8][7]*D[PIDX(4, 7)] + F[8][9]*D[PIDX(4, 9)] + F[8][10]*D[PIDX(4, 10)] + F[8][11]*D[PIDX(4, 11)] + F[8][12]*D[PIDX(4, 12)])*Tsq + (D[PIDX(4, 8)] + F[8][6]*D[PIDX(1, 6)] + F[8][7]*D[PIDX(1, 7)] + F[8][9]*D[PIDX(1, 9)] + F[8][10]*D[PIDX(1, 10)] + F[8][11]*D[PIDX(1, 11)] + F[8][12]*D[PIDX(1, 12)])*T + D[PIDX(1, 8)];
+	P[PIDX(1, 9)] = (F[9][6]*D[PIDX(4, 6)] + F[9][7]*D[PIDX(4, 7)] + F[9][8]*D[PIDX(4, 8)] + F[9][10]*D[PIDX(4, 10)] + F[9][11]*D[PIDX(4, 11)] + F[9][12]*D[PIDX(4, 12)])*Tsq + (D[PIDX(4, 9)] + F[9][6]*D[PIDX(1, 6)] + F[9][7]*D[PIDX(1, 7)] + F[9][8]*D[PIDX(1, 8)] + F[9][10]*D[PIDX(1, 10)] + F[9][11]*D[PIDX(1, 11)] + F[9][12]*D[PIDX(1, 12)])*T + D[PIDX(1, 9)];
+	P[PIDX(1, 10)] = D[PIDX(4, 10)]*T + D[PIDX(1, 10)];
+	P[PIDX(1, 11)] = D[PIDX(4, 11)]*T + D[PIDX(1, 11)];
+	P[PIDX(1, 12)] = D[PIDX(4, 12)]*T + D[PIDX(1, 12)];
+	P[PIDX(1, 13)] = D[PIDX(4, 13)]*T + D[PIDX(1, 13)];
+	P[PIDX(1, 14)] = D[PIDX(4, 14)]*T + D[PIDX(1, 14)];
+	P[PIDX(1, 15)] = D[PIDX(4, 15)]*T + D[PIDX(1, 15)];
+	P[PIDX(2, 2)] = D[PIDX(5, 5)]*Tsq + (2*D[PIDX(2, 5)])*T + D[PIDX(2, 2)];
+	P[PIDX(2, 3)] = (F[3][6]*D[PIDX(5, 6)] + F[3][7]*D[PIDX(5, 7)] + F[3][8]*D[PIDX(5, 8)] + F[3][9]*D[PIDX(5, 9)] + F[3][13]*D[PIDX(5, 13)] + F[3][14]*D[PIDX(5, 14)] + F[3][15]*D[PIDX(5, 15)])*Tsq + (D[PIDX(3, 5)] + F[3][6]*D[PIDX(2, 6)] + F[3][7]*D[PIDX(2, 7)] + F[3][8]*D[PIDX(2, 8)] + F[3][9]*D[PIDX(2, 9)] + F[3][13]*D[PIDX(2, 13)] + F[3][14]*D[PIDX(2, 14)] + F[3][15]*D[PIDX(2, 15)])*T + D[PIDX(2, 3)];
+	P[PIDX(2, 4)] = (F[4][6]*D[PIDX(5, 6)] + F[4][7]*D[PIDX(5, 7)] + F[4][8]*D[PIDX(5, 8)] + F[4][9]*D[PIDX(5, 9)] + F[4][13]*D[PIDX(5, 13)] + F[4][14]*D[PIDX(5, 14)] + F[4][15]*D[PIDX(5, 15)])*Tsq + (D[PIDX(4, 5)] + F[4][6]*D[PIDX(2, 6)] + F[4][7]*D[PIDX(2, 7)] + F[4][8]*D[PIDX(2, 8)] + F[4][9]*D[PIDX(2, 9)] + F[4][13]*D[PIDX(2, 13)] + F[4][14]*D[PIDX(2, 14)] + F[4][15]*D[PIDX(2, 15)])*T + D[PIDX(2, 4)];
+	P[PIDX(2, 5)] = (F[5][6]*D[PIDX(5, 6)] + F[5][7]*D[PIDX(5, 7)] + F[5][8]*D[PIDX(5, 8)] + F[5][9]*D[PIDX(5, 9)] + F[5][13]*D[PIDX(5, 13)] + F[5][14]*D[PIDX(5, 14)] + F[5][15]*D[PIDX(5, 15)])*Tsq + (D[PIDX(5, 5)] + F[5][6]*D[PIDX(2, 6)] + F[5][7]*D[PIDX(2, 7)] + F[5][8]*D[PIDX(2, 8)] + F[5][9]*D[PIDX(2, 9)] + F[5][13]*D[PIDX(2, 13)] + F[5][14]*D[PIDX(2, 14)] + F[5][15]*D[PIDX(2, 15)])*T + D[PIDX(2, 5)];
+	P[PIDX(2, 6)] = (F[6][7]*D[PIDX(5, 7)] + F[6][8]*D[PIDX(5, 8)] + F[6][9]*D[PIDX(5, 9)] + F[6][10]*D[PIDX(5, 10)] + F[6][11]*D[PIDX(5, 11)] + F[6][12]*D[PIDX(5, 12)])*Tsq + (D[PIDX(5, 6)] + F[6][7]*D[PIDX(2, 7)] + F[6][8]*D[PIDX(2, 8)] + F[6][9]*D[PIDX(2, 9)] + F[6][10]*D[PIDX(2, 10)] + F[6][11]*D[PIDX(2, 11)] + F[6][12]*D[PIDX(2, 12)])*T + D[PIDX(2, 6)];
+	P[PIDX(2, 7)] = (F[7][6]*D[PIDX(5, 6)] + F[7][8]*D[PIDX(5, 8)] + F[7][9]*D[PIDX(5, 9)] + F[7][10]*D[PIDX(5, 10)] + F[7][11]*D[PIDX(5, 11)] + F[7][12]*D[PIDX(5, 12)])*Tsq + (D[PIDX(5, 7)] + F[7][6]*D[PIDX(2, 6)] + F[7][8]*D[PIDX(2, 8)] + F[7][9]*D[PIDX(2, 9)] + F[7][10]*D[PIDX(2, 10)] + F[7][11]*D[PIDX(2, 11)] + F[7][12]*D[PIDX(2, 12)])*T + D[PIDX(2, 7)];
+	P[PIDX(2, 8)] = (F[8][6]*D[PIDX(5, 6)] + F[8][7]*D[PIDX(5, 7)] + F[8][9]*D[PIDX(5, 9)] + F[8][10]*D[PIDX(5, 10)] + F[8][11]*D[PIDX(5, 11)] + F[8][12]*D[PIDX(5, 12)])*Tsq + (D[PIDX(5, 8)] + F[8][6]*D[PIDX(2, 6)] + F[8][7]*D[PIDX(2, 7)] + F[8][9]*D[PIDX(2, 9)] + F[8][10]*D[PIDX(2, 10)] + F[8][11]*D[PIDX(2, 11)] + F[8][12]*D[PIDX(2, 12)])*T + D[PIDX(2, 8)];
+	P[PIDX(2, 9)] = (F[9][6]*D[PIDX(5, 6)] + F[9][7]*D[PIDX(5, 7)] + F[9][8]*D[PIDX(5, 8)] + F[9][10]*D[PIDX(5, 10)] + F[9][11]*D[PIDX(5, 11)] + F[9][12]*D[PIDX(5, 12)])*Tsq + (D[PIDX(5, 9)] + F[9][6]*D[PIDX(2, 6)] + F[9][7]*D[PIDX(2, 7)] + F[9][8]*D[PIDX(2, 8)] + F[9][10]*D[PIDX(2, 10)] + F[9][11]*D[PIDX(2, 11)] + F[9][12]*D[PIDX(2, 12)])*T + D[PIDX(2, 9)];
+	P[PIDX(2, 10)] = D[PIDX(5, 10)]*T + D[PIDX(2, 10)];
+	P[PIDX(2, 11)] = D[PIDX(5, 11)]*T + D[PIDX(2, 11)];
+	P[PIDX(2, 12)] = D[PIDX(5, 12)]*T + D[PIDX(2, 12)];
+	P[PIDX(2, 13)] = D[PIDX(5, 13)]*T + D[PIDX(2, 13)];
+	P[PIDX(2, 14)] = D[PIDX(5, 14)]*T + D[PIDX(2, 14)];
+	P[PIDX(2, 15)] = D[PIDX(5, 15)]*T + D[PIDX(2, 15)];
+	P[PIDX(3, 3)] = (Q[3]*G[3][3]*G[3][3] + Q[4]*G[3][4]*G[3][4] + Q[5]*G[3][5]*G[3][5] + F[3][6]*(F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[3][8]*D[PIDX(6, 8)] + F[3][9]*D[PIDX(6, 9)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)]) + F[3][7]*(F[3][6]*D[PIDX(6, 7)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[3][9]*D[PIDX(7, 9)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)]) + F[3][8]*(F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)]) + F[3][9]*(F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)]) + F[3][13]*(F[3][6]*D[PIDX(6, 13)] + F[3][7]*D[PIDX(7, 13)] + F[3][8]*D[PIDX(8, 13)] + F[3][9]*D[PIDX(9, 13)] + F[3][13]*D[PIDX(13, 13)] + F[3][14]*D[PIDX(13, 14)] + F[3][15]*D[PIDX(13, 15)]) + F[3][14]*(F[3][6]*D[PIDX(6, 14)] + F[3][7]*D[PIDX(7, 14)] + F[3][8]*D[PIDX(8, 14)] + F[3][9]*D[PIDX(9, 14)] + F[3][13]*D[PIDX(13, 14)] + F[3][14]*D[PIDX(14, 14)] + F[3][15]*D[PIDX(14, 15)]) + F[3][15]*(F[3][6]*D[PIDX(6, 15)] + F[3][7]*D[PIDX(7, 15)] + F[3][8]*D[PIDX(8, 15)] + F[3][9]*D[PIDX(9, 15)] + F[3][13]*D[PIDX(13, 15)] + F[3][14]*D[PIDX(14, 15)] + F[3][15]*D[PIDX(15, 15)]))*Tsq + (2*F[3][6]*D[PIDX(3, 6)] + 2*F[3][7]*D[PIDX(3, 7)] + 2*F[3][8]*D[PIDX(3, 8)] + 2*F[3][9]*D[PIDX(3, 9)] + 2*F[3][13]*D[PIDX(3, 13)] + 2*F[3][14]*D[PIDX(3, 14)] + 2*F[3][15]*D[PIDX(3, 15)])*T + D[PIDX(3, 3)];
+	P[PIDX(3, 4)] = (F[4][6]*(F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[3][8]*D[PIDX(6, 8)] + F[3][9]*D[PIDX(6, 9)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)]) + F[4][7]*(F[3][6]*D[PIDX(6, 7)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[3][9]*D[PIDX(7, 9)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)]) + F[4][8]*(F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)]) + F[4][9]*(F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)]) + F[4][13]*(F[3][6]*D[PIDX(6, 13)] + F[3][7]*D[PIDX(7, 13)] + F[3][8]*D[PIDX(8, 13)] + F[3][9]*D[PIDX(9, 13)] + F[3][13]*D[PIDX(13, 13)] + F[3][14]*D[PIDX(13, 14)] + F[3][15]*D[PIDX(13, 15)]) + F[4][14]*(F[3][6]*D[PIDX(6, 14)] + F[3][7]*D[PIDX(7, 14)] + F[3][8]*D[PIDX(8, 14)] + F[3][9]*D[PIDX(9, 14)] + F[3][13]*D[PIDX(13, 14)] + F[3][14]*D[PIDX(14, 14)] + F[3][15]*D[PIDX(14, 15)]) + F[4][15]*(F[3][6]*D[PIDX(6, 15)] + F[3][7]*D[PIDX(7, 15)] + F[3][8]*D[PIDX(8, 15)] + F[3][9]*D[PIDX(9, 15)] + F[3][13]*D[PIDX(13, 15)] + F[3][14]*D[PIDX(14, 15)] + F[3][15]*D[PIDX(15, 15)]) + G[3][3]*G[4][3]*Q[3] + G[3][4]*G[4][4]*Q[4] + G[3][5]*G[4][5]*Q[5])*Tsq + (F[3][6]*D[PIDX(4, 6)] + F[4][6]*D[PIDX(3, 6)] + F[3][7]*D[PIDX(4, 7)] + F[4][7]*D[PIDX(3, 7)] + F[3][8]*D[PIDX(4, 8)] + F[4][8]*D[PIDX(3, 8)] + F[3][9]*D[PIDX(4, 9)] + F[4][9]*D[PIDX(3, 9)] + F[3][13]*D[PIDX(4, 13)] + F[4][13]*D[PIDX(3, 13)] + F[3][14]*D[PIDX(4, 14)] + F[4][14]*D[PIDX(3, 14)] + F[3][15]*D[PIDX(4, 15)] + F[4][15]*D[PIDX(3, 15)])*T + D[PIDX(3, 4)];
+	P[PIDX(3, 5)] = (F[5][6]*(F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[3][8]*D[PIDX(6, 8)] + F[3][9]*D[PIDX(6, 9)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)]) + F[5][7]*(F[3][6]*D[PIDX(6, 7)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[3][9]*D[PIDX(7, 9)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)]) + F[5][8]*(F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)]) + F[5][9]*(F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)]) + F[5][13]*(F[3][6]*D[PIDX(6, 13)] + F[3][7]*D[PIDX(7, 13)] + F[3][8]*D[PIDX(8, 13)] + F[3][9]*D[PIDX(9, 13)] + F[3][13]*D[PIDX(13, 13)] + F[3][14]*D[PIDX(13, 14)] + F[3][15]*D[PIDX(13, 15)]) + F[5][14]*(F[3][6]*D[PIDX(6, 14)] + F[3][7]*D[PIDX(7, 14)] + F[3][8]*D[PIDX(8, 14)] + F[3][9]*D[PIDX(9, 14)] + F[3][13]*D[PIDX(13, 14)] + F[3][14]*D[PIDX(14, 14)] + F[3][15]*D[PIDX(14, 15)]) + F[5][15]*(F[3][6]*D[PIDX(6, 15)] + F[3][7]*D[PIDX(7, 15)] + F[3][8]*D[PIDX(8, 15)] + F[3][9]*D[PIDX(9, 15)] + F[3][13]*D[PIDX(13, 15)] + F[3][14]*D[PIDX(14, 15)] + F[3][15]*D[PIDX(15, 15)]) + G[3][3]*G[5][3]*Q[3] + G[3][4]*G[5][4]*Q[4] + G[3][5]*G[5][5]*Q[5])*Tsq + (F[3][6]*D[PIDX(5, 6)] + F[5][6]*D[PIDX(3, 6)] + F[3][7]*D[PIDX(5, 7)] + F[5][7]*D[PIDX(3, 7)] + F[3][8]*D[PIDX(5, 8)] + F[5][8]*D[PIDX(3, 8)] + F[3][9]*D[PIDX(5, 9)] + F[5][9]*D[PIDX(3, 9)] + F[3][13]*D[PIDX(5, 13)] + F[5][13]*D[PIDX(3, 13)] + F[3][14]*D[PIDX(5, 14)] + F[5][14]*D[PIDX(3, 14)] + F[3][15]*D[PIDX(5, 15)] + F[5][15]*D[PIDX(3, 15)])*T + D[PIDX(3, 5)];
+	P[PIDX(3, 6)] = (F[6][7]*(F[3][6]*D[PIDX(6, 7)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[3][9]*D[PIDX(7, 9)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)]) + F[6][8]*(F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)]) + F[6][9]*(F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)]) + F[6][10]*(F[3][6]*D[PIDX(6, 10)] + F[3][7]*D[PIDX(7, 10)] + F[3][8]*D[PIDX(8, 10)] + F[3][9]*D[PIDX(9, 10)] + F[3][13]*D[PIDX(10, 13)] + F[3][14]*D[PIDX(10, 14)] + F[3][15]*D[PIDX(10, 15)]) + F[6][11]*(F[3][6]*D[PIDX(6, 11)] + F[3][7]*D[PIDX(7, 11)] + F[3][8]*D[PIDX(8, 11)] + F[3][9]*D[PIDX(9, 11)] + F[3][13]*D[PIDX(11, 13)] + F[3][14]*D[PIDX(11, 14)] + F[3][15]*D[PIDX(11, 15)]) + F[6][12]*(F[3][6]*D[PIDX(6, 12)] + F[3][7]*D[PIDX(7, 12)] + F[3][8]*D[PIDX(8, 12)] + F[3][9]*D[PIDX(9, 12)] + F[3][13]*D[PIDX(12, 13)] + F[3][14]*D[PIDX(12, 14)] + F[3][15]*D[PIDX(12, 15)]))*Tsq + (F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[6][7]*D[PIDX(3, 7)] + F[3][8]*D[PIDX(6, 8)] + F[6][8]*D[PIDX(3, 8)] + F[3][9]*D[PIDX(6, 9)] + F[6][9]*D[PIDX(3, 9)] + F[6][10]*D[PIDX(3, 10)] + F[6][11]*D[PIDX(3, 11)] + F[6][12]*D[PIDX(3, 12)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)])*T + D[PIDX(3, 6)];
+	P[PIDX(3, 7)] = (F[7][6]*(F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[3][8]*D[PIDX(6, 8)] + F[3][9]*D[PIDX(6, 9)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)]) + F[7][8]*(F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)]) + F[7][9]*(F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)]) + F[7][10]*(F[3][6]*D[PIDX(6, 10)] + F[3][7]*D[PIDX(7, 10)] + F[3][8]*D[PIDX(8, 10)] + F[3][9]*D[PIDX(9, 10)] + F[3][13]*D[PIDX(10, 13)] + F[3][14]*D[PIDX(10, 14)] + F[3][15]*D[PIDX(10, 15)]) + F[7][11]*(F[3][6]*D[PIDX(6, 11)] + F[3][7]*D[PIDX(7, 11)] + F[3][8]*D[PIDX(8, 11)] + F[3][9]*D[PIDX(9, 11)] + F[3][13]*D[PIDX(11, 13)] + F[3][14]*D[PIDX(11, 14)] + F[3][15]*D[PIDX(11, 15)]) + F[7][12]*(F[3][6]*D[PIDX(6, 12)] + F[3][7]*D[PIDX(7, 12)] + F[3][8]*D[PIDX(8, 12)] + F[3][9]*D[PIDX(9, 12)] + F[3][13]*D[PIDX(12, 13)] + F[3][14]*D[PIDX(12, 14)] + F[3][15]*D[PIDX(12, 15)]))*Tsq + (F[3][6]*D[PIDX(6, 7)] + F[7][6]*D[PIDX(3, 6)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[7][8]*D[PIDX(3, 8)] + F[3][9]*D[PIDX(7, 9)] + F[7][9]*D[PIDX(3, 9)] + F[7][10]*D[PIDX(3, 10)] + F[7][11]*D[PIDX(3, 11)] + F[7][12]*D[PIDX(3, 12)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)])*T + D[PIDX(3, 7)];
+	P[PIDX(3, 8)] = (F[8][6]*(F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[3][8]*D[PIDX(6, 8)] + F[3][9]*D[PIDX(6, 9)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)]) + F[8][7]*(F[3][6]*D[PIDX(6, 7)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[3][9]*D[PIDX(7, 9)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)]) + F[8][9]*(F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)]) + F[8][10]*(F[3][6]*D[PIDX(6, 10)] + F[3][7]*D[PIDX(7, 10)] + F[3][8]*D[PIDX(8, 10)] + F[3][9]*D[PIDX(9, 10)] + F[3][13]*D[PIDX(10, 13)] + F[3][14]*D[PIDX(10, 14)] + F[3][15]*D[PIDX(10, 15)]) + F[8][11]*(F[3][6]*D[PIDX(6, 11)] + F[3][7]*D[PIDX(7, 11)] + F[3][8]*D[PIDX(8, 11)] + F[3][9]*D[PIDX(9, 11)] + F[3][13]*D[PIDX(11, 13)] + F[3][14]*D[PIDX(11, 14)] + F[3][15]*D[PIDX(11, 15)]) + F[8][12]*(F[3][6]*D[PIDX(6, 12)] + F[3][7]*D[PIDX(7, 12)] + F[3][8]*D[PIDX(8, 12)] + F[3][9]*D[PIDX(9, 12)] + F[3][13]*D[PIDX(12, 13)] + F[3][14]*D[PIDX(12, 14)] + F[3][15]*D[PIDX(12, 15)]))*Tsq + (F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[8][6]*D[PIDX(3, 6)] + F[8][7]*D[PIDX(3, 7)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[8][9]*D[PIDX(3, 9)] + F[8][10]*D[PIDX(3, 10)] + F[8][11]*D[PIDX(3, 11)] + F[8][12]*D[PIDX(3, 12)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)])*T + D[PIDX(3, 8)];
+	P[PIDX(3, 9)] = (F[9][6]*(F[3][6]*D[PIDX(6, 6)] + F[3][7]*D[PIDX(6, 7)] + F[3][8]*D[PIDX(6, 8)] + F[3][9]*D[PIDX(6, 9)] + F[3][13]*D[PIDX(6, 13)] + F[3][14]*D[PIDX(6, 14)] + F[3][15]*D[PIDX(6, 15)]) + F[9][7]*(F[3][6]*D[PIDX(6, 7)] + F[3][7]*D[PIDX(7, 7)] + F[3][8]*D[PIDX(7, 8)] + F[3][9]*D[PIDX(7, 9)] + F[3][13]*D[PIDX(7, 13)] + F[3][14]*D[PIDX(7, 14)] + F[3][15]*D[PIDX(7, 15)]) + F[9][8]*(F[3][6]*D[PIDX(6, 8)] + F[3][7]*D[PIDX(7, 8)] + F[3][8]*D[PIDX(8, 8)] + F[3][9]*D[PIDX(8, 9)] + F[3][13]*D[PIDX(8, 13)] + F[3][14]*D[PIDX(8, 14)] + F[3][15]*D[PIDX(8, 15)]) + F[9][10]*(F[3][6]*D[PIDX(6, 10)] + F[3][7]*D[PIDX(7, 10)] + F[3][8]*D[PIDX(8, 10)] + F[3][9]*D[PIDX(9, 10)] + F[3][13]*D[PIDX(10, 13)] + F[3][14]*D[PIDX(10, 14)] + F[3][15]*D[PIDX(10, 15)]) + F[9][11]*(F[3][6]*D[PIDX(6, 11)] + F[3][7]*D[PIDX(7, 11)] + F[3][8]*D[PIDX(8, 11)] + F[3][9]*D[PIDX(9, 11)] + F[3][13]*D[PIDX(11, 13)] + F[3][14]*D[PIDX(11, 14)] + F[3][15]*D[PIDX(11, 15)]) + F[9][12]*(F[3][6]*D[PIDX(6, 12)] + F[3][7]*D[PIDX(7, 12)] + F[3][8]*D[PIDX(8, 12)] + F[3][9]*D[PIDX(9, 12)] + F[3][13]*D[PIDX(12, 13)] + F[3][14]*D[PIDX(12, 14)] + F[3][15]*D[PIDX(12, 15)]))*Tsq + (F[9][6]*D[PIDX(3, 6)] + F[9][7]*D[PIDX(3, 7)] + F[9][8]*D[PIDX(3, 8)] + F[3][6]*D[PIDX(6, 9)] + F[3][7]*D[PIDX(7, 9)] + F[3][8]*D[PIDX(8, 9)] + F[3][9]*D[PIDX(9, 9)] + F[9][10]*D[PIDX(3, 10)] + F[9][11]*D[PIDX(3, 11)] + F[9][12]*D[PIDX(3, 12)] + F[3][13]*D[PIDX(9, 13)] + F[3][14]*D[PIDX(9, 14)] + F[3][15]*D[PIDX(9, 15)])*T + D[PIDX(3, 9)];
+	P[PIDX(3, 10)] = (F[3][6]*D[PIDX(6, 10)] + F[3][7]*D[PIDX(7, 10)] + F[3][8]*D[PIDX(8, 10)] + F[3][9]*D[PIDX(9, 10)] + F[3][13]*D[PIDX(10, 13)] + F[3][14]*D[PIDX(10, 14)] + F[3][15]*D[PIDX(10, 15)])*T + D[PIDX(3, 10)];
+	P[PIDX(3, 11)] = (F[3][6]*D[PIDX(6, 11)] + F[3][7]*D[PIDX(7, 11)] + F[3][8]*D[PIDX(8, 11)] + F[3][9]*D[PIDX(9, 11)] + F[3][13]*D[PIDX(11, 13)] + F[3][14]*D[PIDX(11, 14)] + F[3][15]*D[PIDX(11, 15)])*T + D[PIDX(3, 11)];
+	P[PIDX(3, 12)] = (F[3][6]*D[PIDX(6, 12)] + F[3][7]*D[PIDX(7, 12)] + F[3][8]*D[PIDX(8, 12)] + F[3][9]*D[PIDX(9, 12)] + F[3][13]*D[PIDX(12, 13)] + F[3][14]*D[PIDX(12, 14)] + F[3][15]*D[PIDX(12, 15)])*T + D[PIDX(3, 12)];
+	P[PIDX(3, 13)] = (F[3][6]*D[PIDX(6, 13)] + F[3][7]*D[PIDX(7, 13)] + F[3][8]*D[PIDX(8, 13)] + F[3][9]*D[PIDX(9, 13)] + F[3][13]*D[PIDX(13, 13)] + F[3][14]*D[PIDX(13, 14)] + F[3][15]*D[PIDX(13, 15)])*T + D[PIDX(3, 13)];
+	P[PIDX(3, 14)] = (F[3][6]*D[PIDX(6, 14)] + F[3][7]*D[PIDX(7, 14)] + F[3][8]*D[PIDX(8, 14)] + F[3][9]*D[PIDX(9, 14)] + F[3][13]*D[PIDX(13, 14)] + F[3][14]*D[PIDX(14, 14)] + F[3][15]*D[PIDX(14, 15)])*T + D[PIDX(3, 14)];
+	P[PIDX(3, 15)] = (F[3][6]*D[PIDX(6, 15)] + F[3][7]*D[PIDX(7, 15)] + F[3][8]*D[PIDX(8, 15)] + F[3][9]*D[PIDX(9, 15)] + F[3][13]*D[PIDX(13, 15)] + F[3][14]*D[PIDX(14, 15)] + F[3][15]*D[PIDX(15, 15)])*T + D[PIDX(3, 15)];
+	P[PIDX(4, 4)] = (Q[3]*G[4][3]*G[4][3] + Q[4]*G[4][4]*G[4][4] + Q[5]*G[4][5]*G[4][5] + F[4][6]*(F[4][6]*D[PIDX(6, 6)] + F[4][7]*D[PIDX(6, 7)] + F[4][8]*D[PIDX(6, 8)] + F[4][9]*D[PIDX(6, 9)] + F[4][13]*D[PIDX(6, 13)] + F[4][14]*D[PIDX(6, 14)] + F[4][15]*D[PIDX(6, 15)]) + F[4][7]*(F[4][6]*D[PIDX(6, 7)] + F[4][7]*D[PIDX(7, 7)] + F[4][8]*D[PIDX(7, 8)] + F[4][9]*D[PIDX(7, 9)] + F[4][13]*D[PIDX(7, 13)] + F[4][14]*D[PIDX(7, 14)] + F[4][15]*D[PIDX(7, 15)]) + F[4][8]*(F[4][6]*D[PIDX(6, 8)] + F[4][7]*D[PIDX(7, 8)] + F[4][8]*D[PIDX(8, 8)] + F[4][9]*D[PIDX(8, 9)] + F[4][13]*D[PIDX(8, 13)] + F[4][14]*D[PIDX(8, 14)] + F[4][15]*D[PIDX(8, 15)]) + F[4][9]*(F[4][6]*D[PIDX(6, 9)] + F[4][7]*D[PIDX(7, 9)] + F[4][8]*D[PIDX(8, 9)] + F[4][9]*D[PIDX(9, 9)] + F[4][13]*D[PIDX(9, 13)] + F[4][14]*D[PIDX(9, 14)] + F[4][15]*D[PIDX(9, 15)]) + F[4][13]*(F[4][6]*D[PIDX(6, 13)] + F[4][7]*D[PIDX(7, 13)] + F[4][8]*D[PIDX(8, 13)] + F[4][9]*D[PIDX(9, 13)] + F[4][13]*D[PIDX(13, 13)] + F[4][14]*D[PIDX(13, 14)] + F[4][15]*D[PIDX(13, 15)]) + F[4][14]*(F[4][6]*D[PIDX(6, 14)] + F[4][7]*D[PIDX(7, 14)] + F[4][8]*D[PIDX(8, 14)] + F[4][9]*D[PIDX(9, 14)] + F[4][13]*D[PIDX(13, 14)] + F[4][14]*D[PIDX(14, 14)] + F[4][15]*D[PIDX(14, 15)]) + F[4][15]*(F[4][6]*D[PIDX(6, 15)] + F[4][7]*D[PIDX(7, 15)] + F[4][8]*D[PIDX(8, 15)] + F[4][9]*D[PIDX(9, 15)] + F[4][13]*D[PIDX(13, 15)] + F[4][14]*D[PIDX(14, 15)] + F[4][15]*D[PIDX(15, 15)]))*Tsq + (2*F[4][6]*D[PIDX(4, 6)] + 2*F[4][7]*D[PIDX(4, 7)] + 2*F[4][8]*D[PIDX(4, 8)] + 2*F[4][9]*D[PIDX(4, 9)] + 2*F[4][13]*D[PIDX(4, 13)] + 2*F[4][14]*D[PIDX(4, 14)] + 2*F[4][15]*D[PIDX(4, 15)])*T + D[PIDX(4, 4)];
+	P[PIDX(4, 5)] = (F[5][6]*(F[4][6]*D[PIDX(6, 6)] + F[4][7]*D[PIDX(6, 7)] + F[4][8]*D[PIDX(6, 8)] + F[4][9]*D[PIDX(6, 9)] + F[4][13]*D[PIDX(6, 13)] + F[4][14]*D[PIDX(6, 14)] + F[4][15]*D[PIDX(6, 15)]) + F[5][7]*(F[4][6]*D[PIDX(6, 7)] + F[4][7]*D[PIDX(7, 7)] + F[4][8]*D[PIDX(7, 8)] + F[4][9]*D[PIDX(7, 9)] + F[4][13]*D[PIDX(7, 13)] + F[4][14]*D[PIDX(7, 14)] + F[4][15]*D[PIDX(7, 15)]) + F[5][8]*(F[4][6]*D[PIDX(6, 8)] + F[4][7]*D[PIDX(7, 8)] + F[4][8]*D[PIDX(8, 8)] + F[4][9]*D[PIDX(8, 9)] + F[4][13]*D[PIDX(8, 13)] + F[4][14]*D[PIDX(8, 14)] + F[4][15]*D[PIDX(8, 15)]) + F[5][9]*(F[4][6]*D[PIDX(6, 9)] + F[4][7]*D[PIDX(7, 9)] + F[4][8]*D[PIDX(8, 9)] + F[4][9]*D[PIDX(9, 9)] + F[4][13]*D[PIDX(9, 13)] + F[4][14]*D[PIDX(9, 14)] + F[4][15]*D[PIDX(9, 15)]) + F[5][13]*(F[4][6]*D[PIDX(6, 13)] + F[4][7]*D[PIDX(7, 13)] + F[4][8]*D[PIDX(8, 13)] + F[4][9]*D[PIDX(9, 13)] + F[4][13]*D[PIDX(13, 13)] + F[4][14]*D[PIDX(13, 14)] + F[4][15]*D[PIDX(13, 15)]) + F[5][14]*(F[4][6]*D[PIDX(6, 14)] + F[4][7]*D[PIDX(7, 14)] + F[4][8]*D[PIDX(8, 14)] + F[4][9]*D[PIDX(9, 14)] + F[4][13]*D[PIDX(13, 14)] + F[4][14]*D[PIDX(14, 14)] + F[4][15]*D[PIDX(14, 15)]) + F[5][15]*(F[4][6]*D[PIDX(6, 15)] + F[4][7]*D[PIDX(7, 15)] + F[4][8]*D[PIDX(8, 15)] + F[4][9]*D[PIDX(9, 15)] + F[4][13]*D[PIDX(13, 15)] + F[4][14]*D[PIDX(14, 15)] + F[4][15]*D[PIDX(15, 15)]) + G[4][3]*G[5][3]*Q[3] + G[4][4]*G[5][4]*Q[4] + G[4][5]*G[5][5]*Q[5])*Tsq + (F[4][6]*D[PIDX(5, 6)] + F[5][6]*D[PIDX(4, 6)] + F[4][7]*D[PIDX(5, 7)] + F[5][7]*D[PIDX(4, 7)] + F[4][8]*D[PIDX(5, 8)] + F[5][8]*D[PIDX(4, 8)] + F[4][9]*D[PIDX(5, 9)] + F[5][9]*D[PIDX(4, 9)] + F[4][13]*D[PIDX(5, 13)] + F[5][13]*D[PIDX(4, 13)] + F[4][14]*D[PIDX(5, 14)] + F[5][14]*D[PIDX(4, 14)] + F[4][15]*D[PIDX(5, 15)] + F[5][15]*D[PIDX(4, 15)])*T + D[PIDX(4, 5)];
+	P[PIDX(4, 6)] = (F[6][7]*(F[4][6]*D[PIDX(6, 7)] + F[4][7]*D[PIDX(7, 7)] + F[4][8]*D[PIDX(7, 8)] + F[4][9]*D[PIDX(7, 9)] + F[4][13]*D[PIDX(7, 13)] + F[4][14]*D[PIDX(7, 14)] + F[4][15]*D[PIDX(7, 15)]) + F[6][8]*(F[4][6]*D[PIDX(6, 8)] + F[4][7]*D[PIDX(7, 8)] + F[4][8]*D[PIDX(8, 8)] + F[4][9]*D[PIDX(8, 9)] + F[4][13]*D[PIDX(8, 13)] + F[4][14]*D[PIDX(8, 14)] + F[4][15]*D[PIDX(8, 15)]) + F[6][9]*(F[4][6]*D[PIDX(6, 9)] + F[4][7]*D[PIDX(7, 9)] + F[4][8]*D[PIDX(8, 9)] + F[4][9]*D[PIDX(9, 9)] + F[4][13]*D[PIDX(9, 13)] + F[4][14]*D[PIDX(9, 14)] + F[4][15]*D[PIDX(9, 15)]) + F[6][10]*(F[4][6]*D[PIDX(6, 10)] + F[4][7]*D[PIDX(7, 10)] + F[4][8]*D[PIDX(8, 10)] + F[4][9]*D[PIDX(9, 10)] + F[4][13]*D[PIDX(10, 13)] + F[4][14]*D[PIDX(10, 14)] + F[4][15]*D[PIDX(10, 15)]) + F[6][11]*(F[4][6]*D[PIDX(6, 11)] + F[4][7]*D[PIDX(7, 11)] + F[4][8]*D[PIDX(8, 11)] + F[4][9]*D[PIDX(9, 11)] + F[4][13]*D[PIDX(11, 13)] + F[4][14]*D[PIDX(11, 14)] + F[4][15]*D[PIDX(11, 15)]) + F[6][12]*(F[4][6]*D[PIDX(6, 12)] + F[4][7]*D[PIDX(7, 12)] + F[4][8]*D[PIDX(8, 12)] + F[4][9]*D[PIDX(9, 12)] + F[4][13]*D[PIDX(12, 13)] + F[4][14]*D[PIDX(12, 14)] + F[4][15]*D[PIDX(12, 15)]))*Tsq + (F[4][6]*D[PIDX(6, 6)] + F[4][7]*D[PIDX(6, 7)] + F[6][7]*D[PIDX(4, 7)] + F[4][8]*D[PIDX(6, 8)] + F[6][8]*D[PIDX(4, 8)] + F[4][9]*D[PIDX(6, 9)] + F[6][9]*D[PIDX(4, 9)] + F[6][10]*D[PIDX(4, 10)] + F[6][11]*D[PIDX(4, 11)] + F[6][12]*D[PIDX(4, 12)] + F[4][13]*D[PIDX(6, 13)] + F[4][14]*D[PIDX(6, 14)] + F[4][15]*D[PIDX(6, 15)])*T + D[PIDX(4, 6)];
+	P[PIDX(4, 7)] = (F[7][6]*(F[4][6]*D[PIDX(6, 6)] + F[4][7]*D[PIDX(6, 7)] + F[4][8]*D[PIDX(6, 8)] + F[4][9]*D[PIDX(6, 9)] + F[4][13]*D[PIDX(6, 13)] + F[4][14]*D[PIDX(6, 14)] + F[4][15]*D[PIDX(6, 15)]) + F[7][8]*(F[4][6]*D[PIDX(6, 8)] + F[4][7]*D[PIDX(7, 8)] + F[4][8]*D[PIDX(8, 8)] + F[4][9]*D[PIDX(8, 9)] + F[4][13]*D[PIDX(8, 13)] + F[4][14]*D[PIDX(8, 14)] + F[4][15]*D[PIDX(8, 15)]) + F[7][9]*(F[4][6]*D[PIDX(6, 9)] + F[4][7]*D[PIDX(7, 9)] + F[4][8]*D[PIDX(8, 9)] + F[4][9]*D[PIDX(9, 9)] + F[4][13]*D[PIDX(9, 13)] + F[4][14]*D[PIDX(9, 14)] + F[4][15]*D[PIDX(9, 15)]) + F[7][10]*(F[4][6]*D[PIDX(6, 10)] + F[4][7]*D[PIDX(7, 10)] + F[4][8]*D[PIDX(8, 10)] + F[4][9]*D[PIDX(9, 10)] + F[4][13]*D[PIDX(10, 13)] + F[4][14]*D[PIDX(10, 14)] + F[4][15]*D[PIDX(10, 15)]) + F[7][11]*(F[4][6]*D[PIDX(6, 11)] + F[4][7]*D[PIDX(7, 11)] + F[4][8]*D[PIDX(8, 11)] + F[4][9]*D[PIDX(9, 11)] + F[4][13]*D[PIDX(11, 13)] + F[4][14]*D[PIDX(11, 14)] + F[4][15]*D[PIDX(11, 15)]) + F[7][12]*(F[4][6]*D[PIDX(6, 12)] + F[4][7]*D[PIDX(7, 12)] + F[4][8]*D[PIDX(8, 12)] + F[4][9]*D[PIDX(9, 12)] + F[4][13]*D[PIDX(12, 13)] + F[4][14]*D[PIDX(12, 14)] + F[4][15]*D[PIDX(12, 15)]))*Tsq + (F[4][6]*D[PIDX(6, 7)] + F[7][6]*D[PIDX(4, 6)] + F[4][7]*D[PIDX(7, 7)] + F[4][8]*D[PIDX(7, 8)] + F[7][8]*D[PIDX(4, 8)] + F[4][9]*D[PIDX(7, 9)] + F[7][9]*D[PIDX(4, 9)] + F[7][10]*D[PIDX(4, 10)] + F[7][11]*D[PIDX(4, 11)] + F[7][12]*D[PIDX(4, 12)] + F[4][13]*D[PIDX(7, 13)] + F[4][14]*D[PIDX(7, 14)] + F[4][15]*D[PIDX(7, 15)])*T + D[PIDX(4, 7)];
+	P[PIDX(4, 8)] = (F[8][6]*(F[4][6]*D[PIDX(6, 6)] + F[4][7]*D[PIDX(6, 7)] + F[4][8]*D[PIDX(6, 8)] + F[4][9]*D[PIDX(6, 9)] + F[4][13]*D[PIDX(6, 13)] + F[4][14]*D[PIDX(6, 14)] + F[4][15]*D[PIDX(6, 15)]) + F[8][7]*(F[4][6]*D[PIDX(6, 7)] + F[4][7]*D[PIDX(7, 7)] + F[4][8]*D[PIDX(7, 8)] + F[4][9]*D[PIDX(7, 9)] + F[4][13]*D[PIDX(7, 13)] + F[4][14]*D[PIDX(7, 14)] + F[4][15]*D[PIDX(7, 15)]) + F[8][9]*(F[4][6]*D[PIDX(6, 9)] + F[4][7]*D[PIDX(7, 9)] + F[4][8]*D[PIDX(8, 9)] + F[4][9]*D[PIDX(9, 9)] + F[4][13]*D[PIDX(9, 13)] + F[4][14]*D[PIDX(9, 14)] + F[4][15]*D[PIDX(9, 15)]) + F[8][10]*(F[4][6]*D[PIDX(6, 10)] + F[4][7]*D[PIDX(7, 10)] + F[4][8]*D[PIDX(8, 10)] + F[4][9]*D[PIDX(9, 10)] + F[4][13]*D[PIDX(10, 13)] + F[4][14]*D[PIDX(10, 14)] + F[4][15]*D[PIDX(10, 15)]) + F[8][11]*(F[4][6]*D[PIDX(6, 11)] + F[4][7]*D[PIDX(7, 11)] + F[4][8]*D[PIDX(8, 11)] + F[4][9]*D[PIDX(9, 11)] + F[4][13]*D[PIDX(11, 13)] + F[4][14]*D[PIDX(11, 14)] + F[4][15]*D[PIDX(11, 15)]) + F[8][12]*(F[4][6]*D[PIDX(6, 12)] + F[4][7]*D[PIDX(7, 12)] + F[4][8]*D[PIDX(8, 12)] + F[4][9]*D[PIDX(9, 12)] + F[4][13]*D[PIDX(12, 13)] + F[4][14]*D[PIDX(12, 14)] + F[4][15]*D[PIDX(12, 15)]))*Tsq + (F[4][6]*D[PIDX(6, 8)] + F[4][7]*D[PIDX(7, 8)] + F[8][6]*D[PIDX(4, 6)] + F[8][7]*D[PIDX(4, 7)] + F[4][8]*D[PIDX(8, 8)] + F[4][9]*D[PIDX(8, 9)] + F[8][9]*D[PIDX(4, 9)] + F[8][10]*D[PIDX(4, 10)] + F[8][11]*D[PIDX(4, 11)] + F[8][12]*D[PIDX(4, 12)] + F[4][13]*D[PIDX(8, 13)] + F[4][14]*D[PIDX(8, 14)] + F[4][15]*D[PIDX(8, 15)])*T + D[PIDX(4, 8)];
+	P[PIDX(4, 9)] = (F[9][6]*(F[4][6]*D[PIDX(6, 6)] + F[4][7]*D[PIDX(6, 7)] + F[4][8]*D[PIDX(6, 8)] + F[4][9]*D[PIDX(6, 9)] + F[4][13]*D[PIDX(6, 13)] + F[4][14]*D[PIDX(6, 14)] + F[4][15]*D[PIDX(6, 15)]) + F[9][7]*(F[4][6]*D[PIDX(6, 7)] + F[4][7]*D[PIDX(7, 7)] + F[4][8]*D[PIDX(7, 8)] + F[4][9]*D[PIDX(7, 9)] + F[4][13]*D[PIDX(7, 13)] + F[4][14]*D[PIDX(7, 14)] + F[4][15]*D[PIDX(7, 15)]) + F[9][8]*(F[4][6]*D[PIDX(6, 8)] + F[4][7]*D[PIDX(7, 8)] + F[4][8]*D[PIDX(8, 8)] + F[4][9]*D[PIDX(8, 9)] + F[4][13]*D[PIDX(8, 13)] + F[4][14]*D[PIDX(8, 14)] + F[4][15]*D[PIDX(8, 15)]) + F[9][10]*(F[4][6]*D[PIDX(6, 10)] + F[4][7]*D[PIDX(7, 10)] + F[4][8]*D[PIDX(8, 10)] + F[4][9]*D[PIDX(9, 10)] + F[4][13]*D[PIDX(10, 13)] + F[4][14]*D[PIDX(10, 14)] + F[4][15]*D[PIDX(10, 15)]) + F[9][11]*(F[4][6]*D[PIDX(6, 11)] + F[4][7]*D[PIDX(7, 11)] + F[4][8]*D[PIDX(8, 11)] + F[4][9]*D[PIDX(9, 11)] + F[4][13]*D[PIDX(11, 13)] + F[4][14]*D[PIDX(11, 14)] + F[4][15]*D[PIDX(11, 15)]) + F[9][12]*(F[4][6]*D[PIDX(6, 12)] + F[4][7]*D[PIDX(7, 12)] + F[4][8]*D[PIDX(8, 12)] + F[4][9]*D[PIDX(9, 12)] + F[4][13]*D[PIDX(12, 13)] + F[4][14]*D[PIDX(12, 14)] + F[4][15]*D[PIDX(12, 15)]))*Tsq + (F[9][6]*D[PIDX(4, 6)] + F[9][7]*D[PIDX(4, 7)] + F[9][8]*D[PIDX(4, 8)] + F[4][6]*D[PIDX(6, 9)] + F[4][7]*D[PIDX(7, 9)] + F[4][8]*D[PIDX(8, 9)] + F[4][9]*D[PIDX(9, 9)] + F[9][10]*D[PIDX(4, 10)] + F[9][11]*D[PIDX(4, 11)] + F[9][12]*D[PIDX(4, 12)] + F[4][13]*D[PIDX(9, 13)] + F[4][14]*D[PIDX(9, 14)] + F[4][15]*D[PIDX(9, 15)])*T + D[PIDX(4, 9)];
+	P[PIDX(4, 10)] = (F[4][6]*D[PIDX(6, 10)] + F[4][7]*D[PIDX(7, 10)] + F[4][8]*D[PIDX(8, 10)] + F[4][9]*D[PIDX(9, 10)] + F[4][13]*D[PIDX(10, 13)] + F[4][14]*D[PIDX(10, 14)] + F[4][15]*D[PIDX(10, 15)])*T + D[PIDX(4, 10)];
+	P[PIDX(4, 11)] = (F[4][6]*D[PIDX(6, 11)] + F[4][7]*D[PIDX(7, 11)] + F[4][8]*D[PIDX(8, 11)] + F[4][9]*D[PIDX(9, 11)] + F[4][13]*D[PIDX(11, 13)] + F[4][14]*D[PIDX(11, 14)] + F[4][15]*D[PIDX(11, 15)])*T + D[PIDX(4, 11)];
+	P[PIDX(4, 12)] = (F[4][6]*D[PIDX(6, 12)] + F[4][7]*D[PIDX(7, 12)] + F[4][8]*D[PIDX(8, 12)] + F[4][9]*D[PIDX(9, 12)] + F[4][13]*D[PIDX(12, 13)] + F[4][14]*D[PIDX(12, 14)] + F[4][15]*D[PIDX(12, 15)])*T + D[PIDX(4, 12)];
+	P[PIDX(4, 13)] = (F[4][6]*D[PIDX(6, 13)] + F[4][7]*D[PIDX(7, 13)] + F[4][8]*D[PIDX(8, 13)] + F[4][9]*D[PIDX(9, 13)] + F[4][13]*D[PIDX(13, 13)] + F[4][14]*D[PIDX(13, 14)] + F[4][15]*D[PIDX(13, 15)])*T + D[PIDX(4, 13)];
+	P[PIDX(4, 14)] = (F[4][6]*D[PIDX(6, 14)] + F[4][7]*D[PIDX(7, 14)] + F[4][8]*D[PIDX(8, 14)] + F[4][9]*D[PIDX(9, 14)] + F[4][13]*D[PIDX(13, 14)] + F[4][14]*D[PIDX(14, 14)] + F[4][15]*D[PIDX(14, 15)])*T + D[PIDX(4, 14)];
+	P[PIDX(4, 15)] = (F[4][6]*D[PIDX(6, 15)] + F[4][7]*D[PIDX(7, 15)] + F[4][8]*D[PIDX(8, 15)] + F[4][9]*D[PIDX(9, 15)] + F[4][13]*D[PIDX(13, 15)] + F[4][14]*D[PIDX(14, 15)] + F[4][15]*D[PIDX(15, 15)])*T + D[PIDX(4, 15)];
+	P[PIDX(5, 5)] = (Q[3]*G[5][3]*G[5][3] + Q[4]*G[5][4]*G[5][4] + Q[5]*G[5][5]*G[5][5] + F[5][6]*(F[5][6]*D[PIDX(6, 6)] + F[5][7]*D[PIDX(6, 7)] + F[5][8]*D[PIDX(6, 8)] + F[5][9]*D[PIDX(6, 9)] + F[5][13]*D[PIDX(6, 13)] + F[5][14]*D[PIDX(6, 14)] + F[5][15]*D[PIDX(6, 15)]) + F[5][7]*(F[5][6]*D[PIDX(6, 7)] + F[5][7]*D[PIDX(7, 7)] + F[5][8]*D[PIDX(7, 8)] + F[5][9]*D[PIDX(7, 9)] + F[5][13]*D[PIDX(7, 13)] + F[5][14]*D[PIDX(7, 14)] + F[5][15]*D[PIDX(7, 15)]) + F[5][8]*(F[5][6]*D[PIDX(6, 8)] + F[5][7]*D[PIDX(7, 8)] + F[5][8]*D[PIDX(8, 8)] + F[5][9]*D[PIDX(8, 9)] + F[5][13]*D[PIDX(8, 13)] + F[5][14]*D[PIDX(8, 14)] + F[5][15]*D[PIDX(8, 15)]) + F[5][9]*(F[5][6]*D[PIDX(6, 9)] + F[5][7]*D[PIDX(7, 9)] + F[5][8]*D[PIDX(8, 9)] + F[5][9]*D[PIDX(9, 9)] + F[5][13]*D[PIDX(9, 13)] + F[5][14]*D[PIDX(9, 14)] + F[5][15]*D[PIDX(9, 15)]) + F[5][13]*(F[5][6]*D[PIDX(6, 13)] + F[5][7]*D[PIDX(7, 13)] + F[5][8]*D[PIDX(8, 13)] + F[5][9]*D[PIDX(9, 13)] + F[5][13]*D[PIDX(13, 13)] + F[5][14]*D[PIDX(13, 14)] + F[5][15]*D[PIDX(13, 15)]) + F[5][14]*(F[5][6]*D[PIDX(6, 14)] + F[5][7]*D[PIDX(7, 14)] + F[5][8]*D[PIDX(8, 14)] + F[5][9]*D[PIDX(9, 14)] + F[5][13]*D[PIDX(13, 14)] + F[5][14]*D[PIDX(14, 14)] + F[5][15]*D[PIDX(14, 15)]) + F[5][15]*(F[5][6]*D[PIDX(6, 15)] + F[5][7]*D[PIDX(7, 15)] + F[5][8]*D[PIDX(8, 15)] + F[5][9]*D[PIDX(9, 15)] + F[5][13]*D[PIDX(13, 15)] + F[5][14]*D[PIDX(14, 15)] + F[5][15]*D[PIDX(15, 15)]))*Tsq + (2*F[5][6]*D[PIDX(5, 6)] + 2*F[5][7]*D[PIDX(5, 7)] + 2*F[5][8]*D[PIDX(5, 8)] + 2*F[5][9]*D[PIDX(5, 9)] + 2*F[5][13]*D[PIDX(5, 13)] + 2*F[5][14]*D[PIDX(5, 14)] + 2*F[5][15]*D[PIDX(5, 15)])*T + D[PIDX(5, 5)];
+	P[PIDX(5, 6)] = (F[6][7]*(F[5][6]*D[PIDX(6, 7)] + F[5][7]*D[PIDX(7, 7)] + F[5][8]*D[PIDX(7, 8)] + F[5][9]*D[PIDX(7, 9)] + F[5][13]*D[PIDX(7, 13)] + F[5][14]*D[PIDX(7, 14)] + F[5][15]*D[PIDX(7, 15)]) + F[6][8]*(F[5][6]*D[PIDX(6, 8)] + F[5][7]*D[PIDX(7, 8)] + F[5][8]*D[PIDX(8, 8)] + F[5][9]*D[PIDX(8, 9)] + F[5][13]*D[PIDX(8, 13)] + F[5][14]*D[PIDX(8, 14)] + F[5][15]*D[PIDX(8, 15)]) + F[6][9]*(F[5][6]*D[PIDX(6, 9)] + F[5][7]*D[PIDX(7, 9)] + F[5][8]*D[PIDX(8, 9)] + F[5][9]*D[PIDX(9, 9)] + F[5][13]*D[PIDX(9, 13)] + F[5][14]*D[PIDX(9, 14)] + F[5][15]*D[PIDX(9, 15)]) + F[6][10]*(F[5][6]*D[PIDX(6, 10)] + F[5][7]*D[PIDX(7, 10)] + F[5][8]*D[PIDX(8, 10)] + F[5][9]*D[PIDX(9, 10)] + F[5][13]*D[PIDX(10, 13)] + F[5][14]*D[PIDX(10, 14)] + F[5][15]*D[PIDX(10, 15)]) + F[6][11]*(F[5][6]*D[PIDX(6, 11)] + F[5][7]*D[PIDX(7, 11)] + F[5][8]*D[PIDX(8, 11)] + F[5][9]*D[PIDX(9, 11)] + F[5][13]*D[PIDX(11, 13)] + F[5][14]*D[PIDX(11, 14)] + F[5][15]*D[PIDX(11, 15)]) + F[6][12]*(F[5][6]*D[PIDX(6, 12)] + F[5][7]*D[PIDX(7, 12)] + F[5][8]*D[PIDX(8, 12)] + F[5][9]*D[PIDX(9, 12)] + F[5][13]*D[PIDX(12, 13)] + F[5][14]*D[PIDX(12, 14)] + F[5][15]*D[PIDX(12, 15)]))*Tsq + (F[5][6]*D[PIDX(6, 6)] + F[5][7]*D[PIDX(6, 7)] + F[6][7]*D[PIDX(5, 7)] + F[5][8]*D[PIDX(6, 8)] + F[6][8]*D[PIDX(5, 8)] + F[5][9]*D[PIDX(6, 9)] + F[6][9]*D[PIDX(5, 9)] + F[6][10]*D[PIDX(5, 10)] + F[6][11]*D[PIDX(5, 11)] + F[6][12]*D[PIDX(5, 12)] + F[5][13]*D[PIDX(6, 13)] + F[5][14]*D[PIDX(6, 14)] + F[5][15]*D[PIDX(6, 15)])*T + D[PIDX(5, 6)];
+	P[PIDX(5, 7)] = (F[7][6]*(F[5][6]*D[PIDX(6, 6)] + F[5][7]*D[PIDX(6, 7)] + F[5][8]*D[PIDX(6, 8)] + F[5][9]*D[PIDX(6, 9)] + F[5][13]*D[PIDX(6, 13)] + F[5][14]*D[PIDX(6, 14)] + F[5][15]*D[PIDX(6, 15)]) + F[7][8]*(F[5][6]*D[PIDX(6, 8)] + F[5][7]*D[PIDX(7, 8)] + F[5][8]*D[PIDX(8, 8)] + F[5][9]*D[PIDX(8, 9)] + F[5][13]*D[PIDX(8, 13)] + F[5][14]*D[PIDX(8, 14)] + F[5][15]*D[PIDX(8, 15)]) + F[7][9]*(F[5][6]*D[PIDX(6, 9)] + F[5][7]*D[PIDX(7, 9)] + F[5][8]*D[PIDX(8, 9)] + F[5][9]*D[PIDX(9, 9)] + F[5][13]*D[PIDX(9, 13)] + F[5][14]*D[PIDX(9, 14)] + F[5][15]*D[PIDX(9, 15)]) + F[7][10]*(F[5][6]*D[PIDX(6, 10)] + F[5][7]*D[PIDX(7, 10)] + F[5][8]*D[PIDX(8, 10)] + F[5][9]*D[PIDX(9, 10)] + F[5][13]*D[PIDX(10, 13)] + F[5][14]*D[PIDX(10, 14)] + F[5][15]*D[PIDX(10, 15)]) + F[7][11]*(F[5][6]*D[PIDX(6, 11)] + F[5][7]*D[PIDX(7, 11)] + F[5][8]*D[PIDX(8, 11)] + F[5][9]*D[PIDX(9, 11)] + F[5][13]*D[PIDX(11, 13)] + F[5][14]*D[PIDX(11, 14)] + F[5][15]*D[PIDX(11, 15)]) + F[7][12]*(F[5][6]*D[PIDX(6, 12)] + F[5][7]*D[PIDX(7, 12)] + F[5][8]*D[PIDX(8, 12)] + F[5][9]*D[PIDX(9, 12)] + F[5][13]*D[PIDX(12, 13)] + F[5][14]*D[PIDX(12, 14)] + F[5][15]*D[PIDX(12, 15)]))*Tsq + (F[5][6]*D[PIDX(6, 7)] + F[7][6]*D[PIDX(5, 6)] + F[5][7]*D[PIDX(7, 7)] + F[5][8]*D[PIDX(7, 8)] + F[7][8]*D[PIDX(5, 8)] + F[5][9]*D[PIDX(7, 9)] + F[7][9]*D[PIDX(5, 9)] + F[7][10]*D[PIDX(5, 10)] + F[7][11]*D[PIDX(5, 11)] + F[7][12]*D[PIDX(5, 12)] + F[5][13]*D[PIDX(7, 13)] + F[5][14]*D[PIDX(7, 14)] + F[5][15]*D[PIDX(7, 15)])*T + D[PIDX(5, 7)];
+	P[PIDX(5, 8)] = (F[8][6]*(F[5][6]*D[PIDX(6, 6)] + F[5][7]*D[PIDX(6, 7)] + F[5][8]*D[PIDX(6, 8)] + F[5][9]*D[PIDX(6, 9)] + F[5][13]*D[PIDX(6, 13)] + F[5][14]*D[PIDX(6, 14)] + F[5][15]*D[PIDX(6, 15)]) + F[8][7]*(F[5][6]*D[PIDX(6, 7)] + F[5][7]*D[PIDX(7, 7)] + F[5][8]*D[PIDX(7, 8)] + F[5][9]*D[PIDX(7, 9)] + F[5][13]*D[PIDX(7, 13)] + F[5][14]*D[PIDX(7, 14)] + F[5][15]*D[PIDX(7, 15)]) + F[8][9]*(F[5][6]*D[PIDX(6, 9)] + F[5][7]*D[PIDX(7, 9)] + F[5][8]*D[PIDX(8, 9)] + F[5][9]*D[PIDX(9, 9)] + F[5][13]*D[PIDX(9, 13)] + F[5][14]*D[PIDX(9, 14)] + F[5][15]*D[PIDX(9, 15)]) + F[8][10]*(F[5][6]*D[PIDX(6, 10)] + F[5][7]*D[PIDX(7, 10)] + F[5][8]*D[PIDX(8, 10)] + F[5][9]*D[PIDX(9, 10)] + F[5][13]*D[PIDX(10, 13)] + F[5][14]*D[PIDX(10, 14)] + F[5][15]*D[PIDX(10, 15)]) + F[8][11]*(F[5][6]*D[PIDX(6, 11)] + F[5][7]*D[PIDX(7, 11)] + F[5][8]*D[PIDX(8, 11)] + F[5][9]*D[PIDX(9, 11)] + F[5][13]*D[PIDX(11, 13)] + F[5][14]*D[PIDX(11, 14)] + F[5][15]*D[PIDX(11, 15)]) + F[8][12]*(F[5][6]*D[PIDX(6, 12)] + F[5][7]*D[PIDX(7, 12)] + F[5][8]*D[PIDX(8, 12)] + F[5][9]*D[PIDX(9, 12)] + F[5][13]*D[PIDX(12, 13)] + F[5][14]*D[PIDX(12, 14)] + F[5][15]*D[PIDX(12, 15)]))*Tsq + (F[5][6]*D[PIDX(6, 8)] + F[5][7]*D[PIDX(7, 8)] + F[8][6]*D[PIDX(5, 6)] + F[8][7]*D[PIDX(5, 7)] + F[5][8]*D[PIDX(8, 8)] + F[5][9]*D[PIDX(8, 9)] + F[8][9]*D[PIDX(5, 9)] + F[8][10]*D[PIDX(5, 10)] + F[8][11]*D[PIDX(5, 11)] + F[8][12]*D[PIDX(5, 12)] + F[5][13]*D[PIDX(8, 13)] + F[5][14]*D[PIDX(8, 14)] + F[5][15]*D[PIDX(8, 15)])*T + D[PIDX(5, 8)];
+	P[PIDX(5, 9)] = (F[9][6]*(F[5][6]*D[PIDX(6, 6)] + F[5][7]*D[PIDX(6, 7)] + F[5][8]*D[PIDX(6, 8)] + F[5][9]*D[PIDX(6, 9)] + F[5][13]*D[PIDX(6, 13)] + F[5][14]*D[PIDX(6, 14)] + F[5][15]*D[PIDX(6, 15)]) + F[9][7]*(F[5][6]*D[PIDX(6, 7)] + F[5][7]*D[PIDX(7, 7)] + F[5][8]*D[PIDX(7, 8)] + F[5][9]*D[PIDX(7, 9)] + F[5][13]*D[PIDX(7, 13)] + F[5][14]*D[PIDX(7, 14)] + F[5][15]*D[PIDX(7, 15)]) + F[9][8]*(F[5][6]*D[PIDX(6, 8)] + F[5][7]*D[PIDX(7, 8)] + F[5][8]*D[PIDX(8, 8)] + F[5][9]*D[PIDX(8, 9)] + F[5][13]*D[PIDX(8, 13)] + F[5][14]*D[PIDX(8, 14)] + F[5][15]*D[PIDX(8, 15)]) + F[9][10]*(F[5][6]*D[PIDX(6, 10)] + F[5][7]*D[PIDX(7, 10)] + F[5][8]*D[PIDX(8, 10)] + F[5][9]*D[PIDX(9, 10)] + F[5][13]*D[PIDX(10, 13)] + F[5][14]*D[PIDX(10, 14)] + F[5][15]*D[PIDX(10, 15)]) + F[9][11]*(F[5][6]*D[PIDX(6, 11)] + F[5][7]*D[PIDX(7, 11)] + F[5][8]*D[PIDX(8, 11)] + F[5][9]*D[PIDX(9, 11)] + F[5][13]*D[PIDX(11, 13)] + F[5][14]*D[PIDX(11, 14)] + F[5][15]*D[PIDX(11, 15)]) + F[9][12]*(F[5][6]*D[PIDX(6, 12)] + F[5][7]*D[PIDX(7, 12)] + F[5][8]*D[PIDX(8, 12)] + F[5][9]*D[PIDX(9, 12)] + F[5][13]*D[PIDX(12, 13)] + F[5][14]*D[PIDX(12, 14)] + F[5][15]*D[PIDX(12, 15)]))*Tsq + (F[9][6]*D[PIDX(5, 6)] + F[9][7]*D[PIDX(5, 7)] + F[9][8]*D[PIDX(5, 8)] + F[5][6]*D[PIDX(6, 9)] + F[5][7]*D[PIDX(7, 9)] + F[5][8]*D[PIDX(8, 9)] + F[5][9]*D[PIDX(9, 9)] + F[9][10]*D[PIDX(5, 10)] + F[9][11]*D[PIDX(5, 11)] + F[9][12]*D[PIDX(5, 12)] + F[5][13]*D[PIDX(9, 13)] + F[5][14]*D[PIDX(9, 14)] + F[5][15]*D[PIDX(9, 15)])*T + D[PIDX(5, 9)];
+	P[PIDX(5, 10)] = (F[5][6]*D[PIDX(6, 10)] + F[5][7]*D[PIDX(7, 10)] + F[5][8]*D[PIDX(8, 10)] + F[5][9]*D[PIDX(9, 10)] + F[5][13]*D[PIDX(10, 13)] + F[5][14]*D[PIDX(10, 14)] + F[5][15]*D[PIDX(10, 15)])*T + D[PIDX(5, 10)];
+	P[PIDX(5, 11)] = (F[5][6]*D[PIDX(6, 11)] + F[5][7]*D[PIDX(7, 11)] + F[5][8]*D[PIDX(8, 11)] + F[5][9]*D[PIDX(9, 11)] + F[5][13]*D[PIDX(11, 13)] + F[5][14]*D[PIDX(11, 14)] + F[5][15]*D[PIDX(11, 15)])*T + D[PIDX(5, 11)];
+	P[PIDX(5, 12)] = (F[5][6]*D[PIDX(6, 12)] + F[5][7]*D[PIDX(7, 12)] + F[5][8]*D[PIDX(8, 12)] + F[5][9]*D[PIDX(9, 12)] + F[5][13]*D[PIDX(12, 13)] + F[5][14]*D[PIDX(12, 14)] + F[5][15]*D[PIDX(12, 15)])*T + D[PIDX(5, 12)];
+	P[PIDX(5, 13)] = (F[5][6]*D[PIDX(6, 13)] + F[5][7]*D[PIDX(7, 13)] + F[5][8]*D[PIDX(8, 13)] + F[5][9]*D[PIDX(9, 13)] + F[5][13]*D[PIDX(13, 13)] + F[5][14]*D[PIDX(13, 14)] + F[5][15]*D[PIDX(13, 15)])*T + D[PIDX(5, 13)];
+	P[PIDX(5, 14)] = (F[5][6]*D[PIDX(6, 14)] + F[5][7]*D[PIDX(7, 14)] + F[5][8]*D[PIDX(8, 14)] + F[5][9]*D[PIDX(9, 14)] + F[5][13]*D[PIDX(13, 14)] + F[5][14]*D[PIDX(14, 14)] + F[5][15]*D[PIDX(14, 15)])*T + D[PIDX(5, 14)];
+	P[PIDX(5, 15)] = (F[5][6]*D[PIDX(6, 15)] + F[5][7]*D[PIDX(7, 15)] + F[5][8]*D[PIDX(8, 15)] + F[5][9]*D[PIDX(9, 15)] + F[5][13]*D[PIDX(13, 15)] + F[5][14]*D[PIDX(14, 15)] + F[5][15]*D[PIDX(15, 15)])*T + D[PIDX(5, 15)];
+	P[PIDX(6, 6)] = (Q[0]*G[6][0]*G[6][0] + Q[1]*G[6][1]*G[6][1] + Q[2]*G[6][2]*G[6][2] + F[6][7]*(F[6][7]*D[PIDX(7, 7)] + F[6][8]*D[PIDX(7, 8)] + F[6][9]*D[PIDX(7, 9)] + F[6][10]*D[PIDX(7, 10)] + F[6][11]*D[PIDX(7, 11)] + F[6][12]*D[PIDX(7, 12)]) + F[6][8]*(F[6][7]*D[PIDX(7, 8)] + F[6][8]*D[PIDX(8, 8)] + F[6][9]*D[PIDX(8, 9)] + F[6][10]*D[PIDX(8, 10)] + F[6][11]*D[PIDX(8, 11)] + F[6][12]*D[PIDX(8, 12)]) + F[6][9]*(F[6][7]*D[PIDX(7, 9)] + F[6][8]*D[PIDX(8, 9)] + F[6][9]*D[PIDX(9, 9)] + F[6][10]*D[PIDX(9, 10)] + F[6][11]*D[PIDX(9, 11)] + F[6][12]*D[PIDX(9, 12)]) + F[6][10]*(F[6][7]*D[PIDX(7, 10)] + F[6][8]*D[PIDX(8, 10)] + F[6][9]*D[PIDX(9, 10)] + F[6][10]*D[PIDX(10, 10)] + F[6][11]*D[PIDX(10, 11)] + F[6][12]*D[PIDX(10, 12)]) + F[6][11]*(F[6][7]*D[PIDX(7, 11)] + F[6][8]*D[PIDX(8, 11)] + F[6][9]*D[PIDX(9, 11)] + F[6][10]*D[PIDX(10, 11)] + F[6][11]*D[PIDX(11, 11)] + F[6][12]*D[PIDX(11, 12)]) + F[6][12]*(F[6][7]*D[PIDX(7, 12)] + F[6][8]*D[PIDX(8, 12)] + F[6][9]*D[PIDX(9, 12)] + F[6][10]*D[PIDX(10, 12)] + F[6][11]*D[PIDX(11, 12)] + F[6][12]*D[PIDX(12, 12)]))*Tsq + (2*F[6][7]*D[PIDX(6, 7)] + 2*F[6][8]*D[PIDX(6, 8)] + 2*F[6][9]*D[PIDX(6, 9)] + 2*F[6][10]*D[PIDX(6, 10)] + 2*F[6][11]*D[PIDX(6, 11)] + 2*F[6][12]*D[PIDX(6, 12)])*T + D[PIDX(6, 6)];
+	P[PIDX(6, 7)] = (F[7][6]*(F[6][7]*D[PIDX(6, 7)] + F[6][8]*D[PIDX(6, 8)] + F[6][9]*D[PIDX(6, 9)] + F[6][10]*D[PIDX(6, 10)] + F[6][11]*D[PIDX(6, 11)] + F[6][12]*D[PIDX(6, 12)]) + F[7][8]*(F[6][7]*D[PIDX(7, 8)] + F[6][8]*D[PIDX(8, 8)] + F[6][9]*D[PIDX(8, 9)] + F[6][10]*D[PIDX(8, 10)] + F[6][11]*D[PIDX(8, 11)] + F[6][12]*D[PIDX(8, 12)]) + F[7][9]*(F[6][7]*D[PIDX(7, 9)] + F[6][8]*D[PIDX(8, 9)] + F[6][9]*D[PIDX(9, 9)] + F[6][10]*D[PIDX(9, 10)] + F[6][11]*D[PIDX(9, 11)] + F[6][12]*D[PIDX(9, 12)]) + F[7][10]*(F[6][7]*D[PIDX(7, 10)] + F[6][8]*D[PIDX(8, 10)] + F[6][9]*D[PIDX(9, 10)] + F[6][10]*D[PIDX(10, 10)] + F[6][11]*D[PIDX(10, 11)] + F[6][12]*D[PIDX(10, 12)]) + F[7][11]*(F[6][7]*D[PIDX(7, 11)] + F[6][8]*D[PIDX(8, 11)] + F[6][9]*D[PIDX(9, 11)] + F[6][10]*D[PIDX(10, 11)] + F[6][11]*D[PIDX(11, 11)] + F[6][12]*D[PIDX(11, 12)]) + F[7][12]*(F[6][7]*D[PIDX(7, 12)] + F[6][8]*D[PIDX(8, 12)] + F[6][9]*D[PIDX(9, 12)] + F[6][10]*D[PIDX(10, 12)] + F[6][11]*D[PIDX(11, 12)] + F[6][12]*D[PIDX(12, 12)]) + G[6][0]*G[7][0]*Q[0] + G[6][1]*G[7][1]*Q[1] + G[6][2]*G[7][2]*Q[2])*Tsq + (F[7][6]*D[PIDX(6, 6)] + F[6][7]*D[PIDX(7, 7)] + F[6][8]*D[PIDX(7, 8)] + F[7][8]*D[PIDX(6, 8)] + F[6][9]*D[PIDX(7, 9)] + F[7][9]*D[PIDX(6, 9)] + F[6][10]*D[PIDX(7, 10)] + F[7][10]*D[PIDX(6, 10)] + F[6][11]*D[PIDX(7, 11)] + F[7][11]*D[PIDX(6, 11)] + F[6][12]*D[PIDX(7, 12)] + F[7][12]*D[PIDX(6, 12)])*T + D[PIDX(6, 7)];
+	P[PIDX(6, 8)] = (F[8][6]*(F[6][7]*D[PIDX(6, 7)] + F[6][8]*D[PIDX(6, 8)] + F[6][9]*D[PIDX(6, 9)] + F[6][10]*D[PIDX(6, 10)] + F[6][11]*D[PIDX(6, 11)] + F[6][12]*D[PIDX(6, 12)]) + F[8][7]*(F[6][7]*D[PIDX(7, 7)] + F[6][8]*D[PIDX(7, 8)] + F[6][9]*D[PIDX(7, 9)] + F[6][10]*D[PIDX(7, 10)] + F[6][11]*D[PIDX(7, 11)] + F[6][12]*D[PIDX(7, 12)]) + F[8][9]*(F[6][7]*D[PIDX(7, 9)] + F[6][8]*D[PIDX(8, 9)] + F[6][9]*D[PIDX(9, 9)] + F[6][10]*D[PIDX(9, 10)] + F[6][11]*D[PIDX(9, 11)] + F[6][12]*D[PIDX(9, 12)]) + F[8][10]*(F[6][7]*D[PIDX(7, 10)] + F[6][8]*D[PIDX(8, 10)] + F[6][9]*D[PIDX(9, 10)] + F[6][10]*D[PIDX(10, 10)] + F[6][11]*D[PIDX(10, 11)] + F[6][12]*D[PIDX(10, 12)]) + F[8][11]*(F[6][7]*D[PIDX(7, 11)] + F[6][8]*D[PIDX(8, 11)] + F[6][9]*D[PIDX(9, 11)] + F[6][10]*D[PIDX(10, 11)] + F[6][11]*D[PIDX(11, 11)] + F[6][12]*D[PIDX(11, 12)]) + F[8][12]*(F[6][7]*D[PIDX(7, 12)] + F[6][8]*D[PIDX(8, 12)] + F[6][9]*D[PIDX(9, 12)] + F[6][10]*D[PIDX(10, 12)] + F[6][11]*D[PIDX(11, 12)] + F[6][12]*D[PIDX(12, 12)]) + G[6][0]*G[8][0]*Q[0] + G[6][1]*G[8][1]*Q[1] + G[6][2]*G[8][2]*Q[2])*Tsq + (F[6][7]*D[PIDX(7, 8)] + F[8][6]*D[PIDX(6, 6)] + F[8][7]*D[PIDX(6, 7)] + F[6][8]*D[PIDX(8, 8)] + F[6][9]*D[PIDX(8, 9)] + F[8][9]*D[PIDX(6, 9)] + F[6][10]*D[PIDX(8, 10)] + F[8][10]*D[PIDX(6, 10)] + F[6][11]*D[PIDX(8, 11)] + F[8][11]*D[PIDX(6, 11)] + F[6][12]*D[PIDX(8, 12)] + F[8][12]*D[PIDX(6, 12)])*T + D[PIDX(6, 8)];
+	P[PIDX(6, 9)] = (F[9][6]*(F[6][7]*D[PIDX(6, 7)] + F[6][8]*D[PIDX(6, 8)] + F[6][9]*D[PIDX(6, 9)] + F[6][10]*D[PIDX(6, 10)] + F[6][11]*D[PIDX(6, 11)] + F[6][12]*D[PIDX(6, 12)]) + F[9][7]*(F[6][7]*D[PIDX(7, 7)] + F[6][8]*D[PIDX(7, 8)] + F[6][9]*D[PIDX(7, 9)] + F[6][10]*D[PIDX(7, 10)] + F[6][11]*D[PIDX(7, 11)] + F[6][12]*D[PIDX(7, 12)]) + F[9][8]*(F[6][7]*D[PIDX(7, 8)] + F[6][8]*D[PIDX(8, 8)] + F[6][9]*D[PIDX(8, 9)] + F[6][10]*D[PIDX(8, 10)] + F[6][11]*D[PIDX(8, 11)] + F[6][12]*D[PIDX(8, 12)]) + F[9][10]*(F[6][7]*D[PIDX(7, 10)] + F[6][8]*D[PIDX(8, 10)] + F[6][9]*D[PIDX(9, 10)] + F[6][10]*D[PIDX(10, 10)] + F[6][11]*D[PIDX(10, 11)] + F[6][12]*D[PIDX(10, 12)]) + F[9][11]*(F[6][7]*D[PIDX(7, 11)] + F[6][8]*D[PIDX(8, 11)] + F[6][9]*D[PIDX(9, 11)] + F[6][10]*D[PIDX(10, 11)] + F[6][11]*D[PIDX(11, 11)] + F[6][12]*D[PIDX(11, 12)]) + F[9][12]*(F[6][7]*D[PIDX(7, 12)] + F[6][8]*D[PIDX(8, 12)] + F[6][9]*D[PIDX(9, 12)] + F[6][10]*D[PIDX(10, 12)] + F[6][11]*D[PIDX(11, 12)] + F[6][12]*D[PIDX(12, 12)]) + G[6][0]*G[9][0]*Q[0] + G[6][1]*G[9][1]*Q[1] + G[6][2]*G[9][2]*Q[2])*Tsq + (F[9][6]*D[PIDX(6, 6)] + F[9][7]*D[PIDX(6, 7)] + F[9][8]*D[PIDX(6, 8)] + F[6][7]*D[PIDX(7, 9)] + F[6][8]*D[PIDX(8, 9)] + F[6][9]*D[PIDX(9, 9)] + F[6][10]*D[PIDX(9, 10)] + F[9][10]*D[PIDX(6, 10)] + F[6][11]*D[PIDX(9, 11)] + F[9][11]*D[PIDX(6, 11)] + F[6][12]*D[PIDX(9, 12)] + F[9][12]*D[PIDX(6, 12)])*T + D[PIDX(6, 9)];
+	P[PIDX(6, 10)] = (F[6][7]*D[PIDX(7, 10)] + F[6][8]*D[PIDX(8, 10)] + F[6][9]*D[PIDX(9, 10)] + F[6][10]*D[PIDX(10, 10)] + F[6][11]*D[PIDX(10, 11)] + F[6][12]*D[PIDX(10, 12)])*T + D[PIDX(6, 10)];
+	P[PIDX(6, 11)] = (F[6][7]*D[PIDX(7, 11)] + F[6][8]*D[PIDX(8, 11)] + F[6][9]*D[PIDX(9, 11)] + F[6][10]*D[PIDX(10, 11)] + F[6][11]*D[PIDX(11, 11)] + F[6][12]*D[PIDX(11, 12)])*T + D[PIDX(6, 11)];
+	P[PIDX(6, 12)] = (F[6][7]*D[PIDX(7, 12)] + F[6][8]*D[PIDX(8, 12)] + F[6][9]*D[PIDX(9, 12)] + F[6][10]*D[PIDX(10, 12)] + F[6][11]*D[PIDX(11, 12)] + F[6][12]*D[PIDX(12, 12)])*T + D[PIDX(6, 12)];
+	P[PIDX(6, 13)] = (F[6][7]*D[PIDX(7, 13)] + F[6][8]*D[PIDX(8, 13)] + F[6][9]*D[PIDX(9, 13)] + F[6][10]*D[PIDX(10, 13)] + F[6][11]*D[PIDX(11, 13)] + F[6][12]*D[PIDX(12, 13)])*T + D[PIDX(6, 13)];
+	P[PIDX(6, 14)] = (F[6][7]*D[PIDX(7, 14)] + F[6][8]*D[PIDX(8, 14)] + F[6][9]*D[PIDX(9, 14)] + F[6][10]*D[PIDX(10, 14)] + F[6][11]*D[PIDX(11, 14)] + F[6][12]*D[PIDX(12, 14)])*T + D[PIDX(6, 14)];
+	P[PIDX(6, 15)] = (F[6][7]*D[PIDX(7, 15)] + F[6][8]*D[PIDX(8, 15)] + F[6][9]*D[PIDX(9, 15)] + F[6][10]*D[PIDX(10, 15)] + F[6][11]*D[PIDX(11, 15)] + F[6][12]*D[PIDX(12, 15)])*T + D[PIDX(6, 15)];
+	P[PIDX(7, 7)] = (Q[0]*G[7][0]*G[7][0] + Q[1]*G[7][1]*G[7][1] + Q[2]*G[7][2]*G[7][2] + F[7][6]*(F[7][6]*D[PIDX(6, 6)] + F[7][8]*D[PIDX(6, 8)] + F[7][9]*D[PIDX(6, 9)] + F[7][10]*D[PIDX(6, 10)] + F[7][11]*D[PIDX(6, 11)] + F[7][12]*D[PIDX(6, 12)]) + F[7][8]*(F[7][6]*D[PIDX(6, 8)] + F[7][8]*D[PIDX(8, 8)] + F[7][9]*D[PIDX(8, 9)] + F[7][10]*D[PIDX(8, 10)] + F[7][11]*D[PIDX(8, 11)] + F[7][12]*D[PIDX(8, 12)]) + F[7][9]*(F[7][6]*D[PIDX(6, 9)] + F[7][8]*D[PIDX(8, 9)] + F[7][9]*D[PIDX(9, 9)] + F[7][10]*D[PIDX(9, 10)] + F[7][11]*D[PIDX(9, 11)] + F[7][12]*D[PIDX(9, 12)]) + F[7][10]*(F[7][6]*D[PIDX(6, 10)] + F[7][8]*D[PIDX(8, 10)] + F[7][9]*D[PIDX(9, 10)] + F[7][10]*D[PIDX(10, 10)] + F[7][11]*D[PIDX(10, 11)] + F[7][12]*D[PIDX(10, 12)]) + F[7][11]*(F[7][6]*D[PIDX(6, 11)] + F[7][8]*D[PIDX(8, 11)] + F[7][9]*D[PIDX(9, 11)] + F[7][10]*D[PIDX(10, 11)] + F[7][11]*D[PIDX(11, 11)] + F[7][12]*D[PIDX(11, 12)]) + F[7][12]*(F[7][6]*D[PIDX(6, 12)] + F[7][8]*D[PIDX(8, 12)] + F[7][9]*D[PIDX(9, 12)] + F[7][10]*D[PIDX(10, 12)] + F[7][11]*D[PIDX(11, 12)] + F[7][12]*D[PIDX(12, 12)]))*Tsq + (2*F[7][6]*D[PIDX(6, 7)] + 2*F[7][8]*D[PIDX(7, 8)] + 2*F[7][9]*D[PIDX(7, 9)] + 2*F[7][10]*D[PIDX(7, 10)] + 2*F[7][11]*D[PIDX(7, 11)] + 2*F[7][12]*D[PIDX(7, 12)])*T + D[PIDX(7, 7)];
+	P[PIDX(7, 8)] = (F[8][6]*(F[7][6]*D[PIDX(6, 6)] + F[7][8]*D[PIDX(6, 8)] + F[7][9]*D[PIDX(6, 9)] + F[7][10]*D[PIDX(6, 10)] + F[7][11]*D[PIDX(6, 11)] + F[7][12]*D[PIDX(6, 12)]) + F[8][7]*(F[7][6]*D[PIDX(6, 7)] + F[7][8]*D[PIDX(7, 8)] + F[7][9]*D[PIDX(7, 9)] + F[7][10]*D[PIDX(7, 10)] + F[7][11]*D[PIDX(7, 11)] + F[7][12]*D[PIDX(7, 12)]) + F[8][9]*(F[7][6]*D[PIDX(6, 9)] + F[7][8]*D[PIDX(8, 9)] + F[7][9]*D[PIDX(9, 9)] + F[7][10]*D[PIDX(9, 10)] + F[7][11]*D[PIDX(9, 11)] + F[7][12]*D[PIDX(9, 12)]) + F[8][10]*(F[7][6]*D[PIDX(6, 10)] + F[7][8]*D[PIDX(8, 10)] + F[7][9]*D[PIDX(9, 10)] + F[7][10]*D[PIDX(10, 10)] + F[7][11]*D[PIDX(10, 11)] + F[7][12]*D[PIDX(10, 12)]) + F[8][11]*(F[7][6]*D[PIDX(6, 11)] + F[7][8]*D[PIDX(8, 11)] + F[7][9]*D[PIDX(9, 11)] + F[7][10]*D[PIDX(10, 11)] + F[7][11]*D[PIDX(11, 11)] + F[7][12]*D[PIDX(11, 12)]) + F[8][12]*(F[7][6]*D[PIDX(6, 12)] + F[7][8]*D[PIDX(8, 12)] + F[7][9]*D[PIDX(9, 12)] + F[7][10]*D[PIDX(10, 12)] + F[7][11]*D[PIDX(11, 12)] + F[7][12]*D[PIDX(12, 12)]) + G[7][0]*G[8][0]*Q[0] + G[7][1]*G[8][1]*Q[1] + G[7][2]*G[8][2]*Q[2])*Tsq + (F[7][6]*D[PIDX(6, 8)] + F[8][6]*D[PIDX(6, 7)] + F[8][7]*D[PIDX(7, 7)] + F[7][8]*D[PIDX(8, 8)] + F[7][9]*D[PIDX(8, 9)] + F[8][9]*D[PIDX(7, 9)] + F[7][10]*D[PIDX(8, 10)] + F[8][10]*D[PIDX(7, 10)] + F[7][11]*D[PIDX(8, 11)] + F[8][11]*D[PIDX(7, 11)] + F[7][12]*D[PIDX(8, 12)] + F[8][12]*D[PIDX(7, 12)])*T + D[PIDX(7, 8)];
+	P[PIDX(7, 9)] = (F[9][6]*(F[7][6]*D[PIDX(6, 6)] + F[7][8]*D[PIDX(6, 8)] + F[7][9]*D[PIDX(6, 9)] + F[7][10]*D[PIDX(6, 10)] + F[7][11]*D[PIDX(6, 11)] + F[7][12]*D[PIDX(6, 12)]) + F[9][7]*(F[7][6]*D[PIDX(6, 7)] + F[7][8]*D[PIDX(7, 8)] + F[7][9]*D[PIDX(7, 9)] + F[7][10]*D[PIDX(7, 10)] + F[7][11]*D[PIDX(7, 11)] + F[7][12]*D[PIDX(7, 12)]) + F[9][8]*(F[7][6]*D[PIDX(6, 8)] + F[7][8]*D[PIDX(8, 8)] + F[7][9]*D[PIDX(8, 9)] + F[7][10]*D[PIDX(8, 10)] + F[7][11]*D[PIDX(8, 11)] + F[7][12]*D[PIDX(8, 12)]) + F[9][10]*(F[7][6]*D[PIDX(6, 10)] + F[7][8]*D[PIDX(8, 10)] + F[7][9]*D[PIDX(9, 10)] + F[7][10]*D[PIDX(10, 10)] + F[7][11]*D[PIDX(10, 11)] + F[7][12]*D[PIDX(10, 12)]) + F[9][11]*(F[7][6]*D[PIDX(6, 11)] + F[7][8]*D[PIDX(8, 11)] + F[7][9]*D[PIDX(9, 11)] + F[7][10]*D[PIDX(10, 11)] + F[7][11]*D[PIDX(11, 11)] + F[7][12]*D[PIDX(11, 12)]) + F[9][12]*(F[7][6]*D[PIDX(6, 12)] + F[7][8]*D[PIDX(8, 12)] + F[7][9]*D[PIDX(9, 12)] + F[7][10]*D[PIDX(10, 12)] + F[7][11]*D[PIDX(11, 12)] + F[7][12]*D[PIDX(12, 12)]) + G[7][0]*G[9][0]*Q[0] + G[7][1]*G[9][1]*Q[1] + G[7][2]*G[9][2]*Q[2])*Tsq + (F[9][6]*D[PIDX(6, 7)] + F[9][7]*D[PIDX(7, 7)] + F[9][8]*D[PIDX(7, 8)] + F[7][6]*D[PIDX(6, 9)] + F[7][8]*D[PIDX(8, 9)] + F[7][9]*D[PIDX(9, 9)] + F[7][10]*D[PIDX(9, 10)] + F[9][10]*D[PIDX(7, 10)] + F[7][11]*D[PIDX(9, 11)] + F[9][11]*D[PIDX(7, 11)] + F[7][12]*D[PIDX(9, 12)] + F[9][12]*D[PIDX(7, 12)])*T + D[PIDX(7, 9)];
+	P[PIDX(7, 10)] = (F[7][6]*D[PIDX(6, 10)] + F[7][8]*D[PIDX(8, 10)] + F[7][9]*D[PIDX(9, 10)] + F[7][10]*D[PIDX(10, 10)] + F[7][11]*D[PIDX(10, 11)] + F[7][12]*D[PIDX(10, 12)])*T + D[PIDX(7, 10)];
+	P[PIDX(7, 11)] = (F[7][6]*D[PIDX(6, 11)] + F[7][8]*D[PIDX(8, 11)] + F[7][9]*D[PIDX(9, 11)] + F[7][10]*D[PIDX(10, 11)] + F[7][11]*D[PIDX(11, 11)] + F[7][12]*D[PIDX(11, 12)])*T + D[PIDX(7, 11)];
+	P[PIDX(7, 12)] = (F[7][6]*D[PIDX(6, 12)] + F[7][8]*D[PIDX(8, 12)] + F[7][9]*D[PIDX(9, 12)] + F[7][10]*D[PIDX(10, 12)] + F[7][11]*D[PIDX(11, 12)] + F[7][12]*D[PIDX(12, 12)])*T + D[PIDX(7, 12)];
+	P[PIDX(7, 13)] = (F[7][6]*D[PIDX(6, 13)] + F[7][8]*D[PIDX(8, 13)] + F[7][9]*D[PIDX(9, 13)] + F[7][10]*D[PIDX(10, 13)] + F[7][11]*D[PIDX(11, 13)] + F[7][12]*D[PIDX(12, 13)])*T + D[PIDX(7, 13)];
+	P[PIDX(7, 14)] = (F[7][6]*D[PIDX(6, 14)] + F[7][8]*D[PIDX(8, 14)] + F[7][9]*D[PIDX(9, 14)] + F[7][10]*D[PIDX(10, 14)] + F[7][11]*D[PIDX(11, 14)] + F[7][12]*D[PIDX(12, 14)])*T + D[PIDX(7, 14)];
+	P[PIDX(7, 15)] = (F[7][6]*D[PIDX(6, 15)] + F[7][8]*D[PIDX(8, 15)] + F[7][9]*D[PIDX(9, 15)] + F[7][10]*D[PIDX(10, 15)] + F[7][11]*D[PIDX(11, 15)] + F[7][12]*D[PIDX(12, 15)])*T + D[PIDX(7, 15)];
+	P[PIDX(8, 8)] = (Q[0]*G[8][0]*G[8][0] + Q[1]*G[8][1]*G[8][1] + Q[2]*G[8][2]*G[8][2] + F[8][6]*(F[8][6]*D[PIDX(6, 6)] + F[8][7]*D[PIDX(6, 7)] + F[8][9]*D[PIDX(6, 9)] + F[8][10]*D[PIDX(6, 10)] + F[8][11]*D[PIDX(6, 11)] + F[8][12]*D[PIDX(6, 12)]) + F[8][7]*(F[8][6]*D[PIDX(6, 7)] + F[8][7]*D[PIDX(7, 7)] + F[8][9]*D[PIDX(7, 9)] + F[8][10]*D[PIDX(7, 10)] + F[8][11]*D[PIDX(7, 11)] + F[8][12]*D[PIDX(7, 12)]) + F[8][9]*(F[8][6]*D[PIDX(6, 9)] + F[8][7]*D[PIDX(7, 9)] + F[8][9]*D[PIDX(9, 9)] + F[8][10]*D[PIDX(9, 10)] + F[8][11]*D[PIDX(9, 11)] + F[8][12]*D[PIDX(9, 12)]) + F[8][10]*(F[8][6]*D[PIDX(6, 10)] + F[8][7]*D[PIDX(7, 10)] + F[8][9]*D[PIDX(9, 10)] + F[8][10]*D[PIDX(10, 10)] + F[8][11]*D[PIDX(10, 11)] + F[8][12]*D[PIDX(10, 12)]) + F[8][11]*(F[8][6]*D[PIDX(6, 11)] + F[8][7]*D[PIDX(7, 11)] + F[8][9]*D[PIDX(9, 11)] + F[8][10]*D[PIDX(10, 11)] + F[8][11]*D[PIDX(11, 11)] + F[8][12]*D[PIDX(11, 12)]) + F[8][12]*(F[8][6]*D[PIDX(6, 12)] + F[8][7]*D[PIDX(7, 12)] + F[8][9]*D[PIDX(9, 12)] + F[8][10]*D[PIDX(10, 12)] + F[8][11]*D[PIDX(11, 12)] + F[8][12]*D[PIDX(12, 12)]))*Tsq + (2*F[8][6]*D[PIDX(6, 8)] + 2*F[8][7]*D[PIDX(7, 8)] + 2*F[8][9]*D[PIDX(8, 9)] + 2*F[8][10]*D[PIDX(8, 10)] + 2*F[8][11]*D[PIDX(8, 11)] + 2*F[8][12]*D[PIDX(8, 12)])*T + D[PIDX(8, 8)];
+	P[PIDX(8, 9)] = (F[9][6]*(F[8][6]*D[PIDX(6, 6)] + F[8][7]*D[PIDX(6, 7)] + F[8][9]*D[PIDX(6, 9)] + F[8][10]*D[PIDX(6, 10)] + F[8][11]*D[PIDX(6, 11)] + F[8][12]*D[PIDX(6, 12)]) + F[9][7]*(F[8][6]*D[PIDX(6, 7)] + F[8][7]*D[PIDX(7, 7)] + F[8][9]*D[PIDX(7, 9)] + F[8][10]*D[PIDX(7, 10)] + F[8][11]*D[PIDX(7, 11)] + F[8][12]*D[PIDX(7, 12)]) + F[9][8]*(F[8][6]*D[PIDX(6, 8)] + F[8][7]*D[PIDX(7, 8)] + F[8][9]*D[PIDX(8, 9)] + F[8][10]*D[PIDX(8, 10)] + F[8][11]*D[PIDX(8, 11)] + F[8][12]*D[PIDX(8, 12)]) + F[9][10]*(F[8][6]*D[PIDX(6, 10)] + F[8][7]*D[PIDX(7, 10)] + F[8][9]*D[PIDX(9, 10)] + F[8][10]*D[PIDX(10, 10)] + F[8][11]*D[PIDX(10, 11)] + F[8][12]*D[PIDX(10, 12)]) + F[9][11]*(F[8][6]*D[PIDX(6, 11)] + F[8][7]*D[PIDX(7, 11)] + F[8][9]*D[PIDX(9, 11)] + F[8][10]*D[PIDX(10, 11)] + F[8][11]*D[PIDX(11, 11)] + F[8][12]*D[PIDX(11, 12)]) + F[9][12]*(F[8][6]*D[PIDX(6, 12)] + F[8][7]*D[PIDX(7, 12)] + F[8][9]*D[PIDX(9, 12)] + F[8][10]*D[PIDX(10, 12)] + F[8][11]*D[PIDX(11, 12)] + F[8][12]*D[PIDX(12, 12)]) + G[8][0]*G[9][0]*Q[0] + G[8][1]*G[9][1]*Q[1] + G[8][2]*G[9][2]*Q[2])*Tsq + (F[9][6]*D[PIDX(6, 8)] + F[9][7]*D[PIDX(7, 8)] + F[9][8]*D[PIDX(8, 8)] + F[8][6]*D[PIDX(6, 9)] + F[8][7]*D[PIDX(7, 9)] + F[8][9]*D[PIDX(9, 9)] + F[8][10]*D[PIDX(9, 10)] + F[9][10]*D[PIDX(8, 10)] + F[8][11]*D[PIDX(9, 11)] + F[9][11]*D[PIDX(8, 11)] + F[8][12]*D[PIDX(9, 12)] + F[9][12]*D[PIDX(8, 12)])*T + D[PIDX(8, 9)];
+	P[PIDX(8, 10)] = (F[8][6]*D[PIDX(6, 10)] + F[8][7]*D[PIDX(7, 10)] + F[8][9]*D[PIDX(9, 10)] + F[8][10]*D[PIDX(10, 10)] + F[8][11]*D[PIDX(10, 11)] + F[8][12]*D[PIDX(10, 12)])*T + D[PIDX(8, 10)];
+	P[PIDX(8, 11)] = (F[8][6]*D[PIDX(6, 11)] + F[8][7]*D[PIDX(7, 11)] + F[8][9]*D[PIDX(9, 11)] + F[8][10]*D[PIDX(10, 11)] + F[8][11]*D[PIDX(11, 11)] + F[8][12]*D[PIDX(11, 12)])*T + D[PIDX(8, 11)];
+	P[PIDX(8, 12)] = (F[8][6]*D[PIDX(6, 12)] + F[8][7]*D[PIDX(7, 12)] + F[8][9]*D[PIDX(9, 12)] + F[8][10]*D[PIDX(10, 12)] + F[8][11]*D[PIDX(11, 12)] + F[8][12]*D[PIDX(12, 12)])*T + D[PIDX(8, 12)];
+	P[PIDX(8, 13)] = (F[8][6]*D[PIDX(6, 13)] + F[8][7]*D[PIDX(7, 13)] + F[8][9]*D[PIDX(9, 13)] + F[8][10]*D[PIDX(10, 13)] + F[8][11]*D[PIDX(11, 13)] + F[8][12]*D[PIDX(12, 13)])*T + D[PIDX(8, 13)];
+	P[PIDX(8, 14)] = (F[8][6]*D[PIDX(6, 14)] + F[8][7]*D[PIDX(7, 14)] + F[8][9]*D[PIDX(9, 14)] + F[8][10]*D[PIDX(10, 14)] + F[8][11]*D[PIDX(11, 14)] + F[8][12]*D[PIDX(12, 14)])*T + D[PIDX(8, 14)];
+	P[PIDX(8, 15)] = (F[8][6]*D[PIDX(6, 15)] + F[8][7]*D[PIDX(7, 15)] + F[8][9]*D[PIDX(9, 15)] + F[8][10]*D[PIDX(10, 15)] + F[8][11]*D[PIDX(11, 15)] + F[8][12]*D[PIDX(12, 15)])*T + D[PIDX(8, 15)];
+	P[PIDX(9, 9)] = (Q[0]*G[9][0]*G[9][0] + Q[1]*G[9][1]*G[9][1] + Q[2]*G[9][2]*G[9][2] + F[9][6]*(F[9][6]*D[PIDX(6, 6)] + F[9][7]*D[PIDX(6, 7)] + F[9][8]*D[PIDX(6, 8)] + F[9][10]*D[PIDX(6, 10)] + F[9][11]*D[PIDX(6, 11)] + F[9][12]*D[PIDX(6, 12)]) + F[9][7]*(F[9][6]*D[PIDX(6, 7)] + F[9][7]*D[PIDX(7, 7)] + F[9][8]*D[PIDX(7, 8)] + F[9][10]*D[PIDX(7, 10)] + F[9][11]*D[PIDX(7, 11)] + F[9][12]*D[PIDX(7, 12)]) + F[9][8]*(F[9][6]*D[PIDX(6, 8)] + F[9][7]*D[PIDX(7, 8)] + F[9][8]*D[PIDX(8, 8)] + F[9][10]*D[PIDX(8, 10)] + F[9][11]*D[PIDX(8, 11)] + F[9][12]*D[PIDX(8, 12)]) + F[9][10]*(F[9][6]*D[PIDX(6, 10)] + F[9][7]*D[PIDX(7, 10)] + F[9][8]*D[PIDX(8, 10)] + F[9][10]*D[PIDX(10, 10)] + F[9][11]*D[PIDX(10, 11)] + F[9][12]*D[PIDX(10, 12)]) + F[9][11]*(F[9][6]*D[PIDX(6, 11)] + F[9][7]*D[PIDX(7, 11)] + F[9][8]*D[PIDX(8, 11)] + F[9][10]*D[PIDX(10, 11)] + F[9][11]*D[PIDX(11, 11)] + F[9][12]*D[PIDX(11, 12)]) + F[9][12]*(F[9][6]*D[PIDX(6, 12)] + F[9][7]*D[PIDX(7, 12)] + F[9][8]*D[PIDX(8, 12)] + F[9][10]*D[PIDX(10, 12)] + F[9][11]*D[PIDX(11, 12)] + F[9][12]*D[PIDX(12, 12)]))*Tsq + (2*F[9][6]*D[PIDX(6, 9)] + 2*F[9][7]*D[PIDX(7, 9)] + 2*F[9][8]*D[PIDX(8, 9)] + 2*F[9][10]*D[PIDX(9, 10)] + 2*F[9][11]*D[PIDX(9, 11)] + 2*F[9][12]*D[PIDX(9, 12)])*T + D[PIDX(9, 9)];
+	P[PIDX(9, 10)] = (F[9][6]*D[PIDX(6, 10)] + F[9][7]*D[PIDX(7, 10)] + F[9][8]*D[PIDX(8, 10)] + F[9][10]*D[PIDX(10, 10)] + F[9][11]*D[PIDX(10, 11)] + F[9][12]*D[PIDX(10, 12)])*T + D[PIDX(9, 10)];
+	P[PIDX(9, 11)] = (F[9][6]*D[PIDX(6, 11)] + F[9][7]*D[PIDX(7, 11)] + F[9][8]*D[PIDX(8, 11)] + F[9][10]*D[PIDX(10, 11)] + F[9][11]*D[PIDX(11, 11)] + F[9][12]*D[PIDX(11, 12)])*T + D[PIDX(9, 11)];
+	P[PIDX(9, 12)] = (F[9][6]*D[PIDX(6, 12)] + F[9][7]*D[PIDX(7, 12)] + F[9][8]*D[PIDX(8, 12)] + F[9][10]*D[PIDX(10, 12)] + F[9][11]*D[PIDX(11, 12)] + F[9][12]*D[PIDX(12, 12)])*T + D[PIDX(9, 12)];
+	P[PIDX(9, 13)] = (F[9][6]*D[PIDX(6, 13)] + F[9][7]*D[PIDX(7, 13)] + F[9][8]*D[PIDX(8, 13)] + F[9][10]*D[PIDX(10, 13)] + F[9][11]*D[PIDX(11, 13)] + F[9][12]*D[PIDX(12, 13)])*T + D[PIDX(9, 13)];
+	P[PIDX(9, 14)] = (F[9][6]*D[PIDX(6, 14)] + F[9][7]*D[PIDX(7, 14)] + F[9][8]*D[PIDX(8, 14)] + F[9][10]*D[PIDX(10, 14)] + F[9][11]*D[PIDX(11, 14)] + F[9][12]*D[PIDX(12, 14)])*T + D[PIDX(9, 14)];
+	P[PIDX(9, 15)] = (F[9][6]*D[PIDX(6, 15)] + F[9][7]*D[PIDX(7, 15)] + F[9][8]*D[PIDX(8, 15)] + F[9][10]*D[PIDX(10, 15)] + F[9][11]*D[PIDX(11, 15)] + F[9][12]*D[PIDX(12, 15)])*T + D[PIDX(9, 15)];
+	P[PIDX(10, 10)] = Q[6]*Tsq + D[PIDX(10, 10)];
+	P[PIDX(10, 11)] = D[PIDX(10, 11)];
+	P[PIDX(10, 12)] = D[PIDX(10, 12)];
+	P[PIDX(10, 13)] = D[PIDX(10, 13)];
+	P[PIDX(10, 14)] = D[PIDX(10, 14)];
+	P[PIDX(10, 15)] = D[PIDX(10, 15)];
+	P[PIDX(11, 11)] = Q[7]*Tsq + D[PIDX(11, 11)];
+	P[PIDX(11, 12)] = D[PIDX(11, 12)];
+	P[PIDX(11, 13)] = D[PIDX(11, 13)];
+	P[PIDX(11, 14)] = D[PIDX(11, 14)];
+	P[PIDX(11, 15)] = D[PIDX(11, 15)];
+	P[PIDX(12, 12)] = Q[8]*Tsq + D[PIDX(12, 12)];
+	P[PIDX(12, 13)] = D[PIDX(12, 13)];
+	P[PIDX(12, 14)] = D[PIDX(12, 14)];
+	P[PIDX(12, 15)] = D[PIDX(12, 15)];
+	P[PIDX(13, 13)] = Q[9]*Tsq + D[PIDX(13, 13)];
+	P[PIDX(13, 14)] = D[PIDX(13, 14)];
+	P[PIDX(13, 15)] = D[PIDX(13, 15)];
+	P[PIDX(14, 14)] = Q[10]*Tsq + D[PIDX(14, 14)];
+	P[PIDX(14, 15)] = D[PIDX(14, 15)];
+	P[PIDX(15, 15)] = Q[11]*Tsq + D[PIDX(15, 15)];
 
 
 }
@@ -608,10 +664,10 @@ void CovariancePrediction(float F[NUMX][NUMX], float G[NUMX][NUMW],
 //  ************************************************
 
 void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
-		  float Y[NUMV], float P[NUMX][NUMX], float X[NUMX],
-		  uint16_t SensorsUsed)
+		  float Y[NUMV], float P[NUMP], float X[NUMX],
+		  float K[NUMX][NUMV], uint16_t SensorsUsed)
 {
-	float HP[NUMX], HPHR, Error;
+	float HP[NUMX], HPHR, Error, *p;
 	uint8_t i, j, k, m;
 
 	// Iterate through all the possible measurements and apply the
@@ -620,10 +676,15 @@ void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
 
 		if (SensorsUsed & (0x01 << m)) {	// use this sensor for update
 
-			for (j = 0; j < NUMX; j++) {	// Find Hp = H*P
+			for (j = 0; j < NUMX; j++)	// Find Hp = H*P
 				HP[j] = 0.0f;
-				for (k = 0; k < NUMX; k++)
-					HP[j] += H[m][k] * P[k][j];
+			for (k = 0; k < NUMX; k++) {	// adding row k of P for each nonzero in H
+				if (H[m][k] == 0.0f)
+					continue;
+				for (j = 0; j < k; j++)
+					HP[j] += H[m][k] * P[PIDX(j, k)];
+				for (j = k; j < NUMX; j++)
+					HP[j] += H[m][k] * P[PIDX(k, j)];
 			}
 			HPHR = R[m];	// Find  HPHR = H*P*H' + R
 			for (k = 0; k < NUMX; k++)
@@ -632,10 +693,9 @@ void SerialUpdate(float H[NUMV][NUMX], float R[NUMV], float Z[NUMV],
 			for (k = 0; k < NUMX; k++)
 				K[k][m] = HP[k] / HPHR;	// find K = HP/HPHR
 
-			for (i = 0; i < NUMX; i++) {	// Find P(m)= P(m-1) + K*HP
+			for (i = 0, p = P; i < NUMX; i++) {	// Find P(m)= P(m-1) + K*HP
 				for (j = i; j < NUMX; j++)
-					P[i][j] = P[j][i] =
-					    P[i][j] - K[i][m] * HP[j];
+					*p++ -= K[i][m] * HP[j];
 			}
 
 			Error = Z[m] - Y[m];
@@ -863,7 +923,7 @@ void LinearizeFG(float X[NUMX], float U[NUMU], float F[NUMX][NUMX],
  * directly computes the outputs instead of a matrix that
  * you transform the state by
  */
-void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV])
+void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV], uint16_t SensorsUsed)
 {
 	float q0, q1, q2, q3;
 
@@ -881,12 +941,14 @@ void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV])
 	Y[5] = X[5];
 
 	// Rotate Be by only the yaw heading
-	float r = sqrtf( powf(2*q0*q3 + 2*q1*q2, 2) + powf(q0*q0 + q1*q1 - q2*q2 - q3*q3, 2) );
-	float cP = (q0*q0 + q1*q1 - q2*q2 - q3*q3) / r;
-	float sP = (2*q0*q3 + 2*q1*q2) / r;    
-	Y[6] = Be[0] * cP + Be[1] * sP;
-	Y[7] = -Be[0] * sP + Be[1] * cP;
-	Y[8] = 0; // don't care
+	if (SensorsUsed & MAG_SENSORS) {
+		float r = sqrtf( powf(2*q0*q3 + 2*q1*q2, 2) + powf(q0*q0 + q1*q1 - q2*q2 - q3*q3, 2) );
+		float cP = (q0*q0 + q1*q1 - q2*q2 - q3*q3) / r;
+		float sP = (2*q0*q3 + 2*q1*q2) / r;    
+		Y[6] = Be[0] * cP + Be[1] * sP;
+		Y[7] = -Be[0] * sP + Be[1] * cP;
+		Y[8] = 0; // don't care
+	}
 
 	// Alt = -Pz
 	Y[9] = X[2] * -1.0f;
@@ -897,7 +959,7 @@ void MeasurementEq(float X[NUMX], float Be[3], float Y[NUMV])
  * so the predicted measurements are
  *    Z = H * X
  */
-void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX])
+void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX], uint16_t SensorsUsed)
 {
 	float q0, q1, q2, q3;
 
@@ -912,34 +974,152 @@ void LinearizeH(float X[NUMX], float Be[3], float H[NUMV][NUMX])
 	H[3][3] = H[4][4] = H[5][5] = 1.0f;
 
 	// dBb/dq    (expected magnetometer readings in the horizontal plane)
-	// these equations were generated by Rhb(q)*Be which is the matrix that
-	// rotates the earth magnetic field into the horizontal plane, and then
-	// taking the partial derivative wrt each term in q. Maniuplated in
-	// matlab symbolic toolbox
-	float Be_0 = Be[0];
-	float Be_1 = Be[1];
-	float k1 = 1.0f/sqrtf(powf(q0*q3*2.0f+q1*q2*2.0f,2.0f)+powf(q0*q0+q1*q1-q2*q2-q3*q3,2.0f));
-	float k3 = 1.0f/powf(powf(q0*q3*2.0f+q1*q2*2.0f,2.0f)+powf(q0*q0+q1*q1-q2*q2-q3*q3,2.0f),3.0f/2.0f)*(q0*q0+q1*q1-q2*q2-q3*q3)*(1.0f/2.0f);
-	float k4 = (q0*q0+q1*q1-q2*q2-q3*q3)*4.0f;
-	float k5 = (q0*q3*2.0f+q1*q2*2.0f)*4.0f;
-	float k6 = 1.0f/powf(powf(q0*q3*2.0f+q1*q2*2.0f,2.0f)+powf(q0*q0+q1*q1-q2*q2-q3*q3,2.0f),3.0f/2.0f)*(q0*q3*2.0f+q1*q2*2.0f)*(1.0f/2.0f);
-
-	H[6][6] = Be_0*q0*k1*2.0f  + Be_1*q3*k1*2.0f - Be_0*(q0*k4+q3*k5)*k3 - Be_1*(q0*k4+q3*k5)*k6;
-	H[6][7] = Be_0*q1*k1*2.0f  + Be_1*q2*k1*2.0f - Be_0*(q1*k4+q2*k5)*k3 - Be_1*(q1*k4+q2*k5)*k6;
-	H[6][8] = Be_0*q2*k1*-2.0f + Be_1*q1*k1*2.0f + Be_0*(q2*k4-q1*k5)*k3 + Be_1*(q2*k4-q1*k5)*k6;
-	H[6][9] = Be_1*q0*k1*2.0f  - Be_0*q3*k1*2.0f + Be_0*(q3*k4-q0*k5)*k3 + Be_1*(q3*k4-q0*k5)*k6;
-	H[7][6] = Be_1*q0*k1*2.0f  - Be_0*q3*k1*2.0f - Be_1*(q0*k4+q3*k5)*k3 + Be_0*(q0*k4+q3*k5)*k6;
-	H[7][7] = Be_0*q2*k1*-2.0f + Be_1*q1*k1*2.0f - Be_1*(q1*k4+q2*k5)*k3 + Be_0*(q1*k4+q2*k5)*k6;
-	H[7][8] = Be_0*q1*k1*-2.0f - Be_1*q2*k1*2.0f + Be_1*(q2*k4-q1*k5)*k3 - Be_0*(q2*k4-q1*k5)*k6;
-	H[7][9] = Be_0*q0*k1*-2.0f - Be_1*q3*k1*2.0f + Be_1*(q3*k4-q0*k5)*k3 - Be_0*(q3*k4-q0*k5)*k6;
-	H[8][6] = 0.0f;
-	H[8][7] = 0.0f;
-	H[8][9] = 0.0f;
+	if (SensorsUsed & MAG_SENSORS) {
+		// these equations were generated by Rhb(q)*Be which is the matrix that
+		// rotates the earth magnetic field into the horizontal plane, and then
+		// taking the partial derivative wrt each term in q. Maniuplated in
+		// matlab symbolic toolbox
+		float Be_0 = Be[0];
+		float Be_1 = Be[1];
+		float k1 = 1.0f/sqrtf(powf(q0*q3*2.0f+q1*q2*2.0f,2.0f)+powf(q0*q0+q1*q1-q2*q2-q3*q3,2.0f));
+		float k3 = 1.0f/powf(powf(q0*q3*2.0f+q1*q2*2.0f,2.0f)+powf(q0*q0+q1*q1-q2*q2-q3*q3,2.0f),3.0f/2.0f)*(q0*q0+q1*q1-q2*q2-q3*q3)*(1.0f/2.0f);
+		float k4 = (q0*q0+q1*q1-q2*q2-q3*q3)*4.0f;
+		float k5 = (q0*q3*2.0f+q1*q2*2.0f)*4.0f;
+		float k6 = 1.0f/powf(powf(q0*q3*2.0f+q1*q2*2.0f,2.0f)+powf(q0*q0+q1*q1-q2*q2-q3*q3,2.0f),3.0f/2.0f)*(q0*q3*2.0f+q1*q2*2.0f)*(1.0f/2.0f);
+
+		H[6][6] = Be_0*q0*k1*2.0f  + Be_1*q3*k1*2.0f - Be_0*(q0*k4+q3*k5)*k3 - Be_1*(q0*k4+q3*k5)*k6;
+		H[6][7] = Be_0*q1*k1*2.0f  + Be_1*q2*k1*2.0f - Be_0*(q1*k4+q2*k5)*k3 - Be_1*(q1*k4+q2*k5)*k6;
+		H[6][8] = Be_0*q2*k1*-2.0f + Be_1*q1*k1*2.0f + Be_0*(q2*k4-q1*k5)*k3 + Be_1*(q2*k4-q1*k5)*k6;
+		H[6][9] = Be_1*q0*k1*2.0f  - Be_0*q3*k1*2.0f + Be_0*(q3*k4-q0*k5)*k3 + Be_1*(q3*k4-q0*k5)*k6;
+		H[7][6] = Be_1*q0*k1*2.0f  - Be_0*q3*k1*2.0f - Be_1*(q0*k4+q3*k5)*k3 + Be_0*(q0*k4+q3*k5)*k6;
+		H[7][7] = Be_0*q2*k1*-2.0f + Be_1*q1*k1*2.0f - Be_1*(q1*k4+q2*k5)*k3 + Be_0*(q1*k4+q2*k5)*k6;
+		H[7][8] = Be_0*q1*k1*-2.0f - Be_1*q2*k1*2.0f + Be_1*(q2*k4-q1*k5)*k3 - Be_0*(q2*k4-q1*k5)*k6;
+		H[7][9] = Be_0*q0*k1*-2.0f - Be_1*q3*k1*2.0f + Be_1*(q3*k4-q0*k5)*k3 - Be_0*(q3*k4-q0*k5)*k6;
+		H[8][6] = 0.0f;
+		H[8][7] = 0.0f;
+		H[8][9] = 0.0f;
+	}
 
 	// dAlt/dPz = -1  (expected baro readings)
 	H[9][2] = -1.0f;
 }
 
+
+//  *************  Single filter interface *********
+//  The INS* calls run the filter in default_ctx
+//  ************************************************
+
+void INSGPSInit()
+{
+	insgps_init(&default_ctx);
+}
+
+void INSSetArmed(bool armed)
+{
+	insgps_set_armed(&default_ctx, armed);
+}
+
+void INSGetState(float *pos, float *vel, float *attitude, float *gyro_bias, float *accel_bias)
+{
+	insgps_get_state(&default_ctx, pos, vel, attitude, gyro_bias, accel_bias);
+}
+
+void INSGetVariance(float *var_out)
+{
+	insgps_get_variance(&default_ctx, var_out);
+}
+
+void INSResetP(const float *PDiag)
+{
+	insgps_reset_p(&default_ctx, PDiag);
+}
+
+void INSSetState(const float pos[3], const float vel[3], const float q[4], const float gyro_bias[3], const float accel_bias[3])
+{
+	insgps_set_state(&default_ctx, pos, vel, q, gyro_bias, accel_bias);
+}
+
+void INSPosVelReset(const float pos[3], const float vel[3])
+{
+	insgps_pos_vel_reset(&default_ctx, pos, vel);
+}
+
+void INSSetPosVelVar(float PosVar, float VelVar, float VertPosVar)
+{
+	insgps_set_pos_vel_var(&default_ctx, PosVar, VelVar, VertPosVar);
+}
+
+void INSSetGyroBias(const float gyro_bias[3])
+{
+	insgps_set_gyro_bias(&default_ctx, gyro_bias);
+}
+
+void INSSetAccelBias(const float accel_bias[3])
+{
+	insgps_set_accel_bias(&default_ctx, accel_bias);
+}
+
+void INSSetAccelVar(const float accel_var[3])
+{
+	insgps_set_accel_var(&default_ctx, accel_var);
+}
+
+void INSSetGyroVar(const float gyro_var[3])
+{
+	insgps_set_gyro_var(&default_ctx, gyro_var);
+}
+
+void INSSetMagVar(const float scaled_mag_var[3])
+{
+	insgps_set_mag_var(&default_ctx, scaled_mag_var);
+}
+
+void INSSetBaroVar(const float baro_var)
+{
+	insgps_set_baro_var(&default_ctx, baro_var);
+}
+
+void INSSetMagNorth(const float B[3])
+{
+	insgps_set_mag_north(&default_ctx, B);
+}
+
+void INSStatePrediction(const float gyro_data[3], const float accel_data[3], float dT)
+{
+	insgps_state_prediction(&default_ctx, gyro_data, accel_data, dT);
+}
+
+void INSCovariancePrediction(float dT)
+{
+	insgps_covariance_prediction(&default_ctx, dT);
+}
+
+void INSCorrection(const float mag_data[3], const float Pos[3], const float Vel[3],
+		   float BaroAlt, uint16_t SensorsUsed)
+{
+	insgps_correction(&default_ctx, mag_data, Pos, Vel, BaroAlt, SensorsUsed);
+}
+
+void INSPosCorrection(const float Pos[3], uint16_t SensorsUsed)
+{
+	insgps_pos_correction(&default_ctx, Pos, SensorsUsed);
+}
+
+void INSVelCorrection(const float Vel[3], uint16_t SensorsUsed)
+{
+	insgps_vel_correction(&default_ctx, Vel, SensorsUsed);
+}
+
+void INSMagCorrection(const float mag_data[3])
+{
+	insgps_mag_correction(&default_ctx, mag_data);
+}
+
+void INSBaroCorrection(float BaroAlt)
+{
+	insgps_baro_correction(&default_ctx, BaroAlt);
+}
+
 /**
  * @}
  * @}
@@ -0,0 +1,337 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       logcompress.c
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Delta coding and LZ4 format block compression for logs
+ *
+ * Samples of an object are XORed against the previous sample, which leaves
+ * zeroes wherever a byte did not change: flags, counters, and the exponent
+ * and upper mantissa of slowly moving floats.  Only the changed bytes are
+ * kept, behind a mask saying which they are.
+ *
+ * Records are then gathered into blocks and compressed in the LZ4 block
+ * format with a greedy single probe match finder, which only needs a small
+ * table and works on blocks of a few hundred bytes.  That picks up what
+ * repeats between records: their headers, and objects that did not change.
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <string.h>
+#include "logcompress.h"
+
+// Limits of the LZ4 block format
+#define MIN_MATCH     4
+#define LAST_LITERALS 5
+#define MF_LIMIT      12
+#define RUN_MASK      15
+
+/**
+ * Delta code a sample against the previous one
+ * @param[in] data The sample
+ * @param[in,out] prev The previous sample, replaced by this one
+ * @param[in] len Length of the sample
+ * @param[out] out Coded sample, at most len + (len + 7) / 8 bytes
+ * @returns the length of the coded sample
+ */
+uint16_t logcompress_delta(const uint8_t *data, uint8_t *prev, uint16_t len,
+		uint8_t *out)
+{
+	uint8_t *mask = out;
+	uint8_t *pos = out + (len + 7) / 8;
+
+	memset(mask, 0, (len + 7) / 8);
+
+	for (uint16_t i = 0; i < len; i++) {
+		uint8_t diff = data[i] ^ prev[i];
+
+		if (diff) {
+			mask[i / 8] |= 1 << (i % 8);
+			*pos++ = diff;
+		}
+
+		prev[i] = data[i];
+	}
+
+	return pos - out;
+}
+
+/**
+ * Undo logcompress_delta
+ * @param[in] in The coded sample
+ * @param[in] in_len Bytes available at in
+ * @param[in,out] prev The previous sample, replaced by the decoded one
+ * @param[in] len Length of the sample
+ * @returns the number of bytes of in used, or -1 if in is too short
+ */
+int32_t logcompress_undelta(const uint8_t *in, uint16_t in_len,
+		uint8_t *prev, uint16_t len)
+{
+	const uint8_t *mask = in;
+	const uint8_t *pos = in + (len + 7) / 8;
+	const uint8_t *end = in + in_len;
+
+	if (pos > end) {
+		return -1;
+	}
+
+	for (uint16_t i = 0; i < len; i++) {
+		if (mask[i / 8] & (1 << (i % 8))) {
+			if (pos >= end) {
+				return -1;
+			}
+
+			prev[i] ^= *pos++;
+		}
+	}
+
+	return pos - in;
+}
+
+static inline uint32_t read32(const uint8_t *p)
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint16_t hash32(uint32_t v)
+{
+	return (v * 2654435761U) >> (32 - LOGCOMPRESS_HASH_BITS);
+}
+
+/**
+ * Write a length that did not fit in the token, 255 at a time
+ */
+static uint8_t *put_length(uint8_t *op, uint32_t len)
+{
+	while (len >= 255) {
+		*op++ = 255;
+		len -= 255;
+	}
+
+	*op++ = len;
+
+	return op;
+}
+
+/**
+ * Write one sequence: literals, then a match unless it is the last
+ * @returns the position after the sequence, or NULL if it does not fit
+ */
+static uint8_t *put_sequence(uint8_t *op, const uint8_t *oend,
+		const uint8_t *literals, uint32_t lit_len,
+		uint16_t offset, uint32_t match_len)
+{
+	// Worst case: token, literal length, literals, offset, match length
+	if (1 + lit_len / 255 + 1 + lit_len + 2 + match_len / 255 + 1 >
+			(uint32_t)(oend - op)) {
+		return NULL;
+	}
+
+	uint8_t *token = op++;
+
+	if (lit_len >= RUN_MASK) {
+		*token = RUN_MASK << 4;
+		op = put_length(op, lit_len - RUN_MASK);
+	} else {
+		*token = lit_len << 4;
+	}
+
+	memcpy(op, literals, lit_len);
+	op += lit_len;
+
+	if (offset) {
+		*op++ = offset;
+		*op++ = offset >> 8;
+
+		if (match_len >= RUN_MASK) {
+			*token |= RUN_MASK;
+			op = put_length(op, match_len - RUN_MASK);
+		} else {
+			*token |= match_len;
+		}
+	}
+
+	return op;
+}
+
+/**
+ * Compress a block in the LZ4 block format
+ * @param[in] in Data to compress
+ * @param[in] len Length of the data
+ * @param[out] out Compressed block
+ * @param[in] out_size Space at out; LOGCOMPRESS_BOUND(len) always suffices
+ * @param[in] hash Scratch table of LOGCOMPRESS_HASH_ENTRIES entries
+ * @returns the length of the compressed block, or -1 if it does not fit
+ */
+int32_t logcompress_block(const uint8_t *in, uint16_t len,
+		uint8_t *out, uint16_t out_size, uint16_t *hash)
+{
+	const uint8_t *ip = in;
+	const uint8_t *anchor = in;
+	const uint8_t *end = in + len;
+	uint8_t *op = out;
+	const uint8_t *oend = out + out_size;
+
+	if (len > MF_LIMIT) {
+		// Matches start no later than this and end before the last literals
+		const uint8_t *ilimit = end - MF_LIMIT;
+		const uint8_t *mlimit = end - LAST_LITERALS;
+
+		memset(hash, 0, LOGCOMPRESS_HASH_ENTRIES * sizeof(*hash));
+
+		while (ip <= ilimit) {
+			uint32_t seq = read32(ip);
+			uint16_t h = hash32(seq);
+			const uint8_t *ref = in + hash[h];
+
+			hash[h] = ip - in;
+
+			if (ref >= ip || read32(ref) != seq) {
+				ip++;
+				continue;
+			}
+
+			// Take in any matching bytes just before
+			while (ip > anchor && ref > in && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+			}
+
+			const uint8_t *mp = ip + MIN_MATCH;
+			const uint8_t *rp = ref + MIN_MATCH;
+
+			while (mp < mlimit && *mp == *rp) {
+				mp++;
+				rp++;
+			}
+
+			op = put_sequence(op, oend, anchor, ip - anchor,
+					ip - ref, mp - ip - MIN_MATCH);
+			if (!op) {
+				return -1;
+			}
+
+			anchor = ip = mp;
+		}
+	}
+
+	op = put_sequence(op, oend, anchor, end - anchor, 0, 0);
+	if (!op) {
+		return -1;
+	}
+
+	return op - out;
+}
+
+/**
+ * Decompress a block in the LZ4 block format
+ * @param[in] in Compressed block
+ * @param[in] len Length of the compressed block
+ * @param[out] out Decompressed data
+ * @param[in] out_size Space at out
+ * @returns the length of the data, or -1 if the block is corrupt or the
+ * data does not fit
+ */
+int32_t logcompress_unblock(const uint8_t *in, uint16_t len,
+		uint8_t *out, uint16_t out_size)
+{
+	const uint8_t *ip = in;
+	const uint8_t *iend = in + len;
+	uint8_t *op = out;
+	const uint8_t *oend = out + out_size;
+
+	while (ip < iend) {
+		uint8_t token = *ip++;
+		uint32_t lit_len = token >> 4;
+
+		if (lit_len == RUN_MASK) {
+			uint8_t b;
+
+			do {
+				if (ip >= iend) {
+					return -1;
+				}
+
+				b = *ip++;
+				lit_len += b;
+			} while (b == 255);
+		}
+
+		if (lit_len > (uint32_t)(iend - ip) ||
+				lit_len > (uint32_t)(oend - op)) {
+			return -1;
+		}
+
+		memcpy(op, ip, lit_len);
+		op += lit_len;
+		ip += lit_len;
+
+		// The last sequence has no match
+		if (ip == iend) {
+			break;
+		}
+
+		if (iend - ip < 2) {
+			return -1;
+		}
+
+		uint16_t offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+
+		if (offset == 0 || offset > op - out) {
+			return -1;
+		}
+
+		uint32_t match_len = token & RUN_MASK;
+
+		if (match_len == RUN_MASK) {
+			uint8_t b;
+
+			do {
+				if (ip >= iend) {
+					return -1;
+				}
+
+				b = *ip++;
+				match_len += b;
+			} while (b == 255);
+		}
+
+		match_len += MIN_MATCH;
+
+		if (match_len > (uint32_t)(oend - op)) {
+			return -1;
+		}
+
+		// Byte at a time, as the match may overlap what it produces
+		const uint8_t *ref = op - offset;
+		while (match_len--) {
+			*op++ = *ref++;
+		}
+	}
+
+	return op - out;
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ * @addtogroup TauLabsMath Tau Labs math support libraries
+ * @{
+ *
+ * @file       biquad.c
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Second order IIR filter sections
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include <math.h>
+#include "biquad.h"
+
+/**
+ * Make the section a notch.  Only the coefficients are changed, so the centre
+ * can be moved while the filter is running without restarting it.
+ * @param[in] bq The filter section
+ * @param[in] center_hz The frequency to remove
+ * @param[in] q The centre frequency over the -3dB bandwidth
+ * @param[in] sample_rate The rate samples are passed to biquad_apply
+ * @returns false and makes the section a passthrough if the notch cannot be
+ * placed below the Nyquist frequency
+ */
+bool biquad_notch(struct biquad *bq, float center_hz, float q, float sample_rate)
+{
+	if (center_hz <= 0 || q <= 0 || center_hz >= 0.5f * sample_rate) {
+		biquad_passthrough(bq);
+		return false;
+	}
+
+	// From the RBJ audio EQ cookbook
+	const float omega = 2 * (float)M_PI * center_hz / sample_rate;
+	const float cs = cosf(omega);
+	const float alpha = sinf(omega) / (2 * q);
+	const float a0 = 1 + alpha;
+
+	bq->b0 = 1 / a0;
+	bq->b1 = -2 * cs / a0;
+	bq->b2 = bq->b0;
+	bq->a1 = bq->b1;
+	bq->a2 = (1 - alpha) / a0;
+
+	return true;
+}
+
+/**
+ * Make the section pass samples through unchanged, dropping its state
+ * @param[in] bq The filter section
+ */
+void biquad_passthrough(struct biquad *bq)
+{
+	bq->b0 = 1;
+	bq->b1 = 0;
+	bq->b2 = 0;
+	bq->a1 = 0;
+	bq->a2 = 0;
+
+	biquad_reset(bq);
+}
+
+/**
+ * Clear the filter state
+ * @param[in] bq The filter section
+ */
+void biquad_reset(struct biquad *bq)
+{
+	bq->z1 = 0;
+	bq->z2 = 0;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ * @addtogroup TauLabsMath Tau Labs math support libraries
+ * @{
+ *
+ * @file       biquad.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Second order IIR filter sections
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef BIQUAD_H
+#define BIQUAD_H
+
+#include <stdbool.h>
+
+//! One biquad section, coefficients normalized so that a0 is 1
+struct biquad {
+	float b0;
+	float b1;
+	float b2;
+	float a1;
+	float a2;
+	float z1;
+	float z2;
+};
+
+//! Methods to use the biquad structures
+bool biquad_notch(struct biquad *bq, float center_hz, float q, float sample_rate);
+void biquad_passthrough(struct biquad *bq);
+void biquad_reset(struct biquad *bq);
+
+/**
+ * Filter one sample, transposed direct form II
+ * @param[in] bq The filter section
+ * @param[in] in The input sample
+ * @returns The filtered sample
+ */
+static inline float biquad_apply(struct biquad *bq, float in)
+{
+	float out = bq->b0 * in + bq->z1;
+
+	bq->z1 = bq->b1 * in - bq->a1 * out + bq->z2;
+	bq->z2 = bq->b2 * in - bq->a2 * out;
+
+	return out;
+}
+
+#endif /* BIQUAD_H */
+
+/**
+ * @}
+ * @}
+ */
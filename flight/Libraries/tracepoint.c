@@ -0,0 +1,186 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsLibraries Tau Labs Libraries
+ * @{
+ *
+ * @file       tracepoint.c
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Timestamped tracepoints along the control path
+ *
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * Tracepoints may be hit from any task.  Writers claim a slot by bumping
+ * head with a compare and swap, fill it in, then stamp it with its sequence
+ * number so the reader can tell a claimed slot from a written one.  When the
+ * ring is full new tracepoints are counted and dropped, so what reaches the
+ * ground is a run of complete cycles rather than a stream with holes in it.
+ *
+ * A periodic event drains the whole ring into @ref TraceEvents, setting it
+ * once for every TRACEEVENTS_TIME_NUMELEM entries.  Each set is logged as it
+ * happens; telemetry would only see the last one, so it is not sent.
+ * python/tracestats.py turns the log back into per stage latencies.
+ */
+
+#include "openpilot.h"
+#include "tracepoint.h"
+
+#if defined(DIAG_TRACE)
+
+// Private constants
+// Five tracepoints per control loop at 2 kHz fill 100 slots every drain
+// period, this leaves room for the drain to run late
+#define TRACE_RING_LEN 256
+#define TRACE_DRAIN_PERIOD_MS 10
+
+// Private types
+struct trace_slot {
+	uint32_t raw_time;
+	volatile uint16_t seq;
+	uint8_t point;
+};
+
+// Private variables
+static struct trace_slot ring[TRACE_RING_LEN];
+static volatile uint32_t ring_head;
+static volatile uint32_t ring_tail;
+static volatile uint32_t dropped;
+
+//! Converts the raw times to a running microsecond count
+static uint32_t last_raw_time;
+static uint32_t last_time_us;
+
+// Private functions
+static void tracepoint_drain_cb(UAVObjEvent *ev, void *ctx, void *obj, int len);
+static uint8_t tracepoint_drain_batch(void);
+
+/**
+ * Initialize the tracepoint ring and start draining it
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t TracepointInitialize(void)
+{
+	if (TraceEventsInitialize() == -1)
+		return -1;
+
+	last_raw_time = PIOS_DELAY_GetRaw();
+
+	UAVObjEvent ev;
+	memset(&ev, 0, sizeof(ev));
+	EventPeriodicCallbackCreate(&ev, tracepoint_drain_cb, TRACE_DRAIN_PERIOD_MS);
+
+	return 0;
+}
+
+/**
+ * Record that a tracepoint was reached
+ * @param[in] point the tracepoint
+ */
+void Tracepoint(enum tracepoint_id point)
+{
+	uint32_t raw_time = PIOS_DELAY_GetRaw();
+	uint32_t idx;
+
+	do {
+		idx = ring_head;
+
+		if (idx - ring_tail >= TRACE_RING_LEN) {
+			__sync_fetch_and_add(&dropped, 1);
+			return;
+		}
+	} while (!__sync_bool_compare_and_swap(&ring_head, idx, idx + 1));
+
+	struct trace_slot *slot = &ring[idx % TRACE_RING_LEN];
+
+	slot->raw_time = raw_time;
+	slot->point = point;
+
+	__sync_synchronize();
+
+	slot->seq = idx + 1;
+}
+
+/**
+ * Move every written tracepoint into TraceEvents
+ */
+static void tracepoint_drain_cb(UAVObjEvent *ev, void *ctx, void *obj, int len)
+{
+	(void) ev; (void) ctx; (void) obj; (void) len;
+
+	// Bounded, so tracepoints hit while draining cannot keep us here
+	for (int i = 0; i < TRACE_RING_LEN / TRACEEVENTS_TIME_NUMELEM; i++)
+		if (tracepoint_drain_batch() < TRACEEVENTS_TIME_NUMELEM)
+			break;
+}
+
+/**
+ * Move the oldest written tracepoints into TraceEvents
+ * \returns the number of tracepoints moved
+ */
+static uint8_t tracepoint_drain_batch(void)
+{
+	TraceEventsData events;
+	uint32_t tail = ring_tail;
+	uint8_t count = 0;
+
+	while (count < TRACEEVENTS_TIME_NUMELEM && tail != ring_head) {
+		struct trace_slot *slot = &ring[tail % TRACE_RING_LEN];
+
+		// Claimed but not written yet, pick it up next time
+		if (slot->seq != (uint16_t) (tail + 1))
+			break;
+
+		__sync_synchronize();
+
+		last_time_us += PIOS_DELAY_DiffuS2(last_raw_time, slot->raw_time);
+		last_raw_time = slot->raw_time;
+
+		events.Time[count] = last_time_us;
+		events.Point[count] = slot->point;
+		count++;
+
+		tail++;
+	}
+
+	if (count == 0)
+		return 0;
+
+	// Release the slots only once they have been copied
+	__sync_synchronize();
+	ring_tail = tail;
+
+	events.Count = count;
+	events.Dropped = dropped;
+
+	for (uint8_t i = count; i < TRACEEVENTS_TIME_NUMELEM; i++) {
+		events.Time[i] = 0;
+		events.Point[i] = 0;
+	}
+
+	TraceEventsSet(&events);
+
+	return count;
+}
+
+#endif /* DIAG_TRACE */
+
+/**
+ * @}
+ */
@@ -55,23 +55,37 @@
 #include "pios_thread.h"
 #include "pios_queue.h"
 #include "misc_math.h"
+#include "fastloop.h"
+#include "tracepoint.h"
+
+// The targets building the CMSIS DSP library define one of these for it
+#if defined(ARM_MATH_CM4) || defined(ARM_MATH_SIM)
+#define MIXER_USE_DSP_LIB
+#include "arm_math.h"
+#endif
 
 // Private constants
 #define MAX_QUEUE_SIZE 2
 
-#if defined(PIOS_ACTUATOR_STACK_SIZE)
-#define STACK_SIZE_BYTES PIOS_ACTUATOR_STACK_SIZE
-#else
-#define STACK_SIZE_BYTES 1336
-#endif
+#define STACK_SIZE_BYTES ACTUATOR_STACK_BYTES
 
 #define TASK_PRIORITY PIOS_THREAD_PRIO_HIGHEST
 #define FAILSAFE_TIMEOUT_MS 100
 #define MAX_MIX_ACTUATORS ACTUATORCOMMAND_CHANNEL_NUMELEM
 #define MULTIROTOR_MIXER_UPPER_BOUND 128
+#define MIXER_NUM_INPUTS MIXERSETTINGS_MIXER1VECTOR_NUMELEM
+#define MIXER_CURVE_POINTS MIXERSETTINGS_THROTTLECURVE1_NUMELEM
 
 // Private types
 
+//! A curve from MixerSettings with the slope of each segment worked out
+struct mixer_curve {
+	float input_min;
+	float input_scale;
+	float value[MIXER_CURVE_POINTS];
+	float slope[MIXER_CURVE_POINTS - 1];
+};
+
 // Private variables
 static struct pios_queue *queue;
 static struct pios_thread *taskHandle;
@@ -90,18 +104,39 @@ static MixerSettingsData mixerSettings;
 // Ditto, for the actuator settings.
 static ActuatorSettingsData actuatorSettings;
 
+// MixerSettings compiled for the mixer, redone whenever the settings change.
+// Each row of the matrix maps the mixer inputs, in Mixer1Vector order, to a
+// servo or motor channel and is zero for other channel types.
+static float mixer_matrix[MAX_MIX_ACTUATORS * MIXER_NUM_INPUTS];
+static MixerSettingsMixer1TypeOptions mixer_types[MAX_MIX_ACTUATORS];
+static int mixer_count;
+static struct mixer_curve throttle_curve1;
+static struct mixer_curve throttle_curve2;
+
+// State kept from one step to the next
+static float dT = 0.0f;
+static uint32_t last_systime;
+static FlightStatusData flightStatus;
+static ManualControlCommandData manual_control_command;
+static SystemSettingsAirframeTypeOptions airframe_type;
+
 // Private functions
 static void actuator_task(void* parameters);
+static void actuator_setup(void);
+static void actuator_update_settings(void);
+static void actuator_step(void);
+static void actuator_fast_step(void);
+static void actuator_fast_stall(void);
 static float scale_channel(float value, int idx);
 static void set_failsafe();
-static float throt_curve(const float input, const float* curve, uint8_t num_points);
-static float collective_curve(const float input, const float* curve, uint8_t num_points);
+static void mixer_curve_setup(struct mixer_curve *curve, const float *points,
+		float input_min, float input_max);
+static float mixer_curve_apply(const struct mixer_curve *curve, float input);
+static void mixer_compile(void);
+static void mixer_multiply(const float *inputs, float *outputs);
 static bool set_channel(uint8_t mixer_channel, float value);
 static void actuator_set_servo_mode(void);
-float process_mixer(const int index, const float curve1, const float curve2,
-		ActuatorDesiredData *desired);
-static float mix_channel(int ct, ActuatorDesiredData *desired,
-		float curve1, float curve2);
+static float mix_channel(int ct);
 
 static MixerSettingsMixer1TypeOptions get_mixer_type(int idx);
 static typeof(mixerSettings.Mixer1Vector) *get_mixer_vec(int idx);
@@ -112,6 +147,21 @@ static typeof(mixerSettings.Mixer1Vector) *get_mixer_vec(int idx);
  */
 int32_t ActuatorStart()
 {
+	// In fast loop mode the sensor task runs each step straight after
+	// stabilization, so there is no task or queue
+	if (FastLoopEnabled()) {
+		actuator_setup();
+		actuator_update_settings();
+		set_failsafe();
+
+		FastLoopRegister(FASTLOOP_STAGE_OUTPUT, actuator_fast_step,
+				actuator_fast_stall);
+		return 0;
+	}
+
+	queue = PIOS_Queue_Create(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
+	ActuatorDesiredConnectQueue(queue);
+
 	// Watchdog must be registered before starting task
 	PIOS_WDG_RegisterFlag(PIOS_WDG_ACTUATOR);
 
@@ -145,8 +195,10 @@ int32_t ActuatorInitialize()
 		return -1;
 	}
 
-	queue = PIOS_Queue_Create(MAX_QUEUE_SIZE, sizeof(UAVObjEvent));
-	ActuatorDesiredConnectQueue(queue);
+	// Latency statistics, and the fast loop if selected
+	if (FastLoopInitialize() == -1) {
+		return -1;
+	}
 
 	// Primary output of this module
 	if (ActuatorCommandInitialize() == -1) {
@@ -228,38 +280,12 @@ static float get_curve2_source(ActuatorDesiredData *desired, SystemSettingsAirfr
  */
 static void actuator_task(void* parameters)
 {
-	float dT = 0.0f;
-
-	ActuatorCommandData command;
-	ActuatorDesiredData desired;
-	MixerStatusData mixerStatus;
-	FlightStatusData flightStatus;
-	ManualControlCommandData manual_control_command;
-
-	SystemSettingsAirframeTypeOptions airframe_type;
-
-	// Connect update callbacks
-	FlightStatusConnectCallbackCtx(UAVObjCbSetFlag, &flightStatusUpdated);
-	ManualControlCommandConnectCallbackCtx(UAVObjCbSetFlag, &manualControlCommandUpdated);
-
-	// Main task loop
-	uint32_t last_systime = PIOS_Thread_Systime();
+	actuator_setup();
 
 	bool rc = false;
 
 	while (1) {
-		bool clipped = false;
-
-		if (actuator_settings_updated) {
-			actuator_settings_updated = false;
-			ActuatorSettingsGet(&actuatorSettings);
-			actuator_set_servo_mode();
-		}
-		if (mixer_settings_updated) {
-			mixer_settings_updated = false;
-			MixerSettingsGet(&mixerSettings);
-			SystemSettingsAirframeTypeGet(&airframe_type);
-		}
+		actuator_update_settings();
 
 		if (rc != true) {
 			/* Update of ActuatorDesired timed out,
@@ -280,263 +306,393 @@ static void actuator_task(void* parameters)
 			continue;
 		}
 
-		// Check how long since last update
-		uint32_t this_systime = PIOS_Thread_Systime();
-		if (this_systime > last_systime) // reuse dt in case of wraparound
-			dT = (this_systime - last_systime) / 1000.0f;
-		last_systime = this_systime;
+		actuator_step();
+	}
+}
 
-		ActuatorDesiredGet(&desired);
-		ActuatorCommandGet(&command);
+/**
+ * @brief Connect the update flags, before the first step
+ */
+static void actuator_setup(void)
+{
+	// Connect update callbacks
+	FlightStatusConnectCallbackCtx(UAVObjCbSetFlag, &flightStatusUpdated);
+	ManualControlCommandConnectCallbackCtx(UAVObjCbSetFlag, &manualControlCommandUpdated);
 
-		if (flightStatusUpdated) {
-			FlightStatusGet(&flightStatus);
-			flightStatusUpdated = false;
-		}
+	last_systime = PIOS_Thread_Systime();
+}
 
-		if (manualControlCommandUpdated) {
-			ManualControlCommandGet(&manual_control_command);
-			manualControlCommandUpdated = false;
-		}
+/**
+ * @brief Fetch the actuator and mixer settings if they changed
+ */
+static void actuator_update_settings(void)
+{
+	if (actuator_settings_updated) {
+		actuator_settings_updated = false;
+		ActuatorSettingsGet(&actuatorSettings);
+		actuator_set_servo_mode();
+	}
+	if (mixer_settings_updated) {
+		mixer_settings_updated = false;
+		MixerSettingsGet(&mixerSettings);
+		SystemSettingsAirframeTypeGet(&airframe_type);
+		mixer_compile();
+	}
+}
 
-		int nMixers = 0;
+/**
+ * @brief Fast loop step, mixes the ActuatorDesired just computed
+ */
+static void actuator_fast_step(void)
+{
+	actuator_update_settings();
+	actuator_step();
+}
 
-		for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
-			if (get_mixer_type(ct) != MIXERSETTINGS_MIXER1TYPE_DISABLED) {
-				nMixers++;
-			}
-		}
-		if ((nMixers < 2) && !ActuatorCommandReadOnly()) { //Nothing can fly with less than two mixers.
-			set_failsafe(); // So that channels like PWM buzzer keep working
-			continue;
-		}
+/**
+ * @brief Fast loop stall handler, goes to failsafe like a queue timeout
+ */
+static void actuator_fast_stall(void)
+{
+	actuator_update_settings();
 
-		bool armed = flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED;
-		bool spin_while_armed = actuatorSettings.MotorsSpinWhileArmed == ACTUATORSETTINGS_MOTORSSPINWHILEARMED_TRUE;
+	if (PIOS_Thread_Systime() - last_systime >= FAILSAFE_TIMEOUT_MS)
+		set_failsafe();
+}
 
-		float throttle_source = -1;
-		// as long as we're not a heli in failsafe mode, we should set throttle from the manual throttle value
-		// if we're not a heli, set it from the thrust value
-		if (airframe_type == SYSTEMSETTINGS_AIRFRAMETYPE_HELICP) {
-			if (flightStatus.FlightMode != FLIGHTSTATUS_FLIGHTMODE_FAILSAFE) {
-				throttle_source = manual_control_command.Throttle;
-			}
-		} else {
-			throttle_source = desired.Thrust;
+/**
+ * @brief Mix the latest ActuatorDesired and update the outputs
+ */
+static void actuator_step(void)
+{
+	ActuatorCommandData command;
+	ActuatorDesiredData desired;
+	MixerStatusData mixerStatus;
+
+	bool clipped = false;
+
+	// Check how long since last update
+	uint32_t this_systime = PIOS_Thread_Systime();
+	if (this_systime > last_systime) // reuse dt in case of wraparound
+		dT = (this_systime - last_systime) / 1000.0f;
+	last_systime = this_systime;
+
+	ActuatorDesiredGet(&desired);
+	ActuatorCommandGet(&command);
+
+	if (flightStatusUpdated) {
+		FlightStatusGet(&flightStatus);
+		flightStatusUpdated = false;
+	}
+
+	if (manualControlCommandUpdated) {
+		ManualControlCommandGet(&manual_control_command);
+		manualControlCommandUpdated = false;
+	}
+
+	if ((mixer_count < 2) && !ActuatorCommandReadOnly()) { //Nothing can fly with less than two mixers.
+		set_failsafe(); // So that channels like PWM buzzer keep working
+		return;
+	}
+
+	bool armed = flightStatus.Armed == FLIGHTSTATUS_ARMED_ARMED;
+	bool spin_while_armed = actuatorSettings.MotorsSpinWhileArmed == ACTUATORSETTINGS_MOTORSSPINWHILEARMED_TRUE;
+
+	float throttle_source = -1;
+	// as long as we're not a heli in failsafe mode, we should set throttle from the manual throttle value
+	// if we're not a heli, set it from the thrust value
+	if (airframe_type == SYSTEMSETTINGS_AIRFRAMETYPE_HELICP) {
+		if (flightStatus.FlightMode != FLIGHTSTATUS_FLIGHTMODE_FAILSAFE) {
+			throttle_source = manual_control_command.Throttle;
 		}
+	} else {
+		throttle_source = desired.Thrust;
+	}
 
-		bool stabilize_now = armed && (throttle_source > 0.0f);
+	bool stabilize_now = armed && (throttle_source > 0.0f);
 
-		static uint32_t last_pos_throttle_time = 0;
+	static uint32_t last_pos_throttle_time = 0;
 
-		if (stabilize_now) {
-			if (actuatorSettings.LowPowerStabilizationMaxTime) {
-				last_pos_throttle_time = this_systime;
-			}
+	if (stabilize_now) {
+		if (actuatorSettings.LowPowerStabilizationMaxTime) {
+			last_pos_throttle_time = this_systime;
+		}
 
-			// Could consider stabilizing on a positive arming edge,
-			// but this seems problematic.
-		} else if (last_pos_throttle_time) {
-			if ((this_systime - last_pos_throttle_time) <
-					1000.0f * actuatorSettings.LowPowerStabilizationMaxTime) {
-				stabilize_now = true;
-				throttle_source = 0.0f;
-			} else {
-				last_pos_throttle_time = 0;
-			}
+		// Could consider stabilizing on a positive arming edge,
+		// but this seems problematic.
+	} else if (last_pos_throttle_time) {
+		if ((this_systime - last_pos_throttle_time) <
+				1000.0f * actuatorSettings.LowPowerStabilizationMaxTime) {
+			stabilize_now = true;
+			throttle_source = 0.0f;
+		} else {
+			last_pos_throttle_time = 0;
 		}
+	}
 
-		float curve1 = throt_curve(throttle_source, mixerSettings.ThrottleCurve1, MIXERSETTINGS_THROTTLECURVE1_NUMELEM);
+	uint32_t mix_start = PIOS_DELAY_GetRaw();
 
-		//The source for the secondary curve is selectable
-		float curve2 = collective_curve(
-				get_curve2_source(&desired, airframe_type, mixerSettings.Curve2Source),
-				mixerSettings.ThrottleCurve2,
-				MIXERSETTINGS_THROTTLECURVE2_NUMELEM);
+	float inputs[MIXER_NUM_INPUTS];
+	inputs[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1] =
+		mixer_curve_apply(&throttle_curve1, throttle_source);
 
-		float * status = (float *)&mixerStatus; //access status objects as an array of floats
+	//The source for the secondary curve is selectable
+	inputs[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2] =
+		mixer_curve_apply(&throttle_curve2,
+			get_curve2_source(&desired, airframe_type, mixerSettings.Curve2Source));
 
-		float min_chan = INFINITY;
-		float max_chan = -INFINITY;
-		float neg_clip = 0;
-		int num_motors = 0;
+	inputs[MIXERSETTINGS_MIXER1VECTOR_ROLL] = desired.Roll;
+	inputs[MIXERSETTINGS_MIXER1VECTOR_PITCH] = desired.Pitch;
+	inputs[MIXERSETTINGS_MIXER1VECTOR_YAW] = desired.Yaw;
 
-		for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
-			status[ct] = mix_channel(ct, &desired, curve1, curve2);
+	float * status = (float *)&mixerStatus; //access status objects as an array of floats
 
-			if (get_mixer_type(ct) == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
-				min_chan = fminf(min_chan, status[ct]);
-				max_chan = fmaxf(max_chan, status[ct]);
+	// Servos and motors all at once, then the other channel types
+	mixer_multiply(inputs, status);
 
-				if (status[ct] < 0.0f) {
-					neg_clip += status[ct];
-				}
+	float min_chan = INFINITY;
+	float max_chan = -INFINITY;
+	float neg_clip = 0;
+	int num_motors = 0;
+
+	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+		if (mixer_types[ct] != MIXERSETTINGS_MIXER1TYPE_SERVO &&
+				mixer_types[ct] != MIXERSETTINGS_MIXER1TYPE_MOTOR)
+			status[ct] = mix_channel(ct);
 
-				num_motors++;
+		if (mixer_types[ct] == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+			min_chan = fminf(min_chan, status[ct]);
+			max_chan = fmaxf(max_chan, status[ct]);
+
+			if (status[ct] < 0.0f) {
+				neg_clip += status[ct];
 			}
+
+			num_motors++;
 		}
+	}
 
-		float gain = 1.0f;
-		float offset = 0.0f;
+	float gain = 1.0f;
+	float offset = 0.0f;
 
-		/* This is a little dubious.  Scale down command ranges to
-		 * fit.  It may cause some cross-axis coupling, though
-		 * generally less than if we were to actually let it clip.
-		 */
-		if ((max_chan - min_chan) > 1.0f) {
-			gain = 1.0f / (max_chan - min_chan);
+	/* This is a little dubious.  Scale down command ranges to
+	 * fit.  It may cause some cross-axis coupling, though
+	 * generally less than if we were to actually let it clip.
+	 */
+	if ((max_chan - min_chan) > 1.0f) {
+		gain = 1.0f / (max_chan - min_chan);
 
-			clipped = true;
+		clipped = true;
 
-			max_chan *= gain;
-			min_chan *= gain;
-		}
+		max_chan *= gain;
+		min_chan *= gain;
+	}
 
-		/* Sacrifice throttle because of clipping */
-		if (max_chan > 1.0f) {
-			clipped = true;
-
-			offset = 1.0f - max_chan;
-		} else if (min_chan < 0.0f) {
-			clipped = true;
-
-			/* Low-side clip management-- how much power are we
-			 * willing to add??? */
-
-			neg_clip /= num_motors;
-
-			/* neg_clip is now the amount of throttle "already added." by
-			 * clipping...
-			 *
-			 * Find the "highest possible value" of offset.
-			 * if neg_clip is -15%, and maxpoweradd is 10%, we need to add
-			 * -5% to all motors.
-			 * if neg_clip is 5%, and maxpoweradd is 10%, we can add up to
-			 * 5% to all motors to further fix clipping.
-			 */
-			offset = neg_clip + actuatorSettings.LowPowerStabilizationMaxPowerAdd;
-
-			/* Add the lesser of--
-			 * A) the amount the lowest channel is out of range.
-			 * B) the above calculated offset.
-			 */
-			offset = MIN(-min_chan, offset);
-		}
+	/* Sacrifice throttle because of clipping */
+	if (max_chan > 1.0f) {
+		clipped = true;
+
+		offset = 1.0f - max_chan;
+	} else if (min_chan < 0.0f) {
+		clipped = true;
+
+		/* Low-side clip management-- how much power are we
+		 * willing to add??? */
+
+		neg_clip /= num_motors;
 
-		for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
-			// Motors have additional protection for when to be on
-			if (get_mixer_type(ct) == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
-				if (!armed) {
-					status[ct] = -1;  //force min throttle
-				} else if (!stabilize_now) {
-					if (!spin_while_armed) {
-						status[ct] = -1;
-					} else {
-						status[ct] = 0;
-					}
+		/* neg_clip is now the amount of throttle "already added." by
+		 * clipping...
+		 *
+		 * Find the "highest possible value" of offset.
+		 * if neg_clip is -15%, and maxpoweradd is 10%, we need to add
+		 * -5% to all motors.
+		 * if neg_clip is 5%, and maxpoweradd is 10%, we can add up to
+		 * 5% to all motors to further fix clipping.
+		 */
+		offset = neg_clip + actuatorSettings.LowPowerStabilizationMaxPowerAdd;
+
+		/* Add the lesser of--
+		 * A) the amount the lowest channel is out of range.
+		 * B) the above calculated offset.
+		 */
+		offset = MIN(-min_chan, offset);
+	}
+
+	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+		// Motors have additional protection for when to be on
+		if (mixer_types[ct] == MIXERSETTINGS_MIXER1TYPE_MOTOR) {
+			if (!armed) {
+				status[ct] = -1;  //force min throttle
+			} else if (!stabilize_now) {
+				if (!spin_while_armed) {
+					status[ct] = -1;
 				} else {
-					status[ct] = status[ct] * gain + offset;
-
-					if (status[ct] > 0) {
-						// Apply curve fitting, mapping the input to the propeller output.
-						status[ct] = powapprox(status[ct], actuatorSettings.MotorInputOutputCurveFit);
-					} else {
-						status[ct] = 0;
-					}
+					status[ct] = 0;
 				}
-			}
+			} else {
+				status[ct] = status[ct] * gain + offset;
 
-			command.Channel[ct] = scale_channel(status[ct], ct);
+				if (status[ct] > 0) {
+					// Apply curve fitting, mapping the input to the propeller output.
+					status[ct] = powapprox(status[ct], actuatorSettings.MotorInputOutputCurveFit);
+				} else {
+					status[ct] = 0;
+				}
+			}
 		}
 
-		// Store update time
-		command.UpdateTime = 1000.0f*dT;
-		if (1000.0f*dT > command.MaxUpdateTime)
-			command.MaxUpdateTime = 1000.0f*dT;
+		command.Channel[ct] = scale_channel(status[ct], ct);
+	}
 
-		// Update output object
-		if (!ActuatorCommandReadOnly()) {
-			ActuatorCommandSet(&command);
-		} else {
-			// it's read only during servo configuration--
-			// so GCS takes precedence.
-			ActuatorCommandGet(&command);
-		}
+	TRACEPOINT(TRACE_MIXER);
+
+	// Store update time, and the time spent mixing
+	command.UpdateTime = 1000.0f*dT;
+	if (1000.0f*dT > command.MaxUpdateTime)
+		command.MaxUpdateTime = 1000.0f*dT;
+
+	command.MixerTime = MIN(PIOS_DELAY_DiffuS(mix_start), UINT16_MAX);
+	if (command.MixerTime > command.MaxMixerTime)
+		command.MaxMixerTime = command.MixerTime;
+
+	// Update output object
+	if (!ActuatorCommandReadOnly()) {
+		ActuatorCommandSet(&command);
+	} else {
+		// it's read only during servo configuration--
+		// so GCS takes precedence.
+		ActuatorCommandGet(&command);
+	}
 
 #if defined(MIXERSTATUS_DIAGNOSTICS)
-		MixerStatusSet(&mixerStatus);
+	MixerStatusSet(&mixerStatus);
 #endif
 
-		// Update servo outputs
-		bool success = true;
+	// Update servo outputs
+	bool success = true;
 
-		for (int n = 0; n < ACTUATORCOMMAND_CHANNEL_NUMELEM; ++n) {
-			success &= set_channel(n, command.Channel[n]);
-		}
+	for (int n = 0; n < ACTUATORCOMMAND_CHANNEL_NUMELEM; ++n) {
+		success &= set_channel(n, command.Channel[n]);
+	}
 
-		PIOS_Servo_Update();
+	PIOS_Servo_Update();
+	TRACEPOINT(TRACE_SERVO_UPDATE);
+	FastLoopOutputDone();
+
+	if (!success) {
+		command.NumFailedUpdates++;
+		ActuatorCommandSet(&command);
+		AlarmsSet(SYSTEMALARMS_ALARM_ACTUATOR, SYSTEMALARMS_ALARM_CRITICAL);
+	} else if (stabilize_now && clipped) {
+		AlarmsSet(SYSTEMALARMS_ALARM_ACTUATOR, SYSTEMALARMS_ALARM_WARNING);
+	} else {
+		AlarmsClear(SYSTEMALARMS_ALARM_ACTUATOR);
+	}
+}
 
-		if (!success) {
-			command.NumFailedUpdates++;
-			ActuatorCommandSet(&command);
-			AlarmsSet(SYSTEMALARMS_ALARM_ACTUATOR, SYSTEMALARMS_ALARM_CRITICAL);
-		} else if (stabilize_now && clipped) {
-			AlarmsSet(SYSTEMALARMS_ALARM_ACTUATOR, SYSTEMALARMS_ALARM_WARNING);
-		} else {
-			AlarmsClear(SYSTEMALARMS_ALARM_ACTUATOR);
-		}
+/**
+ * @brief Compile MixerSettings into the mixer matrix, channel types and curves
+ */
+static void mixer_compile(void)
+{
+	mixer_count = 0;
+
+	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+		mixer_types[ct] = get_mixer_type(ct);
+
+		if (mixer_types[ct] != MIXERSETTINGS_MIXER1TYPE_DISABLED)
+			mixer_count++;
+
+		// Taking the pointer to the array preserves type information so smart compilers
+		// can detect accesses past the end.
+		typeof(mixerSettings.Mixer1Vector) *vector = get_mixer_vec(ct);
+		bool matrix_row = mixer_types[ct] == MIXERSETTINGS_MIXER1TYPE_SERVO ||
+			mixer_types[ct] == MIXERSETTINGS_MIXER1TYPE_MOTOR;
+
+		for (int i = 0; i < MIXER_NUM_INPUTS; i++)
+			mixer_matrix[ct * MIXER_NUM_INPUTS + i] = matrix_row ?
+				(*vector)[i] * (1.0f / MULTIROTOR_MIXER_UPPER_BOUND) : 0;
 	}
+
+	/* The throttle curve takes input in [0,1].  This means that the
+	 * throttle channel neutral value is nearly the same as its min value,
+	 * which is convenient since the neutral value is used as a failsafe
+	 * and would thus shut off the motor.
+	 *
+	 * The collective curve takes input in [-1,1] so that the neutral point
+	 * may be set arbitrarily within the typical channel input range.
+	 */
+	mixer_curve_setup(&throttle_curve1, mixerSettings.ThrottleCurve1, 0.0f, 1.0f);
+	mixer_curve_setup(&throttle_curve2, mixerSettings.ThrottleCurve2, -1.0f, 1.0f);
 }
 
 /**
- *Process mixing for one actuator
+ * Multiply the mixer inputs by the mixer matrix
+ * @param[in] inputs the mixer inputs, in Mixer1Vector order
+ * @param[out] outputs one value per channel
  */
-float process_mixer(const int index, const float curve1, const float curve2,
-		ActuatorDesiredData *desired)
+static void mixer_multiply(const float *inputs, float *outputs)
 {
-	// Taking the pointer to the array preserves type information so smart compilers
-	// can detect accesses past the end.
-	typeof(mixerSettings.Mixer1Vector) *vector = get_mixer_vec(index);
+#if defined(MIXER_USE_DSP_LIB)
+	arm_matrix_instance_f32 matrix = { MAX_MIX_ACTUATORS, MIXER_NUM_INPUTS, mixer_matrix };
+	arm_matrix_instance_f32 in = { MIXER_NUM_INPUTS, 1, (float *) inputs };
+	arm_matrix_instance_f32 out = { MAX_MIX_ACTUATORS, 1, outputs };
+
+	arm_mat_mult_f32(&matrix, &in, &out);
+#else
+	const float *row = mixer_matrix;
 
-	float result = (((*vector)[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE1] * curve1) +
-			((*vector)[MIXERSETTINGS_MIXER1VECTOR_THROTTLECURVE2] * curve2) +
-			((*vector)[MIXERSETTINGS_MIXER1VECTOR_ROLL] * desired->Roll) +
-			((*vector)[MIXERSETTINGS_MIXER1VECTOR_PITCH] * desired->Pitch) +
-			((*vector)[MIXERSETTINGS_MIXER1VECTOR_YAW] * desired->Yaw)) * (1.0f / MULTIROTOR_MIXER_UPPER_BOUND);
+	for (int ct = 0; ct < MAX_MIX_ACTUATORS; ct++) {
+		float sum = 0;
 
-	return (result);
+		for (int i = 0; i < MIXER_NUM_INPUTS; i++)
+			sum += row[i] * inputs[i];
+
+		outputs[ct] = sum;
+		row += MIXER_NUM_INPUTS;
+	}
+#endif
 }
 
 /**
- * Interpolate a throttle curve
- *
- * throttle curve assumes input is [0,1]
- * this means that the throttle channel neutral value is nearly the same as its min value
- * this is convenient for throttle, since the neutral value is used as a failsafe and would thus shut off the motor
- *
- * @param input the input value, in [0,1]
- * @param curve the array of points in the curve
- * @param num_points the number of points in the curve
- * @return the output value, in [0,1]
+ * Prepare a curve for interpolation
+ * @param[out] curve the prepared curve
+ * @param[in] points MIXER_CURVE_POINTS points, evenly spaced over the input range
+ * @param[in] input_min the input mapped to the first point
+ * @param[in] input_max the input mapped to the last point
  */
-static float throt_curve(float const input, float const * curve, uint8_t num_points)
+static void mixer_curve_setup(struct mixer_curve *curve, const float *points,
+		float input_min, float input_max)
 {
-	return linear_interpolate(input, curve, num_points, 0.0f, 1.0f);
+	curve->input_min = input_min;
+	curve->input_scale = (MIXER_CURVE_POINTS - 1) / (input_max - input_min);
+
+	for (int i = 0; i < MIXER_CURVE_POINTS; i++)
+		curve->value[i] = points[i];
+
+	for (int i = 0; i < MIXER_CURVE_POINTS - 1; i++)
+		curve->slope[i] = points[i + 1] - points[i];
 }
 
 /**
- * Interpolate a collective curve
- *
- * we need to accept input in [-1,1] so that the neutral point may be set arbitrarily within the typical channel input range, which is [-1,1]
- *
- * @param input The input value, in [-1,1]
- * @param curve Array of points in the curve
- * @param num_points Number of points in the curve
- * @return the output value, in [-1,1]
+ * Interpolate a curve, holding the end points outside the input range
+ * @param[in] curve the curve from mixer_curve_setup
+ * @param[in] input the input value
+ * @return the output value
  */
-static float collective_curve(float const input, float const * curve, uint8_t num_points)
+static float mixer_curve_apply(const struct mixer_curve *curve, float input)
 {
-	return linear_interpolate(input, curve, num_points, -1.0f, 1.0f);
+	float pos = (input - curve->input_min) * curve->input_scale;
+
+	if (!(pos > 0))
+		return curve->value[0];
+	if (pos >= MIXER_CURVE_POINTS - 1)
+		return curve->value[MIXER_CURVE_POINTS - 1];
+
+	int idx = pos;
+
+	return curve->value[idx] + curve->slope[idx] * (pos - idx);
 }
 
 /**
@@ -569,7 +725,7 @@ static float scale_channel(float value, int idx)
 
 static float channel_failsafe_value(int idx)
 {
-	switch (get_mixer_type(idx)) {
+	switch (mixer_types[idx]) {
 	case MIXERSETTINGS_MIXER1TYPE_MOTOR:
 		return actuatorSettings.ChannelMin[idx];
 	case MIXERSETTINGS_MIXER1TYPE_SERVO:
@@ -738,10 +894,12 @@ static void actuator_set_servo_mode(void)
 			ACTUATORSETTINGS_TIMERUPDATEFREQ_NUMELEM, actuatorSettings.ChannelMax);
 }
 
-static float mix_channel(int ct, ActuatorDesiredData *desired,
-		float curve1, float curve2)
+/**
+ * Value for a channel that is not mixed through the matrix
+ */
+static float mix_channel(int ct)
 {
-	MixerSettingsMixer1TypeOptions type = get_mixer_type(ct);
+	MixerSettingsMixer1TypeOptions type = mixer_types[ct];
 
 	switch (type) {
 	case MIXERSETTINGS_MIXER1TYPE_DISABLED:
@@ -750,15 +908,9 @@ static float mix_channel(int ct, ActuatorDesiredData *desired,
 		break;
 
 	case MIXERSETTINGS_MIXER1TYPE_SERVO:
-		return process_mixer(ct, curve1, curve2, desired);
-		break;
-
 	case MIXERSETTINGS_MIXER1TYPE_MOTOR:
-		(void) 0;               // nil statement
-		float val = process_mixer(ct, curve1, curve2, desired);
-
-		return val;
-		break;
+		// Mixed through the matrix instead
+		return 0;
 	// If an accessory channel is selected for direct bypass mode
 	// In this configuration the accessory channel is scaled and
 	// mapped directly to output.
@@ -885,6 +1037,7 @@ static typeof(mixerSettings.Mixer1Vector) *get_mixer_vec(int idx)
 }
 
 DONT_BUILD_IF(ACTUATORSETTINGS_TIMERUPDATEFREQ_NUMELEM > PIOS_SERVO_MAX_BANKS, TooManyServoBanks);
+DONT_BUILD_IF(MIXERSETTINGS_THROTTLECURVE2_NUMELEM != MIXER_CURVE_POINTS, MixerCurveSizesDiffer);
 
 /**
  * @}
@@ -288,19 +288,32 @@ static int32_t updateSensorsDigital(AccelsData * accelsData, GyrosData * gyrosDa
 	struct pios_sensor_accel_data accels;
 	struct pios_queue *queue;
 
-	queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_GYRO);
-	if(queue == NULL || PIOS_Queue_Receive(queue, (void *) &gyros, 4) == false) {
-		return-1;
-	}
-
 	// As it says below, because the rest of the code expects the accel to be ready when
-	// the gyro is we must block here too
-	queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_ACCEL);
-	if(queue == NULL || PIOS_Queue_Receive(queue, (void *) &accels, 1) == false) {
-		return -1;
+	// the gyro is we must block for both
+	if (PIOS_SENSORS_HasRing(PIOS_SENSOR_GYRO)) {
+		// the average of everything since the last update
+		struct pios_sensor_sample average;
+
+		if (!PIOS_SENSORS_ReadAverage(PIOS_SENSOR_GYRO, &average, 4))
+			return -1;
+		gyros = average.data.gyro;
+
+		if (!PIOS_SENSORS_ReadAverage(PIOS_SENSOR_ACCEL, &average, 1))
+			return -1;
+		accels = average.data.accel;
+	} else {
+		queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_GYRO);
+		if(queue == NULL || PIOS_Queue_Receive(queue, (void *) &gyros, 4) == false) {
+			return-1;
+		}
+
+		queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_ACCEL);
+		if(queue == NULL || PIOS_Queue_Receive(queue, (void *) &accels, 1) == false) {
+			return -1;
+		}
 	}
-	else
-		update_accels(&accels, accelsData);
+
+	update_accels(&accels, accelsData);
 
 	// Update gyros after the accels since the rest of the code expects
 	// the accels to be available first
@@ -55,6 +55,7 @@
 #include "physical_constants.h"
 #include "coordinate_conversions.h"
 #include "WorldMagModel.h"
+#include "tracepoint.h"
 
 // UAVOs
 #include "accels.h"
@@ -246,10 +247,10 @@ int32_t AttitudeInitialize(void)
 }
 
 /**
- * Start the task.  Expects all objects to be initialized by this point.
- * \returns 0 on success or -1 if initialisation failed
+ * Create the sensor queues and connect them, shared by the task and the
+ * log replay harness.
  */
-int32_t AttitudeStart(void)
+static void attitude_connect(void)
 {
 	// Create the queues for the sensors
 	gyroQueue = PIOS_Queue_Create(1, sizeof(UAVObjEvent));
@@ -286,6 +287,15 @@ int32_t AttitudeStart(void)
 		GPSPositionConnectQueue(gpsQueue);
 	if (GPSVelocityHandle())
 		GPSVelocityConnectQueue(gpsVelQueue);
+}
+
+/**
+ * Start the task.  Expects all objects to be initialized by this point.
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t AttitudeStart(void)
+{
+	attitude_connect();
 
 	// Watchdog must be registered before starting task
 	PIOS_WDG_RegisterFlag(PIOS_WDG_ATTITUDE);
@@ -299,108 +309,153 @@ int32_t AttitudeStart(void)
 
 MODULE_HIPRI_INITCALL(AttitudeInitialize, AttitudeStart)
 
+//! Filter selection state carried between iterations of the main loop
+static bool filters_first_run;
+static uint32_t last_algorithm;
+static bool last_complementary;
+
 /**
- * Module thread, should not return.
+ * Reset the estimator so the next iteration reinitializes the selected
+ * filters from the current settings.
  */
-static void AttitudeTask(void *parameters)
+static void attitude_reset(void)
 {
-	bool first_run = true;
-	uint32_t last_algorithm;
-	bool     last_complementary;
+	filters_first_run = true;
 	set_state_estimation_error(SYSTEMALARMS_STATEESTIMATION_UNDEFINED);
 
 	// Force settings update to make sure rotation loaded
 	settingsUpdatedCb(NULL, NULL, NULL, 0);
 
-	// Wait for all the sensors be to read
-	PIOS_Thread_Sleep(100);
-
 	// Invalidate previous algorithm to trigger a first run
 	last_algorithm = 0xfffffff;
 	last_complementary = false;
+}
 
-	// Main task loop
-	while (1) {
+/**
+ * One iteration of the main loop: update the selected filters from the
+ * sensor queues and publish the estimate.
+ */
+static void attitude_step(void)
+{
+	int32_t ret_val = -1;
 
-		int32_t ret_val = -1;
+	// When changing the attitude filter reinitialize
+	if (last_algorithm != stateEstimation.AttitudeFilter) {
+		last_algorithm = stateEstimation.AttitudeFilter;
+		filters_first_run = true;
+	}
 
-		// When changing the attitude filter reinitialize
-		if (last_algorithm != stateEstimation.AttitudeFilter) {
-			last_algorithm = stateEstimation.AttitudeFilter;
-			first_run = true;
-		}
+	// Determine if we can set the home location. This is done here to share the stack
+	// space with the INS which is the largest stack on the code.
+	check_home_location();
+
+	// There are two options to select:
+	//   Attitude filter - what sets the attitude
+	//   Navigation filter - what sets the position and velocity
+	// If the INS is used for either then it should run
+	bool ins = (stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_INSOUTDOOR) ||
+	           (stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_INSINDOOR) ||
+	           (stateEstimation.NavigationFilter == STATEESTIMATION_NAVIGATIONFILTER_INS);
+
+	// INS outdoor mode when used for navigation OR explicit outdoor attitude
+	bool outdoor = (stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_INSOUTDOOR) ||
+	                (stateEstimation.NavigationFilter == STATEESTIMATION_NAVIGATIONFILTER_INS);
+
+	// Complementary filter only needed when used for attitude
+	bool complementary = stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_COMPLEMENTARY;
+
+	// Update one or both filters
+	if (ins) {
+		ret_val = updateAttitudeINSGPS(filters_first_run, outdoor);
+		if (complementary)
+			 updateAttitudeComplementary(filters_first_run || complementary != last_complementary,
+			                               true,     // the secondary filter
+			                               false);   // no raw gps is used
+	} else {
+		ret_val = updateAttitudeComplementary(filters_first_run,
+		                                       false,
+		                                       stateEstimation.NavigationFilter == STATEESTIMATION_NAVIGATIONFILTER_RAW);
+	}
 
-		// Determine if we can set the home location. This is done here to share the stack
-		// space with the INS which is the largest stack on the code.
-		check_home_location();
-
-		// There are two options to select:
-		//   Attitude filter - what sets the attitude
-		//   Navigation filter - what sets the position and velocity
-		// If the INS is used for either then it should run
-		bool ins = (stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_INSOUTDOOR) ||
-		           (stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_INSINDOOR) ||
-		           (stateEstimation.NavigationFilter == STATEESTIMATION_NAVIGATIONFILTER_INS);
-
-		// INS outdoor mode when used for navigation OR explicit outdoor attitude
-		bool outdoor = (stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_INSOUTDOOR) ||
-		                (stateEstimation.NavigationFilter == STATEESTIMATION_NAVIGATIONFILTER_INS);
-
-		// Complementary filter only needed when used for attitude
-		bool complementary = stateEstimation.AttitudeFilter == STATEESTIMATION_ATTITUDEFILTER_COMPLEMENTARY;
-
-		// Update one or both filters
-		if (ins) {
-			ret_val = updateAttitudeINSGPS(first_run, outdoor);
-			if (complementary)
-				 updateAttitudeComplementary(first_run || complementary != last_complementary,
-				                               true,     // the secondary filter
-				                               false);   // no raw gps is used
-		} else {
-			ret_val = updateAttitudeComplementary(first_run,
-			                                       false,
-			                                       stateEstimation.NavigationFilter == STATEESTIMATION_NAVIGATIONFILTER_RAW);
-		}
+	last_complementary = complementary;
 
-		last_complementary = complementary;
-
-		// Get the requested data
-		// This  function blocks on data queue
-		switch (stateEstimation.AttitudeFilter ) {
-		case STATEESTIMATION_ATTITUDEFILTER_COMPLEMENTARY:
-			setAttitudeComplementary();
-			break;
-		case STATEESTIMATION_ATTITUDEFILTER_INSOUTDOOR:
-		case STATEESTIMATION_ATTITUDEFILTER_INSINDOOR:
-			setAttitudeINSGPS();
-			break;
-		}
+	// Get the requested data
+	// This  function blocks on data queue
+	switch (stateEstimation.AttitudeFilter ) {
+	case STATEESTIMATION_ATTITUDEFILTER_COMPLEMENTARY:
+		setAttitudeComplementary();
+		break;
+	case STATEESTIMATION_ATTITUDEFILTER_INSOUTDOOR:
+	case STATEESTIMATION_ATTITUDEFILTER_INSINDOOR:
+		setAttitudeINSGPS();
+		break;
+	}
 
-		// Use the selected source for position and velocity
-		switch (stateEstimation.NavigationFilter) {
-		case STATEESTIMATION_NAVIGATIONFILTER_INS:
-			// TODO: When running in dual mode and the INS is not initialized set
-			// an error here
-			setNavigationINSGPS();
-			break;
-		case STATEESTIMATION_NAVIGATIONFILTER_RAW:
-			setNavigationRaw();
-			break;
-		case STATEESTIMATION_NAVIGATIONFILTER_NONE:
-		default:
-			setNavigationNone();
-			break;
-		}
+	// Use the selected source for position and velocity
+	switch (stateEstimation.NavigationFilter) {
+	case STATEESTIMATION_NAVIGATIONFILTER_INS:
+		// TODO: When running in dual mode and the INS is not initialized set
+		// an error here
+		setNavigationINSGPS();
+		break;
+	case STATEESTIMATION_NAVIGATIONFILTER_RAW:
+		setNavigationRaw();
+		break;
+	case STATEESTIMATION_NAVIGATIONFILTER_NONE:
+	default:
+		setNavigationNone();
+		break;
+	}
 
-		updateNedAccel();
+	updateNedAccel();
 
-		if(ret_val == 0)
-			first_run = false;
+	if(ret_val == 0)
+		filters_first_run = false;
+}
+
+/**
+ * Module thread, should not return.
+ */
+static void AttitudeTask(void *parameters)
+{
+	attitude_reset();
+
+	// Wait for all the sensors be to read
+	PIOS_Thread_Sleep(100);
+
+	// Main task loop
+	while (1) {
+		attitude_step();
 
 		PIOS_WDG_UpdateFlag(PIOS_WDG_ATTITUDE);
 	}
 }
 
+#if defined(ATTITUDE_REPLAY)
+/**
+ * Connect the sensor queues without starting the task, for the log replay
+ * harness which drives the estimator itself through @ref AttitudeReplayStep.
+ * \returns 0 on success or -1 if initialisation failed
+ */
+int32_t AttitudeReplayStart(void)
+{
+	attitude_connect();
+	attitude_reset();
+
+	return 0;
+}
+
+/**
+ * Run one iteration of the estimator.  The caller must have updated both
+ * @ref Gyros and @ref Accels since the previous call, or it will block on
+ * the sensor queues like the task does.
+ */
+void AttitudeReplayStep(void)
+{
+	attitude_step();
+}
+#endif /* ATTITUDE_REPLAY */
+
 //! The complementary filter attitude estimate
 static float cf_q[4];
 
@@ -1205,6 +1260,8 @@ static int32_t updateAttitudeINSGPS(bool first_run, bool outdoor_mode)
 	// Advance the covariance estimate
 	INSCovariancePrediction(dT);
 
+	TRACEPOINT(TRACE_INS_PREDICT);
+
 	if(mag_updated) {
 		sensors |= MAG_SENSORS;
 		mag_updated = false;
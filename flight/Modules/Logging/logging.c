@@ -40,7 +40,9 @@
 #include "uavobjectmanager.h"
 #include "misc_math.h"
 #include "timeutils.h"
+#include "logcompress.h"
 #include "uavobjectmanager.h"
+#include "uavobjectsinit.h"
 
 #include "pios_streamfs.h"
 #include <pios_board_info.h>
@@ -65,6 +67,7 @@
 #include "stabilizationdesired.h"
 #include "systemalarms.h"
 #include "systemident.h"
+#include "traceevents.h"
 #include "velocityactual.h"
 #include "waypointactive.h"
 
@@ -80,7 +83,48 @@ const char DIGITS[16] = "0123456789abcdef";
 
 #define LOGGING_PERIOD_MS 100
 
+/* Compact log format: after the text header comes a "##compact" line and a
+ * schema of the objects in the log (version, count, then the ID, size and
+ * flags of each).  Each record is then the object's index in the schema,
+ * the ms since the previous record as a varint, the instance ID as a
+ * varint for multi instance objects, and the packed object data.
+ */
+#define LOG_COMPACT_DIVIDER "##compact\n"
+#define LOG_COMPACT_VERSION 1
+#define LOG_COMPACT_FLAG_MULTI_INSTANCE 0x01
+#define LOG_COMPACT_SCHEMA_ENTRY_LEN 7
+#define LOG_COMPACT_SCHEMA_MAX 255	// The count and record index are a byte
+#define LOG_COMPACT_HEADER_MAX (1 + 5 + 3)
+#define LOG_COMPACT_RECORD_MAX (LOG_COMPACT_HEADER_MAX + UAVOBJECTS_LARGEST)
+
+/* Compressed log format: the compact format at version 2, with the records
+ * gathered into blocks.  Each block is its length and compressed length
+ * (16 bits each, the latter 0 if the block is stored as is) followed by the
+ * data in the LZ4 block format.  Objects flagged in the schema are delta
+ * coded against their previous sample, which starts out as all zeroes.
+ */
+#define LOG_COMPACT_VERSION_COMPRESSED 2
+#define LOG_COMPACT_FLAG_DELTA 0x02
+#define LOG_BLOCK_HEADER_LEN 4
+#define LOG_DELTA_RECORD_MAX (LOG_COMPACT_RECORD_MAX + (UAVOBJECTS_LARGEST + 7) / 8)
+#define LOG_BLOCK_SIZE (LOG_DELTA_RECORD_MAX > 256 ? LOG_DELTA_RECORD_MAX : 256)
+#define LOG_HISTORY_SIZE 768
+#define LOG_NO_HISTORY 0xffff
+
 // Private types
+struct log_compressor {
+	struct pios_mutex *lock;
+	uint16_t *history_off;	// per schema entry, or LOG_NO_HISTORY
+	uint16_t history_fill;
+	uint16_t block_fill;
+	uint16_t packed_len;	// of the packed block waiting to be sent
+	uint32_t raw_bytes;	// what the records would take uncompressed
+	uint32_t packed_bytes;
+	uint16_t hash[LOGCOMPRESS_HASH_ENTRIES];
+	uint8_t history[LOG_HISTORY_SIZE];
+	uint8_t block[LOG_BLOCK_SIZE];
+	uint8_t packed[LOG_BLOCK_HEADER_LEN + LOGCOMPRESS_BOUND(LOG_BLOCK_SIZE)];
+};
 
 // Private variables
 static UAVTalkConnection uavTalkCon;
@@ -93,19 +137,45 @@ static LoggingStatsData loggingData;
 static void    loggingTask(void *parameters);
 static int32_t send_data(uint8_t *data, int32_t length);
 static int32_t send_data_nonblock(uint8_t *data, int32_t length);
+static uintptr_t get_logging_com();
+static void update_bytes_logged();
 static uint16_t get_minimum_logging_period();
 static void unregister_object(UAVObjHandle obj);
+static void connect_object(UAVObjHandle obj, uint16_t period);
 static void register_object(UAVObjHandle obj);
 static void register_default_profile();
 static void logSettings(UAVObjHandle obj);
 static void writeHeader();
 static void updateSettings();
+static bool compact_alloc();
+static bool schema_add(UAVObjHandle obj);
+static void schema_add_settings(UAVObjHandle obj);
+static void log_object_data(UAVObjHandle obj, uint16_t instId);
+static bool compressor_alloc();
+static void compressor_reset();
+static void compressor_add_history(UAVObjHandle obj);
+static bool compressor_append(uint16_t idx, const uint8_t *hdr,
+		uint16_t hdr_len, uint16_t size);
+static void compressor_flush(bool wait);
 
 // Local variables
 static uintptr_t logging_com_id;
 static uint32_t written_bytes;
 static bool destination_onboard_flash;
 
+// Compact format state, allocated the first time it is used
+static bool log_compact;
+static UAVObjHandle *schema_objs;
+static uint16_t schema_size;
+static uint16_t schema_count;
+static bool schema_full;
+static uint8_t *record_buf;
+static uint32_t last_record_time;
+
+// Compressed format state, also allocated the first time it is used
+static bool log_compress;
+static struct log_compressor *compressor;
+
 #ifdef PIOS_INCLUDE_LOG_TO_FLASH
 static const struct streamfs_cfg streamfs_settings = {
 	.fs_magic      = 0x89abceef,
@@ -184,6 +254,7 @@ int32_t LoggingInitialize(void)
 		module_enabled = false;
 		return -1;
 	}
+	UAVTalkSetOutputCom(uavTalkCon, &get_logging_com);
 	
 	return 0;
 }
@@ -292,6 +363,28 @@ static void loggingTask(void *parameters)
 		case LOGGINGSTATS_OPERATION_INITIALIZING:
 			// Unregister all objects
 			UAVObjIterate(&unregister_object);
+
+			// Finish off a compressed log being restarted
+			if (log_compress) {
+				compressor_flush(true);
+			}
+
+			log_compact = settings.LogFormat != LOGGINGSETTINGS_LOGFORMAT_UAVTALK;
+			log_compress = settings.LogFormat == LOGGINGSETTINGS_LOGFORMAT_COMPRESSED;
+			if ((log_compact && !compact_alloc()) ||
+					(log_compress && !compressor_alloc())) {
+				log_compress = false;
+				loggingData.Operation = LOGGINGSTATS_OPERATION_ERROR;
+				LoggingStatsSet(&loggingData);
+				break;
+			}
+			schema_count = 0;
+			schema_full = false;
+			last_record_time = 0;
+			if (log_compress) {
+				compressor_reset();
+			}
+
 #ifdef PIOS_INCLUDE_LOG_TO_FLASH
 			if (destination_onboard_flash){
 				// Close the file if it is open for reading
@@ -319,15 +412,8 @@ static void loggingTask(void *parameters)
 			}
 #endif /* PIOS_INCLUDE_LOG_TO_FLASH */
 
-			// Write information at start of the log file
-			writeHeader();
-
-			// Log settings
-			if (settings.LogSettingsOnStart == LOGGINGSETTINGS_LOGSETTINGSONSTART_TRUE){
-				UAVObjIterate(&logSettings);
-			}
-
-			// Register objects to be logged
+			// Register objects to be logged.  Nothing is written
+			// until the operation changes to logging.
 			switch (settings.Profile) {
 				case LOGGINGSETTINGS_PROFILE_DEFAULT:
 					register_default_profile();
@@ -338,8 +424,27 @@ static void loggingTask(void *parameters)
 					break;
 			}
 
+			if (log_compact && settings.LogSettingsOnStart == LOGGINGSETTINGS_LOGSETTINGSONSTART_TRUE) {
+				UAVObjIterate(&schema_add_settings);
+			}
+
+			// Rather than a log missing some of the objects asked for
+			if (schema_full) {
+				loggingData.Operation = LOGGINGSTATS_OPERATION_ERROR;
+				LoggingStatsSet(&loggingData);
+				break;
+			}
+
+			// Write information at start of the log file
+			writeHeader();
+
+			// Log settings
+			if (settings.LogSettingsOnStart == LOGGINGSETTINGS_LOGSETTINGSONSTART_TRUE){
+				UAVObjIterate(&logSettings);
+			}
+
 			// Empty the queue
-			LoggingStatsBytesLoggedSet(&written_bytes);
+			update_bytes_logged();
 			loggingData.Operation = LOGGINGSTATS_OPERATION_LOGGING;
 			LoggingStatsSet(&loggingData);
 			break;
@@ -348,7 +453,12 @@ static void loggingTask(void *parameters)
 				// Sleep between updating stats.
 				PIOS_Thread_Sleep_Until(&now, LOGGING_PERIOD_MS);
 
-				LoggingStatsBytesLoggedSet(&written_bytes);
+				// Get slowly filling blocks out too
+				if (log_compress) {
+					compressor_flush(false);
+				}
+
+				update_bytes_logged();
 
 				now = PIOS_Thread_Systime();
 			}
@@ -404,6 +514,11 @@ static void loggingTask(void *parameters)
 		default:
 			//  Makes sure that we are not hogging the processor
 			PIOS_Thread_Sleep(10);
+
+			// Write out what is left of a compressed log
+			if (log_compress) {
+				compressor_flush(true);
+			}
 #ifdef PIOS_INCLUDE_LOG_TO_FLASH
 			if (destination_onboard_flash) {
 				// Close the file if necessary
@@ -427,7 +542,7 @@ static void loggingTask(void *parameters)
 static void logSettings(UAVObjHandle obj)
 {
 	if (UAVObjIsSettings(obj)) {
-		UAVTalkSendObjectTimestamped(uavTalkCon, obj, 0, false, 0);
+		log_object_data(obj, 0);
 	}
 }
 
@@ -453,11 +568,54 @@ static int32_t send_data_nonblock(uint8_t *data, int32_t length)
 	if (PIOS_COM_SendBufferNonBlocking(logging_com_id, data, length) < 0)
 		return -1;
 
-	written_bytes += length;
-
 	return length;
 }
 
+/**
+ * Get the COM device UAVTalk can build packets in directly
+ */
+static uintptr_t get_logging_com()
+{
+	return logging_com_id;
+}
+
+/**
+ * Publish the number of bytes logged.  Objects may be written straight
+ * into the COM buffer without passing through send_data_nonblock(), so
+ * their share is taken from the UAVTalk statistics.  When logging to
+ * onboard flash, also publish how hard the flash is being worked.
+ */
+static void update_bytes_logged()
+{
+	UAVTalkStats stats;
+	UAVTalkGetStats(uavTalkCon, &stats);
+
+	uint32_t bytes_logged = written_bytes + stats.txBytes;
+	LoggingStatsBytesLoggedSet(&bytes_logged);
+
+#ifdef PIOS_INCLUDE_LOG_TO_FLASH
+	struct streamfs_stats fs_stats;
+	if (destination_onboard_flash &&
+			PIOS_STREAMFS_GetStats(logging_com_id, &fs_stats) == 0) {
+		float amplification = 0;
+		if (fs_stats.bytes_written > 0) {
+			amplification = (float)fs_stats.bytes_programmed / fs_stats.bytes_written;
+		}
+		uint32_t stall_ms = fs_stats.stall_us / 1000;
+
+		LoggingStatsFlashWritesSet(&fs_stats.program_ops);
+		LoggingStatsFlashWriteAmplificationSet(&amplification);
+		LoggingStatsFlashStallTimeSet(&stall_ms);
+		LoggingStatsFlashMaxStallSet(&fs_stats.max_stall_us);
+	}
+#endif
+
+	if (log_compress && compressor->packed_bytes > 0) {
+		float ratio = (float)compressor->raw_bytes / compressor->packed_bytes;
+		LoggingStatsCompressionRatioSet(&ratio);
+	}
+}
+
 /**
  * @brief Callback for adding an object to the logging queue
  * @param ev the event
@@ -471,7 +629,7 @@ static void obj_updated_callback(UAVObjEvent * ev, void* cb_ctx, void *uavo_data
 		return;
 	}
 
-	UAVTalkSendObjectTimestamped(uavTalkCon, ev->obj, ev->instId, false, 0);
+	log_object_data(ev->obj, ev->instId);
 }
 
 
@@ -520,6 +678,31 @@ static void unregister_object(UAVObjHandle obj) {
 	UAVObjDisconnectCallback(obj, obj_updated_callback, NULL);
 }
 
+/**
+ * Connect the update callback of an object to be logged, and give it a
+ * place in the schema when logging in the compact format
+ * \param[in] obj Object to connect
+ * \param[in] period Minimum time between samples in ms, 1 to log every update
+ */
+static void connect_object(UAVObjHandle obj, uint16_t period)
+{
+	if (log_compact && !schema_add(obj)) {
+		return;
+	}
+
+	if (log_compress) {
+		compressor_add_history(obj);
+	}
+
+	if (period <= 1) {
+		// log every update
+		UAVObjConnectCallback(obj, obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED);
+	} else {
+		// log updates throttled
+		UAVObjConnectCallbackThrottled(obj, obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, period);
+	}
+}
+
 /**
  * Register a new object: connect the update callback
  * \param[in] obj Object to connect
@@ -549,13 +732,7 @@ static void register_object(UAVObjHandle obj)
 
 	period = MAX(period, get_minimum_logging_period());
 
-	if (period == 1) {
-		// log every update
-		UAVObjConnectCallback(obj, obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED);
-	} else {
-		// log updates throttled
-		UAVObjConnectCallbackThrottled(obj, obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, period);
-	}
+	connect_object(obj, period);
 }
 
 /**
@@ -567,62 +744,466 @@ static void register_default_profile()
 	uint16_t min_period = MAX(get_minimum_logging_period(), 10);
 
 	// Objects for which we log all changes (use 100Hz to limit max data rate)
-	UAVObjConnectCallbackThrottled(FlightStatusHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10);
-	UAVObjConnectCallbackThrottled(SystemAlarmsHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10);
+	connect_object(FlightStatusHandle(), 10);
+	connect_object(SystemAlarmsHandle(), 10);
 	if (WaypointActiveHandle()) {
-		UAVObjConnectCallbackThrottled(WaypointActiveHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10);
+		connect_object(WaypointActiveHandle(), 10);
 	}
 
 	if (SystemIdentHandle()){
-		UAVObjConnectCallbackThrottled(SystemIdentHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10);
+		connect_object(SystemIdentHandle(), 10);
+	}
+
+	// Tracepoints are only useful complete, present with DIAG_TRACE builds
+	if (TraceEventsHandle()) {
+		connect_object(TraceEventsHandle(), 1);
 	}
 
 	// Log fast
-	UAVObjConnectCallbackThrottled(AccelsHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, min_period);
-	UAVObjConnectCallbackThrottled(GyrosHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, min_period);
+	connect_object(AccelsHandle(), min_period);
+	connect_object(GyrosHandle(), min_period);
 
 	// Log a bit slower
-	UAVObjConnectCallbackThrottled(AttitudeActualHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 5 * min_period);
+	connect_object(AttitudeActualHandle(), 5 * min_period);
 
 	if (MagnetometerHandle()) {
-		UAVObjConnectCallbackThrottled(MagnetometerHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 5 * min_period);
+		connect_object(MagnetometerHandle(), 5 * min_period);
 	}
 
-	UAVObjConnectCallbackThrottled(ManualControlCommandHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 5 * min_period);
-	UAVObjConnectCallbackThrottled(ActuatorDesiredHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 5 * min_period);
-	UAVObjConnectCallbackThrottled(StabilizationDesiredHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 5 * min_period);
+	connect_object(ManualControlCommandHandle(), 5 * min_period);
+	connect_object(ActuatorDesiredHandle(), 5 * min_period);
+	connect_object(StabilizationDesiredHandle(), 5 * min_period);
 
 	// Log slow
 	if (FlightBatteryStateHandle()) {
-		UAVObjConnectCallbackThrottled(FlightBatteryStateHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10 * min_period);
+		connect_object(FlightBatteryStateHandle(), 10 * min_period);
 	}
 	if (BaroAltitudeHandle()) {
-		UAVObjConnectCallbackThrottled(BaroAltitudeHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10 * min_period);
+		connect_object(BaroAltitudeHandle(), 10 * min_period);
 	}
 	if (AirspeedActualHandle()) {
-		UAVObjConnectCallbackThrottled(AirspeedActualHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10 * min_period);
+		connect_object(AirspeedActualHandle(), 10 * min_period);
 	}
 	if (GPSPositionHandle()) {
-		UAVObjConnectCallbackThrottled(GPSPositionHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10 * min_period);
+		connect_object(GPSPositionHandle(), 10 * min_period);
 	}
 	if (PositionActualHandle()) {
-		UAVObjConnectCallbackThrottled(PositionActualHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10 * min_period);
+		connect_object(PositionActualHandle(), 10 * min_period);
 	}
 	if (VelocityActualHandle()) {
-		UAVObjConnectCallbackThrottled(VelocityActualHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 10 * min_period);
+		connect_object(VelocityActualHandle(), 10 * min_period);
 	}
 
 	// Log very slow
 	if (GPSTimeHandle()) {
-		UAVObjConnectCallbackThrottled(GPSTimeHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 50 * min_period);
+		connect_object(GPSTimeHandle(), 50 * min_period);
 	}
 
 	// Log very very slow
 	if (GPSSatellitesHandle()) {
-		UAVObjConnectCallbackThrottled(GPSSatellitesHandle(), obj_updated_callback, NULL, EV_UPDATED | EV_UNPACKED, 500 * min_period);
+		connect_object(GPSSatellitesHandle(), 500 * min_period);
+	}
+}
+
+
+/**
+ * Allocate the schema table and record buffer for the compact format
+ * \return true if they are available
+ */
+static bool compact_alloc()
+{
+	if (!schema_objs) {
+		// Any data object or metaobject may be logged, settings are
+		// data objects too
+		uint16_t num_objs = 2 * (uint16_t)UAVObjCount();
+
+		schema_size = num_objs < LOG_COMPACT_SCHEMA_MAX ?
+			num_objs : LOG_COMPACT_SCHEMA_MAX;
+		schema_objs = PIOS_malloc_no_dma(schema_size * sizeof(*schema_objs));
+	}
+
+	if (!record_buf) {
+		record_buf = PIOS_malloc_no_dma(LOG_COMPACT_RECORD_MAX);
+	}
+
+	return schema_objs && record_buf;
+}
+
+/**
+ * Find where an object is, or belongs, in the schema table.  The table is
+ * kept sorted by handle so the index of an object can be found quickly
+ * for every record.
+ * \param[in] obj Object to look for
+ * \return index of the first entry not below obj
+ */
+static uint16_t schema_lower_bound(UAVObjHandle obj)
+{
+	uint16_t lo = 0;
+	uint16_t hi = schema_count;
+
+	while (lo < hi) {
+		uint16_t mid = (lo + hi) / 2;
+
+		if ((uintptr_t)schema_objs[mid] < (uintptr_t)obj) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/**
+ * Add an object to the schema of the compact log
+ * \param[in] obj Object to add
+ * \return true if the object is in the schema, false (and schema_full set)
+ * if there is no room for it
+ */
+static bool schema_add(UAVObjHandle obj)
+{
+	uint16_t pos = schema_lower_bound(obj);
+
+	if (pos < schema_count && schema_objs[pos] == obj) {
+		return true;
+	}
+
+	if (schema_count >= schema_size) {
+		schema_full = true;
+		return false;
+	}
+
+	memmove(&schema_objs[pos + 1], &schema_objs[pos],
+			(schema_count - pos) * sizeof(*schema_objs));
+	schema_objs[pos] = obj;
+
+	if (log_compress) {
+		uint16_t *history_off = compressor->history_off;
+
+		memmove(&history_off[pos + 1], &history_off[pos],
+				(schema_count - pos) * sizeof(*history_off));
+		history_off[pos] = LOG_NO_HISTORY;
+	}
+
+	schema_count++;
+
+	return true;
+}
+
+/**
+ * Add settings objects to the schema so they can be logged at start
+ * \param[in] obj Object to add
+ */
+static void schema_add_settings(UAVObjHandle obj)
+{
+	if (UAVObjIsSettings(obj)) {
+		schema_add(obj);
+	}
+}
+
+/**
+ * Write the compact log divider and schema
+ */
+static void write_schema()
+{
+	send_data((uint8_t *)LOG_COMPACT_DIVIDER, strlen(LOG_COMPACT_DIVIDER));
+
+	PIOS_Assert(schema_count <= LOG_COMPACT_SCHEMA_MAX);
+
+	uint8_t hdr[2] = {
+		log_compress ? LOG_COMPACT_VERSION_COMPRESSED : LOG_COMPACT_VERSION,
+		schema_count
+	};
+	send_data(hdr, sizeof(hdr));
+
+	for (uint16_t i = 0; i < schema_count; i++) {
+		UAVObjHandle obj = schema_objs[i];
+		uint32_t id = UAVObjGetID(obj);
+		uint32_t size = UAVObjGetNumBytes(obj);
+		uint8_t flags = 0;
+
+		if (!UAVObjIsSingleInstance(obj)) {
+			flags |= LOG_COMPACT_FLAG_MULTI_INSTANCE;
+		}
+
+		if (log_compress && compressor->history_off[i] != LOG_NO_HISTORY) {
+			flags |= LOG_COMPACT_FLAG_DELTA;
+		}
+
+		uint8_t entry[LOG_COMPACT_SCHEMA_ENTRY_LEN] = {
+			id, id >> 8, id >> 16, id >> 24,
+			size, size >> 8,
+			flags,
+		};
+		send_data(entry, sizeof(entry));
 	}
 }
 
+/**
+ * Store an unsigned value in as few bytes as possible, 7 bits at a time
+ * starting from the least significant, the top bit marking that more follow
+ * \param[in] pos Where to put the value
+ * \param[in] val The value
+ * \return the position after the value
+ */
+static uint8_t *put_varint(uint8_t *pos, uint32_t val)
+{
+	while (val >= 0x80) {
+		*pos++ = val | 0x80;
+		val >>= 7;
+	}
+
+	*pos++ = val;
+
+	return pos;
+}
+
+/**
+ * Allocate the compressor.  Must follow compact_alloc(), which sizes the
+ * schema.
+ * \return true if it is available
+ */
+static bool compressor_alloc()
+{
+	if (compressor) {
+		return true;
+	}
+
+	struct log_compressor *c = PIOS_malloc_no_dma(sizeof(*c));
+	if (!c) {
+		return false;
+	}
+
+	c->history_off = PIOS_malloc_no_dma(schema_size * sizeof(*c->history_off));
+	c->lock = c->history_off ? PIOS_Mutex_Create() : NULL;
+
+	if (!c->lock) {
+		if (c->history_off) {
+			PIOS_free(c->history_off);
+		}
+		PIOS_free(c);
+		return false;
+	}
+
+	compressor = c;
+
+	return true;
+}
+
+/**
+ * Start a new compressed log: no data pending and all history zero, which
+ * is where the reader starts too
+ */
+static void compressor_reset()
+{
+	PIOS_Mutex_Lock(compressor->lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	compressor->history_fill = 0;
+	compressor->block_fill = 0;
+	compressor->packed_len = 0;
+	compressor->raw_bytes = 0;
+	compressor->packed_bytes = 0;
+	memset(compressor->history, 0, sizeof(compressor->history));
+
+	PIOS_Mutex_Unlock(compressor->lock);
+}
+
+/**
+ * Keep the previous sample of an object, so that its samples can be delta
+ * coded, while there is room.  Only single instance objects have one.
+ * \param[in] obj Object, already in the schema
+ */
+static void compressor_add_history(UAVObjHandle obj)
+{
+	uint16_t idx = schema_lower_bound(obj);
+	uint16_t size = UAVObjGetNumBytes(obj);
+
+	if (compressor->history_off[idx] != LOG_NO_HISTORY ||
+			!UAVObjIsSingleInstance(obj) ||
+			size > LOG_HISTORY_SIZE - compressor->history_fill) {
+		return;
+	}
+
+	compressor->history_off[idx] = compressor->history_fill;
+	compressor->history_fill += size;
+}
+
+/**
+ * Pack the block being filled, unless the last packed block has not gone
+ * out yet, and try to send the packed block.  Call with the compressor
+ * locked.
+ * \param[in] wait Whether to wait for room to send it
+ */
+static void compressor_pack(bool wait)
+{
+	struct log_compressor *c = compressor;
+
+	if (!c->packed_len && c->block_fill) {
+		uint8_t *data = c->packed + LOG_BLOCK_HEADER_LEN;
+		int32_t len = logcompress_block(c->block, c->block_fill, data,
+				sizeof(c->packed) - LOG_BLOCK_HEADER_LEN, c->hash);
+
+		// Store blocks that do not get any smaller
+		if (len < 0 || len >= c->block_fill) {
+			memcpy(data, c->block, c->block_fill);
+			len = 0;
+		}
+
+		c->packed[0] = c->block_fill;
+		c->packed[1] = c->block_fill >> 8;
+		c->packed[2] = len;
+		c->packed[3] = len >> 8;
+		c->packed_len = LOG_BLOCK_HEADER_LEN + (len ? len : c->block_fill);
+		c->block_fill = 0;
+	}
+
+	if (!c->packed_len) {
+		return;
+	}
+
+	if (wait) {
+		if (send_data(c->packed, c->packed_len) < 0) {
+			return;
+		}
+	} else {
+		if (send_data_nonblock(c->packed, c->packed_len) < 0) {
+			return;
+		}
+		written_bytes += c->packed_len;
+	}
+
+	c->packed_bytes += c->packed_len;
+	c->packed_len = 0;
+}
+
+/**
+ * Add a record to the block being filled, packing and sending the block
+ * first if the record might not fit.  The record is dropped if there is
+ * still no room, leaving the history of its object as it was.
+ * \param[in] idx Index of the object in the schema
+ * \param[in] hdr Record header, followed by the packed object data
+ * \param[in] hdr_len Length of the header
+ * \param[in] size Length of the object data
+ * \return true if the record was added
+ */
+static bool compressor_append(uint16_t idx, const uint8_t *hdr,
+		uint16_t hdr_len, uint16_t size)
+{
+	struct log_compressor *c = compressor;
+	uint16_t hist = c->history_off[idx];
+	uint16_t worst = hdr_len + size;
+	bool added = false;
+
+	if (hist != LOG_NO_HISTORY) {
+		worst += (size + 7) / 8;
+	}
+
+	PIOS_Mutex_Lock(c->lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	if (c->block_fill + worst > LOG_BLOCK_SIZE) {
+		compressor_pack(false);
+	}
+
+	if (c->block_fill + worst <= LOG_BLOCK_SIZE) {
+		uint8_t *pos = c->block + c->block_fill;
+
+		memcpy(pos, hdr, hdr_len);
+		pos += hdr_len;
+
+		if (hist != LOG_NO_HISTORY) {
+			pos += logcompress_delta(hdr + hdr_len, &c->history[hist],
+					size, pos);
+		} else {
+			memcpy(pos, hdr + hdr_len, size);
+			pos += size;
+		}
+
+		c->block_fill = pos - c->block;
+		c->raw_bytes += hdr_len + size;
+		added = true;
+	}
+
+	PIOS_Mutex_Unlock(c->lock);
+
+	return added;
+}
+
+/**
+ * Send what has been gathered so far
+ * \param[in] wait Whether to wait until it is all sent
+ */
+static void compressor_flush(bool wait)
+{
+	PIOS_Mutex_Lock(compressor->lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	// A pending packed block goes first, then the rest is packed
+	compressor_pack(wait);
+	compressor_pack(wait);
+
+	PIOS_Mutex_Unlock(compressor->lock);
+}
+
+/**
+ * Write a compact record of an object.  Records are only written from
+ * the logging task before logging starts and from update callbacks after,
+ * which do not run concurrently, so the record buffer is not locked.
+ * \param[in] obj Object to log
+ * \param[in] instId Instance to log
+ */
+static void log_compact_record(UAVObjHandle obj, uint16_t instId)
+{
+	uint16_t idx = schema_lower_bound(obj);
+
+	if (idx >= schema_count || schema_objs[idx] != obj) {
+		return;
+	}
+
+	uint32_t now = PIOS_Thread_Systime();
+	uint8_t *pos = record_buf;
+
+	*pos++ = idx;
+	pos = put_varint(pos, now - last_record_time);
+
+	if (!UAVObjIsSingleInstance(obj)) {
+		pos = put_varint(pos, instId);
+	}
+
+	if (UAVObjPack(obj, instId, pos) < 0) {
+		return;
+	}
+
+	if (log_compress) {
+		if (compressor_append(idx, record_buf, pos - record_buf,
+					UAVObjGetNumBytes(obj))) {
+			last_record_time = now;
+		}
+
+		return;
+	}
+
+	pos += UAVObjGetNumBytes(obj);
+
+	int32_t len = pos - record_buf;
+	if (send_data_nonblock(record_buf, len) == len) {
+		// Only move the time base on for records that made it out
+		last_record_time = now;
+		written_bytes += len;
+	}
+}
+
+/**
+ * Log the current data of an object in the selected format
+ * \param[in] obj Object to log
+ * \param[in] instId Instance to log
+ */
+static void log_object_data(UAVObjHandle obj, uint16_t instId)
+{
+	if (log_compact) {
+		log_compact_record(obj, instId);
+	} else {
+		UAVTalkSendObjectTimestamped(uavTalkCon, obj, instId, false, 0);
+	}
+}
 
 /**
  * Write log file header
@@ -676,6 +1257,10 @@ static void writeHeader()
 	}
 	tmp_str[pos++] = '\n';
 	send_data((uint8_t*)tmp_str, pos);
+
+	if (log_compact) {
+		write_schema();
+	}
 }
 
 static void updateSettings()
@@ -110,12 +110,12 @@ static void radioRxTask(void *parameters);
 static void PPMInputTask(void *parameters);
 static int32_t UAVTalkSendHandler(uint8_t * buf, int32_t length);
 static int32_t RadioSendHandler(uint8_t * buf, int32_t length);
-static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle,
+static uint16_t ProcessTelemetryStream(UAVTalkConnection inConnectionHandle,
 				   UAVTalkConnection outConnectionHandle,
-				   uint8_t rxbyte);
-static void ProcessRadioStream(UAVTalkConnection inConnectionHandle,
+				   const uint8_t *data, uint16_t length);
+static uint16_t ProcessRadioStream(UAVTalkConnection inConnectionHandle,
 			       UAVTalkConnection outConnectionHandle,
-			       uint8_t rxbyte);
+			       const uint8_t *data, uint16_t length);
 static void objectPersistenceUpdatedCb(UAVObjEvent * objEv, void *ctx,
 				void *obj, int len);
 static void registerObject(UAVObjHandle obj);
@@ -403,11 +403,11 @@ static void radioRxTask( __attribute__ ((unused))
 						   MAX_PORT_DELAY);
 			if (bytes_to_process > 0) {
 				// Pass the data through the UAVTalk parser.
-				for (uint8_t i = 0;
-				     i < bytes_to_process; i++) {
-					ProcessRadioStream(data->radioUAVTalkCon,
+				for (uint16_t i = 0; i < bytes_to_process;) {
+					i += ProcessRadioStream(data->radioUAVTalkCon,
 							   data->telemUAVTalkCon,
-							   serial_data[i]);
+							   &serial_data[i],
+							   bytes_to_process - i);
 				}
 			}
 		} else {
@@ -444,14 +444,13 @@ static void telemetryRxTask( __attribute__ ((unused))
 						   MAX_PORT_DELAY);
 			if (bytes_to_process > 0) {
 				PIOS_LED_Toggle(PIOS_LED_RX);
-				for (uint8_t i = 0; i < bytes_to_process;
-				     i++) {
-					ProcessTelemetryStream(data->
+				for (uint16_t i = 0; i < bytes_to_process;) {
+					i += ProcessTelemetryStream(data->
 							       telemUAVTalkCon,
 							       data->
 							       radioUAVTalkCon,
-							       serial_data
-							       [i]);
+							       &serial_data[i],
+							       bytes_to_process - i);
 				}
 			}
 		} else {
@@ -554,19 +553,23 @@ static int32_t RadioSendHandler(uint8_t * buf, int32_t length)
 
 #define MetaObjectId(x) (x+1)
 /**
- * @brief Process a byte of data received on the telemetry stream
+ * @brief Process data received on the telemetry stream, up to the end of
+ * the first completed packet
  *
  * @param[in] inConnectionHandle  The UAVTalk connection handle on the telemetry port
  * @param[in] outConnectionHandle  The UAVTalk connection handle on the radio port.
- * @param[in] rxbyte  The received byte.
+ * @param[in] data  The received bytes.
+ * @param[in] length  The number of received bytes.
+ * @return The number of bytes used.
  */
-static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle,
+static uint16_t ProcessTelemetryStream(UAVTalkConnection inConnectionHandle,
 				   UAVTalkConnection outConnectionHandle,
-				   uint8_t rxbyte)
+				   const uint8_t *data, uint16_t length)
 {
 	// Keep reading until we receive a completed packet.
-	UAVTalkRxState state =
-	    UAVTalkProcessInputStreamQuiet(inConnectionHandle, rxbyte);
+	UAVTalkRxState state;
+	uint16_t used =
+	    UAVTalkProcessInputBlockQuiet(inConnectionHandle, data, length, &state);
 
 	if (state == UAVTALK_STATE_COMPLETE) {
 		// We only want to unpack certain telemetry objects
@@ -616,22 +619,28 @@ static void ProcessTelemetryStream(UAVTalkConnection inConnectionHandle,
 			break;
 		}
 	}
+
+	return used;
 }
 
 /**
- * @brief Process a byte of data received on the radio data stream.
+ * @brief Process data received on the radio data stream, up to the end of
+ * the first completed packet.
  *
  * @param[in] inConnectionHandle  The UAVTalk connection handle on the radio port.
  * @param[in] outConnectionHandle  The UAVTalk connection handle on the telemetry port.
- * @param[in] rxbyte  The received byte.
+ * @param[in] data  The received bytes.
+ * @param[in] length  The number of received bytes.
+ * @return The number of bytes used.
  */
-static void ProcessRadioStream(UAVTalkConnection inConnectionHandle,
+static uint16_t ProcessRadioStream(UAVTalkConnection inConnectionHandle,
 			       UAVTalkConnection outConnectionHandle,
-			       uint8_t rxbyte)
+			       const uint8_t *data, uint16_t length)
 {
 	// Keep reading until we receive a completed packet.
-	UAVTalkRxState state =
-	    UAVTalkProcessInputStreamQuiet(inConnectionHandle, rxbyte);
+	UAVTalkRxState state;
+	uint16_t used =
+	    UAVTalkProcessInputBlockQuiet(inConnectionHandle, data, length, &state);
 
 	if (state == UAVTALK_STATE_COMPLETE) {
 		// We only want to unpack certain objects from the remote modem
@@ -687,6 +696,8 @@ static void ProcessRadioStream(UAVTalkConnection inConnectionHandle,
 			break;
 		}
 	}
+
+	return used;
 }
 
 /**
@@ -36,6 +36,9 @@
 #include "pios_thread.h"
 #include "pios_queue.h"
 #include "misc_math.h"
+#include "fastloop.h"
+#include "gyrofilter.h"
+#include "tracepoint.h"
 
 #if defined(PIOS_INCLUDE_PX4FLOW)
 #include "pios_px4flow_priv.h"
@@ -62,6 +65,7 @@ extern uintptr_t external_i2c_adapter_id;
 // Private constants
 #define STACK_SIZE_BYTES 1000
 #define TASK_PRIORITY PIOS_THREAD_PRIO_HIGH
+#define FAST_LOOP_TASK_PRIORITY PIOS_THREAD_PRIO_HIGHEST
 #define SENSOR_PERIOD 6		// this allows sensor data to arrive as slow as 166Hz
 #define REQUIRED_GOOD_CYCLES 50
 #define MAX_TIME_BETWEEN_VALID_BARO_DATAS_MS 100*1000  // we allow a pause time of 100 ms between two valid
@@ -77,6 +81,8 @@ enum mag_calibration_algo {
 static void SensorsTask(void *parameters);
 static void settingsUpdatedCb(UAVObjEvent * objEv, void *ctx, void *obj, int len);
 
+static bool receive_gyros(struct pios_sensor_gyro_data *gyros);
+static bool receive_accels(struct pios_sensor_accel_data *accels);
 static void update_accels(struct pios_sensor_accel_data *accel);
 static void update_gyros(struct pios_sensor_gyro_data *gyro);
 static void update_mags(struct pios_sensor_mag_data *mag);
@@ -146,11 +152,16 @@ static int32_t SensorsInitialize(void)
 		|| MagBiasInitialize() == -1 \
 		|| AttitudeSettingsInitialize() == -1 \
 		|| SensorSettingsInitialize() == -1 \
-		|| INSSettingsInitialize() == -1) {
+		|| INSSettingsInitialize() == -1 \
+		|| FastLoopInitialize() == -1 \
+		|| GyroFilterInitialize() == -1) {
 
 		return -1;
 	}
 
+	// This task reads the gyro, so it runs the fast loop if that is selected
+	FastLoopAttachSource();
+
 #if defined (PIOS_INCLUDE_OPTICALFLOW)
 	if (OpticalFlowSettingsInitialize() == -1){
 		return -1;
@@ -206,8 +217,13 @@ static int32_t SensorsStart(void)
 	// Watchdog must be registered before starting task
 	PIOS_WDG_RegisterFlag(PIOS_WDG_SENSORS);
 
-	// Start main task
-	sensorsTaskHandle = PIOS_Thread_Create(SensorsTask, "Sensors", STACK_SIZE_BYTES, NULL, TASK_PRIORITY);
+	// Start main task, with room for stabilization and the mixer when they
+	// run in it
+	if (FastLoopEnabled())
+		sensorsTaskHandle = PIOS_Thread_Create(SensorsTask, "Sensors",
+			STACK_SIZE_BYTES + FASTLOOP_STACK_BYTES, NULL, FAST_LOOP_TASK_PRIORITY);
+	else
+		sensorsTaskHandle = PIOS_Thread_Create(SensorsTask, "Sensors", STACK_SIZE_BYTES, NULL, TASK_PRIORITY);
 	TaskMonitorAdd(TASKINFO_RUNNING_SENSORS, sensorsTaskHandle);
 
 	return 0;
@@ -252,14 +268,16 @@ static void SensorsTask(void *parameters)
 
 		//Block on gyro data but nothing else
 		struct pios_queue *queue;
-		queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_GYRO);
-		if (queue == NULL || PIOS_Queue_Receive(queue, &gyros, SENSOR_PERIOD) == false) {
+		if (!receive_gyros(&gyros)) {
+			FastLoopStall();
 			good_runs = 0;
 			continue;
 		}
 
-		queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_ACCEL);
-		if (queue == NULL || PIOS_Queue_Receive(queue, &accels, 0) == false) {
+		TRACEPOINT(TRACE_GYRO_RECEIVE);
+		FastLoopGyroSample(PIOS_DELAY_GetRaw());
+
+		if (!receive_accels(&accels)) {
 			//If no new accels data is ready, reuse the latest sample
 			AccelsSet(&accelsData);
 		}
@@ -270,6 +288,9 @@ static void SensorsTask(void *parameters)
 		// the accels to be available first
 		update_gyros(&gyros);
 
+		// Run stabilization and the mixer on this sample, if in fast loop mode
+		FastLoopRun();
+
 		queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_MAG);
 		if (queue != NULL && PIOS_Queue_Receive(queue, &mags, 0) != false) {
 			update_mags(&mags);
@@ -330,6 +351,47 @@ static void SensorsTask(void *parameters)
 	}
 }
 
+/**
+ * @brief Get the next gyro data, waiting for it.  With a sample ring this is
+ * the average of every sample that arrived since the last call.
+ * @param[out] gyros The raw gyro data
+ * @return true if there was new data
+ */
+static bool receive_gyros(struct pios_sensor_gyro_data *gyros)
+{
+	if (PIOS_SENSORS_HasRing(PIOS_SENSOR_GYRO)) {
+		struct pios_sensor_sample average;
+		if (!PIOS_SENSORS_ReadAverage(PIOS_SENSOR_GYRO, &average, SENSOR_PERIOD))
+			return false;
+
+		*gyros = average.data.gyro;
+		return true;
+	}
+
+	struct pios_queue *queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_GYRO);
+	return queue != NULL && PIOS_Queue_Receive(queue, gyros, SENSOR_PERIOD);
+}
+
+/**
+ * @brief Get the accel data that arrived along with the gyro data, if any
+ * @param[out] accels The raw accel data
+ * @return true if there was new data
+ */
+static bool receive_accels(struct pios_sensor_accel_data *accels)
+{
+	if (PIOS_SENSORS_HasRing(PIOS_SENSOR_ACCEL)) {
+		struct pios_sensor_sample average;
+		if (!PIOS_SENSORS_ReadAverage(PIOS_SENSOR_ACCEL, &average, 0))
+			return false;
+
+		*accels = average.data.accel;
+		return true;
+	}
+
+	struct pios_queue *queue = PIOS_SENSORS_GetQueue(PIOS_SENSOR_ACCEL);
+	return queue != NULL && PIOS_Queue_Receive(queue, accels, 0);
+}
+
 /**
  * @brief Apply calibration and rotation to the raw accel data
  * @param[in] accels The raw accel data
@@ -417,6 +479,13 @@ static void update_gyros(struct pios_sensor_gyro_data *gyros)
 		}
 	}
 
+	// Remove the motor noise before stabilization sees it
+	float gyros_filtered[3] = { gyrosData.x, gyrosData.y, gyrosData.z };
+	GyroFilterApply(gyros_filtered);
+	gyrosData.x = gyros_filtered[0];
+	gyrosData.y = gyros_filtered[1];
+	gyrosData.z = gyros_filtered[2];
+
 	GyrosSet(&gyrosData);
 }
 
@@ -34,8 +34,11 @@
 #include "systemmod.h"
 #include "sanitycheck.h"
 #include "objectpersistence.h"
+#include "eventdispatcherstats.h"
+#include "eventschedulerstats.h"
 #include "flightstatus.h"
 #include "manualcontrolsettings.h"
+#include "objectmanagerstats.h"
 #include "rfm22bstatus.h"
 #include "stabilizationsettings.h"
 #include "stateestimation.h"
@@ -44,11 +47,16 @@
 #include "taskinfo.h"
 #include "watchdogstatus.h"
 #include "taskmonitor.h"
+#include "tracepoint.h"
 #include "pios_thread.h"
 #include "pios_mutex.h"
 #include "pios_queue.h"
 #include "misc_math.h"
 
+#if defined(PIOS_INCLUDE_LOGFS_SETTINGS)
+#include "pios_flashfs.h"
+#endif
+
 //#define DEBUG_THIS_FILE
 
 #if defined(PIOS_INCLUDE_DEBUG_CONSOLE) && defined(DEBUG_THIS_FILE)
@@ -92,16 +100,30 @@ typedef struct {
  */
 struct PeriodicObjectListStruct {
 	EventCallbackInfo evInfo; /** Event callback information */
-    uint16_t updatePeriodMs; /** Update period in ms or 0 if no periodic updates are needed */
-    int32_t timeToNextUpdateMs; /** Time delay to the next update */
-    struct PeriodicObjectListStruct* next; /** Needed by linked list library (utlist.h) */
+	uint16_t updatePeriodMs; /** Update period in ms or 0 if no periodic updates are needed */
+	uint16_t maxJitterMs; /** Latest this entry has fired since the last jitter report */
+	uint32_t nextUpdateMs; /** System time of the next update */
+	struct PeriodicObjectListStruct* next; /** Needed by linked list library (utlist.h) */
 };
 typedef struct PeriodicObjectListStruct PeriodicObjectList;
 
 // Private types
 
+/*
+ * Periodic entries are kept on a hashed timing wheel: one list per
+ * millisecond slot, an entry living in the slot of the system time it is
+ * next due.  Each wakeup only walks the slots for the milliseconds that
+ * have passed, and within those skips entries due on a later turn of the
+ * wheel.  Entries with no period are parked on their own list.
+ */
+#define WHEEL_SLOTS 64
+#define WHEEL_MASK  (WHEEL_SLOTS - 1)
+
 // Private variables
-static PeriodicObjectList* objList;
+static PeriodicObjectList* wheel[WHEEL_SLOTS];
+static PeriodicObjectList* idleList;
+static uint32_t wheelTime; /** System time up to which the wheel has been processed */
+static uint32_t periodicFired;
 static struct pios_recursive_mutex *mutex;
 static EventStats stats;
 
@@ -118,6 +140,8 @@ static void objectUpdatedCb(UAVObjEvent * ev, void *ctx, void *obj, int len);
 static uint32_t processPeriodicUpdates();
 static int32_t eventPeriodicCreate(UAVObjEvent* ev, UAVObjEventCallback cb, struct pios_queue *queue, uint16_t periodMs);
 static int32_t eventPeriodicUpdate(UAVObjEvent* ev, UAVObjEventCallback cb, struct pios_queue *queue, uint16_t periodMs);
+static PeriodicObjectList* eventPeriodicFind(UAVObjEvent* ev, UAVObjEventCallback cb, struct pios_queue *queue);
+static void eventPeriodicSchedule(PeriodicObjectList* objEntry, uint32_t dueMs);
 
 #ifndef NO_SENSORS
 static void configurationUpdatedCb(UAVObjEvent * ev, void *ctx, void *obj, int len);
@@ -130,6 +154,12 @@ static inline void updateRfm22bStats();
 #if defined(WDG_STATS_DIAGNOSTICS)
 static inline void updateWDGstats();
 #endif
+#ifndef SMALLF1
+static inline void updateSchedulerStats();
+#endif
+#if defined(PIOS_INCLUDE_LOGFS_SETTINGS)
+static void settingsMaintenance();
+#endif
 
 /**
  * Create the module task.
@@ -163,6 +193,8 @@ int32_t SystemModInitialize(void)
 	if (mutex == NULL)
 		return -1;
 
+	wheelTime = PIOS_Thread_Systime();
+
 	// Must registers objects here for system thread because ObjectManager started in OpenPilotInit
 	if (SystemSettingsInitialize() == -1 \
 		|| SystemStatsInitialize() == -1 \
@@ -171,10 +203,20 @@ int32_t SystemModInitialize(void)
 
 		return -1;
 	}
+#ifndef SMALLF1
+	if (ObjectManagerStatsInitialize() == -1
+		|| EventDispatcherStatsInitialize() == -1
+		|| EventSchedulerStatsInitialize() == -1)
+		return -1;
+#endif
 #if defined(DIAG_TASKS)
 	if (TaskInfoInitialize() == -1)
 		return -1;
 #endif
+#if defined(DIAG_TRACE)
+	if (TracepointInitialize() == -1)
+		return -1;
+#endif
 #if defined(WDG_STATS_DIAGNOSTICS)
 	if (WatchdogStatusInitialize() == -1)
 		return -1;
@@ -244,9 +286,33 @@ static void systemTask(void *parameters)
 			// If object persistence is updated call the callback
 			objectUpdatedCb(&ev, NULL, NULL, 0);
 		}
+
+#if defined(PIOS_INCLUDE_LOGFS_SETTINGS)
+		settingsMaintenance();
+#endif
 	}
 }
 
+#if defined(PIOS_INCLUDE_LOGFS_SETTINGS)
+/**
+ * Get the settings filesystem ready for later saves, so they don't have to
+ * erase flash or garbage collect in one go.  Erasing internal flash stalls
+ * the processor, so this is only done while disarmed.
+ */
+static void settingsMaintenance()
+{
+	uint8_t armed;
+	FlightStatusArmedGet(&armed);
+
+	if (armed != FLIGHTSTATUS_ARMED_DISARMED) {
+		return;
+	}
+
+	extern uintptr_t pios_uavo_settings_fs_id;
+	PIOS_FLASHFS_Maintenance(pios_uavo_settings_fs_id);
+}
+#endif
+
 #if defined (PIOS_LED_ALARM)
 /**
  * Indicate there are conditions worth an error LED
@@ -305,6 +371,13 @@ static void systemPeriodicCb(UAVObjEvent *ev, void *ctx, void *obj_data, int len
 	updateWDGstats();
 #endif
 
+#ifndef SMALLF1
+	// Jitter is measured over ~1s windows, matching the telemetry rate
+	if (!(counter & 7)) {
+		updateSchedulerStats();
+	}
+#endif
+
 #if defined(DIAG_TASKS)
 	// Update the task status object
 	TaskMonitorUpdateAll();
@@ -443,6 +516,31 @@ static void updateWDGstats()
 }
 #endif
 
+#ifndef SMALLF1
+/**
+ * Called periodically to report the periodic event scheduler jitter
+ */
+static void updateSchedulerStats()
+{
+	EventSchedulerStatsData schedStats;
+	EventPeriodicJitter worst[EVENTSCHEDULERSTATS_WORSTOBJECTID_NUMELEM];
+
+	uint32_t fired;
+
+	schedStats.Entries = EventPeriodicGetJitter(worst, NELEMENTS(worst),
+		&fired);
+	schedStats.Fired = fired;
+
+	for (int i = 0; i < NELEMENTS(worst); i++) {
+		schedStats.WorstObjectID[i] = worst[i].objId;
+		schedStats.WorstPeriod[i] = worst[i].periodMs;
+		schedStats.WorstJitter[i] = worst[i].maxJitterMs;
+	}
+
+	EventSchedulerStatsSet(&schedStats);
+}
+#endif
+
 #ifdef PIPXTREME
 #define RFM22BSTATUSINST 0
 #else
@@ -630,6 +728,39 @@ static void updateSystemAlarms()
 	EventGetStats(&evStats);
 	UAVObjClearStats();
 	EventClearStats();
+
+#ifndef SMALLF1
+	ObjectManagerStatsData objMgrStats = {
+		.LockAcquisitions = objStats.lockAcquisitions,
+		.LockContended = objStats.lockContended,
+		.LockWaitTotal = objStats.lockWaitTotalUs,
+		.LockWaitMax = objStats.lockWaitMaxUs,
+		.SeqLockReads = objStats.seqlockReads,
+		.SeqLockRetries = objStats.seqlockRetries,
+	};
+	ObjectManagerStatsSet(&objMgrStats);
+
+	UAVObjEventStats objEvStats;
+	UAVObjGetEventStats(&objEvStats);
+
+	EventDispatcherStatsData dispatcherStats = {
+		.Dispatched = objEvStats.dispatched,
+		.Coalesced = objEvStats.coalesced,
+		.Suppressed = objEvStats.suppressed,
+		.Dropped = objEvStats.dropped,
+		.BacklogDepth = objEvStats.depth,
+		.BacklogHighWater = objEvStats.highWater,
+	};
+
+	for (int i = 0; i < EVENTDISPATCHERSTATS_DROPPEDOBJECTID_NUMELEM &&
+			i < UAVO_EVENT_DROP_SLOTS; i++) {
+		dispatcherStats.DroppedObjectID[i] = objEvStats.dropObjIds[i];
+		dispatcherStats.DroppedObjectCount[i] = objEvStats.dropCounts[i];
+	}
+
+	EventDispatcherStatsSet(&dispatcherStats);
+#endif
+
 	if (objStats.eventCallbackErrors > 0 || objStats.eventQueueErrors > 0  || evStats.eventErrors > 0) {
 		AlarmsSet(SYSTEMALARMS_ALARM_EVENTSYSTEM, SYSTEMALARMS_ALARM_WARNING);
 	} else {
@@ -731,6 +862,44 @@ int32_t EventPeriodicQueueUpdate(UAVObjEvent* ev, struct pios_queue *queue, uint
 	return eventPeriodicUpdate(ev, 0, queue, periodMs);
 }
 
+/**
+ * Find the periodic entry matching an event, callback and queue.
+ * Must be called with the lock held.
+ */
+static PeriodicObjectList* eventPeriodicFind(UAVObjEvent* ev, UAVObjEventCallback cb, struct pios_queue *queue)
+{
+	for (int i = -1; i < WHEEL_SLOTS; i++) {
+		PeriodicObjectList* objEntry;
+
+		LL_FOREACH((i < 0) ? idleList : wheel[i], objEntry) {
+			if (objEntry->evInfo.cb == cb &&
+				objEntry->evInfo.queue == queue &&
+				objEntry->evInfo.ev.obj == ev->obj &&
+				objEntry->evInfo.ev.instId == ev->instId &&
+				objEntry->evInfo.ev.event == ev->event) {
+				return objEntry;
+			}
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * Put an entry (not currently on any list) on the wheel, or on the idle
+ * list if it has no period.  Must be called with the lock held.
+ */
+static void eventPeriodicSchedule(PeriodicObjectList* objEntry, uint32_t dueMs)
+{
+	objEntry->nextUpdateMs = dueMs;
+
+	if (objEntry->updatePeriodMs > 0) {
+		LL_PREPEND(wheel[dueMs & WHEEL_MASK], objEntry);
+	} else {
+		LL_PREPEND(idleList, objEntry);
+	}
+}
+
 /**
  * Dispatch an event through a callback at periodic intervals.
  * \param[in] ev The event to be dispatched
@@ -745,34 +914,30 @@ static int32_t eventPeriodicCreate(UAVObjEvent* ev, UAVObjEventCallback cb, stru
 	// Get lock
 	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
 	// Check that the object is not already connected
-	LL_FOREACH(objList, objEntry)
-	{
-		if (objEntry->evInfo.cb == cb &&
-			objEntry->evInfo.queue == queue &&
-			objEntry->evInfo.ev.obj == ev->obj &&
-			objEntry->evInfo.ev.instId == ev->instId &&
-			objEntry->evInfo.ev.event == ev->event)
-		{
-			// Already registered, do nothing
-			PIOS_Recursive_Mutex_Unlock(mutex);
-			return -1;
-		}
+	if (eventPeriodicFind(ev, cb, queue)) {
+		// Already registered, do nothing
+		PIOS_Recursive_Mutex_Unlock(mutex);
+		return -1;
 	}
-    // Create handle
+	// Create handle
 	objEntry = (PeriodicObjectList*)PIOS_malloc_no_dma(sizeof(PeriodicObjectList));
-	if (objEntry == NULL) return -1;
+	if (objEntry == NULL) {
+		PIOS_Recursive_Mutex_Unlock(mutex);
+		return -1;
+	}
 	objEntry->evInfo.ev.obj = ev->obj;
 	objEntry->evInfo.ev.instId = ev->instId;
 	objEntry->evInfo.ev.event = ev->event;
 	objEntry->evInfo.cb = cb;
 	objEntry->evInfo.queue = queue;
-    objEntry->updatePeriodMs = periodMs;
-    objEntry->timeToNextUpdateMs = randomize_int(periodMs); // avoid bunching of updates
-    // Add to list
-    LL_APPEND(objList, objEntry);
+	objEntry->updatePeriodMs = periodMs;
+	objEntry->maxJitterMs = 0;
+	// Add to the wheel, randomized to avoid bunching of updates
+	eventPeriodicSchedule(objEntry,
+		PIOS_Thread_Systime() + 1 + randomize_int(periodMs));
 	// Release lock
 	PIOS_Recursive_Mutex_Unlock(mutex);
-    return 0;
+	return 0;
 }
 
 /**
@@ -785,92 +950,161 @@ static int32_t eventPeriodicCreate(UAVObjEvent* ev, UAVObjEventCallback cb, stru
  */
 static int32_t eventPeriodicUpdate(UAVObjEvent* ev, UAVObjEventCallback cb, struct pios_queue *queue, uint16_t periodMs)
 {
-	PeriodicObjectList* objEntry;
 	// Get lock
 	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
 	// Find object
-	LL_FOREACH(objList, objEntry)
-	{
-		if (objEntry->evInfo.cb == cb &&
-			objEntry->evInfo.queue == queue &&
-			objEntry->evInfo.ev.obj == ev->obj &&
-			objEntry->evInfo.ev.instId == ev->instId &&
-			objEntry->evInfo.ev.event == ev->event)
-		{
-			// Object found, update period
-			objEntry->updatePeriodMs = periodMs;
-			objEntry->timeToNextUpdateMs = randomize_int(periodMs); // avoid bunching of updates
-			// Release lock
-			PIOS_Recursive_Mutex_Unlock(mutex);
-			return 0;
-		}
+	PeriodicObjectList* objEntry = eventPeriodicFind(ev, cb, queue);
+	if (objEntry == NULL) {
+		// If this point is reached the object was not found
+		PIOS_Recursive_Mutex_Unlock(mutex);
+		return -1;
 	}
-    // If this point is reached the object was not found
+	// Move it to its new slot, randomized to avoid bunching of updates
+	if (objEntry->updatePeriodMs > 0) {
+		LL_DELETE(wheel[objEntry->nextUpdateMs & WHEEL_MASK], objEntry);
+	} else {
+		LL_DELETE(idleList, objEntry);
+	}
+	objEntry->updatePeriodMs = periodMs;
+	eventPeriodicSchedule(objEntry,
+		PIOS_Thread_Systime() + 1 + randomize_int(periodMs));
+	// Release lock
 	PIOS_Recursive_Mutex_Unlock(mutex);
-    return -1;
+	return 0;
 }
 
-/* It can take this long before a "first callback" on a registration,
- * so it's advantageous for it to not be too long.  (e.g. we don't have a
- * mechanism to wakeup on list change */
-#define MAX_UPDATE_PERIOD_MS 350
+/**
+ * Report the periodic entries that fired latest since the last report,
+ * worst first, and start a new measurement window.
+ * \param[out] worst Array to receive the entries
+ * \param[in] maxEntries Size of worst
+ * \param[out] fired Periodic events dispatched since boot
+ * \return Number of periodic entries registered
+ */
+uint16_t EventPeriodicGetJitter(EventPeriodicJitter* worst, uint8_t maxEntries,
+		uint32_t* fired)
+{
+	uint16_t numEntries = 0;
+
+	memset(worst, 0, maxEntries * sizeof(*worst));
+
+	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+
+	for (int i = -1; i < WHEEL_SLOTS; i++) {
+		PeriodicObjectList* objEntry;
+
+		LL_FOREACH((i < 0) ? idleList : wheel[i], objEntry) {
+			numEntries++;
+
+			/* Insertion into the (short) sorted array */
+			int pos = maxEntries;
+			while (pos > 0 && worst[pos - 1].maxJitterMs < objEntry->maxJitterMs) {
+				if (pos < maxEntries) {
+					worst[pos] = worst[pos - 1];
+				}
+				pos--;
+			}
+
+			if (pos < maxEntries) {
+				worst[pos] = (EventPeriodicJitter) {
+					.objId = objEntry->evInfo.ev.obj ?
+						UAVObjGetID(objEntry->evInfo.ev.obj) : 0,
+					.periodMs = objEntry->updatePeriodMs,
+					.maxJitterMs = objEntry->maxJitterMs,
+				};
+			}
+
+			objEntry->maxJitterMs = 0;
+		}
+	}
+
+	*fired = periodicFired;
+
+	PIOS_Recursive_Mutex_Unlock(mutex);
+
+	return numEntries;
+}
 
 /**
  * Handle periodic updates for all objects.
- * \return The system time until the next update (in ms) or -1 if failed
+ * \return The system time until the next update (in ms)
  */
 static uint32_t processPeriodicUpdates()
 {
-	PeriodicObjectList* objEntry;
-	int32_t timeNow;
-    int32_t offset;
-
 	// Get lock
 	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
 
-    // Iterate through each object and update its timer, if zero then transmit object.
-    // Also calculate smallest delay to next update.
-    uint32_t now = PIOS_Thread_Systime();
-    uint32_t timeToNextUpdate = PIOS_Thread_Systime() + MAX_UPDATE_PERIOD_MS;
-    LL_FOREACH(objList, objEntry)
-    {
-        // If object is configured for periodic updates
-        if (objEntry->updatePeriodMs > 0)
-        {
-            // Check if time for the next update
-        	timeNow = PIOS_Thread_Systime();
-            if (objEntry->timeToNextUpdateMs <= timeNow)
-            {
-                // Reset timer
-            	offset = ( timeNow - objEntry->timeToNextUpdateMs ) % objEntry->updatePeriodMs;
-            	objEntry->timeToNextUpdateMs = timeNow + objEntry->updatePeriodMs - offset;
-    			// Invoke callback, if one
-    			if ( objEntry->evInfo.cb != 0)
-    			{
+	uint32_t now = PIOS_Thread_Systime();
+
+	// Walk the slot of every millisecond since the last pass (or the
+	// whole wheel once, if we are a full turn or more behind).
+	uint32_t ticks = now - wheelTime;
+	if (ticks > WHEEL_SLOTS) {
+		ticks = WHEEL_SLOTS;
+	}
+
+	for (uint32_t t = 1; t <= ticks; t++) {
+		PeriodicObjectList** slot = &wheel[(now - ticks + t) & WHEEL_MASK];
+		PeriodicObjectList* objEntry = *slot;
+
+		while (objEntry) {
+			// Entries hashed here for a later turn of the wheel
+			if ((int32_t) (objEntry->nextUpdateMs - now) > 0) {
+				objEntry = objEntry->next;
+				continue;
+			}
+
+			// Due; take it off the wheel and put it back at its next
+			// update, keeping its phase
+			LL_DELETE(*slot, objEntry);
+
+			uint32_t late = now - objEntry->nextUpdateMs;
+			if (late > objEntry->maxJitterMs) {
+				objEntry->maxJitterMs = MIN(late, UINT16_MAX);
+			}
+			periodicFired++;
+
+			eventPeriodicSchedule(objEntry, now +
+				objEntry->updatePeriodMs - late % objEntry->updatePeriodMs);
+
+			// Invoke callback, if one
+			if (objEntry->evInfo.cb != 0) {
 				objEntry->evInfo.cb(&objEntry->evInfo.ev, NULL, NULL, 0); // the function is expected to copy the event information
-    			}
-    			// Push event to queue, if one
-    			if ( objEntry->evInfo.queue != 0)
-    			{
-    				if (PIOS_Queue_Send(objEntry->evInfo.queue, &objEntry->evInfo.ev, 0) != true ) // do not block if queue is full
-    				{
-						if (objEntry->evInfo.ev.obj != NULL)
-							stats.lastErrorID = UAVObjGetID(objEntry->evInfo.ev.obj);
-    					++stats.eventErrors;
-    				}
-    			}
-            }
-            // Update minimum delay
-            if (objEntry->timeToNextUpdateMs < timeToNextUpdate)
-            {
-            	timeToNextUpdate = objEntry->timeToNextUpdateMs;
-            }
-        }
-    }
+			}
+			// Push event to queue, if one
+			if (objEntry->evInfo.queue != 0) {
+				if (PIOS_Queue_Send(objEntry->evInfo.queue, &objEntry->evInfo.ev, 0) != true) { // do not block if queue is full
+					if (objEntry->evInfo.ev.obj != NULL)
+						stats.lastErrorID = UAVObjGetID(objEntry->evInfo.ev.obj);
+					++stats.eventErrors;
+				}
+			}
+
+			// The callback may have added or moved entries, so start
+			// over on this slot; everything fired is now in the future
+			objEntry = *slot;
+		}
+	}
 
-    // Done
-    PIOS_Recursive_Mutex_Unlock(mutex);
-    return timeToNextUpdate - now;
+	wheelTime = now;
+
+	// Sleep until the first slot holding an entry due on this turn.
+	uint32_t timeToNextUpdate = WHEEL_SLOTS;
+
+	for (uint32_t t = 1; t < WHEEL_SLOTS; t++) {
+		PeriodicObjectList* objEntry;
+
+		LL_FOREACH(wheel[(now + t) & WHEEL_MASK], objEntry) {
+			if ((int32_t) (objEntry->nextUpdateMs - (now + t)) <= 0) {
+				timeToNextUpdate = t;
+				goto done;
+			}
+		}
+	}
+
+done:
+	PIOS_Recursive_Mutex_Unlock(mutex);
+	return timeToNextUpdate;
 }
 
 /**
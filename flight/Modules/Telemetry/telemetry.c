@@ -53,6 +53,7 @@
 #define STATS_UPDATE_PERIOD_MS 4000
 #define CONNECTION_TIMEOUT_MS 8000
 #define USB_ACTIVITY_TIMEOUT_MS 6000
+#define BATCH_HOLD_MS 2
 
 // Private types
 
@@ -132,6 +133,7 @@ int32_t TelemetryInitialize(void)
 
 	// Initialise UAVTalk
 	uavTalkCon = UAVTalkInitialize(&transmitData);
+	UAVTalkSetOutputCom(uavTalkCon, &getComPort);
 
 	if (SessionManagingInitialize() == -1) {
 		return -1;
@@ -263,6 +265,12 @@ static void processObjEvent(UAVObjEvent * ev)
 		success = -1;
 		if (ev->event == EV_UPDATED || ev->event == EV_UPDATED_MANUAL ||
 				ev->event == EV_UPDATED_PERIODIC) {
+			// Unacked updates can share a frame with others
+			if (!UAVObjGetTelemetryAcked(&metadata)) {
+				success = UAVTalkSendObjectBatched(uavTalkCon, ev->obj, ev->instId);
+				retries = 1;
+			}
+
 			// Send update to GCS (with retries)
 			while (retries < MAX_RETRIES && success == -1) {
 				success = UAVTalkSendObject(uavTalkCon, ev->obj, ev->instId, UAVObjGetTelemetryAcked(&metadata), REQ_TIMEOUT_MS);	// call blocks until ack is received or timeout
@@ -295,10 +303,16 @@ static void telemetryTxTask(void *parameters)
 
 	// Loop forever
 	while (1) {
-		// Wait for queue message
-		if (PIOS_Queue_Receive(queue, &ev, PIOS_QUEUE_TIMEOUT_MAX) == true) {
+		// Wait for queue message, briefly if updates are waiting to be
+		// sent so that a burst of them goes out in one frame
+		uint32_t timeout = UAVTalkBatchPending(uavTalkCon) ?
+			BATCH_HOLD_MS : PIOS_QUEUE_TIMEOUT_MAX;
+
+		if (PIOS_Queue_Receive(queue, &ev, timeout) == true) {
 			// Process event
 			processObjEvent(&ev);
+		} else {
+			UAVTalkFlushBatch(uavTalkCon);
 		}
 	}
 }
@@ -360,14 +374,12 @@ static void telemetryRxTask(void *parameters)
 
 		if (inputPort) {
 			// Block until data are available
-			uint8_t serial_data[16];
+			uint8_t serial_data[64];
 			uint16_t bytes_to_process;
 
 			bytes_to_process = PIOS_COM_ReceiveBuffer(inputPort, serial_data, sizeof(serial_data), 500);
 			if (bytes_to_process > 0) {
-				for (uint8_t i = 0; i < bytes_to_process; i++) {
-					UAVTalkProcessInputStream(uavTalkCon,serial_data[i]);
-				}
+				UAVTalkProcessInputBlock(uavTalkCon, serial_data, bytes_to_process);
 
 #if defined(PIOS_INCLUDE_USB)
 				if (inputPort == PIOS_COM_TELEM_USB) {
@@ -506,6 +518,12 @@ static void updateTelemetryStats()
 		flightStats.Status = FLIGHTTELEMETRYSTATS_STATUS_DISCONNECTED;
 	}
 
+	// The next GCS to connect has to offer batch frames and deltas again
+	if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_DISCONNECTED) {
+		UAVTalkDisableBatching(uavTalkCon);
+		UAVTalkDisableDeltas(uavTalkCon);
+	}
+
 	// Update the telemetry alarm
 	if (flightStats.Status == FLIGHTTELEMETRYSTATS_STATUS_CONNECTED) {
 		AlarmsClear(SYSTEMALARMS_ALARM_TELEMETRY);
@@ -382,6 +382,80 @@ int32_t PIOS_COM_SendBuffer(uintptr_t com_id, const uint8_t *buffer, uint16_t le
 	return sent;
 }
 
+/**
+* Reserves contiguous space in the transmit buffer, so that a packet can be
+* built in place rather than copied in.  Succeeds only when all of len fits
+* without wrapping; the reservation must be ended with
+* PIOS_COM_CommitTxBuffer() before anything else is sent on the port.
+* \param[in] port COM port
+* \param[in] len number of bytes needed
+* \return pointer to len bytes of buffer space
+* \return NULL if the port is unavailable, busy or the space is not contiguous
+*/
+uint8_t *PIOS_COM_ReserveTxBuffer(uintptr_t com_id, uint16_t len)
+{
+	struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+	if (!PIOS_COM_validate(com_dev) || !com_dev->tx) {
+		return NULL;
+	}
+
+#if defined(PIOS_INCLUDE_FREERTOS) || defined(PIOS_INCLUDE_CHIBIOS)
+	if (PIOS_Mutex_Lock(com_dev->sendbuffer_mtx, 0) != true) {
+		return NULL;
+	}
+#endif /* defined(PIOS_INCLUDE_FREERTOS) || defined(PIOS_INCLUDE_CHIBIOS) */
+
+	uint16_t contig;
+	uint8_t *buf = circ_queue_write_pos(com_dev->tx, &contig, NULL);
+
+	if (len == 0 || len > contig) {
+#if defined(PIOS_INCLUDE_FREERTOS) || defined(PIOS_INCLUDE_CHIBIOS)
+		PIOS_Mutex_Unlock(com_dev->sendbuffer_mtx);
+#endif /* PIOS_INCLUDE_FREERTOS */
+		return NULL;
+	}
+
+	return buf;
+}
+
+/**
+* Hands bytes written into space from PIOS_COM_ReserveTxBuffer() to the
+* device and ends the reservation.
+* \param[in] port COM port
+* \param[in] len number of bytes written, 0 to send nothing
+* \return -1 if port not available
+* \return number of bytes transmitted on success
+*/
+int32_t PIOS_COM_CommitTxBuffer(uintptr_t com_id, uint16_t len)
+{
+	struct pios_com_dev *com_dev = (struct pios_com_dev *)com_id;
+
+	if (!PIOS_COM_validate(com_dev) || !com_dev->tx) {
+		return -1;
+	}
+
+	if (com_dev->driver->available && !com_dev->driver->available(com_dev->lower_id)) {
+		/* Device went away, behave as a data sink like the send calls */
+		circ_queue_clear(com_dev->tx);
+	} else if (len > 0) {
+		circ_queue_advance_write_multi(com_dev->tx, len);
+
+		if (com_dev->driver->tx_start) {
+			uint16_t tx_avail;
+
+			circ_queue_read_pos(com_dev->tx, NULL, &tx_avail);
+			com_dev->driver->tx_start(com_dev->lower_id,
+						  tx_avail);
+		}
+	}
+
+#if defined(PIOS_INCLUDE_FREERTOS) || defined(PIOS_INCLUDE_CHIBIOS)
+	PIOS_Mutex_Unlock(com_dev->sendbuffer_mtx);
+#endif /* PIOS_INCLUDE_FREERTOS */
+	return len;
+}
+
 /**
 * Sends a single character over given port
 * \param[in] port COM port
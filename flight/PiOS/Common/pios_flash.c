@@ -242,6 +242,27 @@ int32_t PIOS_FLASH_get_partition_size(uintptr_t partition_id, uint32_t *partitio
 	return 0;
 }
 
+/**
+ * @brief Gets the largest unit that can be written to a partition in one request
+ * @param[in] partition_id opaque handle for a specific partition
+ * @param[out] page_size size of a page of the underlying chip in bytes
+ * @return 0 if success or error code
+ * @retval -20 if partition_id is not a valid partition identifier
+ */
+int32_t PIOS_FLASH_get_page_size(uintptr_t partition_id, uint32_t *page_size)
+{
+	PIOS_Assert(page_size);
+
+	struct pios_flash_partition *partition = (struct pios_flash_partition *)partition_id;
+
+	if (!PIOS_FLASH_validate_partition(partition))
+		return -20;
+
+	*page_size = partition->chip_desc->page_size;
+
+	return 0;
+}
+
 /**
  * @brief Start an atomic transaction on the flash chip underlying this partition
  * @param[in] partition_id opaque handle for a specific partition
@@ -32,6 +32,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>		/* NULL */
+#include <string.h>		/* memset */
 
 #define MIN(x,y) ((x) < (y) ? (x) : (y))
 
@@ -59,6 +60,34 @@ struct logfs_state {
 	/* Underlying flash partition handle */
 	uintptr_t partition_id;
 	uint32_t partition_size;
+
+	/* Index of the active slots, NULL if it couldn't be allocated */
+	struct logfs_index_entry *index;
+	uint16_t index_mask;
+
+	/* Garbage collection into the spare arena, which follows the active one */
+	bool spare_erased;	/* spare arena is erased and can be reserved */
+	bool gc_active;		/* active slots are being copied to the spare arena */
+	uint16_t gc_src_slot;	/* next slot of the active arena to copy */
+	uint16_t gc_dst_slot;	/* next free slot of the spare arena */
+
+	/* Buffer for copying slots, one flash page long; NULL to copy in small blocks */
+	uint8_t *copy_buf;
+	uint16_t copy_buf_size;
+};
+
+/*
+ * The index is an open addressed hash table from (obj_id, obj_inst_id) to
+ * the slot holding the active copy.  Only a 16 bit hash of the key is kept,
+ * so every hit is confirmed against the slot header in flash; that read is
+ * needed anyway to load or obsolete the slot.  The table has at least as
+ * many entries as the arena has slots, so there is always a free entry to
+ * end a probe.
+ */
+struct logfs_index_entry {
+	uint16_t slot_id;	/* 0 (the arena header) marks a free entry */
+	uint16_t hash;
+	uint16_t gc_slot_id;	/* copy in the spare arena during collection, or 0 */
 };
 
 /*
@@ -244,7 +273,7 @@ static int32_t logfs_obsolete_arena(const struct logfs_state *logfs, uint8_t are
 	uintptr_t arena_addr = logfs_get_addr (logfs, arena_id, 0);
 
 	/* We shouldn't be retiring the currently active arena */
-	PIOS_Assert(!logfs->mounted);
+	PIOS_Assert(!logfs->mounted || arena_id != logfs->active_arena_id);
 
 	/* Make sure this arena was previously active */
 	struct arena_header arena_hdr;
@@ -307,6 +336,38 @@ static int32_t logfs_find_active_arena(const struct logfs_state *logfs)
 	return -1;
 }
 
+/**
+ * @brief Return the arena that the next garbage collection will fill
+ */
+static uint8_t logfs_spare_arena_id(const struct logfs_state *logfs)
+{
+	return (logfs->active_arena_id + 1) % (logfs->partition_size / logfs->cfg->arena_size);
+}
+
+/**
+ * @brief Check whether the spare arena is erased, so garbage collection can
+ * skip erasing it
+ * @return 0 if success, < 0 on failure
+ * @note Must be called while holding the flash transaction lock
+ */
+static int32_t logfs_check_spare_arena(struct logfs_state *logfs)
+{
+	uintptr_t arena_addr = logfs_get_addr (logfs, logfs_spare_arena_id(logfs), 0);
+
+	struct arena_header arena_hdr;
+	if (PIOS_FLASH_read_data(logfs->partition_id,
+					arena_addr,
+					(uint8_t *)&arena_hdr,
+					sizeof (arena_hdr)) != 0) {
+		return -1;
+	}
+
+	logfs->spare_erased = (arena_hdr.state == ARENA_STATE_ERASED) &&
+		(arena_hdr.magic == logfs->cfg->fs_magic);
+
+	return 0;
+}
+
 /*
  * The bits within these enum values must progress ONLY
  * from 1 -> 0 so that we can write later ones on top
@@ -335,17 +396,26 @@ struct slot_header {
 	uint16_t obj_size;
 } __attribute__((packed));
 
+#define RAW_COPY_BLOCK_SIZE 16
+
 /* NOTE: Must be called while holding the flash transaction lock */
 static int32_t logfs_raw_copy_bytes (const struct logfs_state *logfs, uintptr_t src_addr, uint16_t src_size, uintptr_t dst_addr)
 {
-#define RAW_COPY_BLOCK_SIZE 16
-	uint8_t data_block[RAW_COPY_BLOCK_SIZE];
+	uint8_t small_block[RAW_COPY_BLOCK_SIZE];
+
+	/* Copy whole flash pages when there's a buffer for them */
+	uint8_t *data_block = small_block;
+	uint16_t block_size = RAW_COPY_BLOCK_SIZE;
+	if (logfs->copy_buf) {
+		data_block = logfs->copy_buf;
+		block_size = logfs->copy_buf_size;
+	}
 
 	while (src_size) {
 		uint16_t blk_size;
-		if (src_size >= RAW_COPY_BLOCK_SIZE) {
+		if (src_size >= block_size) {
 			/* Copy a full block */
-			blk_size = RAW_COPY_BLOCK_SIZE;
+			blk_size = block_size;
 		} else {
 			/* Copy the remainder */
 			blk_size = src_size;
@@ -398,6 +468,87 @@ static bool logfs_log_is_full(const struct logfs_state *logfs)
 	return (logfs->num_free_slots == 0);
 }
 
+/*
+ * Slot index maintenance
+ */
+
+static uint16_t logfs_index_hash(uint32_t obj_id, uint16_t obj_inst_id)
+{
+	uint32_t h = (obj_id ^ (obj_inst_id * 0x9E3779B1U)) * 0x85EBCA6BU;
+
+	return (h >> 16) ^ (h & 0xFFFF);
+}
+
+static void logfs_index_clear(struct logfs_state *logfs)
+{
+	if (!logfs->index) return;
+
+	memset(logfs->index, 0, (logfs->index_mask + 1) * sizeof(*logfs->index));
+}
+
+/**
+ * @brief Find the index entry for an object stored in a particular slot
+ * @return the entry or NULL if there is no such entry
+ */
+static struct logfs_index_entry *logfs_index_lookup(struct logfs_state *logfs, uint32_t obj_id, uint16_t obj_inst_id, uint16_t slot_id)
+{
+	if (!logfs->index) return NULL;
+
+	uint16_t pos = logfs_index_hash(obj_id, obj_inst_id) & logfs->index_mask;
+	while (logfs->index[pos].slot_id != slot_id) {
+		if (logfs->index[pos].slot_id == 0) {
+			/* Not indexed */
+			return NULL;
+		}
+		pos = (pos + 1) & logfs->index_mask;
+	}
+
+	return &logfs->index[pos];
+}
+
+static void logfs_index_insert(struct logfs_state *logfs, uint32_t obj_id, uint16_t obj_inst_id, uint16_t slot_id)
+{
+	if (!logfs->index) return;
+
+	uint16_t hash = logfs_index_hash(obj_id, obj_inst_id);
+	uint16_t pos = hash & logfs->index_mask;
+
+	while (logfs->index[pos].slot_id != 0) {
+		pos = (pos + 1) & logfs->index_mask;
+	}
+
+	logfs->index[pos].slot_id    = slot_id;
+	logfs->index[pos].hash       = hash;
+	logfs->index[pos].gc_slot_id = 0;
+}
+
+static void logfs_index_remove(struct logfs_state *logfs, struct logfs_index_entry *entry)
+{
+	const uint16_t mask = logfs->index_mask;
+
+	uint16_t pos = entry - logfs->index;
+
+	/*
+	 * Close the hole by pulling back any later entries of the probe run
+	 * that can't be reached from their home position past it.
+	 */
+	uint16_t next = pos;
+	while (true) {
+		next = (next + 1) & mask;
+		if (logfs->index[next].slot_id == 0) {
+			break;
+		}
+
+		uint16_t home = logfs->index[next].hash & mask;
+		if (((next - home) & mask) >= ((next - pos) & mask)) {
+			logfs->index[pos] = logfs->index[next];
+			pos = next;
+		}
+	}
+
+	logfs->index[pos].slot_id = 0;
+}
+
 static int32_t logfs_unmount_log(struct logfs_state *logfs)
 {
 	PIOS_Assert (logfs->mounted);
@@ -405,6 +556,9 @@ static int32_t logfs_unmount_log(struct logfs_state *logfs)
 	logfs->num_active_slots = 0;
 	logfs->num_free_slots   = 0;
 	logfs->mounted          = false;
+	logfs->gc_active        = false;
+
+	logfs_index_clear(logfs);
 
 	return 0;
 }
@@ -416,8 +570,11 @@ static int32_t logfs_mount_log(struct logfs_state *logfs, uint8_t arena_id)
 	logfs->num_active_slots = 0;
 	logfs->num_free_slots   = 0;
 	logfs->active_arena_id  = arena_id;
+	logfs->gc_active        = false;
+
+	logfs_index_clear(logfs);
 
-	/* Scan the log to find out how full it is */
+	/* Scan the log to find out how full it is and index the active slots */
 	for (uint16_t slot_id = 1;
 	     slot_id < (logfs->cfg->arena_size / logfs->cfg->slot_size);
 	     slot_id++) {
@@ -443,6 +600,7 @@ static int32_t logfs_mount_log(struct logfs_state *logfs, uint8_t arena_id)
 			break;
 		case SLOT_STATE_ACTIVE:
 			logfs->num_active_slots++;
+			logfs_index_insert(logfs, slot_hdr.obj_id, slot_hdr.obj_inst_id, slot_id);
 			break;
 		case SLOT_STATE_RESERVED:
 		case SLOT_STATE_OBSOLETE:
@@ -454,6 +612,11 @@ static int32_t logfs_mount_log(struct logfs_state *logfs, uint8_t arena_id)
 	logfs->active_arena_id = arena_id;
 	logfs->mounted = true;
 
+	/* See whether the spare arena was left erased */
+	if (logfs_check_spare_arena(logfs) != 0) {
+		return -2;
+	}
+
 	return 0;
 }
 
@@ -470,15 +633,70 @@ static struct logfs_state *PIOS_FLASHFS_Logfs_alloc(void)
 	if (!logfs) return (NULL);
 
 	logfs->magic = PIOS_FLASHFS_LOGFS_DEV_MAGIC;
+	logfs->index = NULL;
+	logfs->copy_buf = NULL;
+	logfs->spare_erased = false;
+	logfs->gc_active = false;
 	return(logfs);
 }
 static void PIOS_FLASHFS_Logfs_free(struct logfs_state *logfs)
 {
 	/* Invalidate the magic */
 	logfs->magic = ~PIOS_FLASHFS_LOGFS_DEV_MAGIC;
+	if (logfs->index) {
+		PIOS_free(logfs->index);
+	}
+	if (logfs->copy_buf) {
+		PIOS_free(logfs->copy_buf);
+	}
 	PIOS_free(logfs);
 }
 
+/**
+ * @brief Allocate the slot index, sized to the next power of two that holds
+ * every slot in the arena
+ * @note Without an index all lookups fall back to scanning the log
+ */
+static void PIOS_FLASHFS_Logfs_alloc_index(struct logfs_state *logfs)
+{
+	uint32_t num_slots = logfs->cfg->arena_size / logfs->cfg->slot_size;
+	uint32_t num_entries = 1;
+
+	while (num_entries < num_slots) {
+		num_entries <<= 1;
+	}
+
+	logfs->index = (struct logfs_index_entry *)PIOS_malloc_no_dma(num_entries * sizeof(*logfs->index));
+	if (!logfs->index) return;
+
+	logfs->index_mask = num_entries - 1;
+	logfs_index_clear(logfs);
+}
+
+/**
+ * @brief Allocate a buffer of one flash page, so garbage collection copies
+ * slots with as few reads and writes as the flash allows
+ * @note Without a buffer slots are copied in small blocks from the stack
+ */
+static void PIOS_FLASHFS_Logfs_alloc_copy_buf(struct logfs_state *logfs)
+{
+	uint32_t page_size;
+	if (PIOS_FLASH_get_page_size(logfs->partition_id, &page_size) != 0) {
+		return;
+	}
+
+	/* Never more than a slot, the most that is copied at once */
+	page_size = MIN(page_size, logfs->cfg->slot_size);
+	if (page_size <= RAW_COPY_BLOCK_SIZE) {
+		return;
+	}
+
+	logfs->copy_buf = (uint8_t *)PIOS_malloc_no_dma(page_size);
+	if (!logfs->copy_buf) return;
+
+	logfs->copy_buf_size = page_size;
+}
+
 /**
  * @brief Initialize the flash object setting FS
  * @return 0 if success, -1 if failure
@@ -521,6 +739,13 @@ int32_t PIOS_FLASHFS_Logfs_Init(uintptr_t *fs_id, const struct flashfs_logfs_cfg
 	logfs->partition_size = partition_size; /* size of underlying partition */
 	logfs->mounted        = false;
 
+	if (cfg->use_index) {
+		PIOS_FLASHFS_Logfs_alloc_index(logfs);
+	}
+	if (cfg->use_copy_buf) {
+		PIOS_FLASHFS_Logfs_alloc_copy_buf(logfs);
+	}
+
 	if (PIOS_FLASH_start_transaction(logfs->partition_id) != 0) {
 		rc = -1;
 		goto out_exit;
@@ -587,72 +812,255 @@ out_exit:
 	return rc;
 }
 
-/* NOTE: Must be called while holding the flash transaction lock */
-static int32_t logfs_garbage_collect (struct logfs_state *logfs) {
-	PIOS_Assert (logfs->mounted);
+/*
+ * Garbage collection copies the active slots into the spare arena and then
+ * swaps the two.  With a slot index this happens incrementally: once the log
+ * runs low on free slots, each save and each call to PIOS_FLASHFS_Maintenance
+ * copies a few slots while the active arena stays in use.  Saves append to
+ * the active arena behind the copy, and deletes obsolete the copy too, so the
+ * spare arena is up to date when the copy reaches the end of the log.
+ * Erasing the spare arena is left to PIOS_FLASHFS_Maintenance where possible.
+ */
 
-	/* Source arena is the active arena */
-	uint8_t src_arena_id = logfs->active_arena_id;
+/* Start collecting when no more than this fraction of the slots are free... */
+#define GC_START_FREE_DIVISOR 4
+/* ...and at least this fraction are obsolete, so the copy is worth it */
+#define GC_START_OBSOLETE_DIVISOR 8
+/* Slots to look at per step.  Visiting more slots than each save appends
+ * lets the copy catch the end of the log before it fills. */
+#define GC_STEP_SLOTS 8
+
+/**
+ * @brief Is it worth starting an incremental garbage collection?
+ */
+static bool logfs_gc_wanted(const struct logfs_state *logfs)
+{
+	uint16_t num_slots = logfs->cfg->arena_size / logfs->cfg->slot_size;
+	uint16_t num_obsolete_slots = (num_slots - 1) - logfs->num_free_slots - logfs->num_active_slots;
 
-	/* Compute destination arena */
-	uint8_t dst_arena_id = (logfs->active_arena_id + 1) % (logfs->partition_size / logfs->cfg->arena_size);
+	return logfs->index && !logfs->gc_active && logfs->spare_erased &&
+		(logfs->num_free_slots <= num_slots / GC_START_FREE_DIVISOR) &&
+		(num_obsolete_slots >= num_slots / GC_START_OBSOLETE_DIVISOR);
+}
+
+/* NOTE: Must be called while holding the flash transaction lock */
+static int32_t logfs_erase_spare_arena(struct logfs_state *logfs)
+{
+	PIOS_Assert(!logfs->gc_active);
 
-	/* Erase destination arena */
-	if (logfs_erase_arena (logfs, dst_arena_id) != 0) {
+	if (logfs_erase_arena (logfs, logfs_spare_arena_id(logfs)) != 0) {
 		return -1;
 	}
 
+	logfs->spare_erased = true;
+
+	return 0;
+}
+
+/**
+ * @brief Give up on a garbage collection, the spare arena will be erased
+ * again before the next one
+ */
+static void logfs_gc_abort(struct logfs_state *logfs)
+{
+	logfs->gc_active = false;
+
+	if (!logfs->index) return;
+
+	for (uint32_t pos = 0; pos <= logfs->index_mask; pos++) {
+		logfs->index[pos].gc_slot_id = 0;
+	}
+}
+
+/* NOTE: Must be called while holding the flash transaction lock */
+static int32_t logfs_gc_start(struct logfs_state *logfs)
+{
+	PIOS_Assert (logfs->mounted);
+	PIOS_Assert (!logfs->gc_active);
+
+	/* Erase destination arena, unless that was done in advance */
+	if (!logfs->spare_erased) {
+		if (logfs_erase_spare_arena (logfs) != 0) {
+			return -1;
+		}
+	}
+
 	/* Reserve the destination arena so we can start filling it */
-	if (logfs_reserve_arena (logfs, dst_arena_id) != 0) {
+	logfs->spare_erased = false;
+	if (logfs_reserve_arena (logfs, logfs_spare_arena_id(logfs)) != 0) {
 		/* Unable to reserve the arena */
 		return -2;
 	}
 
-	/* Copy active slots from active arena to destination arena */
-	uint16_t dst_slot_id = 1;
-	for (uint16_t src_slot_id = 1;
-	     src_slot_id < (logfs->cfg->arena_size / logfs->cfg->slot_size);
-	     src_slot_id++) {
+	logfs->gc_src_slot = 1;
+	logfs->gc_dst_slot = 1;
+	logfs->gc_active   = true;
+
+	return 0;
+}
+
+/* NOTE: Must be called while holding the flash transaction lock */
+static int32_t logfs_gc_finish(struct logfs_state *logfs)
+{
+	uint8_t src_arena_id = logfs->active_arena_id;
+	uint8_t dst_arena_id = logfs_spare_arena_id(logfs);
+
+	/* Activate the destination arena */
+	if (logfs_activate_arena (logfs, dst_arena_id) != 0) {
+		return -1;
+	}
+
+	if (logfs->index) {
+		/*
+		 * Every active slot has been copied and the index knows where,
+		 * so switch over without scanning the new arena.
+		 */
+		for (uint32_t pos = 0; pos <= logfs->index_mask; pos++) {
+			struct logfs_index_entry *entry = &logfs->index[pos];
+			if (entry->slot_id == 0) {
+				continue;
+			}
+
+			PIOS_Assert(entry->gc_slot_id != 0);
+			entry->slot_id    = entry->gc_slot_id;
+			entry->gc_slot_id = 0;
+		}
+
+		logfs->active_arena_id = dst_arena_id;
+		logfs->num_free_slots  = (logfs->cfg->arena_size / logfs->cfg->slot_size) - logfs->gc_dst_slot;
+		logfs->gc_active       = false;
+
+		/* Obsolete the source arena */
+		if (logfs_obsolete_arena (logfs, src_arena_id) != 0) {
+			return -2;
+		}
+	} else {
+		/* Unmount the source arena */
+		if (logfs_unmount_log (logfs) != 0) {
+			return -3;
+		}
+
+		/* Obsolete the source arena */
+		if (logfs_obsolete_arena (logfs, src_arena_id) != 0) {
+			return -2;
+		}
+
+		/* Mount the new arena */
+		if (logfs_mount_log (logfs, dst_arena_id) != 0) {
+			return -4;
+		}
+	}
+
+	/* The old source arena may now be the spare */
+	if (logfs_check_spare_arena (logfs) != 0) {
+		return -5;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Copy the active slots among the next few slots of the log to the
+ * spare arena, and finish the garbage collection at the end of the log
+ * @param[in] max_slots the number of slots to look at
+ * @return 0 if success, < 0 on failure which abandons the collection
+ * @note Must be called while holding the flash transaction lock
+ */
+static int32_t logfs_gc_step(struct logfs_state *logfs, uint16_t max_slots)
+{
+	PIOS_Assert (logfs->gc_active);
+
+	uint8_t dst_arena_id = logfs_spare_arena_id(logfs);
+
+	/* Slots past the end of the log are all empty */
+	uint16_t log_end = (logfs->cfg->arena_size / logfs->cfg->slot_size) - logfs->num_free_slots;
+
+	for (; max_slots > 0 && logfs->gc_src_slot < log_end; max_slots--, logfs->gc_src_slot++) {
 		struct slot_header slot_hdr;
-		uintptr_t src_addr = logfs_get_addr (logfs, src_arena_id, src_slot_id);
+		uintptr_t src_addr = logfs_get_addr (logfs, logfs->active_arena_id, logfs->gc_src_slot);
 		if (PIOS_FLASH_read_data(logfs->partition_id,
 						src_addr,
 						(uint8_t *)&slot_hdr,
 						sizeof (slot_hdr)) != 0) {
-			return -3;
+			logfs_gc_abort(logfs);
+			return -1;
 		}
 
-		if (slot_hdr.state == SLOT_STATE_ACTIVE) {
-			uintptr_t dst_addr = logfs_get_addr (logfs, dst_arena_id, dst_slot_id);
-			if (logfs_raw_copy_bytes(logfs,
-							src_addr,
-							sizeof(slot_hdr) + slot_hdr.obj_size,
-							dst_addr) != 0) {
-				/* Failed to copy all bytes */
-				return -4;
-			}
-			dst_slot_id++;
+		if (slot_hdr.state != SLOT_STATE_ACTIVE) {
+			continue;
+		}
+
+		uintptr_t dst_addr = logfs_get_addr (logfs, dst_arena_id, logfs->gc_dst_slot);
+		if (logfs_raw_copy_bytes(logfs,
+						src_addr,
+						sizeof(slot_hdr) + slot_hdr.obj_size,
+						dst_addr) != 0) {
+			/* Failed to copy all bytes */
+			logfs_gc_abort(logfs);
+			return -2;
+		}
+
+		/* Remember where the copy is, so a delete can obsolete it */
+		struct logfs_index_entry *entry = logfs_index_lookup(logfs, slot_hdr.obj_id, slot_hdr.obj_inst_id, logfs->gc_src_slot);
+		if (entry) {
+			entry->gc_slot_id = logfs->gc_dst_slot;
 		}
+
+		logfs->gc_dst_slot++;
 	}
 
-	/* Activate the destination arena */
-	if (logfs_activate_arena (logfs, dst_arena_id) != 0) {
-		return -5;
+	if (logfs->gc_src_slot < log_end) {
+		/* More to copy */
+		return 0;
 	}
 
-	/* Unmount the source arena */
-	if (logfs_unmount_log (logfs) != 0) {
-		return -6;
+	if (logfs_gc_finish(logfs) != 0) {
+		logfs_gc_abort(logfs);
+		return -3;
 	}
 
-	/* Obsolete the source arena */
-	if (logfs_obsolete_arena (logfs, src_arena_id) != 0) {
-		return -7;
+	return 0;
+}
+
+/**
+ * @brief Do one bounded step of incremental garbage collection, if one is
+ * under way or worth starting
+ * @return 0 if success, < 0 on failure
+ * @note Must be called while holding the flash transaction lock
+ */
+static int32_t logfs_gc_advance(struct logfs_state *logfs)
+{
+	if (!logfs->gc_active) {
+		if (!logfs_gc_wanted(logfs)) {
+			return 0;
+		}
+
+		if (logfs_gc_start(logfs) != 0) {
+			return -1;
+		}
+	}
+
+	if (logfs_gc_step(logfs, GC_STEP_SLOTS) != 0) {
+		return -2;
+	}
+
+	return 0;
+}
+
+/* NOTE: Must be called while holding the flash transaction lock */
+static int32_t logfs_garbage_collect (struct logfs_state *logfs) {
+	PIOS_Assert (logfs->mounted);
+
+	/* Start a collection, unless one is under way already */
+	if (!logfs->gc_active) {
+		if (logfs_gc_start (logfs) != 0) {
+			return -1;
+		}
 	}
 
-	/* Mount the new arena */
-	if (logfs_mount_log (logfs, dst_arena_id) != 0) {
-		return -8;
+	/* Copy everything that is left and switch arenas */
+	if (logfs_gc_step (logfs, UINT16_MAX) != 0) {
+		return -2;
 	}
 
 	return 0;
@@ -696,19 +1104,79 @@ static int16_t logfs_object_find_next (const struct logfs_state *logfs, struct s
 }
 
 /* NOTE: Must be called while holding the flash transaction lock */
-/* OPTIMIZE: could trust that there is at most one active version of every object and terminate the search when we find one */
+static int16_t logfs_object_find (const struct logfs_state *logfs, struct slot_header *slot_hdr, uint16_t *slot_id, uint32_t obj_id, uint16_t obj_inst_id)
+{
+	PIOS_Assert(slot_hdr);
+	PIOS_Assert(slot_id);
+
+	if (!logfs->index) {
+		/* No index, search the log from the start */
+		*slot_id = 0;
+		return logfs_object_find_next(logfs, slot_hdr, slot_id, obj_id, obj_inst_id);
+	}
+
+	uint16_t hash = logfs_index_hash(obj_id, obj_inst_id);
+
+	for (uint16_t pos = hash & logfs->index_mask;
+	     logfs->index[pos].slot_id != 0;
+	     pos = (pos + 1) & logfs->index_mask) {
+		if (logfs->index[pos].hash != hash) {
+			continue;
+		}
+
+		/* Confirm the match against the slot header */
+		uintptr_t slot_addr = logfs_get_addr (logfs, logfs->active_arena_id, logfs->index[pos].slot_id);
+
+		if (PIOS_FLASH_read_data(logfs->partition_id,
+						slot_addr,
+						(uint8_t *)slot_hdr,
+						sizeof (*slot_hdr)) != 0) {
+			return -2;
+		}
+		if (slot_hdr->state == SLOT_STATE_ACTIVE &&
+			slot_hdr->obj_id      == obj_id &&
+			slot_hdr->obj_inst_id == obj_inst_id) {
+			*slot_id = logfs->index[pos].slot_id;
+			return 0;
+		}
+	}
+
+	/* No matching entry was found */
+	return -1;
+}
+
+/* NOTE: Must be called while holding the flash transaction lock */
 static int8_t logfs_delete_object (struct logfs_state *logfs, uint32_t obj_id, uint16_t obj_inst_id)
 {
 	int8_t rc;
 
+	/*
+	 * There should be at most one active version of every object, but
+	 * keep going until none are left in case an earlier save was
+	 * interrupted.
+	 */
 	bool more = true;
-	uint16_t curr_slot_id = 0;
+	uint16_t curr_slot_id;
 	do {
 		struct slot_header slot_hdr;
-		switch (logfs_object_find_next (logfs, &slot_hdr, &curr_slot_id, obj_id, obj_inst_id)) {
+		switch (logfs_object_find (logfs, &slot_hdr, &curr_slot_id, obj_id, obj_inst_id)) {
 		case 0:
 			/* Found a matching slot.  Obsolete it. */
 			slot_hdr.state = SLOT_STATE_OBSOLETE;
+
+			struct logfs_index_entry *entry = logfs_index_lookup(logfs, obj_id, obj_inst_id, curr_slot_id);
+			if (entry && entry->gc_slot_id) {
+				/* Obsolete the copy in the spare arena too, or the collection would revive it */
+				uintptr_t copy_addr = logfs_get_addr (logfs, logfs_spare_arena_id(logfs), entry->gc_slot_id);
+
+				if (PIOS_FLASH_write_data(logfs->partition_id,
+								copy_addr,
+								(uint8_t *)&slot_hdr,
+								sizeof(slot_hdr)) != 0) {
+					logfs_gc_abort(logfs);
+				}
+			}
+
 			uintptr_t slot_addr = logfs_get_addr (logfs, logfs->active_arena_id, curr_slot_id);
 
 			if (PIOS_FLASH_write_data(logfs->partition_id,
@@ -720,6 +1188,9 @@ static int8_t logfs_delete_object (struct logfs_state *logfs, uint32_t obj_id, u
 			}
 			/* Object has been successfully obsoleted and is no longer active */
 			logfs->num_active_slots--;
+			if (entry) {
+				logfs_index_remove(logfs, entry);
+			}
 			break;
 		case -1:
 			/* Search completed, object not found */
@@ -832,6 +1303,7 @@ static int8_t logfs_append_to_log (struct logfs_state *logfs, uint32_t obj_id, u
 
 	/* Object has been successfully written to the slot */
 	logfs->num_active_slots++;
+	logfs_index_insert(logfs, obj_id, obj_inst_id, free_slot_id);
 	return 0;
 }
 
@@ -924,6 +1396,12 @@ int32_t PIOS_FLASHFS_ObjSave(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst
 	/* Object successfully written to the log */
 	rc = 0;
 
+	/*
+	 * Keep any incremental garbage collection ahead of the log.  A failure
+	 * here abandons the collection but doesn't affect the saved object.
+	 */
+	logfs_gc_advance(logfs);
+
 out_end_trans:
 	PIOS_FLASH_end_transaction(logfs->partition_id);
 
@@ -964,9 +1442,9 @@ int32_t PIOS_FLASHFS_ObjLoad(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst
 	}
 
 	/* Find the object in the log */
-	uint16_t slot_id = 0;
+	uint16_t slot_id;
 	struct slot_header slot_hdr;
-	if (logfs_object_find_next (logfs, &slot_hdr, &slot_id, obj_id, obj_inst_id) != 0) {
+	if (logfs_object_find (logfs, &slot_hdr, &slot_id, obj_id, obj_inst_id) != 0) {
 		/* Object does not exist in fs */
 		rc = -3;
 		goto out_end_trans;
@@ -1043,6 +1521,53 @@ out_exit:
 	return rc;
 }
 
+/**
+ * @brief Do a bounded amount of housekeeping so that later saves don't have to
+ * @param[in] fs_id The filesystem to use for this action
+ * @return 0 if success or error code
+ * @retval -1 if fs_id is not a valid filesystem instance
+ * @retval -2 if failed to start transaction
+ * @retval -3 if failed to erase the spare arena
+ * @retval -4 if garbage collection failed
+ * @note Erasing the spare arena takes as long as erasing an arena, call this
+ * from a low priority task
+ */
+int32_t PIOS_FLASHFS_Maintenance(uintptr_t fs_id)
+{
+	int32_t rc;
+
+	struct logfs_state *logfs = (struct logfs_state *)fs_id;
+
+	if (!PIOS_FLASHFS_Logfs_validate(logfs)) {
+		rc = -1;
+		goto out_exit;
+	}
+
+	if (PIOS_FLASH_start_transaction(logfs->partition_id) != 0) {
+		rc = -2;
+		goto out_exit;
+	}
+
+	if (!logfs->gc_active && !logfs->spare_erased) {
+		/* Get the spare arena ready for the next garbage collection */
+		if (logfs_erase_spare_arena(logfs) != 0) {
+			rc = -3;
+			goto out_end_trans;
+		}
+	} else if (logfs_gc_advance(logfs) != 0) {
+		rc = -4;
+		goto out_end_trans;
+	}
+
+	rc = 0;
+
+out_end_trans:
+	PIOS_FLASH_end_transaction(logfs->partition_id);
+
+out_exit:
+	return rc;
+}
+
 /**
  * @brief Erases all filesystem arenas and activate the first arena
  * @param[in] fs_id The filesystem to use for this action
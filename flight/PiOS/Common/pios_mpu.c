@@ -38,6 +38,7 @@
 #include "pios_thread.h"
 #include "pios_queue.h"
 #include "physical_constants.h"
+#include "misc_math.h"
 #include "taskmonitor.h"
 
 #include "pios_mpu_priv.h"
@@ -51,6 +52,11 @@
 
 #define PIOS_MPU_QUEUE_LEN       2
 
+//! Size of one accel, temperature and gyro sample as read from the chip
+#define PIOS_MPU_FRAME_SIZE      14
+//! Most samples taken from the FIFO at once, beyond that it is reset
+#define PIOS_MPU_FIFO_MAX_FRAMES 16
+
 #ifndef PIOS_MPU_SPI_HIGH_SPEED
 #define PIOS_MPU_SPI_HIGH_SPEED              20000000	// should result in 10.5MHz clock on F4 targets like Sparky2
 #endif // PIOS_MPU_SPI_HIGH_SPEED
@@ -83,6 +89,20 @@ enum pios_mpu_com_driver {
 	PIOS_MPU_COM_SPI,  /**< SPI driver */
 };
 
+/**
+ * Words of one sample, in the order the chip stores them
+ */
+enum pios_mpu_raw_idx {
+	PIOS_MPU_RAW_ACCEL_X,
+	PIOS_MPU_RAW_ACCEL_Y,
+	PIOS_MPU_RAW_ACCEL_Z,
+	PIOS_MPU_RAW_TEMP,
+	PIOS_MPU_RAW_GYRO_X,
+	PIOS_MPU_RAW_GYRO_Y,
+	PIOS_MPU_RAW_GYRO_Z,
+	PIOS_MPU_RAW_NUM
+};
+
 /**
  * Magic byte sequence used to validate the device state struct.
  * Should be unique amongst all PiOS drivers!
@@ -104,12 +124,19 @@ struct pios_mpu_dev {
 	bool use_mag;
 	struct pios_queue *mag_queue;
 #endif // PIOS_INCLUDE_MPU_MAG
-	struct pios_queue *gyro_queue;
-	struct pios_queue *accel_queue;
 	struct pios_thread *task_handle;
 	struct pios_semaphore *data_ready_sema;
 	enum pios_mpu_gyro_range gyro_range;
 	enum pios_mpu_accel_range accel_range;
+	uint8_t user_ctrl;                   /**< USER_CTRL value without the reset bits */
+	uint16_t internal_rate;              /**< Sample rate before the divisor [Hz] */
+	uint8_t irq_divisor;                 /**< Data ready interrupts per task wakeup */
+	uint8_t irq_count;
+	uint8_t *fifo_buf;                   /**< Samples drained from the FIFO, NULL in register mode */
+	float fifo_sum[PIOS_MPU_RAW_NUM];    /**< Running sum of the samples being averaged */
+	uint8_t fifo_sum_count;
+	uint32_t sample_period_us;           /**< Time between the samples passed on */
+	uint32_t last_sample_raw;            /**< Read time of the last sample in register mode */
 	enum pios_mpu_dev_magic magic;       /**< Magic bytes to validate the struct contents */
 };
 
@@ -144,6 +171,19 @@ static int32_t PIOS_MPU_Config(struct pios_mpu_cfg const *cfg);
 static void PIOS_MPU_Task(void *parameters);
 static int32_t PIOS_MPU_ReadReg(uint8_t reg);
 static int32_t PIOS_MPU_WriteReg(uint8_t reg, uint8_t data);
+/**
+ * @brief Read consecutive registers, or the FIFO, in one transaction
+ * \param[in] reg First register
+ * \param[out] buffer Received bytes
+ * \param[in] len Number of bytes to read
+ * @return 0 if successful
+ */
+static int32_t PIOS_MPU_ReadBlock(uint8_t reg, uint8_t *buffer, uint8_t len);
+/**
+ * @brief Empty the FIFO and start filling it again
+ * @return 0 if successful
+ */
+static int32_t PIOS_MPU_ResetFifo(void);
 
 #if defined(PIOS_INCLUDE_SPI) || defined(__DOXYGEN__)
 /**
@@ -186,23 +226,19 @@ static struct pios_mpu_dev *PIOS_MPU_Alloc(const struct pios_mpu_cfg *cfg)
 
 	dev->magic = PIOS_MPU_DEV_MAGIC;
 
-	dev->accel_queue = PIOS_Queue_Create(PIOS_MPU_QUEUE_LEN, sizeof(struct pios_sensor_accel_data));
-	if (dev->accel_queue == NULL) {
-		PIOS_free(dev);
-		return NULL;
-	}
-
-	dev->gyro_queue = PIOS_Queue_Create(PIOS_MPU_QUEUE_LEN, sizeof(struct pios_sensor_gyro_data));
-	if (dev->gyro_queue == NULL) {
-		PIOS_Queue_Delete(dev->accel_queue);
-		PIOS_free(dev);
-		return NULL;
+	dev->fifo_buf = NULL;
+	if (cfg->fifo_burst) {
+		dev->fifo_buf = PIOS_malloc(PIOS_MPU_FIFO_MAX_FRAMES * PIOS_MPU_FRAME_SIZE);
+		if (dev->fifo_buf == NULL) {
+			PIOS_free(dev);
+			return NULL;
+		}
 	}
 
 	dev->data_ready_sema = PIOS_Semaphore_Create();
 	if (dev->data_ready_sema == NULL) {
-		PIOS_Queue_Delete(dev->accel_queue);
-		PIOS_Queue_Delete(dev->gyro_queue);
+		if (dev->fifo_buf)
+			PIOS_free(dev->fifo_buf);
 		PIOS_free(dev);
 		return NULL;
 	}
@@ -251,17 +287,25 @@ static int32_t PIOS_MPU_Config(struct pios_mpu_cfg const *cfg)
 		return -PIOS_MPU_ERROR_WRITEFAILED;
 
 	// user control
-	if (mpu_dev->com_driver_type == PIOS_MPU_COM_SPI) {
-		if (PIOS_MPU_WriteReg(PIOS_MPU_USER_CTRL_REG, PIOS_MPU_USERCTL_DIS_I2C | PIOS_MPU_USERCTL_I2C_MST_EN) != 0)
-			return -PIOS_MPU_ERROR_WRITEFAILED;
-	} else {
-		if (PIOS_MPU_WriteReg(PIOS_MPU_USER_CTRL_REG, PIOS_MPU_USERCTL_I2C_MST_EN) != 0)
-			return -PIOS_MPU_ERROR_WRITEFAILED;
-	}
+	if (mpu_dev->com_driver_type == PIOS_MPU_COM_SPI)
+		mpu_dev->user_ctrl = PIOS_MPU_USERCTL_DIS_I2C | PIOS_MPU_USERCTL_I2C_MST_EN;
+	else
+		mpu_dev->user_ctrl = PIOS_MPU_USERCTL_I2C_MST_EN;
+
+	if (cfg->fifo_burst)
+		mpu_dev->user_ctrl |= PIOS_MPU_USERCTL_FIFO_EN;
+
+	if (PIOS_MPU_WriteReg(PIOS_MPU_USER_CTRL_REG, mpu_dev->user_ctrl) != 0)
+		return -PIOS_MPU_ERROR_WRITEFAILED;
 
 	// Digital low-pass filter and scale
 	// set this before sample rate else sample rate calculation will fail
-	PIOS_MPU_SetGyroBandwidth(184);
+	// the FIFO can keep up with the unfiltered 8 kHz gyro, averaging
+	// in the driver takes the place of the filter
+	if (cfg->fifo_burst)
+		PIOS_MPU_SetGyroBandwidth(256);
+	else
+		PIOS_MPU_SetGyroBandwidth(184);
 	PIOS_MPU_SetAccelBandwidth(184);
 
 	// Sample rate
@@ -274,6 +318,15 @@ static int32_t PIOS_MPU_Config(struct pios_mpu_cfg const *cfg)
 	// Set the accel scale
 	PIOS_MPU_SetAccelRange(PIOS_MPU_SCALE_8G);
 
+	// Samples go to the FIFO in the same order as the data registers
+	if (cfg->fifo_burst) {
+		PIOS_MPU_WriteReg(PIOS_MPU_FIFO_EN_REG, PIOS_MPU_FIFO_TEMP_OUT |
+				PIOS_MPU_FIFO_GYRO_X_OUT | PIOS_MPU_FIFO_GYRO_Y_OUT |
+				PIOS_MPU_FIFO_GYRO_Z_OUT | PIOS_MPU_ACCEL_OUT);
+		if (PIOS_MPU_ResetFifo() != 0)
+			return -PIOS_MPU_ERROR_WRITEFAILED;
+	}
+
 	// Interrupt configuration
 	PIOS_MPU_WriteReg(PIOS_MPU_INT_CFG_REG, PIOS_MPU_INT_CLR_ANYRD);
 
@@ -418,6 +471,10 @@ static int32_t PIOS_MPU_Common_Init(void)
 	}
 #endif // PIOS_INCLUDE_MPU_MAG
 
+	/* Wake the task for every sample until it is running */
+	mpu_dev->irq_divisor = 1;
+	mpu_dev->irq_count = 0;
+
 	/* Set up EXTI line */
 	PIOS_EXTI_Init(mpu_dev->cfg->exti_cfg);
 
@@ -428,13 +485,28 @@ static int32_t PIOS_MPU_Common_Init(void)
 		return -PIOS_MPU_ERROR_NOIRQ;
 	}
 
+	// a whole drained FIFO may be passed on at once
+	uint16_t ring_len = PIOS_MPU_QUEUE_LEN;
+	if (mpu_dev->cfg->fifo_burst)
+		ring_len += PIOS_MPU_FIFO_MAX_FRAMES / MAX(mpu_dev->cfg->fifo_decimation, 1);
+
+	if (PIOS_SENSORS_RegisterRing(PIOS_SENSOR_ACCEL, ring_len) != 0 ||
+			PIOS_SENSORS_RegisterRing(PIOS_SENSOR_GYRO, ring_len) != 0)
+		PIOS_Assert(0);
+
+	mpu_dev->last_sample_raw = PIOS_DELAY_GetRaw();
+
+	if (mpu_dev->cfg->fifo_burst) {
+		PIOS_MPU_ResetFifo();
+		// leave room for the task running late
+		mpu_dev->irq_divisor = MIN(mpu_dev->cfg->fifo_burst, PIOS_MPU_FIFO_MAX_FRAMES / 2);
+	}
+
 	mpu_dev->task_handle = PIOS_Thread_Create(
 			PIOS_MPU_Task, "pios_mpu", PIOS_MPU_TASK_STACK, NULL, PIOS_MPU_TASK_PRIORITY);
 	PIOS_Assert(mpu_dev->task_handle != NULL);
 	TaskMonitorAdd(TASKINFO_RUNNING_IMU, mpu_dev->task_handle);
 
-	PIOS_SENSORS_Register(PIOS_SENSOR_ACCEL, mpu_dev->accel_queue);
-	PIOS_SENSORS_Register(PIOS_SENSOR_GYRO, mpu_dev->gyro_queue);
 #ifdef PIOS_INCLUDE_MPU_MAG
 	if (mpu_dev->use_mag)
 		PIOS_SENSORS_Register(PIOS_SENSOR_MAG, mpu_dev->mag_queue);
@@ -532,8 +604,10 @@ static float PIOS_MPU_GetAccelScale(void)
 void PIOS_MPU_SetGyroBandwidth(uint16_t bandwidth)
 {
 	uint8_t filter;
-	// TODO: investigate 250/256 Hz (Fs=8 kHz, aliasing?)
-	if (mpu_dev->mpu_type == PIOS_MPU6500 || mpu_dev->mpu_type == PIOS_MPU9250) {
+	// 250/256 Hz runs the gyro at 8 kHz, only the FIFO can keep up with that
+	if (mpu_dev->cfg->fifo_burst && bandwidth >= 250) {
+		filter = PIOS_MPU60X0_GYRO_LOWPASS_256_HZ;
+	} else if (mpu_dev->mpu_type == PIOS_MPU6500 || mpu_dev->mpu_type == PIOS_MPU9250) {
 		if (bandwidth <= 5)
 			filter = PIOS_MPU6500_GYRO_LOWPASS_5_HZ;
 		else if (bandwidth <= 10)
@@ -561,6 +635,8 @@ void PIOS_MPU_SetGyroBandwidth(uint16_t bandwidth)
 			filter = PIOS_MPU60X0_GYRO_LOWPASS_188_HZ;
 	}
 
+	mpu_dev->internal_rate = (filter == PIOS_MPU60X0_GYRO_LOWPASS_256_HZ) ? 8000 : 1000;
+
 	PIOS_MPU_WriteReg(PIOS_MPU_DLPF_CFG_REG, filter);
 }
 
@@ -590,8 +666,8 @@ void PIOS_MPU_SetAccelBandwidth(uint16_t bandwidth)
 
 int32_t PIOS_MPU_SetSampleRate(uint16_t samplerate_hz)
 {
-	// TODO: think about supporting >1 khz, aliasing/noise issues though..
-	uint16_t internal_rate = 1000;
+	// only above 1 kHz with the FIFO, see PIOS_MPU_SetGyroBandwidth
+	uint16_t internal_rate = mpu_dev->internal_rate;
 
 	// limit samplerate to filter frequency
 	if (samplerate_hz > internal_rate)
@@ -613,8 +689,15 @@ int32_t PIOS_MPU_SetSampleRate(uint16_t samplerate_hz)
 	int32_t retval = PIOS_MPU_WriteReg(PIOS_MPU_SMPLRT_DIV_REG, (uint8_t)divisor);
 
 	if (retval == 0) {
-		PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_ACCEL, samplerate_hz);
-		PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_GYRO, samplerate_hz);
+		// rate after averaging
+		uint16_t output_rate = samplerate_hz;
+		if (mpu_dev->cfg->fifo_burst)
+			output_rate /= MAX(mpu_dev->cfg->fifo_decimation, 1);
+
+		mpu_dev->sample_period_us = 1000000 / MAX(output_rate, 1);
+
+		PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_ACCEL, output_rate);
+		PIOS_SENSORS_SetSampleRate(PIOS_SENSOR_GYRO, output_rate);
 #ifdef PIOS_INCLUDE_MPU_MAG
 		if (mpu_dev->use_mag) {
 			uint16_t mag_rate = (mpu_dev->mpu_type == PIOS_MPU9250) ? 100 : samplerate_hz;
@@ -835,11 +918,51 @@ static int32_t PIOS_MPU_ReadReg(uint8_t reg)
 		return data;
 }
 
+static int32_t PIOS_MPU_ReadBlock(uint8_t reg, uint8_t *buffer, uint8_t len)
+{
+#if defined(PIOS_INCLUDE_I2C)
+	if (mpu_dev->com_driver_type == PIOS_MPU_COM_I2C)
+		return PIOS_MPU_I2C_Read(reg, buffer, len);
+#endif // defined(PIOS_INCLUDE_I2C)
+#if defined(PIOS_INCLUDE_SPI)
+	if (mpu_dev->com_driver_type == PIOS_MPU_COM_SPI) {
+		// only used for the data registers and FIFO, which allow high speed
+		if (PIOS_MPU_ClaimBus(false) != 0)
+			return -1;
+
+		PIOS_SPI_TransferByte(mpu_dev->com_driver_id, 0x80 | reg);
+		int32_t retval = PIOS_SPI_TransferBlock(mpu_dev->com_driver_id, NULL, buffer, len, NULL);
+
+		PIOS_MPU_ReleaseBus(false);
+
+		return (retval < 0) ? -1 : 0;
+	}
+#endif // defined(PIOS_INCLUDE_SPI)
+
+	return -1;
+}
+
+static int32_t PIOS_MPU_ResetFifo(void)
+{
+	if (PIOS_MPU_WriteReg(PIOS_MPU_USER_CTRL_REG, mpu_dev->user_ctrl | PIOS_MPU_USERCTL_FIFO_RST) != 0)
+		return -1;
+
+	// start the next average afresh
+	mpu_dev->fifo_sum_count = 0;
+
+	return 0;
+}
+
 bool PIOS_MPU_IRQHandler(void)
 {
 	if (PIOS_MPU_Validate(mpu_dev) != 0)
 		return false;
 
+	// in FIFO mode samples are left to collect for a few interrupts
+	if (++mpu_dev->irq_count < mpu_dev->irq_divisor)
+		return false;
+	mpu_dev->irq_count = 0;
+
 	bool woken = false;
 
 	PIOS_Semaphore_Give_FromISR(mpu_dev->data_ready_sema, &woken);
@@ -847,28 +970,148 @@ bool PIOS_MPU_IRQHandler(void)
 	return woken;
 }
 
-static void PIOS_MPU_Task(void *parameters)
+/**
+ * @brief Unpack the big endian words of one sample
+ * \param[in] frame Sample as read from the data registers or FIFO
+ * \param[out] raw Words of the sample
+ */
+static void PIOS_MPU_UnpackFrame(const uint8_t *frame, float raw[PIOS_MPU_RAW_NUM])
 {
-	(void)parameters;
+	for (int i = 0; i < PIOS_MPU_RAW_NUM; i++)
+		raw[i] = (int16_t)(frame[2 * i] << 8 | frame[2 * i + 1]);
+}
+
+/**
+ * @brief Rotate and scale one accel and gyro sample and pass it on.  The
+ * sensors ring reader is not woken here.
+ * \param[in] raw Words of the sample, may be averages
+ * \param[in] dt_us Time since the previous sample
+ */
+static void PIOS_MPU_PublishSample(const float raw[PIOS_MPU_RAW_NUM], uint32_t dt_us)
+{
+	struct pios_sensor_sample accel_sample;
+	struct pios_sensor_sample gyro_sample;
+	struct pios_sensor_accel_data accel_data;
+	struct pios_sensor_gyro_data gyro_data;
+
+	float accel_x = raw[PIOS_MPU_RAW_ACCEL_X];
+	float accel_y = raw[PIOS_MPU_RAW_ACCEL_Y];
+	float accel_z = raw[PIOS_MPU_RAW_ACCEL_Z];
+	float gyro_x = raw[PIOS_MPU_RAW_GYRO_X];
+	float gyro_y = raw[PIOS_MPU_RAW_GYRO_Y];
+	float gyro_z = raw[PIOS_MPU_RAW_GYRO_Z];
+
+	// Rotate the sensor to our convention.  The datasheet defines X as towards the right
+	// and Y as forward. Our convention transposes this.  Also the Z is defined negatively
+	// to our convention. This is true for accels and gyros.
+	switch (mpu_dev->cfg->orientation) {
+	case PIOS_MPU_TOP_0DEG:
+		accel_data.y = accel_x;
+		accel_data.x = accel_y;
+		accel_data.z = -accel_z;
+		gyro_data.y  = gyro_x;
+		gyro_data.x  = gyro_y;
+		gyro_data.z  = -gyro_z;
+		break;
+	case PIOS_MPU_TOP_90DEG:
+		accel_data.y = -accel_y;
+		accel_data.x = accel_x;
+		accel_data.z = -accel_z;
+		gyro_data.y  = -gyro_y;
+		gyro_data.x  = gyro_x;
+		gyro_data.z  = -gyro_z;
+		break;
+	case PIOS_MPU_TOP_180DEG:
+		accel_data.y = -accel_x;
+		accel_data.x = -accel_y;
+		accel_data.z = -accel_z;
+		gyro_data.y  = -gyro_x;
+		gyro_data.x  = -gyro_y;
+		gyro_data.z  = -gyro_z;
+		break;
+	case PIOS_MPU_TOP_270DEG:
+		accel_data.y = accel_y;
+		accel_data.x = -accel_x;
+		accel_data.z = -accel_z;
+		gyro_data.y  = gyro_y;
+		gyro_data.x  = -gyro_x;
+		gyro_data.z  = -gyro_z;
+		break;
+	case PIOS_MPU_BOTTOM_0DEG:
+		accel_data.y = -accel_x;
+		accel_data.x = accel_y;
+		accel_data.z = accel_z;
+		gyro_data.y  = -gyro_x;
+		gyro_data.x  = gyro_y;
+		gyro_data.z  = gyro_z;
+		break;
+
+	case PIOS_MPU_BOTTOM_90DEG:
+		accel_data.y = -accel_y;
+		accel_data.x = -accel_x;
+		accel_data.z = accel_z;
+		gyro_data.y  = -gyro_y;
+		gyro_data.x  = -gyro_x;
+		gyro_data.z  = gyro_z;
+		break;
+
+	case PIOS_MPU_BOTTOM_180DEG:
+		accel_data.y = accel_x;
+		accel_data.x = -accel_y;
+		accel_data.z = accel_z;
+		gyro_data.y  = gyro_x;
+		gyro_data.x  = -gyro_y;
+		gyro_data.z  = gyro_z;
+		break;
+
+	case PIOS_MPU_BOTTOM_270DEG:
+		accel_data.y = accel_y;
+		accel_data.x = accel_x;
+		gyro_data.y  = gyro_y;
+		gyro_data.x  = gyro_x;
+		gyro_data.z  = gyro_z;
+		accel_data.z = accel_z;
+		break;
+	}
+
+	float raw_temp = raw[PIOS_MPU_RAW_TEMP];
+	float temperature;
+	if (mpu_dev->mpu_type == PIOS_MPU6500 || mpu_dev->mpu_type == PIOS_MPU9250)
+		temperature = 21.0f + raw_temp / 333.87f;
+	else
+		temperature = 35.0f + (raw_temp + 512.0f) / 340.0f;
+
+	// Apply sensor scaling
+	float accel_scale = PIOS_MPU_GetAccelScale();
+	accel_data.x *= accel_scale;
+	accel_data.y *= accel_scale;
+	accel_data.z *= accel_scale;
+	accel_data.temperature = temperature;
+
+	float gyro_scale = PIOS_MPU_GetGyroScale();
+	gyro_data.x *= gyro_scale;
+	gyro_data.y *= gyro_scale;
+	gyro_data.z *= gyro_scale;
+	gyro_data.temperature = temperature;
+
+	accel_sample.dt_us = dt_us;
+	accel_sample.data.accel = accel_data;
+	gyro_sample.dt_us = dt_us;
+	gyro_sample.data.gyro = gyro_data;
+
+	PIOS_SENSORS_Push(PIOS_SENSOR_ACCEL, &accel_sample);
+	PIOS_SENSORS_Push(PIOS_SENSOR_GYRO, &gyro_sample);
+}
 
-	enum {
-		IDX_SPI_DUMMY_BYTE = 0,
-		IDX_ACCEL_XOUT_H,
-		IDX_ACCEL_XOUT_L,
-		IDX_ACCEL_YOUT_H,
-		IDX_ACCEL_YOUT_L,
-		IDX_ACCEL_ZOUT_H,
-		IDX_ACCEL_ZOUT_L,
-		IDX_TEMP_OUT_H,
-		IDX_TEMP_OUT_L,
-		IDX_GYRO_XOUT_H,
-		IDX_GYRO_XOUT_L,
-		IDX_GYRO_YOUT_H,
-		IDX_GYRO_YOUT_L,
-		IDX_GYRO_ZOUT_H,
-		IDX_GYRO_ZOUT_L,
 #ifdef PIOS_INCLUDE_MPU_MAG
-		IDX_MAG_ST1,
+/**
+ * @brief Check, rotate and scale a magnetometer sample and pass it on
+ * \param[in] buf The AK89xx registers from ST1 to ST2
+ */
+static void PIOS_MPU_PublishMag(const uint8_t *buf)
+{
+	enum {
+		IDX_MAG_ST1 = 0,
 		IDX_MAG_XOUT_L,
 		IDX_MAG_XOUT_H,
 		IDX_MAG_YOUT_L,
@@ -876,8 +1119,160 @@ static void PIOS_MPU_Task(void *parameters)
 		IDX_MAG_ZOUT_L,
 		IDX_MAG_ZOUT_H,
 		IDX_MAG_ST2,
+	};
+
+	// check data ready
+	bool mag_ok = buf[IDX_MAG_ST1] & PIOS_MPU_AK89XX_ST1_DRDY;
+	// check for overflow
+	mag_ok &= !(buf[IDX_MAG_ST2] & PIOS_MPU_AK89XX_ST2_HOFL);
+	// check for data error on mpu-9150
+	mag_ok &= (mpu_dev->mpu_type != PIOS_MPU9150 || !(buf[IDX_MAG_ST2] & PIOS_MPU_AK8975_ST2_DERR));
+	if (!mag_ok)
+		return;
+
+	struct pios_sensor_mag_data mag_data;
+
+	float mag_x = (int16_t)(buf[IDX_MAG_XOUT_H] << 8 | buf[IDX_MAG_XOUT_L]);
+	float mag_y = (int16_t)(buf[IDX_MAG_YOUT_H] << 8 | buf[IDX_MAG_YOUT_L]);
+	float mag_z = (int16_t)(buf[IDX_MAG_ZOUT_H] << 8 | buf[IDX_MAG_ZOUT_L]);
+
+	// Magnetometer corresponds our convention.
+	switch (mpu_dev->cfg->orientation) {
+	case PIOS_MPU_TOP_0DEG:
+		mag_data.x   = mag_x;
+		mag_data.y   = mag_y;
+		mag_data.z   = mag_z;
+		break;
+	case PIOS_MPU_TOP_90DEG:
+		mag_data.x   = -mag_y;
+		mag_data.y   = mag_x;
+		mag_data.z   = mag_z;
+		break;
+	case PIOS_MPU_TOP_180DEG:
+		mag_data.x   = -mag_x;
+		mag_data.y   = -mag_y;
+		mag_data.z   = mag_z;
+		break;
+	case PIOS_MPU_TOP_270DEG:
+		mag_data.x   = mag_y;
+		mag_data.y   = -mag_x;
+		mag_data.z   = mag_z;
+		break;
+	case PIOS_MPU_BOTTOM_0DEG:
+		mag_data.x   = mag_x;
+		mag_data.y   = -mag_y;
+		mag_data.z   = -mag_z;
+		break;
+
+	case PIOS_MPU_BOTTOM_90DEG:
+		mag_data.x   = -mag_y;
+		mag_data.y   = -mag_x;
+		mag_data.z   = -mag_z;
+		break;
+
+	case PIOS_MPU_BOTTOM_180DEG:
+		mag_data.x   = -mag_x;
+		mag_data.y   = mag_y;
+		mag_data.z   = -mag_z;
+		break;
+
+	case PIOS_MPU_BOTTOM_270DEG:
+		mag_data.x   = mag_y;
+		mag_data.y   = mag_x;
+		mag_data.z   = -mag_z;
+		break;
+	}
+
+	float mag_scale;
+	if (mpu_dev->mpu_type == PIOS_MPU9150)
+		mag_scale = 3.0f; // 12-bit sampling
+	else if (buf[IDX_MAG_ST2] & PIOS_MPU_AK8963_ST2_BITM)
+		mag_scale = 1.5f; // 16-bit sampling
+	else
+		mag_scale = 6.0f; // 14-bit sampling
+	mag_data.x *= mag_scale;
+	mag_data.y *= mag_scale;
+	mag_data.z *= mag_scale;
+	PIOS_Queue_Send(mpu_dev->mag_queue, &mag_data, 0);
+
+	// trigger another sample
+	if (mpu_dev->mpu_type == PIOS_MPU9150)
+		PIOS_MPU_Mag_WriteReg(PIOS_MPU_AK89XX_CNTL1_REG, PIOS_MPU_AK8975_MODE_SINGLE_12B);
+}
+#endif // PIOS_INCLUDE_MPU_MAG
+
+/**
+ * @brief Take every complete sample out of the FIFO, average them in groups
+ * of fifo_decimation and pass the averages on
+ * @return 0 if successful
+ */
+static int32_t PIOS_MPU_DrainFifo(void)
+{
+	uint8_t count_buf[2];
+	if (PIOS_MPU_ReadBlock(PIOS_MPU_FIFO_CNT_MSB, count_buf, sizeof(count_buf)) != 0)
+		return -1;
+
+	uint16_t frames = (count_buf[0] << 8 | count_buf[1]) / PIOS_MPU_FRAME_SIZE;
+
+	// Fallen too far behind, and close to the FIFO overflowing which would
+	// leave it out of step with the frames.  Newer samples are worth more.
+	if (frames > PIOS_MPU_FIFO_MAX_FRAMES)
+		return PIOS_MPU_ResetFifo();
+
+	if (frames == 0)
+		return 0;
+
+	if (PIOS_MPU_ReadBlock(PIOS_MPU_FIFO_REG, mpu_dev->fifo_buf, frames * PIOS_MPU_FRAME_SIZE) != 0)
+		return -1;
+
+	uint8_t decimation = MAX(mpu_dev->cfg->fifo_decimation, 1);
+
+	for (uint16_t i = 0; i < frames; i++) {
+		float raw[PIOS_MPU_RAW_NUM];
+		PIOS_MPU_UnpackFrame(&mpu_dev->fifo_buf[i * PIOS_MPU_FRAME_SIZE], raw);
+
+		if (decimation == 1) {
+			PIOS_MPU_PublishSample(raw, mpu_dev->sample_period_us);
+			continue;
+		}
+
+		if (mpu_dev->fifo_sum_count == 0) {
+			for (int j = 0; j < PIOS_MPU_RAW_NUM; j++)
+				mpu_dev->fifo_sum[j] = raw[j];
+		} else {
+			for (int j = 0; j < PIOS_MPU_RAW_NUM; j++)
+				mpu_dev->fifo_sum[j] += raw[j];
+		}
+
+		if (++mpu_dev->fifo_sum_count < decimation)
+			continue;
+
+		for (int j = 0; j < PIOS_MPU_RAW_NUM; j++)
+			raw[j] = mpu_dev->fifo_sum[j] / decimation;
+
+		mpu_dev->fifo_sum_count = 0;
+		PIOS_MPU_PublishSample(raw, mpu_dev->sample_period_us);
+	}
+
+	PIOS_SENSORS_Notify(PIOS_SENSOR_ACCEL);
+	PIOS_SENSORS_Notify(PIOS_SENSOR_GYRO);
+
+	return 0;
+}
+
+static void PIOS_MPU_Task(void *parameters)
+{
+	(void)parameters;
+
+	enum {
+		IDX_SPI_DUMMY_BYTE = 0,
+		IDX_ACCEL_XOUT_H,
+		IDX_MAG_ST1 = IDX_ACCEL_XOUT_H + PIOS_MPU_FRAME_SIZE,
+#ifdef PIOS_INCLUDE_MPU_MAG
+		BUFFER_SIZE = IDX_MAG_ST1 + 8
+#else
+		BUFFER_SIZE = IDX_MAG_ST1
 #endif // PIOS_INCLUDE_MPU_MAG
-		BUFFER_SIZE
 	};
 
 	uint8_t mpu_rec_buf[BUFFER_SIZE];
@@ -903,7 +1298,20 @@ static void PIOS_MPU_Task(void *parameters)
 		//Wait for data ready interrupt
 		if (PIOS_Semaphore_Take(mpu_dev->data_ready_sema, PIOS_SEMAPHORE_TIMEOUT_MAX) != true)
 			continue;
-		
+
+		if (mpu_dev->fifo_buf) {
+			PIOS_MPU_DrainFifo();
+
+#ifdef PIOS_INCLUDE_MPU_MAG
+			// the mag is still sampled into the registers following the gyro
+			if (mpu_dev->use_mag &&
+					PIOS_MPU_ReadBlock(PIOS_MPU_EXT_SENS_DATA_00, &mpu_rec_buf[IDX_MAG_ST1], 8) == 0)
+				PIOS_MPU_PublishMag(&mpu_rec_buf[IDX_MAG_ST1]);
+#endif // PIOS_INCLUDE_MPU_MAG
+
+			continue;
+		}
+
 #if defined(PIOS_INCLUDE_SPI)
 		if (mpu_dev->com_driver_type == PIOS_MPU_COM_SPI) {
 			// claim bus in high speed mode
@@ -927,186 +1335,20 @@ static void PIOS_MPU_Task(void *parameters)
 		}
 #endif // defined(PIOS_INCLUDE_I2C)
 
-		struct pios_sensor_accel_data accel_data;
-		struct pios_sensor_gyro_data gyro_data;
-
-		float accel_x = (int16_t)(mpu_rec_buf[IDX_ACCEL_XOUT_H] << 8 | mpu_rec_buf[IDX_ACCEL_XOUT_L]);
-		float accel_y = (int16_t)(mpu_rec_buf[IDX_ACCEL_YOUT_H] << 8 | mpu_rec_buf[IDX_ACCEL_YOUT_L]);
-		float accel_z = (int16_t)(mpu_rec_buf[IDX_ACCEL_ZOUT_H] << 8 | mpu_rec_buf[IDX_ACCEL_ZOUT_L]);
-		float gyro_x = (int16_t)(mpu_rec_buf[IDX_GYRO_XOUT_H] << 8 | mpu_rec_buf[IDX_GYRO_XOUT_L]);
-		float gyro_y = (int16_t)(mpu_rec_buf[IDX_GYRO_YOUT_H] << 8 | mpu_rec_buf[IDX_GYRO_YOUT_L]);
-		float gyro_z = (int16_t)(mpu_rec_buf[IDX_GYRO_ZOUT_H] << 8 | mpu_rec_buf[IDX_GYRO_ZOUT_L]);
+		uint32_t now = PIOS_DELAY_GetRaw();
+		uint32_t dt_us = PIOS_DELAY_DiffuS2(mpu_dev->last_sample_raw, now);
+		mpu_dev->last_sample_raw = now;
 
-#ifdef PIOS_INCLUDE_MPU_MAG
-		struct pios_sensor_mag_data mag_data;
+		float raw[PIOS_MPU_RAW_NUM];
+		PIOS_MPU_UnpackFrame(&mpu_rec_buf[IDX_ACCEL_XOUT_H], raw);
+		PIOS_MPU_PublishSample(raw, dt_us);
 
-		float mag_x = (int16_t)(mpu_rec_buf[IDX_MAG_XOUT_H] << 8 | mpu_rec_buf[IDX_MAG_XOUT_L]);
-		float mag_y = (int16_t)(mpu_rec_buf[IDX_MAG_YOUT_H] << 8 | mpu_rec_buf[IDX_MAG_YOUT_L]);
-		float mag_z = (int16_t)(mpu_rec_buf[IDX_MAG_ZOUT_H] << 8 | mpu_rec_buf[IDX_MAG_ZOUT_L]);
-#endif // PIOS_INCLUDE_MPU_MAG
+		PIOS_SENSORS_Notify(PIOS_SENSOR_ACCEL);
+		PIOS_SENSORS_Notify(PIOS_SENSOR_GYRO);
 
-		// Rotate the sensor to our convention.  The datasheet defines X as towards the right
-		// and Y as forward. Our convention transposes this.  Also the Z is defined negatively
-		// to our convention. This is true for accels and gyros. Magnetometer corresponds our convention.
-		switch (mpu_dev->cfg->orientation) {
-		case PIOS_MPU_TOP_0DEG:
-			accel_data.y = accel_x;
-			accel_data.x = accel_y;
-			accel_data.z = -accel_z;
-			gyro_data.y  = gyro_x;
-			gyro_data.x  = gyro_y;
-			gyro_data.z  = -gyro_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = mag_x;
-			mag_data.y   = mag_y;
-			mag_data.z   = mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-		case PIOS_MPU_TOP_90DEG:
-			accel_data.y = -accel_y;
-			accel_data.x = accel_x;
-			accel_data.z = -accel_z;
-			gyro_data.y  = -gyro_y;
-			gyro_data.x  = gyro_x;
-			gyro_data.z  = -gyro_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = -mag_y;
-			mag_data.y   = mag_x;
-			mag_data.z   = mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-		case PIOS_MPU_TOP_180DEG:
-			accel_data.y = -accel_x;
-			accel_data.x = -accel_y;
-			accel_data.z = -accel_z;
-			gyro_data.y  = -gyro_x;
-			gyro_data.x  = -gyro_y;
-			gyro_data.z  = -gyro_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = -mag_x;
-			mag_data.y   = -mag_y;
-			mag_data.z   = mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-		case PIOS_MPU_TOP_270DEG:
-			accel_data.y = accel_y;
-			accel_data.x = -accel_x;
-			accel_data.z = -accel_z;
-			gyro_data.y  = gyro_y;
-			gyro_data.x  = -gyro_x;
-			gyro_data.z  = -gyro_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = mag_y;
-			mag_data.y   = -mag_x;
-			mag_data.z   = mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-		case PIOS_MPU_BOTTOM_0DEG:
-			accel_data.y = -accel_x;
-			accel_data.x = accel_y;
-			accel_data.z = accel_z;
-			gyro_data.y  = -gyro_x;
-			gyro_data.x  = gyro_y;
-			gyro_data.z  = gyro_z;
 #ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = mag_x;
-			mag_data.y   = -mag_y;
-			mag_data.z   = -mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-
-		case PIOS_MPU_BOTTOM_90DEG:
-			accel_data.y = -accel_y;
-			accel_data.x = -accel_x;
-			accel_data.z = accel_z;
-			gyro_data.y  = -gyro_y;
-			gyro_data.x  = -gyro_x;
-			gyro_data.z  = gyro_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = -mag_y;
-			mag_data.y   = -mag_x;
-			mag_data.z   = -mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-
-		case PIOS_MPU_BOTTOM_180DEG:
-			accel_data.y = accel_x;
-			accel_data.x = -accel_y;
-			accel_data.z = accel_z;
-			gyro_data.y  = gyro_x;
-			gyro_data.x  = -gyro_y;
-			gyro_data.z  = gyro_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = -mag_x;
-			mag_data.y   = mag_y;
-			mag_data.z   = -mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-
-		case PIOS_MPU_BOTTOM_270DEG:
-			accel_data.y = accel_y;
-			accel_data.x = accel_x;
-			gyro_data.y  = gyro_y;
-			gyro_data.x  = gyro_x;
-			gyro_data.z  = gyro_z;
-			accel_data.z = accel_z;
-#ifdef PIOS_INCLUDE_MPU_MAG
-			mag_data.x   = mag_y;
-			mag_data.y   = mag_x;
-			mag_data.z   = -mag_z;
-#endif // PIOS_INCLUDE_MPU_MAG
-			break;
-		}
-
-		int16_t raw_temp = (int16_t)(mpu_rec_buf[IDX_TEMP_OUT_H] << 8 | mpu_rec_buf[IDX_TEMP_OUT_L]);
-		float temperature;
-		if (mpu_dev->mpu_type == PIOS_MPU6500 || mpu_dev->mpu_type == PIOS_MPU9250)
-			temperature = 21.0f + ((float)raw_temp) / 333.87f;
-		else
-			temperature = 35.0f + ((float)raw_temp + 512.0f) / 340.0f;
-
-		// Apply sensor scaling
-		float accel_scale = PIOS_MPU_GetAccelScale();
-		accel_data.x *= accel_scale;
-		accel_data.y *= accel_scale;
-		accel_data.z *= accel_scale;
-		accel_data.temperature = temperature;
-
-		float gyro_scale = PIOS_MPU_GetGyroScale();
-		gyro_data.x *= gyro_scale;
-		gyro_data.y *= gyro_scale;
-		gyro_data.z *= gyro_scale;
-		gyro_data.temperature = temperature;
-
-		PIOS_Queue_Send(mpu_dev->accel_queue, &accel_data, 0);
-		PIOS_Queue_Send(mpu_dev->gyro_queue, &gyro_data, 0);
-
-#ifdef PIOS_INCLUDE_MPU_MAG
-		if (mpu_dev->use_mag) {
-			// check data ready
-			bool mag_ok = mpu_rec_buf[IDX_MAG_ST1] & PIOS_MPU_AK89XX_ST1_DRDY;
-			// check for overflow
-			mag_ok &= !(mpu_rec_buf[IDX_MAG_ST2] & PIOS_MPU_AK89XX_ST2_HOFL);
-			// check for data error on mpu-9150
-			mag_ok &= (mpu_dev->mpu_type != PIOS_MPU9150 || !(mpu_rec_buf[IDX_MAG_ST2] & PIOS_MPU_AK8975_ST2_DERR));
-			if (mag_ok) {
-				float mag_scale;
-				if (mpu_dev->mpu_type == PIOS_MPU9150)
-					mag_scale = 3.0f; // 12-bit sampling
-				else if (mpu_rec_buf[IDX_MAG_ST2] & PIOS_MPU_AK8963_ST2_BITM)
-					mag_scale = 1.5f; // 16-bit sampling
-				else
-					mag_scale = 6.0f; // 14-bit sampling
-				mag_data.x *= mag_scale;
-				mag_data.y *= mag_scale;
-				mag_data.z *= mag_scale;
-				PIOS_Queue_Send(mpu_dev->mag_queue, &mag_data, 0);
-
-				// trigger another sample
-				if (mpu_dev->mpu_type == PIOS_MPU9150)
-					PIOS_MPU_Mag_WriteReg(PIOS_MPU_AK89XX_CNTL1_REG, PIOS_MPU_AK8975_MODE_SINGLE_12B);
-			}
-		}
+		if (mpu_dev->use_mag)
+			PIOS_MPU_PublishMag(&mpu_rec_buf[IDX_MAG_ST1]);
 #endif // PIOS_INCLUDE_MPU_MAG
 	}
 }
@@ -68,6 +68,19 @@ struct pios_semaphore *PIOS_Semaphore_Create(void)
 	return sema;
 }
 
+/**
+ *
+ * @brief   Destroys an instance of @p struct pios_semaphore
+ *
+ * @param[in] sema         pointer to instance of @p struct pios_semaphore
+ *
+ */
+void PIOS_Semaphore_Delete(struct pios_semaphore *sema)
+{
+	vSemaphoreDelete((xSemaphoreHandle)sema->sema_handle);
+	PIOS_free(sema);
+}
+
 /**
  *
  * @brief   Takes binary semaphore.
@@ -182,6 +195,18 @@ struct pios_semaphore *PIOS_Semaphore_Create(void)
 	return sema;
 }
 
+/**
+ *
+ * @brief   Destroys an instance of @p struct pios_semaphore
+ *
+ * @param[in] sema         pointer to instance of @p struct pios_semaphore
+ *
+ */
+void PIOS_Semaphore_Delete(struct pios_semaphore *sema)
+{
+	PIOS_free(sema);
+}
+
 /**
  *
  * @brief   Takes binary semaphore.
@@ -285,6 +310,18 @@ struct pios_semaphore *PIOS_Semaphore_Create(void)
 	return sema;
 }
 
+/**
+ *
+ * @brief   Destroys an instance of @p struct pios_semaphore
+ *
+ * @param[in] sema         pointer to instance of @p struct pios_semaphore
+ *
+ */
+void PIOS_Semaphore_Delete(struct pios_semaphore *sema)
+{
+	PIOS_free(sema);
+}
+
 /**
  *
  * @brief   Takes binary semaphore.
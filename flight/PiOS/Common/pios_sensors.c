@@ -32,10 +32,26 @@
 // lower driver (??)
 
 #include "pios_sensors.h"
+#include "pios_semaphore.h"
+#include "pios_thread.h"
+#include "misc_math.h"
+#include <circqueue.h>
 #include <stddef.h>
 
+/*
+ * Gyros and accels may pass their samples through a ring instead of a queue.
+ * The driver pushes a block of samples and wakes the reader once, and the
+ * reader takes everything pending in one go.  There is one writer and one
+ * reader per ring, so circqueue needs no locking.
+ */
+struct pios_sensor_ring {
+	circ_queue_t samples;
+	struct pios_semaphore *data_ready;
+};
+
 //! The list of queue handles
 static struct pios_queue *queues[PIOS_SENSOR_LAST];
+static struct pios_sensor_ring rings[PIOS_SENSOR_LAST];
 static uint32_t sample_rates[PIOS_SENSOR_LAST];
 static int32_t max_gyro_rate;
 
@@ -44,6 +60,8 @@ int32_t PIOS_SENSORS_Init()
 {
 	for (uint32_t i = 0; i < PIOS_SENSOR_LAST; i++) {
 		queues[i] = NULL;
+		rings[i].samples = NULL;
+		rings[i].data_ready = NULL;
 		sample_rates[i] = 0;
 	}
 
@@ -67,7 +85,7 @@ bool PIOS_SENSORS_IsRegistered(enum pios_sensor_type type)
 	if(type >= PIOS_SENSOR_LAST)
 		return false;
 
-	if(queues[type] != NULL)
+	if(queues[type] != NULL || rings[type].samples != NULL)
 		return true;
 
 	return false;
@@ -82,6 +100,134 @@ struct pios_queue *PIOS_SENSORS_GetQueue(enum pios_sensor_type type)
 	return queues[type];
 }
 
+/**
+ * Create a sample ring for a gyro or accel and register it with the
+ * PIOS_SENSORS interface
+ * @param[in] type PIOS_SENSOR_GYRO or PIOS_SENSOR_ACCEL
+ * @param[in] num_samples Samples the ring can hold
+ * @return 0 if successful, -1 otherwise
+ */
+int32_t PIOS_SENSORS_RegisterRing(enum pios_sensor_type type, uint16_t num_samples)
+{
+	if (type != PIOS_SENSOR_GYRO && type != PIOS_SENSOR_ACCEL)
+		return -1;
+
+	if (queues[type] != NULL || rings[type].samples != NULL)
+		return -1;
+
+	struct pios_semaphore *data_ready = PIOS_Semaphore_Create();
+	if (data_ready == NULL)
+		return -1;
+
+	// one slot is always left empty
+	circ_queue_t samples = circ_queue_new(sizeof(struct pios_sensor_sample), num_samples + 1);
+	if (samples == NULL) {
+		PIOS_Semaphore_Delete(data_ready);
+		return -1;
+	}
+
+	rings[type].data_ready = data_ready;
+	rings[type].samples = samples;
+
+	return 0;
+}
+
+//! Checks if a sensor type passes its samples through a ring rather than a queue
+bool PIOS_SENSORS_HasRing(enum pios_sensor_type type)
+{
+	if (type >= PIOS_SENSOR_LAST)
+		return false;
+
+	return rings[type].samples != NULL;
+}
+
+/**
+ * Add a sample to the ring of a sensor type.  The reader is not woken until
+ * PIOS_SENSORS_Notify, so a driver reading several samples at once pushes
+ * them all and then notifies once.  Must not be called from an interrupt.
+ * @param[in] type The sensor type
+ * @param[in] sample The sample
+ * @return true if the sample was added, false if the ring is full
+ */
+bool PIOS_SENSORS_Push(enum pios_sensor_type type, const struct pios_sensor_sample *sample)
+{
+	if (!PIOS_SENSORS_HasRing(type))
+		return false;
+
+	return circ_queue_write_data(rings[type].samples, sample, 1) == 1;
+}
+
+//! Wake the reader of a sensor ring once a block of samples has been pushed
+void PIOS_SENSORS_Notify(enum pios_sensor_type type)
+{
+	if (!PIOS_SENSORS_HasRing(type))
+		return;
+
+	PIOS_Semaphore_Give(rings[type].data_ready);
+}
+
+/**
+ * Take all pending samples from a sensor ring and average them.  Each sample
+ * is weighted by the time since the one before it, so samples arriving
+ * unevenly, or some being lost, do not skew the result.  Waits for a sample
+ * if none are pending.
+ * @param[in] type The sensor type
+ * @param[out] average The average, with dt_us the time covered by it
+ * @param[in] timeout_ms How long to wait for a sample
+ * @return true if there was at least one sample, false otherwise
+ */
+bool PIOS_SENSORS_ReadAverage(enum pios_sensor_type type, struct pios_sensor_sample *average, uint32_t timeout_ms)
+{
+	if (!PIOS_SENSORS_HasRing(type))
+		return false;
+
+	struct pios_sensor_ring *ring = &rings[type];
+
+	uint16_t contig;
+	struct pios_sensor_sample *sample = circ_queue_read_pos(ring->samples, &contig, NULL);
+
+	// A notify left over from samples already taken wakes us early, so
+	// keep waiting until there is something to read
+	uint32_t start_ms = PIOS_Thread_Systime();
+	while (sample == NULL) {
+		uint32_t waited_ms = PIOS_Thread_Systime() - start_ms;
+		if (waited_ms >= timeout_ms ||
+				!PIOS_Semaphore_Take(ring->data_ready, timeout_ms - waited_ms))
+			return false;
+
+		sample = circ_queue_read_pos(ring->samples, &contig, NULL);
+	}
+
+	float sum[4] = { 0, 0, 0, 0 };
+	uint32_t sum_dt_us = 0;
+
+	// the gyro and accel data have the same layout
+	while (sample != NULL) {
+		for (uint16_t i = 0; i < contig; i++) {
+			// the first sample from a driver has no time before it
+			uint32_t weight = MAX(sample[i].dt_us, 1);
+
+			sum[0] += sample[i].data.gyro.x * weight;
+			sum[1] += sample[i].data.gyro.y * weight;
+			sum[2] += sample[i].data.gyro.z * weight;
+			sum[3] += sample[i].data.gyro.temperature * weight;
+			sum_dt_us += weight;
+		}
+
+		circ_queue_read_completed_multi(ring->samples, contig);
+
+		sample = circ_queue_read_pos(ring->samples, &contig, NULL);
+	}
+
+	average->dt_us = sum_dt_us;
+	average->data.gyro.x = sum[0] / sum_dt_us;
+	average->data.gyro.y = sum[1] / sum_dt_us;
+	average->data.gyro.z = sum[2] / sum_dt_us;
+	average->data.gyro.temperature = sum[3] / sum_dt_us;
+
+	return true;
+}
+
 //! Set the maximum gyro rate in deg/s
 void PIOS_SENSORS_SetMaxGyro(int32_t rate)
 {
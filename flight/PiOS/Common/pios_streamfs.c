@@ -29,6 +29,7 @@
 #include "pios.h"
 
 #include "pios_flash.h"		     /* PIOS_FLASH_* */
+#include "pios_streamfs.h"      /* External API */
 #include "pios_streamfs_priv.h" /* Internal API */
 #include "pios_mutex.h"
 #include "pios_semaphore.h"
@@ -36,6 +37,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>		/* NULL */
+#include <string.h>		/* memcpy */
 
 #define MIN(x,y) ((x) < (y) ? (x) : (y))
 
@@ -51,6 +53,12 @@
  * sector has a footer to indicate the file id and the sector id.
  *
  * Arenas map onto sectors. 
+ *
+ * Appended data is gathered into a buffer of one flash page and only
+ * programmed once the page is complete, so each program operation writes a
+ * whole aligned page however small the pieces handed to streamfs are.  The
+ * flash drivers program synchronously, so the data arriving meanwhile waits
+ * in the PIOS_COM buffer, which acts as the other half of a double buffer.
  */
 
 #include <pios_com.h>
@@ -98,6 +106,13 @@ struct streamfs_state {
 	int32_t active_file_arena;
 	int32_t active_file_arena_offset;
 
+	/* Write cache for the page containing active_file_arena_offset */
+	uint8_t *page_buf;
+	uint16_t page_size;
+	uint16_t page_fill;
+
+	struct streamfs_stats stats;
+
 	/* Information about file system contents */
 	int32_t min_file_id;
 	int32_t max_file_id;
@@ -132,6 +147,38 @@ struct streamfs_footer {
 } __attribute__((packed));
 
 
+/**
+ * @brief Add the time since start to the time spent waiting on the flash
+ */
+static void streamfs_account_stall(struct streamfs_state *streamfs, uint32_t start)
+{
+	uint32_t stall_us = PIOS_DELAY_DiffuS(start);
+
+	streamfs->stats.stall_us += stall_us;
+	if (stall_us > streamfs->stats.max_stall_us) {
+		streamfs->stats.max_stall_us = stall_us;
+	}
+}
+
+/**
+ * @brief Program data into the flash, keeping statistics
+ * @return 0 if success, < 0 on failure
+ * @note Must be called while holding the flash transaction lock
+ */
+static int32_t streamfs_program(struct streamfs_state *streamfs, uint32_t addr, const uint8_t *data, uint16_t len)
+{
+	uint32_t start = PIOS_DELAY_GetRaw();
+
+	int32_t rc = PIOS_FLASH_write_data(streamfs->partition_id, addr, data, len);
+
+	streamfs_account_stall(streamfs, start);
+
+	streamfs->stats.bytes_programmed += len;
+	streamfs->stats.program_ops++;
+
+	return rc;
+}
+
 /****************************************
  * Arena life-cycle transition functions
  ****************************************/
@@ -141,12 +188,18 @@ struct streamfs_footer {
  * @return 0 if success, < 0 on failure
  * @note Must be called while holding the flash transaction lock
  */
-static int32_t streamfs_erase_arena(const struct streamfs_state *streamfs, uint32_t arena_id)
+static int32_t streamfs_erase_arena(struct streamfs_state *streamfs, uint32_t arena_id)
 {
 	uintptr_t arena_addr = streamfs_get_addr(streamfs, arena_id, 0);
 
+	uint32_t start = PIOS_DELAY_GetRaw();
+
 	/* Erase all of the sectors in the arena */
-	if (PIOS_FLASH_erase_range(streamfs->partition_id, arena_addr, streamfs->cfg->arena_size) != 0) {
+	int32_t rc = PIOS_FLASH_erase_range(streamfs->partition_id, arena_addr, streamfs->cfg->arena_size);
+
+	streamfs_account_stall(streamfs, start);
+
+	if (rc != 0) {
 		return -1;
 	}
 
@@ -159,7 +212,7 @@ static int32_t streamfs_erase_arena(const struct streamfs_state *streamfs, uint3
  * @return 0 if success, < 0 on failure
  * @note Must be called while holding the flash transaction lock
  */
-static int32_t streamfs_erase_all_arenas(const struct streamfs_state *streamfs)
+static int32_t streamfs_erase_all_arenas(struct streamfs_state *streamfs)
 {
 	uint32_t num_arenas = streamfs->partition_size / streamfs->cfg->arena_size;
 
@@ -184,6 +237,9 @@ static struct streamfs_state *streamfs_alloc(void)
 	if (!streamfs) return (NULL);
 
 	streamfs->magic = PIOS_FLASHFS_STREAMFS_DEV_MAGIC;
+	streamfs->page_buf = NULL;
+	streamfs->page_fill = 0;
+	memset(&streamfs->stats, 0, sizeof(streamfs->stats));
 	return(streamfs);
 }
 
@@ -203,7 +259,7 @@ static int32_t streamfs_new_sector(struct streamfs_state *streamfs)
 	uint32_t start_address = streamfs_get_addr(streamfs, streamfs->active_file_arena,
 			                                   streamfs->cfg->arena_size - sizeof(footer));
 
-	if (PIOS_FLASH_write_data(streamfs->partition_id, start_address, (uint8_t *) &footer, sizeof(footer)) != 0) {
+	if (streamfs_program(streamfs, start_address, (uint8_t *) &footer, sizeof(footer)) != 0) {
 		return -1;
 	}
 
@@ -246,7 +302,7 @@ static int32_t streamfs_close_sector(struct streamfs_state *streamfs)
 	uint32_t start_address = streamfs_get_addr(streamfs, streamfs->active_file_arena,
 			                                   streamfs->cfg->arena_size - sizeof(footer));
 
-	if (PIOS_FLASH_write_data(streamfs->partition_id, start_address, (uint8_t *) &footer, sizeof(footer)) != 0) {
+	if (streamfs_program(streamfs, start_address, (uint8_t *) &footer, sizeof(footer)) != 0) {
 		return -1;
 	}
 
@@ -357,6 +413,28 @@ static int32_t streamfs_find_new_sector(struct streamfs_state *streamfs)
 	return (last_sector + 1) % num_arenas;
 }
 
+/**
+ * Program the cached part of the current page
+ */
+/* NOTE: Must be called while holding the flash transaction lock */
+static int32_t streamfs_flush_page(struct streamfs_state *streamfs)
+{
+	if (streamfs->page_fill == 0) {
+		return 0;
+	}
+
+	uint32_t start_address = streamfs_get_addr(streamfs, streamfs->active_file_arena,
+			streamfs->active_file_arena_offset - streamfs->page_fill);
+
+	if (streamfs_program(streamfs, start_address, streamfs->page_buf, streamfs->page_fill) != 0) {
+		return -1;
+	}
+
+	streamfs->page_fill = 0;
+
+	return 0;
+}
+
 /* NOTE: Must be called while holding the flash transaction lock */
 static int32_t streamfs_append_to_file(struct streamfs_state *streamfs, uint8_t *data, uint32_t len)
 {
@@ -366,30 +444,32 @@ static int32_t streamfs_append_to_file(struct streamfs_state *streamfs, uint8_t
 	if (streamfs->file_open_reading)
 		return -2;
 
+	const uint32_t data_size = streamfs->cfg->arena_size - sizeof(struct streamfs_footer);
 	uint32_t total_written = 0;
 
 	while (len > 0) {
-		uint32_t start_address = streamfs_get_addr(streamfs, streamfs->active_file_arena,
-			                                                 streamfs->active_file_arena_offset);
+		// Fill up to the end of the page, without running into the footer
+		uint32_t page_end = streamfs->active_file_arena_offset - streamfs->page_fill + streamfs->page_size;
+		uint32_t bytes_to_write = MIN(len, MIN(page_end, data_size) - streamfs->active_file_arena_offset);
 
-		// Make sure not to write into the space for the footer
-		uint32_t bytes_to_write = len;
-		if ((streamfs->active_file_arena_offset + bytes_to_write) > (streamfs->cfg->arena_size - sizeof(struct streamfs_footer))) {
-			bytes_to_write = streamfs->cfg->arena_size - sizeof(struct streamfs_footer) - streamfs->active_file_arena_offset;
-		}
-
-		if (PIOS_FLASH_write_data(streamfs->partition_id, start_address, data, bytes_to_write) != 0) {
-			return -3;
-		}
+		memcpy(&streamfs->page_buf[streamfs->page_fill], data, bytes_to_write);
 
 		// Increment pointers
+		streamfs->page_fill += bytes_to_write;
 		streamfs->active_file_arena_offset += bytes_to_write;
+		streamfs->stats.bytes_written += bytes_to_write;
 		len -= bytes_to_write;
 		total_written += bytes_to_write;
 		data = &data[bytes_to_write];
 
+		if (streamfs->active_file_arena_offset == page_end ||
+				streamfs->active_file_arena_offset >= data_size) {
+			if (streamfs_flush_page(streamfs) != 0) {
+				return -3;
+			}
+		}
 
-		if (streamfs->active_file_arena_offset >= (streamfs->cfg->arena_size - sizeof(struct streamfs_footer))) {
+		if (streamfs->active_file_arena_offset >= data_size) {
 			if (streamfs_new_sector(streamfs) != 0) {
 				return -4;
 			}
@@ -399,6 +479,30 @@ static int32_t streamfs_append_to_file(struct streamfs_state *streamfs, uint8_t
 	return total_written;
 }
 
+/**
+ * Append everything still waiting in the PIOS_COM buffer to the file
+ */
+/* NOTE: Must be called while holding the mutex and the flash transaction lock */
+static int32_t streamfs_append_pending(struct streamfs_state *streamfs)
+{
+	if (!streamfs->tx_out_cb) {
+		return 0;
+	}
+
+	uint16_t bytes_to_write;
+	while ((bytes_to_write = (streamfs->tx_out_cb)(
+			streamfs->tx_out_context,
+			streamfs->com_buffer,
+			streamfs->cfg->write_size,
+			NULL, NULL)) > 0) {
+		if (streamfs_append_to_file(streamfs, streamfs->com_buffer, bytes_to_write) < 0) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
 /* NOTE: Must be called while holding the flash transaction lock */
 static int32_t streamfs_read_from_file(struct streamfs_state *streamfs, uint8_t *data, uint32_t len)
 {
@@ -554,7 +658,7 @@ static void PIOS_STREAMFS_Task(void *parameters)
 		// Flush available data from PIOS_COM interface to
 		// file system
 		while (bytes_to_write > 0) {
-			if (streamfs_append_to_file(streamfs, streamfs->com_buffer, bytes_to_write) != 0) {
+			if (streamfs_append_to_file(streamfs, streamfs->com_buffer, bytes_to_write) < 0) {
 				break;
 			}
 
@@ -617,6 +721,23 @@ int32_t PIOS_STREAMFS_Init(uintptr_t *fs_id, const struct streamfs_cfg *cfg, enu
 		return -1;
 	}
 
+	/* Cache a page at a time, page boundaries fall at the same offsets in every arena */
+	uint32_t page_size;
+	if (PIOS_FLASH_get_page_size(partition_id, &page_size) != 0) {
+		PIOS_free(streamfs->com_buffer);
+		PIOS_free(streamfs);
+		return -1;
+	}
+	PIOS_Assert((cfg->arena_size % page_size) == 0);
+
+	streamfs->page_size = page_size;
+	streamfs->page_buf = (uint8_t *)PIOS_malloc(page_size);
+	if (!streamfs->page_buf) {
+		PIOS_free(streamfs->com_buffer);
+		PIOS_free(streamfs);
+		return -1;
+	}
+
 	/* Bind configuration parameters to this filesystem instance */
 	streamfs->cfg            = cfg;	/* filesystem configuration */
 	streamfs->partition_id   = partition_id; /* underlying partition */
@@ -763,6 +884,7 @@ int32_t PIOS_STREAMFS_OpenWrite(uintptr_t fs_id)
 	streamfs->active_file_segment = 0;
 	streamfs->active_file_arena = streamfs_find_new_sector(streamfs);
 	streamfs->active_file_arena_offset = 0;
+	streamfs->page_fill = 0;
 	streamfs->file_open_writing = true;
 
 	// Erase this sector to prepare for streaming
@@ -906,6 +1028,19 @@ int32_t PIOS_STREAMFS_Close(uintptr_t fs_id)
 		goto out_exit;
 	}
 
+	// The task only drains the COM buffer when woken, pick up what the
+	// logger queued before closing so the end of the file is not lost
+	if (streamfs_append_pending(streamfs) != 0) {
+		rc = -3;
+		goto out_end_trans;
+	}
+
+	// Program the partly filled page
+	if (streamfs_flush_page(streamfs) != 0) {
+		rc = -3;
+		goto out_end_trans;
+	}
+
 	if (streamfs->active_file_arena_offset != 0) {
 		// Close segment when something has been written. This avoids creating
 		// null files with an open/close operation
@@ -915,8 +1050,6 @@ int32_t PIOS_STREAMFS_Close(uintptr_t fs_id)
 		}
 	}
 
-
-	// TODO: make sure to flush remaining data
 	streamfs->file_open_writing = false;
 
 	if (streamfs_scan_filesystem(streamfs) != 0) {
@@ -937,6 +1070,27 @@ out_exit:
 	return rc;
 }
 
+/**
+ * Get statistics about the data written since initialization
+ *
+ * @param[in] fs_id the streaming device handle
+ * @param[out] stats the statistics
+ * @returns 0 if successful, <0 if not
+ */
+int32_t PIOS_STREAMFS_GetStats(uintptr_t fs_id, struct streamfs_stats *stats)
+{
+	struct streamfs_state *streamfs = (struct streamfs_state *)
+		PIOS_COM_GetDriverCtx(fs_id);
+
+	if (!streamfs_validate(streamfs)) {
+		return -1;
+	}
+
+	*stats = streamfs->stats;
+
+	return 0;
+}
+
 /* Read API */
 
 int32_t PIOS_STREAMFS_Read(uintptr_t fs_id, uint8_t *data, uint32_t len) {
@@ -52,6 +52,8 @@ extern int32_t PIOS_COM_SendCharNonBlocking(uintptr_t com_id, char c);
 extern int32_t PIOS_COM_SendChar(uintptr_t com_id, char c);
 extern int32_t PIOS_COM_SendBufferNonBlocking(uintptr_t com_id, const uint8_t *buffer, uint16_t len);
 extern int32_t PIOS_COM_SendBuffer(uintptr_t com_id, const uint8_t *buffer, uint16_t len);
+extern uint8_t *PIOS_COM_ReserveTxBuffer(uintptr_t com_id, uint16_t len);
+extern int32_t PIOS_COM_CommitTxBuffer(uintptr_t com_id, uint16_t len);
 extern int32_t PIOS_COM_SendStringNonBlocking(uintptr_t com_id, const char *str);
 extern int32_t PIOS_COM_SendString(uintptr_t com_id, const char *str);
 extern int32_t PIOS_COM_SendFormattedStringNonBlocking(uintptr_t com_id, const char *format, ...);
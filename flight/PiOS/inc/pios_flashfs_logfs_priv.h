@@ -28,6 +28,7 @@
 #define PIOS_FLASHFS_LOGFS_PRIV_H_
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "pios_flash.h"		/* struct pios_flash_driver */
 
 /**
@@ -40,6 +41,8 @@ struct flashfs_logfs_cfg {
 	uint32_t fs_magic;
 	uint32_t arena_size;	/* Max size of one generation of the filesystem */
 	uint32_t slot_size;	/* Max size of a "file" within the filesystem */
+	bool use_index;		/* Index the slots in RAM, 6 bytes per slot */
+	bool use_copy_buf;	/* Copy slots through a RAM buffer of one flash page */
 };
 
 int32_t PIOS_FLASHFS_Logfs_Init(uintptr_t * fs_id, const struct flashfs_logfs_cfg * cfg, enum pios_flash_partition_labels partition_label);
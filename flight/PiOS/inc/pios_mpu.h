@@ -118,6 +118,8 @@ struct pios_mpu_cfg {
 
 	uint16_t default_samplerate;
 	enum pios_mpu_orientation orientation;
+	uint8_t fifo_burst;		/* Samples to collect in the FIFO per wakeup, 0 to read the data registers for each sample */
+	uint8_t fifo_decimation;	/* In FIFO mode, samples averaged into each one passed on, 0 or 1 for none */
 #ifdef PIOS_INCLUDE_MPU_MAG
 	bool use_internal_mag;		/* Flag to indicate whether or not to use the internal mag on MPU9x50 devices */
 #endif // PIOS_INCLUDE_MPU_MAG
@@ -66,6 +66,7 @@
 #define PIOS_MPU_GYRO_Y_OUT_LSB       0x46
 #define PIOS_MPU_GYRO_Z_OUT_MSB       0x47
 #define PIOS_MPU_GYRO_Z_OUT_LSB       0x48
+#define PIOS_MPU_EXT_SENS_DATA_00     0x49
 #define PIOS_MPU_SIGNAL_PATH_RESET    0x68
 #define PIOS_MPU_USER_CTRL_REG        0x6A
 #define PIOS_MPU_PWR_MGMT_REG         0x6B
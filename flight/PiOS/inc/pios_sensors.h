@@ -80,6 +80,15 @@ struct pios_sensor_baro_data {
 	float altitude;
 };
 
+//! A gyro or accel sample passed through a sensor ring
+struct pios_sensor_sample {
+	uint32_t dt_us;		//!< Time since the previous sample from the same sensor
+	union {
+		struct pios_sensor_gyro_data gyro;
+		struct pios_sensor_accel_data accel;
+	} data;
+};
+
 //! The types of sensors this module supports
 enum pios_sensor_type
 {
@@ -104,6 +113,21 @@ bool PIOS_SENSORS_IsRegistered(enum pios_sensor_type type);
 //! Get the data queue for a sensor type
 struct pios_queue *PIOS_SENSORS_GetQueue(enum pios_sensor_type type);
 
+//! Create a sample ring for a gyro or accel and register it with the PIOS_SENSORS interface
+int32_t PIOS_SENSORS_RegisterRing(enum pios_sensor_type type, uint16_t num_samples);
+
+//! Checks if a sensor type passes its samples through a ring rather than a queue
+bool PIOS_SENSORS_HasRing(enum pios_sensor_type type);
+
+//! Add a sample to the ring of a sensor type, without waking the reader
+bool PIOS_SENSORS_Push(enum pios_sensor_type type, const struct pios_sensor_sample *sample);
+
+//! Wake the reader of a sensor ring once a block of samples has been pushed
+void PIOS_SENSORS_Notify(enum pios_sensor_type type);
+
+//! Take all pending samples from a sensor ring and average them over time
+bool PIOS_SENSORS_ReadAverage(enum pios_sensor_type type, struct pios_sensor_sample *average, uint32_t timeout_ms);
+
 //! Set the maximum gyro rate in deg/s
 void PIOS_SENSORS_SetMaxGyro(int32_t rate);
 
@@ -29,6 +29,14 @@
 
 #include <stdint.h>
 
+struct streamfs_stats {
+	uint32_t bytes_written;		/* Bytes appended to files */
+	uint32_t bytes_programmed;	/* Bytes programmed, including footers */
+	uint32_t program_ops;		/* Flash program operations */
+	uint32_t stall_us;		/* Time spent programming and erasing */
+	uint32_t max_stall_us;		/* Longest single program or erase */
+};
+
 /* fs_id here is actually the com driver ID, to avoid having to do too
  * much bookkeepin' */
 int32_t PIOS_STREAMFS_Format(uintptr_t fs_id);
@@ -38,6 +46,7 @@ int32_t PIOS_STREAMFS_MinFileId(uintptr_t fs_id);
 int32_t PIOS_STREAMFS_MaxFileId(uintptr_t fs_id);
 int32_t PIOS_STREAMFS_Close(uintptr_t fs_id);
 int32_t PIOS_STREAMFS_Read(uintptr_t fs_id, uint8_t *data, uint32_t len);
+int32_t PIOS_STREAMFS_GetStats(uintptr_t fs_id, struct streamfs_stats *stats);
 
 
 #endif	/* PIOS_FLASHFS_STREAMFS_H_ */
@@ -44,6 +44,15 @@ typedef struct {
 	uint32_t eventErrors;
 } EventStats;
 
+/**
+ * Scheduling jitter of one periodic event
+ */
+typedef struct {
+	uint32_t objId; /** Object the event is for, or 0 */
+	uint16_t periodMs; /** Update period */
+	uint16_t maxJitterMs; /** Latest the event fired in the measurement window */
+} EventPeriodicJitter;
+
 // Public functions
 void EventGetStats(EventStats* statsOut);
 void EventClearStats();
@@ -51,6 +60,7 @@ int32_t EventPeriodicCallbackCreate(UAVObjEvent* ev, UAVObjEventCallback cb, uin
 int32_t EventPeriodicCallbackUpdate(UAVObjEvent* ev, UAVObjEventCallback cb, uint16_t periodMs);
 int32_t EventPeriodicQueueCreate(UAVObjEvent* ev, struct pios_queue *queue, uint16_t periodMs);
 int32_t EventPeriodicQueueUpdate(UAVObjEvent* ev, struct pios_queue *queue, uint16_t periodMs);
+uint16_t EventPeriodicGetJitter(EventPeriodicJitter* worst, uint8_t maxEntries, uint32_t* fired);
 
 #endif // EVENTDISPATCHER_H
 
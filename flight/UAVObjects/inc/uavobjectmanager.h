@@ -143,16 +143,42 @@ typedef struct {
 	uint32_t eventCallbackErrors;
 	uint32_t lastCallbackErrorID;
 	uint32_t lastQueueErrorID;
+	int32_t instanceMemorySaved; /** Heap bytes saved by chunked multi-instance storage vs. one allocation per instance */
+	uint32_t lockAcquisitions; /** Times the object manager lock was taken */
+	uint32_t lockContended; /** Lock acquisitions that had to wait for another task */
+	uint32_t lockWaitTotalUs; /** Total time spent waiting on the lock, in us */
+	uint32_t lockWaitMaxUs; /** Longest single wait on the lock, in us */
+	uint32_t seqlockReads; /** Lock-free reads of seqlocked objects */
+	uint32_t seqlockRetries; /** Lock-free reads that raced a writer and had to retry */
 } UAVObjStats;
 
+/* Objects whose dropped events are counted individually */
+#define UAVO_EVENT_DROP_SLOTS 4
+
+/**
+ * Event dispatcher statistics, counted from boot
+ */
+typedef struct {
+	uint32_t dispatched; /** Events handed to callbacks and queues */
+	uint32_t coalesced; /** Nested events folded into an identical pending one */
+	uint32_t suppressed; /** Events an object's callbacks raised on the same object */
+	uint32_t dropped; /** Nested events lost because the backlog was full */
+	uint8_t depth; /** Size of the nested event backlog */
+	uint8_t highWater; /** Most nested events ever waiting at once */
+	uint32_t dropObjIds[UAVO_EVENT_DROP_SLOTS]; /** First objects to have events dropped */
+	uint16_t dropCounts[UAVO_EVENT_DROP_SLOTS]; /** Events dropped for each of dropObjIds */
+} UAVObjEventStats;
+
 typedef void (*new_uavo_instance_cb_t)(uint32_t,uint32_t);
 void UAVObjRegisterNewInstanceCB(new_uavo_instance_cb_t callback);
 
 int32_t UAVObjInitialize();
 void UAVObjGetStats(UAVObjStats* statsOut);
 void UAVObjClearStats();
+void UAVObjGetEventStats(UAVObjEventStats* statsOut);
 UAVObjHandle UAVObjRegister(uint32_t id,
-		int32_t isSingleInstance, int32_t isSettings, uint32_t numBytes, UAVObjInitializeCallback initCb);
+		int32_t isSingleInstance, int32_t isSettings, int32_t isSeqLocked,
+		uint32_t numBytes, UAVObjInitializeCallback initCb);
 UAVObjHandle UAVObjGetByID(uint32_t id);
 uint32_t UAVObjGetID(UAVObjHandle obj);
 uint32_t UAVObjGetNumBytes(UAVObjHandle obj);
@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjectHandling UAVObject handling code
+ * @{
+ *
+ * @file       uavobjectshash.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Perfect hash over all data object IDs, used by the object
+ *             manager to look up objects by ID in constant time.
+ *             Automatically generated by the UAVObjectGenerator.
+ *
+ * @note       This is an automatically generated file.
+ *             DO NOT modify manually.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef UAVOBJECTSHASH_H
+#define UAVOBJECTSHASH_H
+
+#include <stdint.h>
+
+/*
+ * Two level "hash and displace" table.  The first multiplicative hash
+ * selects a bucket, whose displacement is XORed into the second hash to
+ * give a collision free slot.  Every data object ID maps to a distinct
+ * slot; IDs that are not in the table land on a slot holding another ID
+ * (or zero), so callers must compare against uavo_hash_ids[].
+ */
+#define UAVO_HASH_BITS        $(HASHBITS)
+#define UAVO_HASH_BUCKET_BITS $(BUCKETBITS)
+#define UAVO_HASH_SIZE        (1 << UAVO_HASH_BITS)
+#define UAVO_HASH_BUCKETS     (1 << UAVO_HASH_BUCKET_BITS)
+#define UAVO_HASH_MULT1       $(MULT1)
+#define UAVO_HASH_MULT2       $(MULT2)
+
+static const uint16_t uavo_hash_disp[UAVO_HASH_BUCKETS] = {
+$(DISPTABLE)
+};
+
+static const uint32_t uavo_hash_ids[UAVO_HASH_SIZE] = {
+$(IDTABLE)
+};
+
+static inline uint16_t uavo_hash_slot(uint32_t id)
+{
+	uint32_t bucket = (id * UAVO_HASH_MULT1) >> (32 - UAVO_HASH_BUCKET_BITS);
+	uint32_t slot = (id * UAVO_HASH_MULT2) >> (32 - UAVO_HASH_BITS);
+
+	return slot ^ uavo_hash_disp[bucket];
+}
+
+#endif /* UAVOBJECTSHASH_H */
+
+/**
+ * @}
+ * @}
+ */
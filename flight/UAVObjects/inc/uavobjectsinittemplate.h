@@ -33,6 +33,7 @@
 #define UAVOBJECTSINIT_H
 
 void UAVObjectsInitializeAll();
+const uint16_t *UAVObjectsFieldOffsets(uint32_t objId, uint8_t *numFields);
 
 #define UAVOBJECTS_LARGEST $(SIZECALCULATION)
 
@@ -48,6 +48,7 @@ $(PARENT_INCLUDES)
 #define $(NAMEUC)_OBJID $(OBJIDHEX)
 #define $(NAMEUC)_ISSINGLEINST $(ISSINGLEINST)
 #define $(NAMEUC)_ISSETTINGS $(ISSETTINGS)
+#define $(NAMEUC)_ISSEQLOCKED $(ISSEQLOCKED)
 #define $(NAMEUC)_NUMBYTES $(NUMBYTES)
 
 // Generic interface functions
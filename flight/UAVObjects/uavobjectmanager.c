@@ -39,12 +39,22 @@
 #include "pios_heap.h"		/* PIOS_malloc_no_dma */
 #include "pios_mutex.h"
 #include "pios_queue.h"
+#include "pios_delay.h"
 #include "misc_math.h"
+#include "uavobjectshash.h"	/* generated perfect hash of object IDs */
 
 extern uintptr_t pios_uavo_settings_fs_id;
 
 // Constants
 
+/* Waits on the lock longer than this are counted as contention */
+#define UAVO_LOCK_CONTENDED_US 2
+
+/* Events raised from within callbacks that may wait to be dispatched */
+#ifndef UAVO_EVENT_BACKLOG
+#define UAVO_EVENT_BACKLOG 8
+#endif
+
 // Private types
 
 // Macros
@@ -79,11 +89,12 @@ struct ObjectEventEntryThrottled {
 /*
   MetaInstance   == [UAVOBase [UAVObjMetadata]]
   SingleInstance == [UAVOBase [UAVOData [InstanceData]]]
-  MultiInstance  == [UAVOBase [UAVOData [NumInstances [InstanceData0 [next]]]]
-                                                  ____________________/
-                                                  \-->[InstanceData1 [next]]
-                                                  _________...________/
-                                                  \-->[InstanceDataN [next]]
+  SeqLocked      == [UAVOBase [UAVOData [Seq [InstanceData [InstanceCopy]]]]]
+  MultiInstance  == [UAVOBase [UAVOData [NumInstances [Chunks [InstanceData0]]]]]
+                                                     |
+                                                     \-->[Chunk0 [InstanceData1]]
+                                                     \-->[Chunk1 [InstanceData2 InstanceData3]]
+                                                     \-->[ChunkN [InstanceData2^N .. 2^(N+1)-1]]
  */
 
 /*
@@ -100,6 +111,7 @@ struct UAVOBase {
 		bool isMeta        : 1;
 		bool isSingle      : 1;
 		bool isSettings    : 1;
+		bool isSeqLocked   : 1;
 	} flags;
 
 } __attribute__((packed));
@@ -134,22 +146,44 @@ struct UAVOSingle {
 	 */
 } __attribute__((packed));
 
-/* Part of a linked list of instances chained off of a multi instance UAVO. */
-struct UAVOMultiInst {
-	struct UAVOMultiInst * next;
-	uint8_t                instance[];
-	/* 
-	 * Additional space will be malloc'd here to hold the
-	 * the data for this instance.
+/*
+ * Augmented type for seqlocked Single Instance Data UAVO
+ *
+ * Writers still serialize on the object manager lock, but keep two copies
+ * of the data: while seq is odd the update is going into instance0 and
+ * readers use the copy behind it, which is brought up to date once seq is
+ * even again.  Readers take no lock; they copy whichever side seq points
+ * at and only retry if seq moved while they were copying.  A high priority
+ * task preempting a writer therefore always gets a consistent copy on its
+ * first try.
+ */
+struct UAVOSingleSeq {
+	struct UAVOData   uavo;
+
+	volatile uint32_t seq;
+	uint8_t           instance0[];
+	/*
+	 * Additional space will be malloc'd here to hold the data for
+	 * this instance, followed by the copy used during updates.
 	 */
 } __attribute__((packed));
 
+/*
+ * Instances after the first live in chunks that double in size: chunk N
+ * holds instances 2^N to 2^(N+1)-1, so any instance is found in constant
+ * time from the position of the top bit of its ID.  Ten chunks cover
+ * UAVOBJ_MAX_INSTANCES.
+ */
+#define UAVO_INST_CHUNKS 10
+
 /* Augmented type for Multi Instance Data UAVO */
 struct UAVOMulti {
 	struct UAVOData        uavo;
 
 	uint16_t               num_instances;
-	struct UAVOMultiInst   instance0;
+	/* Table of UAVO_INST_CHUNKS chunks, allocated with the 2nd instance */
+	uint8_t             ** chunks;
+	uint8_t                instance0[];
 	/*
 	 * Additional space will be malloc'd here to hold the
 	 * the data for instance 0.
@@ -169,7 +203,9 @@ struct UAVOMulti {
 
 /** all information about instances are dependant on object type **/
 #define ObjSingleInstanceDataOffset(obj) ((void*)(&(( (struct UAVOSingle*)obj )->instance0)))
-#define InstanceDataOffset(inst) ((void*)&(( (struct UAVOMultiInst*)inst )->instance))
+#define InstanceChunk(instId) (31 - __builtin_clz(instId))
+/* Heap usage of an allocation, the allocator pads everything to 4 bytes */
+#define HeapBytes(size) (((size) + 3) & ~3)
 #define InstanceData(instance) (void*)instance
 
 // Private functions
@@ -182,9 +218,23 @@ static int32_t connectObj(UAVObjHandle obj_handle, struct pios_queue *queue,
 			uint16_t interval);
 static int32_t disconnectObj(UAVObjHandle obj_handle, struct pios_queue *queue,
 			UAVObjEventCallback cb, void *cbCtx);
+static void lockObjects();
+static void seqWriteBegin(struct UAVOBase * obj);
+static void seqWriteEnd(struct UAVOBase * obj);
+static int32_t seqRead(struct UAVOData * obj, void *dataOut,
+			uint32_t offset, uint32_t size);
 
 // Private variables
 static struct UAVOData * uavo_list;
+
+/*
+ * Registered objects, indexed by the slot their ID hashes to.  Entries are
+ * only ever written once (at registration, under the lock) so readers can
+ * look objects up without taking the lock.
+ */
+static struct UAVOData * volatile uavo_index[UAVO_HASH_SIZE];
+/* Number of registered objects whose ID is not in the generated hash */
+static uint16_t uavo_unindexed;
 static struct ObjectEventEntry * events_unused;
 static struct ObjectEventEntry * events_unused_throttled;
 static struct pios_recursive_mutex *mutex;
@@ -201,6 +251,7 @@ static const UAVObjMetadata defMetadata = {
 };
 
 static UAVObjStats stats;
+static UAVObjEventStats event_stats;
 static new_uavo_instance_cb_t newUavObjInstanceCB;
 
 #define UAVO_CB_STACK_SIZE 512
@@ -216,6 +267,8 @@ int32_t UAVObjInitialize()
 {
 	// Initialize variables
 	uavo_list = NULL;
+	memset((void *) uavo_index, 0, sizeof(uavo_index));
+	uavo_unindexed = 0;
 	events_unused = NULL;
 	events_unused_throttled = NULL;
 
@@ -228,6 +281,8 @@ int32_t UAVObjInitialize()
 	cb_stack += UAVO_CB_STACK_SIZE - 4;
 
 	memset(&stats, 0, sizeof(UAVObjStats));
+	memset(&event_stats, 0, sizeof(UAVObjEventStats));
+	event_stats.depth = UAVO_EVENT_BACKLOG;
 
 	// Create mutex
 	mutex = PIOS_Recursive_Mutex_Create();
@@ -247,7 +302,7 @@ int32_t UAVObjInitialize()
  */
 void UAVObjGetStats(UAVObjStats * statsOut)
 {
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	memcpy(statsOut, &stats, sizeof(UAVObjStats));
 	PIOS_Recursive_Mutex_Unlock(mutex);
 }
@@ -257,8 +312,23 @@ void UAVObjGetStats(UAVObjStats * statsOut)
  */
 void UAVObjClearStats()
 {
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
+	/* The memory accounting is a running total, not an error counter */
+	int32_t saved = stats.instanceMemorySaved;
 	memset(&stats, 0, sizeof(UAVObjStats));
+	stats.instanceMemorySaved = saved;
+	PIOS_Recursive_Mutex_Unlock(mutex);
+}
+
+/**
+ * Get the event dispatcher statistics.  These count from boot and are
+ * not reset by UAVObjClearStats().
+ * @param[out] statsOut The statistics will be copied there
+ */
+void UAVObjGetEventStats(UAVObjEventStats * statsOut)
+{
+	lockObjects();
+	memcpy(statsOut, &event_stats, sizeof(UAVObjEventStats));
 	PIOS_Recursive_Mutex_Unlock(mutex);
 }
 
@@ -279,6 +349,30 @@ static void UAVObjInitMetaData (struct UAVOMeta * obj_meta)
 	memset(&(obj_meta->instance0), 0, sizeof(obj_meta->instance0));
 }
 
+static struct UAVOData * UAVObjAllocSeqLocked(uint32_t num_bytes)
+{
+	/* Room for the instance and the copy readers use during updates */
+	uint32_t object_size = sizeof(struct UAVOSingleSeq) + 2 * num_bytes;
+
+	struct UAVOSingleSeq * uavo_seq = (struct UAVOSingleSeq *) PIOS_malloc_no_dma(object_size);
+	if (!uavo_seq)
+		return (NULL);
+
+	/* Fill in the common part of the UAVO */
+	struct UAVOBase * uavo_base = &(uavo_seq->uavo.base);
+	memset(uavo_base, 0, sizeof(*uavo_base));
+	uavo_base->flags.isSingle    = true;
+	uavo_base->flags.isSeqLocked = true;
+	uavo_base->next_event        = NULL;
+
+	/* Clear both copies of the instance data */
+	uavo_seq->seq = 0;
+	memset(&(uavo_seq->instance0), 0, 2 * num_bytes);
+
+	/* Give back the generic UAVO part */
+	return (&(uavo_seq->uavo));
+}
+
 static struct UAVOData * UAVObjAllocSingle(uint32_t num_bytes)
 {
 	/* Compute the complete size of the object, including the data for a single embedded instance */
@@ -322,8 +416,8 @@ static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes)
 	uavo_multi->num_instances = 1;
 
 	/* Clear the instance data carried in the UAVO */
-	uavo_multi->instance0.next = NULL;
-	memset (&(uavo_multi->instance0.instance), 0, num_bytes);
+	uavo_multi->chunks = NULL;
+	memset (&(uavo_multi->instance0), 0, num_bytes);
 
 	/* Give back the generic UAVO part */
 	return (&(uavo_multi->uavo));
@@ -338,6 +432,7 @@ static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes)
  * \param[in] id Unique object ID
  * \param[in] isSingleInstance Is this a single instance or multi-instance object
  * \param[in] isSettings Is this a settings object
+ * \param[in] isSeqLocked Let readers bypass the lock (single instance data objects only)
  * \param[in] numBytes Number of bytes of object data (for one instance)
  * \param[in] initCb Default field and metadata initialization function
  * \return Object handle, or NULL if failure.
@@ -345,19 +440,24 @@ static struct UAVOData * UAVObjAllocMulti(uint32_t num_bytes)
  */
 UAVObjHandle UAVObjRegister(uint32_t id, 
 			int32_t isSingleInstance, int32_t isSettings,
-			uint32_t num_bytes,
+			int32_t isSeqLocked, uint32_t num_bytes,
 			UAVObjInitializeCallback initCb)
 {
 	struct UAVOData * uavo_data = NULL;
 
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	/* Don't allow duplicate registrations */
 	if (UAVObjGetByID(id))
 		goto unlock_exit;
 
 	/* Map the various flags to one of the UAVO types we understand */
-	if (isSingleInstance) {
+	if (isSeqLocked) {
+		if (!isSingleInstance || isSettings)
+			goto unlock_exit;
+
+		uavo_data = UAVObjAllocSeqLocked (num_bytes);
+	} else if (isSingleInstance) {
 		uavo_data = UAVObjAllocSingle (num_bytes);
 	} else {
 		uavo_data = UAVObjAllocMulti (num_bytes);
@@ -379,6 +479,15 @@ UAVObjHandle UAVObjRegister(uint32_t id,
 	/* Add the newly created object to the global list of objects */
 	LL_APPEND(uavo_list, uavo_data);
 
+	/* Publish it in the ID index; the object is fully set up by now */
+	uint16_t slot = uavo_hash_slot(id);
+	if (uavo_hash_ids[slot] == id) {
+		__sync_synchronize();
+		uavo_index[slot] = uavo_data;
+	} else {
+		uavo_unindexed++;
+	}
+
 	/* Initialize object fields and metadata to default values */
 	if (initCb)
 		initCb((UAVObjHandle) uavo_data, 0);
@@ -401,15 +510,39 @@ unlock_exit:
 
 /**
  * Retrieve an object from the list given its id
+ *
+ * Data object IDs always have the LSB clear and the meta object uses the
+ * ID + 1, so both resolve through a single probe of the generated perfect
+ * hash.  This does not take the lock.
+ *
  * \param[in] The object ID
  * \return The object or NULL if not found.
  */
 UAVObjHandle UAVObjGetByID(uint32_t id)
 {
+	uint32_t data_id = id & ~1;
+	uint16_t slot = uavo_hash_slot(data_id);
+
+	if (uavo_hash_ids[slot] == data_id) {
+		struct UAVOData * obj = uavo_index[slot];
+
+		if (!obj)
+			return NULL;
+
+		if (id & 1)
+			return &(obj->metaObj.base);
+
+		return &obj->base;
+	}
+
+	/* Not a generated object ID; only possible match is an unindexed one */
+	if (!uavo_unindexed)
+		return NULL;
+
 	UAVObjHandle found_obj = NULL;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	// Look for object
 	struct UAVOData * tmp_obj;
@@ -540,7 +673,7 @@ uint16_t UAVObjCreateInstance(UAVObjHandle obj_handle, UAVObjInitializeCallback
 	}
 
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	InstanceHandle instEntry;
 	uint16_t instId = 0;
@@ -618,7 +751,7 @@ int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId,
 	PIOS_Assert(obj_handle);
 
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -656,7 +789,9 @@ int32_t UAVObjUnpack(UAVObjHandle obj_handle, uint16_t instId,
 		len = obj->instance_size;
 	}
 
+	seqWriteBegin((struct UAVOBase *) obj_handle);
 	memcpy(target, dataIn, len);
+	seqWriteEnd((struct UAVOBase *) obj_handle);
 
 	// Fire event
 	sendEvent((struct UAVOBase*)obj_handle, instId, EV_UNPACKED,
@@ -681,7 +816,7 @@ int32_t UAVObjPack(UAVObjHandle obj_handle, uint16_t instId, uint8_t * dataOut)
 	PIOS_Assert(obj_handle);
 
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -849,19 +984,24 @@ int32_t UAVObjLoad(UAVObjHandle obj_handle, uint16_t instId)
 			instId,
 			uavobj_load_trampoline,
 			len);
+
+	if (rc != 0)
+		return -1;
+
+	seqWriteBegin((struct UAVOBase *) obj_handle);
+	memcpy(target, uavobj_load_trampoline, len);
+	seqWriteEnd((struct UAVOBase *) obj_handle);
 #else  /* PIOS_INCLUDE_FASTHEAP */
+	seqWriteBegin((struct UAVOBase *) obj_handle);
 	rc = PIOS_FLASHFS_ObjLoad(pios_uavo_settings_fs_id,
 			UAVObjGetID(obj_handle),
 			instId,
 			target,
 			len);
-#endif  /* PIOS_INCLUDE_FASTHEAP */
+	seqWriteEnd((struct UAVOBase *) obj_handle);
 
 	if (rc != 0)
 		return -1;
-
-#if defined(PIOS_INCLUDE_FASTHEAP)
-	memcpy(target, uavobj_load_trampoline, len);
 #endif  /* PIOS_INCLUDE_FASTHEAP */
 
 	sendEvent((struct UAVOBase*)obj_handle, instId, EV_UNPACKED, target, len);
@@ -890,7 +1030,7 @@ int32_t UAVObjSaveSettings()
 	struct UAVOData *obj;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -922,7 +1062,7 @@ int32_t UAVObjLoadSettings()
 	struct UAVOData *obj;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -954,7 +1094,7 @@ int32_t UAVObjDeleteSettings()
 	struct UAVOData *obj;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -986,7 +1126,7 @@ int32_t UAVObjSaveMetaobjects()
 	struct UAVOData *obj;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -1015,7 +1155,7 @@ int32_t UAVObjLoadMetaobjects()
 	struct UAVOData *obj;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -1044,7 +1184,7 @@ int32_t UAVObjDeleteMetaobjects()
 	struct UAVOData *obj;
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -1136,7 +1276,7 @@ int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, con
 	PIOS_Assert(obj_handle);
 
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -1186,7 +1326,9 @@ int32_t UAVObjSetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, con
 	}
 
 	// Set data
+	seqWriteBegin((struct UAVOBase *) obj_handle);
 	memcpy(target + offset, dataIn, size);
+	seqWriteEnd((struct UAVOBase *) obj_handle);
 
 	// Fire event
 	sendEvent((struct UAVOBase *)obj_handle, instId, EV_UPDATED,
@@ -1210,8 +1352,16 @@ int32_t UAVObjGetInstanceData(UAVObjHandle obj_handle, uint16_t instId,
 {
 	PIOS_Assert(obj_handle);
 
+	if (obj_handle->flags.isSeqLocked) {
+		if (instId != 0)
+			return -1;
+
+		return seqRead((struct UAVOData *) obj_handle, dataOut, 0,
+			((struct UAVOData *) obj_handle)->instance_size);
+	}
+
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -1256,8 +1406,16 @@ int32_t UAVObjGetInstanceDataField(UAVObjHandle obj_handle, uint16_t instId, voi
 {
 	PIOS_Assert(obj_handle);
 
+	if (obj_handle->flags.isSeqLocked) {
+		if (instId != 0)
+			return -1;
+
+		return seqRead((struct UAVOData *) obj_handle, dataOut, offset,
+			size);
+	}
+
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	int32_t rc = -1;
 
@@ -1318,7 +1476,7 @@ int32_t UAVObjSetMetadata(UAVObjHandle obj_handle, const UAVObjMetadata * dataIn
 		return -1;
 	}
 
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	UAVObjSetData((UAVObjHandle) MetaObjectPtr((struct UAVOData *)obj_handle), dataIn);
 
@@ -1337,7 +1495,7 @@ int32_t UAVObjGetMetadata(UAVObjHandle obj_handle, UAVObjMetadata * dataOut)
 	PIOS_Assert(obj_handle);
 
 	// Lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	// Get metadata
 	if (UAVObjIsMetaobject(obj_handle)) {
@@ -1512,7 +1670,7 @@ int32_t UAVObjConnectQueueThrottled(UAVObjHandle obj_handle,
 	PIOS_Assert(obj_handle);
 	PIOS_Assert(queue);
 	int32_t res;
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	res = connectObj(obj_handle, queue, NULL, NULL, eventMask, interval);
 	PIOS_Recursive_Mutex_Unlock(mutex);
 	return res;
@@ -1535,7 +1693,7 @@ int32_t UAVObjDisconnectQueue(UAVObjHandle obj_handle, struct pios_queue *queue)
 	PIOS_Assert(obj_handle);
 	PIOS_Assert(queue);
 	int32_t res;
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	res = disconnectObj(obj_handle, queue, NULL, NULL);
 	PIOS_Recursive_Mutex_Unlock(mutex);
 	return res;
@@ -1590,7 +1748,7 @@ int32_t UAVObjConnectCallbackThrottled(UAVObjHandle obj_handle, UAVObjEventCallb
 {
 	PIOS_Assert(obj_handle);
 	int32_t res;
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	res = connectObj(obj_handle, 0, cb, cbCtx, eventMask, interval);
 	PIOS_Recursive_Mutex_Unlock(mutex);
 	return res;
@@ -1613,7 +1771,7 @@ int32_t UAVObjDisconnectCallback(UAVObjHandle obj_handle, UAVObjEventCallback cb
 {
 	PIOS_Assert(obj_handle);
 	int32_t res;
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	res = disconnectObj(obj_handle, 0, cb, cbCtx);
 	PIOS_Recursive_Mutex_Unlock(mutex);
 	return res;
@@ -1636,7 +1794,7 @@ void UAVObjUpdated(UAVObjHandle obj_handle)
 void UAVObjInstanceUpdated(UAVObjHandle obj_handle, uint16_t instId)
 {
 	PIOS_Assert(obj_handle);
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	sendEvent((struct UAVOBase *) obj_handle, instId, EV_UPDATED_MANUAL,
 		NULL, 0);
 	PIOS_Recursive_Mutex_Unlock(mutex);
@@ -1652,7 +1810,7 @@ void UAVObjIterate(void (*iterator) (UAVObjHandle obj))
 	PIOS_Assert(iterator);
 
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	// Iterate through the list and invoke iterator for each object
 	struct UAVOData *obj;
@@ -1753,6 +1911,31 @@ static int32_t pumpOneEvent(UAVObjEvent msg, void *obj_data, int len) {
 	return 0;
 }
 
+/**
+ * Account for an event that could not be queued, per object where possible.
+ */
+static void eventDropped(struct UAVOBase * obj)
+{
+	uint32_t id = UAVObjGetID(obj);
+
+	stats.eventCallbackErrors++;
+	stats.lastCallbackErrorID = id;
+
+	event_stats.dropped++;
+
+	for (int i = 0; i < UAVO_EVENT_DROP_SLOTS; i++) {
+		if (event_stats.dropCounts[i] == 0) {
+			event_stats.dropObjIds[i] = id;
+		}
+
+		if (event_stats.dropObjIds[i] == id) {
+			if (event_stats.dropCounts[i] < UINT16_MAX)
+				event_stats.dropCounts[i]++;
+			return;
+		}
+	}
+}
+
 /**
  * Send a triggered event to all event queues registered on the object.
  */
@@ -1760,13 +1943,16 @@ static int32_t sendEvent(struct UAVOBase * obj, uint16_t instId,
 			UAVObjEventType triggered_event,
 			void *obj_data, int len)
 {
-	static uint8_t num_pending = 0;
-
 	static struct PendEvent {
 		UAVObjEvent msg;
 		void *obj_data;
 		int len;
-	} pending_events[3];
+	} pending_events[UAVO_EVENT_BACKLOG];
+
+	static uint8_t pending_head;
+	static uint8_t num_pending;
+
+	static struct UAVOBase *in_progress = NULL;
 
 	/* The logic to spool up callbacks here may be a little confusing.
 	 * basically, this relies on the fact that we are in a re-entrant
@@ -1775,10 +1961,15 @@ static int32_t sendEvent(struct UAVOBase * obj, uint16_t instId,
 	 * performing a parent callback.
 	 *
 	 * In other words, while executing a callback it did a uav object
-	 * update that will trigger in turn more callbacks.
+	 * update that will trigger in turn more callbacks.  Callbacks run
+	 * on the single callback stack, so they can't nest: instead the
+	 * event is put on a ring of UAVO_EVENT_BACKLOG pending events,
+	 * which the outermost caller dispatches in order once the current
+	 * callback returns.
 	 *
-	 * To handle this, we have a small buffer to store the pending
-	 * callbacks.
+	 * An event identical to one that is already pending is folded into
+	 * it; callbacks are handed a pointer to the live instance data, so
+	 * they see the latest update either way.
 	 *
 	 * We also make the point of disallowing a callback from generating
 	 * the exact same callback.  This is relevant to things like
@@ -1788,53 +1979,73 @@ static int32_t sendEvent(struct UAVOBase * obj, uint16_t instId,
 	 *
 	 * However, infinite loops are still possible; callback A can
 	 * trigger callback B which triggers callback A.  Don't do that.
+	 * The ring bounds the damage: once it is full, events are dropped
+	 * and counted against the object that raised them.
 	 */
 
-	if (num_pending >= 3) {
-		/* Unable to pump event; backlog too long */
-		stats.eventCallbackErrors++;
-		stats.lastCallbackErrorID = UAVObjGetID(obj);
-
+	if (in_progress == obj) {
+		/* We don't fire events of the same type generated by an
+		 * event callback. */
+		event_stats.suppressed++;
 		return -1;
 	}
 
-	static struct UAVOBase *in_progress = NULL;
+	for (uint8_t i = 0; i < num_pending; i++) {
+		struct PendEvent *pend =
+			&pending_events[(pending_head + i) % UAVO_EVENT_BACKLOG];
 
-	if (num_pending) {
-		if (in_progress == obj) {
-			return -1;	/* We don't fire events
-					 * of the same type generated by
-					 * an event callback. */
+		if (pend->msg.obj == obj && pend->msg.instId == instId &&
+				pend->msg.event == triggered_event) {
+			event_stats.coalesced++;
+			return 0;
 		}
 	}
 
-	pending_events[num_pending].msg = (UAVObjEvent) {
+	if (num_pending >= UAVO_EVENT_BACKLOG) {
+		/* Unable to pump event; backlog too long */
+		eventDropped(obj);
+		return -1;
+	}
+
+	struct PendEvent *pend = &pending_events[
+		(pending_head + num_pending) % UAVO_EVENT_BACKLOG];
+
+	pend->msg = (UAVObjEvent) {
 		.obj    = obj,
 		.event  = triggered_event,
 		.instId = instId
 	};
 
-	pending_events[num_pending].obj_data = obj_data;
-	pending_events[num_pending].len = len;
+	pend->obj_data = obj_data;
+	pend->len = len;
 
 	num_pending++;
 
-	/* Only enter the section of pumping events if we are the "first event" */
-	if (!in_progress) {
-		/* While there are events to pump.. */
-		while (num_pending) {
-			/* Deallocate the top one.. */
-			num_pending--;
-
-			/* Mask off events of the same type resulting from
-			 * the callback... */
-			in_progress = pending_events[num_pending].msg.obj;
-
-			/* And pump the event. */
-			pumpOneEvent(pending_events[num_pending].msg,
-				pending_events[num_pending].obj_data,
-				pending_events[num_pending].len);
-		}
+	if (num_pending > event_stats.highWater) {
+		event_stats.highWater = num_pending;
+	}
+
+	/* Only the "first event" pumps; nested ones just queue up */
+	if (in_progress) {
+		return 0;
+	}
+
+	/* While there are events to pump.. */
+	while (num_pending) {
+		/* Take the oldest one off the ring.. */
+		struct PendEvent ev = pending_events[pending_head];
+
+		pending_head = (pending_head + 1) % UAVO_EVENT_BACKLOG;
+		num_pending--;
+
+		/* Mask off events of the same type resulting from
+		 * the callback... */
+		in_progress = ev.msg.obj;
+
+		/* And pump the event. */
+		pumpOneEvent(ev.msg, ev.obj_data, ev.len);
+
+		event_stats.dispatched++;
 	}
 
 	in_progress = NULL;
@@ -1847,7 +2058,7 @@ static int32_t sendEvent(struct UAVOBase * obj, uint16_t instId,
  */
 static InstanceHandle createInstance(struct UAVOData * obj, uint16_t instId)
 {
-	struct UAVOMultiInst *instEntry;
+	struct UAVOMulti *uavo_multi = (struct UAVOMulti *) obj;
 
 	/* Don't allow more than one instance for single instance objects */
 	if (UAVObjIsSingleInstance(&(obj->base))) {
@@ -1872,14 +2083,38 @@ static InstanceHandle createInstance(struct UAVOData * obj, uint16_t instId)
 		}
 	}
 
-	/* Create the actual instance */
-	instEntry = (struct UAVOMultiInst *) PIOS_malloc_no_dma(sizeof(struct UAVOMultiInst)+obj->instance_size);
-	if (!instEntry)
-		return NULL;
-	memset(InstanceDataOffset(instEntry), 0, obj->instance_size);
-	LL_APPEND(( (struct UAVOMulti*)obj )->instance0.next, instEntry);
+	/* Make room for the chunk table and the chunk holding this instance */
+	if (!uavo_multi->chunks) {
+		uint32_t table_size = UAVO_INST_CHUNKS * sizeof(*uavo_multi->chunks);
+
+		uavo_multi->chunks = PIOS_malloc_no_dma(table_size);
+		if (!uavo_multi->chunks)
+			return NULL;
+		memset(uavo_multi->chunks, 0, table_size);
+
+		stats.instanceMemorySaved -= HeapBytes(table_size);
+	}
+
+	uint8_t chunk = InstanceChunk(instId);
+
+	if (!uavo_multi->chunks[chunk]) {
+		uint32_t chunk_size = (1 << chunk) * obj->instance_size;
+
+		uavo_multi->chunks[chunk] = PIOS_malloc_no_dma(chunk_size);
+		if (!uavo_multi->chunks[chunk])
+			return NULL;
+
+		stats.instanceMemorySaved -= HeapBytes(chunk_size);
+	}
+
+	/* A separate allocation would have cost a next pointer and padding */
+	stats.instanceMemorySaved += HeapBytes(sizeof(void *) + obj->instance_size);
+
+	void *instance = uavo_multi->chunks[chunk] +
+		(instId - (1 << chunk)) * obj->instance_size;
+	memset(instance, 0, obj->instance_size);
 
-	( (struct UAVOMulti*)obj )->num_instances++;
+	uavo_multi->num_instances++;
 
 	// Fire event
 	UAVObjInstanceUpdated((UAVObjHandle) obj, instId);
@@ -1888,7 +2123,7 @@ static InstanceHandle createInstance(struct UAVOData * obj, uint16_t instId)
 	if (newUavObjInstanceCB) {
 		newUavObjInstanceCB(obj->id, UAVObjGetNumInstances(&obj->base));
 	}
-	return InstanceDataOffset(instEntry);
+	return instance;
 }
 
 /**
@@ -1912,6 +2147,12 @@ static InstanceHandle getInstance(struct UAVOData * obj, uint16_t instId)
 		if (instId != 0)
 			return NULL;
 
+		/* Writers (and readers holding the lock) always use the first copy */
+		if (obj->base.flags.isSeqLocked) {
+			struct UAVOSingleSeq * uavo_seq = (struct UAVOSingleSeq *) obj;
+			return (&(uavo_seq->instance0));
+		}
+
 		/* Augment our pointer to reflect the proper type */
 		struct UAVOSingle * uavo_single = (struct UAVOSingle *) obj;
 		return (&(uavo_single->instance0));
@@ -1922,17 +2163,100 @@ static InstanceHandle getInstance(struct UAVOData * obj, uint16_t instId)
 		if (instId >= uavo_multi->num_instances)
 			return NULL;
 
-		// Look for specified instance ID
-		uint16_t instance = 0;
-		struct UAVOMultiInst *instEntry;
-		LL_FOREACH(&(uavo_multi->instance0), instEntry) {
-			if (instance++ == instId) {
-				/* Found it */
-				return &(instEntry->instance);
-			}
-		}
-		/* Instance was not found */
-		return NULL;
+		if (instId == 0)
+			return uavo_multi->instance0;
+
+		uint8_t chunk = InstanceChunk(instId);
+
+		return uavo_multi->chunks[chunk] +
+			(instId - (1 << chunk)) * obj->instance_size;
+	}
+}
+
+/**
+ * Take the object manager lock, accounting for any time spent waiting on it.
+ */
+static void lockObjects()
+{
+	uint32_t start = PIOS_DELAY_GetRaw();
+
+	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+
+	uint32_t waited = PIOS_DELAY_DiffuS(start);
+
+	stats.lockAcquisitions++;
+
+	if (waited > UAVO_LOCK_CONTENDED_US) {
+		stats.lockContended++;
+		stats.lockWaitTotalUs += waited;
+
+		if (waited > stats.lockWaitMaxUs)
+			stats.lockWaitMaxUs = waited;
+	}
+}
+
+/**
+ * Start an update of a seqlocked object.  Readers switch over to the
+ * copy until seqWriteEnd().  Must be called with the lock held.
+ */
+static void seqWriteBegin(struct UAVOBase * obj)
+{
+	if (!obj->flags.isSeqLocked)
+		return;
+
+	struct UAVOSingleSeq * uavo_seq = (struct UAVOSingleSeq *) obj;
+
+	uavo_seq->seq++;
+	__sync_synchronize();
+}
+
+/**
+ * Finish an update of a seqlocked object: point readers back at the
+ * updated data, then bring the copy up to date for the next writer.
+ */
+static void seqWriteEnd(struct UAVOBase * obj)
+{
+	if (!obj->flags.isSeqLocked)
+		return;
+
+	struct UAVOSingleSeq * uavo_seq = (struct UAVOSingleSeq *) obj;
+	uint16_t size = uavo_seq->uavo.instance_size;
+
+	__sync_synchronize();
+	uavo_seq->seq++;
+	__sync_synchronize();
+
+	memcpy(uavo_seq->instance0 + size, uavo_seq->instance0, size);
+	__sync_synchronize();
+}
+
+/**
+ * Copy (part of) a seqlocked object without taking the lock.
+ * \return 0 if success or -1 if the range is out of bounds
+ */
+static int32_t seqRead(struct UAVOData * obj, void *dataOut,
+			uint32_t offset, uint32_t size)
+{
+	struct UAVOSingleSeq * uavo_seq = (struct UAVOSingleSeq *) obj;
+
+	if ((size + offset) > obj->instance_size)
+		return -1;
+
+	/* Unlocked, so a count may occasionally be lost; fine for statistics */
+	stats.seqlockReads++;
+
+	while (true) {
+		uint32_t seq = uavo_seq->seq;
+		__sync_synchronize();
+
+		memcpy(dataOut, uavo_seq->instance0 +
+			(seq & 1) * obj->instance_size + offset, size);
+
+		__sync_synchronize();
+		if (uavo_seq->seq == seq)
+			return 0;
+
+		stats.seqlockRetries++;
 	}
 }
 
@@ -1997,7 +2321,7 @@ static int32_t connectObj(UAVObjHandle obj_handle, struct pios_queue *queue,
 		unused = &events_unused_throttled;
 	}
 
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 	if (*unused != NULL) {
 		// We can re-use the memory of a previously disconnected event
 		event = *unused;
@@ -2058,7 +2382,7 @@ static int32_t disconnectObj(UAVObjHandle obj_handle, struct pios_queue *queue,
 				((!event->cb) && event->cbInfo.queue == queue)) {
 			LL_DELETE(obj->next_event, event);
 			// store the unused memory for future reuse
-			PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+			lockObjects();
 			if (event->hasThrottle) {
 				LL_APPEND(events_unused_throttled, event);
 			}
@@ -2109,7 +2433,7 @@ uint8_t UAVObjCount()
 {
 	uint8_t count = 0;
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	// Look for object
 	struct UAVOData * tmp_obj;
@@ -2130,7 +2454,7 @@ uint32_t UAVObjIDByIndex(uint8_t index)
 {
 	uint8_t count = 0;
 	// Get lock
-	PIOS_Recursive_Mutex_Lock(mutex, PIOS_MUTEX_TIMEOUT_MAX);
+	lockObjects();
 
 	// Look for object
 	struct UAVOData * tmp_obj;
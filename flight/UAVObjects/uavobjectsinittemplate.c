@@ -35,6 +35,11 @@
 #include "openpilot.h"
 $(OBJINC)
 
+#if !defined(SMALLF1)
+/* Start of each field in the packed data, followed by the object size */
+$(FIELDOFFSETS)
+#endif /* SMALLF1 */
+
 /**
  * Function used to initialize the first instance of each object.
  * This file is automatically updated by the UAVObjectGenerator.
@@ -44,6 +49,27 @@ void UAVObjectsInitializeAll()
 $(OBJINIT)
 }
 
+/**
+ * Look up the field layout of an object, as used by UAVTalk delta packets.
+ * This file is automatically updated by the UAVObjectGenerator.
+ * \param[in] objId Object ID
+ * \param[out] numFields Number of fields in the object
+ * \return numFields + 1 offsets into the packed data, NULL if the object
+ * has a single field
+ */
+const uint16_t *UAVObjectsFieldOffsets(uint32_t objId, uint8_t *numFields)
+{
+#if !defined(SMALLF1)
+	switch (objId) {
+$(FIELDOFFSETCASES)	}
+#else
+	(void) objId;
+	(void) numFields;
+#endif /* SMALLF1 */
+
+	return NULL;
+}
+
 /**
  * @}
  * @}
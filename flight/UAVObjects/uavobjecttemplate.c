@@ -59,7 +59,8 @@ int32_t $(NAME)Initialize(void)
 	
 	// Register object with the object manager
 	handle = UAVObjRegister($(NAMEUC)_OBJID,
-			$(NAMEUC)_ISSINGLEINST, $(NAMEUC)_ISSETTINGS, $(NAMEUC)_NUMBYTES, &$(NAME)SetDefaults);
+			$(NAMEUC)_ISSINGLEINST, $(NAMEUC)_ISSETTINGS, $(NAMEUC)_ISSEQLOCKED,
+			$(NAMEUC)_NUMBYTES, &$(NAME)SetDefaults);
 
 	// Done
 	if (handle != 0)
@@ -33,6 +33,7 @@
 
 // Public types
 typedef int32_t (*UAVTalkOutputStream)(uint8_t* data, int32_t length);
+typedef uintptr_t (*UAVTalkOutputCom)(void);
 
 //! Tracking statistics for a UAVTalk connection
 typedef struct {
@@ -55,14 +56,22 @@ typedef enum {UAVTALK_STATE_ERROR = 0, UAVTALK_STATE_SYNC, UAVTALK_STATE_TYPE, U
 UAVTalkConnection UAVTalkInitialize(UAVTalkOutputStream outputStream);
 int32_t UAVTalkSetOutputStream(UAVTalkConnection connection, UAVTalkOutputStream outputStream);
 UAVTalkOutputStream UAVTalkGetOutputStream(UAVTalkConnection connection);
+int32_t UAVTalkSetOutputCom(UAVTalkConnection connectionHandle, UAVTalkOutputCom outputCom);
 int32_t UAVTalkSendObject(UAVTalkConnection connection, UAVObjHandle obj, uint16_t instId, uint8_t acked, int32_t timeoutMs);
 int32_t UAVTalkSendObjectTimestamped(UAVTalkConnection connectionHandle, UAVObjHandle obj, uint16_t instId, uint8_t acked, int32_t timeoutMs);
+int32_t UAVTalkSendObjectBatched(UAVTalkConnection connectionHandle, UAVObjHandle obj, uint16_t instId);
+int32_t UAVTalkFlushBatch(UAVTalkConnection connectionHandle);
+bool UAVTalkBatchPending(UAVTalkConnection connectionHandle);
+void UAVTalkDisableBatching(UAVTalkConnection connectionHandle);
+void UAVTalkDisableDeltas(UAVTalkConnection connectionHandle);
 int32_t UAVTalkSendObjectRequest(UAVTalkConnection connection, UAVObjHandle obj, uint16_t instId, int32_t timeoutMs);
 int32_t UAVTalkSendAck(UAVTalkConnection connectionHandle, UAVObjHandle obj, uint16_t instId);
 int32_t UAVTalkSendNack(UAVTalkConnection connectionHandle, uint32_t objId);
 int32_t UAVTalkSendBuf(UAVTalkConnection connectionHandle, uint8_t *buf, uint16_t len);
 UAVTalkRxState UAVTalkProcessInputStream(UAVTalkConnection connection, uint8_t rxbyte);
 UAVTalkRxState UAVTalkProcessInputStreamQuiet(UAVTalkConnection connection, uint8_t rxbyte);
+UAVTalkRxState UAVTalkProcessInputBlock(UAVTalkConnection connectionHandle, const uint8_t *data, uint16_t length);
+uint16_t UAVTalkProcessInputBlockQuiet(UAVTalkConnection connectionHandle, const uint8_t *data, uint16_t length, UAVTalkRxState *state);
 UAVTalkRxState UAVTalkRelayInputStream(UAVTalkConnection connectionHandle, uint8_t rxbyte);
 int32_t UAVTalkRelayPacket(UAVTalkConnection inConnectionHandle, UAVTalkConnection outConnectionHandle);
 int32_t UAVTalkReceiveObject(UAVTalkConnection connectionHandle);
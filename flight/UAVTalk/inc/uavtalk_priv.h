@@ -63,6 +63,45 @@ typedef uint8_t uavtalk_checksum;
 #define UAVTALK_MIN_PACKET_LENGTH       UAVTALK_MAX_HEADER_LENGTH + UAVTALK_CHECKSUM_LENGTH
 #define UAVTALK_MAX_PACKET_LENGTH       UAVTALK_MIN_PACKET_LENGTH + UAVTALK_MAX_PAYLOAD_LENGTH
 
+/*
+ * A batch frame has the minimal header (with a zero object ID) followed by
+ * records of objId (4), length word (2), optional instId (2) and the object
+ * data, all covered by the one checksum.  The top bit of the length word
+ * says whether the instance ID is present, the next whether the data is a
+ * delta.  Batches are kept small enough for peers limited to 256 byte
+ * payloads.
+ */
+#define UAVTALK_BATCH_RECORD_LENGTH     6
+#define UAVTALK_BATCH_INSTID            0x8000
+#define UAVTALK_BATCH_DELTA             0x4000
+#define UAVTALK_BATCH_LENGTH_MASK       0x3FFF
+#define UAVTALK_BATCH_MAX_PAYLOAD       ((UAVTALK_MAX_PAYLOAD_LENGTH - 1) < 255 ? (UAVTALK_MAX_PAYLOAD_LENGTH - 1) : 255)
+
+/*
+ * A delta carries an object as a bitmap of the fields that changed since
+ * it was last sent on the connection (one bit per field, LSB of the first
+ * byte first) followed by just those fields.  Each connection keeps the
+ * data last sent for a few objects to compare against, and sends the
+ * whole object every UAVTALK_DELTA_REFRESH updates in case a delta was
+ * lost.  Objects whose deltas keep coming out no smaller give up their
+ * slot after UAVTALK_DELTA_MAX_MISSES tries.
+ */
+#define UAVTALK_DELTA_SLOTS             12
+#define UAVTALK_DELTA_MIN_LENGTH        32
+#define UAVTALK_DELTA_REFRESH           10
+#define UAVTALK_DELTA_MAX_MISSES        4
+#define UAVTALK_DELTA_MAX_MASK          32
+
+//! Data last sent for an object, for delta packets
+typedef struct {
+	UAVObjHandle obj;
+	uint16_t instId;
+	uint16_t size;
+	uint8_t sends;
+	uint8_t misses;
+	uint8_t *shadow;
+} UAVTalkDeltaSlot;
+
 //! State information for the UAVTalk parser
 typedef struct {
 	UAVObjHandle obj;
@@ -84,6 +123,7 @@ typedef struct {
 typedef struct {
 	uint8_t canari;
 	UAVTalkOutputStream outStream;
+	UAVTalkOutputCom outCom;
 	struct pios_recursive_mutex *lock;
 	struct pios_recursive_mutex *transLock;
 	struct pios_semaphore *respSema;
@@ -94,6 +134,12 @@ typedef struct {
 	uint8_t *rxBuffer;
 	uint32_t txSize;
 	uint8_t *txBuffer;
+	bool batchEnabled;
+	uint16_t batchLength;
+	uint8_t batchRecords;
+	bool deltaEnabled;
+	UAVTalkDeltaSlot *deltaSlots;
+	uint8_t *deltaBuffer;
 } UAVTalkConnectionData;
 
 #define UAVTALK_CANARI         0xCA
@@ -108,6 +154,8 @@ typedef struct {
 #define UAVTALK_TYPE_OBJ_ACK   (UAVTALK_TYPE_VER | 0x02)
 #define UAVTALK_TYPE_ACK       (UAVTALK_TYPE_VER | 0x03)
 #define UAVTALK_TYPE_NACK      (UAVTALK_TYPE_VER | 0x04)
+#define UAVTALK_TYPE_OBJ_BATCH (UAVTALK_TYPE_VER | 0x05)
+#define UAVTALK_TYPE_OBJ_DELTA (UAVTALK_TYPE_VER | 0x06)
 #define UAVTALK_TYPE_OBJ_TS       (UAVTALK_TIMESTAMPED | UAVTALK_TYPE_OBJ)
 #define UAVTALK_TYPE_OBJ_ACK_TS   (UAVTALK_TIMESTAMPED | UAVTALK_TYPE_OBJ_ACK)
 
@@ -41,7 +41,18 @@
 static int32_t objectTransaction(UAVTalkConnectionData *connection, UAVObjHandle objectId, uint16_t instId, uint8_t type, int32_t timeout);
 static int32_t sendObject(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint8_t type);
 static int32_t sendSingleObject(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint8_t type);
+static int32_t buildPacket(uint8_t *buf, UAVObjHandle obj, uint16_t instId, uint8_t type, int32_t length);
 static int32_t sendNack(UAVTalkConnectionData *connection, uint32_t objId);
+static int32_t batchObject(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId);
+static int32_t flushBatch(UAVTalkConnectionData *connection);
+static int32_t receiveBatch(UAVTalkConnectionData *connection, uint8_t* data, int32_t length);
+static UAVTalkDeltaSlot *deltaSlot(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint16_t length);
+static uint16_t deltaEncode(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint8_t *data, uint16_t length);
+static void deltaRefresh(UAVTalkConnectionData *connection);
+static void deltaForget(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId);
+static int32_t applyDelta(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, const uint8_t *data, int32_t length);
+static void objIdReceived(UAVTalkConnectionData *connection);
+static uint16_t processBlock(UAVTalkConnectionData *connection, const uint8_t *data, uint16_t length);
 static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, uint32_t objId, uint16_t instId, uint8_t* data, int32_t length);
 static void updateAck(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId);
 
@@ -61,6 +72,7 @@ UAVTalkConnection UAVTalkInitialize(UAVTalkOutputStream outputStream)
 	connection->iproc.rxPacketLength = 0;
 	connection->iproc.state = UAVTALK_STATE_SYNC;
 	connection->outStream = outputStream;
+	connection->outCom = NULL;
 	connection->lock = PIOS_Recursive_Mutex_Create();
 	PIOS_Assert(connection->lock != NULL);
 	connection->transLock = PIOS_Recursive_Mutex_Create();
@@ -70,6 +82,12 @@ UAVTalkConnection UAVTalkInitialize(UAVTalkOutputStream outputStream)
 	if (!connection->rxBuffer) return 0;
 	connection->txBuffer = PIOS_malloc(UAVTALK_MAX_PACKET_LENGTH);
 	if (!connection->txBuffer) return 0;
+	connection->batchEnabled = false;
+	connection->batchLength = 0;
+	connection->batchRecords = 0;
+	connection->deltaEnabled = false;
+	connection->deltaSlots = NULL;
+	connection->deltaBuffer = NULL;
 	connection->respSema = PIOS_Semaphore_Create();
 	PIOS_Semaphore_Take(connection->respSema, 0); // reset to zero
 	UAVTalkResetStats( (UAVTalkConnection) connection );
@@ -102,6 +120,28 @@ int32_t UAVTalkSetOutputStream(UAVTalkConnection connectionHandle, UAVTalkOutput
 
 }
 
+/**
+ * Name the COM device behind the output stream, so that single objects can
+ * be built directly in its transmit buffer instead of being copied there.
+ * The output stream is still used whenever the device has no room for a
+ * packet in one piece.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] outputCom Function returning the COM device in use, or 0
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkSetOutputCom(UAVTalkConnection connectionHandle, UAVTalkOutputCom outputCom)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return -1);
+
+	PIOS_Recursive_Mutex_Lock(connection->lock, PIOS_MUTEX_TIMEOUT_MAX);
+	connection->outCom = outputCom;
+	PIOS_Recursive_Mutex_Unlock(connection->lock);
+
+	return 0;
+}
+
 /**
  * Get current output stream
  * \param[in] connection UAVTalkConnection to be used
@@ -226,6 +266,115 @@ int32_t UAVTalkSendObjectTimestamped(UAVTalkConnection connectionHandle, UAVObjH
 	}
 }
 
+/**
+ * Queue an unacknowledged object update into a batch frame.  Once the peer
+ * has shown it understands batch frames the update is packed together with
+ * others and sent on the next UAVTalkFlushBatch() or when the frame fills.
+ * Until then this is the same as an unacked UAVTalkSendObject().
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object to send
+ * \param[in] instId The instance ID or UAVOBJ_ALL_INSTANCES for all instances.
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkSendObjectBatched(UAVTalkConnection connectionHandle, UAVObjHandle obj, uint16_t instId)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return -1);
+
+	if (!connection->batchEnabled) {
+		return objectTransaction(connection, obj, instId, UAVTALK_TYPE_OBJ, 0);
+	}
+
+	int32_t ret = 0;
+
+	PIOS_Recursive_Mutex_Lock(connection->lock, PIOS_MUTEX_TIMEOUT_MAX);
+
+	if (instId == UAVOBJ_ALL_INSTANCES && UAVObjIsSingleInstance(obj)) {
+		instId = 0;
+	}
+
+	if (instId == UAVOBJ_ALL_INSTANCES) {
+		uint32_t numInst = UAVObjGetNumInstances(obj);
+		for (uint32_t n = 0; n < numInst; ++n) {
+			if (batchObject(connection, obj, n) < 0) {
+				ret = -1;
+			}
+		}
+	} else {
+		ret = batchObject(connection, obj, instId);
+	}
+
+	PIOS_Recursive_Mutex_Unlock(connection->lock);
+
+	return ret;
+}
+
+/**
+ * Send any object updates waiting in a batch frame.
+ * \param[in] connection UAVTalkConnection to be used
+ * \return 0 Success
+ * \return -1 Failure
+ */
+int32_t UAVTalkFlushBatch(UAVTalkConnection connectionHandle)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return -1);
+
+	PIOS_Recursive_Mutex_Lock(connection->lock, PIOS_MUTEX_TIMEOUT_MAX);
+	int32_t ret = flushBatch(connection);
+	PIOS_Recursive_Mutex_Unlock(connection->lock);
+
+	return ret;
+}
+
+/**
+ * Check whether object updates are waiting in a batch frame.
+ * \param[in] connection UAVTalkConnection to be used
+ * \return true if UAVTalkFlushBatch() has something to send
+ */
+bool UAVTalkBatchPending(UAVTalkConnection connectionHandle)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return false);
+
+	return connection->batchRecords > 0;
+}
+
+/**
+ * Stop sending batch frames until the peer sends one again.  Called when
+ * the link drops, as the next peer may not understand them.
+ * \param[in] connection UAVTalkConnection to be used
+ */
+void UAVTalkDisableBatching(UAVTalkConnection connectionHandle)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return );
+
+	PIOS_Recursive_Mutex_Lock(connection->lock, PIOS_MUTEX_TIMEOUT_MAX);
+	flushBatch(connection);
+	connection->batchEnabled = false;
+	PIOS_Recursive_Mutex_Unlock(connection->lock);
+}
+
+/**
+ * Stop sending deltas until the peer sends one again.  Called when the
+ * link drops, as the next peer may not understand them and won't have
+ * the data they are relative to.
+ * \param[in] connection UAVTalkConnection to be used
+ */
+void UAVTalkDisableDeltas(UAVTalkConnection connectionHandle)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return );
+
+	PIOS_Recursive_Mutex_Lock(connection->lock, PIOS_MUTEX_TIMEOUT_MAX);
+	flushBatch(connection);
+	connection->deltaEnabled = false;
+	deltaRefresh(connection);
+	PIOS_Recursive_Mutex_Unlock(connection->lock);
+}
+
 /**
  * Execute the requested transaction on an object.
  * \param[in] connection UAVTalkConnection to be used
@@ -277,6 +426,80 @@ static int32_t objectTransaction(UAVTalkConnectionData *connection, UAVObjHandle
 	}
 }
 
+/**
+ * Work out the rest of the packet layout once the header up to the object
+ * ID has been received, moving the parser on to the next field.
+ * \param[in] connection UAVTalkConnection to be used
+ */
+static void objIdReceived(UAVTalkConnectionData *connection)
+{
+	UAVTalkInputProcessor *iproc = &connection->iproc;
+
+	// Search for object.
+	iproc->obj = UAVObjGetByID(iproc->objId);
+
+	// Determine data length
+	iproc->timestampLength = 0;
+	if (iproc->type == UAVTALK_TYPE_OBJ_BATCH) {
+		// The records carry their own headers, the rest of the packet is payload
+		iproc->length = iproc->packet_size - iproc->rxPacketLength;
+		iproc->instanceLength = 0;
+	} else if (iproc->type == UAVTALK_TYPE_OBJ_DELTA && iproc->obj) {
+		// Only the changed fields follow, so the packet gives the length
+		iproc->instanceLength = (UAVObjIsSingleInstance(iproc->obj) ? 0 : 2);
+		iproc->length = iproc->packet_size - iproc->rxPacketLength - iproc->instanceLength;
+	} else if (iproc->type == UAVTALK_TYPE_OBJ_REQ || iproc->type == UAVTALK_TYPE_ACK || iproc->type == UAVTALK_TYPE_NACK) {
+		iproc->length = 0;
+		iproc->instanceLength = 0;
+	} else {
+		if (iproc->obj) {
+			iproc->length = UAVObjGetNumBytes(iproc->obj);
+			iproc->instanceLength = (UAVObjIsSingleInstance(iproc->obj) ? 0 : 2);
+			iproc->timestampLength = (iproc->type & UAVTALK_TIMESTAMPED) ? 2 : 0;
+		} else {
+			// We don't know if it's a multi-instance object, so just assume it's 0.
+			iproc->instanceLength = 0;
+			iproc->length = iproc->packet_size - iproc->rxPacketLength;
+		}
+	}
+
+	// Check length and determine next state
+	if (iproc->length >= UAVTALK_MAX_PAYLOAD_LENGTH) {
+		connection->stats.rxErrors++;
+		iproc->state = UAVTALK_STATE_ERROR;
+		return;
+	}
+
+	// Check the lengths match
+	if ((iproc->rxPacketLength + iproc->instanceLength + iproc->timestampLength + iproc->length) != iproc->packet_size) { // packet error - mismatched packet size
+		connection->stats.rxErrors++;
+		iproc->state = UAVTALK_STATE_ERROR;
+		return;
+	}
+
+	iproc->instId = 0;
+	if (iproc->type == UAVTALK_TYPE_NACK) {
+		// If this is a NACK, we skip to Checksum
+		iproc->state = UAVTALK_STATE_CS;
+	}
+	// Check if this is a single instance object (i.e. if the instance ID field is coming next)
+	else if ((iproc->obj != 0) && !UAVObjIsSingleInstance(iproc->obj)) {
+		iproc->state = UAVTALK_STATE_INSTID;
+	}
+	// Check if this is a single instance and has a timestamp in it
+	else if ((iproc->obj != 0) && (iproc->type & UAVTALK_TIMESTAMPED)) {
+		iproc->timestamp = 0;
+		iproc->state = UAVTALK_STATE_TIMESTAMP;
+	} else {
+		// If there is a payload get it, otherwise receive checksum
+		if (iproc->length > 0)
+			iproc->state = UAVTALK_STATE_DATA;
+		else
+			iproc->state = UAVTALK_STATE_CS;
+	}
+	iproc->rxCount = 0;
+}
+
 /**
  * Process an byte from the telemetry stream.
  * \param[in] connection UAVTalkConnection to be used
@@ -364,60 +587,7 @@ UAVTalkRxState UAVTalkProcessInputStreamQuiet(UAVTalkConnection connectionHandle
 		if (iproc->rxCount < 4)
 			break;
 
-		// Search for object.
-		iproc->obj = UAVObjGetByID(iproc->objId);
-
-		// Determine data length
-		if (iproc->type == UAVTALK_TYPE_OBJ_REQ || iproc->type == UAVTALK_TYPE_ACK || iproc->type == UAVTALK_TYPE_NACK) {
-			iproc->length = 0;
-			iproc->instanceLength = 0;
-		} else {
-			if (iproc->obj) {
-				iproc->length = UAVObjGetNumBytes(iproc->obj);
-				iproc->instanceLength = (UAVObjIsSingleInstance(iproc->obj) ? 0 : 2);
-				iproc->timestampLength = (iproc->type & UAVTALK_TIMESTAMPED) ? 2 : 0;
-			} else {
-				// We don't know if it's a multi-instance object, so just assume it's 0.
-				iproc->instanceLength = 0;
-				iproc->length = iproc->packet_size - iproc->rxPacketLength;
-			}
-		}
-
-		// Check length and determine next state
-		if (iproc->length >= UAVTALK_MAX_PAYLOAD_LENGTH) {
-			connection->stats.rxErrors++;
-			iproc->state = UAVTALK_STATE_ERROR;
-			break;
-		}
-
-		// Check the lengths match
-		if ((iproc->rxPacketLength + iproc->instanceLength + iproc->timestampLength + iproc->length) != iproc->packet_size) { // packet error - mismatched packet size
-			connection->stats.rxErrors++;
-			iproc->state = UAVTALK_STATE_ERROR;
-			break;
-		}
-
-		iproc->instId = 0;
-		if (iproc->type == UAVTALK_TYPE_NACK) {
-			// If this is a NACK, we skip to Checksum
-			iproc->state = UAVTALK_STATE_CS;
-		}
-		// Check if this is a single instance object (i.e. if the instance ID field is coming next)
-		else if ((iproc->obj != 0) && !UAVObjIsSingleInstance(iproc->obj)) {
-			iproc->state = UAVTALK_STATE_INSTID;
-		}
-		// Check if this is a single instance and has a timestamp in it
-		else if ((iproc->obj != 0) && (iproc->type & UAVTALK_TIMESTAMPED)) {
-			iproc->timestamp = 0;
-			iproc->state = UAVTALK_STATE_TIMESTAMP;
-		} else {
-			// If there is a payload get it, otherwise receive checksum
-			if (iproc->length > 0)
-				iproc->state = UAVTALK_STATE_DATA;
-			else
-				iproc->state = UAVTALK_STATE_CS;
-		}
-		iproc->rxCount = 0;
+		objIdReceived(connection);
 
 		break;
 
@@ -466,13 +636,13 @@ UAVTalkRxState UAVTalkProcessInputStreamQuiet(UAVTalkConnection connectionHandle
 
 	case UAVTALK_STATE_DATA:
 
-		// update the CRC
-		iproc->cs = PIOS_CRC_updateByte(iproc->cs, rxbyte);
-
 		connection->rxBuffer[iproc->rxCount++] = rxbyte;
 		if (iproc->rxCount < iproc->length)
 			break;
 
+		// update the CRC over the whole payload at once
+		iproc->cs = PIOS_CRC_updateCRC(iproc->cs, connection->rxBuffer, iproc->length);
+
 		iproc->state = UAVTALK_STATE_CS;
 		iproc->rxCount = 0;
 		break;
@@ -530,6 +700,153 @@ UAVTalkRxState UAVTalkProcessInputStream(UAVTalkConnection connectionHandle, uin
 	return state;
 }
 
+/**
+ * Take as much of a block of received bytes as can be handled without
+ * going through the byte-at-a-time state machine: noise between packets is
+ * skipped with one scan for the sync byte, a complete header is checked in
+ * one go and the payload is copied in one piece.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] data Received bytes
+ * \param[in] length Number of bytes in data
+ * \return Number of bytes used, 0 if the next byte needs the state machine
+ */
+static uint16_t processBlock(UAVTalkConnectionData *connection, const uint8_t *data, uint16_t length)
+{
+	UAVTalkInputProcessor *iproc = &connection->iproc;
+
+	switch (iproc->state) {
+	case UAVTALK_STATE_ERROR:
+	case UAVTALK_STATE_COMPLETE:
+	case UAVTALK_STATE_SYNC:
+	{
+		const uint8_t *sync = memchr(data, UAVTALK_SYNC_VAL, length);
+		uint16_t skip = sync ? (sync - data) : length;
+
+		if (skip > 0) {
+			connection->stats.rxBytes += skip;
+			iproc->state = UAVTALK_STATE_SYNC;
+			return skip;
+		}
+
+		if (length < UAVTALK_MIN_HEADER_LENGTH) {
+			return 0;
+		}
+
+		uint16_t packet_size = data[2] | (data[3] << 8);
+
+		// Leave anything malformed to the state machine to reject
+		if ((data[1] & UAVTALK_TYPE_MASK) != UAVTALK_TYPE_VER ||
+				packet_size < UAVTALK_MIN_HEADER_LENGTH ||
+				packet_size > UAVTALK_MAX_HEADER_LENGTH + UAVTALK_MAX_PAYLOAD_LENGTH) {
+			return 0;
+		}
+
+		iproc->cs = PIOS_CRC_updateCRC(0, data, UAVTALK_MIN_HEADER_LENGTH);
+		iproc->type = data[1];
+		iproc->packet_size = packet_size;
+		iproc->objId = data[4] | (data[5] << 8) | (data[6] << 16) | ((uint32_t)data[7] << 24);
+		iproc->rxPacketLength = UAVTALK_MIN_HEADER_LENGTH;
+		connection->stats.rxBytes += UAVTALK_MIN_HEADER_LENGTH;
+
+		objIdReceived(connection);
+
+		return UAVTALK_MIN_HEADER_LENGTH;
+	}
+	case UAVTALK_STATE_DATA:
+	{
+		uint16_t count = iproc->length - iproc->rxCount;
+
+		if (count > length) {
+			count = length;
+		}
+
+		memcpy(&connection->rxBuffer[iproc->rxCount], data, count);
+		iproc->rxCount += count;
+		iproc->rxPacketLength += count;
+		connection->stats.rxBytes += count;
+
+		if (iproc->rxCount >= iproc->length) {
+			iproc->cs = PIOS_CRC_updateCRC(iproc->cs, connection->rxBuffer, iproc->length);
+			iproc->state = UAVTALK_STATE_CS;
+			iproc->rxCount = 0;
+		}
+
+		return count;
+	}
+	default:
+		return 0;
+	}
+}
+
+/**
+ * Process a block of bytes from the telemetry stream, stopping after the
+ * last byte of a complete packet so that the caller can act on it.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] data Received bytes
+ * \param[in] length Number of bytes in data
+ * \param[out] state The parser state after the last byte used
+ * \return Number of bytes used
+ */
+uint16_t UAVTalkProcessInputBlockQuiet(UAVTalkConnection connectionHandle, const uint8_t *data, uint16_t length, UAVTalkRxState *state)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,*state = UAVTALK_STATE_ERROR; return length);
+
+	UAVTalkInputProcessor *iproc = &connection->iproc;
+	uint16_t used = 0;
+
+	*state = (iproc->state == UAVTALK_STATE_COMPLETE) ? UAVTALK_STATE_SYNC : iproc->state;
+
+	while (used < length) {
+		uint16_t count = processBlock(connection, &data[used], length - used);
+
+		if (count > 0) {
+			used += count;
+			*state = iproc->state;
+			continue;
+		}
+
+		*state = UAVTalkProcessInputStreamQuiet(connectionHandle, data[used++]);
+		if (*state == UAVTALK_STATE_COMPLETE) {
+			break;
+		}
+	}
+
+	return used;
+}
+
+/**
+ * Process a block of bytes from the telemetry stream, acting on every
+ * packet completed in it.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] data Received bytes
+ * \param[in] length Number of bytes in data
+ * \return The parser state after the last byte
+ */
+UAVTalkRxState UAVTalkProcessInputBlock(UAVTalkConnection connectionHandle, const uint8_t *data, uint16_t length)
+{
+	UAVTalkConnectionData *connection;
+	CHECKCONHANDLE(connectionHandle,connection,return -1);
+
+	UAVTalkInputProcessor *iproc = &connection->iproc;
+	UAVTalkRxState state = iproc->state;
+
+	while (length > 0) {
+		uint16_t used = UAVTalkProcessInputBlockQuiet(connectionHandle, data, length, &state);
+
+		data += used;
+		length -= used;
+
+		if (state == UAVTALK_STATE_COMPLETE) {
+			PIOS_Recursive_Mutex_Lock(connection->lock, PIOS_MUTEX_TIMEOUT_MAX);
+			receiveObject(connection, iproc->type, iproc->objId, iproc->instId, connection->rxBuffer, iproc->length);
+			PIOS_Recursive_Mutex_Unlock(connection->lock);
+		}
+	}
+
+	return state;
+}
+
 /**
  * Send a parsed packet received on one connection handle out on a different connection handle.
  * The packet must be in a complete state, meaning it is completed parsing.
@@ -566,6 +883,8 @@ int32_t UAVTalkRelayPacket(UAVTalkConnection inConnectionHandle, UAVTalkConnecti
 	// Lock
 	PIOS_Recursive_Mutex_Lock(outConnection->lock, PIOS_MUTEX_TIMEOUT_MAX);
 
+	flushBatch(outConnection);
+
 	outConnection->txBuffer[0] = UAVTALK_SYNC_VAL;
 	// Setup type
 	outConnection->txBuffer[1] = inIproc->type;
@@ -695,6 +1014,8 @@ UAVTalkRxState UAVTalkRelayInputStream(UAVTalkConnection connectionHandle, uint8
 
 		if (!connection->outStream) return -1;
 
+		UAVTalkFlushBatch(connectionHandle);
+
 		// Setup type and object id fields
 		connection->txBuffer[0] = UAVTALK_SYNC_VAL;  // sync byte
 		connection->txBuffer[1] = iproc->type;
@@ -844,6 +1165,8 @@ static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, ui
 		if (obj && (instId != UAVOBJ_ALL_INSTANCES)) {
 			// Unpack object, if the instance does not exist it will be created!
 			UAVObjUnpack(obj, instId, data);
+			// The peer now holds its own data, not what we last sent
+			deltaForget(connection, obj, instId);
 			// Check if an ack is pending
 			updateAck(connection, obj, instId);
 		} else {
@@ -856,6 +1179,7 @@ static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, ui
 		if (obj && (instId != UAVOBJ_ALL_INSTANCES)) {
 			// Unpack object, if the instance does not exist it will be created!
 			if (UAVObjUnpack(obj, instId, data) == 0) {
+				deltaForget(connection, obj, instId);
 				// Transmit ACK
 				sendObject(connection, obj, instId, UAVTALK_TYPE_ACK);
 			} else {
@@ -870,14 +1194,37 @@ static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, ui
 		break;
 	case UAVTALK_TYPE_OBJ_REQ:
 		// Send requested object if message is of type OBJ_REQ
-		if (obj == 0)
+		if (obj == 0) {
 			sendNack(connection, objId);
-		else
+		} else {
+			// The requester may hold anything, so the reply goes whole
+			deltaForget(connection, obj, instId);
 			sendObject(connection, obj, instId, UAVTALK_TYPE_OBJ);
+		}
 		break;
 	case UAVTALK_TYPE_NACK:
 		// Do nothing on flight side, let it time out.
 		break;
+	case UAVTALK_TYPE_OBJ_BATCH:
+		// A peer that sends batch frames can receive them.  The GCS opens
+		// with an empty one, old peers never send any.
+		connection->batchEnabled = true;
+		ret = receiveBatch(connection, data, length);
+		break;
+	case UAVTALK_TYPE_OBJ_DELTA:
+		// Likewise for deltas, the GCS opens with one for object ID 0
+		connection->deltaEnabled = true;
+		if (obj && (instId != UAVOBJ_ALL_INSTANCES)) {
+			ret = applyDelta(connection, obj, instId, data, length);
+			deltaForget(connection, obj, instId);
+		} else if (objId == 0) {
+			// A peer opening again (restarted, or on another link) has
+			// none of the data our deltas would build on
+			deltaRefresh(connection);
+		} else {
+			ret = -1;
+		}
+		break;
 	case UAVTALK_TYPE_ACK:
 		// All instances, not allowed for ACK messages
 		if (obj && (instId != UAVOBJ_ALL_INSTANCES)) {
@@ -894,6 +1241,70 @@ static int32_t receiveObject(UAVTalkConnectionData *connection, uint8_t type, ui
 	return ret;
 }
 
+/**
+ * Unpack every record of a received batch frame.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] data Batch payload
+ * \param[in] length Payload length
+ * \return 0 Success
+ * \return -1 If any record was malformed or for an unknown object
+ */
+static int32_t receiveBatch(UAVTalkConnectionData *connection, uint8_t* data, int32_t length)
+{
+	uint8_t *end = data + length;
+	int32_t ret = 0;
+
+	while (data < end) {
+		if (end - data < UAVTALK_BATCH_RECORD_LENGTH) {
+			return -1;
+		}
+
+		uint32_t objId = data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+		uint16_t lengthWord = data[4] | (data[5] << 8);
+		uint16_t dataLength = lengthWord & UAVTALK_BATCH_LENGTH_MASK;
+		bool hasInstId = (lengthWord & UAVTALK_BATCH_INSTID) != 0;
+		bool isDelta = (lengthWord & UAVTALK_BATCH_DELTA) != 0;
+		uint16_t instId = 0;
+
+		data += UAVTALK_BATCH_RECORD_LENGTH;
+
+		if (hasInstId) {
+			if (end - data < 2) {
+				return -1;
+			}
+			instId = data[0] | (data[1] << 8);
+			data += 2;
+		}
+
+		if (end - data < dataLength) {
+			return -1;
+		}
+
+		UAVObjHandle obj = UAVObjGetByID(objId);
+
+		// Skip records we can't apply, the length word gets us past them
+		if (obj && isDelta && hasInstId != UAVObjIsSingleInstance(obj) &&
+				instId != UAVOBJ_ALL_INSTANCES) {
+			if (applyDelta(connection, obj, instId, data, dataLength) < 0) {
+				ret = -1;
+			}
+			deltaForget(connection, obj, instId);
+		} else if (obj && dataLength == UAVObjGetNumBytes(obj) &&
+				hasInstId != UAVObjIsSingleInstance(obj) &&
+				instId != UAVOBJ_ALL_INSTANCES) {
+			UAVObjUnpack(obj, instId, data);
+			deltaForget(connection, obj, instId);
+			updateAck(connection, obj, instId);
+		} else {
+			ret = -1;
+		}
+
+		data += dataLength;
+	}
+
+	return ret;
+}
+
 /**
  * Check if an ack is pending on an object and give response semaphore
  * \param[in] connection UAVTalkConnection to be used
@@ -965,37 +1376,12 @@ static int32_t sendObject(UAVTalkConnectionData *connection, UAVObjHandle obj, u
 static int32_t sendSingleObject(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint8_t type)
 {
 	int32_t length;
-	int32_t dataOffset;
-	uint32_t objId;
+	int32_t rc;
 
 	if (!connection->outStream) return -1;
 
-	// Setup type and object id fields
-	objId = UAVObjGetID(obj);
-	connection->txBuffer[0] = UAVTALK_SYNC_VAL;  // sync byte
-	connection->txBuffer[1] = type;
-	// data length inserted here below
-	connection->txBuffer[4] = (uint8_t)(objId & 0xFF);
-	connection->txBuffer[5] = (uint8_t)((objId >> 8) & 0xFF);
-	connection->txBuffer[6] = (uint8_t)((objId >> 16) & 0xFF);
-	connection->txBuffer[7] = (uint8_t)((objId >> 24) & 0xFF);
-
-	// Setup instance ID if one is required
-	if (UAVObjIsSingleInstance(obj)) {
-		dataOffset = 8;
-	} else {
-		connection->txBuffer[8] = (uint8_t)(instId & 0xFF);
-		connection->txBuffer[9] = (uint8_t)((instId >> 8) & 0xFF);
-		dataOffset = 10;
-	}
-
-	// Add timestamp when the transaction type is appropriate
-	if (type & UAVTALK_TIMESTAMPED) {
-		uint32_t time = PIOS_Thread_Systime();
-		connection->txBuffer[dataOffset] = (uint8_t)(time & 0xFF);
-		connection->txBuffer[dataOffset + 1] = (uint8_t)((time >> 8) & 0xFF);
-		dataOffset += 2;
-	}
+	// Keep the stream in order behind anything already batched
+	flushBatch(connection);
 
 	// Determine data length
 	if (type == UAVTALK_TYPE_OBJ_REQ || type == UAVTALK_TYPE_ACK) {
@@ -1009,34 +1395,125 @@ static int32_t sendSingleObject(UAVTalkConnectionData *connection, UAVObjHandle
 		return -1;
 	}
 
-	// Copy data (if any)
-	if (length > 0) {
-		if (UAVObjPack(obj, instId, &connection->txBuffer[dataOffset]) < 0) {
+	uint16_t dataOffset = UAVTALK_MIN_HEADER_LENGTH;
+	if (!UAVObjIsSingleInstance(obj)) {
+		dataOffset += 2;
+	}
+	if (type & UAVTALK_TIMESTAMPED) {
+		dataOffset += 2;
+	}
+	uint16_t tx_msg_len = dataOffset + length + UAVTALK_CHECKSUM_LENGTH;
+
+	// Plain updates may go as a delta, whose length is only known once
+	// the data has been compared with what was sent before
+	bool delta = (type == UAVTALK_TYPE_OBJ) && connection->deltaEnabled &&
+		(length >= UAVTALK_DELTA_MIN_LENGTH);
+
+	// Build the packet straight into the device's buffer when there is
+	// room for it in one piece, saving the copy through txBuffer
+	uintptr_t com_id = (connection->outCom && !delta) ? connection->outCom() : 0;
+	uint8_t *buf = com_id ? PIOS_COM_ReserveTxBuffer(com_id, tx_msg_len) : NULL;
+
+	if (buf) {
+		if (buildPacket(buf, obj, instId, type, length) < 0) {
+			PIOS_COM_CommitTxBuffer(com_id, 0);
 			return -1;
 		}
-	}
 
-	// Store the packet length
-	connection->txBuffer[2] = (uint8_t)((dataOffset+length) & 0xFF);
-	connection->txBuffer[3] = (uint8_t)(((dataOffset+length) >> 8) & 0xFF);
+		rc = PIOS_COM_CommitTxBuffer(com_id, tx_msg_len);
+	} else {
+		if (buildPacket(connection->txBuffer, obj, instId, type, length) < 0) {
+			return -1;
+		}
 
-	// Calculate checksum
-	connection->txBuffer[dataOffset+length] = PIOS_CRC_updateCRC(0, connection->txBuffer, dataOffset+length);
+		uint16_t deltaLength = delta ? deltaEncode(connection, obj, instId,
+				&connection->txBuffer[dataOffset], length) : 0;
 
-	uint16_t tx_msg_len = dataOffset+length+UAVTALK_CHECKSUM_LENGTH;
-	int32_t rc = (*connection->outStream)(connection->txBuffer, tx_msg_len);
+		if (deltaLength > 0) {
+			length = deltaLength;
+			tx_msg_len = dataOffset + length + UAVTALK_CHECKSUM_LENGTH;
+			connection->txBuffer[1] = UAVTALK_TYPE_OBJ_DELTA;
+			connection->txBuffer[2] = (uint8_t)((dataOffset+length) & 0xFF);
+			connection->txBuffer[3] = (uint8_t)(((dataOffset+length) >> 8) & 0xFF);
+			connection->txBuffer[dataOffset+length] = PIOS_CRC_updateCRC(0, connection->txBuffer, dataOffset+length);
+		}
+
+		rc = (*connection->outStream)(connection->txBuffer, tx_msg_len);
+	}
 
 	if (rc == tx_msg_len) {
 		// Update stats
 		++connection->stats.txObjects;
 		connection->stats.txBytes += tx_msg_len;
 		connection->stats.txObjectBytes += length;
+	} else if (delta) {
+		// The peer may have missed data the next delta would build on
+		deltaRefresh(connection);
 	}
 
 	// Done
 	return 0;
 }
 
+/**
+ * Lay out a complete packet for an object: header, data and checksum.
+ * \param[out] buf Where to build the packet
+ * \param[in] obj Object handle
+ * \param[in] instId The instance ID
+ * \param[in] type Transaction type
+ * \param[in] length Number of object data bytes to include
+ * \return Packet length including the checksum
+ * \return -1 Failure
+ */
+static int32_t buildPacket(uint8_t *buf, UAVObjHandle obj, uint16_t instId, uint8_t type, int32_t length)
+{
+	int32_t dataOffset;
+	uint32_t objId;
+
+	// Setup type and object id fields
+	objId = UAVObjGetID(obj);
+	buf[0] = UAVTALK_SYNC_VAL;  // sync byte
+	buf[1] = type;
+	// data length inserted here below
+	buf[4] = (uint8_t)(objId & 0xFF);
+	buf[5] = (uint8_t)((objId >> 8) & 0xFF);
+	buf[6] = (uint8_t)((objId >> 16) & 0xFF);
+	buf[7] = (uint8_t)((objId >> 24) & 0xFF);
+
+	// Setup instance ID if one is required
+	if (UAVObjIsSingleInstance(obj)) {
+		dataOffset = 8;
+	} else {
+		buf[8] = (uint8_t)(instId & 0xFF);
+		buf[9] = (uint8_t)((instId >> 8) & 0xFF);
+		dataOffset = 10;
+	}
+
+	// Add timestamp when the transaction type is appropriate
+	if (type & UAVTALK_TIMESTAMPED) {
+		uint32_t time = PIOS_Thread_Systime();
+		buf[dataOffset] = (uint8_t)(time & 0xFF);
+		buf[dataOffset + 1] = (uint8_t)((time >> 8) & 0xFF);
+		dataOffset += 2;
+	}
+
+	// Copy data (if any)
+	if (length > 0) {
+		if (UAVObjPack(obj, instId, &buf[dataOffset]) < 0) {
+			return -1;
+		}
+	}
+
+	// Store the packet length
+	buf[2] = (uint8_t)((dataOffset+length) & 0xFF);
+	buf[3] = (uint8_t)(((dataOffset+length) >> 8) & 0xFF);
+
+	// Calculate checksum
+	buf[dataOffset+length] = PIOS_CRC_updateCRC(0, buf, dataOffset+length);
+
+	return dataOffset + length + UAVTALK_CHECKSUM_LENGTH;
+}
+
 /**
  * Send a NACK through the telemetry link.
  * \param[in] connection UAVTalkConnection to be used
@@ -1050,6 +1527,8 @@ static int32_t sendNack(UAVTalkConnectionData *connection, uint32_t objId)
 
 	if (!connection->outStream) return -1;
 
+	flushBatch(connection);
+
 	connection->txBuffer[0] = UAVTALK_SYNC_VAL;  // sync byte
 	connection->txBuffer[1] = UAVTALK_TYPE_NACK;
 	// data length inserted here below
@@ -1079,6 +1558,341 @@ static int32_t sendNack(UAVTalkConnectionData *connection, uint32_t objId)
 	return 0;
 }
 
+/**
+ * Append one object instance to the batch frame being built in the
+ * transmit buffer, sending the frame first if the record won't fit.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object handle to send
+ * \param[in] instId The instance ID (can NOT be UAVOBJ_ALL_INSTANCES)
+ * \return 0 Success
+ * \return -1 Failure
+ */
+static int32_t batchObject(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId)
+{
+	if (!connection->outStream) return -1;
+
+	bool hasInstId = !UAVObjIsSingleInstance(obj);
+	uint16_t length = UAVObjGetNumBytes(obj);
+	int32_t recordLength = UAVTALK_BATCH_RECORD_LENGTH + (hasInstId ? 2 : 0) + length;
+
+	// Objects too big to share a frame go out on their own
+	if (recordLength > UAVTALK_BATCH_MAX_PAYLOAD) {
+		return sendSingleObject(connection, obj, instId, UAVTALK_TYPE_OBJ);
+	}
+
+	if (connection->batchLength + recordLength > UAVTALK_BATCH_MAX_PAYLOAD) {
+		flushBatch(connection);
+	}
+
+	uint32_t objId = UAVObjGetID(obj);
+	uint16_t lengthWord = length | (hasInstId ? UAVTALK_BATCH_INSTID : 0);
+	uint8_t *record = &connection->txBuffer[UAVTALK_MIN_HEADER_LENGTH + connection->batchLength];
+	uint8_t *data = &record[UAVTALK_BATCH_RECORD_LENGTH + (hasInstId ? 2 : 0)];
+
+	if (UAVObjPack(obj, instId, data) < 0) {
+		return -1;
+	}
+
+	if (connection->deltaEnabled && length >= UAVTALK_DELTA_MIN_LENGTH) {
+		uint16_t deltaLength = deltaEncode(connection, obj, instId, data, length);
+
+		if (deltaLength > 0) {
+			lengthWord = deltaLength | UAVTALK_BATCH_DELTA | (hasInstId ? UAVTALK_BATCH_INSTID : 0);
+			recordLength -= length - deltaLength;
+		}
+	}
+
+	record[0] = (uint8_t)(objId & 0xFF);
+	record[1] = (uint8_t)((objId >> 8) & 0xFF);
+	record[2] = (uint8_t)((objId >> 16) & 0xFF);
+	record[3] = (uint8_t)((objId >> 24) & 0xFF);
+	record[4] = (uint8_t)(lengthWord & 0xFF);
+	record[5] = (uint8_t)((lengthWord >> 8) & 0xFF);
+
+	if (hasInstId) {
+		record[6] = (uint8_t)(instId & 0xFF);
+		record[7] = (uint8_t)((instId >> 8) & 0xFF);
+	}
+
+	connection->batchLength += recordLength;
+	connection->batchRecords++;
+
+	return 0;
+}
+
+/**
+ * Send the batch frame built up in the transmit buffer, if any.
+ * \param[in] connection UAVTalkConnection to be used
+ * \return 0 Success
+ * \return -1 Failure
+ */
+static int32_t flushBatch(UAVTalkConnectionData *connection)
+{
+	if (connection->batchRecords == 0) {
+		return 0;
+	}
+
+	uint16_t dataLength = UAVTALK_MIN_HEADER_LENGTH + connection->batchLength;
+
+	connection->txBuffer[0] = UAVTALK_SYNC_VAL;
+	connection->txBuffer[1] = UAVTALK_TYPE_OBJ_BATCH;
+	connection->txBuffer[2] = (uint8_t)(dataLength & 0xFF);
+	connection->txBuffer[3] = (uint8_t)((dataLength >> 8) & 0xFF);
+	memset(&connection->txBuffer[4], 0, 4);
+
+	connection->txBuffer[dataLength] = PIOS_CRC_updateCRC(0, connection->txBuffer, dataLength);
+
+	uint16_t tx_msg_len = dataLength + UAVTALK_CHECKSUM_LENGTH;
+	int32_t rc = (*connection->outStream)(connection->txBuffer, tx_msg_len);
+
+	if (rc == tx_msg_len) {
+		// Update stats
+		connection->stats.txObjects += connection->batchRecords;
+		connection->stats.txBytes += tx_msg_len;
+		connection->stats.txObjectBytes += connection->batchLength;
+	} else {
+		// The peer may have missed data the next delta would build on
+		deltaRefresh(connection);
+	}
+
+	connection->batchLength = 0;
+	connection->batchRecords = 0;
+
+	return (rc == tx_msg_len) ? 0 : -1;
+}
+
+/**
+ * Find the slot holding what was last sent for an object instance, giving
+ * it a free one if it has none yet.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object handle
+ * \param[in] instId The instance ID
+ * \param[in] length Size of the object data
+ * \return The slot, NULL if none is free
+ */
+static UAVTalkDeltaSlot *deltaSlot(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint16_t length)
+{
+	if (!connection->deltaSlots) {
+		connection->deltaSlots = PIOS_malloc_no_dma(UAVTALK_DELTA_SLOTS * sizeof(UAVTalkDeltaSlot));
+		if (!connection->deltaSlots) {
+			return NULL;
+		}
+		memset(connection->deltaSlots, 0, UAVTALK_DELTA_SLOTS * sizeof(UAVTalkDeltaSlot));
+	}
+
+	UAVTalkDeltaSlot *reuse = NULL;
+	UAVTalkDeltaSlot *unused = NULL;
+
+	for (int i = 0; i < UAVTALK_DELTA_SLOTS; i++) {
+		UAVTalkDeltaSlot *slot = &connection->deltaSlots[i];
+
+		if (slot->obj == obj && slot->instId == instId) {
+			return slot;
+		} else if (slot->obj) {
+			continue;
+		}
+
+		// Prefer a released slot whose buffer is big enough, as the
+		// buffers are never freed
+		if (slot->shadow && slot->size >= length) {
+			if (!reuse) {
+				reuse = slot;
+			}
+		} else if (!slot->shadow && !unused) {
+			unused = slot;
+		}
+	}
+
+	UAVTalkDeltaSlot *slot = reuse ? reuse : unused;
+
+	if (!slot) {
+		return NULL;
+	}
+
+	if (!slot->shadow) {
+		slot->shadow = PIOS_malloc_no_dma(length);
+		if (!slot->shadow) {
+			return NULL;
+		}
+		slot->size = length;
+	}
+
+	slot->obj = obj;
+	slot->instId = instId;
+	slot->sends = UAVTALK_DELTA_REFRESH;
+	slot->misses = 0;
+
+	return slot;
+}
+
+/**
+ * Turn packed object data into a delta against the data last sent for it,
+ * in place, and remember the new data for next time.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object handle
+ * \param[in] instId The instance ID
+ * \param[in,out] data Packed object data
+ * \param[in] length Size of the object data
+ * \return Length of the delta, 0 if the data should be sent whole
+ */
+static uint16_t deltaEncode(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, uint8_t *data, uint16_t length)
+{
+	uint8_t numFields;
+	const uint16_t *offsets = UAVObjectsFieldOffsets(UAVObjGetID(obj), &numFields);
+
+	if (!offsets || offsets[numFields] != length) {
+		return 0;
+	}
+
+	UAVTalkDeltaSlot *slot = deltaSlot(connection, obj, instId, length);
+
+	if (!slot) {
+		return 0;
+	}
+
+	if (slot->sends >= UAVTALK_DELTA_REFRESH) {
+		memcpy(slot->shadow, data, length);
+		slot->sends = 0;
+		return 0;
+	}
+
+	uint8_t mask[UAVTALK_DELTA_MAX_MASK];
+	uint8_t maskLength = (numFields + 7) / 8;
+	uint16_t deltaLength = 0;
+
+	memset(mask, 0, maskLength);
+
+	// Pack the changed fields down to the start of the buffer
+	for (uint8_t n = 0; n < numFields; n++) {
+		uint16_t start = offsets[n];
+		uint16_t size = offsets[n + 1] - start;
+
+		if (memcmp(&data[start], &slot->shadow[start], size) != 0) {
+			mask[n / 8] |= 1 << (n % 8);
+			memcpy(&slot->shadow[start], &data[start], size);
+			memmove(&data[deltaLength], &data[start], size);
+			deltaLength += size;
+		}
+	}
+
+	if (maskLength + deltaLength >= length) {
+		// Nothing saved, so put the whole object back
+		memcpy(data, slot->shadow, length);
+		slot->sends = 0;
+		if (++slot->misses >= UAVTALK_DELTA_MAX_MISSES) {
+			slot->obj = NULL;
+		}
+		return 0;
+	}
+
+	memmove(&data[maskLength], data, deltaLength);
+	memcpy(data, mask, maskLength);
+	slot->sends++;
+	slot->misses = 0;
+
+	return maskLength + deltaLength;
+}
+
+/**
+ * Make the next update of every object go out whole.
+ * \param[in] connection UAVTalkConnection to be used
+ */
+static void deltaRefresh(UAVTalkConnectionData *connection)
+{
+	if (!connection->deltaSlots) {
+		return;
+	}
+
+	for (int i = 0; i < UAVTALK_DELTA_SLOTS; i++) {
+		connection->deltaSlots[i].sends = UAVTALK_DELTA_REFRESH;
+	}
+}
+
+/**
+ * Make the next update of an object go out whole, as the peer's copy no
+ * longer matches what was last sent: it wrote the object itself, or asked
+ * for it without holding anything.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object handle
+ * \param[in] instId The instance ID, or UAVOBJ_ALL_INSTANCES
+ */
+static void deltaForget(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId)
+{
+	if (!connection->deltaSlots) {
+		return;
+	}
+
+	for (int i = 0; i < UAVTALK_DELTA_SLOTS; i++) {
+		UAVTalkDeltaSlot *slot = &connection->deltaSlots[i];
+
+		if (slot->obj == obj &&
+				(instId == UAVOBJ_ALL_INSTANCES || slot->instId == instId)) {
+			slot->sends = UAVTALK_DELTA_REFRESH;
+		}
+	}
+}
+
+/**
+ * Update an object from a delta.
+ * \param[in] connection UAVTalkConnection to be used
+ * \param[in] obj Object handle
+ * \param[in] instId The instance ID
+ * \param[in] data Field bitmap and changed fields
+ * \param[in] length Length of data
+ * \return 0 Success
+ * \return -1 Failure
+ */
+static int32_t applyDelta(UAVTalkConnectionData *connection, UAVObjHandle obj, uint16_t instId, const uint8_t *data, int32_t length)
+{
+	uint8_t numFields;
+	const uint16_t *offsets = UAVObjectsFieldOffsets(UAVObjGetID(obj), &numFields);
+	uint16_t size = UAVObjGetNumBytes(obj);
+
+	if (!offsets || offsets[numFields] != size) {
+		return -1;
+	}
+
+	uint8_t maskLength = (numFields + 7) / 8;
+	const uint8_t *end = data + length;
+	const uint8_t *field = data + maskLength;
+
+	if (length < maskLength) {
+		return -1;
+	}
+
+	if (!connection->deltaBuffer) {
+		connection->deltaBuffer = PIOS_malloc_no_dma(UAVOBJECTS_LARGEST);
+		if (!connection->deltaBuffer) {
+			return -1;
+		}
+	}
+
+	if (UAVObjPack(obj, instId, connection->deltaBuffer) < 0) {
+		return -1;
+	}
+
+	for (uint8_t n = 0; n < numFields; n++) {
+		if (data[n / 8] & (1 << (n % 8))) {
+			uint16_t fieldSize = offsets[n + 1] - offsets[n];
+
+			if (end - field < fieldSize) {
+				return -1;
+			}
+			memcpy(&connection->deltaBuffer[offsets[n]], field, fieldSize);
+			field += fieldSize;
+		}
+	}
+
+	if (field != end) {
+		return -1;
+	}
+
+	UAVObjUnpack(obj, instId, connection->deltaBuffer);
+	updateAck(connection, obj, instId);
+
+	return 0;
+}
+
 /**
  * @}
  * @}
@@ -291,6 +291,8 @@ static const struct flashfs_logfs_cfg flashfs_settings_cfg = {
 	.fs_magic      = 0x99abcdef,
 	.arena_size    = 0x00010000, /* 256 * slot size */
 	.slot_size     = 0x00000100, /* 256 bytes */
+	.use_index     = false,      /* No RAM to spare for an index */
+	.use_copy_buf  = false,
 };
 
 #if defined(PIOS_INCLUDE_FLASH_JEDEC)
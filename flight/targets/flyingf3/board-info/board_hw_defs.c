@@ -817,6 +817,8 @@ static const struct flashfs_logfs_cfg flashfs_internal_settings_cfg = {
 	.fs_magic      = 0x9ae1ee11,
 	.arena_size    = 0x00002000,       /* 32 * slot size = 8K bytes = 4 sectors */
 	.slot_size     = 0x00000100,       /* 256 bytes */
+	.use_index     = true,
+	.use_copy_buf  = true,
 };
 
 static const struct flashfs_logfs_cfg flashfs_internal_waypoints_cfg = {
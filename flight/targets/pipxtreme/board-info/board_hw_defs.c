@@ -688,6 +688,8 @@ static const struct flashfs_logfs_cfg flashfs_internal_settings_cfg = {
 	.fs_magic      = 0x9ae1ee11,
 	.arena_size    = 0x00002000,       /* 32 * slot size = 8K bytes = 4 sectors */
 	.slot_size     = 0x00000100,       /* 256 bytes */
+	.use_index     = false,            /* No RAM to spare for an index */
+	.use_copy_buf  = false,
 };
 
 #include "pios_flash_internal_priv.h"
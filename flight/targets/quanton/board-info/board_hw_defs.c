@@ -574,6 +574,8 @@ static const struct flashfs_logfs_cfg flashfs_settings_cfg = {
 	.fs_magic = 0x3b1b14cf,
 	.arena_size = 0x00004000,	/* 64 * slot size */
 	.slot_size = 0x00000100,	/* 256 bytes */
+	.use_index = true,
+	.use_copy_buf = true,
 };
 
 static const struct flashfs_logfs_cfg flashfs_waypoints_cfg = {
@@ -0,0 +1,488 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsTargets Tau Labs Targets
+ * @{
+ * @addtogroup Simulation Simulation support files
+ * @{
+ *
+ * @file       replay.c
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Run the attitude estimator against a recorded log.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * The log is read in one go and pushed through the UAVTalk parser.  Only the
+ * sensor streams the estimator consumes, @ref FlightStatus, @ref GPSTime and
+ * the settings objects are unpacked, so the recorded estimator outputs do not
+ * overwrite the replayed ones.  Each time both @ref Gyros and @ref Accels have
+ * been updated the estimator in attitude.c runs one iteration and the result
+ * is written out, as CSV by default or as fixed size binary records with -b.
+ *
+ * There is no scheduler in the loop: time only moves when the log says so.
+ * PIOS_DELAY and the parts of the PIOS_Thread API the estimator uses are
+ * implemented here on top of the log timestamps, so PIOS_Thread_Systime()
+ * reads the flight controller's uptime at the sample being replayed.
+ */
+
+#include "openpilot.h"
+#include "uavobjectsinit.h"
+#include "uavtalk.h"
+
+#include "accels.h"
+#include "attitudeactual.h"
+#include "baroaltitude.h"
+#include "flightstatus.h"
+#include "gpsposition.h"
+#include "gpstime.h"
+#include "gpsvelocity.h"
+#include "gyros.h"
+#include "gyrosbias.h"
+#include "magnetometer.h"
+#include "positionactual.h"
+#include "systemstats.h"
+#include "velocityactual.h"
+
+#include <getopt.h>
+#include <time.h>
+
+/* In attitude.c when built with ATTITUDE_REPLAY */
+extern int32_t AttitudeInitialize(void);
+extern int32_t AttitudeReplayStart(void);
+extern void AttitudeReplayStep(void);
+
+#define LOG_HEADER "dRonin git hash:\n"
+#define LOG_HEADER_LINES 3
+
+//! One binary output record, little endian on every supported host
+struct replay_record {
+	uint32_t time_us;
+	float q[4];
+	float rpy[3];
+	float position[3];
+	float velocity[3];
+	float gyro_bias[3];
+} __attribute__((packed));
+
+//! The virtual clock, in microseconds of log time
+static uint32_t replay_time_us;
+
+//! The flight controller's uptime at the sample being replayed
+static uint32_t replay_time_ms;
+
+//! Packet timestamp unwrapping state
+static uint16_t last_stamp;
+static uint32_t stamp_wraps;
+
+/* Used by pios_debug.c, no COM device is opened so debug output is dropped */
+uintptr_t pios_com_debug_id;
+
+/* No settings partition: settings only come from the log */
+uintptr_t pios_uavo_settings_fs_id;
+
+/* Local Variables */
+static bool binary_output;
+static FILE *output;
+
+MODULE_INITSYSTEM_DECLS;
+
+static void usage(const char *cmd_name)
+{
+	fprintf(stderr, "usage: %s [-b] [-o output] logfile\n"
+		"\n"
+		"\t-b\tWrite binary records instead of CSV\n"
+		"\t-o\tWrite the estimate to output instead of stdout\n",
+		cmd_name);
+
+	exit(1);
+}
+
+int32_t PIOS_DELAY_Init(void)
+{
+	return 0;
+}
+
+int32_t PIOS_DELAY_WaituS(uint32_t uS)
+{
+	return 0;
+}
+
+int32_t PIOS_DELAY_WaitmS(uint32_t mS)
+{
+	return 0;
+}
+
+uint32_t PIOS_DELAY_GetuS()
+{
+	return replay_time_us;
+}
+
+uint32_t PIOS_DELAY_GetuSSince(uint32_t t)
+{
+	return replay_time_us - t;
+}
+
+uint32_t PIOS_DELAY_GetRaw()
+{
+	return replay_time_us;
+}
+
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
+{
+	return replay_time_us - raw;
+}
+
+uint32_t PIOS_DELAY_DiffuS2(uint32_t raw, uint32_t later)
+{
+	return later - raw;
+}
+
+/* Only the ChibiOS main thread runs, so threads are never created */
+struct pios_thread *PIOS_Thread_Create(void (*fp)(void *), const char *namep,
+		size_t stack_bytes, void *argp, enum pios_thread_prio_e prio)
+{
+	return NULL;
+}
+
+uint32_t PIOS_Thread_Systime(void)
+{
+	return replay_time_ms;
+}
+
+void PIOS_Thread_Sleep(uint32_t time_ms)
+{
+}
+
+/* Called from the ChibiOS idle thread */
+void vApplicationIdleHook(void)
+{
+}
+
+/**
+ * Extend the 16 bit millisecond packet timestamp.  Objects are logged from
+ * several tasks so the stamps can step back slightly; only a large step
+ * back is taken as a wrap.
+ */
+static uint32_t unwrap_timestamp(uint16_t stamp)
+{
+	if (stamp < last_stamp && (last_stamp - stamp) > 0x8000)
+		stamp_wraps += 0x10000;
+	last_stamp = stamp;
+
+	return stamp_wraps + stamp;
+}
+
+/**
+ * Find the flight controller's uptime at the start of the log.  The packet
+ * stamps only carry the low 16 bits, so the upper bits are recovered from
+ * the first @ref SystemStats in the log.  Without one the log is taken to
+ * start less than 65 seconds after boot.
+ * \returns the amount to add to the unwrapped packet stamps
+ */
+static uint32_t find_uptime_offset(const uint8_t *buf, size_t len, size_t pos)
+{
+	UAVTalkConnection uavTalkCon = UAVTalkInitialize(NULL);
+	PIOS_Assert(uavTalkCon);
+
+	uint32_t offset = 0;
+
+	while (pos < len) {
+		UAVTalkRxState state;
+		uint16_t chunk = (len - pos) > 0xffff ? 0xffff : (len - pos);
+
+		pos += UAVTalkProcessInputBlockQuiet(uavTalkCon, &buf[pos], chunk, &state);
+		if (state != UAVTALK_STATE_COMPLETE)
+			continue;
+
+		uint16_t stamp;
+		UAVTalkGetLastTimestamp(uavTalkCon, &stamp);
+		uint32_t log_ms = unwrap_timestamp(stamp);
+
+		if (UAVTalkGetPacketObjId(uavTalkCon) != SYSTEMSTATS_OBJID)
+			continue;
+
+		SystemStatsData stats;
+		UAVTalkReceiveObject(uavTalkCon);
+		SystemStatsGet(&stats);
+
+		offset = (stats.FlightTime - log_ms + 0x8000) & 0xffff0000;
+		break;
+	}
+
+	last_stamp = 0;
+	stamp_wraps = 0;
+
+	return offset;
+}
+
+/**
+ * Pick the time of a sensor sample.  The log only has millisecond stamps
+ * and several samples often share one, which would give the filters a zero
+ * dT.  Those are spaced by the mean sample period seen so far instead.
+ */
+static uint32_t sample_time_us(uint32_t log_us)
+{
+	static uint32_t first_us;
+	static uint32_t last_us;
+	static uint32_t samples;
+
+	if (samples == 0) {
+		first_us = log_us;
+	} else if (log_us <= last_us) {
+		uint32_t period = (last_us - first_us) / samples;
+		log_us = last_us + (period > 0 ? period : 1);
+	}
+
+	samples++;
+	last_us = log_us;
+
+	return log_us;
+}
+
+//! Whether a logged object is an input of the estimator
+static bool replay_input(UAVObjHandle obj)
+{
+	return UAVObjIsSettings(obj) ||
+		obj == GyrosHandle() ||
+		obj == AccelsHandle() ||
+		obj == MagnetometerHandle() ||
+		obj == BaroAltitudeHandle() ||
+		obj == GPSPositionHandle() ||
+		obj == GPSVelocityHandle() ||
+		obj == GPSTimeHandle() ||
+		obj == FlightStatusHandle();
+}
+
+//! Write the current estimate
+static void write_estimate(void)
+{
+	struct replay_record rec;
+	AttitudeActualData attitude;
+	PositionActualData position;
+	VelocityActualData velocity;
+	GyrosBiasData gyro_bias;
+
+	AttitudeActualGet(&attitude);
+	PositionActualGet(&position);
+	VelocityActualGet(&velocity);
+	GyrosBiasGet(&gyro_bias);
+
+	rec.time_us = replay_time_us;
+	rec.q[0] = attitude.q1;
+	rec.q[1] = attitude.q2;
+	rec.q[2] = attitude.q3;
+	rec.q[3] = attitude.q4;
+	rec.rpy[0] = attitude.Roll;
+	rec.rpy[1] = attitude.Pitch;
+	rec.rpy[2] = attitude.Yaw;
+	rec.position[0] = position.North;
+	rec.position[1] = position.East;
+	rec.position[2] = position.Down;
+	rec.velocity[0] = velocity.North;
+	rec.velocity[1] = velocity.East;
+	rec.velocity[2] = velocity.Down;
+	rec.gyro_bias[0] = gyro_bias.x;
+	rec.gyro_bias[1] = gyro_bias.y;
+	rec.gyro_bias[2] = gyro_bias.z;
+
+	if (binary_output) {
+		fwrite(&rec, sizeof(rec), 1, output);
+		return;
+	}
+
+	fprintf(output, "%u,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f\n",
+		rec.time_us, rec.q[0], rec.q[1], rec.q[2], rec.q[3],
+		rec.rpy[0], rec.rpy[1], rec.rpy[2],
+		rec.position[0], rec.position[1], rec.position[2],
+		rec.velocity[0], rec.velocity[1], rec.velocity[2],
+		rec.gyro_bias[0], rec.gyro_bias[1], rec.gyro_bias[2]);
+}
+
+//! Read the whole log into memory
+static uint8_t *read_log(const char *path, size_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	if (!f) {
+		perror(path);
+		return NULL;
+	}
+
+	fseek(f, 0, SEEK_END);
+	*len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+
+	uint8_t *buf = malloc(*len);
+	if (buf && fread(buf, 1, *len, f) != *len) {
+		perror(path);
+		free(buf);
+		buf = NULL;
+	}
+
+	fclose(f);
+
+	return buf;
+}
+
+//! Skip the text header written by the logging module, if present
+static size_t skip_header(const uint8_t *buf, size_t len)
+{
+	size_t pos = 0;
+
+	if (len < strlen(LOG_HEADER) || memcmp(buf, LOG_HEADER, strlen(LOG_HEADER)))
+		return 0;
+
+	for (int lines = 0; lines < LOG_HEADER_LINES && pos < len; pos++) {
+		if (buf[pos] == '\n')
+			lines++;
+	}
+
+	return pos;
+}
+
+static double wall_time(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *output_path = NULL;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "bo:")) != -1) {
+		switch (opt) {
+		case 'b':
+			binary_output = true;
+			break;
+		case 'o':
+			output_path = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			break;
+		}
+	}
+
+	if (optind != argc - 1)
+		usage(argv[0]);
+
+	size_t len;
+	uint8_t *buf = read_log(argv[optind], &len);
+	if (!buf)
+		return 1;
+
+	output = output_path ? fopen(output_path, "wb") : stdout;
+	if (!output) {
+		perror(output_path);
+		return 1;
+	}
+
+	if (!binary_output)
+		fprintf(output, "time_us,q1,q2,q3,q4,roll,pitch,yaw,north,east,down,"
+			"vnorth,veast,vdown,gyrobias_x,gyrobias_y,gyrobias_z\n");
+
+	PIOS_heap_initialize_blocks();
+
+#if defined(PIOS_INCLUDE_CHIBIOS)
+	halInit();
+	chSysInit();
+
+	boardInit();
+#endif /* defined(PIOS_INCLUDE_CHIBIOS) */
+
+	UAVObjInitialize();
+	UAVObjectsInitializeAll();
+	AlarmsInitialize();
+
+	if (AttitudeInitialize() != 0 || AttitudeReplayStart() != 0) {
+		fprintf(stderr, "Unable to start the attitude estimator\n");
+		return 1;
+	}
+
+	UAVTalkConnection uavTalkCon = UAVTalkInitialize(NULL);
+	PIOS_Assert(uavTalkCon);
+
+	bool gyro_updated = false;
+	bool accel_updated = false;
+	uint32_t samples = 0;
+	uint32_t first_us = 0;
+
+	double start = wall_time();
+
+	size_t pos = skip_header(buf, len);
+	uint32_t uptime_offset = find_uptime_offset(buf, len, pos);
+
+	while (pos < len) {
+		UAVTalkRxState state;
+		uint16_t chunk = (len - pos) > 0xffff ? 0xffff : (len - pos);
+
+		pos += UAVTalkProcessInputBlockQuiet(uavTalkCon, &buf[pos], chunk, &state);
+		if (state != UAVTALK_STATE_COMPLETE)
+			continue;
+
+		uint16_t stamp;
+		UAVTalkGetLastTimestamp(uavTalkCon, &stamp);
+		uint32_t log_ms = uptime_offset + unwrap_timestamp(stamp);
+
+		UAVObjHandle obj = UAVObjGetByID(UAVTalkGetPacketObjId(uavTalkCon));
+		if (!obj || !replay_input(obj))
+			continue;
+
+		UAVTalkReceiveObject(uavTalkCon);
+
+		if (obj == GyrosHandle())
+			gyro_updated = true;
+		else if (obj == AccelsHandle())
+			accel_updated = true;
+
+		if (!gyro_updated || !accel_updated)
+			continue;
+
+		replay_time_ms = log_ms;
+		replay_time_us = sample_time_us(log_ms * 1000);
+		if (samples == 0)
+			first_us = replay_time_us;
+
+		AttitudeReplayStep();
+		write_estimate();
+
+		gyro_updated = false;
+		accel_updated = false;
+		samples++;
+	}
+
+	double elapsed = wall_time() - start;
+	double log_seconds = (replay_time_us - first_us) * 1e-6;
+
+	fflush(output);
+
+	fprintf(stderr, "%u samples, %.1f s of log in %.3f s: %.0f samples/s, %.0fx real time\n",
+		samples, log_seconds, elapsed,
+		elapsed > 0 ? samples / elapsed : 0,
+		elapsed > 0 ? log_seconds / elapsed : 0);
+
+	return 0;
+}
+
+/**
+ * @}
+ * @}
+ */
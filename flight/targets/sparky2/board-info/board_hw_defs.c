@@ -546,12 +546,16 @@ static const struct flashfs_logfs_cfg flashfs_settings_internal_cfg = {
 	.fs_magic      = 0x99abcedf,
 	.arena_size    = 0x00004000, /* 256 * slot size */
 	.slot_size     = 0x00000100, /* 256 bytes */
+	.use_index     = true,
+	.use_copy_buf  = true,
 };
 
 static const struct flashfs_logfs_cfg flashfs_settings_external_cfg = {
 	.fs_magic      = 0x77abcedf,
 	.arena_size    = 0x00010000, /* 256 * slot size */
 	.slot_size     = 0x00000100, /* 256 bytes */
+	.use_index     = true,
+	.use_copy_buf  = true,
 };
 
 
@@ -0,0 +1,138 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+
+extern "C" {
+
+#include "biquad.h"		/* API for biquad functions */
+
+}
+
+#include <math.h>		/* sinf() */
+
+#define SAMPLE_RATE 1000.0f
+
+// To use a test fixture, derive a class from testing::Test.
+class Biquad : public testing::Test {
+protected:
+  virtual void SetUp() {
+    memset(&bq, 0, sizeof(bq));
+  }
+
+  virtual void TearDown() {
+  }
+
+  // Runs a sine through the filter and returns the output amplitude once settled
+  float SineGain(float freq) {
+    float peak = 0;
+
+    biquad_reset(&bq);
+
+    for (int i = 0; i < 4000; i++) {
+      float out = biquad_apply(&bq, sinf(2 * (float)M_PI * freq * i / SAMPLE_RATE));
+
+      if (i >= 3000 && fabsf(out) > peak)
+        peak = fabsf(out);
+    }
+
+    return peak;
+  }
+
+  struct biquad bq;
+};
+
+TEST_F(Biquad, Passthrough) {
+  biquad_passthrough(&bq);
+
+  EXPECT_EQ(1.5f, biquad_apply(&bq, 1.5f));
+  EXPECT_EQ(-3.0f, biquad_apply(&bq, -3.0f));
+};
+
+TEST_F(Biquad, NotchRemovesCenter) {
+  ASSERT_TRUE(biquad_notch(&bq, 150, 3, SAMPLE_RATE));
+
+  EXPECT_GT(0.01f, SineGain(150));
+};
+
+TEST_F(Biquad, NotchPassesOutsideBand) {
+  ASSERT_TRUE(biquad_notch(&bq, 150, 3, SAMPLE_RATE));
+
+  EXPECT_NEAR(1.0f, SineGain(10), 0.01f);
+  EXPECT_NEAR(1.0f, SineGain(400), 0.05f);
+};
+
+TEST_F(Biquad, NotchBandwidth) {
+  // -3dB at the edges of a band of width center / Q, give or take the
+  // warping from the bilinear transform
+  ASSERT_TRUE(biquad_notch(&bq, 100, 2, SAMPLE_RATE));
+
+  float lower = 100 * (sqrtf(1 + 4 * 2 * 2) - 1) / (2 * 2);
+  EXPECT_NEAR(M_SQRT1_2, SineGain(lower), 0.05f);
+  EXPECT_NEAR(M_SQRT1_2, SineGain(lower + 50), 0.05f);
+};
+
+TEST_F(Biquad, NotchDCGain) {
+  ASSERT_TRUE(biquad_notch(&bq, 200, 5, SAMPLE_RATE));
+
+  float out = 0;
+  for (int i = 0; i < 1000; i++)
+    out = biquad_apply(&bq, 2.0f);
+
+  EXPECT_NEAR(2.0f, out, 1e-4f);
+};
+
+TEST_F(Biquad, NotchAboveNyquist) {
+  EXPECT_FALSE(biquad_notch(&bq, 500, 3, SAMPLE_RATE));
+  EXPECT_FALSE(biquad_notch(&bq, 0, 3, SAMPLE_RATE));
+  EXPECT_FALSE(biquad_notch(&bq, 100, 0, SAMPLE_RATE));
+
+  // Left as a passthrough
+  EXPECT_EQ(0.25f, biquad_apply(&bq, 0.25f));
+};
+
+TEST_F(Biquad, RetuneKeepsState) {
+  ASSERT_TRUE(biquad_notch(&bq, 100, 3, SAMPLE_RATE));
+
+  for (int i = 0; i < 1000; i++)
+    biquad_apply(&bq, 1.0f);
+
+  // Moving the centre must not restart the filter from zero
+  ASSERT_TRUE(biquad_notch(&bq, 110, 3, SAMPLE_RATE));
+  EXPECT_NEAR(1.0f, biquad_apply(&bq, 1.0f), 0.01f);
+};
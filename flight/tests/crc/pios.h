@@ -0,0 +1,13 @@
+/*
+ * Minimal stand-in for flight/PiOS/inc/pios.h, enough to build the CRC
+ * functions on the host.
+ */
+#ifndef PIOS_H
+#define PIOS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <pios_crc.h>
+
+#endif /* PIOS_H */
@@ -0,0 +1,205 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test and microbenchmark for the CRC functions
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* rand */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+
+#include "pios.h"
+
+}
+
+#define BUF_SIZE 1024
+#define BENCH_SIZE (64 * 1024)
+#define BENCH_ROUNDS 200
+
+static const uint8_t check[] = "123456789";
+
+static double now_ns()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* The one-byte-at-a-time table lookups the block functions replace */
+static uint8_t crc8_bytewise(uint8_t crc, const uint8_t *data, int32_t length)
+{
+	while (length--)
+		crc = PIOS_CRC_updateByte(crc, *data++);
+	return crc;
+}
+
+static uint16_t crc16_bytewise(uint16_t crc, const uint8_t *data, int32_t length)
+{
+	while (length--)
+		crc = PIOS_CRC16_updateByte(crc, *data++);
+	return crc;
+}
+
+static uint32_t crc32_bytewise(uint32_t crc, const uint8_t *data, int32_t length)
+{
+	while (length--)
+		crc = PIOS_CRC32_updateByte(crc, *data++);
+	return crc;
+}
+
+class CrcTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    srand(1234);
+    for (int i = 0; i < BUF_SIZE; i++)
+      buf[i] = rand();
+  }
+
+  virtual void TearDown() {
+  }
+
+  uint8_t buf[BUF_SIZE];
+};
+
+TEST_F(CrcTest, KnownCheckValues) {
+  int32_t len = sizeof(check) - 1;
+
+  EXPECT_EQ(0xF4, PIOS_CRC_updateCRC(0, check, len));
+  EXPECT_EQ(0x2189, PIOS_CRC16_updateCRC(0, check, len));
+  EXPECT_EQ(0x89A1897Fu, PIOS_CRC32_updateCRC(0, check, len));
+  EXPECT_EQ(0x0376E6E7u, PIOS_CRC32_updateCRC(0xFFFFFFFF, check, len));
+};
+
+TEST_F(CrcTest, EmptyBlocks) {
+  EXPECT_EQ(0x5A, PIOS_CRC_updateCRC(0x5A, buf, 0));
+  EXPECT_EQ(0x5A5A, PIOS_CRC16_updateCRC(0x5A5A, buf, 0));
+  EXPECT_EQ(0x5A5A5A5Au, PIOS_CRC32_updateCRC(0x5A5A5A5A, buf, 0));
+  EXPECT_EQ(0x5A, PIOS_CRC_updateCRC(0x5A, buf, -1));
+  EXPECT_EQ(0x5A5A, PIOS_CRC16_updateCRC(0x5A5A, buf, -1));
+  EXPECT_EQ(0x5A5A5A5Au, PIOS_CRC32_updateCRC(0x5A5A5A5A, buf, -1));
+};
+
+TEST_F(CrcTest, Crc8BlockMatchesBytewise) {
+  for (int offset = 0; offset < 8; offset++) {
+    for (int len = 0; len < 80; len++) {
+      uint8_t seed = rand();
+      ASSERT_EQ(crc8_bytewise(seed, buf + offset, len),
+          PIOS_CRC_updateCRC(seed, buf + offset, len)) << "offset " << offset << " len " << len;
+    }
+  }
+
+  EXPECT_EQ(crc8_bytewise(0, buf, BUF_SIZE), PIOS_CRC_updateCRC(0, buf, BUF_SIZE));
+};
+
+TEST_F(CrcTest, Crc16BlockMatchesBytewise) {
+  for (int offset = 0; offset < 8; offset++) {
+    for (int len = 0; len < 80; len++) {
+      uint16_t seed = rand();
+      ASSERT_EQ(crc16_bytewise(seed, buf + offset, len),
+          PIOS_CRC16_updateCRC(seed, buf + offset, len)) << "offset " << offset << " len " << len;
+    }
+  }
+
+  EXPECT_EQ(crc16_bytewise(0, buf, BUF_SIZE), PIOS_CRC16_updateCRC(0, buf, BUF_SIZE));
+};
+
+TEST_F(CrcTest, Crc32BlockMatchesBytewise) {
+  for (int offset = 0; offset < 8; offset++) {
+    for (int len = 0; len < 80; len++) {
+      uint32_t seed = rand();
+      ASSERT_EQ(crc32_bytewise(seed, buf + offset, len),
+          PIOS_CRC32_updateCRC(seed, buf + offset, len)) << "offset " << offset << " len " << len;
+    }
+  }
+
+  EXPECT_EQ(crc32_bytewise(0, buf, BUF_SIZE), PIOS_CRC32_updateCRC(0, buf, BUF_SIZE));
+};
+
+TEST_F(CrcTest, SplitBlocksChain) {
+  // Checksumming in pieces must give the same answer as all at once
+  for (int split = 0; split <= 64; split++) {
+    EXPECT_EQ(PIOS_CRC_updateCRC(0, buf, 64),
+        PIOS_CRC_updateCRC(PIOS_CRC_updateCRC(0, buf, split), buf + split, 64 - split));
+    EXPECT_EQ(PIOS_CRC16_updateCRC(0, buf, 64),
+        PIOS_CRC16_updateCRC(PIOS_CRC16_updateCRC(0, buf, split), buf + split, 64 - split));
+    EXPECT_EQ(PIOS_CRC32_updateCRC(0, buf, 64),
+        PIOS_CRC32_updateCRC(PIOS_CRC32_updateCRC(0, buf, split), buf + split, 64 - split));
+  }
+};
+
+TEST_F(CrcTest, Benchmark) {
+  static uint8_t bench[BENCH_SIZE];
+  volatile uint32_t sink = 0;
+  double t0, t1, t2;
+  double mb = (double) BENCH_SIZE * BENCH_ROUNDS / 1e6;
+
+  memset(bench, 0xA5, sizeof(bench));
+
+  t0 = now_ns();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    sink += crc8_bytewise(r, bench, BENCH_SIZE);
+  t1 = now_ns();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    sink += PIOS_CRC_updateCRC(r, bench, BENCH_SIZE);
+  t2 = now_ns();
+  printf("CRC8:  bytewise %.0f MB/s, block %.0f MB/s\n", mb / ((t1 - t0) / 1e9), mb / ((t2 - t1) / 1e9));
+
+  t0 = now_ns();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    sink += crc16_bytewise(r, bench, BENCH_SIZE);
+  t1 = now_ns();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    sink += PIOS_CRC16_updateCRC(r, bench, BENCH_SIZE);
+  t2 = now_ns();
+  printf("CRC16: bytewise %.0f MB/s, block %.0f MB/s\n", mb / ((t1 - t0) / 1e9), mb / ((t2 - t1) / 1e9));
+
+  t0 = now_ns();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    sink += crc32_bytewise(r, bench, BENCH_SIZE);
+  t1 = now_ns();
+  for (int r = 0; r < BENCH_ROUNDS; r++)
+    sink += PIOS_CRC32_updateCRC(r, bench, BENCH_SIZE);
+  t2 = now_ns();
+  printf("CRC32: bytewise %.0f MB/s, block %.0f MB/s\n", mb / ((t1 - t0) / 1e9), mb / ((t2 - t1) / 1e9));
+
+  (void) sink;
+};
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,319 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test and microbenchmark for the INSGPS filter
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* malloc */
+#include <string.h>		/* memcmp */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+
+#include "insgps.h"
+
+}
+
+#define MAX_STATES 16
+#define STEPS 2000
+#define BENCH_ROUNDS 50
+
+static const float Be[3] = { 400, 0, 1600 };
+
+static double now_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Made up but repeatable sensor data for one filter step */
+struct step {
+  float gyro[3], accel[3], mag[3], pos[3], vel[3];
+  uint16_t sensors;
+};
+
+/* Not rand(), so the steps and the reference results are the same on any host */
+static uint32_t step_seed;
+
+static int step_rand()
+{
+  step_seed = step_seed * 1664525u + 1013904223u;
+  return step_seed >> 16;
+}
+
+static void make_steps(struct step *steps, int n, unsigned int seed)
+{
+  step_seed = seed;
+  for (int i = 0; i < n; i++) {
+    for (int k = 0; k < 3; k++) {
+      steps[i].gyro[k] = (step_rand() % 100 - 50) * 1e-3f;
+      steps[i].accel[k] = (step_rand() % 100 - 50) * 1e-2f;
+      steps[i].mag[k] = Be[k] + step_rand() % 20;
+      steps[i].pos[k] = step_rand() % 10;
+      steps[i].vel[k] = step_rand() % 3;
+    }
+    steps[i].accel[2] -= 9.81f;
+    steps[i].sensors = (i % 50 == 0) ? FULL_SENSORS :
+        (i % 10 == 0) ? (MAG_SENSORS | BARO_SENSOR) : 0;
+  }
+}
+
+struct result {
+  float pos[3], vel[3], q[4], gyro_bias[3], accel_bias[3];
+  float var[MAX_STATES];
+};
+
+static void run_step(struct insgps_ctx *ctx, const struct step *s)
+{
+  insgps_state_prediction(ctx, s->gyro, s->accel, 0.002f);
+  insgps_covariance_prediction(ctx, 0.002f);
+  if (s->sensors)
+    insgps_correction(ctx, s->mag, s->pos, s->vel, s->pos[2], s->sensors);
+}
+
+static void get_result(struct insgps_ctx *ctx, struct result *r)
+{
+  memset(r, 0, sizeof(*r));
+  insgps_get_state(ctx, r->pos, r->vel, r->q, r->gyro_bias, r->accel_bias);
+  insgps_get_variance(ctx, r->var);
+}
+
+/*
+ * Bit patterns of the result after STEPS of make_steps(seed 1), from the
+ * filters as they were before the covariance was packed.  Any change to
+ * the filter arithmetic shows up here.
+ */
+static const uint32_t reference13[] = {
+    0x3fddeaa0, 0x40b6a5a6, 0x404beab7, 0xc09c1c99, 0x402cd834, 0x40056167,
+    0xbf739f86, 0xbda0ae8a, 0x3aa34b9d, 0xbe980e55, 0x3ea1efe4, 0x3c1478b7,
+    0x3f9fa45e, 0x00000000, 0x00000000, 0x00000000, 0x3992b7bd, 0x3992b750,
+    0x3a5f5e41, 0x3834218a, 0x383403eb, 0x38a73404, 0x305222b8, 0x301b06a5,
+    0x2f91ce96, 0x31acf06b, 0x32055662, 0x32026fe0, 0x322f6d64, 0x00000000,
+    0x00000000, 0x00000000
+};
+
+static const uint32_t reference14[] = {
+    0x40c232d0, 0xc094753d, 0x41f22c36, 0xc12de570, 0xc0ea6847, 0x420a9ecd,
+    0x3f25909a, 0x3e356333, 0x3f3d0774, 0x3d92a138, 0xbd460d51, 0x3d3c22a2,
+    0xbe1681c4, 0x00000000, 0x00000000, 0xbdc70a69, 0x399beb4d, 0x39937fac,
+    0x39e5a8f4, 0x38b429c1, 0x3853ce06, 0x387d589d, 0x318c45b8, 0x3254197a,
+    0x3181b81c, 0x32b684dc, 0x32fa0cbe, 0x32467d29, 0x326438cc, 0x374eef10,
+    0x00000000, 0x00000000
+};
+
+static const uint32_t reference16[] = {
+    0x410207cb, 0xc155c77b, 0x41917d97, 0xc0394fc8, 0xc17833d3, 0x41d9e267,
+    0x3e31d538, 0x3f4f747b, 0x3d0e05e0, 0x3f0efab7, 0x4048bc68, 0x3e0a8d0b,
+    0x3fac66d9, 0xbdcdf16b, 0xbf22b29d, 0x3f080dda, 0x399acf74, 0x399438cb,
+    0x3a500314, 0x389a75b4, 0x38386a15, 0x391a6bbf, 0x312bddff, 0x30f810bb,
+    0x30ab67b9, 0x30f3cc44, 0x329679ee, 0x329574e5, 0x326cd841, 0x37600650,
+    0x37578d44, 0x37625736
+};
+
+class InsgpsCtx : public testing::Test {
+protected:
+  virtual void SetUp() {
+    ASSERT_LE(ins_get_num_states(), MAX_STATES);
+    a = (struct insgps_ctx *) malloc(insgps_ctx_size());
+    b = (struct insgps_ctx *) malloc(insgps_ctx_size());
+    ASSERT_TRUE(a && b);
+    insgps_init(a);
+    insgps_set_mag_north(a, Be);
+    insgps_init(b);
+    insgps_set_mag_north(b, Be);
+  }
+
+  virtual void TearDown() {
+    free(a);
+    free(b);
+  }
+
+  struct insgps_ctx *a;
+  struct insgps_ctx *b;
+  struct step steps[STEPS];
+};
+
+TEST_F(InsgpsCtx, MatchesSingleFilterCalls) {
+  make_steps(steps, STEPS, 1);
+
+  INSGPSInit();
+  INSSetMagNorth(Be);
+  for (int i = 0; i < STEPS; i++) {
+    const struct step *s = &steps[i];
+    INSStatePrediction(s->gyro, s->accel, 0.002f);
+    INSCovariancePrediction(0.002f);
+    if (s->sensors)
+      INSCorrection(s->mag, s->pos, s->vel, s->pos[2], s->sensors);
+  }
+
+  for (int i = 0; i < STEPS; i++)
+    run_step(a, &steps[i]);
+
+  struct result expected, actual;
+  memset(&expected, 0, sizeof(expected));
+  INSGetState(expected.pos, expected.vel, expected.q, expected.gyro_bias, expected.accel_bias);
+  INSGetVariance(expected.var);
+  get_result(a, &actual);
+
+  EXPECT_EQ(0, memcmp(&expected, &actual, sizeof(expected)));
+};
+
+TEST_F(InsgpsCtx, MatchesReference) {
+  const uint32_t *reference;
+  switch (ins_get_num_states()) {
+  case 13:
+    reference = reference13;
+    break;
+  case 14:
+    reference = reference14;
+    break;
+  case 16:
+    reference = reference16;
+    break;
+  default:
+    FAIL() << "no reference for " << ins_get_num_states() << " states";
+  }
+
+  make_steps(steps, STEPS, 1);
+  for (int i = 0; i < STEPS; i++)
+    run_step(a, &steps[i]);
+
+  struct result actual;
+  get_result(a, &actual);
+
+  uint32_t bits[sizeof(actual) / sizeof(uint32_t)];
+  memcpy(bits, &actual, sizeof(actual));
+  for (unsigned int i = 0; i < sizeof(bits) / sizeof(bits[0]); i++)
+    EXPECT_EQ(reference[i], bits[i]) << "word " << i;
+};
+
+TEST_F(InsgpsCtx, FiltersAreIndependent) {
+  static struct step other[STEPS];
+  make_steps(steps, STEPS, 1);
+  make_steps(other, STEPS, 2);
+
+  // Interleaved runs must give what each filter gives on its own
+  for (int i = 0; i < STEPS; i++) {
+    run_step(a, &steps[i]);
+    run_step(b, &other[i]);
+  }
+
+  struct result ra, rb, alone;
+  get_result(a, &ra);
+  get_result(b, &rb);
+
+  insgps_init(a);
+  insgps_set_mag_north(a, Be);
+  for (int i = 0; i < STEPS; i++)
+    run_step(a, &steps[i]);
+  get_result(a, &alone);
+
+  EXPECT_EQ(0, memcmp(&alone, &ra, sizeof(alone)));
+  EXPECT_NE(0, memcmp(&ra, &rb, sizeof(ra)));
+};
+
+TEST_F(InsgpsCtx, GroupCorrectionsMatchMasks) {
+  const uint16_t groups[] = { POS_SENSORS, HORIZ_POS_SENSORS, HORIZ_VEL_SENSORS | VERT_VEL_SENSORS,
+      VERT_VEL_SENSORS, MAG_SENSORS, BARO_SENSOR };
+  make_steps(steps, STEPS, 3);
+
+  // A group correction must do exactly what the masked full correction does
+  for (int i = 0; i < STEPS; i++) {
+    const struct step *s = &steps[i];
+    uint16_t group = groups[i % (sizeof(groups) / sizeof(groups[0]))];
+
+    insgps_state_prediction(a, s->gyro, s->accel, 0.002f);
+    insgps_covariance_prediction(a, 0.002f);
+    insgps_correction(a, s->mag, s->pos, s->vel, s->pos[2], group);
+
+    insgps_state_prediction(b, s->gyro, s->accel, 0.002f);
+    insgps_covariance_prediction(b, 0.002f);
+    if (group & POS_SENSORS)
+      insgps_pos_correction(b, s->pos, group);
+    else if (group & (HORIZ_VEL_SENSORS | VERT_VEL_SENSORS))
+      insgps_vel_correction(b, s->vel, group);
+    else if (group & MAG_SENSORS)
+      insgps_mag_correction(b, s->mag);
+    else
+      insgps_baro_correction(b, s->pos[2]);
+  }
+
+  struct result ra, rb;
+  get_result(a, &ra);
+  get_result(b, &rb);
+
+  EXPECT_EQ(0, memcmp(&ra, &rb, sizeof(ra)));
+};
+
+TEST_F(InsgpsCtx, Benchmark) {
+  double t_state = 0, t_cov = 0, t_corr = 0, t_baro = 0, t0, t1, t2, t3;
+  int corrections = 0;
+
+  make_steps(steps, STEPS, 1);
+
+  for (int r = 0; r < BENCH_ROUNDS; r++) {
+    insgps_init(a);
+    insgps_set_mag_north(a, Be);
+    for (int i = 0; i < STEPS; i++) {
+      const struct step *s = &steps[i];
+      t0 = now_ns();
+      insgps_state_prediction(a, s->gyro, s->accel, 0.002f);
+      t1 = now_ns();
+      insgps_covariance_prediction(a, 0.002f);
+      t2 = now_ns();
+      if (s->sensors) {
+        insgps_correction(a, s->mag, s->pos, s->vel, s->pos[2], FULL_SENSORS);
+        t3 = now_ns();
+        insgps_baro_correction(a, s->pos[2]);
+        t_corr += t3 - t2;
+        t_baro += now_ns() - t3;
+        corrections++;
+      }
+      t_state += t1 - t0;
+      t_cov += t2 - t1;
+    }
+  }
+
+  printf("%d states: state prediction %.0f ns, covariance prediction %.0f ns\n",
+      ins_get_num_states(), t_state / (STEPS * BENCH_ROUNDS), t_cov / (STEPS * BENCH_ROUNDS));
+  printf("%d states: full correction %.0f ns, baro correction %.0f ns\n",
+      ins_get_num_states(), t_corr / corrections, t_baro / corrections);
+};
+
+/**
+ * @}
+ * @}
+ */
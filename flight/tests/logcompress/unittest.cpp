@@ -0,0 +1,333 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test and benchmark for log delta coding and compression
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* rand */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <math.h>		/* sinf */
+#include <time.h>		/* clock_gettime */
+
+extern "C" {
+
+#include "logcompress.h"
+
+}
+
+#define BLOCK_SIZE 256
+#define MAX_LEN 1024
+#define BENCH_RECORDS 20000
+
+static double now_ns()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+class LogCompress : public testing::Test {
+protected:
+  virtual void SetUp() {
+    srand(1234);
+  }
+
+  virtual void TearDown() {
+  }
+
+  // Compresses and decompresses, checking the data comes back
+  void RoundTrip(const uint8_t *data, uint16_t len) {
+    int32_t packed_len = logcompress_block(data, len, packed, sizeof(packed), hash);
+    ASSERT_GE(packed_len, 0) << "len " << len;
+    ASSERT_LE(packed_len, (int32_t) LOGCOMPRESS_BOUND(len)) << "len " << len;
+
+    memset(unpacked, 0xee, sizeof(unpacked));
+    ASSERT_EQ(len, logcompress_unblock(packed, packed_len, unpacked, len)) << "len " << len;
+    ASSERT_EQ(0, memcmp(data, unpacked, len)) << "len " << len;
+  }
+
+  uint16_t hash[LOGCOMPRESS_HASH_ENTRIES];
+  uint8_t packed[LOGCOMPRESS_BOUND(MAX_LEN)];
+  uint8_t unpacked[MAX_LEN];
+};
+
+TEST_F(LogCompress, DeltaRoundTrip) {
+  uint8_t prev_in[40], prev_out[40], sample[40];
+  uint8_t coded[40 + 5];
+
+  memset(prev_in, 0, sizeof(prev_in));
+  memset(prev_out, 0, sizeof(prev_out));
+
+  for (int i = 0; i < 100; i++) {
+    // Change a few bytes of each sample
+    for (int j = 0; j < 5; j++)
+      sample[rand() % sizeof(sample)] = rand();
+
+    uint16_t len = logcompress_delta(sample, prev_in, sizeof(sample), coded);
+    ASSERT_LE(len, sizeof(coded));
+    ASSERT_EQ(0, memcmp(sample, prev_in, sizeof(sample)));
+
+    ASSERT_EQ(len, logcompress_undelta(coded, len, prev_out, sizeof(sample)));
+    ASSERT_EQ(0, memcmp(sample, prev_out, sizeof(sample)));
+  }
+
+  // An unchanged sample is only the mask
+  EXPECT_EQ(5, logcompress_delta(sample, prev_in, sizeof(sample), coded));
+};
+
+TEST_F(LogCompress, DeltaTruncated) {
+  uint8_t prev[16], sample[16];
+  uint8_t coded[16 + 2];
+
+  memset(prev, 0, sizeof(prev));
+  memset(sample, 0x5a, sizeof(sample));
+
+  uint16_t len = logcompress_delta(sample, prev, sizeof(sample), coded);
+  ASSERT_EQ(18, len);
+
+  memset(prev, 0, sizeof(prev));
+  EXPECT_EQ(-1, logcompress_undelta(coded, 1, prev, sizeof(sample)));
+  EXPECT_EQ(-1, logcompress_undelta(coded, len - 1, prev, sizeof(sample)));
+};
+
+TEST_F(LogCompress, ShortBlocks) {
+  uint8_t data[16];
+
+  // Too short for any match; stored as literals
+  memset(data, 0, sizeof(data));
+  for (uint16_t len = 0; len <= sizeof(data); len++) {
+    RoundTrip(data, len);
+  }
+
+  EXPECT_EQ(1, logcompress_block(data, 0, packed, sizeof(packed), hash));
+};
+
+TEST_F(LogCompress, RandomBlocks) {
+  uint8_t data[MAX_LEN];
+
+  for (int i = 0; i < 500; i++) {
+    uint16_t len = rand() % sizeof(data);
+
+    for (uint16_t j = 0; j < len; j++)
+      data[j] = rand();
+
+    RoundTrip(data, len);
+  }
+};
+
+TEST_F(LogCompress, RepetitiveBlocks) {
+  uint8_t data[MAX_LEN];
+
+  for (int i = 0; i < 500; i++) {
+    uint16_t len = rand() % sizeof(data);
+    int alphabet = 1 + rand() % 4;
+
+    for (uint16_t j = 0; j < len; j++)
+      data[j] = rand() % alphabet;
+
+    RoundTrip(data, len);
+  }
+
+  // Long runs need the extra length bytes
+  memset(data, 0, sizeof(data));
+  RoundTrip(data, sizeof(data));
+  EXPECT_LT(logcompress_block(data, sizeof(data), packed, sizeof(packed), hash), 20);
+};
+
+TEST_F(LogCompress, OutputTooSmall) {
+  uint8_t data[BLOCK_SIZE];
+
+  for (int i = 0; i < BLOCK_SIZE; i++)
+    data[i] = rand();
+
+  // Incompressible data gets a little longer, so does not fit its own size
+  EXPECT_EQ(-1, logcompress_block(data, sizeof(data), packed, sizeof(data), hash));
+  EXPECT_EQ(-1, logcompress_block(data, sizeof(data), packed, 0, hash));
+};
+
+TEST_F(LogCompress, CorruptBlocks) {
+  // Match before the start of the output
+  const uint8_t bad_offset[] = { 0x10, 'a', 0x02, 0x00, 0x00 };
+  EXPECT_EQ(-1, logcompress_unblock(bad_offset, sizeof(bad_offset), unpacked, sizeof(unpacked)));
+
+  // Zero offset
+  const uint8_t zero_offset[] = { 0x10, 'a', 0x00, 0x00, 0x00 };
+  EXPECT_EQ(-1, logcompress_unblock(zero_offset, sizeof(zero_offset), unpacked, sizeof(unpacked)));
+
+  // Literals running past the end of the input
+  const uint8_t long_literals[] = { 0x50, 'a', 'b' };
+  EXPECT_EQ(-1, logcompress_unblock(long_literals, sizeof(long_literals), unpacked, sizeof(unpacked)));
+
+  // Offset cut off
+  const uint8_t short_offset[] = { 0x10, 'a', 0x01 };
+  EXPECT_EQ(-1, logcompress_unblock(short_offset, sizeof(short_offset), unpacked, sizeof(unpacked)));
+
+  // More output than there is room for
+  const uint8_t long_match[] = { 0x1f, 'a', 0x01, 0x00, 0xff, 0xff, 0x00, 0x00 };
+  EXPECT_EQ(-1, logcompress_unblock(long_match, sizeof(long_match), unpacked, 64));
+
+  // Garbage never writes past the output
+  uint8_t garbage[64];
+  for (int i = 0; i < 2000; i++) {
+    for (unsigned j = 0; j < sizeof(garbage); j++)
+      garbage[j] = rand();
+
+    memset(unpacked, 0xee, sizeof(unpacked));
+    int32_t len = logcompress_unblock(garbage, sizeof(garbage), unpacked, 100);
+    ASSERT_LE(len, 100);
+    ASSERT_EQ(0xee, unpacked[100]);
+  }
+};
+
+/*
+ * Log shaped data: samples of objects at their rates, each record a header
+ * of index and time delta, delta coded and gathered into blocks the way
+ * the Logging module does it.
+ */
+struct bench_obj {
+  const char *name;
+  uint16_t size;
+  int every;		// ticks between samples
+  int floats;		// leading floats; the rest are small counters/flags
+  float noise;
+  uint8_t prev[64];
+  uint64_t raw, coded;
+};
+
+static void fill_sample(struct bench_obj *o, int tick, uint8_t *out)
+{
+  int i;
+
+  for (i = 0; i < o->floats; i++) {
+    float v = 10 * sinf(tick * 0.001f * (i + 1)) +
+        o->noise * ((rand() % 2001) - 1000) / 1000.0f;
+    memcpy(out + 4 * i, &v, 4);
+  }
+
+  for (i *= 4; i < o->size; i++) {
+    out[i] = (tick / 5000 + i) & 3;
+  }
+}
+
+TEST_F(LogCompress, Benchmark) {
+  struct bench_obj objs[] = {
+    { "Gyros", 16, 1, 4, 0.5f },
+    { "Accels", 16, 1, 4, 0.05f },
+    { "AttitudeActual", 28, 5, 7, 0.01f },
+    { "ActuatorCommand", 28, 5, 0, 0 },
+    { "FlightStatus", 8, 1, 0, 0 },
+  };
+  const int num_objs = sizeof(objs) / sizeof(objs[0]);
+
+  uint8_t block[BLOCK_SIZE];
+  uint8_t sample[64];
+  uint16_t fill = 0;
+  uint64_t raw = 0, out = 0;
+  int records = 0;
+  double ns = 0;
+
+  for (int i = 0; i < num_objs; i++) {
+    memset(objs[i].prev, 0, sizeof(objs[i].prev));
+    objs[i].raw = objs[i].coded = 0;
+  }
+
+  for (int tick = 0; records < BENCH_RECORDS; tick++) {
+    for (int i = 0; i < num_objs; i++) {
+      struct bench_obj *o = &objs[i];
+
+      if (tick % o->every)
+        continue;
+
+      fill_sample(o, tick, sample);
+
+      double t0 = now_ns();
+
+      uint16_t worst = 2 + o->size + (o->size + 7) / 8;
+      if (fill + worst > BLOCK_SIZE) {
+        int32_t len = logcompress_block(block, fill, packed, sizeof(packed), hash);
+        ASSERT_GE(len, 0);
+        out += 4 + (len < fill ? len : fill);
+        fill = 0;
+      }
+
+      block[fill++] = i;
+      block[fill++] = o->every;
+      fill += logcompress_delta(sample, o->prev, o->size, block + fill);
+
+      ns += now_ns() - t0;
+
+      raw += 2 + o->size;
+      records++;
+    }
+  }
+
+  printf("%d records: %llu bytes compact, %llu compressed, ratio %.2f, %.0f ns/record\n",
+      records, (unsigned long long) raw, (unsigned long long) out,
+      (double) raw / out, ns / records);
+
+  // Each object on its own, to see what suits which
+  for (int i = 0; i < num_objs; i++) {
+    struct bench_obj *o = &objs[i];
+    uint8_t prev[64];
+
+    memset(prev, 0, sizeof(prev));
+    fill = 0;
+    raw = out = 0;
+
+    for (int n = 0; n < 2000; n++) {
+      fill_sample(o, n * o->every, sample);
+
+      if (fill + 2 + o->size + (o->size + 7) / 8 > BLOCK_SIZE) {
+        int32_t len = logcompress_block(block, fill, packed, sizeof(packed), hash);
+        out += 4 + (len < fill ? len : fill);
+        fill = 0;
+      }
+
+      block[fill++] = i;
+      block[fill++] = o->every;
+      fill += logcompress_delta(sample, prev, o->size, block + fill);
+      raw += 2 + o->size;
+    }
+
+    printf("  %-16s ratio %.2f\n", o->name, (double) raw / out);
+  }
+
+  EXPECT_GT(records, 0);
+};
+
+/**
+ * @}
+ * @}
+ */
@@ -17,6 +17,7 @@ struct flash_posix_dev {
 	const struct pios_flash_posix_cfg * cfg;
 	bool transaction_in_progress;
 	FILE * flash_file;
+	struct pios_flash_posix_stats stats;
 };
 
 static struct flash_posix_dev * PIOS_Flash_Posix_Alloc(void)
@@ -42,6 +43,7 @@ int32_t PIOS_Flash_Posix_Init(uintptr_t * chip_id, const struct pios_flash_posix
 
 	flash_dev->cfg = cfg;
 	flash_dev->transaction_in_progress = false;
+	memset(&flash_dev->stats, 0, sizeof(flash_dev->stats));
 
 	flash_dev->flash_file = fopen ("theflash.bin", "r+");
 	if (flash_dev->flash_file == NULL) {
@@ -66,6 +68,13 @@ void PIOS_Flash_Posix_Destroy(uintptr_t chip_id)
 	PIOS_free(flash_dev);
 }
 
+void PIOS_Flash_Posix_GetStats(uintptr_t chip_id, struct pios_flash_posix_stats * stats)
+{
+	struct flash_posix_dev * flash_dev = (struct flash_posix_dev *)chip_id;
+
+	*stats = flash_dev->stats;
+}
+
 /**********************************
  *
  * Provide a PIOS flash driver API
@@ -114,6 +123,8 @@ static int32_t PIOS_Flash_Posix_EraseSector(uintptr_t chip_id, uint32_t chip_sec
 
 	assert (s == flash_dev->cfg->size_of_sector);
 
+	flash_dev->stats.erases++;
+
 	return 0;
 }
 
@@ -135,6 +146,9 @@ static int32_t PIOS_Flash_Posix_WriteData(uintptr_t chip_id, uint32_t chip_offse
 
 	assert (s == len);
 
+	flash_dev->stats.writes++;
+	flash_dev->stats.write_bytes += len;
+
 	return 0;
 }
 
@@ -156,6 +170,9 @@ static int32_t PIOS_Flash_Posix_ReadData(uintptr_t chip_id, uint32_t chip_offset
 
 	assert (s == len);
 
+	flash_dev->stats.reads++;
+	flash_dev->stats.read_bytes += len;
+
 	return 0;
 }
 
@@ -37,6 +37,9 @@
 #include <stdlib.h>		/* abort */
 #include <string.h>		/* memset */
 #include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+
+#include <algorithm>		/* std::max */
 
 extern "C" {
 
@@ -333,6 +336,186 @@ TEST_F(LogfsTestCooked, WriteManyVerify) {
   EXPECT_EQ(0, memcmp(obj3, obj3_check, sizeof(obj3)));
 }
 
+TEST_F(LogfsTestCooked, DeleteEveryOtherVerify) {
+  /* Enough instances to share probe runs in the slot index */
+  for (uint16_t i = 0; i < 200; i++) {
+    obj1[0] = i;
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, i, obj1, sizeof(obj1)));
+  }
+
+  for (uint16_t i = 0; i < 200; i += 2) {
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjDelete(fs_id, OBJ1_ID, i));
+  }
+
+  /* Garbage collect so the survivors move to new slots */
+  for (uint16_t i = 0; i < 100; i++) {
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ2_ID, 0, obj2, sizeof(obj2)));
+  }
+
+  unsigned char obj1_check[OBJ1_SIZE];
+  for (uint16_t i = 0; i < 200; i++) {
+    memset(obj1_check, 0, sizeof(obj1_check));
+    if (i % 2) {
+      EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, i, obj1_check, sizeof(obj1_check)));
+      EXPECT_EQ(i & 0xFF, obj1_check[0]);
+      EXPECT_EQ(0, memcmp(obj1 + 1, obj1_check + 1, sizeof(obj1) - 1));
+    } else {
+      EXPECT_EQ(-3, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, i, obj1_check, sizeof(obj1_check)));
+    }
+  }
+}
+
+static double elapsed_us(const struct timespec *start)
+{
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  return (now.tv_sec - start->tv_sec) * 1e6 + (now.tv_nsec - start->tv_nsec) / 1e3;
+}
+
+TEST_F(LogfsTestCooked, BootAndSaveBenchmark) {
+  /* Populate the settings partition the way a configured board would */
+  const uint16_t num_objs = 150;
+  for (uint16_t i = 0; i < num_objs; i++) {
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, i, obj1, sizeof(obj1)));
+  }
+
+  /* Reboot: mount the filesystem and load every object */
+  PIOS_FLASHFS_Logfs_Destroy(fs_id);
+  PIOS_Flash_Posix_Destroy(pios_posix_flash_id);
+
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  EXPECT_EQ(0, PIOS_Flash_Posix_Init(&pios_posix_flash_id, &flash_config));
+  EXPECT_EQ(0, PIOS_FLASHFS_Logfs_Init(&fs_id, &flashfs_config_settings, FLASH_PARTITION_LABEL_SETTINGS));
+
+  unsigned char obj1_check[OBJ1_SIZE];
+  for (uint16_t i = 0; i < num_objs; i++) {
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, i, obj1_check, sizeof(obj1_check)));
+  }
+
+  double boot_us = elapsed_us(&start);
+
+  struct pios_flash_posix_stats boot;
+  PIOS_Flash_Posix_GetStats(pios_posix_flash_id, &boot);
+
+  /* The mount scans each slot header once, then each load is a header and a data read */
+  uint32_t num_slots = flashfs_config_settings.arena_size / flashfs_config_settings.slot_size;
+  EXPECT_GE(num_slots + 2 * num_objs + 2, boot.reads);
+
+  /* Save each object again, as a settings change would */
+  clock_gettime(CLOCK_MONOTONIC, &start);
+
+  for (uint16_t i = 0; i < num_objs; i++) {
+    EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, i, obj1_alt, sizeof(obj1_alt)));
+  }
+
+  double save_us = elapsed_us(&start);
+
+  struct pios_flash_posix_stats save;
+  PIOS_Flash_Posix_GetStats(pios_posix_flash_id, &save);
+
+  printf("boot: %u objects in %.0f us, %u reads (%u bytes)\n",
+    num_objs, boot_us, boot.reads, boot.read_bytes);
+  printf("save: %.1f us, %.1f reads, %.1f writes per object (includes garbage collection)\n",
+    save_us / num_objs, (double)(save.reads - boot.reads) / num_objs,
+    (double)(save.writes - boot.writes) / num_objs);
+}
+
+class LogfsTestIncremental : public LogfsTestCooked {
+protected:
+  /*
+   * Random saves and deletes of a set of instances, checked against a copy
+   * kept in RAM.  Returns the most flash operations any one save needed.
+   */
+  void Churn(uint32_t ops, bool maintain, struct pios_flash_posix_stats *worst) {
+    memset(worst, 0, sizeof(*worst));
+
+    for (uint32_t op = 0; op < ops; op++) {
+      uint16_t inst = rand() % NUM_INSTANCES;
+
+      if (rand() % 8 == 0) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjDelete(fs_id, OBJ1_ID, inst));
+        present[inst] = false;
+      } else {
+        memset(contents[inst], op & 0xFF, OBJ1_SIZE);
+
+        struct pios_flash_posix_stats before, after;
+        PIOS_Flash_Posix_GetStats(pios_posix_flash_id, &before);
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjSave(fs_id, OBJ1_ID, inst, contents[inst], OBJ1_SIZE));
+        PIOS_Flash_Posix_GetStats(pios_posix_flash_id, &after);
+        present[inst] = true;
+
+        worst->reads  = std::max(worst->reads, after.reads - before.reads);
+        worst->writes = std::max(worst->writes, after.writes - before.writes);
+        worst->erases = std::max(worst->erases, after.erases - before.erases);
+      }
+
+      if (maintain) {
+        EXPECT_EQ(0, PIOS_FLASHFS_Maintenance(fs_id));
+      }
+    }
+  }
+
+  void Verify() {
+    unsigned char check[OBJ1_SIZE];
+
+    for (uint16_t inst = 0; inst < NUM_INSTANCES; inst++) {
+      if (present[inst]) {
+        EXPECT_EQ(0, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, inst, check, sizeof(check)));
+        EXPECT_EQ(0, memcmp(contents[inst], check, sizeof(check)));
+      } else {
+        EXPECT_EQ(-3, PIOS_FLASHFS_ObjLoad(fs_id, OBJ1_ID, inst, check, sizeof(check)));
+      }
+    }
+  }
+
+  void Reboot() {
+    PIOS_FLASHFS_Logfs_Destroy(fs_id);
+    PIOS_Flash_Posix_Destroy(pios_posix_flash_id);
+
+    EXPECT_EQ(0, PIOS_Flash_Posix_Init(&pios_posix_flash_id, &flash_config));
+    EXPECT_EQ(0, PIOS_FLASHFS_Logfs_Init(&fs_id, &flashfs_config_settings, FLASH_PARTITION_LABEL_SETTINGS));
+  }
+
+  static const uint16_t NUM_INSTANCES = 120;
+
+  unsigned char contents[NUM_INSTANCES][OBJ1_SIZE];
+  bool present[NUM_INSTANCES] = { };
+};
+
+TEST_F(LogfsTestIncremental, ChurnWithMaintenance) {
+  struct pios_flash_posix_stats worst;
+
+  srand(1);
+  Churn(5000, true, &worst);
+  Verify();
+
+  /* Saves never wait for an erase once the spare arena is kept ready */
+  EXPECT_EQ(0U, worst.erases);
+
+  Reboot();
+  Verify();
+
+  printf("incremental gc: worst save %u reads, %u writes, %u erases\n",
+    worst.reads, worst.writes, worst.erases);
+}
+
+TEST_F(LogfsTestIncremental, ChurnWithoutMaintenance) {
+  struct pios_flash_posix_stats worst;
+
+  srand(1);
+  Churn(5000, false, &worst);
+  Verify();
+
+  Reboot();
+  Verify();
+
+  printf("blocking gc: worst save %u reads, %u writes, %u erases\n",
+    worst.reads, worst.writes, worst.erases);
+}
+
 class LogfsTestCookedMultiPart : public LogfsTestRaw {
 protected:
   virtual void SetUp() {
@@ -11,6 +11,8 @@ const struct flashfs_logfs_cfg flashfs_config_settings = {
 	.fs_magic      = 0x89abceef,
 	.arena_size    = 0x00010000, /* 256 * slot size */
 	.slot_size     = 0x00000100, /* 256 bytes */
+	.use_index     = true,
+	.use_copy_buf  = true,
 };
 
 const struct flashfs_logfs_cfg flashfs_config_waypoints = {
@@ -0,0 +1,3 @@
+#include <stdlib.h>
+#define pvPortMalloc(xSize) (malloc(xSize))
+#define vPortFree(pv) (free(pv))
@@ -0,0 +1,2 @@
+#define PIOS_INCLUDE_FLASH
+#define PIOS_INCLUDE_FREERTOS
@@ -0,0 +1,21 @@
+#include <stdint.h>
+
+struct pios_flash_posix_cfg {
+	uint32_t size_of_flash;
+	uint32_t size_of_sector;
+};
+
+/* Count of driver calls, to benchmark the filesystems against */
+struct pios_flash_posix_stats {
+	uint32_t reads;
+	uint32_t read_bytes;
+	uint32_t writes;
+	uint32_t write_bytes;
+	uint32_t erases;
+};
+
+int32_t PIOS_Flash_Posix_Init(uintptr_t * chip_id, const struct pios_flash_posix_cfg * cfg);
+void PIOS_Flash_Posix_Destroy(uintptr_t chip_id);
+void PIOS_Flash_Posix_GetStats(uintptr_t chip_id, struct pios_flash_posix_stats * stats);
+
+extern const struct pios_flash_driver pios_posix_flash_driver;
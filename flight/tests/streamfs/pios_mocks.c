@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ * @file       pios_mocks.c
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Host stand-ins for the PiOS services used by streamfs
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "pios.h"
+#include "pios_mutex.h"
+#include "pios_semaphore.h"
+#include "pios_thread.h"
+
+static int mock_mutex;
+
+struct pios_mutex *PIOS_Mutex_Create(void)
+{
+	return (struct pios_mutex *) &mock_mutex;
+}
+
+bool PIOS_Mutex_Lock(struct pios_mutex *mtx, uint32_t timeout_ms)
+{
+	return true;
+}
+
+bool PIOS_Mutex_Unlock(struct pios_mutex *mtx)
+{
+	return true;
+}
+
+static int mock_semaphore;
+
+struct pios_semaphore *PIOS_Semaphore_Create(void)
+{
+	return (struct pios_semaphore *) &mock_semaphore;
+}
+
+bool PIOS_Semaphore_Take(struct pios_semaphore *sema, uint32_t timeout_ms)
+{
+	return false;
+}
+
+bool PIOS_Semaphore_Give(struct pios_semaphore *sema)
+{
+	return true;
+}
+
+static int mock_thread;
+
+/* The task is never run, so the COM buffer is only drained by the API */
+struct pios_thread *PIOS_Thread_Create(void (*fp)(void *), const char *namep,
+		size_t stack_bytes, void *argp, enum pios_thread_prio_e prio)
+{
+	return (struct pios_thread *) &mock_thread;
+}
+
+void PIOS_Thread_Sleep(uint32_t time_ms)
+{
+}
+
+uint32_t PIOS_DELAY_GetRaw()
+{
+	return 0;
+}
+
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
+{
+	return 0;
+}
+
+/* Without PIOS_COM in between, the driver context is the handle itself */
+uintptr_t PIOS_COM_GetDriverCtx(uintptr_t com_id)
+{
+	return com_id;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,21 @@
+/*
+ * Stand-in for flight/PiOS/inc/pios_thread.h, which needs an RTOS.
+ * The streamfs task is created but never run, tests call the API directly.
+ */
+#ifndef PIOS_THREAD_H_
+#define PIOS_THREAD_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+enum pios_thread_prio_e {
+	PIOS_THREAD_PRIO_LOW = 1,
+};
+
+struct pios_thread;
+
+struct pios_thread *PIOS_Thread_Create(void (*fp)(void *), const char *namep,
+		size_t stack_bytes, void *argp, enum pios_thread_prio_e prio);
+void PIOS_Thread_Sleep(uint32_t time_ms);
+
+#endif /* PIOS_THREAD_H_ */
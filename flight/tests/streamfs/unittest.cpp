@@ -0,0 +1,232 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test for the streamfs page cache
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* fopen */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <unistd.h>		/* unlink */
+
+#include <algorithm>		/* std::min */
+
+extern "C" {
+
+#include "pios_flash.h"		/* PIOS_FLASH_* API */
+
+#include "pios_flash_priv.h"	/* struct pios_flash_partition */
+
+extern const struct pios_flash_partition pios_flash_partition_table[];
+extern uint32_t pios_flash_partition_table_size;
+
+#include "pios_flash_posix_priv.h"
+
+extern uintptr_t pios_posix_flash_id;
+extern struct pios_flash_posix_cfg flash_config;
+
+#include "pios_com.h"		/* struct pios_com_driver */
+#include "pios_streamfs.h"	/* PIOS_STREAMFS_* */
+#include "pios_streamfs_priv.h"
+
+extern struct streamfs_cfg streamfs_config;
+
+int32_t PIOS_STREAMFS_Testing_Write(uintptr_t fs_id, uint8_t *data, uint32_t len);
+
+}
+
+#define PAGE_SIZE 256
+#define FOOTER_SIZE 14
+#define ARENA_DATA_SIZE (0x10000 - FOOTER_SIZE)
+
+/* Data the logger has queued in PIOS_COM, handed out like its tx callback */
+static uint8_t com_data[1000];
+static uint16_t com_pending;
+
+static uint16_t com_tx_out(uintptr_t, uint8_t *buf, uint16_t buf_len,
+    uint16_t *, bool *)
+{
+  uint16_t len = std::min(buf_len, com_pending);
+
+  memcpy(buf, &com_data[sizeof(com_data) - com_pending], len);
+  com_pending -= len;
+
+  return len;
+}
+
+class StreamfsTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    /* create an empty, appropriately sized flash */
+    FILE * theflash = fopen("theflash.bin", "w");
+    uint8_t sector[flash_config.size_of_sector];
+    memset(sector, 0xFF, sizeof(sector));
+    for (uint32_t i = 0; i < flash_config.size_of_flash / flash_config.size_of_sector; i++) {
+      fwrite(sector, sizeof(sector), 1, theflash);
+    }
+    fclose(theflash);
+
+    for (uint32_t i = 0; i < sizeof(data); i++) {
+      data[i] = i * 7 + (i >> 8);
+    }
+
+    EXPECT_EQ(0, PIOS_Flash_Posix_Init(&pios_posix_flash_id, &flash_config));
+    PIOS_FLASH_register_partition_table(pios_flash_partition_table, pios_flash_partition_table_size);
+    EXPECT_EQ(0, PIOS_STREAMFS_Init(&fs_id, &streamfs_config, FLASH_PARTITION_LABEL_LOG));
+    EXPECT_EQ(0, PIOS_FLASH_find_partition_id(FLASH_PARTITION_LABEL_LOG, &partition_id));
+  }
+
+  virtual void TearDown() {
+    PIOS_Flash_Posix_Destroy(pios_posix_flash_id);
+    unlink("theflash.bin");
+  }
+
+  /* Append len bytes of data, in pieces of chunk bytes */
+  void write_chunks(uint32_t len, uint32_t chunk) {
+    for (uint32_t pos = 0; pos < len; pos += chunk) {
+      ASSERT_EQ(0, PIOS_STREAMFS_Testing_Write(fs_id, &data[pos], std::min(chunk, len - pos)));
+    }
+  }
+
+  /* Read back the last file and compare it with the first len bytes of data */
+  void verify_file(uint32_t len) {
+    ASSERT_EQ(0, PIOS_STREAMFS_OpenRead(fs_id, PIOS_STREAMFS_MaxFileId(fs_id)));
+
+    static uint8_t check[sizeof(data)];
+    memset(check, 0, sizeof(check));
+    EXPECT_EQ((int32_t) len, PIOS_STREAMFS_Read(fs_id, check, sizeof(check)));
+    EXPECT_EQ(0, memcmp(data, check, len));
+
+    EXPECT_EQ(0, PIOS_STREAMFS_Close(fs_id));
+  }
+
+  struct streamfs_stats get_stats() {
+    struct streamfs_stats stats;
+    EXPECT_EQ(0, PIOS_STREAMFS_GetStats(fs_id, &stats));
+    return stats;
+  }
+
+  uintptr_t fs_id;
+  uintptr_t partition_id;
+  uint8_t data[2 * ARENA_DATA_SIZE];
+};
+
+TEST_F(StreamfsTest, WriteVerify) {
+  ASSERT_EQ(0, PIOS_STREAMFS_OpenWrite(fs_id));
+  write_chunks(1000, 37);
+  ASSERT_EQ(0, PIOS_STREAMFS_Close(fs_id));
+
+  verify_file(1000);
+}
+
+TEST_F(StreamfsTest, SmallWritesProgramWholePages) {
+  ASSERT_EQ(0, PIOS_STREAMFS_OpenWrite(fs_id));
+  write_chunks(10 * PAGE_SIZE, 17);
+
+  struct streamfs_stats stats = get_stats();
+  EXPECT_EQ(10u, stats.program_ops);
+  EXPECT_EQ(10u * PAGE_SIZE, stats.bytes_programmed);
+  EXPECT_EQ(10u * PAGE_SIZE, stats.bytes_written);
+
+  ASSERT_EQ(0, PIOS_STREAMFS_Close(fs_id));
+  verify_file(10 * PAGE_SIZE);
+}
+
+TEST_F(StreamfsTest, CloseFlushesPartialPage) {
+  ASSERT_EQ(0, PIOS_STREAMFS_OpenWrite(fs_id));
+  write_chunks(100, 30);
+
+  EXPECT_EQ(0u, get_stats().program_ops);
+
+  ASSERT_EQ(0, PIOS_STREAMFS_Close(fs_id));
+
+  /* The partial page, then the footer */
+  struct streamfs_stats stats = get_stats();
+  EXPECT_EQ(2u, stats.program_ops);
+  EXPECT_EQ(100u + FOOTER_SIZE, stats.bytes_programmed);
+
+  verify_file(100);
+}
+
+TEST_F(StreamfsTest, PageSplitAtFooter) {
+  const uint32_t len = ARENA_DATA_SIZE + 300;
+
+  ASSERT_EQ(0, PIOS_STREAMFS_OpenWrite(fs_id));
+  write_chunks(len, 100);
+
+  /*
+   * The first arena takes 255 whole pages and a last page cut short by
+   * the footer, then its footer.  One page of the second arena is full.
+   */
+  struct streamfs_stats stats = get_stats();
+  EXPECT_EQ(255u + 1 + 1 + 1, stats.program_ops);
+  EXPECT_EQ((uint32_t) ARENA_DATA_SIZE + FOOTER_SIZE + PAGE_SIZE, stats.bytes_programmed);
+
+  /* The data runs right up to the footer of the first arena */
+  ASSERT_EQ(0, PIOS_FLASH_start_transaction(partition_id));
+  uint8_t tail[PAGE_SIZE];
+  EXPECT_EQ(0, PIOS_FLASH_read_data(partition_id, ARENA_DATA_SIZE - sizeof(tail), tail, sizeof(tail)));
+  EXPECT_EQ(0, memcmp(&data[ARENA_DATA_SIZE - sizeof(tail)], tail, sizeof(tail)));
+
+  uint32_t footer[2];
+  EXPECT_EQ(0, PIOS_FLASH_read_data(partition_id, ARENA_DATA_SIZE, (uint8_t *) footer, sizeof(footer)));
+  EXPECT_EQ(streamfs_config.fs_magic, footer[0]);
+  EXPECT_EQ((uint32_t) ARENA_DATA_SIZE, footer[1]);
+  PIOS_FLASH_end_transaction(partition_id);
+
+  ASSERT_EQ(0, PIOS_STREAMFS_Close(fs_id));
+  verify_file(len);
+}
+
+TEST_F(StreamfsTest, CloseFlushesComBuffer) {
+  for (uint32_t i = 0; i < sizeof(com_data); i++) {
+    com_data[i] = data[i];
+  }
+  com_pending = sizeof(com_data);
+
+  pios_streamfs_com_driver.bind_tx_cb(fs_id, com_tx_out, 0);
+
+  ASSERT_EQ(0, PIOS_STREAMFS_OpenWrite(fs_id));
+
+  /* Nothing has run the task, so all of it is still queued */
+  ASSERT_EQ(0, PIOS_STREAMFS_Close(fs_id));
+  EXPECT_EQ(0, com_pending);
+
+  verify_file(sizeof(com_data));
+
+  pios_streamfs_com_driver.bind_tx_cb(fs_id, NULL, 0);
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,13 @@
+/*
+ * Minimal stand-in for flight/PiOS/openpilot.h, enough to build the
+ * object manager without the rest of the flight libraries.
+ */
+#ifndef OPENPILOT_H
+#define OPENPILOT_H
+
+#include <pios.h>
+
+#include "utlist.h"
+#include "uavobjectmanager.h"
+
+#endif /* OPENPILOT_H */
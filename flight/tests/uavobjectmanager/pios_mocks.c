@@ -0,0 +1,120 @@
+/**
+ ******************************************************************************
+ * @file       pios_mocks.c
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Host stand-ins for the PiOS services used by the object manager
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#include "pios.h"
+#include "misc_math.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+uintptr_t pios_uavo_settings_fs_id;
+
+/* Counts lock acquisitions so tests can check lock-free paths */
+uint32_t pios_mock_mutex_locks;
+
+static int mock_mutex;
+
+struct pios_recursive_mutex *PIOS_Recursive_Mutex_Create(void)
+{
+	return (struct pios_recursive_mutex *) &mock_mutex;
+}
+
+bool PIOS_Recursive_Mutex_Lock(struct pios_recursive_mutex *mtx, uint32_t timeout_ms)
+{
+	pios_mock_mutex_locks++;
+	return true;
+}
+
+bool PIOS_Recursive_Mutex_Unlock(struct pios_recursive_mutex *mtx)
+{
+	return true;
+}
+
+void * PIOS_malloc_no_dma(size_t size)
+{
+	return malloc(size);
+}
+
+void * PIOS_malloc(size_t size)
+{
+	return malloc(size);
+}
+
+void PIOS_free(void * buf)
+{
+	free(buf);
+}
+
+bool PIOS_Queue_Send(struct pios_queue *queuep, const void *itemp, uint32_t timeout_ms)
+{
+	return true;
+}
+
+uint32_t PIOS_Thread_Systime(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+/* Every wait for the lock appears to take this long */
+uint32_t pios_mock_lock_wait_us;
+
+uint32_t PIOS_DELAY_GetRaw()
+{
+	return 0;
+}
+
+uint32_t PIOS_DELAY_DiffuS(uint32_t raw)
+{
+	return pios_mock_lock_wait_us;
+}
+
+uint16_t randomize_int(uint16_t interval)
+{
+	return 0;
+}
+
+int32_t PIOS_FLASHFS_ObjSave(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst_id, uint8_t * obj_data, uint16_t obj_size)
+{
+	return -1;
+}
+
+int32_t PIOS_FLASHFS_ObjLoad(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst_id, uint8_t * obj_data, uint16_t obj_size)
+{
+	return -1;
+}
+
+int32_t PIOS_FLASHFS_ObjDelete(uintptr_t fs_id, uint32_t obj_id, uint16_t obj_inst_id)
+{
+	return -1;
+}
+
+/**
+ * @}
+ * @}
+ */
@@ -0,0 +1,102 @@
+/**
+ ******************************************************************************
+ * @addtogroup TauLabsCore Tau Labs Core components
+ * @{
+ * @addtogroup UAVObjectHandling UAVObject handling code
+ * @{
+ *
+ * @file       uavobjectshash.h
+ * @author     dRonin, http://dronin.org Copyright (C) 2016
+ * @brief      Perfect hash over all data object IDs, used by the object
+ *             manager to look up objects by ID in constant time.
+ *             Generated by the UAVObjectGenerator algorithm for the
+ *             synthetic object IDs used by the unit test,
+ *             ID(n) = (n * 0x9E3779B1) & ~1 for n = 1..118.
+ * @see        The GNU Public License (GPL) Version 3
+ *
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+#ifndef UAVOBJECTSHASH_H
+#define UAVOBJECTSHASH_H
+
+#include <stdint.h>
+
+/*
+ * Two level "hash and displace" table.  The first multiplicative hash
+ * selects a bucket, whose displacement is XORed into the second hash to
+ * give a collision free slot.  Every data object ID maps to a distinct
+ * slot; IDs that are not in the table land on a slot holding another ID
+ * (or zero), so callers must compare against uavo_hash_ids[].
+ */
+#define UAVO_HASH_BITS        7
+#define UAVO_HASH_BUCKET_BITS 6
+#define UAVO_HASH_SIZE        (1 << UAVO_HASH_BITS)
+#define UAVO_HASH_BUCKETS     (1 << UAVO_HASH_BUCKET_BITS)
+#define UAVO_HASH_MULT1       0xe29724bdu
+#define UAVO_HASH_MULT2       0x8d1ab8ebu
+
+static const uint16_t uavo_hash_disp[UAVO_HASH_BUCKETS] = {
+	0x0000, 0x0003, 0x0000, 0x0000, 0x0005, 0x000d, 0x0000, 0x0009,
+	0x0001, 0x0003, 0x0005, 0x0004, 0x0004, 0x0000, 0x0000, 0x000c,
+	0x0000, 0x0000, 0x0005, 0x0004, 0x0005, 0x0010, 0x0000, 0x0003,
+	0x0000, 0x0000, 0x0004, 0x0009, 0x0005, 0x0002, 0x000e, 0x0002,
+	0x000d, 0x0006, 0x0009, 0x0005, 0x0008, 0x0004, 0x0000, 0x0002,
+	0x0004, 0x0007, 0x000c, 0x0003, 0x000a, 0x0007, 0x000e, 0x0004,
+	0x0002, 0x0000, 0x001b, 0x0004, 0x0009, 0x000e, 0x0010, 0x0007,
+	0x0006, 0x0014, 0x000c, 0x0000, 0x0000, 0x000c, 0x0001, 0x0000,
+};
+
+static const uint32_t uavo_hash_ids[UAVO_HASH_SIZE] = {
+	0x212fdcfa, 0x54cda260, 0x4bfc7462, 0xaa66d130, 0x0f8d8100, 0x6df7ddce,
+	0x3a5a1868, 0x432b4666, 0x7f9a39c8, 0x8ff34738, 0xe4c0e998, 0x98c47536,
+	0xed921796, 0xd5336898, 0x185eaefe, 0x6526afd0, 0x538453d6, 0xd31e8d9e,
+	0x00000000, 0x3188ea6c, 0xdbefbb9c, 0x5c5581d4, 0xb1232434, 0x28b7bc6e,
+	0xec48c90c, 0xfdeb2506, 0x06bc5304, 0x00000000, 0xc17c31a4, 0x00000000,
+	0x17156074, 0xa851f636, 0x6be302d4, 0xafd9d5aa, 0x74b430d2, 0xf519f70a,
+	0x1fe68e72, 0x9f80c83a, 0x96af9a3c, 0x850d3e42, 0x8dde6c40, 0xdaa66d12,
+	0x6311d4d8, 0x2f740f72, 0x38453d70, 0xca4d5fa2, 0x5a40a6da, 0x489e4ae0,
+	0x7c3c1046, 0x1dd1b378, 0x26a2e176, 0x516f78de, 0x736ae248, 0xa708a7ae,
+	0x9e3779b0, 0xfbd64a0e, 0x00000000, 0x00000000, 0xe3779b10, 0xb8ab03a8,
+	0xf3051c10, 0x0c2f577e, 0x36fbeee6, 0xe162c016, 0x3fcd1ce4, 0x82f8634a,
+	0x6a99b44c, 0xfa8cfb84, 0xea33ee14, 0xbf6756ac, 0xb69628ae, 0x00000000,
+	0x2e2ac0ea, 0xd891921a, 0x035e2982, 0x7a27354c, 0xadc4fab2, 0xa4f3ccb4,
+	0xcfc0641c, 0x4f5a9de4, 0xf1bbcd88, 0x71560750, 0x9c229eb8, 0x12ebaa82,
+	0xbe1e0822, 0x3db841ea, 0xc6ef3620, 0x46896fe8, 0x935170ba, 0x00000000,
+	0x1500857c, 0x00000000, 0x6884d952, 0x56e27d58, 0x2c15e5f0, 0x81af14c0,
+	0x8a8042be, 0x0a1a7c86, 0xf878208c, 0xd67cb720, 0xefa6f28e, 0x34e713ee,
+	0xb54cda26, 0x01494e88, 0xcdab8924, 0x2344b7f4, 0xc4da5b26, 0x4e114f5c,
+	0x9a0dc3be, 0x4540215e, 0x78dde6c4, 0x1a7389f6, 0x3c6ef362, 0x11a25bfa,
+	0x08d12dfc, 0xe6d5c492, 0x5fb3ab56, 0x886b67c4, 0x913c95c2, 0xde049694,
+	0xbc092d2a, 0x00000000, 0x00000000, 0xa195a332, 0xb337ff2c, 0x5d9ed05c,
+	0xcc623a9a, 0x76c90bca,
+};
+
+static inline uint16_t uavo_hash_slot(uint32_t id)
+{
+	uint32_t bucket = (id * UAVO_HASH_MULT1) >> (32 - UAVO_HASH_BUCKET_BITS);
+	uint32_t slot = (id * UAVO_HASH_MULT2) >> (32 - UAVO_HASH_BITS);
+
+	return slot ^ uavo_hash_disp[bucket];
+}
+
+#endif /* UAVOBJECTSHASH_H */
+
+/**
+ * @}
+ * @}
+ */
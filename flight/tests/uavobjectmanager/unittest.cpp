@@ -0,0 +1,455 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test and microbenchmark for the UAVObject manager
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <time.h>		/* clock_gettime */
+#include <pthread.h>		/* pthread_create */
+
+extern "C" {
+
+#include "openpilot.h"
+
+extern uint32_t pios_mock_mutex_locks;
+extern uint32_t pios_mock_lock_wait_us;
+
+}
+
+/* Must match the IDs the test's uavobjectshash.h was generated from */
+#define NUM_OBJS 118
+#define OBJ_ID(n) ((uint32_t) ((n) * 0x9E3779B1u) & ~1u)
+
+#define OBJ_SIZE 40
+
+/* Not in the generated table; exercises the locked fallback path */
+#define ROGUE_ID 0x12345678
+#define SEQ_ID   0x2468ace0
+
+static double now_ns()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// To use a test fixture, derive a class from testing::Test.
+class UAVObjManagerTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    ASSERT_EQ(0, UAVObjInitialize());
+
+    for (int n = 1; n <= NUM_OBJS; n++) {
+      handles[n] = UAVObjRegister(OBJ_ID(n), n & 1, 0, 0, OBJ_SIZE, NULL);
+      ASSERT_TRUE(handles[n] != NULL);
+    }
+  }
+
+  virtual void TearDown() {
+  }
+
+  UAVObjHandle handles[NUM_OBJS + 1];
+};
+
+TEST_F(UAVObjManagerTest, LookupById) {
+  for (int n = 1; n <= NUM_OBJS; n++) {
+    EXPECT_EQ(handles[n], UAVObjGetByID(OBJ_ID(n)));
+    EXPECT_EQ(OBJ_ID(n), UAVObjGetID(UAVObjGetByID(OBJ_ID(n))));
+  }
+}
+
+TEST_F(UAVObjManagerTest, LookupMetaById) {
+  for (int n = 1; n <= NUM_OBJS; n++) {
+    UAVObjHandle meta = UAVObjGetByID(OBJ_ID(n) + 1);
+
+    ASSERT_TRUE(meta != NULL);
+    EXPECT_TRUE(UAVObjIsMetaobject(meta));
+    EXPECT_EQ(UAVObjGetLinkedObj(handles[n]), meta);
+    EXPECT_EQ(OBJ_ID(n) + 1, UAVObjGetID(meta));
+  }
+}
+
+TEST_F(UAVObjManagerTest, LookupIsLockFree) {
+  uint32_t locks = pios_mock_mutex_locks;
+
+  for (int n = 1; n <= NUM_OBJS; n++) {
+    UAVObjGetByID(OBJ_ID(n));
+    UAVObjGetByID(OBJ_ID(n) + 1);
+  }
+  UAVObjGetByID(0xdeadbeef);
+
+  EXPECT_EQ(locks, pios_mock_mutex_locks);
+}
+
+TEST_F(UAVObjManagerTest, UnknownIdsNotFound) {
+  EXPECT_EQ(NULL, UAVObjGetByID(0));
+  EXPECT_EQ(NULL, UAVObjGetByID(0xdeadbeef));
+  EXPECT_EQ(NULL, UAVObjGetByID(OBJ_ID(NUM_OBJS + 1)));
+  EXPECT_EQ(NULL, UAVObjGetByID(ROGUE_ID));
+}
+
+TEST_F(UAVObjManagerTest, DuplicateRegistrationRejected) {
+  EXPECT_EQ(NULL, UAVObjRegister(OBJ_ID(1), 1, 0, 0, OBJ_SIZE, NULL));
+}
+
+TEST_F(UAVObjManagerTest, UnindexedObjectFallback) {
+  UAVObjHandle rogue = UAVObjRegister(ROGUE_ID, 1, 0, 0, OBJ_SIZE, NULL);
+
+  ASSERT_TRUE(rogue != NULL);
+  EXPECT_EQ(rogue, UAVObjGetByID(ROGUE_ID));
+  EXPECT_EQ(UAVObjGetLinkedObj(rogue), UAVObjGetByID(ROGUE_ID + 1));
+
+  /* Indexed objects are unaffected */
+  EXPECT_EQ(handles[7], UAVObjGetByID(OBJ_ID(7)));
+  EXPECT_EQ(NULL, UAVObjGetByID(0xdeadbeef));
+}
+
+TEST_F(UAVObjManagerTest, MultiInstanceData) {
+  /* Even numbered objects are multi-instance */
+  UAVObjHandle multi = handles[2];
+  uint8_t data[OBJ_SIZE];
+
+  ASSERT_FALSE(UAVObjIsSingleInstance(multi));
+
+  /* Creating an instance fills in every chunk boundary up to it */
+  for (uint16_t n = 1; n < 70; n++) {
+    EXPECT_EQ(n, UAVObjCreateInstance(multi, NULL));
+  }
+  EXPECT_EQ(70, UAVObjGetNumInstances(multi));
+
+  for (uint16_t n = 0; n < 70; n++) {
+    memset(data, n, sizeof(data));
+    EXPECT_EQ(0, UAVObjSetInstanceData(multi, n, data));
+  }
+
+  for (uint16_t n = 0; n < 70; n++) {
+    uint8_t expected[OBJ_SIZE];
+    memset(expected, n, sizeof(expected));
+    EXPECT_EQ(0, UAVObjGetInstanceData(multi, n, data));
+    EXPECT_EQ(0, memcmp(expected, data, sizeof(data)));
+  }
+
+  EXPECT_EQ(-1, UAVObjGetInstanceData(multi, 70, data));
+
+  /* Unpacking past the end creates the missing instances */
+  memset(data, 0xa5, sizeof(data));
+  EXPECT_EQ(0, UAVObjUnpack(multi, 130, data));
+  EXPECT_EQ(131, UAVObjGetNumInstances(multi));
+  EXPECT_EQ(0, UAVObjGetInstanceData(multi, 130, data));
+  EXPECT_EQ(0xa5, data[OBJ_SIZE - 1]);
+  EXPECT_EQ(0, UAVObjGetInstanceData(multi, 129, data));
+  EXPECT_EQ(0, data[0]);
+}
+
+TEST_F(UAVObjManagerTest, MultiInstanceMemoryStats) {
+  UAVObjStats stats;
+
+  UAVObjGetStats(&stats);
+  EXPECT_EQ(0, stats.instanceMemorySaved);
+
+  /* Fill instances 1..15 exactly: chunks of 1, 2, 4 and 8 */
+  for (uint16_t n = 1; n < 16; n++) {
+    UAVObjCreateInstance(handles[2], NULL);
+  }
+
+  UAVObjClearStats();
+  UAVObjGetStats(&stats);
+
+  /* 15 separate allocations would each carry a next pointer */
+  EXPECT_EQ((int32_t) (15 * sizeof(void *) - 10 * sizeof(void *)),
+      stats.instanceMemorySaved);
+}
+
+TEST_F(UAVObjManagerTest, SeqLockedOnlySingleInstanceData) {
+  /* Multi-instance */
+  EXPECT_EQ(NULL, UAVObjRegister(SEQ_ID, 0, 0, 1, OBJ_SIZE, NULL));
+  /* Settings */
+  EXPECT_EQ(NULL, UAVObjRegister(SEQ_ID, 1, 1, 1, OBJ_SIZE, NULL));
+}
+
+TEST_F(UAVObjManagerTest, SeqLockedData) {
+  UAVObjHandle seq = UAVObjRegister(SEQ_ID, 1, 0, 1, OBJ_SIZE, NULL);
+  uint8_t data[OBJ_SIZE];
+  uint8_t out[OBJ_SIZE];
+
+  ASSERT_TRUE(seq != NULL);
+  ASSERT_TRUE(UAVObjIsSingleInstance(seq));
+
+  for (int i = 0; i < OBJ_SIZE; i++) {
+    data[i] = i;
+  }
+  EXPECT_EQ(0, UAVObjSetData(seq, data));
+
+  /* Reads bypass the lock */
+  uint32_t locks = pios_mock_mutex_locks;
+  EXPECT_EQ(0, UAVObjGetData(seq, out));
+  EXPECT_EQ(0, memcmp(data, out, sizeof(data)));
+  EXPECT_EQ(0, UAVObjGetDataField(seq, out, 10, 4));
+  EXPECT_EQ(0, memcmp(data + 10, out, 4));
+  EXPECT_EQ(-1, UAVObjGetDataField(seq, out, OBJ_SIZE - 2, 4));
+  EXPECT_EQ(-1, UAVObjGetInstanceData(seq, 1, out));
+  EXPECT_EQ(locks, pios_mock_mutex_locks);
+
+  /* Field updates carry over the rest of the object */
+  uint8_t field[4] = { 0xaa, 0xbb, 0xcc, 0xdd };
+  EXPECT_EQ(0, UAVObjSetDataField(seq, field, 20, sizeof(field)));
+  EXPECT_EQ(0, UAVObjGetData(seq, out));
+  memcpy(data + 20, field, sizeof(field));
+  EXPECT_EQ(0, memcmp(data, out, sizeof(data)));
+
+  /* Unpack and pack go through the same storage */
+  memset(data, 0x5a, sizeof(data));
+  EXPECT_EQ(0, UAVObjUnpack(seq, 0, data));
+  EXPECT_EQ(0, UAVObjGetData(seq, out));
+  EXPECT_EQ(0, memcmp(data, out, sizeof(data)));
+  memset(out, 0, sizeof(out));
+  EXPECT_EQ(0, UAVObjPack(seq, 0, out));
+  EXPECT_EQ(0, memcmp(data, out, sizeof(data)));
+
+  UAVObjStats stats;
+  UAVObjGetStats(&stats);
+  /* Rejected reads are not counted */
+  EXPECT_EQ(4u, stats.seqlockReads);
+  EXPECT_EQ(0u, stats.seqlockRetries);
+}
+
+static volatile bool writer_done;
+
+static void *seq_writer(void *handle)
+{
+  uint8_t data[OBJ_SIZE];
+
+  for (int n = 0; n < 200000; n++) {
+    memset(data, n, sizeof(data));
+    UAVObjSetData((UAVObjHandle) handle, data);
+  }
+
+  writer_done = true;
+
+  return NULL;
+}
+
+TEST_F(UAVObjManagerTest, SeqLockedReadsNeverTear) {
+  UAVObjHandle seq = UAVObjRegister(SEQ_ID, 1, 0, 1, OBJ_SIZE, NULL);
+  pthread_t writer;
+  uint32_t reads = 0;
+
+  ASSERT_TRUE(seq != NULL);
+
+  writer_done = false;
+  ASSERT_EQ(0, pthread_create(&writer, NULL, seq_writer, seq));
+
+  while (!writer_done) {
+    uint8_t out[OBJ_SIZE];
+
+    UAVObjGetData(seq, out);
+    reads++;
+
+    for (int i = 1; i < OBJ_SIZE; i++) {
+      ASSERT_EQ(out[0], out[i]);
+    }
+  }
+
+  pthread_join(writer, NULL);
+
+  UAVObjStats stats;
+  UAVObjGetStats(&stats);
+  printf("Seqlocked reads: %u, retries: %u\n", reads, stats.seqlockRetries);
+}
+
+TEST_F(UAVObjManagerTest, LockContentionStats) {
+  uint8_t data[OBJ_SIZE];
+  UAVObjStats stats;
+
+  UAVObjClearStats();
+
+  /* Uncontended */
+  UAVObjGetData(handles[1], data);
+  UAVObjGetStats(&stats);
+  EXPECT_EQ(0u, stats.lockContended);
+
+  UAVObjClearStats();
+
+  pios_mock_lock_wait_us = 50;
+  UAVObjGetData(handles[1], data);
+  UAVObjSetData(handles[1], data);
+  pios_mock_lock_wait_us = 0;
+
+  UAVObjGetStats(&stats);
+
+  /* Get, set and the get of the stats themselves */
+  EXPECT_EQ(3u, stats.lockAcquisitions);
+  EXPECT_EQ(2u, stats.lockContended);
+  EXPECT_EQ(100u, stats.lockWaitTotalUs);
+  EXPECT_EQ(50u, stats.lockWaitMaxUs);
+}
+
+/* Objects touched by the fan-out callback, and the order events arrive */
+static UAVObjHandle fanout_targets[16];
+static int fanout_count;
+static uint32_t event_log[32];
+static int event_log_len;
+
+static void log_event_cb(UAVObjEvent *ev, void *, void *, int)
+{
+  event_log[event_log_len++] = UAVObjGetID(ev->obj);
+}
+
+static void fanout_cb(UAVObjEvent *, void *, void *, int)
+{
+  uint8_t data[OBJ_SIZE] = { 0 };
+
+  for (int i = 0; i < fanout_count; i++) {
+    UAVObjSetData(fanout_targets[i], data);
+  }
+}
+
+class UAVObjEventTest : public UAVObjManagerTest {
+protected:
+  virtual void SetUp() {
+    UAVObjManagerTest::SetUp();
+
+    event_log_len = 0;
+    UAVObjConnectCallback(handles[1], fanout_cb, NULL, EV_MASK_ALL_UPDATES);
+
+    for (int i = 0; i < 16; i++) {
+      fanout_targets[i] = handles[3 + 2 * i];
+      UAVObjConnectCallback(fanout_targets[i], log_event_cb, NULL,
+          EV_MASK_ALL_UPDATES);
+    }
+
+    UAVObjGetEventStats(&before);
+  }
+
+  void fire() {
+    uint8_t data[OBJ_SIZE] = { 0 };
+
+    UAVObjSetData(handles[1], data);
+    UAVObjGetEventStats(&after);
+  }
+
+  UAVObjEventStats before, after;
+};
+
+TEST_F(UAVObjEventTest, NestedEventsDispatchedInOrder) {
+  fanout_count = 6;
+  fire();
+
+  ASSERT_EQ(6, event_log_len);
+  for (int i = 0; i < 6; i++) {
+    EXPECT_EQ(UAVObjGetID(fanout_targets[i]), event_log[i]);
+  }
+
+  EXPECT_EQ(7u, after.dispatched - before.dispatched);
+  EXPECT_EQ(0u, after.dropped);
+  EXPECT_EQ(6, after.highWater);
+}
+
+TEST_F(UAVObjEventTest, FullBacklogDropsPerObject) {
+  UAVObjStats stats;
+
+  UAVObjClearStats();
+
+  fanout_count = after.depth + 2;
+  fire();
+
+  EXPECT_EQ(after.depth, event_log_len);
+  EXPECT_EQ(2u, after.dropped);
+  EXPECT_EQ(after.depth, after.highWater);
+
+  for (int i = 0; i < 2; i++) {
+    EXPECT_EQ(UAVObjGetID(fanout_targets[after.depth + i]),
+        after.dropObjIds[i]);
+    EXPECT_EQ(1, after.dropCounts[i]);
+  }
+  EXPECT_EQ(0, after.dropCounts[2]);
+
+  /* Drops still raise the event system alarm */
+  UAVObjGetStats(&stats);
+  EXPECT_EQ(2u, stats.eventCallbackErrors);
+}
+
+TEST_F(UAVObjEventTest, RepeatedEventsCoalesce) {
+  fanout_targets[1] = fanout_targets[0];
+  fanout_count = 2;
+  fire();
+
+  EXPECT_EQ(1, event_log_len);
+  EXPECT_EQ(1u, after.coalesced - before.coalesced);
+}
+
+TEST_F(UAVObjEventTest, SelfTriggerSuppressed) {
+  fanout_targets[0] = handles[1];
+  fanout_count = 1;
+  fire();
+
+  EXPECT_EQ(0, event_log_len);
+  EXPECT_EQ(1u, after.suppressed - before.suppressed);
+  EXPECT_EQ(1u, after.dispatched - before.dispatched);
+}
+
+TEST_F(UAVObjManagerTest, LookupBenchmark) {
+  const int rounds = 20000;
+  volatile uintptr_t sink = 0;
+
+  double start = now_ns();
+  for (int r = 0; r < rounds; r++) {
+    for (int n = 1; n <= NUM_OBJS; n++) {
+      sink += (uintptr_t) UAVObjGetByID(OBJ_ID(n) | (r & 1));
+    }
+  }
+  double elapsed = now_ns() - start;
+
+  printf("UAVObjGetByID: %d objects, %.1f ns/lookup\n", NUM_OBJS,
+      elapsed / (rounds * NUM_OBJS));
+
+  start = now_ns();
+  for (int r = 0; r < rounds * NUM_OBJS; r++) {
+    sink += (uintptr_t) UAVObjGetByID(0xdeadbeef + 2 * r);
+  }
+  elapsed = now_ns() - start;
+
+  printf("UAVObjGetByID: unknown IDs, %.1f ns/lookup\n",
+      elapsed / (rounds * NUM_OBJS));
+
+  (void) sink;
+}
+
+/**
+ * @}
+ * @}
+ */
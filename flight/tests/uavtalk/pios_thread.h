@@ -0,0 +1,12 @@
+/*
+ * Stand-in for flight/PiOS/inc/pios_thread.h, which needs an RTOS.
+ * UAVTalk only reads the clock.
+ */
+#ifndef PIOS_THREAD_H_
+#define PIOS_THREAD_H_
+
+#include <stdint.h>
+
+uint32_t PIOS_Thread_Systime(void);
+
+#endif /* PIOS_THREAD_H_ */
@@ -0,0 +1,13 @@
+/*
+ * Stand-in for the generated uavobjectsinit.h.  The test objects are much
+ * smaller than this, it only sizes the UAVTalk buffers.
+ */
+#ifndef UAVOBJECTSINIT_H
+#define UAVOBJECTSINIT_H
+
+#define UAVOBJECTS_LARGEST 512
+
+void UAVObjectsInitializeAll();
+const uint16_t *UAVObjectsFieldOffsets(uint32_t objId, uint8_t *numFields);
+
+#endif /* UAVOBJECTSINIT_H */
@@ -0,0 +1,736 @@
+/**
+ ******************************************************************************
+ * @file       unittest.cpp
+ * @author     dRonin, http://dronin.org, Copyright (C) 2016
+ * @addtogroup UnitTests
+ * @{
+ * @addtogroup UnitTests
+ * @{
+ * @brief Unit test for the UAVTalk protocol
+ *****************************************************************************/
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY
+ * or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program; if not, write to the Free Software Foundation, Inc.,
+ * 59 Temple Place, Suite 330, Boston, MA 02111-1307 USA
+ */
+
+/*
+ * NOTE: This program uses the Google Test infrastructure to drive the unit test
+ *
+ * Main site for Google Test: http://code.google.com/p/googletest/
+ * Documentation and examples: http://code.google.com/p/googletest/wiki/Documentation
+ */
+
+#include "gtest/gtest.h"
+
+#include <stdio.h>		/* printf */
+#include <stdlib.h>		/* abort */
+#include <string.h>		/* memset */
+#include <stdint.h>		/* uint*_t */
+#include <algorithm>
+#include <vector>
+
+extern "C" {
+
+#include "openpilot.h"
+
+extern uint8_t pios_mock_com_buf[];
+extern uint16_t pios_mock_com_room;
+extern uint16_t pios_mock_com_used;
+
+}
+
+/* Same IDs the shared uavobjectshash.h was generated from */
+#define OBJ_ID(n) ((uint32_t) ((n) * 0x9E3779B1u) & ~1u)
+
+#define SINGLE_ID   OBJ_ID(1)
+#define SINGLE_SIZE 40
+#define MULTI_ID    OBJ_ID(2)
+#define MULTI_SIZE  12
+#define LARGE_ID    OBJ_ID(3)
+#define LARGE_SIZE  300
+#define UNKNOWN_ID  OBJ_ID(4)
+
+#define SYNC            0x3C
+#define TYPE_OBJ        0x20
+#define TYPE_OBJ_REQ    0x21
+#define TYPE_OBJ_BATCH  0x25
+#define TYPE_OBJ_DELTA  0x26
+#define HEADER_LENGTH   8
+
+static std::vector<uint8_t> sent;
+
+static int32_t capture(uint8_t *data, int32_t length)
+{
+	sent.insert(sent.end(), data, data + length);
+
+	return length;
+}
+
+/* Split the captured stream into packets using their size fields */
+static std::vector<std::vector<uint8_t> > sentPackets()
+{
+	std::vector<std::vector<uint8_t> > packets;
+	size_t pos = 0;
+
+	while (pos + HEADER_LENGTH <= sent.size()) {
+		size_t size = sent[pos + 2] | (sent[pos + 3] << 8);
+		packets.push_back(std::vector<uint8_t>(sent.begin() + pos, sent.begin() + pos + size + 1));
+		pos += size + 1;
+	}
+
+	return packets;
+}
+
+static void put32(std::vector<uint8_t> &buf, uint32_t val)
+{
+	for (int i = 0; i < 4; i++)
+		buf.push_back(val >> (8 * i));
+}
+
+static void put16(std::vector<uint8_t> &buf, uint16_t val)
+{
+	buf.push_back(val & 0xFF);
+	buf.push_back(val >> 8);
+}
+
+static std::vector<uint8_t> makePacket(uint8_t type, uint32_t objId, const std::vector<uint8_t> &payload)
+{
+	std::vector<uint8_t> packet;
+
+	packet.push_back(SYNC);
+	packet.push_back(type);
+	put16(packet, HEADER_LENGTH + payload.size());
+	put32(packet, objId);
+	packet.insert(packet.end(), payload.begin(), payload.end());
+	packet.push_back(PIOS_CRC_updateCRC(0, &packet[0], packet.size()));
+
+	return packet;
+}
+
+class UAVTalkTest : public testing::Test {
+protected:
+  virtual void SetUp() {
+    ASSERT_EQ(0, UAVObjInitialize());
+
+    single = UAVObjRegister(SINGLE_ID, 1, 0, 0, SINGLE_SIZE, NULL);
+    multi = UAVObjRegister(MULTI_ID, 0, 0, 0, MULTI_SIZE, NULL);
+    large = UAVObjRegister(LARGE_ID, 1, 0, 0, LARGE_SIZE, NULL);
+    ASSERT_TRUE(single && multi && large);
+    ASSERT_EQ(1, UAVObjCreateInstance(multi, NULL));
+    ASSERT_EQ(2, UAVObjCreateInstance(multi, NULL));
+
+    con = UAVTalkInitialize(capture);
+    ASSERT_TRUE(con != NULL);
+    sent.clear();
+  }
+
+  virtual void TearDown() {
+  }
+
+  void receive(const std::vector<uint8_t> &packet) {
+    for (size_t i = 0; i < packet.size(); i++)
+      UAVTalkProcessInputStream(con, packet[i]);
+  }
+
+  void fill(UAVObjHandle obj, uint16_t instId, uint8_t val) {
+    uint8_t data[LARGE_SIZE];
+    memset(data, val, sizeof(data));
+    ASSERT_EQ(0, UAVObjSetInstanceData(obj, instId, data));
+  }
+
+  uint8_t firstByte(UAVObjHandle obj, uint16_t instId) {
+    uint8_t data[LARGE_SIZE];
+    UAVObjGetInstanceData(obj, instId, data);
+    return data[0];
+  }
+
+  UAVObjHandle single;
+  UAVObjHandle multi;
+  UAVObjHandle large;
+  UAVTalkConnection con;
+};
+
+TEST_F(UAVTalkTest, NoBatchesUntilPeerSendsOne) {
+  EXPECT_EQ(0, UAVTalkSendObjectBatched(con, single, 0));
+  EXPECT_FALSE(UAVTalkBatchPending(con));
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(1U, packets.size());
+  EXPECT_EQ(TYPE_OBJ, packets[0][1]);
+  EXPECT_EQ((size_t) (HEADER_LENGTH + SINGLE_SIZE + 1), packets[0].size());
+};
+
+TEST_F(UAVTalkTest, BatchedUpdatesShareOnePacket) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+  ASSERT_TRUE(sent.empty());
+
+  EXPECT_EQ(0, UAVTalkSendObjectBatched(con, single, 0));
+  EXPECT_EQ(0, UAVTalkSendObjectBatched(con, multi, UAVOBJ_ALL_INSTANCES));
+  EXPECT_TRUE(sent.empty());
+  EXPECT_TRUE(UAVTalkBatchPending(con));
+
+  EXPECT_EQ(0, UAVTalkFlushBatch(con));
+  EXPECT_FALSE(UAVTalkBatchPending(con));
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(1U, packets.size());
+  std::vector<uint8_t> &p = packets[0];
+  EXPECT_EQ(TYPE_OBJ_BATCH, p[1]);
+  EXPECT_EQ((size_t) (HEADER_LENGTH + (6 + SINGLE_SIZE) + 3 * (8 + MULTI_SIZE) + 1), p.size());
+  EXPECT_EQ(p.back(), PIOS_CRC_updateCRC(0, &p[0], p.size() - 1));
+
+  // Second record is instance 0 of the multi-instance object
+  size_t rec = HEADER_LENGTH + 6 + SINGLE_SIZE;
+  EXPECT_EQ(MULTI_ID, (uint32_t) (p[rec] | (p[rec + 1] << 8) | (p[rec + 2] << 16) | (p[rec + 3] << 24)));
+  EXPECT_EQ(0x8000 | MULTI_SIZE, p[rec + 4] | (p[rec + 5] << 8));
+  EXPECT_EQ(0, p[rec + 6] | (p[rec + 7] << 8));
+
+  UAVTalkStats stats;
+  UAVTalkGetStats(con, &stats);
+  EXPECT_EQ(4U, stats.txObjects);
+};
+
+TEST_F(UAVTalkTest, BatchRoundTrip) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+
+  fill(single, 0, 0x11);
+  for (int i = 0; i < 3; i++)
+    fill(multi, i, 0x20 + i);
+  UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkSendObjectBatched(con, multi, UAVOBJ_ALL_INSTANCES);
+  UAVTalkFlushBatch(con);
+  std::vector<uint8_t> packet = sent;
+
+  fill(single, 0, 0);
+  for (int i = 0; i < 3; i++)
+    fill(multi, i, 0);
+
+  receive(packet);
+
+  EXPECT_EQ(0x11, firstByte(single, 0));
+  for (int i = 0; i < 3; i++)
+    EXPECT_EQ(0x20 + i, firstByte(multi, i));
+};
+
+TEST_F(UAVTalkTest, FullBatchIsSent) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+
+  // Each record is 46 bytes, five fit in a batch
+  for (int i = 0; i < 6; i++)
+    UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkFlushBatch(con);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(2U, packets.size());
+  EXPECT_EQ((size_t) (HEADER_LENGTH + 5 * (6 + SINGLE_SIZE) + 1), packets[0].size());
+  EXPECT_EQ((size_t) (HEADER_LENGTH + 1 * (6 + SINGLE_SIZE) + 1), packets[1].size());
+};
+
+TEST_F(UAVTalkTest, LargeObjectsSentAlone) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+
+  UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkSendObjectBatched(con, large, 0);
+
+  // The pending batch goes out first to keep updates in order
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(2U, packets.size());
+  EXPECT_EQ(TYPE_OBJ_BATCH, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[1][1]);
+  EXPECT_EQ((size_t) (HEADER_LENGTH + LARGE_SIZE + 1), packets[1].size());
+  EXPECT_FALSE(UAVTalkBatchPending(con));
+};
+
+TEST_F(UAVTalkTest, UnbatchedSendFlushesBatch) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+
+  UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(2U, packets.size());
+  EXPECT_EQ(TYPE_OBJ_BATCH, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[1][1]);
+};
+
+TEST_F(UAVTalkTest, DisableBatching) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+
+  UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkDisableBatching(con);
+  EXPECT_FALSE(UAVTalkBatchPending(con));
+  UAVTalkSendObjectBatched(con, single, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(2U, packets.size());
+  EXPECT_EQ(TYPE_OBJ_BATCH, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[1][1]);
+};
+
+TEST_F(UAVTalkTest, UnknownRecordsSkipped) {
+  std::vector<uint8_t> payload;
+
+  put32(payload, UNKNOWN_ID);
+  put16(payload, 0x8000 | 5);
+  put16(payload, 7);
+  payload.insert(payload.end(), 5, 0xEE);
+
+  put32(payload, SINGLE_ID);
+  put16(payload, SINGLE_SIZE);
+  payload.insert(payload.end(), SINGLE_SIZE, 0x42);
+
+  receive(makePacket(TYPE_OBJ_BATCH, 0, payload));
+
+  EXPECT_EQ(0x42, firstByte(single, 0));
+};
+
+TEST_F(UAVTalkTest, TruncatedRecordRejected) {
+  std::vector<uint8_t> payload;
+
+  fill(single, 0, 0x33);
+
+  put32(payload, SINGLE_ID);
+  put16(payload, SINGLE_SIZE);
+  payload.insert(payload.end(), SINGLE_SIZE - 1, 0x42);
+
+  receive(makePacket(TYPE_OBJ_BATCH, 0, payload));
+
+  EXPECT_EQ(0x33, firstByte(single, 0));
+};
+
+/* A few packets with line noise, including stray sync bytes, around them */
+static std::vector<uint8_t> noisyStream()
+{
+	static const uint8_t noise[] = { 0x00, 0x3C, 0x11, 0xFF, 0x3C, 0x20, 0xFF, 0xFF, 0x42 };
+	std::vector<uint8_t> stream(noise, noise + sizeof(noise));
+	std::vector<uint8_t> payload;
+
+	payload.assign(SINGLE_SIZE, 0x51);
+	std::vector<uint8_t> packet = makePacket(TYPE_OBJ, SINGLE_ID, payload);
+	stream.insert(stream.end(), packet.begin(), packet.end());
+	stream.insert(stream.end(), noise, noise + sizeof(noise));
+
+	payload.clear();
+	put16(payload, 2);
+	payload.insert(payload.end(), MULTI_SIZE, 0x52);
+	packet = makePacket(TYPE_OBJ, MULTI_ID, payload);
+	stream.insert(stream.end(), packet.begin(), packet.end());
+
+	payload.assign(LARGE_SIZE, 0x53);
+	packet = makePacket(TYPE_OBJ, LARGE_ID, payload);
+	stream.insert(stream.end(), packet.begin(), packet.end());
+
+	return stream;
+}
+
+TEST_F(UAVTalkTest, BlockMatchesBytewise) {
+  std::vector<uint8_t> stream = noisyStream();
+  UAVTalkStats expected, stats;
+
+  receive(stream);
+  UAVTalkGetStats(con, &expected);
+  EXPECT_EQ(3U, expected.rxObjects);
+  EXPECT_EQ(stream.size(), expected.rxBytes);
+
+  // Every block size must land every packet, whatever the split
+  for (size_t block = 1; block <= stream.size(); block++) {
+    fill(single, 0, 0);
+    fill(multi, 2, 0);
+    fill(large, 0, 0);
+    UAVTalkResetStats(con);
+
+    for (size_t pos = 0; pos < stream.size(); pos += block) {
+      size_t len = std::min(block, stream.size() - pos);
+      UAVTalkProcessInputBlock(con, &stream[pos], len);
+    }
+
+    UAVTalkGetStats(con, &stats);
+    ASSERT_EQ(expected.rxObjects, stats.rxObjects) << "block " << block;
+    ASSERT_EQ(expected.rxBytes, stats.rxBytes) << "block " << block;
+    ASSERT_EQ(expected.rxErrors, stats.rxErrors) << "block " << block;
+    ASSERT_EQ(0x51, firstByte(single, 0)) << "block " << block;
+    ASSERT_EQ(0x52, firstByte(multi, 2)) << "block " << block;
+    ASSERT_EQ(0x53, firstByte(large, 0)) << "block " << block;
+  }
+};
+
+TEST_F(UAVTalkTest, BlockBadCrcRejected) {
+  std::vector<uint8_t> payload(SINGLE_SIZE, 0x42);
+  std::vector<uint8_t> packet = makePacket(TYPE_OBJ, SINGLE_ID, payload);
+
+  fill(single, 0, 0x33);
+  packet[HEADER_LENGTH + 5] ^= 0x01;
+
+  UAVTalkProcessInputBlock(con, &packet[0], packet.size());
+
+  UAVTalkStats stats;
+  UAVTalkGetStats(con, &stats);
+  EXPECT_EQ(0U, stats.rxObjects);
+  EXPECT_EQ(1U, stats.rxErrors);
+  EXPECT_EQ(0x33, firstByte(single, 0));
+};
+
+TEST_F(UAVTalkTest, QuietBlockStopsAtPacketEnd) {
+  std::vector<uint8_t> payload(SINGLE_SIZE, 0x42);
+  std::vector<uint8_t> first = makePacket(TYPE_OBJ, SINGLE_ID, payload);
+  payload.assign(LARGE_SIZE, 0x43);
+  std::vector<uint8_t> second = makePacket(TYPE_OBJ, LARGE_ID, payload);
+  std::vector<uint8_t> stream(first);
+  stream.insert(stream.end(), second.begin(), second.end());
+
+  UAVTalkRxState state;
+  uint16_t used = UAVTalkProcessInputBlockQuiet(con, &stream[0], stream.size(), &state);
+  EXPECT_EQ(first.size(), used);
+  EXPECT_EQ(UAVTALK_STATE_COMPLETE, state);
+  EXPECT_EQ(SINGLE_ID, UAVTalkGetPacketObjId(con));
+
+  used += UAVTalkProcessInputBlockQuiet(con, &stream[used], stream.size() - used, &state);
+  EXPECT_EQ(stream.size(), used);
+  EXPECT_EQ(UAVTALK_STATE_COMPLETE, state);
+  EXPECT_EQ(LARGE_ID, UAVTalkGetPacketObjId(con));
+
+  // Nothing is unpacked without being asked for
+  EXPECT_NE(0x42, firstByte(single, 0));
+  EXPECT_NE(0x43, firstByte(large, 0));
+};
+
+static uintptr_t mockCom()
+{
+	return 1;
+}
+
+TEST_F(UAVTalkTest, ZeroCopySendMatchesBuffered) {
+  fill(multi, 1, 0x61);
+
+  ASSERT_EQ(0, UAVTalkSendObject(con, multi, 1, 0, 0));
+  std::vector<uint8_t> buffered = sent;
+  sent.clear();
+
+  pios_mock_com_room = 512;
+  pios_mock_com_used = 0;
+  ASSERT_EQ(0, UAVTalkSetOutputCom(con, mockCom));
+  ASSERT_EQ(0, UAVTalkSendObject(con, multi, 1, 0, 0));
+
+  // Built in the device buffer, never passed through the output stream
+  EXPECT_TRUE(sent.empty());
+  ASSERT_EQ(buffered.size(), (size_t) pios_mock_com_used);
+  EXPECT_EQ(0, memcmp(&buffered[0], pios_mock_com_buf, buffered.size()));
+
+  UAVTalkStats stats;
+  UAVTalkGetStats(con, &stats);
+  EXPECT_EQ(2U, stats.txObjects);
+  EXPECT_EQ(2 * buffered.size(), stats.txBytes);
+};
+
+TEST_F(UAVTalkTest, ZeroCopyTimestamped) {
+  pios_mock_com_room = 512;
+  pios_mock_com_used = 0;
+  ASSERT_EQ(0, UAVTalkSetOutputCom(con, mockCom));
+  ASSERT_EQ(0, UAVTalkSendObjectTimestamped(con, single, 0, 0, 0));
+
+  EXPECT_TRUE(sent.empty());
+  ASSERT_EQ((size_t) (HEADER_LENGTH + 2 + SINGLE_SIZE + 1), (size_t) pios_mock_com_used);
+  EXPECT_EQ(HEADER_LENGTH + 2 + SINGLE_SIZE, pios_mock_com_buf[2] | (pios_mock_com_buf[3] << 8));
+  EXPECT_EQ(pios_mock_com_buf[pios_mock_com_used - 1],
+      PIOS_CRC_updateCRC(0, pios_mock_com_buf, pios_mock_com_used - 1));
+};
+
+TEST_F(UAVTalkTest, ZeroCopyFallsBackWithoutRoom) {
+  pios_mock_com_room = HEADER_LENGTH + SINGLE_SIZE;
+  pios_mock_com_used = 0;
+  ASSERT_EQ(0, UAVTalkSetOutputCom(con, mockCom));
+  ASSERT_EQ(0, UAVTalkSendObject(con, single, 0, 0, 0));
+
+  EXPECT_EQ(0, pios_mock_com_used);
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(1U, packets.size());
+  EXPECT_EQ((size_t) (HEADER_LENGTH + SINGLE_SIZE + 1), packets[0].size());
+};
+
+/* Packed single instance object, whose ten fields are four bytes each */
+static void setField(UAVObjHandle obj, int field, uint32_t val)
+{
+	uint8_t data[LARGE_SIZE];
+	UAVObjGetInstanceData(obj, 0, data);
+	memcpy(&data[4 * field], &val, 4);
+	UAVObjSetInstanceData(obj, 0, data);
+}
+
+static uint32_t getField(UAVObjHandle obj, int field)
+{
+	uint8_t data[LARGE_SIZE];
+	uint32_t val;
+	UAVObjGetInstanceData(obj, 0, data);
+	memcpy(&val, &data[4 * field], 4);
+	return val;
+}
+
+TEST_F(UAVTalkTest, NoDeltasUntilPeerSendsOne) {
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  setField(single, 2, 0x12345678);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(2U, packets.size());
+  for (int i = 0; i < 2; i++) {
+    EXPECT_EQ(TYPE_OBJ, packets[i][1]);
+    EXPECT_EQ((size_t) (HEADER_LENGTH + SINGLE_SIZE + 1), packets[i].size());
+  }
+};
+
+TEST_F(UAVTalkTest, DeltaCarriesChangedFields) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+  ASSERT_TRUE(sent.empty());
+
+  fill(single, 0, 0x10);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  setField(single, 2, 0x12345678);
+  setField(single, 9, 0x9ABCDEF0);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(3U, packets.size());
+
+  // The first update goes whole, as the peer has nothing to apply a delta to
+  EXPECT_EQ(TYPE_OBJ, packets[0][1]);
+  EXPECT_EQ((size_t) (HEADER_LENGTH + SINGLE_SIZE + 1), packets[0].size());
+
+  std::vector<uint8_t> &p = packets[1];
+  EXPECT_EQ(TYPE_OBJ_DELTA, p[1]);
+  ASSERT_EQ((size_t) (HEADER_LENGTH + 2 + 8 + 1), p.size());
+  EXPECT_EQ(0x04, p[HEADER_LENGTH]);
+  EXPECT_EQ(0x02, p[HEADER_LENGTH + 1]);
+  uint32_t vals[2];
+  memcpy(vals, &p[HEADER_LENGTH + 2], 8);
+  EXPECT_EQ(0x12345678u, vals[0]);
+  EXPECT_EQ(0x9ABCDEF0u, vals[1]);
+  EXPECT_EQ(p.back(), PIOS_CRC_updateCRC(0, &p[0], p.size() - 1));
+
+  // Nothing changed, so only the empty bitmap goes
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[2][1]);
+  EXPECT_EQ((size_t) (HEADER_LENGTH + 2 + 1), packets[2].size());
+
+  UAVTalkStats stats;
+  UAVTalkGetStats(con, &stats);
+  EXPECT_EQ(3U, stats.txObjects);
+  EXPECT_EQ(sent.size(), stats.txBytes);
+};
+
+TEST_F(UAVTalkTest, DeltaRefreshesPeriodically) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  for (int i = 0; i < 12; i++) {
+    setField(single, 0, i);
+    UAVTalkSendObject(con, single, 0, 0, 0);
+  }
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(12U, packets.size());
+  for (int i = 0; i < 12; i++)
+    EXPECT_EQ((i % 11) ? TYPE_OBJ_DELTA : TYPE_OBJ, packets[i][1]) << "packet " << i;
+};
+
+TEST_F(UAVTalkTest, DeltaNotUsedWhenNoSmaller) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  // Every field changing makes the delta bigger than the object
+  for (int i = 0; i < 3; i++) {
+    fill(single, 0, 0x30 + i);
+    UAVTalkSendObject(con, single, 0, 0, 0);
+  }
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(3U, packets.size());
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(TYPE_OBJ, packets[i][1]);
+    EXPECT_EQ(0x30 + i, packets[i][HEADER_LENGTH]);
+  }
+};
+
+TEST_F(UAVTalkTest, DisableDeltas) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  UAVTalkDisableDeltas(con);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  // And when they are offered again the first update goes whole
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(4U, packets.size());
+  EXPECT_EQ(TYPE_OBJ, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[1][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[2][1]);
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[3][1]);
+};
+
+TEST_F(UAVTalkTest, DeltaApplied) {
+  fill(single, 0, 0x55);
+
+  std::vector<uint8_t> payload;
+  payload.push_back(0x01);
+  payload.push_back(0x02);
+  put32(payload, 0x11223344);
+  put32(payload, 0x55667788);
+  receive(makePacket(TYPE_OBJ_DELTA, SINGLE_ID, payload));
+
+  EXPECT_EQ(0x11223344u, getField(single, 0));
+  EXPECT_EQ(0x55667788u, getField(single, 9));
+  for (int i = 1; i < 9; i++)
+    EXPECT_EQ(0x55555555u, getField(single, i));
+};
+
+TEST_F(UAVTalkTest, DeltaAppliedToInstance) {
+  for (int i = 0; i < 3; i++)
+    fill(multi, i, 0x40);
+
+  std::vector<uint8_t> payload;
+  put16(payload, 2);
+  payload.push_back(0x01);
+  put32(payload, 0x01020304);
+  std::vector<uint8_t> packet = makePacket(TYPE_OBJ_DELTA, MULTI_ID, payload);
+  receive(packet);
+
+  uint8_t data[MULTI_SIZE];
+  UAVObjGetInstanceData(multi, 2, data);
+  EXPECT_EQ(0x04, data[0]);
+  EXPECT_EQ(0x40, data[4]);
+  EXPECT_EQ(0x40, firstByte(multi, 1));
+};
+
+TEST_F(UAVTalkTest, MalformedDeltaRejected) {
+  fill(single, 0, 0x55);
+
+  // One field flagged but two sent
+  std::vector<uint8_t> payload;
+  payload.push_back(0x01);
+  payload.push_back(0x00);
+  put32(payload, 0x11223344);
+  put32(payload, 0x55667788);
+  receive(makePacket(TYPE_OBJ_DELTA, SINGLE_ID, payload));
+
+  // Two fields flagged but one sent
+  payload.resize(6);
+  payload[0] = 0x03;
+  receive(makePacket(TYPE_OBJ_DELTA, SINGLE_ID, payload));
+
+  EXPECT_EQ(0x55555555u, getField(single, 0));
+};
+
+TEST_F(UAVTalkTest, BatchedDelta) {
+  receive(makePacket(TYPE_OBJ_BATCH, 0, std::vector<uint8_t>()));
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  fill(single, 0, 0x21);
+  UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkFlushBatch(con);
+  std::vector<uint8_t> full = sent;
+  sent.clear();
+
+  setField(single, 3, 0xCAFEF00D);
+  UAVTalkSendObjectBatched(con, single, 0);
+  UAVTalkFlushBatch(con);
+  std::vector<uint8_t> delta = sent;
+
+  ASSERT_EQ((size_t) (HEADER_LENGTH + 6 + SINGLE_SIZE + 1), full.size());
+  ASSERT_EQ((size_t) (HEADER_LENGTH + 6 + 2 + 4 + 1), delta.size());
+  EXPECT_EQ(0x4000 | 6, delta[HEADER_LENGTH + 4] | (delta[HEADER_LENGTH + 5] << 8));
+  EXPECT_EQ(delta.back(), PIOS_CRC_updateCRC(0, &delta[0], delta.size() - 1));
+
+  // Played back in order they reproduce the object
+  fill(single, 0, 0);
+  receive(full);
+  receive(delta);
+  EXPECT_EQ(0xCAFEF00Du, getField(single, 3));
+  EXPECT_EQ(0x21212121u, getField(single, 4));
+};
+
+TEST_F(UAVTalkTest, RequestAnsweredWhole) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  setField(single, 1, 0x01020304);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  // The requester may hold anything, so it gets all of it
+  receive(makePacket(TYPE_OBJ_REQ, SINGLE_ID, std::vector<uint8_t>()));
+  setField(single, 1, 0x05060708);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(4U, packets.size());
+  EXPECT_EQ(TYPE_OBJ, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[1][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[2][1]);
+  EXPECT_EQ((size_t) (HEADER_LENGTH + SINGLE_SIZE + 1), packets[2].size());
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[3][1]);
+};
+
+TEST_F(UAVTalkTest, PeerWriteResetsDelta) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  fill(single, 0, 0x10);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  // The peer writes the object with its own data
+  std::vector<uint8_t> payload(SINGLE_SIZE, 0x77);
+  receive(makePacket(TYPE_OBJ, SINGLE_ID, payload));
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  // And then changes a field by delta
+  payload.clear();
+  payload.push_back(0x01);
+  payload.push_back(0x00);
+  put32(payload, 0x11223344);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  receive(makePacket(TYPE_OBJ_DELTA, SINGLE_ID, payload));
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(4U, packets.size());
+  EXPECT_EQ(TYPE_OBJ, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[1][1]);
+  EXPECT_EQ(0x77, packets[1][HEADER_LENGTH]);
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[2][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[3][1]);
+  EXPECT_EQ(0x44, packets[3][HEADER_LENGTH]);
+};
+
+TEST_F(UAVTalkTest, RepeatedProbeResetsDeltas) {
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  // A restarted peer probes again and must be sent everything
+  receive(makePacket(TYPE_OBJ_DELTA, 0, std::vector<uint8_t>()));
+  UAVTalkSendObject(con, single, 0, 0, 0);
+  UAVTalkSendObject(con, single, 0, 0, 0);
+
+  std::vector<std::vector<uint8_t> > packets = sentPackets();
+  ASSERT_EQ(4U, packets.size());
+  EXPECT_EQ(TYPE_OBJ, packets[0][1]);
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[1][1]);
+  EXPECT_EQ(TYPE_OBJ, packets[2][1]);
+  EXPECT_EQ(TYPE_OBJ_DELTA, packets[3][1]);
+};
+
+/**
+ * @}
+ * @}
+ */
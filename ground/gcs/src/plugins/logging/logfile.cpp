@@ -29,6 +29,8 @@
 #include <QDebug>
 #include <QtGlobal>
 #include <QTextStream>
+#include <QVector>
+#include <string.h>
  #include <QMessageBox>
 
 // autogenerated version info string. MUST GO BEFORE coreconstants.h INCLUDE
@@ -36,8 +38,31 @@
 
 #include <coreplugin/coreconstants.h>
 
+//! Header the firmware starts each onboard log with, in lines
+static const QByteArray LOG_HEADER("dRonin git hash:\n");
+static const int LOG_HEADER_LINES = 3;
+
+//! Divider line and schema layout of the compact onboard log format
+static const QByteArray COMPACT_DIVIDER("##compact\n");
+static const int COMPACT_VERSION = 1;
+static const int COMPACT_VERSION_COMPRESSED = 2;
+static const int COMPACT_SCHEMA_ENTRY_LEN = 7;
+static const quint8 COMPACT_FLAG_MULTI_INSTANCE = 0x01;
+static const quint8 COMPACT_FLAG_DELTA = 0x02;
+static const int COMPACT_BLOCK_HEADER_LEN = 4;
+
+//! Limits of the LZ4 block format compressed logs use
+static const int LZ4_MIN_MATCH = 4;
+static const int LZ4_RUN_MASK = 15;
+
+//! Enough of UAVTalk to rebuild object packets from compact log records
+static const quint8 UAVTALK_SYNC_VAL = 0x3C;
+static const quint8 UAVTALK_TYPE_OBJ = 0x20;
+static const int UAVTALK_HEADER_LENGTH = 8;
+
 LogFile::LogFile(QObject *parent) :
     QIODevice(parent),
+    source(&file),
     timestampBufferIdx(0)
 {
     connect(&timer, SIGNAL(timeout()), this, SLOT(timerFired()));
@@ -52,6 +77,7 @@ bool LogFile::open(OpenMode mode) {
 
     // start a timer for playback
     myTime.restart();
+    source = &file;
     if (file.isOpen()) {
         // We end up here when doing a replay, because the connection
         // manager will also try to open the QIODevice, even though we just
@@ -108,13 +134,25 @@ bool LogFile::open(OpenMode mode) {
 
         QString tmpLine=file.readLine(); //Look for the header/body separation string.
         int cnt=0;
-        while (tmpLine!="##\n" && cnt < 10 && !file.atEnd()){
+        while (tmpLine!="##\n" && tmpLine!=COMPACT_DIVIDER && cnt < 10 && !file.atEnd()){
             tmpLine=file.readLine().trimmed();
             cnt++;
         }
 
+        if (tmpLine == COMPACT_DIVIDER) {
+            // Onboard log in the compact format, which replays from
+            // a decoded copy
+            if (!decodeCompact()) {
+                QMessageBox msgBox;
+                msgBox.setText("Corrupted file.");
+                msgBox.setInformativeText("GCS cannot read the object list of this compact log.");
+                msgBox.exec();
+                file.close();
+                return false;
+            }
+        }
         //Check if we reached the end of the file before finding the separation string
-        if (cnt >=10 || file.atEnd()){
+        else if (cnt >=10 || file.atEnd()){
             QMessageBox msgBox;
             msgBox.setText("Corrupted file.");
             msgBox.setInformativeText("GCS cannot find the separation byte. GCS will attempt to play the file."); //<--TODO: add hyperlink to webpage with better description.
@@ -138,6 +176,343 @@ bool LogFile::open(OpenMode mode) {
     return true;
 }
 
+/**
+ * Reads a varint from a compact log: 7 bits at a time, least significant
+ * first, with the top bit set on all but the last byte.
+ */
+static bool readVarint(const quint8 *&pos, const quint8 *end, quint32 &value)
+{
+    value = 0;
+
+    for (int shift = 0; pos < end && shift < 35; shift += 7) {
+        quint8 byte = *pos++;
+
+        value |= (quint32) (byte & 0x7f) << shift;
+
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    return false;
+}
+
+//! CRC-8 with polynomial 0x07, as used by UAVTalk
+static quint8 updateCRC(quint8 crc, const QByteArray &data)
+{
+    for (int i = 0; i < data.size(); i++) {
+        crc ^= (quint8) data[i];
+
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x80) ? (crc << 1) ^ 0x07 : (crc << 1);
+    }
+
+    return crc;
+}
+
+//! Reads a length continued 255 at a time, as LZ4 does
+static bool readLength(const quint8 *&pos, const quint8 *end, quint32 &length)
+{
+    quint8 byte;
+
+    do {
+        if (pos >= end)
+            return false;
+
+        byte = *pos++;
+        length += byte;
+    } while (byte == 255);
+
+    return true;
+}
+
+/**
+ * Decompresses an LZ4 format block of a compressed log
+ * @return false if the block is corrupt or does not come to rawLen bytes
+ */
+static bool lz4Unblock(const quint8 *pos, const quint8 *end, int rawLen, QByteArray &out)
+{
+    const int start = out.size();
+
+    while (pos < end) {
+        const quint8 token = *pos++;
+
+        quint32 litLen = token >> 4;
+        if (litLen == LZ4_RUN_MASK && !readLength(pos, end, litLen))
+            return false;
+        if (litLen > (quint32) (end - pos) || out.size() - start + litLen > (quint32) rawLen)
+            return false;
+
+        out.append((const char *) pos, litLen);
+        pos += litLen;
+
+        // The last sequence has no match
+        if (pos == end)
+            break;
+        if (end - pos < 2)
+            return false;
+
+        const int offset = pos[0] | (pos[1] << 8);
+        pos += 2;
+        if (offset == 0 || offset > out.size() - start)
+            return false;
+
+        quint32 matchLen = token & LZ4_RUN_MASK;
+        if (matchLen == LZ4_RUN_MASK && !readLength(pos, end, matchLen))
+            return false;
+        matchLen += LZ4_MIN_MATCH;
+        if (out.size() - start + matchLen > (quint32) rawLen)
+            return false;
+
+        // Byte at a time, as the match may overlap what it produces
+        for (quint32 i = 0; i < matchLen; i++)
+            out.append(out.at(out.size() - offset));
+    }
+
+    return out.size() - start == rawLen;
+}
+
+//! One object of a compact log schema
+struct CompactSchemaEntry {
+    quint32 objId;
+    quint16 size;
+    bool multiInstance;
+    bool delta;
+};
+
+/**
+ * Checks for the text header and divider of a log started again in the
+ * same stream, as the firmware writes each time logging starts (with
+ * LogOnArm, on every arm).
+ * @return the length of the header and divider, 0 if there is none at pos,
+ * or -1 if the log restarts in another format
+ */
+static int restartLength(const quint8 *pos, const quint8 *end)
+{
+    if (end - pos < LOG_HEADER.size() || memcmp(pos, LOG_HEADER.constData(), LOG_HEADER.size()))
+        return 0;
+
+    const quint8 *next = pos;
+    for (int i = 0; i < LOG_HEADER_LINES; i++) {
+        next = (const quint8 *) memchr(next, '\n', end - next);
+        if (!next)
+            return -1;
+        next++;
+    }
+
+    if (end - next < COMPACT_DIVIDER.size() || memcmp(next, COMPACT_DIVIDER.constData(), COMPACT_DIVIDER.size()))
+        return -1;
+
+    return next + COMPACT_DIVIDER.size() - pos;
+}
+
+/**
+ * Joins the blocks of a compressed log back into the records they hold.
+ * Records do not span blocks, so a truncated or corrupt block only loses
+ * its own.  Stops before the header of a log started again in the stream.
+ */
+static QByteArray unpackBlocks(const quint8 *&pos, const quint8 *end)
+{
+    QByteArray records;
+
+    while (end - pos >= COMPACT_BLOCK_HEADER_LEN && !restartLength(pos, end)) {
+        const int rawLen = pos[0] | (pos[1] << 8);
+        const int packedLen = pos[2] | (pos[3] << 8);
+        const int dataLen = packedLen ? packedLen : rawLen;
+
+        if (end - pos - COMPACT_BLOCK_HEADER_LEN < dataLen) {
+            pos = end;
+            break;
+        }
+        pos += COMPACT_BLOCK_HEADER_LEN;
+
+        const int before = records.size();
+        if (!packedLen) {
+            records.append((const char *) pos, rawLen);
+        } else if (!lz4Unblock(pos, pos + packedLen, rawLen, records)) {
+            qDebug() << "Compressed log: bad block, stopping";
+            records.truncate(before);
+            pos = end;
+            break;
+        }
+        pos += dataLen;
+    }
+
+    return records;
+}
+
+/**
+ * Converts the records of one compact log to timestamped UAVTalk packets.
+ * With stopAtRestart the records come straight from the stream, and a
+ * restarted log's header ends them.
+ * @return false if a record is corrupt or truncated
+ */
+static bool decodeRecords(const quint8 *&pos, const quint8 *end, bool stopAtRestart,
+                          const QVector<CompactSchemaEntry> &schema,
+                          QVector<QByteArray> &history, QByteArray &out)
+{
+    const quint8 *const start = pos;
+    quint32 timeStamp = 0;
+
+    while (pos < end) {
+        if (stopAtRestart && restartLength(pos, end))
+            return true;
+
+        const quint8 idx = *pos++;
+        if (idx >= schema.size()) {
+            qDebug() << "Compact log: bad object index" << idx << "at record offset" << (pos - 1 - start);
+            return false;
+        }
+        const CompactSchemaEntry &entry = schema[idx];
+
+        quint32 delta, instId = 0;
+        if (!readVarint(pos, end, delta))
+            return false;
+        if (entry.multiInstance && !readVarint(pos, end, instId))
+            return false;
+
+        const quint8 *data = pos;
+        if (entry.delta) {
+            // A mask of the bytes that changed, then those bytes XORed
+            QByteArray &prev = history[idx];
+            const quint8 *mask = pos;
+            pos += (entry.size + 7) / 8;
+            if (pos > end)
+                return false;
+
+            for (int i = 0; i < entry.size; i++) {
+                if (!(mask[i / 8] & (1 << (i % 8))))
+                    continue;
+                if (pos >= end)
+                    return false;
+                prev[i] = (char) (prev.at(i) ^ *pos++);
+            }
+
+            data = (const quint8 *) prev.constData();
+        } else {
+            if (end - pos < entry.size)
+                return false;
+            pos += entry.size;
+        }
+
+        timeStamp += delta;
+
+        const quint16 length = UAVTALK_HEADER_LENGTH + (entry.multiInstance ? 2 : 0) + entry.size;
+
+        QByteArray packet;
+        packet.reserve(length + 1);
+        packet.append((char) UAVTALK_SYNC_VAL);
+        packet.append((char) UAVTALK_TYPE_OBJ);
+        packet.append((char) (length & 0xff));
+        packet.append((char) (length >> 8));
+        for (int i = 0; i < 32; i += 8)
+            packet.append((char) (entry.objId >> i));
+        if (entry.multiInstance) {
+            packet.append((char) (instId & 0xff));
+            packet.append((char) ((instId >> 8) & 0xff));
+        }
+        packet.append((const char *) data, entry.size);
+        packet.append((char) updateCRC(0, packet));
+
+        // Same framing writeData() uses for GCS logs
+        qint64 dataSize = packet.size();
+        out.append((const char *) &timeStamp, sizeof(timeStamp));
+        out.append((const char *) &dataSize, sizeof(dataSize));
+        out.append(packet);
+    }
+
+    return true;
+}
+
+/**
+ * Converts one compact log, from its schema up to the end of the stream or
+ * the header of a log started again after it.  The schema gives the ID and
+ * size of every object in the log, so records of objects this GCS does not
+ * know can still be stepped over; UAVTalk then drops them by ID.
+ * Compressed logs are unpacked into records first, and delta coded samples
+ * applied to the previous sample of their object.
+ * @return false if the schema cannot be read
+ */
+static bool decodeCompactLog(const quint8 *&pos, const quint8 *end, QByteArray &out)
+{
+    if (end - pos < 2 || (pos[0] != COMPACT_VERSION && pos[0] != COMPACT_VERSION_COMPRESSED))
+        return false;
+
+    const bool compressed = pos[0] == COMPACT_VERSION_COMPRESSED;
+    const int count = pos[1];
+    pos += 2;
+
+    if (end - pos < count * COMPACT_SCHEMA_ENTRY_LEN)
+        return false;
+
+    QVector<CompactSchemaEntry> schema(count);
+    for (int i = 0; i < count; i++) {
+        schema[i].objId = pos[0] | (pos[1] << 8) | (pos[2] << 16) | ((quint32) pos[3] << 24);
+        schema[i].size = pos[4] | (pos[5] << 8);
+        schema[i].multiInstance = pos[6] & COMPACT_FLAG_MULTI_INSTANCE;
+        schema[i].delta = compressed && (pos[6] & COMPACT_FLAG_DELTA);
+        pos += COMPACT_SCHEMA_ENTRY_LEN;
+    }
+
+    // Previous samples of delta coded objects, which start out as zeroes
+    QVector<QByteArray> history(count);
+    for (int i = 0; i < count; i++) {
+        if (schema[i].delta)
+            history[i].fill(0, schema[i].size);
+    }
+
+    if (!compressed) {
+        if (!decodeRecords(pos, end, true, schema, history, out))
+            pos = end;
+        return true;
+    }
+
+    const QByteArray records = unpackBlocks(pos, end);
+    const quint8 *recordPos = (const quint8 *) records.constData();
+    decodeRecords(recordPos, recordPos + records.size(), false, schema, history, out);
+
+    return true;
+}
+
+/**
+ * Converts the compact onboard log following the divider into the
+ * timestamped UAVTalk stream that the replay code reads.  Each time
+ * logging started again in the stream the header and schema are repeated;
+ * the timestamps and previous samples start over from there.
+ * @return false if the first schema cannot be read
+ */
+bool LogFile::decodeCompact()
+{
+    const QByteArray in = file.readAll();
+    const quint8 *pos = (const quint8 *) in.constData();
+    const quint8 *end = pos + in.size();
+
+    QByteArray out;
+
+    if (!decodeCompactLog(pos, end, out))
+        return false;
+
+    while (pos < end) {
+        // Anything else left is a truncated block
+        const int headerLen = restartLength(pos, end);
+        if (headerLen < 0)
+            qDebug() << "Compact log: log restarts in another format, stopping";
+        if (headerLen <= 0)
+            break;
+
+        pos += headerLen;
+        if (!decodeCompactLog(pos, end, out)) {
+            qDebug() << "Compact log: cannot read the schema of a restarted log, stopping";
+            break;
+        }
+    }
+
+    decoded.setData(out);
+    decoded.open(QIODevice::ReadOnly);
+    source = &decoded;
+
+    return true;
+}
+
 void LogFile::close()
 {
     emit aboutToClose();
@@ -145,6 +520,9 @@ void LogFile::close()
     if (timer.isActive())
         timer.stop();
     file.close();
+    decoded.close();
+    decoded.setData(QByteArray());
+    source = &file;
     QIODevice::close();
 }
 
@@ -181,7 +559,7 @@ void LogFile::timerFired()
 {
     qint64 dataSize;
 
-    if(file.bytesAvailable() > 4)
+    if(source->bytesAvailable() > 4)
     {
 
         int time;
@@ -191,31 +569,31 @@ void LogFile::timerFired()
         while ((lastPlayTime + ((time - lastPlayTimeOffset)* playbackSpeed) > (lastTimeStamp-firstTimestamp)))
         {
             lastPlayTime += ((time - lastPlayTimeOffset)* playbackSpeed);
-            if(file.bytesAvailable() < 4) {
+            if(source->bytesAvailable() < 4) {
                 stopReplay();
                 return;
             }
 
-            file.seek(lastTimeStampPos+sizeof(lastTimeStamp));
+            source->seek(lastTimeStampPos+sizeof(lastTimeStamp));
 
-            file.read((char *) &dataSize, sizeof(dataSize));
+            source->read((char *) &dataSize, sizeof(dataSize));
 
             if (dataSize<1 || dataSize>(1024*1024)) {
                 qDebug() << "Error: Logfile corrupted! Unlikely packet size: " << dataSize << "\n";
                 stopReplay();
                 return;
             }
-            if(file.bytesAvailable() < dataSize) {
+            if(source->bytesAvailable() < dataSize) {
                 stopReplay();
                 return;
             }
 
             mutex.lock();
-            dataBuffer.append(file.read(dataSize));
+            dataBuffer.append(source->read(dataSize));
             mutex.unlock();
             emit readyRead();
 
-            if(file.bytesAvailable() < 4) {
+            if(source->bytesAvailable() < 4) {
                 stopReplay();
                 return;
             }
@@ -244,25 +622,25 @@ bool LogFile::startReplay() {
     //Read all log timestamps into array
     timestampBuffer.clear(); //Save beginning of log for later use
     timestampPos.clear();
-    quint64 logFileStartIdx = file.pos();
+    quint64 logFileStartIdx = source->pos();
     timestampBufferIdx = 0;
     lastTimeStamp = 0;
 
-    while (!file.atEnd()){
+    while (!source->atEnd()){
         qint64 dataSize;
 
         //Get time stamp position
-        timestampPos.append(file.pos());
+        timestampPos.append(source->pos());
 
         //Read timestamp and logfile packet size
-        file.read((char *) &lastTimeStamp, sizeof(lastTimeStamp));
-        file.read((char *) &dataSize, sizeof(dataSize));
+        source->read((char *) &lastTimeStamp, sizeof(lastTimeStamp));
+        source->read((char *) &dataSize, sizeof(dataSize));
 
         //Check if dataSize sync bytes are correct.
         //TODO: LIKELY AS NOT, THIS WILL FAIL TO RESYNC BECAUSE THERE IS TOO LITTLE INFORMATION IN THE STRING OF SIX 0x00
         if ((dataSize & 0xFFFFFFFFFFFF0000)!=0){
-            qDebug() << "Wrong sync byte. At file location 0x"  << QString("%1").arg(file.pos(),0,16) << "Got 0x" << QString("%1").arg(dataSize & 0xFFFFFFFFFFFF0000,0,16) << ", but expected 0x""00"".";
-            file.seek(timestampPos.last()+1);
+            qDebug() << "Wrong sync byte. At file location 0x"  << QString("%1").arg(source->pos(),0,16) << "Got 0x" << QString("%1").arg(dataSize & 0xFFFFFFFFFFFF0000,0,16) << ", but expected 0x""00"".";
+            source->seek(timestampPos.last()+1);
             timestampPos.pop_back();
             continue;
         }
@@ -279,7 +657,7 @@ bool LogFile::startReplay() {
 
         timestampBuffer.append(lastTimeStamp);
 
-        file.seek(timestampPos.last()+sizeof(lastTimeStamp)+sizeof(dataSize)+dataSize);
+        source->seek(timestampPos.last()+sizeof(lastTimeStamp)+sizeof(dataSize)+dataSize);
     }
 
     //Check if any timestamps were successfully read
@@ -294,7 +672,7 @@ bool LogFile::startReplay() {
     }
 
     //Reset to log beginning.
-    file.seek(logFileStartIdx+sizeof(lastTimeStamp));
+    source->seek(logFileStartIdx+sizeof(lastTimeStamp));
     lastTimeStampPos = timestampPos[0];
     lastTimeStamp = timestampBuffer[0];
     firstTimestamp = timestampBuffer[0];
@@ -72,6 +72,8 @@ protected:
     QTimer timer;
     QTime myTime;
     QFile file;
+    QBuffer decoded;
+    QIODevice *source;
     quint32 lastTimeStamp;
     quint32 lastPlayTime;
     QMutex mutex;
@@ -81,6 +83,8 @@ protected:
     double playbackSpeed;
 
 private:
+    bool decodeCompact();
+
     QList<quint32> timestampBuffer;
     QList<quint32> timestampPos;
     quint32 timestampBufferIdx;
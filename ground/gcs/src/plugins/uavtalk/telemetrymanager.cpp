@@ -91,6 +91,9 @@ void TelemetryManager::onStop()
 void TelemetryManager::onConnect()
 {
     autopilotConnected = true;
+    // Let the autopilot pack its telemetry into batch frames and deltas
+    utalk->sendBatchProbe();
+    utalk->sendDeltaProbe();
     emit connected();
 }
 
@@ -127,13 +127,11 @@ UAVTalk::ComStats UAVTalk::getStats()
  */
 void UAVTalk::processInputStream()
 {
-    quint8 tmp;
-
     if (io && io->isReadable()) {
         while (io->bytesAvailable() > 0)
         {
-            io->read((char*)&tmp, 1);
-            processInputByte(tmp);
+            QByteArray data = io->readAll();
+            processInputBlock((const quint8 *)data.constData(), data.size());
         }
     }
 }
@@ -161,6 +159,65 @@ bool UAVTalk::sendObjectRequest(UAVObject* obj, bool allInstances)
     return objectTransaction(obj, TYPE_OBJ_REQ, allInstances);
 }
 
+/**
+ * Tell the autopilot that we understand batch frames by sending an empty
+ * one.  Firmware that knows them starts packing its unacked updates into
+ * batches, older firmware ignores the packet.
+ * \return Success (true), Failure (false)
+ */
+bool UAVTalk::sendBatchProbe()
+{
+    return sendProbe(TYPE_OBJ_BATCH);
+}
+
+/**
+ * Tell the autopilot that we understand deltas by sending an empty one for
+ * object ID 0.  Firmware that knows them starts sending just the changed
+ * fields of larger objects, older firmware ignores the packet.
+ * \return Success (true), Failure (false)
+ */
+bool UAVTalk::sendDeltaProbe()
+{
+    return sendProbe(TYPE_OBJ_DELTA);
+}
+
+/**
+ * Send an empty packet of the given type for object ID 0.
+ * \param[in] type Packet type
+ * \return Success (true), Failure (false)
+ */
+bool UAVTalk::sendProbe(quint8 type)
+{
+    int dataOffset = 8;
+
+    txBuffer[0] = SYNC_VAL;
+    txBuffer[1] = type;
+    qToLittleEndian<quint16>(dataOffset, &txBuffer[2]);
+    qToLittleEndian<quint32>(0, &txBuffer[4]);
+
+    // Calculate checksum
+    txBuffer[dataOffset] = updateCRC(0, txBuffer, dataOffset);
+
+    if (io && io->isWritable() && io->bytesToWrite() < TX_BUFFER_SIZE )
+    {
+        io->write((const char*)txBuffer, dataOffset+CHECKSUM_LENGTH);
+        if(useUDPMirror)
+        {
+            udpSocketRx->writeDatagram((const char*)txBuffer,dataOffset+CHECKSUM_LENGTH,QHostAddress::LocalHost,udpSocketTx->localPort());
+        }
+    }
+    else
+    {
+        ++stats.txErrors;
+        return false;
+    }
+
+    // Update stats
+    stats.txBytes += dataOffset+CHECKSUM_LENGTH;
+
+    return true;
+}
+
 /**
  * Send the specified object through the telemetry link.
  * \param[in] obj Object to send
@@ -201,6 +258,57 @@ bool UAVTalk::objectTransaction(UAVObject* obj, quint8 type, bool allInstances)
     }
 }
 
+/**
+ * Process a block of bytes from the telemetry stream. Noise between packets
+ * and object payloads are taken in one piece, the rest of each packet goes
+ * through processInputByte().
+ * \param[in] data Received bytes
+ * \param[in] length Number of bytes in data
+ */
+void UAVTalk::processInputBlock(const quint8 *data, qint64 length)
+{
+    while (length > 0)
+    {
+        qint64 count = 0;
+
+        if (rxState == STATE_SYNC)
+        {
+            const quint8 *sync = (const quint8 *)memchr(data, SYNC_VAL, length);
+            count = sync ? (sync - data) : length;
+        }
+        else if (rxState == STATE_DATA)
+        {
+            count = qMin<qint64>(rxLength - rxCount, length);
+            memcpy(&rxBuffer[rxCount], data, count);
+            rxCount += count;
+
+            if (rxCount >= rxLength)
+            {
+                rxCS = updateCRC(rxCS, rxBuffer, rxLength);
+                rxState = STATE_CS;
+                rxCount = 0;
+            }
+        }
+
+        if (count == 0)
+        {
+            processInputByte(*data);
+            count = 1;
+        }
+        else
+        {
+            stats.rxBytes += count;
+            rxPacketLength += count;
+
+            if(useUDPMirror)
+                rxDataArray.append((const char *)data, count);
+        }
+
+        data += count;
+        length -= count;
+    }
+}
+
 /**
  * Process a byte from the telemetry stream.
  * \param[in] rxbyte Received byte
@@ -304,6 +412,16 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
 
             // Search for object, if not found reset state machine
             rxObjId = (qint32)qFromLittleEndian<quint32>(rxTmpBuffer);
+            if (rxType == TYPE_OBJ_BATCH)
+            {
+                // The records carry their own headers, the rest of the packet is payload
+                rxLength = packetSize - rxPacketLength;
+                rxInstId = 0;
+                rxCount = 0;
+                rxState = (rxLength > 0) ? STATE_DATA : STATE_CS;
+                UAVTALK_QXTLOG_DEBUG("UAVTalk: ObjID->Data (batch)");
+                break;
+            }
             {
                 UAVObject *rxObj = objMngr->getObject(rxObjId);
                 if (rxObj == NULL && rxType != TYPE_OBJ_REQ)
@@ -329,6 +447,12 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
                 {
                     rxLength = 0;
                 }
+                else if (rxType == TYPE_OBJ_DELTA)
+                {
+                    // Only the changed fields follow, so the packet gives the length
+                    qint32 deltaLength = packetSize - rxPacketLength - (rxObj->isSingleInstance() ? 0 : 2);
+                    rxLength = (deltaLength > 0) ? deltaLength : MAX_PAYLOAD_LENGTH;
+                }
                 else
                 {
                     rxLength = rxObj->getNumBytes();
@@ -409,9 +533,6 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
 
         case STATE_DATA:
 
-            // Update CRC
-            rxCS = updateCRC(rxCS, rxbyte);
-
             rxBuffer[rxCount++] = rxbyte;
             if (rxCount < rxLength)
             {
@@ -419,6 +540,9 @@ bool UAVTalk::processInputByte(quint8 rxbyte)
                 break;
             }
 
+            // Update CRC over the whole payload
+            rxCS = updateCRC(rxCS, rxBuffer, rxLength);
+
             rxState = STATE_CS;
             UAVTALK_QXTLOG_DEBUG("UAVTalk: Data->CSum");
             rxCount = 0;
@@ -569,6 +693,24 @@ bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8*
             }
         }
         break;
+    case TYPE_OBJ_BATCH: // We have received several objects in one packet
+        error = !receiveBatch(data, length);
+        break;
+    case TYPE_OBJ_DELTA: // We have received the changed fields of an object
+        if (!allInstances)
+        {
+            obj = updateObjectDelta(objId, instId, data, length);
+            if (obj == NULL)
+            {
+                UAVTALK_QXTLOG_DEBUG(QString("[uavtalk.cpp  ] Could not apply a delta for OBJID:%0 INSTID:%1").arg(QString(QString("0x") + QString::number(objId, 16).toUpper())).arg(instId));
+                error = true;
+            }
+        }
+        else
+        {
+            error = true;
+        }
+        break;
     case TYPE_ACK: // We have received a ACK, supposedly after sending an object with OBJ_ACK
         // All instances, not allowed for ACK messages
         if (!allInstances)
@@ -596,6 +738,76 @@ bool UAVTalk::receiveObject(quint8 type, quint32 objId, quint16 instId, quint8*
     return !error;
 }
 
+/**
+ * Unpack every record of a batch frame.  Records for objects we don't know
+ * are skipped using their length word.
+ * \param[in] data Batch payload
+ * \param[in] length Payload length
+ * \return Success (true), Failure (false) if any record could not be applied
+ */
+bool UAVTalk::receiveBatch(quint8* data, qint32 length)
+{
+    quint8* end = data + length;
+    bool error = false;
+
+    while (data < end)
+    {
+        if (end - data < BATCH_RECORD_LENGTH)
+        {
+            return false;
+        }
+
+        quint32 objId = qFromLittleEndian<quint32>(data);
+        quint16 lengthWord = qFromLittleEndian<quint16>(data + 4);
+        quint16 dataLength = lengthWord & BATCH_LENGTH_MASK;
+        bool hasInstId = (lengthWord & BATCH_INSTID) != 0;
+        bool isDelta = (lengthWord & BATCH_DELTA) != 0;
+        quint16 instId = 0;
+
+        data += BATCH_RECORD_LENGTH;
+
+        if (hasInstId)
+        {
+            if (end - data < 2)
+            {
+                return false;
+            }
+            instId = qFromLittleEndian<quint16>(data);
+            data += 2;
+        }
+
+        if (end - data < dataLength)
+        {
+            return false;
+        }
+
+        UAVObject* obj = objMngr->getObject(objId);
+        bool applied = false;
+        if (obj != NULL && hasInstId != obj->isSingleInstance() && instId != ALL_INSTANCES)
+        {
+            if (isDelta)
+            {
+                applied = (updateObjectDelta(objId, instId, data, dataLength) != NULL);
+            }
+            else if (obj->getNumBytes() == dataLength)
+            {
+                updateObject(objId, instId, data);
+                applied = true;
+            }
+        }
+
+        if (!applied)
+        {
+            UAVTALK_QXTLOG_DEBUG(QString("[uavtalk.cpp  ] Skipped a batched update for OBJID:%0 INSTID:%1").arg(QString(QString("0x") + QString::number(objId, 16).toUpper())).arg(instId));
+            error = true;
+        }
+
+        data += dataLength;
+    }
+
+    return !error;
+}
+
 /**
  * Update the data of an object from a byte array (unpack).
  * If the object instance could not be found in the list, then a
@@ -637,6 +849,62 @@ UAVObject* UAVTalk::updateObject(quint32 objId, quint16 instId, quint8* data)
     }
 }
 
+/**
+ * Update an existing object instance from a delta: a bitmap of the fields
+ * that changed (LSB of the first byte is the first field) followed by
+ * just those fields, in order.
+ * \param[in] objId Object ID
+ * \param[in] instId Instance ID
+ * \param[in] data Delta payload
+ * \param[in] length Payload length
+ * \return The updated object, NULL if the delta could not be applied
+ */
+UAVObject* UAVTalk::updateObjectDelta(quint32 objId, quint16 instId, const quint8* data, qint32 length)
+{
+    // A delta is relative to data we already have
+    UAVObject* obj = objMngr->getObject(objId, instId);
+    if (obj == NULL)
+    {
+        return NULL;
+    }
+
+    QList<UAVObjectField*> fields = obj->getFields();
+    qint32 maskLength = (fields.length() + 7) / 8;
+    if (length < maskLength)
+    {
+        return NULL;
+    }
+
+    QByteArray buf(obj->getNumBytes(), 0);
+    obj->pack((quint8*)buf.data());
+
+    const quint8* src = data + maskLength;
+    const quint8* end = data + length;
+    quint32 offset = 0;
+    for (int n = 0; n < fields.length(); ++n)
+    {
+        quint32 size = fields[n]->getNumBytes();
+        if (data[n / 8] & (1 << (n % 8)))
+        {
+            if ((quint32)(end - src) < size)
+            {
+                return NULL;
+            }
+            memcpy(buf.data() + offset, src, size);
+            src += size;
+        }
+        offset += size;
+    }
+
+    if (src != end)
+    {
+        return NULL;
+    }
+
+    obj->unpack((const quint8*)buf.constData());
+    return obj;
+}
+
 
 /**
  * Send an object through the telemetry link.
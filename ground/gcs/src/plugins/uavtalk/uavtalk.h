@@ -64,10 +64,13 @@ public:
     ~UAVTalk();
     bool sendObject(UAVObject* obj, bool acked, bool allInstances);
     bool sendObjectRequest(UAVObject* obj, bool allInstances);
+    bool sendBatchProbe();
+    bool sendDeltaProbe();
     ComStats getStats();
     void resetStats();
 
     bool processInputByte(quint8 rxbyte);
+    void processInputBlock(const quint8 *data, qint64 length);
 
 signals:
     // The only signals we send to the upper level are when we
@@ -89,6 +92,14 @@ protected:
     static const int TYPE_OBJ_ACK = (TYPE_VER | 0x02);
     static const int TYPE_ACK = (TYPE_VER | 0x03);
     static const int TYPE_NACK = (TYPE_VER | 0x04);
+    static const int TYPE_OBJ_BATCH = (TYPE_VER | 0x05);
+    static const int TYPE_OBJ_DELTA = (TYPE_VER | 0x06);
+
+    // Batch records: object ID(4), length word(2), instance ID(2, only if flagged), data
+    static const int BATCH_RECORD_LENGTH = 6;
+    static const quint16 BATCH_INSTID = 0x8000;
+    static const quint16 BATCH_DELTA = 0x4000;
+    static const quint16 BATCH_LENGTH_MASK = 0x3FFF;
 
     static const int MIN_HEADER_LENGTH = 8; // sync(1), type (1), size(2), object ID(4)
     static const int MAX_HEADER_LENGTH = 10; // sync(1), type (1), size(2), object ID (4), instance ID(2, not used in single objects)
@@ -135,7 +146,10 @@ protected:
     // Methods
     bool objectTransaction(UAVObject* obj, quint8 type, bool allInstances);
     virtual bool receiveObject(quint8 type, quint32 objId, quint16 instId, quint8* data, qint32 length);
+    bool receiveBatch(quint8* data, qint32 length);
     UAVObject* updateObject(quint32 objId, quint16 instId, quint8* data);
+    UAVObject* updateObjectDelta(quint32 objId, quint16 instId, const quint8* data, qint32 length);
+    bool sendProbe(quint8 type);
     bool transmitNack(quint32 objId);
     bool transmitObject(UAVObject* obj, quint8 type, bool allInstances);
     bool transmitSingleObject(UAVObject* obj, quint8 type, bool allInstances);
@@ -31,14 +31,132 @@
 
 #include "uavobjectgeneratorflight.h"
 
+#include <algorithm>
+#include <vector>
+
 using namespace std;
 
+/**
+ * Perfect hash over the data object IDs, consumed by uavobjectmanager.c
+ * through the generated uavobjectshash.h.
+ */
+struct UAVOPerfectHash {
+    int hashBits;
+    int bucketBits;
+    quint32 mult1;
+    quint32 mult2;
+    vector<quint16> disp;
+    vector<quint32> ids;
+};
+
+/**
+ * Build a "hash and displace" perfect hash for the given (even, unique) IDs.
+ * Buckets are placed largest first; each bucket gets the smallest XOR
+ * displacement that moves all of its keys into free slots.  Multipliers are
+ * drawn from a fixed seed so the output is stable between runs.
+ */
+static bool buildPerfectHash(const vector<quint32> &keys, UAVOPerfectHash &out)
+{
+    quint32 seed = 0x2545F491;
+    int bits = 1;
+
+    while ((1u << bits) < keys.size())
+        bits++;
+
+    for (; bits <= 12; bits++) {
+        const quint32 size = 1u << bits;
+        const int bucketBits = max(bits - 1, 1);
+        const quint32 numBuckets = 1u << bucketBits;
+
+        for (int attempt = 0; attempt < 2000; attempt++) {
+            seed = seed * 1664525 + 1013904223;
+            quint32 mult1 = seed | 1;
+            seed = seed * 1664525 + 1013904223;
+            quint32 mult2 = seed | 1;
+
+            vector<vector<quint32> > buckets(numBuckets);
+            for (size_t i = 0; i < keys.size(); i++)
+                buckets[(keys[i] * mult1) >> (32 - bucketBits)].push_back(keys[i]);
+
+            vector<quint32> order;
+            for (quint32 b = 0; b < numBuckets; b++)
+                order.push_back(b);
+            stable_sort(order.begin(), order.end(),
+                    [&buckets](quint32 a, quint32 b) {
+                        return buckets[a].size() > buckets[b].size();
+                    });
+
+            vector<quint16> disp(numBuckets, 0);
+            vector<quint32> ids(size, 0);
+            vector<bool> used(size, false);
+            bool ok = true;
+
+            for (size_t i = 0; ok && i < order.size(); i++) {
+                const vector<quint32> &bucket = buckets[order[i]];
+                if (bucket.empty())
+                    break;
+
+                bool placed = false;
+                for (quint32 d = 0; !placed && d < size; d++) {
+                    vector<quint32> slots;
+                    placed = true;
+                    for (size_t k = 0; k < bucket.size(); k++) {
+                        quint32 slot = ((bucket[k] * mult2) >> (32 - bits)) ^ d;
+                        if (used[slot] || find(slots.begin(), slots.end(), slot) != slots.end()) {
+                            placed = false;
+                            break;
+                        }
+                        slots.push_back(slot);
+                    }
+                    if (placed) {
+                        disp[order[i]] = d;
+                        for (size_t k = 0; k < bucket.size(); k++) {
+                            used[slots[k]] = true;
+                            ids[slots[k]] = bucket[k];
+                        }
+                    }
+                }
+                ok = placed;
+            }
+
+            if (ok) {
+                out.hashBits = bits;
+                out.bucketBits = bucketBits;
+                out.mult1 = mult1;
+                out.mult2 = mult2;
+                out.disp = disp;
+                out.ids = ids;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Format a table of integers as C initializer lines, several per line.
+ */
+template <typename T>
+static QString formatTable(const vector<T> &values, int width, int perLine)
+{
+    QString table;
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i % perLine == 0)
+            table.append("\t");
+        table.append(QString("0x%1,").arg(values[i], width, 16, QChar('0')));
+        table.append(((i % perLine) == (size_t) perLine - 1 || i == values.size() - 1) ? "\r\n" : " ");
+    }
+    return table;
+}
+
 bool UAVObjectGeneratorFlight::generate(UAVObjectParser* parser,QString templatepath,QString outputpath) {
 
     fieldTypeStrC << "int8_t" << "int16_t" << "int32_t" <<"uint8_t"
             <<"uint16_t" << "uint32_t" << "float" << "uint8_t";
 
     QString flightObjInit,objInc,objFileNames,objNames;
+    QString fieldOffsets,fieldOffsetCases;
     qint32 sizeCalc;
     flightCodePath = QDir( templatepath + QString("flight/UAVObjects"));
     flightOutputPath = QDir( outputpath + QString("flight") );
@@ -49,16 +167,20 @@ bool UAVObjectGeneratorFlight::generate(UAVObjectParser* parser,QString template
     flightInitTemplate = readFile( flightCodePath.absoluteFilePath("uavobjectsinittemplate.c") );
     flightInitIncludeTemplate = readFile( flightCodePath.absoluteFilePath("inc/uavobjectsinittemplate.h") );
     flightVersionTemplate = readFile( flightCodePath.absoluteFilePath("inc/uavoversiontemplate.h") );
+    flightHashTemplate = readFile( flightCodePath.absoluteFilePath("inc/uavobjectshashtemplate.h") );
 
-    if ( flightCodeTemplate.isNull() || flightIncludeTemplate.isNull() || flightInitTemplate.isNull()) {
+    if ( flightCodeTemplate.isNull() || flightIncludeTemplate.isNull() || flightInitTemplate.isNull() ||
+            flightHashTemplate.isNull()) {
             cerr << "Error: Could not open flight template files." << endl;
             return false;
         }
 
     sizeCalc = 0;
+    vector<quint32> objIds;
     for (int objidx = 0; objidx < parser->getNumObjects(); ++objidx) {
         ObjectInfo* info=parser->getObjectByIndex(objidx);
         process_object(info);
+        objIds.push_back(info->id);
         flightObjInit.append("    " + info->name + "Initialize();\r\n");
         objInc.append("#include \"" + info->namelc + ".h\"\r\n");
 	objFileNames.append(" " + info->namelc);
@@ -66,11 +188,26 @@ bool UAVObjectGeneratorFlight::generate(UAVObjectParser* parser,QString template
 	if (parser->getNumBytes(objidx)>sizeCalc) {
 		sizeCalc = parser->getNumBytes(objidx);
 	}
+
+        // Field boundaries, so UAVTalk can send just the fields that changed
+        if (info->fields.length() > 1 && info->fields.length() <= 255) {
+            int offset = 0;
+            fieldOffsets.append(QString("static const uint16_t %1_field_offsets[] = {").arg(info->namelc));
+            for (int n = 0; n < info->fields.length(); ++n) {
+                fieldOffsets.append(QString(" %1,").arg(offset));
+                offset += info->fields[n]->numBytes * info->fields[n]->numElements;
+            }
+            fieldOffsets.append(QString(" %1 };\r\n").arg(offset));
+            fieldOffsetCases.append(QString("\tcase %1_OBJID:\r\n\t\t*numFields = %2;\r\n\t\treturn %3_field_offsets;\r\n")
+                                    .arg(info->name.toUpper()).arg(info->fields.length()).arg(info->namelc));
+        }
     }
 
     // Write the flight object inialization files
     flightInitTemplate.replace( QString("$(OBJINC)"), objInc);
     flightInitTemplate.replace( QString("$(OBJINIT)"), flightObjInit);
+    flightInitTemplate.replace( QString("$(FIELDOFFSETS)"), fieldOffsets);
+    flightInitTemplate.replace( QString("$(FIELDOFFSETCASES)"), fieldOffsetCases);
     bool res = writeFileIfDiffrent( flightOutputPath.absolutePath() + "/uavobjectsinit.c",
                      flightInitTemplate );
     if (!res) {
@@ -97,6 +234,25 @@ bool UAVObjectGeneratorFlight::generate(UAVObjectParser* parser,QString template
         return false;
     }
 
+    // Write the object ID perfect hash used by UAVObjGetByID
+    UAVOPerfectHash hash;
+    if (!buildPerfectHash(objIds, hash)) {
+        cerr << "Error: Could not build a perfect hash of the object IDs" << endl;
+        return false;
+    }
+    flightHashTemplate.replace( QString("$(HASHBITS)"), QString().setNum(hash.hashBits));
+    flightHashTemplate.replace( QString("$(BUCKETBITS)"), QString().setNum(hash.bucketBits));
+    flightHashTemplate.replace( QString("$(MULT1)"), QString("0x%1u").arg(hash.mult1, 8, 16, QChar('0')));
+    flightHashTemplate.replace( QString("$(MULT2)"), QString("0x%1u").arg(hash.mult2, 8, 16, QChar('0')));
+    flightHashTemplate.replace( QString("$(DISPTABLE)"), formatTable(hash.disp, 4, 8));
+    flightHashTemplate.replace( QString("$(IDTABLE)"), formatTable(hash.ids, 8, 6));
+    res = writeFileIfDiffrent( flightOutputPath.absolutePath() + "/uavobjectshash.h",
+                     flightHashTemplate );
+    if (!res) {
+        cout << "Error: Could not write flight object hash header file" << endl;
+        return false;
+    }
+
     return true; // if we come here everything should be fine
 }
 
@@ -35,7 +35,7 @@ class UAVObjectGeneratorFlight
 public:
     bool generate(UAVObjectParser* gen,QString templatepath,QString outputpath);
     QStringList fieldTypeStrC;
-    QString flightCodeTemplate, flightIncludeTemplate, flightInitTemplate, flightInitIncludeTemplate, flightVersionTemplate;
+    QString flightCodeTemplate, flightIncludeTemplate, flightInitTemplate, flightInitIncludeTemplate, flightVersionTemplate, flightHashTemplate;
     QDir flightCodePath;
     QDir flightOutputPath;
 
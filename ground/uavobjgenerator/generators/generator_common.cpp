@@ -73,6 +73,8 @@ void replaceCommonTags(QString& out, ObjectInfo* info)
     // Replace $(ISSETTINGS) tag
     out.replace(QString("$(ISSETTINGS)"), boolTo01String( info->isSettings ));
     out.replace(QString("$(ISSETTINGSTF)"), boolToTRUEFALSEString( info->isSettings ));    
+    // Replace $(ISSEQLOCKED) tag
+    out.replace(QString("$(ISSEQLOCKED)"), boolTo01String( info->isSeqLocked ));
     // Replace $(NUMBYTES) tag
     out.replace(QString("$(NUMBYTES)"), QString().setNum(info->numBytes));
     // Replace $(GCSACCESS) tag
@@ -878,6 +878,19 @@ QString UAVObjectParser::processObjectAttributes(QDomNode& node, ObjectInfo* inf
     if ( info->isSettings && !info->isSingleInst )
         return QString("Object: Settings objects can not have multiple instances");
 
+    // Get seqlock attribute if present
+    attr = attributes.namedItem("seqlock");
+    if ( attr.isNull() || attr.nodeValue().compare(QString("false")) == 0 )
+        info->isSeqLocked = false;
+    else if ( attr.nodeValue().compare(QString("true")) == 0 )
+        info->isSeqLocked = true;
+    else
+        return QString("Object:seqlock attribute value is invalid");
+
+    // Only single instance data objects can be read through a seqlock
+    if ( info->isSeqLocked && (info->isSettings || !info->isSingleInst) )
+        return QString("Object: seqlock is only supported on single instance data objects");
+
     // Done
     return QString();
 }
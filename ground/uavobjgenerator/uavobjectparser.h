@@ -100,6 +100,7 @@ struct ObjectInfo_s {
     quint32 id;
     bool isSingleInst;
     bool isSettings;
+    bool isSeqLocked; /** Readers bypass the object manager lock (flight only, not part of the ID) */
     AccessMode gcsAccess;
     AccessMode flightAccess;
     bool flightTelemetryAcked;
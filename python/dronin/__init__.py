@@ -3,6 +3,7 @@ from __future__ import absolute_import # Use 3.x import model.
 #-------------------------------------------------------------------------------
 __all__ = ()
 
+from . import compactlog
 from . import logfs
 from . import telemetry
 from . import uavo
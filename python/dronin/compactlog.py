@@ -0,0 +1,397 @@
+"""
+Implements the compact onboard log format.
+
+Copyright (C) 2016 dRonin, http://dronin.org
+
+Licensed under the GNU LGPL version 2.1 or any later version (see COPYING.LESSER)
+
+The log starts with the usual text header, then a "##compact" line and a
+schema of the objects in the log: a version byte, an object count byte, and
+for each object its ID (4 bytes), data size (2 bytes) and flags (1 byte).
+
+Each record that follows is the object's index in the schema (1 byte), the
+milliseconds since the previous record as a varint, the instance ID as a
+varint for multi instance objects, and the packed object data.
+
+Version 2 of the schema marks a compressed log.  The records are gathered into
+blocks, each its length and compressed length (2 bytes each, the latter 0 if
+the block is stored as is) and then the LZ4 block format compressed records.
+The data of objects flagged for it is delta coded: a mask with a bit for each
+byte, set for the bytes that changed, then those bytes XORed with the
+previous sample of the object.  Previous samples start out all zeroes.
+
+Each time logging starts again in the same stream (with LogOnArm, on every
+arm) the text header, divider and schema are written again.  Timestamps and
+previous samples start over from there.
+
+Ordinarily one would use the methods exposed by the telemetry module instead of
+this interface.
+"""
+
+try:
+    from struct import Struct
+except:
+    from structshim import Struct
+
+__all__ = [ "DIVIDER", "process_stream" ]
+
+DIVIDER = '##compact\n'
+
+HEADER = 'dRonin git hash:\n'
+HEADER_LINES = 3
+
+SCHEMA_VERSION = 1
+SCHEMA_VERSION_COMPRESSED = 2
+FLAG_MULTI_INSTANCE = 0x01
+FLAG_DELTA = 0x02
+
+# Limits of the LZ4 block format
+MIN_MATCH = 4
+RUN_MASK = 15
+
+schema_header_fmt = Struct("<BB")
+schema_entry_fmt = Struct("<LHB")
+block_header_fmt = Struct("<HH")
+
+def parse_varint(buf, offset):
+    """Returns the value and the offset after it, or None if buf ends first"""
+
+    value = 0
+    shift = 0
+
+    while offset < len(buf):
+        b = ord(buf[offset])
+        offset += 1
+
+        value |= (b & 0x7f) << shift
+        shift += 7
+
+        if not (b & 0x80):
+            return (value, offset)
+
+    return None
+
+def parse_schema(buf, offset):
+    """Returns the schema entries, whether the log is compressed and the
+    offset after them, or None if buf ends first.  Each entry is (object ID,
+    size, flags)."""
+
+    if len(buf) < offset + schema_header_fmt.size:
+        return None
+
+    (version, count) = schema_header_fmt.unpack_from(buf, offset)
+
+    if version not in (SCHEMA_VERSION, SCHEMA_VERSION_COMPRESSED):
+        raise ValueError("Unsupported compact log version %d" % (version))
+
+    offset += schema_header_fmt.size
+
+    if len(buf) < offset + count * schema_entry_fmt.size:
+        return None
+
+    return ([ schema_entry_fmt.unpack_from(buf, offset + i * schema_entry_fmt.size)
+            for i in range(count) ], version == SCHEMA_VERSION_COMPRESSED,
+            offset + count * schema_entry_fmt.size)
+
+def parse_length(buf, offset, length):
+    """Returns a length continued in 255s and the offset after it"""
+
+    while True:
+        if offset >= len(buf):
+            raise ValueError("Truncated block in compressed log")
+
+        b = ord(buf[offset])
+        offset += 1
+        length += b
+
+        if b != 255:
+            return (length, offset)
+
+def lz4_unblock(buf, raw_len):
+    """Decompresses an LZ4 format block that should come to raw_len bytes"""
+
+    out = bytearray()
+    offset = 0
+
+    while offset < len(buf):
+        token = ord(buf[offset])
+        offset += 1
+
+        lit_len = token >> 4
+        if lit_len == RUN_MASK:
+            (lit_len, offset) = parse_length(buf, offset, lit_len)
+
+        if offset + lit_len > len(buf) or len(out) + lit_len > raw_len:
+            raise ValueError("Bad block in compressed log")
+
+        out += buf[offset:offset + lit_len]
+        offset += lit_len
+
+        # The last sequence has no match
+        if offset == len(buf):
+            break
+
+        if offset + 2 > len(buf):
+            raise ValueError("Truncated block in compressed log")
+
+        match_offset = ord(buf[offset]) | (ord(buf[offset + 1]) << 8)
+        offset += 2
+
+        if match_offset == 0 or match_offset > len(out):
+            raise ValueError("Bad match in compressed log")
+
+        match_len = token & RUN_MASK
+        if match_len == RUN_MASK:
+            (match_len, offset) = parse_length(buf, offset, match_len)
+        match_len += MIN_MATCH
+
+        if len(out) + match_len > raw_len:
+            raise ValueError("Bad block in compressed log")
+
+        # The match may overlap what it produces
+        start = len(out) - match_offset
+        for i in range(match_len):
+            out.append(out[start + i])
+
+    if len(out) != raw_len:
+        raise ValueError("Block in compressed log has the wrong length")
+
+    return str(out)
+
+def parse_block(buf, offset):
+    """Returns the records of a compressed log block and the offset after it,
+    or None if buf ends first"""
+
+    if len(buf) < offset + block_header_fmt.size:
+        return None
+
+    (raw_len, packed_len) = block_header_fmt.unpack_from(buf, offset)
+    offset += block_header_fmt.size
+
+    data_len = packed_len if packed_len else raw_len
+
+    if len(buf) < offset + data_len:
+        return None
+
+    data = buf[offset:offset + data_len]
+
+    if packed_len:
+        data = lz4_unblock(data, raw_len)
+
+    return (data, offset + data_len)
+
+def undelta(buf, offset, prev):
+    """Applies a delta coded sample to the previous one, in place.  Returns
+    the offset after the sample."""
+
+    size = len(prev)
+    mask_len = (size + 7) // 8
+
+    mask = buf[offset:offset + mask_len]
+    offset += mask_len
+
+    if len(mask) < mask_len:
+        raise ValueError("Truncated record in compressed log")
+
+    for i in range(size):
+        if ord(mask[i // 8]) & (1 << (i % 8)):
+            if offset >= len(buf):
+                raise ValueError("Truncated record in compressed log")
+
+            prev[i] ^= ord(buf[offset])
+            offset += 1
+
+    return offset
+
+def parse_restart(buf, offset):
+    """Returns the offset after the header and divider of a log started again
+    in the same stream, False if there is none at offset, or None if buf ends
+    first"""
+
+    start = buf[offset:offset + len(HEADER)]
+
+    if not HEADER.startswith(start):
+        return False
+
+    if len(start) < len(HEADER):
+        return None
+
+    for i in range(HEADER_LINES):
+        offset = buf.find('\n', offset)
+        if offset < 0:
+            return None
+        offset += 1
+
+    if len(buf) < offset + len(DIVIDER):
+        return None
+
+    if buf[offset:offset + len(DIVIDER)] != DIVIDER:
+        raise ValueError("Log restarts in a format other than compact")
+
+    return offset + len(DIVIDER)
+
+def parse_record(buf, offset, schema, history=None):
+    """Returns (schema index, time delta, instance id, data offset) and the
+    offset after the record, or None if buf ends first.  For objects with a
+    history the data is instead in the history, at offset 0."""
+
+    if offset >= len(buf):
+        return None
+
+    idx = ord(buf[offset])
+
+    if idx >= len(schema):
+        raise ValueError("Bad object index %d in compact log" % (idx))
+
+    (obj_id, size, flags) = schema[idx]
+
+    r = parse_varint(buf, offset + 1)
+    if r is None:
+        return None
+    (delta, offset) = r
+
+    instance_id = None
+
+    if flags & FLAG_MULTI_INSTANCE:
+        r = parse_varint(buf, offset)
+        if r is None:
+            return None
+        (instance_id, offset) = r
+
+    if history is not None and history[idx] is not None:
+        offset = undelta(buf, offset, history[idx])
+
+        return ((idx, delta, instance_id, 0), offset)
+
+    if len(buf) < offset + size:
+        return None
+
+    return ((idx, delta, instance_id, offset), offset + size)
+
+def process_stream(uavo_defs):
+    """Generator function that parses a compact log following its divider.
+
+    Works like uavtalk.process_stream: you are expected to send more bytes,
+    or '' to it, until EOF.  Then send None."""
+
+    buf = ''
+    buf_offset = 0
+
+    schema = None
+    classes = None
+    compressed = False
+    history = None
+
+    timestamp = 0
+
+    received = 0
+
+    next_recv = None
+
+    while True:
+        if schema is None:
+            r = parse_schema(buf, buf_offset)
+
+            if r is not None:
+                (schema, compressed, buf_offset) = r
+
+                history = [ bytearray(size) if flags & FLAG_DELTA else None
+                        for (obj_id, size, flags) in schema ]
+
+                # Objects this tree does not know, or knows with another
+                # size, are skipped over using the size in the schema.
+                classes = []
+
+                for (obj_id, size, flags) in schema:
+                    obj = uavo_defs.get('{0:08x}'.format(obj_id))
+
+                    if obj is not None and obj.get_size_of_data() != size:
+                        print "Size of object %s differs from log, skipping" % (obj._name)
+                        obj = None
+
+                    classes.append(obj)
+
+                continue
+        else:
+            # Records, each with the buffer its data is in
+            records = None
+
+            try:
+                restart = parse_restart(buf, buf_offset)
+
+                if restart:
+                    buf_offset = restart
+                    schema = None
+                    timestamp = 0
+                    continue
+                elif restart is None:
+                    pass
+                elif compressed:
+                    r = parse_block(buf, buf_offset)
+
+                    if r is not None:
+                        (block, buf_offset) = r
+
+                        records = []
+                        block_offset = 0
+                        while block_offset < len(block):
+                            r = parse_record(block, block_offset, schema,
+                                    history)
+                            if r is None:
+                                raise ValueError("Truncated record in compressed log")
+
+                            (record, block_offset) = r
+                            idx = record[0]
+
+                            if history[idx] is not None:
+                                data = str(history[idx])
+                            else:
+                                data = block
+
+                            records.append((record, data))
+                else:
+                    r = parse_record(buf, buf_offset, schema)
+
+                    if r is not None:
+                        (record, buf_offset) = r
+                        records = [ (record, buf) ]
+            except ValueError as e:
+                # There is nothing to resync on; give up on the rest, but
+                # keep taking data until EOF as the caller expects
+                print e
+
+                while (yield None) is not None:
+                    pass
+
+                return
+
+            for ((idx, delta, instance_id, data_offset), data) in records or []:
+                timestamp += delta
+
+                obj = classes[idx]
+
+                if obj is not None:
+                    objInstance = obj.from_bytes(data, timestamp, instance_id,
+                            offset=data_offset)
+
+                    received += 1
+                    if not (received % 20000):
+                        print "received %d objs"%(received)
+
+                    next_recv = yield objInstance
+
+                    if next_recv is not None and next_recv != '':
+                        buf = buf[buf_offset:] + next_recv
+                        buf_offset = 0
+
+            if records is not None:
+                continue
+
+        # Out of data for the next step
+        rx = yield None
+
+        if rx is None:
+            return
+
+        buf = buf[buf_offset:] + rx
+        buf_offset = 0
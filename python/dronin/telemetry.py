@@ -10,7 +10,7 @@ import socket
 import time
 import errno
 
-import uavtalk, uavo_collection, uavo
+import uavtalk, compactlog, uavo_collection, uavo
 
 import os
 
@@ -26,7 +26,7 @@ class TelemetryBase():
 
     def __init__(self, githash=None, service_in_iter=True,
             iter_blocks=True, use_walltime=True, do_handshaking=False,
-            gcs_timestamps=False, name=None):
+            gcs_timestamps=False, compact_log=False, name=None):
 
         """Instantiates a telemetry instance.  Called only by derived classes.
          - githash: revision control id of the UAVO's used to communicate.
@@ -43,6 +43,8 @@ class TelemetryBase():
              protocol.
          - gcs_timestamps: if true, this means we are reading from a file with
              the GCS timestamp protocol.
+         - compact_log: if true, this means we are reading the compact onboard
+             log format instead of UAVTalk.
          - name: a filename to store into .filename for legacy purposes
         """
 
@@ -58,8 +60,11 @@ class TelemetryBase():
         self.githash = githash
 
         self.uavo_defs = uavo_defs
-        self.uavtalk_generator = uavtalk.process_stream(uavo_defs,
-            use_walltime=use_walltime, gcs_timestamps=gcs_timestamps)
+        if compact_log:
+            self.uavtalk_generator = compactlog.process_stream(uavo_defs)
+        else:
+            self.uavtalk_generator = uavtalk.process_stream(uavo_defs,
+                use_walltime=use_walltime, gcs_timestamps=gcs_timestamps)
 
         self.uavtalk_generator.send(None)
 
@@ -499,7 +504,7 @@ class FileTelemetry(TelemetryBase):
             #    First line is "dRonin git hash:" or "Tau Labs git hash:"
             #    Second line is the actual git hash
             #    Third line is the UAVO hash
-            #    Fourth line is "##"a
+            #    Fourth line is "##", or "##compact" for the compact format
 
             # Scan up to 100 "lines" looking for the signature, in case
             # there's garbage at the beginning of the log
@@ -528,7 +533,7 @@ class FileTelemetry(TelemetryBase):
 
             TelemetryBase.__init__(self, service_in_iter=False, iter_blocks=True,
                 do_handshaking=False, githash=githash, use_walltime=False,
-                *args, **kwargs)
+                compact_log=(divider == compactlog.DIVIDER), *args, **kwargs)
         else:
             TelemetryBase.__init__(self, service_in_iter=False, iter_blocks=True,
                 do_handshaking=False, use_walltime=False, *args, **kwargs)
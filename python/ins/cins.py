@@ -19,35 +19,40 @@ class CINS:
 
 	GRAV = 9.805
 
-	def __init__(self):
+	def __init__(self, private=False):
 		""" Creates the CINS class. 
 
 		Important variables are
 		  * X  - the vector of state variables
 		  * Xd - the vector of state derivatives for state and inputs
 		  * Y  - the vector of outputs for current state value
+
+		With private set the instance gets a filter of its own, so several
+		can run side by side (also on separate threads), otherwise it uses
+		the filter shared through the ins module functions.
 		"""
 
 		self.state = []
+		self.filter = ins.new_filter() if private else None
 
 	def configure(self, mag_var=None, gyro_var=None, accel_var=None, baro_var=None, gps_var=None):
 		""" configure the INS parameters """
 
 		if mag_var is not None:
-			ins.configure(mag_var=mag_var)
+			ins.configure(mag_var=mag_var, filter=self.filter)
 		if gyro_var is not None:
-			ins.configure(gyro_var=gyro_var)
+			ins.configure(gyro_var=gyro_var, filter=self.filter)
 		if accel_var is not None:
-			ins.configure(accel_var=accel_var)
+			ins.configure(accel_var=accel_var, filter=self.filter)
 		if baro_var is not None:
-			ins.configure(baro_var=baro_var)
+			ins.configure(baro_var=baro_var, filter=self.filter)
 		if gps_var is not None:
-			ins.configure(gps_var=gps_var)
+			ins.configure(gps_var=gps_var, filter=self.filter)
 
 	def prepare(self):
 		""" prepare the C INS wrapper
 		"""
-		self.state = ins.init()
+		self.state = ins.init(self.filter)
 		self.configure(
 			mag_var=default_mag_var,
 			gyro_var=default_gyro_var,
@@ -60,7 +65,7 @@ class CINS:
 		""" Perform the prediction step
 		"""
 
-		self.state = ins.prediction(gyros, accels, dT)
+		self.state = ins.prediction(gyros, accels, dT, self.filter)
 
 	def correction(self, pos=None, vel=None, mag=None, baro=None):
 		""" Perform the INS correction based on the provided corrections
@@ -92,7 +97,7 @@ class CINS:
 			sensors = sensors | 0x0200
 			Z[9] = baro
 
-		self.state = ins.correction(Z, sensors)
+		self.state = ins.correction(Z, sensors, self.filter)
 
 def test():
 	""" test the INS with simulated data
@@ -7,6 +7,28 @@
 
 #include <insgps.h>
 
+/* The filter used when a call doesn't pass one from new_filter() */
+static struct insgps_ctx *module_ctx;
+
+static void free_filter(PyObject *capsule)
+{
+	free(PyCapsule_GetPointer(capsule, "ins.filter"));
+}
+
+/**
+ * get_ctx - find the filter a call should work on
+ * @param[in] filter capsule from new_filter(), or NULL or None for the
+ * module's own filter
+ * @return the filter, NULL with an exception set if it isn't one
+ */
+static struct insgps_ctx *get_ctx(PyObject *filter)
+{
+	if (filter == NULL || filter == Py_None)
+		return module_ctx;
+
+	return (struct insgps_ctx *) PyCapsule_GetPointer(filter, "ins.filter");
+}
+
 int not_doublevector(PyArrayObject *vec)
 {
 	if (PyArray_TYPE(vec) != NPY_DOUBLE) {
@@ -94,10 +116,10 @@ static bool parseFloatVec3(PyArrayObject *vec_in, float *vec_out)
  * pack_state put the state information into an array
  */
 static PyObject*
-pack_state(PyObject* self)
+pack_state(struct insgps_ctx *ctx)
 {
 	float pos[3], vel[3], q[4], gyro_bias[3], accel_bias[3];        
-	INSGetState(pos, vel, q, gyro_bias, accel_bias);
+	insgps_get_state(ctx, pos, vel, q, gyro_bias, accel_bias);
 
 	const int N = 16;
 	int nd = 1;
@@ -135,35 +157,42 @@ pack_state(PyObject* self)
  *  - gyro
  *  - accel
  *  - dT
+ *  - filter (optional)
  * @return state
  */
 static PyObject*
 prediction(PyObject* self, PyObject* args)
 {
 	PyArrayObject *vec_gyro, *vec_accel;
+	PyObject *filter = NULL;
+	struct insgps_ctx *ctx;
 	float gyro_data[3], accel_data[3];
 	float dT;
 
-	if (!PyArg_ParseTuple(args, "O!O!f", &PyArray_Type, &vec_gyro,
-				   &PyArray_Type, &vec_accel, &dT))  return NULL;
+	if (!PyArg_ParseTuple(args, "O!O!f|O", &PyArray_Type, &vec_gyro,
+				   &PyArray_Type, &vec_accel, &dT, &filter))  return NULL;
 	if (NULL == vec_gyro)  return NULL;
 	if (NULL == vec_accel)  return NULL;
+	if (NULL == (ctx = get_ctx(filter)))  return NULL;
 
 	if (!parseFloatVec3(vec_gyro, gyro_data))
 		return NULL;
 	if (!parseFloatVec3(vec_accel, accel_data))
 		return NULL;
 
-	INSStatePrediction(gyro_data, accel_data, dT);
-	INSCovariancePrediction(dT);
+	// Let other threads run their own filters meanwhile
+	Py_BEGIN_ALLOW_THREADS
+	insgps_state_prediction(ctx, gyro_data, accel_data, dT);
+	insgps_covariance_prediction(ctx, dT);
+	Py_END_ALLOW_THREADS
 
 	if (false) {
 		const float zeros[3] = {0,0,0};
-		INSSetGyroBias(zeros);
-		INSSetAccelBias(zeros);
+		insgps_set_gyro_bias(ctx, zeros);
+		insgps_set_accel_bias(ctx, zeros);
 	}
 
-	return pack_state(self);
+	return pack_state(ctx);
 }
  
 /**
@@ -172,25 +201,31 @@ prediction(PyObject* self, PyObject* args)
  * @params[in] args
  *  - Z - vector of measurements (position, velocity, mag, baro)
  *  - sensors - binary flags for which sensors should be used
+ *  - filter (optional)
  * @return state
  */
 static PyObject*
 correction(PyObject* self, PyObject* args)
 {
 	PyArrayObject *vec_z;
+	PyObject *filter = NULL;
+	struct insgps_ctx *ctx;
 	float z[10];
 	int sensors;
 
-	if (!PyArg_ParseTuple(args, "O!i", &PyArray_Type, &vec_z,
-				   &sensors))  return NULL;
+	if (!PyArg_ParseTuple(args, "O!i|O", &PyArray_Type, &vec_z,
+				   &sensors, &filter))  return NULL;
 	if (NULL == vec_z)  return NULL;
+	if (NULL == (ctx = get_ctx(filter)))  return NULL;
 
 	if (!parseFloatVecN(vec_z, z, 10))
 		return NULL;
 
-	INSCorrection(&z[6], &z[0], &z[3], z[9], sensors);
+	Py_BEGIN_ALLOW_THREADS
+	insgps_correction(ctx, &z[6], &z[0], &z[3], z[9], sensors);
+	Py_END_ALLOW_THREADS
 
-	return pack_state(self);
+	return pack_state(ctx);
 }
 
 /**
@@ -201,51 +236,57 @@ correction(PyObject* self, PyObject* args)
  *  - accel_var
  *  - gyro_var
  *  - baro_var
+ *  - filter (optional)
  * @return nothing
  */
 static PyObject*
 configure(PyObject* self, PyObject* args, PyObject *kwarg)
 {
-	static char *kwlist[] = {"mag_var", "accel_var", "gyro_var", "baro_var", "gps_var", NULL};
+	static char *kwlist[] = {"mag_var", "accel_var", "gyro_var", "baro_var", "gps_var", "filter", NULL};
 
 	PyArrayObject *mag_var = NULL, *accel_var = NULL, *gyro_var = NULL, *gps_var = NULL;
+	PyObject *filter = NULL;
+	struct insgps_ctx *ctx;
 	float baro_var = 0.0f;
 
-	if (!PyArg_ParseTupleAndKeywords(args, kwarg, "|OOOfO", kwlist,
-		 &mag_var, &accel_var, &gyro_var, &baro_var, &gps_var)) {
+	if (!PyArg_ParseTupleAndKeywords(args, kwarg, "|OOOfOO", kwlist,
+		 &mag_var, &accel_var, &gyro_var, &baro_var, &gps_var, &filter)) {
 		return NULL;
 	}
 
+	if (NULL == (ctx = get_ctx(filter)))
+		return NULL;
+
 	if (mag_var) {
 		float mag[3];
 		if (!parseFloatVec3(mag_var, mag))
 			return NULL;
-		INSSetMagVar(mag);
+		insgps_set_mag_var(ctx, mag);
 	}
 
 	if (accel_var) {
 		float accel[3];
 		if (!parseFloatVec3(accel_var, accel))
 			return NULL;
-		INSSetAccelVar(accel);
+		insgps_set_accel_var(ctx, accel);
 	}
 
 	if (gyro_var) {
 		float gyro[3];
 		if (!parseFloatVec3(gyro_var, gyro))
 			return NULL;
-		INSSetGyroVar(gyro);
+		insgps_set_gyro_var(ctx, gyro);
 	}
 
 	if (baro_var != 0.0f) {
-		INSSetBaroVar(baro_var);
+		insgps_set_baro_var(ctx, baro_var);
 	}
 
 	if (gps_var) {
 		float gps[3];
 		if (!parseFloatVec3(gps_var, gps))
 			return NULL;
-		INSSetPosVelVar(gps[0], gps[1], gps[2]);
+		insgps_set_pos_vel_var(ctx, gps[0], gps[1], gps[2]);
 	}
 
 	return Py_None;
@@ -254,17 +295,22 @@ configure(PyObject* self, PyObject* args, PyObject *kwarg)
 static PyObject*
 set_state(PyObject* self, PyObject* args, PyObject *kwarg)
 {
-	static char *kwlist[] = {"pos", "vel", "q", "gyro_bias", "accel_bias", NULL};
+	static char *kwlist[] = {"pos", "vel", "q", "gyro_bias", "accel_bias", "filter", NULL};
 
 	PyArrayObject *vec_pos = NULL, *vec_vel = NULL, *vec_q = NULL, *vec_gyro_bias = NULL, *vec_accel_bias = NULL;
+	PyObject *filter = NULL;
+	struct insgps_ctx *ctx;
 
-	if (!PyArg_ParseTupleAndKeywords(args, kwarg, "|OOOOO", kwlist,
-		 &vec_pos, &vec_vel, &vec_q, &vec_gyro_bias, &vec_accel_bias)) {
+	if (!PyArg_ParseTupleAndKeywords(args, kwarg, "|OOOOOO", kwlist,
+		 &vec_pos, &vec_vel, &vec_q, &vec_gyro_bias, &vec_accel_bias, &filter)) {
 		return NULL;
 	}
 
+	if (NULL == (ctx = get_ctx(filter)))
+		return NULL;
+
 	float pos[3], vel[3], q[4], gyro_bias[3], accel_bias[3];
-	INSGetState(pos, vel, q, gyro_bias, accel_bias);
+	insgps_get_state(ctx, pos, vel, q, gyro_bias, accel_bias);
 
 	// Overwrite state with any that were passed in
 	if (vec_pos) {
@@ -288,7 +334,7 @@ set_state(PyObject* self, PyObject* args, PyObject *kwarg)
 			return NULL;
 	}
 
-	INSSetState(pos, vel, q, gyro_bias, accel_bias);
+	insgps_set_state(ctx, pos, vel, q, gyro_bias, accel_bias);
 
 	return Py_None;
 }
@@ -297,12 +343,36 @@ set_state(PyObject* self, PyObject* args, PyObject *kwarg)
 static PyObject*
 init(PyObject* self, PyObject* args)
 {
-	INSGPSInit();
+	PyObject *filter = NULL;
+	struct insgps_ctx *ctx;
+
+	if (!PyArg_ParseTuple(args, "|O", &filter))  return NULL;
+	if (NULL == (ctx = get_ctx(filter)))  return NULL;
+
+	insgps_init(ctx);
 
 	const float Be[] = {400, 0, 1600};
-	INSSetMagNorth(Be);
+	insgps_set_mag_north(ctx, Be);
 
-	return pack_state(self);	
+	return pack_state(ctx);	
+}
+
+/**
+ * new_filter - create a filter of its own for the caller, which can be
+ * passed to the other calls and run on another thread.  Call init() on it
+ * before use, as for the module's filter.
+ * @return the filter
+ */
+static PyObject*
+new_filter(PyObject* self, PyObject* args)
+{
+	struct insgps_ctx *ctx = malloc(insgps_ctx_size());
+	if (ctx == NULL)
+		return PyErr_NoMemory();
+
+	insgps_init(ctx);
+
+	return PyCapsule_New(ctx, "ins.filter", free_filter);
 }
 
 static PyMethodDef InsMethods[] =
@@ -312,6 +382,7 @@ static PyMethodDef InsMethods[] =
 	{"correction", correction, METH_VARARGS, "Apply state correction based on measured sensors."},
 	{"configure", (PyCFunction)configure, METH_VARARGS|METH_KEYWORDS, "Configure EKF parameters."},
 	{"set_state", (PyCFunction)set_state, METH_VARARGS|METH_KEYWORDS, "Set the EKF state."},
+	{"new_filter", new_filter, METH_NOARGS, "Create an independent EKF."},
 	{NULL, NULL, 0, NULL}
 };
  
@@ -320,6 +391,10 @@ initins(void)
 {
 	(void) Py_InitModule("ins", InsMethods);
 	import_array();
-	init(NULL, NULL);
-	INSGPSInit();
+
+	module_ctx = malloc(insgps_ctx_size());
+	if (module_ctx == NULL)
+		return;
+
+	insgps_init(module_ctx);
 }
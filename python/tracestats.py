@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+"""
+Latency statistics from the TraceEvents tracepoints.
+
+Needs firmware built with DIAG_TRACE=YES.  Reads an onboard log, prints a
+latency histogram for each stage of the control path measured from the gyro
+sample that started the cycle, then plots a timeline of the cycles and the
+histograms.
+
+Only logs have every TraceEvents update.  The flight side sets it several
+times a period, faster than telemetry could send it, so it is not sent live.
+"""
+
+from __future__ import print_function
+
+import sys, os
+
+STAGES = ['GyroReceive', 'InsPredict', 'PidCompute', 'Mixer', 'ServoUpdate']
+
+# Histogram bin edges, in microseconds
+BINS = [0, 50, 100, 200, 400, 800, 1600, 3200]
+
+def collect_events(uavo_list):
+    """ Flattens the TraceEvents updates into one list of (time, point). """
+    from dronin.uavo import UAVO_TraceEvents
+
+    events = []
+    dropped = 0
+
+    for obj in uavo_list:
+        if not isinstance(obj, UAVO_TraceEvents):
+            continue
+
+        for i in range(obj.Count):
+            events.append((obj.Time[i], obj.Point[i]))
+
+        dropped = obj.Dropped
+
+    return events, dropped
+
+def split_cycles(events):
+    """ Splits the events into cycles, each starting at a gyro sample.
+
+    Returns a list of dicts mapping stage name to the time since the gyro
+    sample.  Stages may be missing, e.g. INS predictions run in their own
+    task and not for every sample.
+    """
+
+    cycles = []
+    start = None
+    cycle = None
+
+    for t, point in events:
+        name = STAGES[point] if point < len(STAGES) else None
+
+        if name == 'GyroReceive':
+            if cycle is not None:
+                cycles.append(cycle)
+            start = t
+            cycle = { 'start' : t }
+        elif cycle is not None and name is not None and name not in cycle:
+            cycle[name] = (t - start) & 0xFFFFFFFF
+
+    if cycle is not None:
+        cycles.append(cycle)
+
+    return cycles
+
+def print_histogram(name, values):
+    if not values:
+        print('%s: no samples' % name)
+        return
+
+    values = sorted(values)
+    print('%s: %d samples, median %d us, 99%% %d us, max %d us' % (name,
+            len(values), values[len(values) // 2],
+            values[int(len(values) * 0.99)], values[-1]))
+
+    edges = BINS + [None]
+    for lo, hi in zip(edges[:-1], edges[1:]):
+        count = len([v for v in values if v >= lo and (hi is None or v < hi)])
+        label = '%5d-%-5s' % (lo, hi if hi is not None else '')
+        print('  %s us %7d %s' % (label, count,
+                '#' * int(60 * count / len(values))))
+
+def main():
+    sys.path.insert(1, os.path.dirname(sys.path[0]))
+    from dronin import telemetry
+
+    uavo_list = telemetry.get_telemetry_by_args(desc="Control path tracepoint statistics")
+
+    if not isinstance(uavo_list, telemetry.FileTelemetry):
+        print("TraceEvents is only complete in logs, give a log file")
+        sys.exit(1)
+
+    events, dropped = collect_events(uavo_list)
+    cycles = split_cycles(events)
+
+    print('%d tracepoints, %d dropped on the flight side, %d cycles' % (
+            len(events), dropped, len(cycles)))
+
+    for name in STAGES[1:]:
+        print_histogram(name, [c[name] for c in cycles if name in c])
+
+    periods = [(b['start'] - a['start']) & 0xFFFFFFFF
+            for a, b in zip(cycles[:-1], cycles[1:])]
+    print_histogram('Gyro period', periods)
+
+    import matplotlib.pyplot as plt
+
+    fig, (timeline, hist) = plt.subplots(2, 1)
+
+    for point, name in enumerate(STAGES):
+        times = [t * 1e-6 for t, p in events if p == point]
+        timeline.plot(times, [point] * len(times), '|', label=name)
+    timeline.set_yticks(range(len(STAGES)))
+    timeline.set_yticklabels(STAGES)
+    timeline.set_xlabel('Time (s)')
+
+    for name in STAGES[1:]:
+        values = [c[name] for c in cycles if name in c]
+        if values:
+            hist.hist(values, bins=100, histtype='step', label=name)
+    hist.set_xlabel('Latency from gyro sample (us)')
+    hist.legend()
+
+    plt.show()
+
+if __name__ == "__main__":
+    main()